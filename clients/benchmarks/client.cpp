@@ -339,6 +339,38 @@ try
             "                           Used in partial SVD functions.\n"
             "                           ")
 
+        // randomized SVD options
+        ("p",
+         value<rocblas_int>(),
+            "The oversampling parameter.\n"
+            "                           Only applicable to gesvdr.\n"
+            "                           ")
+
+        ("niters",
+         value<rocblas_int>(),
+            "The number of power iterations.\n"
+            "                           Only applicable to gesvdr.\n"
+            "                           ")
+
+        ("rankA",
+         value<rocblas_int>(),
+            "The rank of the random input matrix. Defaults to k + p.\n"
+            "                           Only applicable to gesvdr.\n"
+            "                           ")
+
+        // syevAuto options
+        ("alg",
+         value<char>(),
+            "A = chosen by the table of the device, D = syevd, J = syevj, X = syevdx.\n"
+            "                           The algorithm used by syev_auto/heev_auto.\n"
+            "                           ")
+
+        ("tune_output",
+         value<std::string>(),
+            "The file to which syev_auto_tune/heev_auto_tune write the table of the device.\n"
+            "                           Defaults to syev_auto_<arch>.json.\n"
+            "                           ")
+
         ("vl",
          value<double>(),
             "Lower bound of half-open interval (vl, vu].\n"
@@ -369,7 +401,8 @@ try
         ("tolerance",
          value<double>(),
             "Absolute tolerance at which convergence is accepted.\n"
-            "                           Used in iterative Jacobi functions.\n"
+            "                           Used in iterative Jacobi functions. For iterative sparse solvers,\n"
+            "                           the tolerance is relative to the norm of the right-hand side.\n"
             "                           ")
 
         ("sort_eig",
@@ -397,6 +430,30 @@ try
             "                           2 = AMD reordering, 3 = METIS reordering.\n"
             "                           ")
 
+        ("perturb",
+         value<double>(),
+            "Static pivot perturbation. Pivots with magnitude smaller than perturb\n"
+            "                           are replaced by +/-perturb. Used in LDL' sparse solvers.\n"
+            "                           ")
+
+        ("maxiter",
+         value<rocblas_int>(),
+            "Maximum number of iterations.\n"
+            "                           Used in iterative sparse solvers.\n"
+            "                           ")
+
+        ("restart",
+         value<rocblas_int>(),
+            "Number of iterations before GMRES is restarted.\n"
+            "                           ")
+
+        ("precond",
+         value<rocblas_int>(),
+            "0 = no preconditioner, 1 = IC0 preconditioner,\n"
+            "                           2 = ILU0 preconditioner.\n"
+            "                           Used in iterative sparse solvers.\n"
+            "                           ")
+
         // other options
         // ("direct",
         //  value<char>()->default_value('F'),
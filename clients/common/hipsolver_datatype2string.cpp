@@ -222,3 +222,20 @@ hipsolverEigRange_t char2hipsolver_erange(char value)
         throw std::invalid_argument("Invalid character");
     }
 }
+
+hipsolverSyevAlgorithm_t char2hipsolver_syev_alg(char value)
+{
+    switch(value)
+    {
+    case 'A':
+        return HIPSOLVER_SYEV_ALG_AUTO;
+    case 'D':
+        return HIPSOLVER_SYEV_ALG_SYEVD;
+    case 'J':
+        return HIPSOLVER_SYEV_ALG_SYEVJ;
+    case 'X':
+        return HIPSOLVER_SYEV_ALG_SYEVDX;
+    default:
+        throw std::invalid_argument("Invalid character");
+    }
+}
@@ -22,6 +22,10 @@
  * ************************************************************************ */
 
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 #include "hipsolver.h"
 #include "utility.hpp"
@@ -109,6 +113,62 @@ double get_time_us_sync(hipStream_t stream)
     return get_time_us_no_sync();
 }
 
+/* ============================================================================================ */
+/*  host memory:*/
+
+/* Read a field (in KiB) of the status file of the process
+ */
+static double read_status_kb(const char* field)
+{
+    double kb = std::nan("");
+#ifdef __linux__
+    FILE* status = fopen("/proc/self/status", "r");
+    if(!status)
+        return kb;
+
+    char   line[256];
+    size_t len = strlen(field);
+    while(fgets(line, sizeof(line), status))
+    {
+        if(strncmp(line, field, len) == 0)
+        {
+            kb = atof(line + len);
+            break;
+        }
+    }
+    fclose(status);
+#endif
+    return kb;
+}
+
+/* Host memory (in KiB): current resident set size
+ */
+double get_host_memory_kb()
+{
+    return read_status_kb("VmRSS:");
+}
+
+/* Host memory (in KiB): peak resident set size since the last reset
+ */
+double get_host_peak_memory_kb()
+{
+    return read_status_kb("VmHWM:");
+}
+
+/* Host memory: reset the peak resident set size to the current resident set size
+ */
+void reset_host_peak_memory()
+{
+#ifdef __linux__
+    FILE* refs = fopen("/proc/self/clear_refs", "w");
+    if(refs)
+    {
+        fputs("5", refs);
+        fclose(refs);
+    }
+#endif
+}
+
 #ifdef __cplusplus
 }
 #endif
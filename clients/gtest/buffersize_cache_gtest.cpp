@@ -0,0 +1,137 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_BUFFERSIZE_CACHE : public ::testing::Test
+{
+protected:
+    checkin_misc_BUFFERSIZE_CACHE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_BUFFERSIZE_CACHE, normal_execution)
+{
+    hipsolver_local_handle handle;
+    size_t                 hits, misses;
+    int                    lwork1, lwork2, lwork3;
+
+    hipsolverStatus_t stat = hipsolverGetBufferSizeCacheStats(handle, &hits, &misses);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_EQ(hits, 0);
+    EXPECT_EQ(misses, 0);
+
+    // first query is a miss, repeated query is a hit with the same size
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrf_bufferSize(handle, 100, 100, nullptr, 100, &lwork1),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrf_bufferSize(handle, 100, 100, nullptr, 100, &lwork2),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork1, lwork2);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBufferSizeCacheStats(handle, &hits, &misses),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hits, 1);
+    EXPECT_EQ(misses, 1);
+
+    // different dimensions or precision are different entries
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrf_bufferSize(handle, 200, 100, nullptr, 200, &lwork3),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, 100, 100, nullptr, 100, &lwork3),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBufferSizeCacheStats(handle, &hits, &misses),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hits, 1);
+    EXPECT_EQ(misses, 3);
+
+    // changing the deterministic mode invalidates the entries
+    EXPECT_ROCBLAS_STATUS(hipsolverSetDeterministicMode(handle, HIPSOLVER_DETERMINISTIC_RESULTS),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrf_bufferSize(handle, 100, 100, nullptr, 100, &lwork2),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBufferSizeCacheStats(handle, &hits, &misses),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hits, 1);
+    EXPECT_EQ(misses, 4);
+
+    // clearing the cache resets the counters
+    EXPECT_ROCBLAS_STATUS(hipsolverClearBufferSizeCache(handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBufferSizeCacheStats(handle, &hits, &misses),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hits, 0);
+    EXPECT_EQ(misses, 0);
+}
+
+TEST_F(checkin_misc_BUFFERSIZE_CACHE, failed_query)
+{
+    hipsolver_local_handle handle;
+    size_t                 hits, misses;
+    int                    lwork;
+
+    hipsolverStatus_t stat = hipsolverGetBufferSizeCacheStats(handle, &hits, &misses);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+
+    // queries with invalid sizes are not stored
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrf_bufferSize(handle, -1, 100, nullptr, 100, &lwork),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrf_bufferSize(handle, -1, 100, nullptr, 100, &lwork),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBufferSizeCacheStats(handle, &hits, &misses),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hits, 0);
+    EXPECT_EQ(misses, 2);
+}
+
+TEST_F(checkin_misc_BUFFERSIZE_CACHE, get_null_handle)
+{
+    size_t hits, misses;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBufferSizeCacheStats(nullptr, &hits, &misses),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+}
+
+TEST_F(checkin_misc_BUFFERSIZE_CACHE, get_null_counters)
+{
+    hipsolver_local_handle handle;
+    size_t                 hits, misses;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBufferSizeCacheStats(handle, nullptr, &misses),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBufferSizeCacheStats(handle, &hits, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+TEST_F(checkin_misc_BUFFERSIZE_CACHE, clear_null_handle)
+{
+    EXPECT_ROCBLAS_STATUS(hipsolverClearBufferSizeCache(nullptr), HIPSOLVER_STATUS_NOT_INITIALIZED);
+}
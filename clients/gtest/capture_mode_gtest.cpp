@@ -0,0 +1,253 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "capture_mode.hpp"
+#include "clientcommon.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_CAPTURE_MODE : public ::testing::Test
+{
+protected:
+    checkin_misc_CAPTURE_MODE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_CAPTURE_MODE, workspace)
+{
+    hipsolver::capture_policy policy;
+
+    // with the mode off, the workspace is grown as usual, even if one is reserved
+    policy.reserved = 1024;
+    EXPECT_EQ(policy.workspace(0), hipsolver::workspace_managed);
+    EXPECT_EQ(policy.workspace(4096), hipsolver::workspace_managed);
+
+    // in capture-safe mode, calls take the reserved workspace and never grow it
+    policy.safe = true;
+    EXPECT_EQ(policy.workspace(0), hipsolver::workspace_unchanged);
+    EXPECT_EQ(policy.workspace(512), hipsolver::workspace_reserved);
+    EXPECT_EQ(policy.workspace(1024), hipsolver::workspace_reserved);
+    EXPECT_EQ(policy.workspace(1025), hipsolver::workspace_refused);
+
+    // without a reservation, only calls that need no workspace go through
+    policy.reserved = 0;
+    EXPECT_EQ(policy.workspace(0), hipsolver::workspace_unchanged);
+    EXPECT_EQ(policy.workspace(1), hipsolver::workspace_refused);
+
+    // enabling the mode pins the workspace grown so far, unless one has been reserved
+    EXPECT_EQ(policy.pin_size(4096), 4096);
+    policy.reserved = 1024;
+    EXPECT_EQ(policy.pin_size(4096), 1024);
+    EXPECT_EQ(policy.pin_size(0), 1024);
+}
+
+TEST_F(checkin_misc_CAPTURE_MODE, steps)
+{
+    hipsolver::capture_policy policy;
+
+    const hipsolver::capture_step steps[] = {hipsolver::capture_step_allocate,
+                                             hipsolver::capture_step_synchronize,
+                                             hipsolver::capture_step_host};
+
+    // nothing is refused with the mode off
+    for(hipsolver::capture_step step : steps)
+        EXPECT_TRUE(policy.allows(step));
+    EXPECT_TRUE(policy.allows_results(0, 8));
+    EXPECT_TRUE(policy.allows_stride_detection(false));
+
+    // in capture-safe mode, steps that allocate, wait or run on the host are refused
+    policy.safe = true;
+    for(hipsolver::capture_step step : steps)
+        EXPECT_FALSE(policy.allows(step));
+
+    // the parameters of a Jacobi solver must already hold the results of the batch
+    EXPECT_FALSE(policy.allows_results(0, 1));
+    EXPECT_FALSE(policy.allows_results(4, 8));
+    EXPECT_TRUE(policy.allows_results(8, 8));
+    EXPECT_TRUE(policy.allows_results(8, 1));
+
+    // and only the layouts of pointer arrays already seen are used
+    EXPECT_FALSE(policy.allows_stride_detection(false));
+    EXPECT_TRUE(policy.allows_stride_detection(true));
+}
+
+TEST_F(checkin_misc_CAPTURE_MODE, normal_execution)
+{
+    hipsolver_local_handle handle;
+    hipsolverCaptureMode_t mode;
+
+    hipsolverStatus_t stat = hipsolverGetCaptureMode(handle, &mode);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_EQ(mode, HIPSOLVER_CAPTURE_MODE_OFF);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCaptureMode(handle, hipsolverCaptureMode_t(0)),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+    int n = 256, lwork;
+
+    device_strided_batch_vector<float> dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<int>   dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int>   dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    std::vector<float> hA(n * n), hLU(n * n), hGraph(n * n);
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < n; i++)
+            hA[i + j * n] = (i == j) ? n : float((i * 7 + j * 3) % 5) - 2;
+    CHECK_HIP_ERROR(hipMemcpy(dA.data(), hA.data(), sizeof(float) * n * n, hipMemcpyHostToDevice));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrf_bufferSize(handle, n, n, dA.data(), n, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    if(lwork <= 1)
+        return;
+
+    // a new handle has no workspace to pin, so calls that need one are refused
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCaptureMode(handle, HIPSOLVER_CAPTURE_MODE_SAFE),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetCaptureMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_CAPTURE_MODE_SAFE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSgetrf(handle, n, n, dA.data(), n, nullptr, 0, dIpiv.data(), dInfo.data()),
+        HIPSOLVER_STATUS_NOT_CAPTURABLE);
+
+    // they take the workspace reserved up front
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, lwork), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSgetrf(handle, n, n, dA.data(), n, nullptr, 0, dIpiv.data(), dInfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(
+        hipMemcpy(hLU.data(), dA.data(), sizeof(float) * n * n, hipMemcpyDeviceToHost));
+
+    // the same call is recorded into a graph, which repeats it
+    hipStream_t    stream, old_stream;
+    hipGraph_t     graph;
+    hipGraphExec_t exec;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    EXPECT_ROCBLAS_STATUS(hipsolverGetStream(handle, &old_stream), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetStream(handle, stream), HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA.data(), hA.data(), sizeof(float) * n * n, hipMemcpyHostToDevice));
+
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSgetrf(handle, n, n, dA.data(), n, nullptr, 0, dIpiv.data(), dInfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, 2 * lwork),
+                          HIPSOLVER_STATUS_NOT_CAPTURABLE);
+    CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+    CHECK_HIP_ERROR(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+
+    for(int launch = 0; launch < 2; launch++)
+    {
+        CHECK_HIP_ERROR(
+            hipMemcpy(dA.data(), hA.data(), sizeof(float) * n * n, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipGraphLaunch(exec, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hGraph.data(), dA.data(), sizeof(float) * n * n, hipMemcpyDeviceToHost));
+        for(int i = 0; i < n * n; i++)
+            EXPECT_NEAR(hGraph[i], hLU[i], 1e-3);
+    }
+
+    CHECK_HIP_ERROR(hipGraphExecDestroy(exec));
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    EXPECT_ROCBLAS_STATUS(hipsolverSetStream(handle, old_stream), HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    // the parameters of a Jacobi solver cannot grow, and the blocking queries wait for the
+    // device, but the same queries made in stream order are allowed
+    hipsolverSyevjInfo_t params;
+    int                  syevj_lwork, sweeps;
+    double               residual;
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateSyevjInfo(&params), HIPSOLVER_STATUS_SUCCESS);
+
+    int                                m = 16;
+    device_strided_batch_vector<float> dW(m, 1, m, 1);
+    device_strided_batch_vector<int>   dSweeps(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dSweeps.memcheck());
+    CHECK_HIP_ERROR(hipMemcpy2D(dA.data(),
+                                sizeof(float) * m,
+                                hA.data(),
+                                sizeof(float) * n,
+                                sizeof(float) * m,
+                                m,
+                                hipMemcpyHostToDevice));
+    EXPECT_ROCBLAS_STATUS(hipsolverSsyevj_bufferSize(handle,
+                                                     HIPSOLVER_EIG_MODE_VECTOR,
+                                                     HIPSOLVER_FILL_MODE_LOWER,
+                                                     m,
+                                                     dA.data(),
+                                                     m,
+                                                     dW.data(),
+                                                     &syevj_lwork,
+                                                     params),
+                          HIPSOLVER_STATUS_SUCCESS);
+    int                                size_W = std::max(syevj_lwork, 1);
+    device_strided_batch_vector<float> dWork(size_W, 1, size_W, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+
+    auto syevj = [&]() {
+        return hipsolverSsyevj(handle,
+                               HIPSOLVER_EIG_MODE_VECTOR,
+                               HIPSOLVER_FILL_MODE_LOWER,
+                               m,
+                               dA.data(),
+                               m,
+                               dW.data(),
+                               dWork.data(),
+                               syevj_lwork,
+                               dInfo.data(),
+                               params);
+    };
+    EXPECT_ROCBLAS_STATUS(syevj(), HIPSOLVER_STATUS_NOT_CAPTURABLE);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCaptureMode(handle, HIPSOLVER_CAPTURE_MODE_OFF),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(syevj(), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCaptureMode(handle, HIPSOLVER_CAPTURE_MODE_SAFE),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverXsyevjGetResidual(handle, params, &residual),
+                          HIPSOLVER_STATUS_NOT_CAPTURABLE);
+    EXPECT_ROCBLAS_STATUS(hipsolverXsyevjGetSweeps(handle, params, &sweeps),
+                          HIPSOLVER_STATUS_NOT_CAPTURABLE);
+    EXPECT_ROCBLAS_STATUS(hipsolverXsyevjGetSweepsAsync(handle, params, dSweeps.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroySyevjInfo(params), HIPSOLVER_STATUS_SUCCESS);
+
+    // releasing the reservation returns the workspace to rocBLAS once the mode is off
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCaptureMode(handle, HIPSOLVER_CAPTURE_MODE_OFF),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, 0), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSgetrf(handle, n, n, dA.data(), n, nullptr, 0, dIpiv.data(), dInfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+}
@@ -62,7 +62,7 @@ Arguments csrlsvchol_setup_arguments(csrlsvchol_tuple tup)
     return arg;
 }
 
-template <bool HOST>
+template <bool HOST, typename I>
 class CSRLSVCHOL_BASE : public ::TestWithParam<csrlsvchol_tuple>
 {
 protected:
@@ -82,18 +82,26 @@ protected:
         Arguments arg = csrlsvchol_setup_arguments(GetParam());
 
         if(arg.peek<rocblas_int>("n") == 20 && arg.peek<rocblas_int>("nnzA") == 60)
-            testing_csrlsvchol_bad_arg<HOST, T>();
+            testing_csrlsvchol_bad_arg<HOST, T, I>();
 
         arg.batch_count = 1;
-        testing_csrlsvchol<HOST, T>(arg);
+        testing_csrlsvchol<HOST, T, I>(arg);
     }
 };
 
-class CSRLSVCHOL : public CSRLSVCHOL_BASE<false>
+class CSRLSVCHOL : public CSRLSVCHOL_BASE<false, int>
 {
 };
 
-class CSRLSVCHOLHOST : public CSRLSVCHOL_BASE<true>
+class CSRLSVCHOLHOST : public CSRLSVCHOL_BASE<true, int>
+{
+};
+
+class CSRLSVCHOL_64 : public CSRLSVCHOL_BASE<false, int64_t>
+{
+};
+
+class CSRLSVCHOLHOST_64 : public CSRLSVCHOL_BASE<true, int64_t>
 {
 };
 
@@ -139,6 +147,26 @@ TEST_P(CSRLSVCHOLHOST, __double)
 //     run_tests<rocblas_double_complex>();
 // }
 
+TEST_P(CSRLSVCHOL_64, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(CSRLSVCHOL_64, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(CSRLSVCHOLHOST_64, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(CSRLSVCHOLHOST_64, __double)
+{
+    run_tests<double>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          CSRLSVCHOL,
                          Combine(ValuesIn(large_n_range), ValuesIn(large_nnz_range)));
@@ -154,3 +182,19 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          CSRLSVCHOLHOST,
                          Combine(ValuesIn(n_range), ValuesIn(nnz_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         CSRLSVCHOL_64,
+                         Combine(ValuesIn(large_n_range), ValuesIn(large_nnz_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         CSRLSVCHOL_64,
+                         Combine(ValuesIn(n_range), ValuesIn(nnz_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         CSRLSVCHOLHOST_64,
+                         Combine(ValuesIn(large_n_range), ValuesIn(large_nnz_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         CSRLSVCHOLHOST_64,
+                         Combine(ValuesIn(n_range), ValuesIn(nnz_range)));
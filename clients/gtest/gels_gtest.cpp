@@ -22,6 +22,7 @@
  * ************************************************************************ */
 
 #include "testing_gels.hpp"
+#include "testing_gels_mixed.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -132,6 +133,39 @@ class GELS_INPLACE : public GELS_BASE<API_NORMAL, true>
 {
 };
 
+template <testAPI_t API, bool INPLACE>
+class GELS_MIXED_BASE : public ::TestWithParam<gels_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool HALF, typename T>
+    void run_tests()
+    {
+        Arguments arg = gels_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == -1 && arg.peek<rocblas_int>("nrhs") == -1)
+            testing_gels_mixed_bad_arg<API, HALF, T>();
+
+        testing_gels_mixed<API, HALF, INPLACE, T>(arg);
+    }
+};
+
+class GELS_MIXED : public GELS_MIXED_BASE<API_NORMAL, false>
+{
+};
+
+class GELS_MIXED_COMPAT : public GELS_MIXED_BASE<API_COMPAT, false>
+{
+};
+
+class GELS_MIXED_INPLACE : public GELS_MIXED_BASE<API_NORMAL, true>
+{
+};
+
 // non-batch tests
 
 TEST_P(GELS, __float)
@@ -214,6 +248,53 @@ TEST_P(GELS_INPLACE, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(GELS_MIXED, __double_float)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GELS_MIXED, __double_half)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GELS_MIXED, __double_complex_float_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+TEST_P(GELS_MIXED_COMPAT, __double_float)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GELS_MIXED_COMPAT, __double_half)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GELS_MIXED_COMPAT, __double_complex_float_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+TEST_P(GELS_MIXED_INPLACE, __double_float)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GELS_MIXED_INPLACE, __double_half)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GELS_MIXED_INPLACE, __double_complex_float_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+#endif
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          GELS,
 //                          Combine(ValuesIn(large_matrix_sizeA_range),
@@ -249,3 +330,17 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GELS_INPLACE,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELS_MIXED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELS_MIXED_COMPAT,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELS_MIXED_INPLACE,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+#endif
@@ -22,6 +22,7 @@
  * ************************************************************************ */
 
 #include "testing_gesv.hpp"
+#include "testing_gesv_mixed.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -127,6 +128,39 @@ class GESV_INPLACE : public GESV_BASE<API_NORMAL, true>
 {
 };
 
+template <testAPI_t API, bool INPLACE>
+class GESV_MIXED_BASE : public ::TestWithParam<gesv_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool HALF, typename T>
+    void run_tests()
+    {
+        Arguments arg = gesv_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == -1 && arg.peek<rocblas_int>("nrhs") == -1)
+            testing_gesv_mixed_bad_arg<API, HALF, T>();
+
+        testing_gesv_mixed<API, HALF, INPLACE, T>(arg);
+    }
+};
+
+class GESV_MIXED : public GESV_MIXED_BASE<API_NORMAL, false>
+{
+};
+
+class GESV_MIXED_COMPAT : public GESV_MIXED_BASE<API_COMPAT, false>
+{
+};
+
+class GESV_MIXED_INPLACE : public GESV_MIXED_BASE<API_NORMAL, true>
+{
+};
+
 // non-batch tests
 
 TEST_P(GESV, __float)
@@ -211,6 +245,68 @@ TEST_P(GESV_INPLACE, __double_complex)
 }
 #endif
 
+TEST_P(GESV_MIXED, __double_float)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GESV_MIXED, __double_half)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GESV_MIXED, __double_complex_float_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+TEST_P(GESV_MIXED, __double_complex_half_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+
+TEST_P(GESV_MIXED_COMPAT, __double_float)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GESV_MIXED_COMPAT, __double_half)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GESV_MIXED_COMPAT, __double_complex_float_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+TEST_P(GESV_MIXED_COMPAT, __double_complex_half_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+TEST_P(GESV_MIXED_INPLACE, __double_float)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GESV_MIXED_INPLACE, __double_half)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GESV_MIXED_INPLACE, __double_complex_float_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+TEST_P(GESV_MIXED_INPLACE, __double_complex_half_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+#endif
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          GESV,
 //                          Combine(ValuesIn(large_matrix_sizeA_range),
@@ -248,3 +344,17 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GESV_INPLACE,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
 #endif
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESV_MIXED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESV_MIXED_COMPAT,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESV_MIXED_INPLACE,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+#endif
@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesvdp.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gesvdp_tuple;
+
+// each size_range vector is a {m, n, lda, ldu, ldv};
+
+// each opt_range vector is a {jobz, econ};
+// if jobz = 0 then no singular vectors are computed
+// if jobz = 1 then the left and right singular vectors are computed
+
+// case when m = n = 0 and jobz = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // invalid
+    {0, 0, 0, 0, 0},
+    {-1, 10, 0, 0, 0},
+    {10, 10, -1, 0, 0},
+    // normal (valid) samples
+    {1, 1, 0, 0, 0},
+    {20, 20, 0, 0, 0},
+    {40, 30, 1, 0, 0},
+    {30, 40, 0, 1, 0},
+    {60, 40, 0, 1, 1},
+    {50, 100, 0, 0, 1}};
+
+const vector<vector<int>> opt_range = {{0, 0}, {1, 0}, {1, 1}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_size_range
+//     = {{300, 300, 0, 0, 0}, {1000, 600, 1, 0, 0}, {600, 1000, 0, 1, 1}, {2000, 2000, 0, 0, 0}};
+
+Arguments gesvdp_setup_arguments(gesvdp_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<int> opt  = std::get<1>(tup);
+
+    Arguments arg;
+
+    // sizes
+    rocblas_int m = size[0];
+    rocblas_int n = size[1];
+    arg.set<rocblas_int>("m", m);
+    arg.set<rocblas_int>("n", n);
+
+    // leading dimensions
+    arg.set<rocblas_int>("lda", m + size[2] * 10);
+    arg.set<rocblas_int>("ldu", m + size[3] * 10);
+    arg.set<rocblas_int>("ldv", n + size[4] * 10);
+
+    // vector options
+    arg.set<char>("jobz", opt[0] == 0 ? 'N' : 'V');
+    arg.set<rocblas_int>("econ", opt[1]);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API>
+class GESVDP_BASE : public ::TestWithParam<gesvdp_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = gesvdp_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0
+           && arg.peek<char>("jobz") == 'N')
+            testing_gesvdp_bad_arg<API, T>();
+
+        testing_gesvdp<API, T>(arg);
+    }
+};
+
+class GESVDP_COMPAT : public GESVDP_BASE<API_COMPAT>
+{
+};
+
+// non-batch tests
+
+TEST_P(GESVDP_COMPAT, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GESVDP_COMPAT, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GESVDP_COMPAT, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GESVDP_COMPAT, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// // daily_lapack tests normal execution with medium to large sizes
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GESVDP_COMPAT,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(opt_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESVDP_COMPAT,
+                         Combine(ValuesIn(size_range), ValuesIn(opt_range)));
@@ -0,0 +1,167 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesvdr.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gesvdr_tuple;
+
+// each size_range vector is a {m, n, lda, ldu, ldv};
+
+// each opt_range vector is a {vect, k, p, niters, rankA};
+// if vect = 0 then no singular vectors are computed
+// if vect = 1 then the left and right singular vectors are computed
+// if vect = 2 then only the left singular vectors are computed
+
+// case when m = n = 0, vect = 0 and k = 1 will also execute the bad
+// arguments test (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // invalid
+    {0, 0, 0, 0, 0},
+    {-1, 10, 0, 0, 0},
+    // normal (valid) samples
+    {20, 20, 0, 0, 0},
+    {40, 30, 1, 0, 0},
+    {60, 40, 0, 1, 1},
+    {100, 50, 0, 0, 0}};
+
+const vector<vector<int>> opt_range = {
+    {0, 1, 0, 0, 1},
+    {1, 5, 5, 0, 8},
+    {1, 10, 5, 1, 15},
+    {2, 8, 2, 2, 5},
+};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_size_range
+//     = {{300, 200, 0, 0, 0}, {1000, 600, 1, 0, 0}, {2000, 2000, 0, 1, 1}};
+
+// const vector<vector<int>> large_opt_range = {{1, 20, 10, 2, 30}, {1, 50, 10, 1, 60}};
+
+Arguments gesvdr_setup_arguments(gesvdr_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<int> opt  = std::get<1>(tup);
+
+    Arguments arg;
+
+    // sizes
+    rocblas_int m = size[0];
+    rocblas_int n = size[1];
+    arg.set<rocblas_int>("m", m);
+    arg.set<rocblas_int>("n", n);
+
+    // leading dimensions
+    arg.set<rocblas_int>("lda", m + size[2] * 10);
+    arg.set<rocblas_int>("ldu", m + size[3] * 10);
+    arg.set<rocblas_int>("ldv", n + size[4] * 10);
+
+    // vector options
+    arg.set<char>("jobu", opt[0] == 0 ? 'N' : 'S');
+    arg.set<char>("jobv", opt[0] == 1 ? 'S' : 'N');
+
+    // ranks
+    arg.set<rocblas_int>("k", opt[1]);
+    arg.set<rocblas_int>("p", opt[2]);
+    arg.set<rocblas_int>("niters", opt[3]);
+    arg.set<rocblas_int>("rankA", opt[4]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API>
+class GESVDR_BASE : public ::TestWithParam<gesvdr_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gesvdr_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0
+           && arg.peek<char>("jobu") == 'N' && arg.peek<rocblas_int>("k") == 1)
+            testing_gesvdr_bad_arg<API, STRIDED, T>();
+
+        arg.batch_count = (STRIDED ? 3 : 1);
+        testing_gesvdr<API, STRIDED, T>(arg);
+    }
+};
+
+class GESVDR_COMPAT : public GESVDR_BASE<API_COMPAT>
+{
+};
+
+// non-batch tests
+
+TEST_P(GESVDR_COMPAT, __float)
+{
+    run_tests<false, float>();
+}
+
+TEST_P(GESVDR_COMPAT, __double)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GESVDR_COMPAT, __float_complex)
+{
+    run_tests<false, rocblas_float_complex>();
+}
+
+TEST_P(GESVDR_COMPAT, __double_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+TEST_P(GESVDR_COMPAT, strided_batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(GESVDR_COMPAT, strided_batched__double)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GESVDR_COMPAT, strided_batched__float_complex)
+{
+    run_tests<true, rocblas_float_complex>();
+}
+
+TEST_P(GESVDR_COMPAT, strided_batched__double_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+#endif
+
+// // daily_lapack tests normal execution with medium to large sizes
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GESVDR_COMPAT,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(large_opt_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESVDR_COMPAT,
+                         Combine(ValuesIn(size_range), ValuesIn(opt_range)));
@@ -0,0 +1,323 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+#include "handle_pool_core.hpp"
+
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+// Hands out fake handles and records what the pool does with them
+struct mock_handle_state
+{
+    std::mutex                               mutex;
+    int                                      created   = 0;
+    int                                      destroyed = 0;
+    bool                                     fail      = false;
+    std::map<hipsolverHandle_t, hipStream_t> streams;
+};
+
+class mock_handle_factory : public hipsolver::handle_factory
+{
+public:
+    explicit mock_handle_factory(mock_handle_state& state)
+        : state(state)
+    {
+    }
+
+    hipsolverStatus_t create(hipsolverHandle_t* handle) override
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if(state.fail)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        *handle                = new int(++state.created);
+        state.streams[*handle] = nullptr;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipsolverStatus_t destroy(hipsolverHandle_t handle) override
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.streams.erase(handle);
+        delete(int*)handle;
+        state.destroyed++;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipsolverStatus_t set_stream(hipsolverHandle_t handle, hipStream_t stream) override
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.streams[handle] = stream;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+private:
+    mock_handle_state& state;
+};
+
+class checkin_misc_HANDLE_POOL : public ::testing::Test
+{
+protected:
+    checkin_misc_HANDLE_POOL() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_HANDLE_POOL, core_reuse)
+{
+    mock_handle_state state;
+    hipStream_t       stream1 = (hipStream_t)0x10, stream2 = (hipStream_t)0x20;
+    hipsolverHandle_t handle1, handle2;
+
+    {
+        hipsolver::handle_pool_core pool(std::make_unique<mock_handle_factory>(state), 2);
+
+        // released handles are reused and bound to the stream of the new owner
+        EXPECT_EQ(pool.acquire(stream1, &handle1), HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(state.streams[handle1], stream1);
+        EXPECT_EQ(pool.outstanding(), 1);
+        EXPECT_EQ(pool.release(handle1), HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(pool.idle(), 1);
+
+        EXPECT_EQ(pool.acquire(stream2, &handle2), HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(handle2, handle1);
+        EXPECT_EQ(state.streams[handle2], stream2);
+        EXPECT_EQ(pool.created, 1);
+        EXPECT_EQ(pool.reused, 1);
+
+        // a second handle is created while the first one is in use
+        EXPECT_EQ(pool.acquire(stream1, &handle1), HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_NE(handle1, handle2);
+        EXPECT_EQ(pool.created, 2);
+        EXPECT_EQ(pool.outstanding(), 2);
+
+        EXPECT_EQ(pool.release(handle1), HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(pool.release(handle2), HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(pool.outstanding(), 0);
+        EXPECT_EQ(state.destroyed, 0);
+    }
+
+    // the pool is drained when destroyed
+    EXPECT_EQ(state.destroyed, 2);
+    EXPECT_TRUE(state.streams.empty());
+}
+
+TEST_F(checkin_misc_HANDLE_POOL, core_capacity)
+{
+    mock_handle_state           state;
+    hipsolver::handle_pool_core pool(std::make_unique<mock_handle_factory>(state), 2);
+    hipsolverHandle_t           handles[3];
+
+    // warm preallocation is limited to the capacity
+    EXPECT_EQ(pool.reserve(3), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(state.created, 2);
+    EXPECT_EQ(pool.idle(), 2);
+    EXPECT_EQ(pool.reserve(1), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(state.created, 2);
+
+    for(int i = 0; i < 3; i++)
+        EXPECT_EQ(pool.acquire(nullptr, &handles[i]), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(pool.reused, 2);
+    EXPECT_EQ(pool.idle(), 0);
+
+    // handles that do not fit in the cache are destroyed, and cannot be released again
+    for(int i = 0; i < 3; i++)
+        EXPECT_EQ(pool.release(handles[i]), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(pool.idle(), 2);
+    EXPECT_EQ(state.destroyed, 1);
+    EXPECT_EQ(pool.release(handles[2]), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(pool.outstanding(), 0);
+
+    EXPECT_EQ(pool.drain(), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(pool.idle(), 0);
+    EXPECT_EQ(state.destroyed, 3);
+}
+
+TEST_F(checkin_misc_HANDLE_POOL, core_factory_failure)
+{
+    mock_handle_state           state;
+    hipsolver::handle_pool_core pool(std::make_unique<mock_handle_factory>(state), 2);
+    hipsolverHandle_t           handle = nullptr;
+
+    state.fail = true;
+    EXPECT_EQ(pool.reserve(2), HIPSOLVER_STATUS_ALLOC_FAILED);
+    EXPECT_EQ(pool.acquire(nullptr, &handle), HIPSOLVER_STATUS_ALLOC_FAILED);
+    EXPECT_EQ(handle, nullptr);
+    EXPECT_EQ(pool.outstanding(), 0);
+}
+
+TEST_F(checkin_misc_HANDLE_POOL, core_bad_release)
+{
+    mock_handle_state           state;
+    hipsolver::handle_pool_core pool(std::make_unique<mock_handle_factory>(state), 2);
+    hipsolverHandle_t           handle, stray = (hipsolverHandle_t)0x30;
+
+    // handles that were not acquired from the pool, or were already released, are refused
+    EXPECT_EQ(pool.acquire(nullptr, &handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(pool.release(stray), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(pool.outstanding(), 1);
+    EXPECT_EQ(pool.release(handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(pool.release(handle), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(pool.outstanding(), 0);
+    EXPECT_EQ(pool.idle(), 1);
+
+    // a handle destroyed by the pool is no longer its own
+    EXPECT_EQ(pool.drain(), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(pool.release(handle), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(pool.outstanding(), 0);
+}
+
+TEST_F(checkin_misc_HANDLE_POOL, core_threads)
+{
+    const int nthreads = 8, iters = 1000;
+
+    mock_handle_state state;
+    {
+        hipsolver::handle_pool_core pool(std::make_unique<mock_handle_factory>(state), nthreads);
+        EXPECT_EQ(pool.reserve(nthreads), HIPSOLVER_STATUS_SUCCESS);
+
+        std::vector<std::thread> threads;
+        for(int t = 0; t < nthreads; t++)
+            threads.emplace_back([&pool, t]() {
+                hipStream_t stream = (hipStream_t)(intptr_t)(t + 1);
+                for(int i = 0; i < iters; i++)
+                {
+                    hipsolverHandle_t handle;
+                    if(pool.acquire(stream, &handle) == HIPSOLVER_STATUS_SUCCESS)
+                        pool.release(handle);
+                }
+            });
+        for(auto& thread : threads)
+            thread.join();
+
+        // a thread may miss the cached handles while the others are moving them, in which case
+        // it creates a new one, so only the accounting of the acquisitions is exact
+        EXPECT_EQ(pool.outstanding(), 0);
+        EXPECT_LE(pool.idle(), nthreads);
+        EXPECT_GE(pool.created, size_t(nthreads));
+        EXPECT_EQ(pool.reused + pool.created, size_t(nthreads * iters + nthreads));
+    }
+
+    EXPECT_EQ(state.destroyed, state.created);
+}
+
+TEST_F(checkin_misc_HANDLE_POOL, normal_execution)
+{
+    hipsolverHandlePool_t pool;
+    hipsolverHandle_t     handle1, handle2;
+    hipStream_t           stream, bound;
+    int                   device;
+
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateHandlePool(&pool, device, 4), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolReserve(pool, 2), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(pool, stream, &handle1),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetStream(handle1, &bound), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(bound, stream);
+
+    // the pool cannot be destroyed while a handle is in use
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyHandlePool(pool), HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, handle1), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(pool, nullptr, &handle2),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetStream(handle2, &bound), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(bound, nullptr);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, handle2), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyHandlePool(pool), HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+TEST_F(checkin_misc_HANDLE_POOL, settings_kept)
+{
+    hipsolverHandlePool_t        pool;
+    hipsolverHandle_t            handle1, handle2;
+    hipsolverDeterministicMode_t mode;
+    int                          device;
+
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateHandlePool(&pool, device, 1), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(pool, nullptr, &handle1),
+                          HIPSOLVER_STATUS_SUCCESS);
+    hipsolverStatus_t stat
+        = hipsolverSetDeterministicMode(handle1, HIPSOLVER_DETERMINISTIC_RESULTS);
+    if(stat == HIPSOLVER_STATUS_SUCCESS)
+    {
+        // released handles come back with the settings of their previous user
+        EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, handle1), HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(pool, nullptr, &handle2),
+                              HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(handle2, handle1);
+        EXPECT_ROCBLAS_STATUS(hipsolverGetDeterministicMode(handle2, &mode),
+                              HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(mode, HIPSOLVER_DETERMINISTIC_RESULTS);
+
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverSetDeterministicMode(handle2, HIPSOLVER_ALLOW_NON_DETERMINISTIC_RESULTS),
+            HIPSOLVER_STATUS_SUCCESS);
+    }
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, handle1), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyHandlePool(pool), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_F(checkin_misc_HANDLE_POOL, bad_arguments)
+{
+    hipsolverHandlePool_t pool;
+    hipsolverHandle_t     handle;
+    int                   count;
+
+    CHECK_HIP_ERROR(hipGetDeviceCount(&count));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateHandlePool(nullptr, 0, 1), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateHandlePool(&pool, 0, 0), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateHandlePool(&pool, -1, 1), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateHandlePool(&pool, count, 1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyHandlePool(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolReserve(nullptr, 1), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(nullptr, nullptr, &handle),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(nullptr, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateHandlePool(&pool, 0, 1), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolReserve(pool, -1), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(pool, nullptr, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, nullptr),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyHandlePool(pool), HIPSOLVER_STATUS_SUCCESS);
+}
@@ -0,0 +1,223 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+#include "clientcommon.hpp"
+#include "hybrid_dispatch.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+extern "C" {
+void dgetrf_(int* m, int* n, double* A, int* lda, int* ipiv, int* info);
+void dgetrs_(
+    char* trans, int* n, int* nrhs, double* A, int* lda, int* ipiv, double* B, int* ldb, int* info);
+void dpotrf_(char* uplo, int* n, double* A, int* lda, int* info);
+void dpotrs_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
+}
+
+class checkin_misc_HYBRID_DISPATCH : public ::testing::Test
+{
+protected:
+    checkin_misc_HYBRID_DISPATCH() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_HYBRID_DISPATCH, policy)
+{
+    hipsolver::hybrid_policy policy;
+    const int                threshold = hipsolver::hybrid_policy::default_threshold;
+
+    // the hybrid mode is off by default
+    EXPECT_FALSE(policy.use_host(hipsolver::hybrid_getrf, 4, true, true));
+
+    policy.enabled = true;
+    EXPECT_TRUE(policy.use_host(hipsolver::hybrid_getrf, 4, true, true));
+    EXPECT_TRUE(policy.use_host(hipsolver::hybrid_potrs, 0, true, true));
+    EXPECT_FALSE(policy.use_host(hipsolver::hybrid_getrf, threshold, true, true));
+
+    // invalid arguments and data that the host cannot access stay on the device
+    EXPECT_FALSE(policy.use_host(hipsolver::hybrid_getrf, 4, false, true));
+    EXPECT_FALSE(policy.use_host(hipsolver::hybrid_getrf, 4, true, false));
+
+    // thresholds are per function, and 0 sends every call to the device
+    EXPECT_TRUE(policy.set_threshold(hipsolver::hybrid_potrf, 100));
+    EXPECT_TRUE(policy.set_threshold(hipsolver::hybrid_getrs, 0));
+    EXPECT_TRUE(policy.use_host(hipsolver::hybrid_potrf, 99, true, true));
+    EXPECT_FALSE(policy.use_host(hipsolver::hybrid_potrf, 100, true, true));
+    EXPECT_FALSE(policy.use_host(hipsolver::hybrid_getrs, 0, true, true));
+    EXPECT_TRUE(policy.use_host(hipsolver::hybrid_getrf, 4, true, true));
+
+    EXPECT_FALSE(policy.set_threshold(hipsolver::hybrid_potrf, -1));
+    EXPECT_FALSE(policy.set_threshold(hipsolver::hybrid_function_count, 10));
+    EXPECT_EQ(policy.threshold[hipsolver::hybrid_potrf], 100);
+
+    policy.on_dispatch(true);
+    policy.on_dispatch(false);
+    policy.on_dispatch(false);
+    EXPECT_EQ(policy.host_calls, 1);
+    EXPECT_EQ(policy.device_calls, 2);
+}
+
+TEST_F(checkin_misc_HYBRID_DISPATCH, crossover)
+{
+    const int    sizes[] = {4, 8, 16, 32, 64};
+    const double device[] = {10, 10, 10, 10, 10};
+
+    // the device path is faster from the first size at which it stays faster
+    const double host1[] = {1, 2, 5, 20, 80};
+    EXPECT_EQ(hipsolver::hybrid_crossover(sizes, host1, device, 5), 32);
+
+    // a noisy measurement below the crossover does not lower it
+    const double host2[] = {1, 12, 5, 20, 80};
+    EXPECT_EQ(hipsolver::hybrid_crossover(sizes, host2, device, 5), 32);
+
+    const double host3[] = {20, 20, 20, 20, 20};
+    EXPECT_EQ(hipsolver::hybrid_crossover(sizes, host3, device, 5), 0);
+
+    const double host4[] = {1, 1, 1, 1, 1};
+    EXPECT_EQ(hipsolver::hybrid_crossover(sizes, host4, device, 5), 65);
+}
+
+TEST_F(checkin_misc_HYBRID_DISPATCH, host_path)
+{
+    hipsolver::host_lapack<double> lapack;
+    lapack.getrf = dgetrf_;
+    lapack.getrs = dgetrs_;
+    lapack.potrf = dpotrf_;
+    lapack.potrs = dpotrs_;
+
+    // symmetric positive definite matrix with solution x = (1, 2, 3)
+    const int    n = 3, lda = 4;
+    const double A0[lda * n] = {4, 1, 0, -1, 1, 5, 2, -1, 0, 2, 6, -1};
+    const double x[n]        = {1, 2, 3};
+    double       b[n];
+    for(int i = 0; i < n; i++)
+        b[i] = A0[i] * x[0] + A0[i + lda] * x[1] + A0[i + 2 * lda] * x[2];
+
+    double A[lda * n], B[n];
+    int    ipiv[n], info = -1;
+
+    std::copy(A0, A0 + lda * n, A);
+    std::copy(b, b + n, B);
+    hipsolver::hybrid_host_getrf(lapack, n, n, A, lda, ipiv, &info);
+    EXPECT_EQ(info, 0);
+    info = -1;
+    hipsolver::hybrid_host_getrs(lapack, 'N', n, 1, A, lda, ipiv, B, n, &info);
+    EXPECT_EQ(info, 0);
+    for(int i = 0; i < n; i++)
+        EXPECT_NEAR(B[i], x[i], 1e-12);
+
+    // potrf only references the lower triangle
+    std::copy(A0, A0 + lda * n, A);
+    std::copy(b, b + n, B);
+    A[lda] = A[2 * lda] = A[1 + 2 * lda] = 0;
+    hipsolver::hybrid_host_potrf(lapack, 'L', n, A, lda, &info);
+    EXPECT_EQ(info, 0);
+    info = -1;
+    hipsolver::hybrid_host_potrs(lapack, 'L', n, 1, A, lda, B, n, &info);
+    EXPECT_EQ(info, 0);
+    for(int i = 0; i < n; i++)
+        EXPECT_NEAR(B[i], x[i], 1e-12);
+
+    // a matrix that is not positive definite reports the failed pivot
+    std::copy(A0, A0 + lda * n, A);
+    A[1 + lda] = -5;
+    hipsolver::hybrid_host_potrf(lapack, 'L', n, A, lda, &info);
+    EXPECT_EQ(info, 2);
+}
+
+TEST_F(checkin_misc_HYBRID_DISPATCH, normal_execution)
+{
+    hipsolver_local_handle handle;
+    hipsolverHybridMode_t  mode;
+    int                    threshold;
+    size_t                 host_calls, device_calls;
+
+    hipsolverStatus_t stat = hipsolverGetHybridMode(handle, &mode);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_EQ(mode, HIPSOLVER_HYBRID_MODE_OFF);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHybridThreshold(handle, HIPSOLVER_HYBRID_GETRF, &threshold),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(threshold, hipsolver::hybrid_policy::default_threshold);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetHybridThreshold(handle, HIPSOLVER_HYBRID_GETRF, -1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetHybridThreshold(handle, hipsolverHybridFunction_t(0), 16),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+
+    // the host path needs a LAPACK library at run time
+    stat = hipsolverSetHybridMode(handle, HIPSOLVER_HYBRID_MODE_AUTO);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHybridMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_HYBRID_MODE_AUTO);
+
+    const int n = 8;
+    float*    mA;
+    int *     mIpiv, *mInfo;
+    CHECK_HIP_ERROR(hipMallocManaged((void**)&mA, sizeof(float) * n * n));
+    CHECK_HIP_ERROR(hipMallocManaged((void**)&mIpiv, sizeof(int) * n));
+    CHECK_HIP_ERROR(hipMallocManaged((void**)&mInfo, sizeof(int)));
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < n; i++)
+            mA[i + j * n] = (i == j) ? n : 1;
+
+    // small problems in managed memory run on the host
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrf(handle, n, n, mA, n, nullptr, 0, mIpiv, mInfo),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(*mInfo, 0);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHybridStats(handle, &host_calls, &device_calls),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(host_calls, 1);
+    EXPECT_EQ(device_calls, 0);
+
+    // problems above the threshold, and data in device memory, run on the device
+    EXPECT_ROCBLAS_STATUS(hipsolverSetHybridThreshold(handle, HIPSOLVER_HYBRID_POTRF, n),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSpotrf(handle, HIPSOLVER_FILL_MODE_LOWER, n, mA, n, nullptr, 0, mInfo),
+        HIPSOLVER_STATUS_SUCCESS);
+
+    device_strided_batch_vector<float> dA(n * n, 1, n * n, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(hipMemcpy(dA.data(), mA, sizeof(float) * n * n, hipMemcpyDefault));
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrf(handle, n, n, dA.data(), n, nullptr, 0, mIpiv, mInfo),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHybridStats(handle, &host_calls, &device_calls),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(host_calls, 1);
+    EXPECT_EQ(device_calls, 2);
+
+    CHECK_HIP_ERROR(hipFree(mA));
+    CHECK_HIP_ERROR(hipFree(mIpiv));
+    CHECK_HIP_ERROR(hipFree(mInfo));
+}
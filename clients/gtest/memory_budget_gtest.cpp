@@ -0,0 +1,262 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_MEMORY_BUDGET : public ::testing::Test
+{
+protected:
+    checkin_misc_MEMORY_BUDGET() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_MEMORY_BUDGET, normal_execution)
+{
+    hipsolver_local_handle handle;
+    hipsolverMemoryUsage_t usage;
+
+    hipsolverStatus_t stat = hipsolverGetMemoryUsage(handle, &usage);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_EQ(usage.budget, 0);
+    EXPECT_EQ(usage.bytes_in_use, 0);
+    EXPECT_EQ(usage.rejected_calls, 0);
+
+    int n = 256, lwork;
+
+    device_strided_batch_vector<float> dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<int>   dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int>   dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    CHECK_HIP_ERROR(hipMemset(dA.data(), 0, sizeof(float) * n * n));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrf_bufferSize(handle, n, n, dA.data(), n, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    if(lwork <= 1)
+        return;
+
+    // the workspace allocated by hipSOLVER is accounted to the handle
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSgetrf(handle, n, n, dA.data(), n, nullptr, 0, dIpiv.data(), dInfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryUsage(handle, &usage), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(usage.bytes_in_use, size_t(lwork));
+    EXPECT_EQ(usage.peak_bytes_in_use, size_t(lwork));
+
+    // lowering the budget releases the workspace, and calls that do not fit fail before allocating
+    EXPECT_ROCBLAS_STATUS(hipsolverSetMemoryBudget(handle, lwork - 1), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSgetrf(handle, n, n, dA.data(), n, nullptr, 0, dIpiv.data(), dInfo.data()),
+        HIPSOLVER_STATUS_ALLOC_FAILED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryUsage(handle, &usage), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(usage.budget, size_t(lwork - 1));
+    EXPECT_EQ(usage.bytes_in_use, 0);
+    EXPECT_EQ(usage.peak_bytes_in_use, size_t(lwork));
+    EXPECT_EQ(usage.rejected_calls, 1);
+
+    // workspaces provided by the user are not subject to the budget
+    device_strided_batch_vector<float> dWork(lwork, 1, lwork, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrf(handle,
+                                          n,
+                                          n,
+                                          dA.data(),
+                                          n,
+                                          dWork.data(),
+                                          lwork,
+                                          dIpiv.data(),
+                                          dInfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryUsage(handle, &usage), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(usage.bytes_in_use, 0);
+
+    // removing the budget
+    EXPECT_ROCBLAS_STATUS(hipsolverSetMemoryBudget(handle, 0), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSgetrf(handle, n, n, dA.data(), n, nullptr, 0, dIpiv.data(), dInfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryUsage(handle, &usage), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(usage.budget, 0);
+    EXPECT_EQ(usage.rejected_calls, 1);
+}
+
+TEST_F(checkin_misc_MEMORY_BUDGET, low_memory_variant)
+{
+    hipsolver_local_handle handle;
+    hipsolverMemoryUsage_t usage;
+
+    hipsolverStatus_t stat = hipsolverGetMemoryUsage(handle, &usage);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+
+    int m = 512, n = 32, lwork;
+
+    device_strided_batch_vector<float> dA(m * n, 1, m * n, 1);
+    device_strided_batch_vector<float> dS(n, 1, n, 1);
+    device_strided_batch_vector<float> dU(m * n, 1, m * n, 1);
+    device_strided_batch_vector<float> dV(n * n, 1, n * n, 1);
+    device_strided_batch_vector<int>   dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dS.memcheck());
+    CHECK_HIP_ERROR(dU.memcheck());
+    CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    CHECK_HIP_ERROR(hipMemset(dA.data(), 0, sizeof(float) * m * n));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSgesvd_bufferSize(handle, 'S', 'S', m, n, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    if(lwork <= 1)
+        return;
+
+    // when the default workspace does not fit, gesvd switches to its in-place variant, which
+    // either fits in the budget or is rejected
+    EXPECT_ROCBLAS_STATUS(hipsolverSetMemoryBudget(handle, lwork - 1), HIPSOLVER_STATUS_SUCCESS);
+    stat = hipsolverSgesvd(handle,
+                           'S',
+                           'S',
+                           m,
+                           n,
+                           dA.data(),
+                           m,
+                           dS.data(),
+                           dU.data(),
+                           m,
+                           dV.data(),
+                           n,
+                           nullptr,
+                           0,
+                           nullptr,
+                           dInfo.data());
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryUsage(handle, &usage), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(usage.degraded_calls, 1);
+    if(stat == HIPSOLVER_STATUS_SUCCESS)
+    {
+        EXPECT_LE(usage.bytes_in_use, size_t(lwork - 1));
+        EXPECT_EQ(usage.rejected_calls, 0);
+    }
+    else
+    {
+        EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_ALLOC_FAILED);
+        EXPECT_EQ(usage.rejected_calls, 1);
+    }
+}
+
+TEST_F(checkin_misc_MEMORY_BUDGET, jacobi_buffers)
+{
+    hipsolver_local_handle handle;
+    hipsolverMemoryUsage_t usage;
+    hipsolverSyevjInfo_t   params;
+
+    hipsolverStatus_t stat = hipsolverGetMemoryUsage(handle, &usage);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+
+    int n = 16, lwork;
+
+    device_strided_batch_vector<float> dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<float> dW(n, 1, n, 1);
+    device_strided_batch_vector<int>   dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    CHECK_HIP_ERROR(hipMemset(dA.data(), 0, sizeof(float) * n * n));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateSyevjInfo(&params), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSsyevj_bufferSize(handle,
+                                                     HIPSOLVER_EIG_MODE_VECTOR,
+                                                     HIPSOLVER_FILL_MODE_UPPER,
+                                                     n,
+                                                     dA.data(),
+                                                     n,
+                                                     dW.data(),
+                                                     &lwork,
+                                                     params),
+                          HIPSOLVER_STATUS_SUCCESS);
+    device_strided_batch_vector<float> dWork(std::max(lwork, 1), 1, std::max(lwork, 1), 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+
+    // the buffer holding the results of the parameters is accounted to the handle, even with a
+    // workspace provided by the user, until the parameters are destroyed
+    EXPECT_ROCBLAS_STATUS(hipsolverSsyevj(handle,
+                                          HIPSOLVER_EIG_MODE_VECTOR,
+                                          HIPSOLVER_FILL_MODE_UPPER,
+                                          n,
+                                          dA.data(),
+                                          n,
+                                          dW.data(),
+                                          dWork.data(),
+                                          lwork,
+                                          dInfo.data(),
+                                          params),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryUsage(handle, &usage), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_GT(usage.bytes_in_use, 0);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroySyevjInfo(params), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryUsage(handle, &usage), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(usage.bytes_in_use, 0);
+
+    // the buffer of new parameters is not allocated beyond the budget
+    EXPECT_ROCBLAS_STATUS(hipsolverSetMemoryBudget(handle, 1), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateSyevjInfo(&params), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSsyevj(handle,
+                                          HIPSOLVER_EIG_MODE_VECTOR,
+                                          HIPSOLVER_FILL_MODE_UPPER,
+                                          n,
+                                          dA.data(),
+                                          n,
+                                          dW.data(),
+                                          dWork.data(),
+                                          lwork,
+                                          dInfo.data(),
+                                          params),
+                          HIPSOLVER_STATUS_ALLOC_FAILED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryUsage(handle, &usage), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(usage.bytes_in_use, 0);
+    EXPECT_EQ(usage.rejected_calls, 1);
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroySyevjInfo(params), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_F(checkin_misc_MEMORY_BUDGET, bad_arguments)
+{
+    hipsolver_local_handle handle;
+    hipsolverMemoryUsage_t usage;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetMemoryBudget(nullptr, 0), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryUsage(nullptr, &usage),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryUsage(handle, nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+}
@@ -93,3 +93,154 @@ TEST_F(checkin_misc_PARAMS, destroy_nullptr)
 
     EXPECT_ROCBLAS_STATUS(hipsolverDnDestroyParams(params), HIPSOLVER_STATUS_INVALID_VALUE);
 }
+
+TEST_F(checkin_misc_PARAMS, setoptions_all_functions)
+{
+    hipsolverDnParams_t params = hipsolverDnParams_t();
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDnCreateParams(&params), HIPSOLVER_STATUS_SUCCESS);
+
+    for(hipsolverDnFunction_t func : {HIPSOLVERDN_GETRF, HIPSOLVERDN_POTRF, HIPSOLVERDN_GEQRF})
+        EXPECT_ROCBLAS_STATUS(hipsolverDnSetAdvOptions(params, func, HIPSOLVER_ALG_0),
+                              HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDnSetAdvOptions(params, HIPSOLVERDN_GETRF, HIPSOLVER_ALG_1),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    EXPECT_ROCBLAS_STATUS(hipsolverDnSetAdvOptions(params, HIPSOLVERDN_POTRF, HIPSOLVER_ALG_1),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnSetAdvOptions(params, HIPSOLVERDN_GEQRF, HIPSOLVER_ALG_1),
+                          HIPSOLVER_STATUS_SUCCESS);
+#endif
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDnDestroyParams(params), HIPSOLVER_STATUS_SUCCESS);
+}
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+// HIPSOLVER_ALG_1 selects unblocked algorithms, which must give the results of the blocked ones
+TEST_F(checkin_misc_PARAMS, alg1_execution)
+{
+    hipsolver_local_handle handle;
+    hipsolverDnParams_t    params0 = hipsolverDnParams_t(), params1 = hipsolverDnParams_t();
+    size_t                 lwork, lworkHost;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDnCreateParams(&params0), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnCreateParams(&params1), HIPSOLVER_STATUS_SUCCESS);
+    for(hipsolverDnFunction_t func : {HIPSOLVERDN_GETRF, HIPSOLVERDN_POTRF, HIPSOLVERDN_GEQRF})
+        EXPECT_ROCBLAS_STATUS(hipsolverDnSetAdvOptions(params1, func, HIPSOLVER_ALG_1),
+                              HIPSOLVER_STATUS_SUCCESS);
+
+    // symmetric positive definite matrix
+    const int64_t       m = 40, n = 24;
+    std::vector<double> hA(m * n), hR0(m * n), hR1(m * n);
+    for(int64_t j = 0; j < n; j++)
+        for(int64_t i = 0; i < m; i++)
+            hA[i + j * m] = (i == j) ? m : 1.0 / (1 + i + j);
+
+    double * dA, *dTau;
+    int64_t* dIpiv;
+    int*     dInfo;
+    int      info;
+    CHECK_HIP_ERROR(hipMalloc((void**)&dA, sizeof(double) * m * n));
+    CHECK_HIP_ERROR(hipMalloc((void**)&dTau, sizeof(double) * n));
+    CHECK_HIP_ERROR(hipMalloc((void**)&dIpiv, sizeof(int64_t) * n));
+    CHECK_HIP_ERROR(hipMalloc((void**)&dInfo, sizeof(int)));
+
+    for(hipsolverDnFunction_t func : {HIPSOLVERDN_GETRF, HIPSOLVERDN_POTRF, HIPSOLVERDN_GEQRF})
+    {
+        for(hipsolverDnParams_t params : {params0, params1})
+        {
+            std::vector<double>& hR = params == params0 ? hR0 : hR1;
+            CHECK_HIP_ERROR(
+                hipMemcpy(dA, hA.data(), sizeof(double) * m * n, hipMemcpyHostToDevice));
+
+            if(func == HIPSOLVERDN_GETRF)
+            {
+                EXPECT_ROCBLAS_STATUS(
+                    hipsolverDnXgetrf_bufferSize(
+                        handle, params, m, n, HIP_R_64F, dA, m, HIP_R_64F, &lwork, &lworkHost),
+                    HIPSOLVER_STATUS_SUCCESS);
+                EXPECT_ROCBLAS_STATUS(hipsolverDnXgetrf(handle,
+                                                        params,
+                                                        m,
+                                                        n,
+                                                        HIP_R_64F,
+                                                        dA,
+                                                        m,
+                                                        dIpiv,
+                                                        HIP_R_64F,
+                                                        nullptr,
+                                                        0,
+                                                        nullptr,
+                                                        0,
+                                                        dInfo),
+                                      HIPSOLVER_STATUS_SUCCESS);
+            }
+            else if(func == HIPSOLVERDN_POTRF)
+            {
+                EXPECT_ROCBLAS_STATUS(hipsolverDnXpotrf(handle,
+                                                        params,
+                                                        HIPSOLVER_FILL_MODE_LOWER,
+                                                        n,
+                                                        HIP_R_64F,
+                                                        dA,
+                                                        m,
+                                                        HIP_R_64F,
+                                                        nullptr,
+                                                        0,
+                                                        nullptr,
+                                                        0,
+                                                        dInfo),
+                                      HIPSOLVER_STATUS_SUCCESS);
+            }
+            else
+            {
+                EXPECT_ROCBLAS_STATUS(hipsolverDnXgeqrf(handle,
+                                                        params,
+                                                        m,
+                                                        n,
+                                                        HIP_R_64F,
+                                                        dA,
+                                                        m,
+                                                        HIP_R_64F,
+                                                        dTau,
+                                                        HIP_R_64F,
+                                                        nullptr,
+                                                        0,
+                                                        nullptr,
+                                                        0,
+                                                        dInfo),
+                                      HIPSOLVER_STATUS_SUCCESS);
+            }
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(hR.data(), dA, sizeof(double) * m * n, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(&info, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+            EXPECT_EQ(info, 0);
+        }
+
+        for(int64_t i = 0; i < m * n; i++)
+            EXPECT_NEAR(hR0[i], hR1[i], 1e-10 * m);
+    }
+
+    // wider matrices fall back to the blocked algorithms, whose workspace they ask for
+    size_t lwork0;
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDnXgetrf_bufferSize(
+            handle, params0, 512, 512, HIP_R_64F, nullptr, 512, HIP_R_64F, &lwork0, &lworkHost),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDnXgetrf_bufferSize(
+            handle, params1, 512, 512, HIP_R_64F, nullptr, 512, HIP_R_64F, &lwork, &lworkHost),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork, lwork0);
+
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dTau));
+    CHECK_HIP_ERROR(hipFree(dIpiv));
+    CHECK_HIP_ERROR(hipFree(dInfo));
+    EXPECT_ROCBLAS_STATUS(hipsolverDnDestroyParams(params0), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnDestroyParams(params1), HIPSOLVER_STATUS_SUCCESS);
+}
+#endif
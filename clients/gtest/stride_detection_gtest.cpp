@@ -0,0 +1,246 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+#include "clientcommon.hpp"
+#include "stride_detection.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_STRIDE_DETECTION : public ::testing::Test
+{
+protected:
+    checkin_misc_STRIDE_DETECTION() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_STRIDE_DETECTION, layout)
+{
+    float       buffer[64];
+    const void* ptrs[4];
+    int64_t     stride;
+
+    // equally spaced matrices of 4x4 elements
+    for(int i = 0; i < 4; i++)
+        ptrs[i] = buffer + 16 * i;
+    hipsolver::pointer_layout layout = hipsolver::detect_pointer_layout(ptrs, 4);
+    EXPECT_TRUE(layout.affine);
+    EXPECT_EQ(layout.base, uintptr_t(buffer));
+    EXPECT_EQ(layout.stride, int64_t(16 * sizeof(float)));
+    EXPECT_TRUE(layout.as_strided(sizeof(float), 16, 4, &stride));
+    EXPECT_EQ(stride, 16);
+
+    // the matrices must not overlap, and the stride must be a whole number of elements
+    EXPECT_FALSE(layout.as_strided(sizeof(float), 17, 4, &stride));
+    EXPECT_FALSE(layout.as_strided(3 * sizeof(float), 4, 4, &stride));
+
+    // a single matrix is always a strided batch
+    layout = hipsolver::detect_pointer_layout(ptrs + 2, 1);
+    EXPECT_TRUE(layout.affine);
+    EXPECT_TRUE(layout.as_strided(sizeof(float), 16, 1, &stride));
+    EXPECT_EQ(stride, 16);
+
+    // a repeated matrix is affine but cannot be computed in place by a strided routine
+    for(int i = 0; i < 4; i++)
+        ptrs[i] = buffer;
+    layout = hipsolver::detect_pointer_layout(ptrs, 4);
+    EXPECT_TRUE(layout.affine);
+    EXPECT_FALSE(layout.as_strided(sizeof(float), 16, 4, &stride));
+
+    // unevenly spaced, reversed and null pointers are not
+    for(int i = 0; i < 4; i++)
+        ptrs[i] = buffer + 16 * i;
+    ptrs[3] = buffer + 60;
+    EXPECT_FALSE(hipsolver::detect_pointer_layout(ptrs, 4).affine);
+    for(int i = 0; i < 4; i++)
+        ptrs[i] = buffer + 16 * (3 - i);
+    layout = hipsolver::detect_pointer_layout(ptrs, 4);
+    EXPECT_TRUE(layout.affine);
+    EXPECT_FALSE(layout.as_strided(sizeof(float), 16, 4, &stride));
+    ptrs[0] = nullptr;
+    EXPECT_FALSE(hipsolver::detect_pointer_layout(ptrs, 4).affine);
+    EXPECT_FALSE(hipsolver::detect_pointer_layout(ptrs, 0).affine);
+}
+
+TEST_F(checkin_misc_STRIDE_DETECTION, cache)
+{
+    hipsolver::stride_detection strides;
+    hipsolver::pointer_layout   layout, found;
+    int                         arrays[2];
+
+    // the detection is off by default
+    EXPECT_FALSE(strides.enabled);
+    strides.set_enabled(true);
+
+    layout.affine = true;
+    layout.base   = 64;
+    layout.stride = 32;
+    strides.insert(&arrays[0], 4, layout);
+    EXPECT_TRUE(strides.find(&arrays[0], 4, &found));
+    EXPECT_EQ(found.base, 64);
+    EXPECT_EQ(found.stride, 32);
+
+    // entries are keyed by address and length
+    EXPECT_FALSE(strides.find(&arrays[0], 3, &found));
+    EXPECT_FALSE(strides.find(&arrays[1], 4, &found));
+
+    // setting the mode empties the cache
+    strides.set_enabled(true);
+    EXPECT_FALSE(strides.find(&arrays[0], 4, &found));
+
+    // and so does reaching its capacity
+    for(size_t i = 0; i < hipsolver::stride_detection::capacity; i++)
+        strides.insert(&arrays[0], int(i), layout);
+    EXPECT_EQ(strides.size(), hipsolver::stride_detection::capacity);
+    strides.insert(&arrays[1], 4, layout);
+    EXPECT_EQ(strides.size(), 1);
+    EXPECT_TRUE(strides.find(&arrays[1], 4, &found));
+
+    strides.on_dispatch(true);
+    strides.on_dispatch(false);
+    strides.on_dispatch(true);
+    EXPECT_EQ(strides.strided_calls, 2);
+    EXPECT_EQ(strides.batched_calls, 1);
+}
+
+TEST_F(checkin_misc_STRIDE_DETECTION, normal_execution)
+{
+    hipsolver_local_handle         handle;
+    hipsolverStrideDetectionMode_t mode;
+    size_t                         strided_calls, batched_calls;
+
+    hipsolverStatus_t stat = hipsolverGetStrideDetectionMode(handle, &mode);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_EQ(mode, HIPSOLVER_STRIDE_DETECTION_OFF);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetStrideDetectionMode(handle, hipsolverStrideDetectionMode_t(0)),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetStrideDetectionMode(handle, HIPSOLVER_STRIDE_DETECTION_AUTO),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetStrideDetectionMode(handle, &mode),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_STRIDE_DETECTION_AUTO);
+
+    const int          n = 8, nrhs = 2, bc = 3;
+    std::vector<float> hA(n * n * bc), hB(n * nrhs * bc), hX(n * nrhs * bc);
+    for(int b = 0; b < bc; b++)
+    {
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+                hA[i + j * n + b * n * n] = (i == j) ? n + b : 1;
+        for(int i = 0; i < n * nrhs; i++)
+            hB[i + b * n * nrhs] = float(i % n + 1);
+    }
+
+    float * dA, *dB, *dA2;
+    float **dAarray, **dBarray;
+    int*    dInfo;
+    CHECK_HIP_ERROR(hipMalloc((void**)&dA, sizeof(float) * n * n * bc));
+    CHECK_HIP_ERROR(hipMalloc((void**)&dA2, sizeof(float) * n * n * bc));
+    CHECK_HIP_ERROR(hipMalloc((void**)&dB, sizeof(float) * n * nrhs * bc));
+    CHECK_HIP_ERROR(hipMalloc((void**)&dAarray, sizeof(float*) * bc));
+    CHECK_HIP_ERROR(hipMalloc((void**)&dBarray, sizeof(float*) * bc));
+    CHECK_HIP_ERROR(hipMalloc((void**)&dInfo, sizeof(int) * bc));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(float) * n * n * bc, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(float) * n * nrhs * bc, hipMemcpyHostToDevice));
+
+    std::vector<float*> hAarray(bc), hBarray(bc);
+    for(int b = 0; b < bc; b++)
+    {
+        hAarray[b] = dA + b * n * n;
+        hBarray[b] = dB + b * n * nrhs;
+    }
+    CHECK_HIP_ERROR(
+        hipMemcpy(dAarray, hAarray.data(), sizeof(float*) * bc, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dBarray, hBarray.data(), sizeof(float*) * bc, hipMemcpyHostToDevice));
+
+    // equally spaced matrices are computed by the strided routines
+    EXPECT_ROCBLAS_STATUS(hipsolverSpotrfBatched(
+                              handle, HIPSOLVER_FILL_MODE_LOWER, n, dAarray, n, nullptr, 0, dInfo, bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpotrsBatched(handle,
+                                                 HIPSOLVER_FILL_MODE_LOWER,
+                                                 n,
+                                                 nrhs,
+                                                 dAarray,
+                                                 n,
+                                                 dBarray,
+                                                 n,
+                                                 nullptr,
+                                                 0,
+                                                 dInfo,
+                                                 bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipMemcpy(hX.data(), dB, sizeof(float) * n * nrhs * bc, hipMemcpyDeviceToHost));
+    EXPECT_ROCBLAS_STATUS(hipsolverGetStrideDetectionStats(handle, &strided_calls, &batched_calls),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(strided_calls, 2);
+    EXPECT_EQ(batched_calls, 0);
+
+    // the solutions satisfy A_b * X_b = B_b
+    for(int b = 0; b < bc; b++)
+        for(int k = 0; k < nrhs; k++)
+            for(int i = 0; i < n; i++)
+            {
+                double r = -hB[i + k * n + b * n * nrhs];
+                for(int j = 0; j < n; j++)
+                    r += hA[i + j * n + b * n * n] * hX[j + k * n + b * n * nrhs];
+                EXPECT_NEAR(r, 0, 1e-4);
+            }
+
+    // matrices in another order are computed by the batched routine
+    std::swap(hAarray[0], hAarray[2]);
+    for(int b = 0; b < bc; b++)
+        hAarray[b] += dA2 - dA;
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA2, hA.data(), sizeof(float) * n * n * bc, hipMemcpyHostToDevice));
+
+    // the pointer array is rewritten, so the cached layouts are discarded first
+    EXPECT_ROCBLAS_STATUS(hipsolverSetStrideDetectionMode(handle, HIPSOLVER_STRIDE_DETECTION_AUTO),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(
+        hipMemcpy(dAarray, hAarray.data(), sizeof(float*) * bc, hipMemcpyHostToDevice));
+    EXPECT_ROCBLAS_STATUS(hipsolverSpotrfBatched(
+                              handle, HIPSOLVER_FILL_MODE_LOWER, n, dAarray, n, nullptr, 0, dInfo, bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetStrideDetectionStats(handle, &strided_calls, &batched_calls),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(strided_calls, 2);
+    EXPECT_EQ(batched_calls, 1);
+
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dA2));
+    CHECK_HIP_ERROR(hipFree(dB));
+    CHECK_HIP_ERROR(hipFree(dAarray));
+    CHECK_HIP_ERROR(hipFree(dBarray));
+    CHECK_HIP_ERROR(hipFree(dInfo));
+}
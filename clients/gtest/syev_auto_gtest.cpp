@@ -0,0 +1,179 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "testing_gesvdr.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gesvdr_tuple;
+
+// each size_range vector is a {m, n, lda, ldu, ldv};
+
+// each opt_range vector is a {vect, k, p, niters, rankA};
+// if vect = 0 then no singular vectors are computed
+// if vect = 1 then the left and right singular vectors are computed
+// if vect = 2 then only the left singular vectors are computed
+
+
+#include "testing_syev_auto.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<char>> syev_auto_tuple;
+
+// each size_range vector is a {n, lda, il, iu}
+
+// each op_range vector is a {jobz, range, uplo, alg}
+
+// case when n == 1, jobz == N, range == A, uplo = L and alg = A will also execute the bad
+// arguments test (null handle, null pointers and invalid values)
+
+const vector<vector<char>> op_range = {{'N', 'A', 'L', 'A'},
+                                       {'V', 'A', 'U', 'A'},
+                                       {'V', 'I', 'L', 'A'},
+                                       {'N', 'I', 'U', 'D'},
+                                       {'V', 'I', 'L', 'J'},
+                                       {'V', 'I', 'U', 'X'},
+                                       {'V', 'A', 'L', 'J'},
+                                       {'N', 'A', 'U', 'X'}};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // invalid
+    {-1, 1, 1, 1},
+    {10, 5, 1, 1},
+    // normal (valid) samples
+    {1, 1, 1, 1},
+    {12, 12, 10, 12},
+    {20, 30, 1, 20},
+    {35, 35, 1, 15},
+    {50, 60, 20, 30}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_size_range
+//     = {{192, 192, 100, 170}, {256, 270, 1, 256}, {300, 300, 200, 300}};
+
+Arguments syev_auto_setup_arguments(syev_auto_tuple tup)
+{
+    vector<int>  size = std::get<0>(tup);
+    vector<char> op   = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", size[0]);
+    arg.set<rocblas_int>("lda", size[1]);
+    arg.set<rocblas_int>("il", size[2]);
+    arg.set<rocblas_int>("iu", size[3]);
+
+    arg.set<char>("jobz", op[0]);
+    arg.set<char>("range", op[1]);
+    arg.set<char>("uplo", op[2]);
+    arg.set<char>("alg", op[3]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API>
+class SYEV_AUTO_BASE : public ::TestWithParam<syev_auto_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = syev_auto_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 1 && arg.peek<char>("jobz") == 'N'
+           && arg.peek<char>("range") == 'A' && arg.peek<char>("uplo") == 'L'
+           && arg.peek<char>("alg") == 'A')
+            testing_syev_auto_bad_arg<API, T>();
+
+        arg.batch_count = 3;
+        testing_syev_auto<API, T>(arg);
+    }
+};
+
+class SYEV_AUTO : public SYEV_AUTO_BASE<API_COMPAT>
+{
+};
+
+class HEEV_AUTO : public SYEV_AUTO_BASE<API_COMPAT>
+{
+};
+
+// syevAuto is not available on the cuSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+// strided_batched tests
+
+TEST_P(SYEV_AUTO, strided_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(SYEV_AUTO, strided_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(HEEV_AUTO, strided_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(HEEV_AUTO, strided_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          SYEV_AUTO,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SYEV_AUTO,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          HEEV_AUTO,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         HEEV_AUTO,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
+#endif
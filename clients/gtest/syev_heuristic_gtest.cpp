@@ -0,0 +1,169 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+#include "clientcommon.hpp"
+#include "syev_heuristic.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_SYEV_HEURISTIC : public ::testing::Test
+{
+protected:
+    checkin_misc_SYEV_HEURISTIC() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_SYEV_HEURISTIC, defaults)
+{
+    hipsolver::syev_heuristic table = hipsolver::syev_heuristic::defaults();
+    EXPECT_EQ(table.device, "default");
+    EXPECT_FALSE(table.entries.empty());
+
+    // Jacobi for small matrices, syevdx for few eigenpairs of a large matrix
+    for(bool vectors : {false, true})
+    {
+        EXPECT_EQ(table.choose(vectors, 16, 1, 1.0), hipsolver::syev_alg_syevj);
+        EXPECT_EQ(table.choose(vectors, 64, 64, 1.0), hipsolver::syev_alg_syevj);
+        EXPECT_EQ(table.choose(vectors, 1024, 1, 0.1), hipsolver::syev_alg_syevdx);
+        EXPECT_EQ(table.choose(vectors, 1024, 1, 1.0), hipsolver::syev_alg_syevd);
+        EXPECT_EQ(table.choose(vectors, 1024, 512, 0.1), hipsolver::syev_alg_syevd);
+    }
+}
+
+TEST_F(checkin_misc_SYEV_HEURISTIC, choose)
+{
+    hipsolver::syev_heuristic table;
+
+    // an empty table falls back to divide-and-conquer
+    EXPECT_EQ(table.choose(true, 100, 1, 1.0), hipsolver::syev_alg_syevd);
+
+    table.entries.push_back({32, 1, true, 1.0, hipsolver::syev_alg_syevj});
+    table.entries.push_back({1024, 1, true, 1.0, hipsolver::syev_alg_syevd});
+    table.entries.push_back({1024, 1, true, 0.1, hipsolver::syev_alg_syevdx});
+    table.entries.push_back({1024, 1, false, 1.0, hipsolver::syev_alg_syevj});
+
+    // sizes are compared on a logarithmic scale
+    EXPECT_EQ(table.choose(true, 100, 1, 1.0), hipsolver::syev_alg_syevj);
+    EXPECT_EQ(table.choose(true, 300, 1, 1.0), hipsolver::syev_alg_syevd);
+    EXPECT_EQ(table.choose(true, 2048, 1, 0.2), hipsolver::syev_alg_syevdx);
+
+    // entries must agree on whether eigenvectors are wanted
+    EXPECT_EQ(table.choose(false, 32, 1, 0.1), hipsolver::syev_alg_syevj);
+}
+
+TEST_F(checkin_misc_SYEV_HEURISTIC, json)
+{
+    hipsolver::syev_heuristic table = hipsolver::syev_heuristic::defaults();
+    table.device                    = "gfx90a";
+
+    hipsolver::syev_heuristic parsed;
+    ASSERT_TRUE(hipsolver::syev_heuristic::from_json(table.to_json(), &parsed));
+    EXPECT_EQ(parsed.device, "gfx90a");
+    ASSERT_EQ(parsed.entries.size(), table.entries.size());
+    for(size_t i = 0; i < table.entries.size(); i++)
+    {
+        EXPECT_EQ(parsed.entries[i].n, table.entries[i].n);
+        EXPECT_EQ(parsed.entries[i].batch, table.entries[i].batch);
+        EXPECT_EQ(parsed.entries[i].vectors, table.entries[i].vectors);
+        EXPECT_DOUBLE_EQ(parsed.entries[i].fraction, table.entries[i].fraction);
+        EXPECT_EQ(parsed.entries[i].alg, table.entries[i].alg);
+    }
+
+    // unknown keys are skipped
+    std::string text = R"({"version": [1, {"x": null}], "device": "gfx942", "entries": [
+        {"n": 64, "batch": 8, "jobz": "V", "fraction": 0.5, "algorithm": "syevdx", "time": 1.5}]})";
+    ASSERT_TRUE(hipsolver::syev_heuristic::from_json(text, &parsed));
+    EXPECT_EQ(parsed.device, "gfx942");
+    ASSERT_EQ(parsed.entries.size(), 1);
+    EXPECT_EQ(parsed.entries[0].n, 64);
+    EXPECT_EQ(parsed.entries[0].batch, 8);
+    EXPECT_TRUE(parsed.entries[0].vectors);
+    EXPECT_DOUBLE_EQ(parsed.entries[0].fraction, 0.5);
+    EXPECT_EQ(parsed.entries[0].alg, hipsolver::syev_alg_syevdx);
+
+    // malformed tables and incomplete entries are rejected, leaving the table unchanged
+    for(const char* bad : {"",
+                           "{",
+                           R"({"entries": [})",
+                           R"({"entries": []} x)",
+                           R"({"entries": [{"n": 64, "batch": 8, "jobz": "V", "fraction": 0.5}]})",
+                           R"({"entries": [{"n": 6.5, "batch": 8, "jobz": "V", "fraction": 0.5,
+                                            "algorithm": "syevd"}]})",
+                           R"({"entries": [{"n": 64, "batch": 8, "jobz": "X", "fraction": 0.5,
+                                            "algorithm": "syevd"}]})",
+                           R"({"entries": [{"n": 64, "batch": 8, "jobz": "V", "fraction": 2,
+                                            "algorithm": "syevd"}]})",
+                           R"({"entries": [{"n": 64, "batch": 8, "jobz": "V", "fraction": 0.5,
+                                            "algorithm": "syev"}]})"})
+    {
+        EXPECT_FALSE(hipsolver::syev_heuristic::from_json(bad, &parsed)) << bad;
+        EXPECT_EQ(parsed.device, "gfx942");
+    }
+}
+
+TEST_F(checkin_misc_SYEV_HEURISTIC, file)
+{
+    hipsolver::syev_heuristic table = hipsolver::syev_heuristic::defaults();
+    hipsolver::syev_heuristic read;
+
+    std::string path = "syev_heuristic_gtest.json";
+    ASSERT_TRUE(table.write(path));
+    EXPECT_TRUE(hipsolver::syev_heuristic::read(path, &read));
+    EXPECT_EQ(read.entries.size(), table.entries.size());
+    std::remove(path.c_str());
+
+    EXPECT_FALSE(hipsolver::syev_heuristic::read(path, &read));
+}
+
+TEST_F(checkin_misc_SYEV_HEURISTIC, normal_execution)
+{
+    hipsolver_local_handle   handle;
+    hipsolverSyevAlgorithm_t alg;
+
+    hipsolverStatus_t stat = hipsolverDnGetSyevAutoAlgorithm(
+        handle, HIPSOLVER_EIG_MODE_VECTOR, HIPSOLVER_EIG_RANGE_ALL, 16, 0, 0, 1, &alg);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_TRUE(alg == HIPSOLVER_SYEV_ALG_SYEVD || alg == HIPSOLVER_SYEV_ALG_SYEVJ
+                || alg == HIPSOLVER_SYEV_ALG_SYEVDX);
+
+    // an algorithm set on the handle overrides its table
+    EXPECT_ROCBLAS_STATUS(hipsolverDnSetSyevAutoAlgorithm(handle, HIPSOLVER_SYEV_ALG_SYEVDX),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDnGetSyevAutoAlgorithm(
+            handle, HIPSOLVER_EIG_MODE_NOVECTOR, HIPSOLVER_EIG_RANGE_I, 100, 1, 10, 4, &alg),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(alg, HIPSOLVER_SYEV_ALG_SYEVDX);
+
+    // invalid indices are rejected
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDnGetSyevAutoAlgorithm(
+            handle, HIPSOLVER_EIG_MODE_NOVECTOR, HIPSOLVER_EIG_RANGE_I, 100, 10, 1, 4, &alg),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+}
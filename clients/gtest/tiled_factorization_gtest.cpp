@@ -0,0 +1,835 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+#include "tiled_factorization.hpp"
+
+#include <complex>
+#include <random>
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+using hipsolver::tile_schedule;
+using hipsolver::tile_task;
+
+namespace
+{
+
+double conj_(double x)
+{
+    return x;
+}
+
+std::complex<double> conj_(std::complex<double> x)
+{
+    return std::conj(x);
+}
+
+/* Runs a schedule on the host, in place of the device. The buffers of the device are host
+   vectors, and each task is computed by a naive kernel with the same effect as the rocBLAS and
+   rocSOLVER calls of the library. Tasks are picked at random among those that could start on a
+   device, that is, whose dependencies are complete and that are first in their queue. */
+template <typename T>
+class simulated_device
+{
+public:
+    simulated_device(const tile_schedule& s, bool upper, std::vector<T>& A, int64_t lda)
+        : ipiv(std::max(std::min(s.m, s.n), int64_t(1)))
+        , s(s)
+        , upper(upper)
+        , A(A)
+        , lda(lda)
+        , dipiv(ipiv.size())
+        , hipiv(ipiv.size())
+        , dinfo(std::max(s.factored(), int64_t(1)))
+    {
+        for(auto& b : panel)
+            b.assign(s.ld() * s.nb, T(0));
+        for(auto& b : stream)
+            b.assign(s.ld() * s.nb, T(0));
+    }
+
+    std::vector<int64_t> ipiv;
+
+    // Returns false if the schedule cannot complete
+    bool run(unsigned seed, int* info)
+    {
+        std::mt19937                    rng(seed);
+        std::vector<std::vector<int>>   queues(hipsolver::tile_queue_count);
+        std::vector<size_t>             next(hipsolver::tile_queue_count, 0);
+        std::vector<char>               done(s.tasks.size(), 0);
+        for(size_t i = 0; i < s.tasks.size(); i++)
+            queues[s.tasks[i].queue()].push_back(int(i));
+
+        for(size_t count = 0; count < s.tasks.size(); count++)
+        {
+            std::vector<int> ready;
+            for(int q = 0; q < hipsolver::tile_queue_count; q++)
+            {
+                if(next[q] == queues[q].size())
+                    continue;
+                const tile_task& t  = s.tasks[queues[q][next[q]]];
+                bool             ok = true;
+                for(int d : t.deps)
+                    ok = ok && done[d];
+                if(ok)
+                    ready.push_back(q);
+            }
+            if(ready.empty())
+                return false;
+
+            int q = ready[rng() % ready.size()];
+            int i = queues[q][next[q]++];
+            execute(s.tasks[i]);
+            done[i] = 1;
+        }
+
+        *info = 0;
+        for(int64_t j = 0; j < s.factored(); j++)
+        {
+            if(dinfo[j] > 0)
+            {
+                *info = int(dinfo[j] + j * s.nb);
+                break;
+            }
+        }
+        return true;
+    }
+
+private:
+    const tile_schedule& s;
+    bool                 upper;
+    std::vector<T>&      A;
+    int64_t              lda;
+    std::vector<T>       panel[tile_schedule::panel_buffers];
+    std::vector<T>       stream[tile_schedule::stream_buffers];
+    std::vector<int>     dipiv, hipiv, dinfo;
+
+    // Element (i, j) of the lower triangle, or of the upper triangle transposed
+    T& host(int64_t i, int64_t j)
+    {
+        return upper ? A[j + i * lda] : A[i + j * lda];
+    }
+
+    T from_host(int64_t i, int64_t j)
+    {
+        return upper ? conj_(host(i, j)) : host(i, j);
+    }
+
+    void to_host(int64_t i, int64_t j, T x)
+    {
+        host(i, j) = upper ? conj_(x) : x;
+    }
+
+    void execute(const tile_task& t)
+    {
+        int64_t         ld  = s.ld();
+        std::vector<T>& P   = panel[t.j % tile_schedule::panel_buffers];
+        int64_t         row = s.panel_row(t.j);
+        switch(t.op)
+        {
+        case hipsolver::tile_op_load_panel:
+            for(int64_t c = 0; c < s.width(t.j); c++)
+                for(int64_t r = row; r < s.m; r++)
+                    P[r - row + c * ld] = from_host(r, t.j * s.nb + c);
+            break;
+        case hipsolver::tile_op_load_block:
+            row = s.block_row(t.j, t.k);
+            for(int64_t c = 0; c < s.width(t.k); c++)
+                for(int64_t r = row; r < s.m; r++)
+                    stream[t.stream][r - row + c * ld] = from_host(r, t.k * s.nb + c);
+            break;
+        case hipsolver::tile_op_store_panel:
+            for(int64_t c = 0; c < s.width(t.j); c++)
+                for(int64_t r = row; r < s.m; r++)
+                    to_host(r, t.j * s.nb + c, P[r - row + c * ld]);
+            break;
+        case hipsolver::tile_op_store_pivots:
+            for(int64_t i = t.j * s.nb; i < t.j * s.nb + s.pivots(t.j); i++)
+                hipiv[i] = dipiv[i];
+            break;
+        case hipsolver::tile_op_update:
+            if(s.lu)
+                update_lu(t, P);
+            else
+                update_cholesky(t, P);
+            break;
+        case hipsolver::tile_op_factor:
+            if(s.lu)
+                factor_lu(t, P);
+            else
+                factor_cholesky(t, P);
+            break;
+        case hipsolver::tile_op_pivots:
+            for(int64_t i = t.j * s.nb; i < t.j * s.nb + s.pivots(t.j); i++)
+                ipiv[i] = hipiv[i] + t.j * s.nb;
+            break;
+        case hipsolver::tile_op_swap:
+            for(int64_t c = t.k * s.nb; c < t.k * s.nb + s.width(t.k); c++)
+                for(int64_t i = t.j * s.nb; i < t.j * s.nb + s.pivots(t.j); i++)
+                    std::swap(A[i + c * lda], A[ipiv[i] - 1 + c * lda]);
+            break;
+        }
+    }
+
+    // Block column k as loaded to update panel j, from row block_row(j, k)
+    T* source(const tile_task& t)
+    {
+        if(t.stream >= 0)
+            return stream[t.stream].data();
+        return panel[t.k % tile_schedule::panel_buffers].data() + s.block_row(t.j, t.k)
+               - s.panel_row(t.k);
+    }
+
+    void update_cholesky(const tile_task& t, std::vector<T>& P)
+    {
+        T*      B  = source(t);
+        int64_t ld = s.ld();
+        int64_t h  = s.n - t.j * s.nb;
+        for(int64_t c = 0; c < s.width(t.j); c++)
+            for(int64_t r = c; r < h; r++)
+                for(int64_t l = 0; l < s.width(t.k); l++)
+                    P[r + c * ld] -= B[r + l * ld] * conj_(B[c + l * ld]);
+    }
+
+    void factor_cholesky(const tile_task& t, std::vector<T>& P)
+    {
+        int64_t ld = s.ld();
+        int64_t h  = s.n - t.j * s.nb;
+        int64_t w  = s.width(t.j);
+        dinfo[t.j] = 0;
+        for(int64_t c = 0; c < w; c++)
+        {
+            double d = std::real(P[c + c * ld]);
+            for(int64_t l = 0; l < c; l++)
+                d -= std::norm(P[c + l * ld]);
+            if(d <= 0)
+            {
+                dinfo[t.j] = int(c + 1);
+                return;
+            }
+            P[c + c * ld] = std::sqrt(d);
+            for(int64_t r = c + 1; r < h; r++)
+            {
+                T x = P[r + c * ld];
+                for(int64_t l = 0; l < c; l++)
+                    x -= P[r + l * ld] * conj_(P[c + l * ld]);
+                P[r + c * ld] = x / P[c + c * ld];
+            }
+        }
+    }
+
+    // Applies the interchanges of block column b to cols columns of X, whose first row is row
+    void swap_rows(T* X, int64_t cols, int64_t b, int64_t row)
+    {
+        for(int64_t c = 0; c < cols; c++)
+            for(int64_t i = b * s.nb; i < b * s.nb + s.pivots(b); i++)
+                std::swap(X[i - row + c * s.ld()], X[b * s.nb + dipiv[i] - 1 - row + c * s.ld()]);
+    }
+
+    void update_lu(const tile_task& t, std::vector<T>& P)
+    {
+        T*      B  = source(t);
+        int64_t ld = s.ld();
+        int64_t r0 = t.k * s.nb;
+        int64_t p  = s.pivots(t.k);
+        for(int64_t b = 0; t.k == 0 && b < std::min(t.j, s.factored()); b++)
+            swap_rows(P.data(), s.width(t.j), b, 0);
+        for(int64_t b = t.k + 1; t.stream >= 0 && b < std::min(t.j, s.factored()); b++)
+            swap_rows(B, s.width(t.k), b, r0);
+
+        for(int64_t c = 0; c < s.width(t.j); c++)
+        {
+            T* x = P.data() + r0 + c * ld;
+            for(int64_t i = 0; i < s.m - r0; i++)
+                for(int64_t l = 0; l < std::min(i, p); l++)
+                    x[i] -= B[i + l * ld] * x[l];
+        }
+    }
+
+    void factor_lu(const tile_task& t, std::vector<T>& P)
+    {
+        int64_t ld = s.ld();
+        int64_t r0 = t.j * s.nb;
+        int64_t h  = s.m - r0;
+        T*      X  = P.data() + r0;
+        dinfo[t.j] = 0;
+        for(int64_t c = 0; c < s.pivots(t.j); c++)
+        {
+            int64_t piv = c;
+            for(int64_t i = c + 1; i < h; i++)
+                if(std::abs(X[i + c * ld]) > std::abs(X[piv + c * ld]))
+                    piv = i;
+            dipiv[r0 + c] = int(piv + 1);
+            for(int64_t l = 0; l < s.width(t.j); l++)
+                std::swap(X[c + l * ld], X[piv + l * ld]);
+
+            if(X[c + c * ld] == T(0))
+            {
+                if(dinfo[t.j] == 0)
+                    dinfo[t.j] = int(c + 1);
+                continue;
+            }
+            for(int64_t i = c + 1; i < h; i++)
+            {
+                X[i + c * ld] /= X[c + c * ld];
+                for(int64_t l = c + 1; l < s.width(t.j); l++)
+                    X[i + l * ld] -= X[i + c * ld] * X[c + l * ld];
+            }
+        }
+    }
+};
+
+template <typename T>
+std::vector<T> random_matrix(int64_t m, int64_t n, int64_t lda, unsigned seed)
+{
+    std::mt19937                           rng(seed);
+    std::uniform_real_distribution<double> dist(-1, 1);
+    std::vector<T>                         A(lda * n, T(0));
+    for(int64_t j = 0; j < n; j++)
+        for(int64_t i = 0; i < m; i++)
+            A[i + j * lda] = T(dist(rng));
+    return A;
+}
+
+template <>
+std::vector<std::complex<double>> random_matrix(int64_t m, int64_t n, int64_t lda, unsigned seed)
+{
+    std::mt19937                           rng(seed);
+    std::uniform_real_distribution<double> dist(-1, 1);
+    std::vector<std::complex<double>>      A(lda * n, 0);
+    for(int64_t j = 0; j < n; j++)
+        for(int64_t i = 0; i < m; i++)
+            A[i + j * lda] = std::complex<double>(dist(rng), dist(rng));
+    return A;
+}
+
+// Hermitian positive definite matrix, with the other triangle set to a marker
+template <typename T>
+std::vector<T> hpd_matrix(int64_t n, int64_t lda, bool upper, unsigned seed)
+{
+    std::vector<T> A = random_matrix<T>(n, n, lda, seed);
+    for(int64_t j = 0; j < n; j++)
+        for(int64_t i = 0; i < n; i++)
+        {
+            bool stored = upper ? i <= j : i >= j;
+            if(i == j)
+                A[i + j * lda] = T(n + std::real(A[i + j * lda]));
+            else if(!stored)
+                A[i + j * lda] = T(1234);
+        }
+    return A;
+}
+
+// Largest entry of |A - L * L**H| over the stored triangle, and whether the other one is intact
+template <typename T>
+double cholesky_error(const std::vector<T>& A,
+                      const std::vector<T>& F,
+                      int64_t               n,
+                      int64_t               lda,
+                      bool                  upper,
+                      bool*                 intact)
+{
+    auto L = [&](int64_t i, int64_t j) {
+        if(j > i)
+            return T(0);
+        return upper ? conj_(F[j + i * lda]) : F[i + j * lda];
+    };
+
+    double err = 0;
+    *intact    = true;
+    for(int64_t j = 0; j < n; j++)
+        for(int64_t i = 0; i < n; i++)
+        {
+            bool stored = upper ? i <= j : i >= j;
+            if(!stored)
+            {
+                *intact = *intact && F[i + j * lda] == A[i + j * lda];
+                continue;
+            }
+
+            int64_t r = upper ? j : i, c = upper ? i : j;
+            T       x = upper ? conj_(A[i + j * lda]) : A[i + j * lda];
+            for(int64_t l = 0; l <= c; l++)
+                x -= L(r, l) * conj_(L(c, l));
+            err = std::max(err, std::abs(x));
+        }
+    return err;
+}
+
+// Largest entry of |P * A - L * U|, where P is given by ipiv
+template <typename T>
+double lu_error(const std::vector<T>&       A,
+                const std::vector<T>&       F,
+                const std::vector<int64_t>& ipiv,
+                int64_t                     m,
+                int64_t                     n,
+                int64_t                     lda)
+{
+    std::vector<T> PA = A;
+    for(int64_t i = 0; i < std::min(m, n); i++)
+    {
+        EXPECT_GE(ipiv[i], i + 1);
+        EXPECT_LE(ipiv[i], m);
+        for(int64_t c = 0; c < n; c++)
+            std::swap(PA[i + c * lda], PA[ipiv[i] - 1 + c * lda]);
+    }
+
+    double err = 0;
+    for(int64_t j = 0; j < n; j++)
+        for(int64_t i = 0; i < m; i++)
+        {
+            T x = PA[i + j * lda];
+            for(int64_t l = 0; l <= std::min(i, j); l++)
+                x -= (l == i ? T(1) : F[i + l * lda]) * F[l + j * lda];
+            err = std::max(err, std::abs(x));
+        }
+    return err;
+}
+
+/* Resources read and written by a task: the panel and stream buffers, the pivots of each block
+   column on the device, in the staging area and in ipiv, and each block column of the host
+   matrix. */
+struct tile_access
+{
+    int  resource;
+    bool write;
+};
+
+std::vector<tile_access> accesses(const tile_schedule& s, const tile_task& t)
+{
+    int64_t panels  = s.panels();
+    int     P       = 0;
+    int     S       = P + tile_schedule::panel_buffers;
+    int     dpiv    = S + tile_schedule::stream_buffers;
+    int     staging = dpiv + int(panels);
+    int     ipiv    = staging + int(panels);
+    int     H       = ipiv + int(panels);
+    int     pj      = P + int(t.j % tile_schedule::panel_buffers);
+
+    switch(t.op)
+    {
+    case hipsolver::tile_op_load_panel:
+        return {{pj, true}, {H + int(t.j), false}};
+    case hipsolver::tile_op_load_block:
+        return {{S + t.stream, true}, {H + int(t.k), false}};
+    case hipsolver::tile_op_update:
+    {
+        std::vector<tile_access> result
+            = {{pj, true},
+               {t.stream >= 0 ? S + t.stream : P + int(t.k % tile_schedule::panel_buffers), false}};
+        // the interchanges of the block columns before panel j are applied to it, and those of
+        // the block columns between k and j to the streamed block column k
+        if(s.lu && t.stream >= 0)
+            result[1].write = true;
+        for(int64_t i = 0; t.k == 0 && i < std::min(t.j, s.factored()); i++)
+            result.push_back({dpiv + int(i), false});
+        for(int64_t i = t.k + 1; t.stream >= 0 && i < std::min(t.j, s.factored()); i++)
+            result.push_back({dpiv + int(i), false});
+        return result;
+    }
+    case hipsolver::tile_op_factor:
+        return {{pj, true}, {dpiv + int(t.j), true}};
+    case hipsolver::tile_op_store_pivots:
+        return {{dpiv + int(t.j), false}, {staging + int(t.j), true}};
+    case hipsolver::tile_op_store_panel:
+        return {{pj, false}, {H + int(t.j), true}};
+    case hipsolver::tile_op_pivots:
+        return {{staging + int(t.j), false}, {ipiv + int(t.j), true}};
+    case hipsolver::tile_op_swap:
+        return {{ipiv + int(t.j), false}, {H + int(t.k), true}};
+    }
+    return {};
+}
+
+/* Checks that tasks that may run at the same time, because neither is ordered before the other
+   by the dependencies and the order of the queues, do not write a resource used by the other. */
+void expect_no_hazards(const tile_schedule& s)
+{
+    size_t                         count = s.tasks.size();
+    std::vector<std::vector<char>> before(count, std::vector<char>(count, 0));
+    std::vector<int>               last(hipsolver::tile_queue_count, -1);
+    for(size_t i = 0; i < count; i++)
+    {
+        const tile_task& t    = s.tasks[i];
+        std::vector<int> deps = t.deps;
+        if(last[t.queue()] >= 0)
+            deps.push_back(last[t.queue()]);
+        last[t.queue()] = int(i);
+
+        for(int d : deps)
+        {
+            ASSERT_LT(size_t(d), i);
+            before[i][d] = 1;
+            for(size_t k = 0; k < count; k++)
+                before[i][k] |= before[d][k];
+        }
+    }
+
+    for(size_t i = 0; i < count; i++)
+        for(size_t k = 0; k < i; k++)
+        {
+            if(before[i][k])
+                continue;
+            for(const tile_access& a : accesses(s, s.tasks[i]))
+                for(const tile_access& b : accesses(s, s.tasks[k]))
+                    EXPECT_FALSE(a.resource == b.resource && (a.write || b.write))
+                        << "tasks " << k << " and " << i << " race";
+        }
+}
+
+/* Time to complete the schedule when every queue runs its tasks as soon as their dependencies
+   allow, with copies of an element taking copy_time and multiply-adds taking flop_time. */
+double makespan(const tile_schedule& s, double copy_time, double flop_time, double* serial)
+{
+    std::vector<double> finish(s.tasks.size());
+    std::vector<double> free(hipsolver::tile_queue_count, 0);
+    *serial = 0;
+    for(size_t i = 0; i < s.tasks.size(); i++)
+    {
+        const tile_task& t = s.tasks[i];
+        double           w = double(s.width(t.j)), wk = t.k >= 0 ? double(s.width(t.k)) : 0;
+        double           h = double(s.m - (s.lu ? 0 : t.j * s.nb));
+        double           duration;
+        switch(t.op)
+        {
+        case hipsolver::tile_op_load_panel:
+        case hipsolver::tile_op_store_panel:
+            duration = copy_time * h * w;
+            break;
+        case hipsolver::tile_op_load_block:
+            duration = copy_time * double(s.m - s.block_row(t.j, t.k)) * wk;
+            break;
+        case hipsolver::tile_op_update:
+            duration = flop_time * h * w * wk;
+            break;
+        case hipsolver::tile_op_factor:
+            duration = flop_time * h * w * w / 2;
+            break;
+        default:
+            duration = 0;
+        }
+
+        double start = free[t.queue()];
+        for(int d : t.deps)
+            start = std::max(start, finish[d]);
+        finish[i]        = start + duration;
+        free[t.queue()]  = finish[i];
+        *serial         += duration;
+    }
+    return *std::max_element(finish.begin(), finish.end());
+}
+
+}
+
+class checkin_misc_TILED_FACTORIZATION : public ::testing::Test
+{
+protected:
+    checkin_misc_TILED_FACTORIZATION() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_TILED_FACTORIZATION, schedule)
+{
+    // block columns of 8 columns, the last one narrower
+    tile_schedule s = tile_schedule::cholesky(37, 8);
+    EXPECT_EQ(s.panels(), 5);
+    EXPECT_EQ(s.factored(), 5);
+    EXPECT_EQ(s.width(4), 5);
+    EXPECT_EQ(s.buffer_elements(), size_t(4 * 37 * 8));
+
+    // each block column is loaded, factored and stored once; the block column factored last
+    // is used from its panel buffer, and the others are streamed
+    int counts[8] = {};
+    for(const tile_task& t : s.tasks)
+        counts[t.op]++;
+    EXPECT_EQ(counts[hipsolver::tile_op_load_panel], 5);
+    EXPECT_EQ(counts[hipsolver::tile_op_factor], 5);
+    EXPECT_EQ(counts[hipsolver::tile_op_store_panel], 5);
+    EXPECT_EQ(counts[hipsolver::tile_op_update], 10);
+    EXPECT_EQ(counts[hipsolver::tile_op_load_block], 6);
+    EXPECT_EQ(counts[hipsolver::tile_op_store_pivots] + counts[hipsolver::tile_op_pivots]
+                  + counts[hipsolver::tile_op_swap],
+              0);
+
+    // LU of a wide matrix: only the first block columns have pivots, and the interchanges of
+    // each are applied to the stored block columns to its left
+    s = tile_schedule::getrf(20, 45, 8);
+    EXPECT_EQ(s.panels(), 6);
+    EXPECT_EQ(s.factored(), 3);
+    EXPECT_EQ(s.pivots(2), 4);
+    EXPECT_EQ(s.pivots(3), 0);
+    for(int& c : counts)
+        c = 0;
+    for(const tile_task& t : s.tasks)
+        counts[t.op]++;
+    EXPECT_EQ(counts[hipsolver::tile_op_factor], 3);
+    EXPECT_EQ(counts[hipsolver::tile_op_store_pivots], 3);
+    EXPECT_EQ(counts[hipsolver::tile_op_pivots], 3);
+    EXPECT_EQ(counts[hipsolver::tile_op_swap], 3);
+    EXPECT_EQ(counts[hipsolver::tile_op_update], 1 + 2 + 3 * 3);
+
+    // default tile sizes
+    EXPECT_EQ(tile_schedule::default_tile_size(200000, 200000, 8, 0), 1024);
+    EXPECT_EQ(tile_schedule::default_tile_size(100, 100, 8, 0), 100);
+    EXPECT_EQ(tile_schedule::default_tile_size(200000, 200000, 8, size_t(4) << 30), 512);
+    EXPECT_EQ(tile_schedule::default_tile_size(1000, 1000, 8, 1), 1);
+}
+
+TEST_F(checkin_misc_TILED_FACTORIZATION, hazards)
+{
+    for(int64_t nb : {1, 3, 8, 40})
+    {
+        SCOPED_TRACE(nb);
+        expect_no_hazards(tile_schedule::cholesky(37, nb));
+        expect_no_hazards(tile_schedule::getrf(37, 37, nb));
+        expect_no_hazards(tile_schedule::getrf(45, 20, nb));
+        expect_no_hazards(tile_schedule::getrf(20, 45, nb));
+    }
+}
+
+TEST_F(checkin_misc_TILED_FACTORIZATION, simulated_cholesky)
+{
+    const int64_t n = 37, lda = 40;
+    for(bool upper : {false, true})
+        for(int64_t nb : {1, 5, 8, 37, 64})
+            for(unsigned seed : {1u, 2u, 3u})
+            {
+                SCOPED_TRACE(testing::Message() << "upper " << upper << " nb " << nb);
+                tile_schedule s = tile_schedule::cholesky(n, nb);
+
+                std::vector<double>                    A = hpd_matrix<double>(n, lda, upper, seed);
+                std::vector<double>                    F = A;
+                simulated_device<double>               device(s, upper, F, lda);
+                int                                    info;
+                bool                                   intact;
+                ASSERT_TRUE(device.run(seed, &info));
+                EXPECT_EQ(info, 0);
+                EXPECT_LT(cholesky_error(A, F, n, lda, upper, &intact), 1e-10);
+                EXPECT_TRUE(intact);
+
+                using Z                              = std::complex<double>;
+                std::vector<Z>                     B = hpd_matrix<Z>(n, lda, upper, seed);
+                std::vector<Z>                     G = B;
+                simulated_device<Z>                zdevice(s, upper, G, lda);
+                ASSERT_TRUE(zdevice.run(seed, &info));
+                EXPECT_EQ(info, 0);
+                EXPECT_LT(cholesky_error(B, G, n, lda, upper, &intact), 1e-10);
+                EXPECT_TRUE(intact);
+            }
+}
+
+TEST_F(checkin_misc_TILED_FACTORIZATION, simulated_getrf)
+{
+    const int64_t sizes[][2] = {{37, 37}, {45, 20}, {20, 45}, {1, 9}, {9, 1}};
+    for(const auto& size : sizes)
+        for(int64_t nb : {1, 4, 8, 64})
+            for(unsigned seed : {1u, 2u, 3u})
+            {
+                int64_t m = size[0], n = size[1], lda = m + 2;
+                SCOPED_TRACE(testing::Message() << m << "x" << n << " nb " << nb);
+                tile_schedule s = tile_schedule::getrf(m, n, nb);
+
+                std::vector<double>      A = random_matrix<double>(m, n, lda, seed);
+                std::vector<double>      F = A;
+                simulated_device<double> device(s, false, F, lda);
+                int                      info;
+                ASSERT_TRUE(device.run(seed, &info));
+                EXPECT_EQ(info, 0);
+                EXPECT_LT(lu_error(A, F, device.ipiv, m, n, lda), 1e-10);
+
+                // the pivots are those of partial pivoting on the whole matrix
+                std::vector<double> R = A;
+                for(int64_t c = 0; c < std::min(m, n); c++)
+                {
+                    int64_t piv = c;
+                    for(int64_t i = c + 1; i < m; i++)
+                        if(std::abs(R[i + c * lda]) > std::abs(R[piv + c * lda]))
+                            piv = i;
+                    EXPECT_EQ(device.ipiv[c], piv + 1);
+                    for(int64_t l = 0; l < n; l++)
+                        std::swap(R[c + l * lda], R[piv + l * lda]);
+                    for(int64_t i = c + 1; i < m; i++)
+                    {
+                        R[i + c * lda] /= R[c + c * lda];
+                        for(int64_t l = c + 1; l < n; l++)
+                            R[i + l * lda] -= R[i + c * lda] * R[c + l * lda];
+                    }
+                }
+            }
+}
+
+TEST_F(checkin_misc_TILED_FACTORIZATION, simulated_info)
+{
+    const int64_t n = 37;
+
+    // the leading minor of order 14 is not positive definite
+    std::vector<double> A = hpd_matrix<double>(n, n, false, 1);
+    A[13 + 13 * n]        = -100;
+    tile_schedule            s = tile_schedule::cholesky(n, 8);
+    simulated_device<double> device(s, false, A, n);
+    int                      info;
+    ASSERT_TRUE(device.run(1, &info));
+    EXPECT_EQ(info, 14);
+
+    // column 22 is zero, so U(22, 22) is zero
+    std::vector<double> B = random_matrix<double>(n, n, n, 1);
+    for(int64_t i = 0; i < n; i++)
+        B[i + 21 * n] = 0;
+    s = tile_schedule::getrf(n, n, 8);
+    simulated_device<double> ldevice(s, false, B, n);
+    ASSERT_TRUE(ldevice.run(1, &info));
+    EXPECT_EQ(info, 22);
+}
+
+TEST_F(checkin_misc_TILED_FACTORIZATION, overlap)
+{
+    // with copies as costly as the computation, the copies of a block column are hidden behind
+    // the computation on the previous one
+    for(bool lu : {false, true})
+    {
+        tile_schedule s = lu ? tile_schedule::getrf(4096, 4096, 256)
+                             : tile_schedule::cholesky(4096, 256);
+        double serial;
+        double time = makespan(s, 256, 1, &serial);
+        EXPECT_LT(time, 0.6 * serial);
+    }
+}
+
+TEST_F(checkin_misc_TILED_FACTORIZATION, normal_execution)
+{
+    hipsolver_local_handle handle;
+    hipsolverDnParams_t    params;
+    EXPECT_ROCBLAS_STATUS(hipsolverDnCreateParams(&params), HIPSOLVER_STATUS_SUCCESS);
+
+    const int64_t n = 100, nb = 16;
+    size_t        lworkOnDevice, lworkOnHost;
+
+    hipsolverStatus_t stat = hipsolverDnXpotrfOutOfCore_bufferSize(handle,
+                                                                   params,
+                                                                   HIPSOLVER_FILL_MODE_LOWER,
+                                                                   n,
+                                                                   HIP_R_64F,
+                                                                   nullptr,
+                                                                   n,
+                                                                   HIP_R_64F,
+                                                                   nb,
+                                                                   &lworkOnDevice,
+                                                                   &lworkOnHost);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+    {
+        hipsolverDnDestroyParams(params);
+        return;
+    }
+    EXPECT_GE(lworkOnDevice, sizeof(double) * 4 * n * nb);
+
+    // the factors are returned in host memory, pinned or not
+    double* hA;
+    CHECK_HIP_ERROR(hipHostMalloc((void**)&hA, sizeof(double) * n * n, 0));
+    std::vector<double> A = hpd_matrix<double>(n, n, false, 1);
+    std::copy(A.begin(), A.end(), hA);
+
+    int  info = -1;
+    bool intact;
+    EXPECT_ROCBLAS_STATUS(hipsolverDnXpotrfOutOfCore(handle,
+                                                     params,
+                                                     HIPSOLVER_FILL_MODE_LOWER,
+                                                     n,
+                                                     HIP_R_64F,
+                                                     hA,
+                                                     n,
+                                                     HIP_R_64F,
+                                                     nb,
+                                                     nullptr,
+                                                     0,
+                                                     nullptr,
+                                                     0,
+                                                     &info),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(info, 0);
+    EXPECT_LT(cholesky_error(A, std::vector<double>(hA, hA + n * n), n, n, false, &intact), 1e-8);
+    EXPECT_TRUE(intact);
+    CHECK_HIP_ERROR(hipHostFree(hA));
+
+    std::vector<double>  B = random_matrix<double>(n, n, n, 2);
+    std::vector<double>  F = B;
+    std::vector<int64_t> ipiv(n);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnXgetrfOutOfCore(handle,
+                                                     params,
+                                                     n,
+                                                     n,
+                                                     HIP_R_64F,
+                                                     F.data(),
+                                                     n,
+                                                     ipiv.data(),
+                                                     HIP_R_64F,
+                                                     nb,
+                                                     nullptr,
+                                                     0,
+                                                     nullptr,
+                                                     0,
+                                                     &info),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(info, 0);
+    EXPECT_LT(lu_error(B, F, ipiv, n, n, n), 1e-8);
+
+    // invalid arguments
+    EXPECT_ROCBLAS_STATUS(hipsolverDnXgetrfOutOfCore(handle,
+                                                     params,
+                                                     n,
+                                                     n,
+                                                     HIP_R_64F,
+                                                     F.data(),
+                                                     n,
+                                                     ipiv.data(),
+                                                     HIP_R_64F,
+                                                     -1,
+                                                     nullptr,
+                                                     0,
+                                                     nullptr,
+                                                     0,
+                                                     &info),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnXgetrfOutOfCore(handle,
+                                                     params,
+                                                     n,
+                                                     n,
+                                                     HIP_R_64F,
+                                                     F.data(),
+                                                     n,
+                                                     nullptr,
+                                                     HIP_R_64F,
+                                                     nb,
+                                                     nullptr,
+                                                     0,
+                                                     nullptr,
+                                                     0,
+                                                     &info),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    hipsolverDnDestroyParams(params);
+}
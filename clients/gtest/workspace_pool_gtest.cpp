@@ -0,0 +1,206 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+#include "workspace_pool_tracker.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_WORKSPACE_POOL : public ::testing::Test
+{
+protected:
+    checkin_misc_WORKSPACE_POOL() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_WORKSPACE_POOL, tracker_reuse)
+{
+    hipsolver::workspace_pool_tracker tracker;
+
+    // blocks grow when needed and are reused otherwise
+    EXPECT_TRUE(tracker.must_reallocate(0, 100));
+    tracker.on_allocate(100);
+    EXPECT_FALSE(tracker.must_reallocate(100, 100));
+    EXPECT_FALSE(tracker.must_reallocate(100, 10));
+    EXPECT_TRUE(tracker.must_reallocate(100, 200));
+    tracker.on_release(100);
+    tracker.on_allocate(200);
+
+    EXPECT_EQ(tracker.bytes_in_use, 200);
+    EXPECT_EQ(tracker.peak_bytes_in_use, 200);
+    EXPECT_EQ(tracker.reallocations, 2);
+
+    tracker.on_release(200);
+    EXPECT_EQ(tracker.bytes_in_use, 0);
+    EXPECT_EQ(tracker.peak_bytes_in_use, 200);
+}
+
+TEST_F(checkin_misc_WORKSPACE_POOL, tracker_watermarks)
+{
+    hipsolver::workspace_pool_tracker tracker;
+
+    EXPECT_FALSE(tracker.set_watermarks(200, 100));
+    EXPECT_TRUE(tracker.set_watermarks(100, 1000));
+    EXPECT_EQ(tracker.low_watermark, 100);
+    EXPECT_EQ(tracker.high_watermark, 1000);
+
+    // oversized blocks are only shrunk above the high watermark
+    tracker.on_allocate(800);
+    EXPECT_FALSE(tracker.must_reallocate(800, 100));
+    tracker.on_allocate(800);
+    EXPECT_TRUE(tracker.must_reallocate(800, 100));
+    EXPECT_FALSE(tracker.must_reallocate(800, 400));
+
+    EXPECT_FALSE(tracker.should_trim(1000));
+    EXPECT_TRUE(tracker.should_trim(1001));
+    tracker.on_trim();
+    EXPECT_EQ(tracker.trims, 1);
+}
+
+TEST_F(checkin_misc_WORKSPACE_POOL, normal_execution)
+{
+    hipsolver_local_handle   handle;
+    hipsolverWorkspacePool_t pool;
+
+    hipsolverStatus_t stat = hipsolverCreateWorkspacePool(&pool);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspacePool(handle, pool), HIPSOLVER_STATUS_SUCCESS);
+
+    int n = 256, lwork;
+
+    device_strided_batch_vector<float> dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<int>   dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int>   dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    CHECK_HIP_ERROR(hipMemset(dA.data(), 0, sizeof(float) * n * n));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrf_bufferSize(handle, n, n, dA.data(), n, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    // the workspace is taken from the pool when none is provided
+    hipsolverWorkspacePoolStats_t stats;
+    for(int i = 0; i < 2; i++)
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverSgetrf(handle, n, n, dA.data(), n, nullptr, 0, dIpiv.data(), dInfo.data()),
+            HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverWorkspacePoolGetStats(pool, &stats), HIPSOLVER_STATUS_SUCCESS);
+    if(lwork > 0)
+    {
+        EXPECT_EQ(stats.bytes_in_use, size_t(lwork));
+        EXPECT_EQ(stats.peak_bytes_in_use, size_t(lwork));
+        EXPECT_GE(stats.bytes_reserved, size_t(lwork));
+        EXPECT_EQ(stats.reallocations, 1);
+    }
+
+    // trimming marks the blocks held by the handles as stale; each handle replaces its block on
+    // its next call
+    EXPECT_ROCBLAS_STATUS(hipsolverWorkspacePoolTrim(pool), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverWorkspacePoolGetStats(pool, &stats), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(stats.trims, 1);
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSgetrf(handle, n, n, dA.data(), n, nullptr, 0, dIpiv.data(), dInfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    EXPECT_ROCBLAS_STATUS(hipsolverWorkspacePoolGetStats(pool, &stats), HIPSOLVER_STATUS_SUCCESS);
+    if(lwork > 0)
+    {
+        EXPECT_EQ(stats.bytes_in_use, size_t(lwork));
+        EXPECT_EQ(stats.reallocations, 2);
+    }
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspacePool(handle, nullptr), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverWorkspacePoolGetStats(pool, &stats), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(stats.bytes_in_use, 0);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyWorkspacePool(pool), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_F(checkin_misc_WORKSPACE_POOL, destroy_attached)
+{
+    hipsolver_local_handle   handle;
+    hipsolverWorkspacePool_t pool;
+
+    hipsolverStatus_t stat = hipsolverCreateWorkspacePool(&pool);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspacePool(handle, pool), HIPSOLVER_STATUS_SUCCESS);
+
+    int n = 256;
+
+    device_strided_batch_vector<float> dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<int>   dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int>   dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    CHECK_HIP_ERROR(hipMemset(dA.data(), 0, sizeof(float) * n * n));
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSgetrf(handle, n, n, dA.data(), n, nullptr, 0, dIpiv.data(), dInfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+
+    // the handle is detached by its next call, which takes its workspace from rocBLAS again
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyWorkspacePool(pool), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSgetrf(handle, n, n, dA.data(), n, nullptr, 0, dIpiv.data(), dInfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspacePool(handle, nullptr), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_F(checkin_misc_WORKSPACE_POOL, bad_arguments)
+{
+    hipsolver_local_handle        handle;
+    hipsolverWorkspacePool_t      pool;
+    hipsolverWorkspacePoolStats_t stats;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateWorkspacePool(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyWorkspacePool(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverWorkspacePoolTrim(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverWorkspacePoolGetStats(nullptr, &stats),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspacePool(nullptr, nullptr),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    hipsolverStatus_t stat = hipsolverCreateWorkspacePool(&pool);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverWorkspacePoolSetWatermarks(pool, 200, 100),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverWorkspacePoolGetStats(pool, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyWorkspacePool(pool), HIPSOLVER_STATUS_SUCCESS);
+}
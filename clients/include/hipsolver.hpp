@@ -2029,27 +2029,214 @@ inline hipsolverStatus_t hipsolver_gels(testAPI_t               API,
 }
 /********************************************************/
 
+/******************** GELS (MIXED PRECISION) ********************/
+// HALF selects the variant that factorizes A in half precision (DH) instead of single precision
+// (DS and ZC); there is no complex half-precision variant
+inline hipsolverStatus_t hipsolver_gels_mixed_bufferSize(testAPI_t         API,
+                                                         bool              HALF,
+                                                         hipsolverHandle_t handle,
+                                                         int               m,
+                                                         int               n,
+                                                         int               nrhs,
+                                                         double*           A,
+                                                         int               lda,
+                                                         double*           B,
+                                                         int               ldb,
+                                                         double*           X,
+                                                         int               ldx,
+                                                         size_t*           lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        if(HALF)
+            return hipsolverDHgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
+        else
+            return hipsolverDSgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
+    case API_COMPAT:
+        if(HALF)
+            return hipsolverDnDHgels_bufferSize(
+                handle, m, n, nrhs, A, lda, B, ldb, X, ldx, nullptr, lwork);
+        else
+            return hipsolverDnDSgels_bufferSize(
+                handle, m, n, nrhs, A, lda, B, ldb, X, ldx, nullptr, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gels_mixed_bufferSize(testAPI_t               API,
+                                                         bool                    HALF,
+                                                         hipsolverHandle_t       handle,
+                                                         int                     m,
+                                                         int                     n,
+                                                         int                     nrhs,
+                                                         hipsolverDoubleComplex* A,
+                                                         int                     lda,
+                                                         hipsolverDoubleComplex* B,
+                                                         int                     ldb,
+                                                         hipsolverDoubleComplex* X,
+                                                         int                     ldx,
+                                                         size_t*                 lwork)
+{
+    if(HALF)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZCgels_bufferSize(handle,
+                                          m,
+                                          n,
+                                          nrhs,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          (hipDoubleComplex*)X,
+                                          ldx,
+                                          lwork);
+    case API_COMPAT:
+        return hipsolverDnZCgels_bufferSize(handle,
+                                            m,
+                                            n,
+                                            nrhs,
+                                            (hipDoubleComplex*)A,
+                                            lda,
+                                            (hipDoubleComplex*)B,
+                                            ldb,
+                                            (hipDoubleComplex*)X,
+                                            ldx,
+                                            nullptr,
+                                            lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gels_mixed(testAPI_t         API,
+                                              bool              HALF,
+                                              hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              int               nrhs,
+                                              double*           A,
+                                              int               lda,
+                                              double*           B,
+                                              int               ldb,
+                                              double*           X,
+                                              int               ldx,
+                                              void*             work,
+                                              size_t            lwork,
+                                              int*              niters,
+                                              int*              info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        if(HALF)
+            return hipsolverDHgels(
+                handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
+        else
+            return hipsolverDSgels(
+                handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
+    case API_COMPAT:
+        if(HALF)
+            return hipsolverDnDHgels(
+                handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
+        else
+            return hipsolverDnDSgels(
+                handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gels_mixed(testAPI_t               API,
+                                              bool                    HALF,
+                                              hipsolverHandle_t       handle,
+                                              int                     m,
+                                              int                     n,
+                                              int                     nrhs,
+                                              hipsolverDoubleComplex* A,
+                                              int                     lda,
+                                              hipsolverDoubleComplex* B,
+                                              int                     ldb,
+                                              hipsolverDoubleComplex* X,
+                                              int                     ldx,
+                                              void*                   work,
+                                              size_t                  lwork,
+                                              int*                    niters,
+                                              int*                    info)
+{
+    if(HALF)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZCgels(handle,
+                               m,
+                               n,
+                               nrhs,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               (hipDoubleComplex*)X,
+                               ldx,
+                               work,
+                               lwork,
+                               niters,
+                               info);
+    case API_COMPAT:
+        return hipsolverDnZCgels(handle,
+                                 m,
+                                 n,
+                                 nrhs,
+                                 (hipDoubleComplex*)A,
+                                 lda,
+                                 (hipDoubleComplex*)B,
+                                 ldb,
+                                 (hipDoubleComplex*)X,
+                                 ldx,
+                                 work,
+                                 lwork,
+                                 niters,
+                                 info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
 /******************** GEQRF ********************/
 // normal and strided_batched
 inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverDnParams_t params,
                                                     int                 m,
                                                     int                 n,
                                                     float*              A,
                                                     int                 lda,
+                                                    int                 stA,
                                                     float*              tau,
                                                     int*                lworkOnDevice,
-                                                    int*                lworkOnHost)
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
 {
     *lworkOnHost = 0;
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
-    case API_FORTRAN:
+    case C_NORMAL_ALT:
+        return hipsolverSgeqrfStridedBatched_bufferSize(
+            handle, m, n, A, lda, stA, lworkOnDevice, bc);
+    case FORTRAN_NORMAL:
         return hipsolverSgeqrf_bufferSizeFortran(handle, m, n, A, lda, lworkOnDevice);
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnSgeqrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
     default:
         *lworkOnDevice = 0;
@@ -2058,24 +2245,30 @@ inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t           API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverDnParams_t params,
                                                     int                 m,
                                                     int                 n,
                                                     double*             A,
                                                     int                 lda,
+                                                    int                 stA,
                                                     double*             tau,
                                                     int*                lworkOnDevice,
-                                                    int*                lworkOnHost)
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
 {
     *lworkOnHost = 0;
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
-    case API_FORTRAN:
+    case C_NORMAL_ALT:
+        return hipsolverDgeqrfStridedBatched_bufferSize(
+            handle, m, n, A, lda, stA, lworkOnDevice, bc);
+    case FORTRAN_NORMAL:
         return hipsolverDgeqrf_bufferSizeFortran(handle, m, n, A, lda, lworkOnDevice);
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnDgeqrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
     default:
         *lworkOnDevice = 0;
@@ -2084,25 +2277,31 @@ inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t           API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverDnParams_t params,
                                                     int                 m,
                                                     int                 n,
                                                     hipsolverComplex*   A,
                                                     int                 lda,
+                                                    int                 stA,
                                                     hipsolverComplex*   tau,
                                                     int*                lworkOnDevice,
-                                                    int*                lworkOnHost)
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
 {
     *lworkOnHost = 0;
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverCgeqrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
-    case API_FORTRAN:
+    case C_NORMAL_ALT:
+        return hipsolverCgeqrfStridedBatched_bufferSize(
+            handle, m, n, (hipFloatComplex*)A, lda, stA, lworkOnDevice, bc);
+    case FORTRAN_NORMAL:
         return hipsolverCgeqrf_bufferSizeFortran(
             handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnCgeqrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
     default:
         *lworkOnDevice = 0;
@@ -2111,25 +2310,31 @@ inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t           API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
                                                     hipsolverHandle_t       handle,
                                                     hipsolverDnParams_t     params,
                                                     int                     m,
                                                     int                     n,
                                                     hipsolverDoubleComplex* A,
                                                     int                     lda,
+                                                    int                     stA,
                                                     hipsolverDoubleComplex* tau,
                                                     int*                    lworkOnDevice,
-                                                    int*                    lworkOnHost)
+                                                    int*                    lworkOnHost,
+                                                    int                     bc)
 {
     *lworkOnHost = 0;
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverZgeqrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
-    case API_FORTRAN:
+    case C_NORMAL_ALT:
+        return hipsolverZgeqrfStridedBatched_bufferSize(
+            handle, m, n, (hipDoubleComplex*)A, lda, stA, lworkOnDevice, bc);
+    case FORTRAN_NORMAL:
         return hipsolverZgeqrf_bufferSizeFortran(
             handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnZgeqrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
     default:
         *lworkOnDevice = 0;
@@ -2138,19 +2343,22 @@ inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t               API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverDnParams_t params,
                                                     int64_t             m,
                                                     int64_t             n,
                                                     float*              A,
                                                     int64_t             lda,
+                                                    int64_t             stA,
                                                     float*              tau,
                                                     size_t*             lworkOnDevice,
-                                                    size_t*             lworkOnHost)
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnXgeqrf_bufferSize(handle,
                                             params,
                                             m,
@@ -2171,19 +2379,22 @@ inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t           API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverDnParams_t params,
                                                     int64_t             m,
                                                     int64_t             n,
                                                     double*             A,
                                                     int64_t             lda,
+                                                    int64_t             stA,
                                                     double*             tau,
                                                     size_t*             lworkOnDevice,
-                                                    size_t*             lworkOnHost)
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnXgeqrf_bufferSize(handle,
                                             params,
                                             m,
@@ -2204,19 +2415,22 @@ inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t           API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverDnParams_t params,
                                                     int64_t             m,
                                                     int64_t             n,
                                                     hipsolverComplex*   A,
                                                     int64_t             lda,
+                                                    int64_t             stA,
                                                     hipsolverComplex*   tau,
                                                     size_t*             lworkOnDevice,
-                                                    size_t*             lworkOnHost)
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnXgeqrf_bufferSize(handle,
                                             params,
                                             m,
@@ -2237,19 +2451,22 @@ inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t           API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
                                                     hipsolverHandle_t       handle,
                                                     hipsolverDnParams_t     params,
                                                     int64_t                 m,
                                                     int64_t                 n,
                                                     hipsolverDoubleComplex* A,
                                                     int64_t                 lda,
+                                                    int64_t                 stA,
                                                     hipsolverDoubleComplex* tau,
                                                     size_t*                 lworkOnDevice,
-                                                    size_t*                 lworkOnHost)
+                                                    size_t*                 lworkOnHost,
+                                                    int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnXgeqrf_bufferSize(handle,
                                             params,
                                             m,
@@ -2270,6 +2487,7 @@ inline hipsolverStatus_t hipsolver_geqrf_bufferSize(testAPI_t               API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverDnParams_t params,
                                          int                 m,
@@ -2286,13 +2504,16 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
                                          int*                info,
                                          int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverSgeqrf(handle, m, n, A, lda, tau, workOnDevice, lworkOnDevice, info);
-    case API_FORTRAN:
+    case C_NORMAL_ALT:
+        return hipsolverSgeqrfStridedBatched(
+            handle, m, n, A, lda, stA, tau, stT, workOnDevice, lworkOnDevice, info, bc);
+    case FORTRAN_NORMAL:
         return hipsolverSgeqrfFortran(handle, m, n, A, lda, tau, workOnDevice, lworkOnDevice, info);
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnSgeqrf(handle, m, n, A, lda, tau, workOnDevice, lworkOnDevice, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
@@ -2300,6 +2521,7 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverDnParams_t params,
                                          int                 m,
@@ -2316,13 +2538,16 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
                                          int*                info,
                                          int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverDgeqrf(handle, m, n, A, lda, tau, workOnDevice, lworkOnDevice, info);
-    case API_FORTRAN:
+    case C_NORMAL_ALT:
+        return hipsolverDgeqrfStridedBatched(
+            handle, m, n, A, lda, stA, tau, stT, workOnDevice, lworkOnDevice, info, bc);
+    case FORTRAN_NORMAL:
         return hipsolverDgeqrfFortran(handle, m, n, A, lda, tau, workOnDevice, lworkOnDevice, info);
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnDgeqrf(handle, m, n, A, lda, tau, workOnDevice, lworkOnDevice, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
@@ -2330,6 +2555,7 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverDnParams_t params,
                                          int                 m,
@@ -2346,9 +2572,9 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
                                          int*                info,
                                          int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverCgeqrf(handle,
                                m,
                                n,
@@ -2358,7 +2584,20 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
                                (hipFloatComplex*)workOnDevice,
                                lworkOnDevice,
                                info);
-    case API_FORTRAN:
+    case C_NORMAL_ALT:
+        return hipsolverCgeqrfStridedBatched(handle,
+                                             m,
+                                             n,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             stA,
+                                             (hipFloatComplex*)tau,
+                                             stT,
+                                             (hipFloatComplex*)workOnDevice,
+                                             lworkOnDevice,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
         return hipsolverCgeqrfFortran(handle,
                                       m,
                                       n,
@@ -2368,7 +2607,7 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
                                       (hipFloatComplex*)workOnDevice,
                                       lworkOnDevice,
                                       info);
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnCgeqrf(handle,
                                  m,
                                  n,
@@ -2384,6 +2623,7 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf(testAPI_t               API,
+                                         bool                    STRIDED,
                                          hipsolverHandle_t       handle,
                                          hipsolverDnParams_t     params,
                                          int                     m,
@@ -2400,9 +2640,9 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t               API,
                                          int*                    info,
                                          int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverZgeqrf(handle,
                                m,
                                n,
@@ -2412,7 +2652,20 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t               API,
                                (hipDoubleComplex*)workOnDevice,
                                lworkOnDevice,
                                info);
-    case API_FORTRAN:
+    case C_NORMAL_ALT:
+        return hipsolverZgeqrfStridedBatched(handle,
+                                             m,
+                                             n,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             stA,
+                                             (hipDoubleComplex*)tau,
+                                             stT,
+                                             (hipDoubleComplex*)workOnDevice,
+                                             lworkOnDevice,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
         return hipsolverZgeqrfFortran(handle,
                                       m,
                                       n,
@@ -2422,7 +2675,7 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t               API,
                                       (hipDoubleComplex*)workOnDevice,
                                       lworkOnDevice,
                                       info);
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnZgeqrf(handle,
                                  m,
                                  n,
@@ -2438,6 +2691,7 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t               API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverDnParams_t params,
                                          int64_t             m,
@@ -2454,9 +2708,9 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
                                          int*                info,
                                          int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnXgeqrf(handle,
                                  params,
                                  m,
@@ -2478,6 +2732,7 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverDnParams_t params,
                                          int64_t             m,
@@ -2494,9 +2749,9 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
                                          int*                info,
                                          int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnXgeqrf(handle,
                                  params,
                                  m,
@@ -2518,6 +2773,7 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverDnParams_t params,
                                          int64_t             m,
@@ -2534,9 +2790,9 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
                                          int*                info,
                                          int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnXgeqrf(handle,
                                  params,
                                  m,
@@ -2558,6 +2814,7 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t           API,
 }
 
 inline hipsolverStatus_t hipsolver_geqrf(testAPI_t               API,
+                                         bool                    STRIDED,
                                          hipsolverHandle_t       handle,
                                          hipsolverDnParams_t     params,
                                          int64_t                 m,
@@ -2574,9 +2831,9 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t               API,
                                          int*                    info,
                                          int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnXgeqrf(handle,
                                  params,
                                  m,
@@ -3035,57 +3292,300 @@ inline hipsolverStatus_t hipsolver_gesv(testAPI_t               API,
 }
 /********************************************************/
 
-/******************** GESVD ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
-                                                    hipsolverHandle_t handle,
-                                                    signed char       jobu,
-                                                    signed char       jobv,
-                                                    int               m,
-                                                    int               n,
-                                                    float*            A,
-                                                    int               lda,
-                                                    int*              lwork)
+/******************** GESV (MIXED PRECISION) ********************/
+// HALF selects the variants that factorize A in half precision (DH and ZK) instead of single
+// precision (DS and ZC)
+inline hipsolverStatus_t hipsolver_gesv_mixed_bufferSize(testAPI_t         API,
+                                                         bool              HALF,
+                                                         hipsolverHandle_t handle,
+                                                         int               n,
+                                                         int               nrhs,
+                                                         double*           A,
+                                                         int               lda,
+                                                         int*              ipiv,
+                                                         double*           B,
+                                                         int               ldb,
+                                                         double*           X,
+                                                         int               ldx,
+                                                         size_t*           lwork)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
-    case API_FORTRAN:
-        return hipsolverSgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+        if(HALF)
+            return hipsolverDHgesv_bufferSize(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, lwork);
+        else
+            return hipsolverDSgesv_bufferSize(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, lwork);
     case API_COMPAT:
-        return hipsolverDnSgesvd_bufferSize(handle, m, n, lwork);
+        if(HALF)
+            return hipsolverDnDHgesv_bufferSize(
+                handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, nullptr, lwork);
+        else
+            return hipsolverDnDSgesv_bufferSize(
+                handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, nullptr, lwork);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
-                                                    hipsolverHandle_t handle,
-                                                    signed char       jobu,
-                                                    signed char       jobv,
-                                                    int               m,
-                                                    int               n,
-                                                    double*           A,
-                                                    int               lda,
-                                                    int*              lwork)
+inline hipsolverStatus_t hipsolver_gesv_mixed_bufferSize(testAPI_t               API,
+                                                         bool                    HALF,
+                                                         hipsolverHandle_t       handle,
+                                                         int                     n,
+                                                         int                     nrhs,
+                                                         hipsolverDoubleComplex* A,
+                                                         int                     lda,
+                                                         int*                    ipiv,
+                                                         hipsolverDoubleComplex* B,
+                                                         int                     ldb,
+                                                         hipsolverDoubleComplex* X,
+                                                         int                     ldx,
+                                                         size_t*                 lwork)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
-    case API_FORTRAN:
-        return hipsolverDgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+        if(HALF)
+            return hipsolverZKgesv_bufferSize(handle,
+                                              n,
+                                              nrhs,
+                                              (hipDoubleComplex*)A,
+                                              lda,
+                                              ipiv,
+                                              (hipDoubleComplex*)B,
+                                              ldb,
+                                              (hipDoubleComplex*)X,
+                                              ldx,
+                                              lwork);
+        else
+            return hipsolverZCgesv_bufferSize(handle,
+                                              n,
+                                              nrhs,
+                                              (hipDoubleComplex*)A,
+                                              lda,
+                                              ipiv,
+                                              (hipDoubleComplex*)B,
+                                              ldb,
+                                              (hipDoubleComplex*)X,
+                                              ldx,
+                                              lwork);
     case API_COMPAT:
-        return hipsolverDnDgesvd_bufferSize(handle, m, n, lwork);
-    default:
-        *lwork = 0;
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
+        if(HALF)
+            return hipsolverDnZKgesv_bufferSize(handle,
+                                                n,
+                                                nrhs,
+                                                (hipDoubleComplex*)A,
+                                                lda,
+                                                ipiv,
+                                                (hipDoubleComplex*)B,
+                                                ldb,
+                                                (hipDoubleComplex*)X,
+                                                ldx,
+                                                nullptr,
+                                                lwork);
+        else
+            return hipsolverDnZCgesv_bufferSize(handle,
+                                                n,
+                                                nrhs,
+                                                (hipDoubleComplex*)A,
+                                                lda,
+                                                ipiv,
+                                                (hipDoubleComplex*)B,
+                                                ldb,
+                                                (hipDoubleComplex*)X,
+                                                ldx,
+                                                nullptr,
+                                                lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesv_mixed(testAPI_t         API,
+                                              bool              HALF,
+                                              hipsolverHandle_t handle,
+                                              int               n,
+                                              int               nrhs,
+                                              double*           A,
+                                              int               lda,
+                                              int*              ipiv,
+                                              double*           B,
+                                              int               ldb,
+                                              double*           X,
+                                              int               ldx,
+                                              void*             work,
+                                              size_t            lwork,
+                                              int*              niters,
+                                              int*              info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        if(HALF)
+            return hipsolverDHgesv(
+                handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, work, lwork, niters, info);
+        else
+            return hipsolverDSgesv(
+                handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, work, lwork, niters, info);
+    case API_COMPAT:
+        if(HALF)
+            return hipsolverDnDHgesv(
+                handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, work, lwork, niters, info);
+        else
+            return hipsolverDnDSgesv(
+                handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, work, lwork, niters, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesv_mixed(testAPI_t               API,
+                                              bool                    HALF,
+                                              hipsolverHandle_t       handle,
+                                              int                     n,
+                                              int                     nrhs,
+                                              hipsolverDoubleComplex* A,
+                                              int                     lda,
+                                              int*                    ipiv,
+                                              hipsolverDoubleComplex* B,
+                                              int                     ldb,
+                                              hipsolverDoubleComplex* X,
+                                              int                     ldx,
+                                              void*                   work,
+                                              size_t                  lwork,
+                                              int*                    niters,
+                                              int*                    info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        if(HALF)
+            return hipsolverZKgesv(handle,
+                                   n,
+                                   nrhs,
+                                   (hipDoubleComplex*)A,
+                                   lda,
+                                   ipiv,
+                                   (hipDoubleComplex*)B,
+                                   ldb,
+                                   (hipDoubleComplex*)X,
+                                   ldx,
+                                   work,
+                                   lwork,
+                                   niters,
+                                   info);
+        else
+            return hipsolverZCgesv(handle,
+                                   n,
+                                   nrhs,
+                                   (hipDoubleComplex*)A,
+                                   lda,
+                                   ipiv,
+                                   (hipDoubleComplex*)B,
+                                   ldb,
+                                   (hipDoubleComplex*)X,
+                                   ldx,
+                                   work,
+                                   lwork,
+                                   niters,
+                                   info);
+    case API_COMPAT:
+        if(HALF)
+            return hipsolverDnZKgesv(handle,
+                                     n,
+                                     nrhs,
+                                     (hipDoubleComplex*)A,
+                                     lda,
+                                     ipiv,
+                                     (hipDoubleComplex*)B,
+                                     ldb,
+                                     (hipDoubleComplex*)X,
+                                     ldx,
+                                     work,
+                                     lwork,
+                                     niters,
+                                     info);
+        else
+            return hipsolverDnZCgesv(handle,
+                                     n,
+                                     nrhs,
+                                     (hipDoubleComplex*)A,
+                                     lda,
+                                     ipiv,
+                                     (hipDoubleComplex*)B,
+                                     ldb,
+                                     (hipDoubleComplex*)X,
+                                     ldx,
+                                     work,
+                                     lwork,
+                                     niters,
+                                     info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** GESVD ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    float*            A,
+                                                    int               lda,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverSgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+    case COMPAT_NORMAL:
+        return hipsolverDnSgesvd_bufferSize(handle, m, n, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    double*           A,
+                                                    int               lda,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverDgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+    case COMPAT_NORMAL:
+        return hipsolverDnDgesvd_bufferSize(handle, m, n, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
+                                                    bool              STRIDED,
                                                     hipsolverHandle_t handle,
                                                     signed char       jobu,
                                                     signed char       jobv,
@@ -3093,15 +3593,18 @@ inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
                                                     int               n,
                                                     hipsolverComplex* A,
                                                     int               lda,
-                                                    int*              lwork)
+                                                    int*              lwork,
+                                                    int               bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
-    case API_FORTRAN:
+    case C_NORMAL_ALT:
+        return hipsolverCgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
+    case FORTRAN_NORMAL:
         return hipsolverCgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnCgesvd_bufferSize(handle, m, n, lwork);
     default:
         *lwork = 0;
@@ -3110,6 +3613,7 @@ inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
 }
 
 inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
                                                     hipsolverHandle_t       handle,
                                                     signed char             jobu,
                                                     signed char             jobv,
@@ -3117,15 +3621,18 @@ inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t               API,
                                                     int                     n,
                                                     hipsolverDoubleComplex* A,
                                                     int                     lda,
-                                                    int*                    lwork)
+                                                    int*                    lwork,
+                                                    int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
-    case API_FORTRAN:
+    case C_NORMAL_ALT:
+        return hipsolverZgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
+    case FORTRAN_NORMAL:
         return hipsolverZgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
-    case API_COMPAT:
+    case COMPAT_NORMAL:
         return hipsolverDnZgesvd_bufferSize(handle, m, n, lwork);
     default:
         *lwork = 0;
@@ -3135,6 +3642,7 @@ inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t               API,
 
 inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
                                          bool              NRWK,
+                                         bool              STRIDED,
                                          hipsolverHandle_t handle,
                                          signed char       jobu,
                                          signed char       jobv,
@@ -3158,6 +3666,36 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
                                          int*              info,
                                          int               bc)
 {
+    if(STRIDED)
+    {
+        switch(API)
+        {
+        case API_NORMAL:
+            return hipsolverSgesvdStridedBatched(handle,
+                                                 jobu,
+                                                 jobv,
+                                                 m,
+                                                 n,
+                                                 A,
+                                                 lda,
+                                                 stA,
+                                                 S,
+                                                 stS,
+                                                 U,
+                                                 ldu,
+                                                 stU,
+                                                 V,
+                                                 ldv,
+                                                 stV,
+                                                 work,
+                                                 lwork,
+                                                 info,
+                                                 bc);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     switch(api2marshal(API, NRWK))
     {
     case C_NORMAL:
@@ -3179,6 +3717,7 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
 
 inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
                                          bool              NRWK,
+                                         bool              STRIDED,
                                          hipsolverHandle_t handle,
                                          signed char       jobu,
                                          signed char       jobv,
@@ -3202,6 +3741,36 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
                                          int*              info,
                                          int               bc)
 {
+    if(STRIDED)
+    {
+        switch(API)
+        {
+        case API_NORMAL:
+            return hipsolverDgesvdStridedBatched(handle,
+                                                 jobu,
+                                                 jobv,
+                                                 m,
+                                                 n,
+                                                 A,
+                                                 lda,
+                                                 stA,
+                                                 S,
+                                                 stS,
+                                                 U,
+                                                 ldu,
+                                                 stU,
+                                                 V,
+                                                 ldv,
+                                                 stV,
+                                                 work,
+                                                 lwork,
+                                                 info,
+                                                 bc);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     switch(api2marshal(API, NRWK))
     {
     case C_NORMAL:
@@ -3223,6 +3792,7 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
 
 inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
                                          bool              NRWK,
+                                         bool              STRIDED,
                                          hipsolverHandle_t handle,
                                          signed char       jobu,
                                          signed char       jobv,
@@ -3246,6 +3816,36 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
                                          int*              info,
                                          int               bc)
 {
+    if(STRIDED)
+    {
+        switch(API)
+        {
+        case API_NORMAL:
+            return hipsolverCgesvdStridedBatched(handle,
+                                                 jobu,
+                                                 jobv,
+                                                 m,
+                                                 n,
+                                                 (hipFloatComplex*)A,
+                                                 lda,
+                                                 stA,
+                                                 S,
+                                                 stS,
+                                                 (hipFloatComplex*)U,
+                                                 ldu,
+                                                 stU,
+                                                 (hipFloatComplex*)V,
+                                                 ldv,
+                                                 stV,
+                                                 (hipFloatComplex*)work,
+                                                 lwork,
+                                                 info,
+                                                 bc);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     switch(api2marshal(API, NRWK))
     {
     case C_NORMAL:
@@ -3323,6 +3923,7 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
 
 inline hipsolverStatus_t hipsolver_gesvd(testAPI_t               API,
                                          bool                    NRWK,
+                                         bool                    STRIDED,
                                          hipsolverHandle_t       handle,
                                          signed char             jobu,
                                          signed char             jobv,
@@ -3346,6 +3947,36 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t               API,
                                          int*                    info,
                                          int                     bc)
 {
+    if(STRIDED)
+    {
+        switch(API)
+        {
+        case API_NORMAL:
+            return hipsolverZgesvdStridedBatched(handle,
+                                                 jobu,
+                                                 jobv,
+                                                 m,
+                                                 n,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 stA,
+                                                 S,
+                                                 stS,
+                                                 (hipDoubleComplex*)U,
+                                                 ldu,
+                                                 stU,
+                                                 (hipDoubleComplex*)V,
+                                                 ldv,
+                                                 stV,
+                                                 (hipDoubleComplex*)work,
+                                                 lwork,
+                                                 info,
+                                                 bc);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     switch(api2marshal(API, NRWK))
     {
     case C_NORMAL:
@@ -4474,1601 +5105,2636 @@ inline hipsolverStatus_t hipsolver_gesvda(testAPI_t               API,
 }
 /********************************************************/
 
-/******************** GETRF ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverDnParams_t params,
-                                                    int                 m,
-                                                    int                 n,
-                                                    float*              A,
-                                                    int                 lda,
-                                                    int*                lworkOnDevice,
-                                                    int*                lworkOnHost)
-{
-    *lworkOnHost = 0;
-    switch(API)
+/******************** GESVDP ********************/
+inline hipsolverStatus_t hipsolver_gesvdp_bufferSize(testAPI_t           API,
+                                                     hipsolverHandle_t   handle,
+                                                     hipsolverDnParams_t params,
+                                                     hipsolverEigMode_t  jobz,
+                                                     int                 econ,
+                                                     int                 m,
+                                                     int                 n,
+                                                     float*              A,
+                                                     int                 lda,
+                                                     float*              S,
+                                                     float*              U,
+                                                     int                 ldu,
+                                                     float*              V,
+                                                     int                 ldv,
+                                                     size_t*             lworkOnDevice,
+                                                     size_t*             lworkOnHost)
+{
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
-    case API_FORTRAN:
-        return hipsolverSgetrf_bufferSizeFortran(handle, m, n, A, lda, lworkOnDevice);
-    case API_COMPAT:
-        return hipsolverDnSgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdp_bufferSize(handle,
+                                             params,
+                                             jobz,
+                                             econ,
+                                             m,
+                                             n,
+                                             HIP_R_32F,
+                                             A,
+                                             lda,
+                                             HIP_R_32F,
+                                             S,
+                                             HIP_R_32F,
+                                             U,
+                                             ldu,
+                                             HIP_R_32F,
+                                             V,
+                                             ldv,
+                                             HIP_R_32F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
     default:
         *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverDnParams_t params,
-                                                    int                 m,
-                                                    int                 n,
-                                                    double*             A,
-                                                    int                 lda,
-                                                    int*                lworkOnDevice,
-                                                    int*                lworkOnHost)
+inline hipsolverStatus_t hipsolver_gesvdp_bufferSize(testAPI_t           API,
+                                                     hipsolverHandle_t   handle,
+                                                     hipsolverDnParams_t params,
+                                                     hipsolverEigMode_t  jobz,
+                                                     int                 econ,
+                                                     int                 m,
+                                                     int                 n,
+                                                     double*             A,
+                                                     int                 lda,
+                                                     double*             S,
+                                                     double*             U,
+                                                     int                 ldu,
+                                                     double*             V,
+                                                     int                 ldv,
+                                                     size_t*             lworkOnDevice,
+                                                     size_t*             lworkOnHost)
 {
-    *lworkOnHost = 0;
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
-    case API_FORTRAN:
-        return hipsolverDgetrf_bufferSizeFortran(handle, m, n, A, lda, lworkOnDevice);
-    case API_COMPAT:
-        return hipsolverDnDgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdp_bufferSize(handle,
+                                             params,
+                                             jobz,
+                                             econ,
+                                             m,
+                                             n,
+                                             HIP_R_64F,
+                                             A,
+                                             lda,
+                                             HIP_R_64F,
+                                             S,
+                                             HIP_R_64F,
+                                             U,
+                                             ldu,
+                                             HIP_R_64F,
+                                             V,
+                                             ldv,
+                                             HIP_R_64F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
     default:
         *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverDnParams_t params,
-                                                    int                 m,
-                                                    int                 n,
-                                                    hipsolverComplex*   A,
-                                                    int                 lda,
-                                                    int*                lworkOnDevice,
-                                                    int*                lworkOnHost)
+inline hipsolverStatus_t hipsolver_gesvdp_bufferSize(testAPI_t           API,
+                                                     hipsolverHandle_t   handle,
+                                                     hipsolverDnParams_t params,
+                                                     hipsolverEigMode_t  jobz,
+                                                     int                 econ,
+                                                     int                 m,
+                                                     int                 n,
+                                                     hipsolverComplex*   A,
+                                                     int                 lda,
+                                                     float*              S,
+                                                     hipsolverComplex*   U,
+                                                     int                 ldu,
+                                                     hipsolverComplex*   V,
+                                                     int                 ldv,
+                                                     size_t*             lworkOnDevice,
+                                                     size_t*             lworkOnHost)
 {
-    *lworkOnHost = 0;
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverCgetrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
-    case API_FORTRAN:
-        return hipsolverCgetrf_bufferSizeFortran(
-            handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
-    case API_COMPAT:
-        return hipsolverDnCgetrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdp_bufferSize(handle,
+                                             params,
+                                             jobz,
+                                             econ,
+                                             m,
+                                             n,
+                                             HIP_C_32F,
+                                             A,
+                                             lda,
+                                             HIP_R_32F,
+                                             S,
+                                             HIP_C_32F,
+                                             U,
+                                             ldu,
+                                             HIP_C_32F,
+                                             V,
+                                             ldv,
+                                             HIP_C_32F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
     default:
         *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t               API,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverDnParams_t     params,
-                                                    int                     m,
-                                                    int                     n,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    int*                    lworkOnDevice,
-                                                    int*                    lworkOnHost)
+inline hipsolverStatus_t hipsolver_gesvdp_bufferSize(testAPI_t               API,
+                                                     hipsolverHandle_t       handle,
+                                                     hipsolverDnParams_t     params,
+                                                     hipsolverEigMode_t      jobz,
+                                                     int                     econ,
+                                                     int                     m,
+                                                     int                     n,
+                                                     hipsolverDoubleComplex* A,
+                                                     int                     lda,
+                                                     double*                 S,
+                                                     hipsolverDoubleComplex* U,
+                                                     int                     ldu,
+                                                     hipsolverDoubleComplex* V,
+                                                     int                     ldv,
+                                                     size_t*                 lworkOnDevice,
+                                                     size_t*                 lworkOnHost)
 {
-    *lworkOnHost = 0;
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverZgetrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
-    case API_FORTRAN:
-        return hipsolverZgetrf_bufferSizeFortran(
-            handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
-    case API_COMPAT:
-        return hipsolverDnZgetrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdp_bufferSize(handle,
+                                             params,
+                                             jobz,
+                                             econ,
+                                             m,
+                                             n,
+                                             HIP_C_64F,
+                                             A,
+                                             lda,
+                                             HIP_R_64F,
+                                             S,
+                                             HIP_C_64F,
+                                             U,
+                                             ldu,
+                                             HIP_C_64F,
+                                             V,
+                                             ldv,
+                                             HIP_C_64F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
     default:
         *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverDnParams_t params,
-                                                    int64_t             m,
-                                                    int64_t             n,
-                                                    float*              A,
-                                                    int64_t             lda,
-                                                    size_t*             lworkOnDevice,
-                                                    size_t*             lworkOnHost)
+inline hipsolverStatus_t hipsolver_gesvdp(testAPI_t           API,
+                                          hipsolverHandle_t   handle,
+                                          hipsolverDnParams_t params,
+                                          hipsolverEigMode_t  jobz,
+                                          int                 econ,
+                                          int                 m,
+                                          int                 n,
+                                          float*              A,
+                                          int                 lda,
+                                          float*              S,
+                                          float*              U,
+                                          int                 ldu,
+                                          float*              V,
+                                          int                 ldv,
+                                          float*              workOnDevice,
+                                          size_t              lworkOnDevice,
+                                          float*              workOnHost,
+                                          size_t              lworkOnHost,
+                                          int*                info,
+                                          double*             hErrSigma)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrf_bufferSize(
-            handle, params, m, n, HIP_R_32F, A, lda, HIP_R_32F, lworkOnDevice, lworkOnHost);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdp(handle,
+                                  params,
+                                  jobz,
+                                  econ,
+                                  m,
+                                  n,
+                                  HIP_R_32F,
+                                  A,
+                                  lda,
+                                  HIP_R_32F,
+                                  S,
+                                  HIP_R_32F,
+                                  U,
+                                  ldu,
+                                  HIP_R_32F,
+                                  V,
+                                  ldv,
+                                  HIP_R_32F,
+                                  workOnDevice,
+                                  lworkOnDevice,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info,
+                                  hErrSigma);
     default:
-        *lworkOnDevice = 0;
-        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverDnParams_t params,
-                                                    int64_t             m,
-                                                    int64_t             n,
-                                                    double*             A,
-                                                    int64_t             lda,
-                                                    size_t*             lworkOnDevice,
-                                                    size_t*             lworkOnHost)
+inline hipsolverStatus_t hipsolver_gesvdp(testAPI_t           API,
+                                          hipsolverHandle_t   handle,
+                                          hipsolverDnParams_t params,
+                                          hipsolverEigMode_t  jobz,
+                                          int                 econ,
+                                          int                 m,
+                                          int                 n,
+                                          double*             A,
+                                          int                 lda,
+                                          double*             S,
+                                          double*             U,
+                                          int                 ldu,
+                                          double*             V,
+                                          int                 ldv,
+                                          double*             workOnDevice,
+                                          size_t              lworkOnDevice,
+                                          double*             workOnHost,
+                                          size_t              lworkOnHost,
+                                          int*                info,
+                                          double*             hErrSigma)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrf_bufferSize(
-            handle, params, m, n, HIP_R_64F, A, lda, HIP_R_64F, lworkOnDevice, lworkOnHost);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdp(handle,
+                                  params,
+                                  jobz,
+                                  econ,
+                                  m,
+                                  n,
+                                  HIP_R_64F,
+                                  A,
+                                  lda,
+                                  HIP_R_64F,
+                                  S,
+                                  HIP_R_64F,
+                                  U,
+                                  ldu,
+                                  HIP_R_64F,
+                                  V,
+                                  ldv,
+                                  HIP_R_64F,
+                                  workOnDevice,
+                                  lworkOnDevice,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info,
+                                  hErrSigma);
     default:
-        *lworkOnDevice = 0;
-        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverDnParams_t params,
-                                                    int64_t             m,
-                                                    int64_t             n,
-                                                    hipsolverComplex*   A,
-                                                    int64_t             lda,
-                                                    size_t*             lworkOnDevice,
-                                                    size_t*             lworkOnHost)
+inline hipsolverStatus_t hipsolver_gesvdp(testAPI_t           API,
+                                          hipsolverHandle_t   handle,
+                                          hipsolverDnParams_t params,
+                                          hipsolverEigMode_t  jobz,
+                                          int                 econ,
+                                          int                 m,
+                                          int                 n,
+                                          hipsolverComplex*   A,
+                                          int                 lda,
+                                          float*              S,
+                                          hipsolverComplex*   U,
+                                          int                 ldu,
+                                          hipsolverComplex*   V,
+                                          int                 ldv,
+                                          hipsolverComplex*   workOnDevice,
+                                          size_t              lworkOnDevice,
+                                          hipsolverComplex*   workOnHost,
+                                          size_t              lworkOnHost,
+                                          int*                info,
+                                          double*             hErrSigma)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrf_bufferSize(
-            handle, params, m, n, HIP_C_32F, A, lda, HIP_C_32F, lworkOnDevice, lworkOnHost);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdp(handle,
+                                  params,
+                                  jobz,
+                                  econ,
+                                  m,
+                                  n,
+                                  HIP_C_32F,
+                                  A,
+                                  lda,
+                                  HIP_R_32F,
+                                  S,
+                                  HIP_C_32F,
+                                  U,
+                                  ldu,
+                                  HIP_C_32F,
+                                  V,
+                                  ldv,
+                                  HIP_C_32F,
+                                  workOnDevice,
+                                  lworkOnDevice,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info,
+                                  hErrSigma);
     default:
-        *lworkOnDevice = 0;
-        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t               API,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverDnParams_t     params,
-                                                    int64_t                 m,
-                                                    int64_t                 n,
-                                                    hipsolverDoubleComplex* A,
-                                                    int64_t                 lda,
-                                                    size_t*                 lworkOnDevice,
-                                                    size_t*                 lworkOnHost)
+inline hipsolverStatus_t hipsolver_gesvdp(testAPI_t               API,
+                                          hipsolverHandle_t       handle,
+                                          hipsolverDnParams_t     params,
+                                          hipsolverEigMode_t      jobz,
+                                          int                     econ,
+                                          int                     m,
+                                          int                     n,
+                                          hipsolverDoubleComplex* A,
+                                          int                     lda,
+                                          double*                 S,
+                                          hipsolverDoubleComplex* U,
+                                          int                     ldu,
+                                          hipsolverDoubleComplex* V,
+                                          int                     ldv,
+                                          hipsolverDoubleComplex* workOnDevice,
+                                          size_t                  lworkOnDevice,
+                                          hipsolverDoubleComplex* workOnHost,
+                                          size_t                  lworkOnHost,
+                                          int*                    info,
+                                          double*                 hErrSigma)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrf_bufferSize(
-            handle, params, m, n, HIP_C_64F, A, lda, HIP_C_64F, lworkOnDevice, lworkOnHost);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdp(handle,
+                                  params,
+                                  jobz,
+                                  econ,
+                                  m,
+                                  n,
+                                  HIP_C_64F,
+                                  A,
+                                  lda,
+                                  HIP_R_64F,
+                                  S,
+                                  HIP_C_64F,
+                                  U,
+                                  ldu,
+                                  HIP_C_64F,
+                                  V,
+                                  ldv,
+                                  HIP_C_64F,
+                                  workOnDevice,
+                                  lworkOnDevice,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info,
+                                  hErrSigma);
     default:
-        *lworkOnDevice = 0;
-        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
+/********************************************************/
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
-                                         bool                NPVT,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverDnParams_t params,
-                                         int                 m,
-                                         int                 n,
-                                         float*              A,
-                                         int                 lda,
-                                         int                 stA,
-                                         int*                ipiv,
-                                         int                 stP,
-                                         float*              workOnDevice,
-                                         int                 lworkOnDevice,
-                                         float*              workOnHost,
-                                         int                 lworkOnHost,
-                                         int*                info,
-                                         int                 bc)
+/******************** GESVDR ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_gesvdr_bufferSize(testAPI_t           API,
+                                                     bool                STRIDED,
+                                                     hipsolverHandle_t   handle,
+                                                     hipsolverDnParams_t params,
+                                                     char                jobu,
+                                                     char                jobv,
+                                                     int                 m,
+                                                     int                 n,
+                                                     int                 k,
+                                                     int                 p,
+                                                     int                 niters,
+                                                     float*              A,
+                                                     int                 lda,
+                                                     int                 stA,
+                                                     float*              S,
+                                                     int                 stS,
+                                                     float*              U,
+                                                     int                 ldu,
+                                                     int                 stU,
+                                                     float*              V,
+                                                     int                 ldv,
+                                                     int                 stV,
+                                                     size_t*             lworkOnDevice,
+                                                     size_t*             lworkOnHost,
+                                                     int                 bc)
 {
-    switch(api2marshal(API, NPVT))
+    switch(api2marshal(API, STRIDED))
     {
-    case C_NORMAL:
-        return hipsolverSgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
-    case C_NORMAL_ALT:
-        return hipsolverSgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, nullptr, info);
-    case FORTRAN_NORMAL:
-        return hipsolverSgetrfFortran(
-            handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
     case COMPAT_NORMAL:
-        return hipsolverDnSgetrf(handle, m, n, A, lda, workOnDevice, ipiv, info);
+        return hipsolverDnXgesvdr_bufferSize(handle,
+                                             params,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             k,
+                                             p,
+                                             niters,
+                                             HIP_R_32F,
+                                             A,
+                                             lda,
+                                             HIP_R_32F,
+                                             S,
+                                             HIP_R_32F,
+                                             U,
+                                             ldu,
+                                             HIP_R_32F,
+                                             V,
+                                             ldv,
+                                             HIP_R_32F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnXgesvdrStridedBatched_bufferSize(handle,
+                                                           params,
+                                                           jobu,
+                                                           jobv,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           p,
+                                                           niters,
+                                                           HIP_R_32F,
+                                                           A,
+                                                           lda,
+                                                           stA,
+                                                           HIP_R_32F,
+                                                           S,
+                                                           stS,
+                                                           HIP_R_32F,
+                                                           U,
+                                                           ldu,
+                                                           stU,
+                                                           HIP_R_32F,
+                                                           V,
+                                                           ldv,
+                                                           stV,
+                                                           HIP_R_32F,
+                                                           lworkOnDevice,
+                                                           lworkOnHost,
+                                                           bc);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
-                                         bool                NPVT,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverDnParams_t params,
-                                         int                 m,
-                                         int                 n,
-                                         double*             A,
-                                         int                 lda,
-                                         int                 stA,
-                                         int*                ipiv,
-                                         int                 stP,
-                                         double*             workOnDevice,
-                                         int                 lworkOnDevice,
-                                         double*             workOnHost,
-                                         int                 lworkOnHost,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_gesvdr_bufferSize(testAPI_t           API,
+                                                     bool                STRIDED,
+                                                     hipsolverHandle_t   handle,
+                                                     hipsolverDnParams_t params,
+                                                     char                jobu,
+                                                     char                jobv,
+                                                     int                 m,
+                                                     int                 n,
+                                                     int                 k,
+                                                     int                 p,
+                                                     int                 niters,
+                                                     double*             A,
+                                                     int                 lda,
+                                                     int                 stA,
+                                                     double*             S,
+                                                     int                 stS,
+                                                     double*             U,
+                                                     int                 ldu,
+                                                     int                 stU,
+                                                     double*             V,
+                                                     int                 ldv,
+                                                     int                 stV,
+                                                     size_t*             lworkOnDevice,
+                                                     size_t*             lworkOnHost,
+                                                     int                 bc)
 {
-    switch(api2marshal(API, NPVT))
+    switch(api2marshal(API, STRIDED))
     {
-    case C_NORMAL:
-        return hipsolverDgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
-    case C_NORMAL_ALT:
-        return hipsolverDgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, nullptr, info);
-    case FORTRAN_NORMAL:
-        return hipsolverDgetrfFortran(
-            handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
     case COMPAT_NORMAL:
-        return hipsolverDnDgetrf(handle, m, n, A, lda, workOnDevice, ipiv, info);
+        return hipsolverDnXgesvdr_bufferSize(handle,
+                                             params,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             k,
+                                             p,
+                                             niters,
+                                             HIP_R_64F,
+                                             A,
+                                             lda,
+                                             HIP_R_64F,
+                                             S,
+                                             HIP_R_64F,
+                                             U,
+                                             ldu,
+                                             HIP_R_64F,
+                                             V,
+                                             ldv,
+                                             HIP_R_64F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnXgesvdrStridedBatched_bufferSize(handle,
+                                                           params,
+                                                           jobu,
+                                                           jobv,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           p,
+                                                           niters,
+                                                           HIP_R_64F,
+                                                           A,
+                                                           lda,
+                                                           stA,
+                                                           HIP_R_64F,
+                                                           S,
+                                                           stS,
+                                                           HIP_R_64F,
+                                                           U,
+                                                           ldu,
+                                                           stU,
+                                                           HIP_R_64F,
+                                                           V,
+                                                           ldv,
+                                                           stV,
+                                                           HIP_R_64F,
+                                                           lworkOnDevice,
+                                                           lworkOnHost,
+                                                           bc);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
-                                         bool                NPVT,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverDnParams_t params,
-                                         int                 m,
-                                         int                 n,
-                                         hipsolverComplex*   A,
-                                         int                 lda,
-                                         int                 stA,
-                                         int*                ipiv,
-                                         int                 stP,
-                                         hipsolverComplex*   workOnDevice,
-                                         int                 lworkOnDevice,
-                                         hipsolverComplex*   workOnHost,
-                                         int                 lworkOnHost,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_gesvdr_bufferSize(testAPI_t           API,
+                                                     bool                STRIDED,
+                                                     hipsolverHandle_t   handle,
+                                                     hipsolverDnParams_t params,
+                                                     char                jobu,
+                                                     char                jobv,
+                                                     int                 m,
+                                                     int                 n,
+                                                     int                 k,
+                                                     int                 p,
+                                                     int                 niters,
+                                                     hipsolverComplex*   A,
+                                                     int                 lda,
+                                                     int                 stA,
+                                                     float*              S,
+                                                     int                 stS,
+                                                     hipsolverComplex*   U,
+                                                     int                 ldu,
+                                                     int                 stU,
+                                                     hipsolverComplex*   V,
+                                                     int                 ldv,
+                                                     int                 stV,
+                                                     size_t*             lworkOnDevice,
+                                                     size_t*             lworkOnHost,
+                                                     int                 bc)
 {
-    switch(api2marshal(API, NPVT))
+    switch(api2marshal(API, STRIDED))
     {
-    case C_NORMAL:
-        return hipsolverCgetrf(handle,
-                               m,
-                               n,
-                               (hipFloatComplex*)A,
-                               lda,
-                               (hipFloatComplex*)workOnDevice,
-                               lworkOnDevice,
-                               ipiv,
-                               info);
-    case C_NORMAL_ALT:
-        return hipsolverCgetrf(handle,
-                               m,
-                               n,
-                               (hipFloatComplex*)A,
-                               lda,
-                               (hipFloatComplex*)workOnDevice,
-                               lworkOnDevice,
-                               nullptr,
-                               info);
-    case FORTRAN_NORMAL:
-        return hipsolverCgetrfFortran(handle,
-                                      m,
-                                      n,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      (hipFloatComplex*)workOnDevice,
-                                      lworkOnDevice,
-                                      ipiv,
-                                      info);
     case COMPAT_NORMAL:
-        return hipsolverDnCgetrf(
-            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)workOnDevice, ipiv, info);
+        return hipsolverDnXgesvdr_bufferSize(handle,
+                                             params,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             k,
+                                             p,
+                                             niters,
+                                             HIP_C_32F,
+                                             A,
+                                             lda,
+                                             HIP_R_32F,
+                                             S,
+                                             HIP_C_32F,
+                                             U,
+                                             ldu,
+                                             HIP_C_32F,
+                                             V,
+                                             ldv,
+                                             HIP_C_32F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnXgesvdrStridedBatched_bufferSize(handle,
+                                                           params,
+                                                           jobu,
+                                                           jobv,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           p,
+                                                           niters,
+                                                           HIP_C_32F,
+                                                           A,
+                                                           lda,
+                                                           stA,
+                                                           HIP_R_32F,
+                                                           S,
+                                                           stS,
+                                                           HIP_C_32F,
+                                                           U,
+                                                           ldu,
+                                                           stU,
+                                                           HIP_C_32F,
+                                                           V,
+                                                           ldv,
+                                                           stV,
+                                                           HIP_C_32F,
+                                                           lworkOnDevice,
+                                                           lworkOnHost,
+                                                           bc);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
-                                         bool                    NPVT,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverDnParams_t     params,
-                                         int                     m,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         int*                    ipiv,
-                                         int                     stP,
-                                         hipsolverDoubleComplex* workOnDevice,
-                                         int                     lworkOnDevice,
-                                         hipsolverDoubleComplex* workOnHost,
-                                         int                     lworkOnHost,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_gesvdr_bufferSize(testAPI_t               API,
+                                                     bool                    STRIDED,
+                                                     hipsolverHandle_t       handle,
+                                                     hipsolverDnParams_t     params,
+                                                     char                    jobu,
+                                                     char                    jobv,
+                                                     int                     m,
+                                                     int                     n,
+                                                     int                     k,
+                                                     int                     p,
+                                                     int                     niters,
+                                                     hipsolverDoubleComplex* A,
+                                                     int                     lda,
+                                                     int                     stA,
+                                                     double*                 S,
+                                                     int                     stS,
+                                                     hipsolverDoubleComplex* U,
+                                                     int                     ldu,
+                                                     int                     stU,
+                                                     hipsolverDoubleComplex* V,
+                                                     int                     ldv,
+                                                     int                     stV,
+                                                     size_t*                 lworkOnDevice,
+                                                     size_t*                 lworkOnHost,
+                                                     int                     bc)
 {
-    switch(api2marshal(API, NPVT))
+    switch(api2marshal(API, STRIDED))
     {
-    case C_NORMAL:
-        return hipsolverZgetrf(handle,
-                               m,
-                               n,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               (hipDoubleComplex*)workOnDevice,
-                               lworkOnDevice,
-                               ipiv,
-                               info);
-    case C_NORMAL_ALT:
-        return hipsolverZgetrf(handle,
-                               m,
-                               n,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               (hipDoubleComplex*)workOnDevice,
-                               lworkOnDevice,
-                               nullptr,
-                               info);
-    case FORTRAN_NORMAL:
-        return hipsolverZgetrfFortran(handle,
-                                      m,
-                                      n,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      (hipDoubleComplex*)workOnDevice,
-                                      lworkOnDevice,
-                                      ipiv,
-                                      info);
     case COMPAT_NORMAL:
-        return hipsolverDnZgetrf(
-            handle, m, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)workOnDevice, ipiv, info);
+        return hipsolverDnXgesvdr_bufferSize(handle,
+                                             params,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             k,
+                                             p,
+                                             niters,
+                                             HIP_C_64F,
+                                             A,
+                                             lda,
+                                             HIP_R_64F,
+                                             S,
+                                             HIP_C_64F,
+                                             U,
+                                             ldu,
+                                             HIP_C_64F,
+                                             V,
+                                             ldv,
+                                             HIP_C_64F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnXgesvdrStridedBatched_bufferSize(handle,
+                                                           params,
+                                                           jobu,
+                                                           jobv,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           p,
+                                                           niters,
+                                                           HIP_C_64F,
+                                                           A,
+                                                           lda,
+                                                           stA,
+                                                           HIP_R_64F,
+                                                           S,
+                                                           stS,
+                                                           HIP_C_64F,
+                                                           U,
+                                                           ldu,
+                                                           stU,
+                                                           HIP_C_64F,
+                                                           V,
+                                                           ldv,
+                                                           stV,
+                                                           HIP_C_64F,
+                                                           lworkOnDevice,
+                                                           lworkOnHost,
+                                                           bc);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
-                                         bool                NPVT,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverDnParams_t params,
-                                         int64_t             m,
-                                         int64_t             n,
-                                         float*              A,
-                                         int64_t             lda,
-                                         int64_t             stA,
-                                         int64_t*            ipiv,
-                                         int64_t             stP,
-                                         float*              workOnDevice,
-                                         size_t              lworkOnDevice,
-                                         float*              workOnHost,
-                                         size_t              lworkOnHost,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_gesvdr(testAPI_t           API,
+                                          bool                STRIDED,
+                                          hipsolverHandle_t   handle,
+                                          hipsolverDnParams_t params,
+                                          char                jobu,
+                                          char                jobv,
+                                          int                 m,
+                                          int                 n,
+                                          int                 k,
+                                          int                 p,
+                                          int                 niters,
+                                          float*              A,
+                                          int                 lda,
+                                          int                 stA,
+                                          float*              S,
+                                          int                 stS,
+                                          float*              U,
+                                          int                 ldu,
+                                          int                 stU,
+                                          float*              V,
+                                          int                 ldv,
+                                          int                 stV,
+                                          float*              workOnDevice,
+                                          size_t              lworkOnDevice,
+                                          float*              workOnHost,
+                                          size_t              lworkOnHost,
+                                          int*                info,
+                                          double*             hRnrmF,
+                                          int                 bc)
 {
-    switch(api2marshal(API, NPVT))
+    switch(api2marshal(API, STRIDED))
     {
     case COMPAT_NORMAL:
-        return hipsolverDnXgetrf(handle,
-                                 params,
-                                 m,
-                                 n,
-                                 HIP_R_32F,
-                                 A,
-                                 lda,
-                                 ipiv,
-                                 HIP_R_32F,
-                                 workOnDevice,
-                                 lworkOnDevice,
-                                 workOnHost,
-                                 lworkOnHost,
-                                 info);
+        return hipsolverDnXgesvdr(handle,
+                                  params,
+                                  jobu,
+                                  jobv,
+                                  m,
+                                  n,
+                                  k,
+                                  p,
+                                  niters,
+                                  HIP_R_32F,
+                                  A,
+                                  lda,
+                                  HIP_R_32F,
+                                  S,
+                                  HIP_R_32F,
+                                  U,
+                                  ldu,
+                                  HIP_R_32F,
+                                  V,
+                                  ldv,
+                                  HIP_R_32F,
+                                  workOnDevice,
+                                  lworkOnDevice,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info);
     case COMPAT_NORMAL_ALT:
-        return hipsolverDnXgetrf(handle,
-                                 params,
-                                 m,
-                                 n,
-                                 HIP_R_32F,
-                                 A,
-                                 lda,
-                                 nullptr,
-                                 HIP_R_32F,
-                                 workOnDevice,
-                                 lworkOnDevice,
-                                 workOnHost,
-                                 lworkOnHost,
-                                 info);
+        return hipsolverDnXgesvdrStridedBatched(handle,
+                                                params,
+                                                jobu,
+                                                jobv,
+                                                m,
+                                                n,
+                                                k,
+                                                p,
+                                                niters,
+                                                HIP_R_32F,
+                                                A,
+                                                lda,
+                                                stA,
+                                                HIP_R_32F,
+                                                S,
+                                                stS,
+                                                HIP_R_32F,
+                                                U,
+                                                ldu,
+                                                stU,
+                                                HIP_R_32F,
+                                                V,
+                                                ldv,
+                                                stV,
+                                                HIP_R_32F,
+                                                workOnDevice,
+                                                lworkOnDevice,
+                                                workOnHost,
+                                                lworkOnHost,
+                                                info,
+                                                hRnrmF,
+                                                bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
-                                         bool                NPVT,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverDnParams_t params,
-                                         int64_t             m,
-                                         int64_t             n,
-                                         double*             A,
-                                         int64_t             lda,
-                                         int64_t             stA,
-                                         int64_t*            ipiv,
-                                         int64_t             stP,
-                                         double*             workOnDevice,
-                                         size_t              lworkOnDevice,
-                                         double*             workOnHost,
-                                         size_t              lworkOnHost,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_gesvdr(testAPI_t           API,
+                                          bool                STRIDED,
+                                          hipsolverHandle_t   handle,
+                                          hipsolverDnParams_t params,
+                                          char                jobu,
+                                          char                jobv,
+                                          int                 m,
+                                          int                 n,
+                                          int                 k,
+                                          int                 p,
+                                          int                 niters,
+                                          double*             A,
+                                          int                 lda,
+                                          int                 stA,
+                                          double*             S,
+                                          int                 stS,
+                                          double*             U,
+                                          int                 ldu,
+                                          int                 stU,
+                                          double*             V,
+                                          int                 ldv,
+                                          int                 stV,
+                                          double*             workOnDevice,
+                                          size_t              lworkOnDevice,
+                                          double*             workOnHost,
+                                          size_t              lworkOnHost,
+                                          int*                info,
+                                          double*             hRnrmF,
+                                          int                 bc)
 {
-    switch(api2marshal(API, NPVT))
+    switch(api2marshal(API, STRIDED))
     {
     case COMPAT_NORMAL:
-        return hipsolverDnXgetrf(handle,
-                                 params,
-                                 m,
-                                 n,
-                                 HIP_R_64F,
-                                 A,
-                                 lda,
-                                 ipiv,
-                                 HIP_R_64F,
-                                 workOnDevice,
-                                 lworkOnDevice,
-                                 workOnHost,
-                                 lworkOnHost,
-                                 info);
+        return hipsolverDnXgesvdr(handle,
+                                  params,
+                                  jobu,
+                                  jobv,
+                                  m,
+                                  n,
+                                  k,
+                                  p,
+                                  niters,
+                                  HIP_R_64F,
+                                  A,
+                                  lda,
+                                  HIP_R_64F,
+                                  S,
+                                  HIP_R_64F,
+                                  U,
+                                  ldu,
+                                  HIP_R_64F,
+                                  V,
+                                  ldv,
+                                  HIP_R_64F,
+                                  workOnDevice,
+                                  lworkOnDevice,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info);
     case COMPAT_NORMAL_ALT:
-        return hipsolverDnXgetrf(handle,
-                                 params,
-                                 m,
-                                 n,
-                                 HIP_R_64F,
-                                 A,
-                                 lda,
-                                 nullptr,
-                                 HIP_R_64F,
-                                 workOnDevice,
-                                 lworkOnDevice,
-                                 workOnHost,
-                                 lworkOnHost,
-                                 info);
+        return hipsolverDnXgesvdrStridedBatched(handle,
+                                                params,
+                                                jobu,
+                                                jobv,
+                                                m,
+                                                n,
+                                                k,
+                                                p,
+                                                niters,
+                                                HIP_R_64F,
+                                                A,
+                                                lda,
+                                                stA,
+                                                HIP_R_64F,
+                                                S,
+                                                stS,
+                                                HIP_R_64F,
+                                                U,
+                                                ldu,
+                                                stU,
+                                                HIP_R_64F,
+                                                V,
+                                                ldv,
+                                                stV,
+                                                HIP_R_64F,
+                                                workOnDevice,
+                                                lworkOnDevice,
+                                                workOnHost,
+                                                lworkOnHost,
+                                                info,
+                                                hRnrmF,
+                                                bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
-                                         bool                NPVT,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverDnParams_t params,
-                                         int64_t             m,
-                                         int64_t             n,
-                                         hipsolverComplex*   A,
-                                         int64_t             lda,
-                                         int64_t             stA,
-                                         int64_t*            ipiv,
-                                         int64_t             stP,
-                                         hipsolverComplex*   workOnDevice,
-                                         size_t              lworkOnDevice,
-                                         hipsolverComplex*   workOnHost,
-                                         size_t              lworkOnHost,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_gesvdr(testAPI_t           API,
+                                          bool                STRIDED,
+                                          hipsolverHandle_t   handle,
+                                          hipsolverDnParams_t params,
+                                          char                jobu,
+                                          char                jobv,
+                                          int                 m,
+                                          int                 n,
+                                          int                 k,
+                                          int                 p,
+                                          int                 niters,
+                                          hipsolverComplex*   A,
+                                          int                 lda,
+                                          int                 stA,
+                                          float*              S,
+                                          int                 stS,
+                                          hipsolverComplex*   U,
+                                          int                 ldu,
+                                          int                 stU,
+                                          hipsolverComplex*   V,
+                                          int                 ldv,
+                                          int                 stV,
+                                          hipsolverComplex*   workOnDevice,
+                                          size_t              lworkOnDevice,
+                                          hipsolverComplex*   workOnHost,
+                                          size_t              lworkOnHost,
+                                          int*                info,
+                                          double*             hRnrmF,
+                                          int                 bc)
 {
-    switch(api2marshal(API, NPVT))
+    switch(api2marshal(API, STRIDED))
     {
     case COMPAT_NORMAL:
-        return hipsolverDnXgetrf(handle,
-                                 params,
-                                 m,
-                                 n,
-                                 HIP_C_32F,
-                                 A,
-                                 lda,
-                                 ipiv,
-                                 HIP_C_32F,
-                                 workOnDevice,
-                                 lworkOnDevice,
-                                 workOnHost,
-                                 lworkOnHost,
-                                 info);
+        return hipsolverDnXgesvdr(handle,
+                                  params,
+                                  jobu,
+                                  jobv,
+                                  m,
+                                  n,
+                                  k,
+                                  p,
+                                  niters,
+                                  HIP_C_32F,
+                                  A,
+                                  lda,
+                                  HIP_R_32F,
+                                  S,
+                                  HIP_C_32F,
+                                  U,
+                                  ldu,
+                                  HIP_C_32F,
+                                  V,
+                                  ldv,
+                                  HIP_C_32F,
+                                  workOnDevice,
+                                  lworkOnDevice,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info);
     case COMPAT_NORMAL_ALT:
-        return hipsolverDnXgetrf(handle,
-                                 params,
-                                 m,
-                                 n,
-                                 HIP_C_32F,
-                                 A,
-                                 lda,
-                                 nullptr,
-                                 HIP_C_32F,
-                                 workOnDevice,
-                                 lworkOnDevice,
-                                 workOnHost,
-                                 lworkOnHost,
-                                 info);
+        return hipsolverDnXgesvdrStridedBatched(handle,
+                                                params,
+                                                jobu,
+                                                jobv,
+                                                m,
+                                                n,
+                                                k,
+                                                p,
+                                                niters,
+                                                HIP_C_32F,
+                                                A,
+                                                lda,
+                                                stA,
+                                                HIP_R_32F,
+                                                S,
+                                                stS,
+                                                HIP_C_32F,
+                                                U,
+                                                ldu,
+                                                stU,
+                                                HIP_C_32F,
+                                                V,
+                                                ldv,
+                                                stV,
+                                                HIP_C_32F,
+                                                workOnDevice,
+                                                lworkOnDevice,
+                                                workOnHost,
+                                                lworkOnHost,
+                                                info,
+                                                hRnrmF,
+                                                bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
-                                         bool                    NPVT,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverDnParams_t     params,
-                                         int64_t                 m,
-                                         int64_t                 n,
-                                         hipsolverDoubleComplex* A,
-                                         int64_t                 lda,
-                                         int64_t                 stA,
-                                         int64_t*                ipiv,
-                                         int64_t                 stP,
-                                         hipsolverDoubleComplex* workOnDevice,
-                                         size_t                  lworkOnDevice,
-                                         hipsolverDoubleComplex* workOnHost,
-                                         size_t                  lworkOnHost,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_gesvdr(testAPI_t               API,
+                                          bool                    STRIDED,
+                                          hipsolverHandle_t       handle,
+                                          hipsolverDnParams_t     params,
+                                          char                    jobu,
+                                          char                    jobv,
+                                          int                     m,
+                                          int                     n,
+                                          int                     k,
+                                          int                     p,
+                                          int                     niters,
+                                          hipsolverDoubleComplex* A,
+                                          int                     lda,
+                                          int                     stA,
+                                          double*                 S,
+                                          int                     stS,
+                                          hipsolverDoubleComplex* U,
+                                          int                     ldu,
+                                          int                     stU,
+                                          hipsolverDoubleComplex* V,
+                                          int                     ldv,
+                                          int                     stV,
+                                          hipsolverDoubleComplex* workOnDevice,
+                                          size_t                  lworkOnDevice,
+                                          hipsolverDoubleComplex* workOnHost,
+                                          size_t                  lworkOnHost,
+                                          int*                    info,
+                                          double*                 hRnrmF,
+                                          int                     bc)
 {
-    switch(api2marshal(API, NPVT))
+    switch(api2marshal(API, STRIDED))
     {
     case COMPAT_NORMAL:
-        return hipsolverDnXgetrf(handle,
-                                 params,
-                                 m,
-                                 n,
-                                 HIP_C_64F,
-                                 A,
-                                 lda,
-                                 ipiv,
-                                 HIP_C_64F,
-                                 workOnDevice,
-                                 lworkOnDevice,
-                                 workOnHost,
-                                 lworkOnHost,
-                                 info);
+        return hipsolverDnXgesvdr(handle,
+                                  params,
+                                  jobu,
+                                  jobv,
+                                  m,
+                                  n,
+                                  k,
+                                  p,
+                                  niters,
+                                  HIP_C_64F,
+                                  A,
+                                  lda,
+                                  HIP_R_64F,
+                                  S,
+                                  HIP_C_64F,
+                                  U,
+                                  ldu,
+                                  HIP_C_64F,
+                                  V,
+                                  ldv,
+                                  HIP_C_64F,
+                                  workOnDevice,
+                                  lworkOnDevice,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info);
     case COMPAT_NORMAL_ALT:
-        return hipsolverDnXgetrf(handle,
-                                 params,
-                                 m,
-                                 n,
-                                 HIP_C_64F,
-                                 A,
-                                 lda,
-                                 nullptr,
-                                 HIP_C_64F,
-                                 workOnDevice,
-                                 lworkOnDevice,
-                                 workOnHost,
-                                 lworkOnHost,
-                                 info);
+        return hipsolverDnXgesvdrStridedBatched(handle,
+                                                params,
+                                                jobu,
+                                                jobv,
+                                                m,
+                                                n,
+                                                k,
+                                                p,
+                                                niters,
+                                                HIP_C_64F,
+                                                A,
+                                                lda,
+                                                stA,
+                                                HIP_R_64F,
+                                                S,
+                                                stS,
+                                                HIP_C_64F,
+                                                U,
+                                                ldu,
+                                                stU,
+                                                HIP_C_64F,
+                                                V,
+                                                ldv,
+                                                stV,
+                                                HIP_C_64F,
+                                                workOnDevice,
+                                                lworkOnDevice,
+                                                workOnHost,
+                                                lworkOnHost,
+                                                info,
+                                                hRnrmF,
+                                                bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 /********************************************************/
 
-/******************** GETRS ********************/
+/******************** GETRF ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverDnParams_t  params,
-                                                    hipsolverOperation_t trans,
-                                                    int                  n,
-                                                    int                  nrhs,
-                                                    float*               A,
-                                                    int                  lda,
-                                                    int*                 ipiv,
-                                                    float*               B,
-                                                    int                  ldb,
-                                                    int*                 lwork)
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int                 m,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
 {
-    switch(API)
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
-    case API_FORTRAN:
-        return hipsolverSgetrs_bufferSizeFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_NORMAL:
+        return hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverSgetrfStridedBatched_bufferSize(
+            handle, m, n, A, lda, stA, lworkOnDevice, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrf_bufferSizeFortran(handle, m, n, A, lda, lworkOnDevice);
+    case COMPAT_NORMAL:
+        return hipsolverDnSgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverDnParams_t  params,
-                                                    hipsolverOperation_t trans,
-                                                    int                  n,
-                                                    int                  nrhs,
-                                                    double*              A,
-                                                    int                  lda,
-                                                    int*                 ipiv,
-                                                    double*              B,
-                                                    int                  ldb,
-                                                    int*                 lwork)
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int                 m,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
 {
-    switch(API)
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
-    case API_FORTRAN:
-        return hipsolverDgetrs_bufferSizeFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_NORMAL:
+        return hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverDgetrfStridedBatched_bufferSize(
+            handle, m, n, A, lda, stA, lworkOnDevice, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrf_bufferSizeFortran(handle, m, n, A, lda, lworkOnDevice);
+    case COMPAT_NORMAL:
+        return hipsolverDnDgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverDnParams_t  params,
-                                                    hipsolverOperation_t trans,
-                                                    int                  n,
-                                                    int                  nrhs,
-                                                    hipsolverComplex*    A,
-                                                    int                  lda,
-                                                    int*                 ipiv,
-                                                    hipsolverComplex*    B,
-                                                    int                  ldb,
-                                                    int*                 lwork)
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int                 m,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
 {
-    switch(API)
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCgetrs_bufferSize(handle,
-                                          trans,
-                                          n,
-                                          nrhs,
-                                          (hipFloatComplex*)A,
-                                          lda,
-                                          ipiv,
-                                          (hipFloatComplex*)B,
-                                          ldb,
-                                          lwork);
-    case API_FORTRAN:
-        return hipsolverCgetrs_bufferSizeFortran(handle,
-                                                 trans,
-                                                 n,
-                                                 nrhs,
-                                                 (hipFloatComplex*)A,
-                                                 lda,
-                                                 ipiv,
-                                                 (hipFloatComplex*)B,
-                                                 ldb,
-                                                 lwork);
+    case C_NORMAL:
+        return hipsolverCgetrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverCgetrfStridedBatched_bufferSize(
+            handle, m, n, (hipFloatComplex*)A, lda, stA, lworkOnDevice, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrf_bufferSizeFortran(
+            handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
+    case COMPAT_NORMAL:
+        return hipsolverDnCgetrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
                                                     hipsolverHandle_t       handle,
                                                     hipsolverDnParams_t     params,
-                                                    hipsolverOperation_t    trans,
+                                                    int                     m,
                                                     int                     n,
-                                                    int                     nrhs,
                                                     hipsolverDoubleComplex* A,
                                                     int                     lda,
-                                                    int*                    ipiv,
-                                                    hipsolverDoubleComplex* B,
-                                                    int                     ldb,
-                                                    int*                    lwork)
+                                                    int                     stA,
+                                                    int*                    lworkOnDevice,
+                                                    int*                    lworkOnHost,
+                                                    int                     bc)
 {
-    switch(API)
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZgetrs_bufferSize(handle,
-                                          trans,
-                                          n,
-                                          nrhs,
-                                          (hipDoubleComplex*)A,
-                                          lda,
-                                          ipiv,
-                                          (hipDoubleComplex*)B,
-                                          ldb,
-                                          lwork);
-    case API_FORTRAN:
-        return hipsolverZgetrs_bufferSizeFortran(handle,
-                                                 trans,
-                                                 n,
-                                                 nrhs,
-                                                 (hipDoubleComplex*)A,
-                                                 lda,
-                                                 ipiv,
-                                                 (hipDoubleComplex*)B,
-                                                 ldb,
-                                                 lwork);
+    case C_NORMAL:
+        return hipsolverZgetrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverZgetrfStridedBatched_bufferSize(
+            handle, m, n, (hipDoubleComplex*)A, lda, stA, lworkOnDevice, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrf_bufferSizeFortran(
+            handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
+    case COMPAT_NORMAL:
+        return hipsolverDnZgetrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverDnParams_t  params,
-                                                    hipsolverOperation_t trans,
-                                                    int64_t              n,
-                                                    int64_t              nrhs,
-                                                    float*               A,
-                                                    int64_t              lda,
-                                                    int64_t*             ipiv,
-                                                    float*               B,
-                                                    int64_t              ldb,
-                                                    size_t*              lwork)
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int64_t             m,
+                                                    int64_t             n,
+                                                    float*              A,
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf_bufferSize(
+            handle, params, m, n, HIP_R_32F, A, lda, HIP_R_32F, lworkOnDevice, lworkOnHost);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverDnParams_t  params,
-                                                    hipsolverOperation_t trans,
-                                                    int64_t              n,
-                                                    int64_t              nrhs,
-                                                    double*              A,
-                                                    int64_t              lda,
-                                                    int64_t*             ipiv,
-                                                    double*              B,
-                                                    int64_t              ldb,
-                                                    size_t*              lwork)
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int64_t             m,
+                                                    int64_t             n,
+                                                    double*             A,
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf_bufferSize(
+            handle, params, m, n, HIP_R_64F, A, lda, HIP_R_64F, lworkOnDevice, lworkOnHost);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverDnParams_t  params,
-                                                    hipsolverOperation_t trans,
-                                                    int64_t              n,
-                                                    int64_t              nrhs,
-                                                    hipsolverComplex*    A,
-                                                    int64_t              lda,
-                                                    int64_t*             ipiv,
-                                                    hipsolverComplex*    B,
-                                                    int64_t              ldb,
-                                                    size_t*              lwork)
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int64_t             m,
+                                                    int64_t             n,
+                                                    hipsolverComplex*   A,
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf_bufferSize(
+            handle, params, m, n, HIP_C_32F, A, lda, HIP_C_32F, lworkOnDevice, lworkOnHost);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
                                                     hipsolverHandle_t       handle,
                                                     hipsolverDnParams_t     params,
-                                                    hipsolverOperation_t    trans,
+                                                    int64_t                 m,
                                                     int64_t                 n,
-                                                    int64_t                 nrhs,
                                                     hipsolverDoubleComplex* A,
                                                     int64_t                 lda,
-                                                    int64_t*                ipiv,
-                                                    hipsolverDoubleComplex* B,
-                                                    int64_t                 ldb,
-                                                    size_t*                 lwork)
+                                                    int64_t                 stA,
+                                                    size_t*                 lworkOnDevice,
+                                                    size_t*                 lworkOnHost,
+                                                    int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf_bufferSize(
+            handle, params, m, n, HIP_C_64F, A, lda, HIP_C_64F, lworkOnDevice, lworkOnHost);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverDnParams_t  params,
-                                         hipsolverOperation_t trans,
-                                         int                  n,
-                                         int                  nrhs,
-                                         float*               A,
-                                         int                  lda,
-                                         int                  stA,
-                                         int*                 ipiv,
-                                         int                  stP,
-                                         float*               B,
-                                         int                  ldb,
-                                         int                  stB,
-                                         float*               work,
-                                         int                  lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int                 m,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         float*              workOnDevice,
+                                         int                 lworkOnDevice,
+                                         float*              workOnHost,
+                                         int                 lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    if(STRIDED)
     {
-    case API_NORMAL:
-        return hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSgetrsFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+        switch(API)
+        {
+        case API_NORMAL:
+            return hipsolverSgetrfStridedBatched(handle,
+                                                 m,
+                                                 n,
+                                                 A,
+                                                 lda,
+                                                 stA,
+                                                 workOnDevice,
+                                                 lworkOnDevice,
+                                                 NPVT ? nullptr : ipiv,
+                                                 stP,
+                                                 info,
+                                                 bc);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    switch(api2marshal(API, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverSgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
+    case C_NORMAL_ALT:
+        return hipsolverSgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, nullptr, info);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrfFortran(
+            handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnSgetrf(handle, m, n, A, lda, workOnDevice, ipiv, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverDnParams_t  params,
-                                         hipsolverOperation_t trans,
-                                         int                  n,
-                                         int                  nrhs,
-                                         double*              A,
-                                         int                  lda,
-                                         int                  stA,
-                                         int*                 ipiv,
-                                         int                  stP,
-                                         double*              B,
-                                         int                  ldb,
-                                         int                  stB,
-                                         double*              work,
-                                         int                  lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int                 m,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         double*             workOnDevice,
+                                         int                 lworkOnDevice,
+                                         double*             workOnHost,
+                                         int                 lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    if(STRIDED)
     {
-    case API_NORMAL:
-        return hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDgetrsFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+        switch(API)
+        {
+        case API_NORMAL:
+            return hipsolverDgetrfStridedBatched(handle,
+                                                 m,
+                                                 n,
+                                                 A,
+                                                 lda,
+                                                 stA,
+                                                 workOnDevice,
+                                                 lworkOnDevice,
+                                                 NPVT ? nullptr : ipiv,
+                                                 stP,
+                                                 info,
+                                                 bc);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    switch(api2marshal(API, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverDgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
+    case C_NORMAL_ALT:
+        return hipsolverDgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, nullptr, info);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrfFortran(
+            handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnDgetrf(handle, m, n, A, lda, workOnDevice, ipiv, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverDnParams_t  params,
-                                         hipsolverOperation_t trans,
-                                         int                  n,
-                                         int                  nrhs,
-                                         hipsolverComplex*    A,
-                                         int                  lda,
-                                         int                  stA,
-                                         int*                 ipiv,
-                                         int                  stP,
-                                         hipsolverComplex*    B,
-                                         int                  ldb,
-                                         int                  stB,
-                                         hipsolverComplex*    work,
-                                         int                  lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int                 m,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         hipsolverComplex*   workOnDevice,
+                                         int                 lworkOnDevice,
+                                         hipsolverComplex*   workOnHost,
+                                         int                 lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    if(STRIDED)
     {
-    case API_NORMAL:
-        return hipsolverCgetrs(handle,
-                               trans,
+        switch(API)
+        {
+        case API_NORMAL:
+            return hipsolverCgetrfStridedBatched(handle,
+                                                 m,
+                                                 n,
+                                                 (hipFloatComplex*)A,
+                                                 lda,
+                                                 stA,
+                                                 (hipFloatComplex*)workOnDevice,
+                                                 lworkOnDevice,
+                                                 NPVT ? nullptr : ipiv,
+                                                 stP,
+                                                 info,
+                                                 bc);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    switch(api2marshal(API, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverCgetrf(handle,
+                               m,
                                n,
-                               nrhs,
                                (hipFloatComplex*)A,
                                lda,
+                               (hipFloatComplex*)workOnDevice,
+                               lworkOnDevice,
                                ipiv,
-                               (hipFloatComplex*)B,
-                               ldb,
-                               (hipFloatComplex*)work,
-                               lwork,
                                info);
-    case API_FORTRAN:
-        return hipsolverCgetrsFortran(handle,
-                                      trans,
+    case C_NORMAL_ALT:
+        return hipsolverCgetrf(handle,
+                               m,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               (hipFloatComplex*)workOnDevice,
+                               lworkOnDevice,
+                               nullptr,
+                               info);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrfFortran(handle,
+                                      m,
                                       n,
-                                      nrhs,
                                       (hipFloatComplex*)A,
                                       lda,
+                                      (hipFloatComplex*)workOnDevice,
+                                      lworkOnDevice,
                                       ipiv,
-                                      (hipFloatComplex*)B,
-                                      ldb,
-                                      (hipFloatComplex*)work,
-                                      lwork,
                                       info);
-    case API_COMPAT:
-        return hipsolverDnCgetrs(
-            handle, trans, n, nrhs, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)B, ldb, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnCgetrf(
+            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)workOnDevice, ipiv, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
+                                         bool                    NPVT,
+                                         bool                    STRIDED,
                                          hipsolverHandle_t       handle,
                                          hipsolverDnParams_t     params,
-                                         hipsolverOperation_t    trans,
+                                         int                     m,
                                          int                     n,
-                                         int                     nrhs,
                                          hipsolverDoubleComplex* A,
                                          int                     lda,
                                          int                     stA,
                                          int*                    ipiv,
                                          int                     stP,
-                                         hipsolverDoubleComplex* B,
-                                         int                     ldb,
-                                         int                     stB,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
+                                         hipsolverDoubleComplex* workOnDevice,
+                                         int                     lworkOnDevice,
+                                         hipsolverDoubleComplex* workOnHost,
+                                         int                     lworkOnHost,
                                          int*                    info,
                                          int                     bc)
 {
-    switch(API)
+    if(STRIDED)
     {
-    case API_NORMAL:
-        return hipsolverZgetrs(handle,
-                               trans,
+        switch(API)
+        {
+        case API_NORMAL:
+            return hipsolverZgetrfStridedBatched(handle,
+                                                 m,
+                                                 n,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 stA,
+                                                 (hipDoubleComplex*)workOnDevice,
+                                                 lworkOnDevice,
+                                                 NPVT ? nullptr : ipiv,
+                                                 stP,
+                                                 info,
+                                                 bc);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    switch(api2marshal(API, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverZgetrf(handle,
+                               m,
                                n,
-                               nrhs,
                                (hipDoubleComplex*)A,
                                lda,
+                               (hipDoubleComplex*)workOnDevice,
+                               lworkOnDevice,
                                ipiv,
-                               (hipDoubleComplex*)B,
-                               ldb,
-                               (hipDoubleComplex*)work,
-                               lwork,
                                info);
-    case API_FORTRAN:
-        return hipsolverZgetrsFortran(handle,
-                                      trans,
+    case C_NORMAL_ALT:
+        return hipsolverZgetrf(handle,
+                               m,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               (hipDoubleComplex*)workOnDevice,
+                               lworkOnDevice,
+                               nullptr,
+                               info);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrfFortran(handle,
+                                      m,
                                       n,
-                                      nrhs,
                                       (hipDoubleComplex*)A,
                                       lda,
+                                      (hipDoubleComplex*)workOnDevice,
+                                      lworkOnDevice,
                                       ipiv,
-                                      (hipDoubleComplex*)B,
-                                      ldb,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
                                       info);
-    case API_COMPAT:
-        return hipsolverDnZgetrs(handle,
-                                 trans,
+    case COMPAT_NORMAL:
+        return hipsolverDnZgetrf(
+            handle, m, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)workOnDevice, ipiv, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int64_t             m,
+                                         int64_t             n,
+                                         float*              A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         float*              workOnDevice,
+                                         size_t              lworkOnDevice,
+                                         float*              workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(STRIDED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    switch(api2marshal(API, NPVT))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf(handle,
+                                 params,
+                                 m,
                                  n,
-                                 nrhs,
-                                 (hipDoubleComplex*)A,
+                                 HIP_R_32F,
+                                 A,
                                  lda,
                                  ipiv,
-                                 (hipDoubleComplex*)B,
-                                 ldb,
+                                 HIP_R_32F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnXgetrf(handle,
+                                 params,
+                                 m,
+                                 n,
+                                 HIP_R_32F,
+                                 A,
+                                 lda,
+                                 nullptr,
+                                 HIP_R_32F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
                                  info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverDnParams_t  params,
-                                         hipsolverOperation_t trans,
-                                         int64_t              n,
-                                         int64_t              nrhs,
-                                         float*               A,
-                                         int64_t              lda,
-                                         int64_t              stA,
-                                         int64_t*             ipiv,
-                                         int64_t              stP,
-                                         float*               B,
-                                         int64_t              ldb,
-                                         int64_t              stB,
-                                         float*               work,
-                                         size_t               lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int64_t             m,
+                                         int64_t             n,
+                                         double*             A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         double*             workOnDevice,
+                                         size_t              lworkOnDevice,
+                                         double*             workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
-    {
-    case API_COMPAT:
-        return hipsolverDnXgetrs(
-            handle, params, trans, n, nrhs, HIP_R_32F, A, lda, ipiv, HIP_R_32F, B, ldb, info);
-    default:
+    if(STRIDED)
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
-}
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverDnParams_t  params,
-                                         hipsolverOperation_t trans,
-                                         int64_t              n,
-                                         int64_t              nrhs,
-                                         double*              A,
-                                         int64_t              lda,
-                                         int64_t              stA,
-                                         int64_t*             ipiv,
-                                         int64_t              stP,
-                                         double*              B,
-                                         int64_t              ldb,
-                                         int64_t              stB,
-                                         double*              work,
-                                         size_t               lwork,
-                                         int*                 info,
-                                         int                  bc)
-{
-    switch(API)
+    switch(api2marshal(API, NPVT))
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrs(
-            handle, params, trans, n, nrhs, HIP_R_64F, A, lda, ipiv, HIP_R_64F, B, ldb, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf(handle,
+                                 params,
+                                 m,
+                                 n,
+                                 HIP_R_64F,
+                                 A,
+                                 lda,
+                                 ipiv,
+                                 HIP_R_64F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnXgetrf(handle,
+                                 params,
+                                 m,
+                                 n,
+                                 HIP_R_64F,
+                                 A,
+                                 lda,
+                                 nullptr,
+                                 HIP_R_64F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverDnParams_t  params,
-                                         hipsolverOperation_t trans,
-                                         int64_t              n,
-                                         int64_t              nrhs,
-                                         hipsolverComplex*    A,
-                                         int64_t              lda,
-                                         int64_t              stA,
-                                         int64_t*             ipiv,
-                                         int64_t              stP,
-                                         hipsolverComplex*    B,
-                                         int64_t              ldb,
-                                         int64_t              stB,
-                                         hipsolverComplex*    work,
-                                         size_t               lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int64_t             m,
+                                         int64_t             n,
+                                         hipsolverComplex*   A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         hipsolverComplex*   workOnDevice,
+                                         size_t              lworkOnDevice,
+                                         hipsolverComplex*   workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    if(STRIDED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    switch(api2marshal(API, NPVT))
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrs(
-            handle, params, trans, n, nrhs, HIP_C_32F, A, lda, ipiv, HIP_C_32F, B, ldb, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf(handle,
+                                 params,
+                                 m,
+                                 n,
+                                 HIP_C_32F,
+                                 A,
+                                 lda,
+                                 ipiv,
+                                 HIP_C_32F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnXgetrf(handle,
+                                 params,
+                                 m,
+                                 n,
+                                 HIP_C_32F,
+                                 A,
+                                 lda,
+                                 nullptr,
+                                 HIP_C_32F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
+                                         bool                    NPVT,
+                                         bool                    STRIDED,
                                          hipsolverHandle_t       handle,
                                          hipsolverDnParams_t     params,
-                                         hipsolverOperation_t    trans,
+                                         int64_t                 m,
                                          int64_t                 n,
-                                         int64_t                 nrhs,
                                          hipsolverDoubleComplex* A,
                                          int64_t                 lda,
                                          int64_t                 stA,
                                          int64_t*                ipiv,
                                          int64_t                 stP,
-                                         hipsolverDoubleComplex* B,
-                                         int64_t                 ldb,
-                                         int64_t                 stB,
-                                         hipsolverDoubleComplex* work,
-                                         size_t                  lwork,
+                                         hipsolverDoubleComplex* workOnDevice,
+                                         size_t                  lworkOnDevice,
+                                         hipsolverDoubleComplex* workOnHost,
+                                         size_t                  lworkOnHost,
                                          int*                    info,
                                          int                     bc)
 {
-    switch(API)
+    if(STRIDED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    switch(api2marshal(API, NPVT))
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrs(
-            handle, params, trans, n, nrhs, HIP_C_64F, A, lda, ipiv, HIP_C_64F, B, ldb, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf(handle,
+                                 params,
+                                 m,
+                                 n,
+                                 HIP_C_64F,
+                                 A,
+                                 lda,
+                                 ipiv,
+                                 HIP_C_64F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnXgetrf(handle,
+                                 params,
+                                 m,
+                                 n,
+                                 HIP_C_64F,
+                                 A,
+                                 lda,
+                                 nullptr,
+                                 HIP_C_64F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 /********************************************************/
 
-/******************** POTRF ********************/
+/******************** GETRS ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    float*              A,
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    float*               A,
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    float*               B,
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
-    case API_COMPAT:
-        return hipsolverDnSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverSgetrsStridedBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrs_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    double*             A,
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    double*              A,
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    double*              B,
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
-    case API_COMPAT:
-        return hipsolverDnDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverDgetrsStridedBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrs_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipsolverComplex*   A,
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    hipsolverComplex*    A,
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    hipsolverComplex*    B,
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCpotrf_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
-    case API_COMPAT:
-        return hipsolverDnCpotrf_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverCgetrs_bufferSize(handle,
+                                          trans,
+                                          n,
+                                          nrhs,
+                                          (hipFloatComplex*)A,
+                                          lda,
+                                          ipiv,
+                                          (hipFloatComplex*)B,
+                                          ldb,
+                                          lwork);
+    case C_NORMAL_ALT:
+        return hipsolverCgetrsStridedBatched_bufferSize(handle,
+                                                        trans,
+                                                        n,
+                                                        nrhs,
+                                                        (hipFloatComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        ipiv,
+                                                        stP,
+                                                        (hipFloatComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        lwork,
+                                                        bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrs_bufferSizeFortran(handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 (hipFloatComplex*)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (hipFloatComplex*)B,
+                                                 ldb,
+                                                 lwork);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
                                                     hipsolverHandle_t       handle,
-                                                    hipsolverFillMode_t     uplo,
+                                                    hipsolverDnParams_t     params,
+                                                    hipsolverOperation_t    trans,
                                                     int                     n,
+                                                    int                     nrhs,
                                                     hipsolverDoubleComplex* A,
                                                     int                     lda,
+                                                    int                     stA,
+                                                    int*                    ipiv,
+                                                    int                     stP,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int                     stB,
                                                     int*                    lwork,
                                                     int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotrf_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
-    case API_COMPAT:
-        return hipsolverDnZpotrf_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverZgetrs_bufferSize(handle,
+                                          trans,
+                                          n,
+                                          nrhs,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          ipiv,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          lwork);
+    case C_NORMAL_ALT:
+        return hipsolverZgetrsStridedBatched_bufferSize(handle,
+                                                        trans,
+                                                        n,
+                                                        nrhs,
+                                                        (hipDoubleComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        ipiv,
+                                                        stP,
+                                                        (hipDoubleComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        lwork,
+                                                        bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrs_bufferSizeFortran(handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (hipDoubleComplex*)B,
+                                                 ldb,
+                                                 lwork);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A,
-                                         int                 lda,
-                                         int                 stA,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int64_t              n,
+                                                    int64_t              nrhs,
+                                                    float*               A,
+                                                    int64_t              lda,
+                                                    int64_t              stA,
+                                                    int64_t*             ipiv,
+                                                    int64_t              stP,
+                                                    float*               B,
+                                                    int64_t              ldb,
+                                                    int64_t              stB,
+                                                    size_t*              lwork,
+                                                    int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnSpotrf(handle, uplo, n, A, lda, work, lwork, info);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A,
-                                         int                 lda,
-                                         int                 stA,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int64_t              n,
+                                                    int64_t              nrhs,
+                                                    double*              A,
+                                                    int64_t              lda,
+                                                    int64_t              stA,
+                                                    int64_t*             ipiv,
+                                                    int64_t              stP,
+                                                    double*              B,
+                                                    int64_t              ldb,
+                                                    int64_t              stB,
+                                                    size_t*              lwork,
+                                                    int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnDpotrf(handle, uplo, n, A, lda, work, lwork, info);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipsolverComplex*   A,
-                                         int                 lda,
-                                         int                 stA,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int64_t              n,
+                                                    int64_t              nrhs,
+                                                    hipsolverComplex*    A,
+                                                    int64_t              lda,
+                                                    int64_t              stA,
+                                                    int64_t*             ipiv,
+                                                    int64_t              stP,
+                                                    hipsolverComplex*    B,
+                                                    int64_t              ldb,
+                                                    int64_t              stB,
+                                                    size_t*              lwork,
+                                                    int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCpotrf(
-            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverCpotrfFortran(
-            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnCpotrf(
-            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverFillMode_t     uplo,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverDnParams_t     params,
+                                                    hipsolverOperation_t    trans,
+                                                    int64_t                 n,
+                                                    int64_t                 nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int64_t                 lda,
+                                                    int64_t                 stA,
+                                                    int64_t*                ipiv,
+                                                    int64_t                 stP,
+                                                    hipsolverDoubleComplex* B,
+                                                    int64_t                 ldb,
+                                                    int64_t                 stB,
+                                                    size_t*                 lwork,
+                                                    int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotrf(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverZpotrfFortran(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnZpotrf(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-// batched
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    float*              A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         float*               A,
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         float*               B,
+                                         int                  ldb,
+                                         int                  stB,
+                                         float*               work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+    case C_NORMAL:
+        return hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverSgetrsStridedBatched(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrsFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    double*             A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         double*              A,
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         double*              B,
+                                         int                  ldb,
+                                         int                  stB,
+                                         double*              work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+    case C_NORMAL:
+        return hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverDgetrsStridedBatched(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrsFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipsolverComplex*   A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         hipsolverComplex*    A,
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         hipsolverComplex*    B,
+                                         int                  ldb,
+                                         int                  stB,
+                                         hipsolverComplex*    work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCpotrfBatched_bufferSize(
-            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverCpotrfBatched_bufferSizeFortran(
-            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
+    case C_NORMAL:
+        return hipsolverCgetrs(handle,
+                               trans,
+                               n,
+                               nrhs,
+                               (hipFloatComplex*)A,
+                               lda,
+                               ipiv,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverCgetrsStridedBatched(handle,
+                                             trans,
+                                             n,
+                                             nrhs,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             stA,
+                                             ipiv,
+                                             stP,
+                                             (hipFloatComplex*)B,
+                                             ldb,
+                                             stB,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrsFortran(handle,
+                                      trans,
+                                      n,
+                                      nrhs,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      ipiv,
+                                      (hipFloatComplex*)B,
+                                      ldb,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
+    case COMPAT_NORMAL:
+        return hipsolverDnCgetrs(
+            handle, trans, n, nrhs, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)B, ldb, info);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t               API,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverFillMode_t     uplo,
-                                                    int                     n,
-                                                    hipsolverDoubleComplex* A[],
-                                                    int                     lda,
-                                                    int*                    lwork,
-                                                    int                     bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t               API,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverDnParams_t     params,
+                                         hipsolverOperation_t    trans,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotrfBatched_bufferSize(
-            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverZpotrfBatched_bufferSizeFortran(
-            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
+    case C_NORMAL:
+        return hipsolverZgetrs(handle,
+                               trans,
+                               n,
+                               nrhs,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               ipiv,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverZgetrsStridedBatched(handle,
+                                             trans,
+                                             n,
+                                             nrhs,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             stA,
+                                             ipiv,
+                                             stP,
+                                             (hipDoubleComplex*)B,
+                                             ldb,
+                                             stB,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrsFortran(handle,
+                                      trans,
+                                      n,
+                                      nrhs,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      ipiv,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info);
+    case COMPAT_NORMAL:
+        return hipsolverDnZgetrs(handle,
+                                 trans,
+                                 n,
+                                 nrhs,
+                                 (hipDoubleComplex*)A,
+                                 lda,
+                                 ipiv,
+                                 (hipDoubleComplex*)B,
+                                 ldb,
+                                 info);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int64_t              n,
+                                         int64_t              nrhs,
+                                         float*               A,
+                                         int64_t              lda,
+                                         int64_t              stA,
+                                         int64_t*             ipiv,
+                                         int64_t              stP,
+                                         float*               B,
+                                         int64_t              ldb,
+                                         int64_t              stB,
+                                         float*               work,
+                                         size_t               lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnSpotrfBatched(handle, uplo, n, A, lda, info, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrs(
+            handle, params, trans, n, nrhs, HIP_R_32F, A, lda, ipiv, HIP_R_32F, B, ldb, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int64_t              n,
+                                         int64_t              nrhs,
+                                         double*              A,
+                                         int64_t              lda,
+                                         int64_t              stA,
+                                         int64_t*             ipiv,
+                                         int64_t              stP,
+                                         double*              B,
+                                         int64_t              ldb,
+                                         int64_t              stB,
+                                         double*              work,
+                                         size_t               lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnDpotrfBatched(handle, uplo, n, A, lda, info, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrs(
+            handle, params, trans, n, nrhs, HIP_R_64F, A, lda, ipiv, HIP_R_64F, B, ldb, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipsolverComplex*   A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int64_t              n,
+                                         int64_t              nrhs,
+                                         hipsolverComplex*    A,
+                                         int64_t              lda,
+                                         int64_t              stA,
+                                         int64_t*             ipiv,
+                                         int64_t              stP,
+                                         hipsolverComplex*    B,
+                                         int64_t              ldb,
+                                         int64_t              stB,
+                                         hipsolverComplex*    work,
+                                         size_t               lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCpotrfBatched(
-            handle, uplo, n, (hipFloatComplex**)A, lda, (hipFloatComplex*)work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverCpotrfBatchedFortran(
-            handle, uplo, n, (hipFloatComplex**)A, lda, (hipFloatComplex*)work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnCpotrfBatched(handle, uplo, n, (hipFloatComplex**)A, lda, info, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrs(
+            handle, params, trans, n, nrhs, HIP_C_32F, A, lda, ipiv, HIP_C_32F, B, ldb, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t               API,
+                                         bool                    STRIDED,
                                          hipsolverHandle_t       handle,
-                                         hipsolverFillMode_t     uplo,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A[],
-                                         int                     lda,
-                                         int                     stA,
+                                         hipsolverDnParams_t     params,
+                                         hipsolverOperation_t    trans,
+                                         int64_t                 n,
+                                         int64_t                 nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int64_t                 lda,
+                                         int64_t                 stA,
+                                         int64_t*                ipiv,
+                                         int64_t                 stP,
+                                         hipsolverDoubleComplex* B,
+                                         int64_t                 ldb,
+                                         int64_t                 stB,
                                          hipsolverDoubleComplex* work,
-                                         int                     lwork,
+                                         size_t                  lwork,
                                          int*                    info,
                                          int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotrfBatched(
-            handle, uplo, n, (hipDoubleComplex**)A, lda, (hipDoubleComplex*)work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverZpotrfBatchedFortran(
-            handle, uplo, n, (hipDoubleComplex**)A, lda, (hipDoubleComplex*)work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnZpotrfBatched(handle, uplo, n, (hipDoubleComplex**)A, lda, info, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrs(
+            handle, params, trans, n, nrhs, HIP_C_64F, A, lda, ipiv, HIP_C_64F, B, ldb, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 /********************************************************/
 
-/******************** POTRI ********************/
+/******************** POTRF ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
                                                     float*              A,
                                                     int                 lda,
-                                                    int*                lwork)
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSpotri_bufferSize(handle, uplo, n, A, lda, lwork);
+        return hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverSpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+        return hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    case API_COMPAT:
+        return hipsolverDnSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
                                                     double*             A,
                                                     int                 lda,
-                                                    int*                lwork)
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDpotri_bufferSize(handle, uplo, n, A, lda, lwork);
+        return hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverDpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+        return hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    case API_COMPAT:
+        return hipsolverDnDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
                                                     hipsolverComplex*   A,
                                                     int                 lda,
-                                                    int*                lwork)
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCpotri_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
+        return hipsolverCpotrf_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverCpotri_bufferSizeFortran(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
+        return hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
+    case API_COMPAT:
+        return hipsolverDnCpotrf_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t               API,
                                                     hipsolverHandle_t       handle,
                                                     hipsolverFillMode_t     uplo,
                                                     int                     n,
                                                     hipsolverDoubleComplex* A,
                                                     int                     lda,
-                                                    int*                    lwork)
+                                                    int*                    lwork,
+                                                    int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZpotri_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
+        return hipsolverZpotrf_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverZpotri_bufferSizeFortran(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
+        return hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
+    case API_COMPAT:
+        return hipsolverDnZpotrf_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
@@ -6083,15 +7749,17 @@ inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSpotri(handle, uplo, n, A, lda, work, lwork, info);
+        return hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info);
     case API_FORTRAN:
-        return hipsolverSpotriFortran(handle, uplo, n, A, lda, work, lwork, info);
+        return hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnSpotrf(handle, uplo, n, A, lda, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
@@ -6106,15 +7774,17 @@ inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDpotri(handle, uplo, n, A, lda, work, lwork, info);
+        return hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info);
     case API_FORTRAN:
-        return hipsolverDpotriFortran(handle, uplo, n, A, lda, work, lwork, info);
+        return hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnDpotrf(handle, uplo, n, A, lda, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
@@ -6129,17 +7799,20 @@ inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCpotri(
+        return hipsolverCpotrf(
             handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
     case API_FORTRAN:
-        return hipsolverCpotriFortran(
+        return hipsolverCpotrfFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnCpotrf(
             handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potri(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
                                          hipsolverHandle_t       handle,
                                          hipsolverFillMode_t     uplo,
                                          int                     n,
@@ -6154,130 +7827,115 @@ inline hipsolverStatus_t hipsolver_potri(testAPI_t               API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZpotri(
+        return hipsolverZpotrf(
             handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
     case API_FORTRAN:
-        return hipsolverZpotriFortran(
+        return hipsolverZpotrfFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnZpotrf(
             handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
 
-/******************** POTRS ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+// batched
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
-                                                    int                 nrhs,
-                                                    float*              A,
+                                                    float*              A[],
                                                     int                 lda,
-                                                    float*              B,
-                                                    int                 ldb,
                                                     int*                lwork,
                                                     int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+        return hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
     case API_FORTRAN:
-        return hipsolverSpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+        return hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
-                                                    int                 nrhs,
-                                                    double*             A,
+                                                    double*             A[],
                                                     int                 lda,
-                                                    double*             B,
-                                                    int                 ldb,
                                                     int*                lwork,
                                                     int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+        return hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
     case API_FORTRAN:
-        return hipsolverDpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+        return hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
-                                                    int                 nrhs,
-                                                    hipsolverComplex*   A,
+                                                    hipsolverComplex*   A[],
                                                     int                 lda,
-                                                    hipsolverComplex*   B,
-                                                    int                 ldb,
                                                     int*                lwork,
                                                     int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCpotrs_bufferSize(
-            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
+        return hipsolverCpotrfBatched_bufferSize(
+            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
     case API_FORTRAN:
-        return hipsolverCpotrs_bufferSizeFortran(
-            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
+        return hipsolverCpotrfBatched_bufferSizeFortran(
+            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t               API,
                                                     hipsolverHandle_t       handle,
                                                     hipsolverFillMode_t     uplo,
                                                     int                     n,
-                                                    int                     nrhs,
-                                                    hipsolverDoubleComplex* A,
+                                                    hipsolverDoubleComplex* A[],
                                                     int                     lda,
-                                                    hipsolverDoubleComplex* B,
-                                                    int                     ldb,
                                                     int*                    lwork,
                                                     int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZpotrs_bufferSize(
-            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
+        return hipsolverZpotrfBatched_bufferSize(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
     case API_FORTRAN:
-        return hipsolverZpotrs_bufferSizeFortran(
-            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
+        return hipsolverZpotrfBatched_bufferSizeFortran(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
-                                         int                 nrhs,
-                                         float*              A,
+                                         float*              A[],
                                          int                 lda,
                                          int                 stA,
-                                         float*              B,
-                                         int                 ldb,
-                                         int                 stB,
                                          float*              work,
                                          int                 lwork,
                                          int*                info,
@@ -6286,27 +7944,23 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+        return hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
     case API_FORTRAN:
-        return hipsolverSpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+        return hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
     case API_COMPAT:
-        return hipsolverDnSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+        return hipsolverDnSpotrfBatched(handle, uplo, n, A, lda, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
-                                         int                 nrhs,
-                                         double*             A,
+                                         double*             A[],
                                          int                 lda,
                                          int                 stA,
-                                         double*             B,
-                                         int                 ldb,
-                                         int                 stB,
                                          double*             work,
                                          int                 lwork,
                                          int*                info,
@@ -6315,27 +7969,23 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+        return hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
     case API_FORTRAN:
-        return hipsolverDpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+        return hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
     case API_COMPAT:
-        return hipsolverDnDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+        return hipsolverDnDpotrfBatched(handle, uplo, n, A, lda, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
-                                         int                 nrhs,
-                                         hipsolverComplex*   A,
+                                         hipsolverComplex*   A[],
                                          int                 lda,
                                          int                 stA,
-                                         hipsolverComplex*   B,
-                                         int                 ldb,
-                                         int                 stB,
                                          hipsolverComplex*   work,
                                          int                 lwork,
                                          int*                info,
@@ -6344,48 +7994,25 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCpotrs(handle,
-                               uplo,
-                               n,
-                               nrhs,
-                               (hipFloatComplex*)A,
-                               lda,
-                               (hipFloatComplex*)B,
-                               ldb,
-                               (hipFloatComplex*)work,
-                               lwork,
-                               info);
+        return hipsolverCpotrfBatched(
+            handle, uplo, n, (hipFloatComplex**)A, lda, (hipFloatComplex*)work, lwork, info, bc);
     case API_FORTRAN:
-        return hipsolverCpotrsFortran(handle,
-                                      uplo,
-                                      n,
-                                      nrhs,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      (hipFloatComplex*)B,
-                                      ldb,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info);
+        return hipsolverCpotrfBatchedFortran(
+            handle, uplo, n, (hipFloatComplex**)A, lda, (hipFloatComplex*)work, lwork, info, bc);
     case API_COMPAT:
-        return hipsolverDnCpotrs(
-            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, info);
+        return hipsolverDnCpotrfBatched(handle, uplo, n, (hipFloatComplex**)A, lda, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
                                          hipsolverHandle_t       handle,
                                          hipsolverFillMode_t     uplo,
                                          int                     n,
-                                         int                     nrhs,
-                                         hipsolverDoubleComplex* A,
+                                         hipsolverDoubleComplex* A[],
                                          int                     lda,
                                          int                     stA,
-                                         hipsolverDoubleComplex* B,
-                                         int                     ldb,
-                                         int                     stB,
                                          hipsolverDoubleComplex* work,
                                          int                     lwork,
                                          int*                    info,
@@ -6394,167 +8021,104 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZpotrs(handle,
-                               uplo,
-                               n,
-                               nrhs,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               (hipDoubleComplex*)B,
-                               ldb,
-                               (hipDoubleComplex*)work,
-                               lwork,
-                               info);
+        return hipsolverZpotrfBatched(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, (hipDoubleComplex*)work, lwork, info, bc);
     case API_FORTRAN:
-        return hipsolverZpotrsFortran(handle,
-                                      uplo,
-                                      n,
-                                      nrhs,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      (hipDoubleComplex*)B,
-                                      ldb,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info);
+        return hipsolverZpotrfBatchedFortran(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, (hipDoubleComplex*)work, lwork, info, bc);
     case API_COMPAT:
-        return hipsolverDnZpotrs(
-            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, info);
+        return hipsolverDnZpotrfBatched(handle, uplo, n, (hipDoubleComplex**)A, lda, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
+/********************************************************/
 
-// batched
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+/******************** POTRI ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t           API,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
-                                                    int                 nrhs,
-                                                    float*              A[],
+                                                    float*              A,
                                                     int                 lda,
-                                                    float*              B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
+                                                    int*                lwork)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+        return hipsolverSpotri_bufferSize(handle, uplo, n, A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverSpotrsBatched_bufferSizeFortran(
-            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+        return hipsolverSpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t           API,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
-                                                    int                 nrhs,
-                                                    double*             A[],
+                                                    double*             A,
                                                     int                 lda,
-                                                    double*             B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
+                                                    int*                lwork)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+        return hipsolverDpotri_bufferSize(handle, uplo, n, A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverDpotrsBatched_bufferSizeFortran(
-            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+        return hipsolverDpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t           API,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
-                                                    int                 nrhs,
-                                                    hipsolverComplex*   A[],
+                                                    hipsolverComplex*   A,
                                                     int                 lda,
-                                                    hipsolverComplex*   B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
+                                                    int*                lwork)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCpotrsBatched_bufferSize(
-            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
+        return hipsolverCpotri_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverCpotrsBatched_bufferSizeFortran(
-            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
+        return hipsolverCpotri_bufferSizeFortran(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t               API,
                                                     hipsolverHandle_t       handle,
                                                     hipsolverFillMode_t     uplo,
                                                     int                     n,
-                                                    int                     nrhs,
-                                                    hipsolverDoubleComplex* A[],
+                                                    hipsolverDoubleComplex* A,
                                                     int                     lda,
-                                                    hipsolverDoubleComplex* B[],
-                                                    int                     ldb,
-                                                    int*                    lwork,
-                                                    int                     bc)
+                                                    int*                    lwork)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZpotrsBatched_bufferSize(handle,
-                                                 uplo,
-                                                 n,
-                                                 nrhs,
-                                                 (hipDoubleComplex**)A,
-                                                 lda,
-                                                 (hipDoubleComplex**)B,
-                                                 ldb,
-                                                 lwork,
-                                                 bc);
+        return hipsolverZpotri_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverZpotrsBatched_bufferSizeFortran(handle,
-                                                        uplo,
-                                                        n,
-                                                        nrhs,
-                                                        (hipDoubleComplex**)A,
-                                                        lda,
-                                                        (hipDoubleComplex**)B,
-                                                        ldb,
-                                                        lwork,
-                                                        bc);
+        return hipsolverZpotri_bufferSizeFortran(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
-                                         int                 nrhs,
-                                         float*              A[],
+                                         float*              A,
                                          int                 lda,
                                          int                 stA,
-                                         float*              B[],
-                                         int                 ldb,
-                                         int                 stB,
                                          float*              work,
                                          int                 lwork,
                                          int*                info,
@@ -6563,28 +8127,21 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+        return hipsolverSpotri(handle, uplo, n, A, lda, work, lwork, info);
     case API_FORTRAN:
-        return hipsolverSpotrsBatchedFortran(
-            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
+        return hipsolverSpotriFortran(handle, uplo, n, A, lda, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
-                                         int                 nrhs,
-                                         double*             A[],
+                                         double*             A,
                                          int                 lda,
                                          int                 stA,
-                                         double*             B[],
-                                         int                 ldb,
-                                         int                 stB,
                                          double*             work,
                                          int                 lwork,
                                          int*                info,
@@ -6593,28 +8150,21 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+        return hipsolverDpotri(handle, uplo, n, A, lda, work, lwork, info);
     case API_FORTRAN:
-        return hipsolverDpotrsBatchedFortran(
-            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
+        return hipsolverDpotriFortran(handle, uplo, n, A, lda, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
-                                         int                 nrhs,
-                                         hipsolverComplex*   A[],
+                                         hipsolverComplex*   A,
                                          int                 lda,
                                          int                 stA,
-                                         hipsolverComplex*   B[],
-                                         int                 ldb,
-                                         int                 stB,
                                          hipsolverComplex*   work,
                                          int                 lwork,
                                          int*                info,
@@ -6623,50 +8173,23 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCpotrsBatched(handle,
-                                      uplo,
-                                      n,
-                                      nrhs,
-                                      (hipFloatComplex**)A,
-                                      lda,
-                                      (hipFloatComplex**)B,
-                                      ldb,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info,
-                                      bc);
+        return hipsolverCpotri(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
     case API_FORTRAN:
-        return hipsolverCpotrsBatchedFortran(handle,
-                                             uplo,
-                                             n,
-                                             nrhs,
-                                             (hipFloatComplex**)A,
-                                             lda,
-                                             (hipFloatComplex**)B,
-                                             ldb,
-                                             (hipFloatComplex*)work,
-                                             lwork,
-                                             info,
-                                             bc);
-    case API_COMPAT:
-        return hipsolverDnCpotrsBatched(
-            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, info, bc);
+        return hipsolverCpotriFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_potri(testAPI_t               API,
                                          hipsolverHandle_t       handle,
                                          hipsolverFillMode_t     uplo,
                                          int                     n,
-                                         int                     nrhs,
-                                         hipsolverDoubleComplex* A[],
+                                         hipsolverDoubleComplex* A,
                                          int                     lda,
                                          int                     stA,
-                                         hipsolverDoubleComplex* B[],
-                                         int                     ldb,
-                                         int                     stB,
                                          hipsolverDoubleComplex* work,
                                          int                     lwork,
                                          int*                    info,
@@ -6675,701 +8198,658 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZpotrsBatched(handle,
-                                      uplo,
-                                      n,
-                                      nrhs,
-                                      (hipDoubleComplex**)A,
-                                      lda,
-                                      (hipDoubleComplex**)B,
-                                      ldb,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info,
-                                      bc);
+        return hipsolverZpotri(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
     case API_FORTRAN:
-        return hipsolverZpotrsBatchedFortran(handle,
-                                             uplo,
-                                             n,
-                                             nrhs,
-                                             (hipDoubleComplex**)A,
-                                             lda,
-                                             (hipDoubleComplex**)B,
-                                             ldb,
-                                             (hipDoubleComplex*)work,
-                                             lwork,
-                                             info,
-                                             bc);
-    case API_COMPAT:
-        return hipsolverDnZpotrsBatched(handle,
-                                        uplo,
-                                        n,
-                                        nrhs,
-                                        (hipDoubleComplex**)A,
-                                        lda,
-                                        (hipDoubleComplex**)B,
-                                        ldb,
-                                        info,
-                                        bc);
+        return hipsolverZpotriFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 /********************************************************/
 
-/******************** SYEVD/HEEVD ********************/
+/******************** POTRS ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverEigMode_t  jobz,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          float*              A,
-                                                          int                 lda,
-                                                          float*              W,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    float*              B,
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork);
+        return hipsolverSpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
     case API_FORTRAN:
-        return hipsolverSsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork);
+        return hipsolverSpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverEigMode_t  jobz,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          double*             A,
-                                                          int                 lda,
-                                                          double*             W,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    double*             B,
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork);
+        return hipsolverDpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
     case API_FORTRAN:
-        return hipsolverDsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork);
+        return hipsolverDpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverEigMode_t  jobz,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          hipsolverComplex*   A,
-                                                          int                 lda,
-                                                          float*              W,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    hipsolverComplex*   B,
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCheevd_bufferSize(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork);
+        return hipsolverCpotrs_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
     case API_FORTRAN:
-        return hipsolverCheevd_bufferSizeFortran(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork);
+        return hipsolverCpotrs_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t               API,
-                                                          hipsolverHandle_t       handle,
-                                                          hipsolverEigMode_t      jobz,
-                                                          hipsolverFillMode_t     uplo,
-                                                          int                     n,
-                                                          hipsolverDoubleComplex* A,
-                                                          int                     lda,
-                                                          double*                 W,
-                                                          int*                    lwork)
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int*                    lwork,
+                                                    int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZheevd_bufferSize(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork);
+        return hipsolverZpotrs_bufferSize(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
     case API_FORTRAN:
-        return hipsolverZheevd_bufferSizeFortran(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork);
+        return hipsolverZpotrs_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverEigMode_t  jobz,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               float*              A,
-                                               int                 lda,
-                                               int                 stA,
-                                               float*              W,
-                                               int                 stW,
-                                               float*              work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSsyevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info);
+        return hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
     case API_FORTRAN:
-        return hipsolverSsyevdFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info);
+        return hipsolverSpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverEigMode_t  jobz,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               double*             A,
-                                               int                 lda,
-                                               int                 stA,
-                                               double*             W,
-                                               int                 stW,
-                                               double*             work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDsyevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info);
+        return hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
     case API_FORTRAN:
-        return hipsolverDsyevdFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info);
+        return hipsolverDpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverEigMode_t  jobz,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               hipsolverComplex*   A,
-                                               int                 lda,
-                                               int                 stA,
-                                               float*              W,
-                                               int                 stW,
-                                               hipsolverComplex*   work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCheevd(handle,
-                               jobz,
+        return hipsolverCpotrs(handle,
                                uplo,
                                n,
+                               nrhs,
                                (hipFloatComplex*)A,
                                lda,
-                               W,
+                               (hipFloatComplex*)B,
+                               ldb,
                                (hipFloatComplex*)work,
                                lwork,
                                info);
     case API_FORTRAN:
-        return hipsolverCheevdFortran(handle,
-                                      jobz,
+        return hipsolverCpotrsFortran(handle,
                                       uplo,
                                       n,
+                                      nrhs,
                                       (hipFloatComplex*)A,
                                       lda,
-                                      W,
+                                      (hipFloatComplex*)B,
+                                      ldb,
                                       (hipFloatComplex*)work,
                                       lwork,
                                       info);
+    case API_COMPAT:
+        return hipsolverDnCpotrs(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t               API,
-                                               hipsolverHandle_t       handle,
-                                               hipsolverEigMode_t      jobz,
-                                               hipsolverFillMode_t     uplo,
-                                               int                     n,
-                                               hipsolverDoubleComplex* A,
-                                               int                     lda,
-                                               int                     stA,
-                                               double*                 W,
-                                               int                     stW,
-                                               hipsolverDoubleComplex* work,
-                                               int                     lwork,
-                                               int*                    info,
-                                               int                     bc)
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZheevd(handle,
-                               jobz,
+        return hipsolverZpotrs(handle,
                                uplo,
                                n,
+                               nrhs,
                                (hipDoubleComplex*)A,
                                lda,
-                               W,
+                               (hipDoubleComplex*)B,
+                               ldb,
                                (hipDoubleComplex*)work,
                                lwork,
                                info);
     case API_FORTRAN:
-        return hipsolverZheevdFortran(handle,
-                                      jobz,
+        return hipsolverZpotrsFortran(handle,
                                       uplo,
                                       n,
+                                      nrhs,
                                       (hipDoubleComplex*)A,
                                       lda,
-                                      W,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
                                       (hipDoubleComplex*)work,
                                       lwork,
                                       info);
+    case API_COMPAT:
+        return hipsolverDnZpotrs(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
 
-/******************** SYEVDX/HEEVDX ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
-                                                            hipsolverHandle_t   handle,
-                                                            hipsolverEigMode_t  jobz,
-                                                            hipsolverEigRange_t range,
-                                                            hipsolverFillMode_t uplo,
-                                                            int                 n,
-                                                            float*              A,
-                                                            int                 lda,
-                                                            float               vl,
-                                                            float               vu,
-                                                            int                 il,
-                                                            int                 iu,
-                                                            int*                nev,
-                                                            float*              W,
-                                                            int*                lwork)
+// batched
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    float*              B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSsyevdx_bufferSize(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
-    case API_COMPAT:
-        return hipsolverDnSsyevdx_bufferSize(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+        return hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrsBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
-                                                            hipsolverHandle_t   handle,
-                                                            hipsolverEigMode_t  jobz,
-                                                            hipsolverEigRange_t range,
-                                                            hipsolverFillMode_t uplo,
-                                                            int                 n,
-                                                            double*             A,
-                                                            int                 lda,
-                                                            double              vl,
-                                                            double              vu,
-                                                            int                 il,
-                                                            int                 iu,
-                                                            int*                nev,
-                                                            double*             W,
-                                                            int*                lwork)
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    double*             B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDsyevdx_bufferSize(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
-    case API_COMPAT:
-        return hipsolverDnDsyevdx_bufferSize(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+        return hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrsBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
-                                                            hipsolverHandle_t   handle,
-                                                            hipsolverEigMode_t  jobz,
-                                                            hipsolverEigRange_t range,
-                                                            hipsolverFillMode_t uplo,
-                                                            int                 n,
-                                                            hipsolverComplex*   A,
-                                                            int                 lda,
-                                                            float               vl,
-                                                            float               vu,
-                                                            int                 il,
-                                                            int                 iu,
-                                                            int*                nev,
-                                                            float*              W,
-                                                            int*                lwork)
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   A[],
+                                                    int                 lda,
+                                                    hipsolverComplex*   B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCheevdx_bufferSize(
-            handle, jobz, range, uplo, n, (hipFloatComplex*)A, lda, vl, vu, il, iu, nev, W, lwork);
-    case API_COMPAT:
-        return hipsolverDnCheevdx_bufferSize(
-            handle, jobz, range, uplo, n, (hipFloatComplex*)A, lda, vl, vu, il, iu, nev, W, lwork);
+        return hipsolverCpotrsBatched_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverCpotrsBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t               API,
-                                                            hipsolverHandle_t       handle,
-                                                            hipsolverEigMode_t      jobz,
-                                                            hipsolverEigRange_t     range,
-                                                            hipsolverFillMode_t     uplo,
-                                                            int                     n,
-                                                            hipsolverDoubleComplex* A,
-                                                            int                     lda,
-                                                            double                  vl,
-                                                            double                  vu,
-                                                            int                     il,
-                                                            int                     iu,
-                                                            int*                    nev,
-                                                            double*                 W,
-                                                            int*                    lwork)
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    hipsolverDoubleComplex* B[],
+                                                    int                     ldb,
+                                                    int*                    lwork,
+                                                    int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZheevdx_bufferSize(
-            handle, jobz, range, uplo, n, (hipDoubleComplex*)A, lda, vl, vu, il, iu, nev, W, lwork);
-    case API_COMPAT:
-        return hipsolverDnZheevdx_bufferSize(
-            handle, jobz, range, uplo, n, (hipDoubleComplex*)A, lda, vl, vu, il, iu, nev, W, lwork);
-    default:
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
-}
-
-inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
-                                                 hipsolverHandle_t   handle,
-                                                 hipsolverEigMode_t  jobz,
-                                                 hipsolverEigRange_t range,
-                                                 hipsolverFillMode_t uplo,
-                                                 int                 n,
-                                                 float*              A,
-                                                 int                 lda,
-                                                 int                 stA,
-                                                 float               vl,
-                                                 float               vu,
-                                                 int                 il,
-                                                 int                 iu,
-                                                 int*                nev,
-                                                 float*              W,
-                                                 int                 stW,
-                                                 float*              work,
-                                                 int                 lwork,
-                                                 int*                info,
-                                                 int                 bc)
-{
-    switch(API)
-    {
-    case API_NORMAL:
-        return hipsolverSsyevdx(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnSsyevdx(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
+        return hipsolverZpotrsBatched_bufferSize(handle,
+                                                 uplo,
+                                                 n,
+                                                 nrhs,
+                                                 (hipDoubleComplex**)A,
+                                                 lda,
+                                                 (hipDoubleComplex**)B,
+                                                 ldb,
+                                                 lwork,
+                                                 bc);
+    case API_FORTRAN:
+        return hipsolverZpotrsBatched_bufferSizeFortran(handle,
+                                                        uplo,
+                                                        n,
+                                                        nrhs,
+                                                        (hipDoubleComplex**)A,
+                                                        lda,
+                                                        (hipDoubleComplex**)B,
+                                                        ldb,
+                                                        lwork,
+                                                        bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
-                                                 hipsolverHandle_t   handle,
-                                                 hipsolverEigMode_t  jobz,
-                                                 hipsolverEigRange_t range,
-                                                 hipsolverFillMode_t uplo,
-                                                 int                 n,
-                                                 double*             A,
-                                                 int                 lda,
-                                                 int                 stA,
-                                                 double              vl,
-                                                 double              vu,
-                                                 int                 il,
-                                                 int                 iu,
-                                                 int*                nev,
-                                                 double*             W,
-                                                 int                 stW,
-                                                 double*             work,
-                                                 int                 lwork,
-                                                 int*                info,
-                                                 int                 bc)
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDsyevdx(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
+        return hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrsBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
     case API_COMPAT:
-        return hipsolverDnDsyevdx(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
+        return hipsolverDnSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
-                                                 hipsolverHandle_t   handle,
-                                                 hipsolverEigMode_t  jobz,
-                                                 hipsolverEigRange_t range,
-                                                 hipsolverFillMode_t uplo,
-                                                 int                 n,
-                                                 hipsolverComplex*   A,
-                                                 int                 lda,
-                                                 int                 stA,
-                                                 float               vl,
-                                                 float               vu,
-                                                 int                 il,
-                                                 int                 iu,
-                                                 int*                nev,
-                                                 float*              W,
-                                                 int                 stW,
-                                                 hipsolverComplex*   work,
-                                                 int                 lwork,
-                                                 int*                info,
-                                                 int                 bc)
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCheevdx(handle,
-                                jobz,
-                                range,
-                                uplo,
-                                n,
-                                (hipFloatComplex*)A,
-                                lda,
-                                vl,
-                                vu,
-                                il,
-                                iu,
-                                nev,
-                                W,
-                                (hipFloatComplex*)work,
-                                lwork,
-                                info);
+        return hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrsBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
     case API_COMPAT:
-        return hipsolverDnCheevdx(handle,
-                                  jobz,
-                                  range,
-                                  uplo,
-                                  n,
-                                  (hipFloatComplex*)A,
-                                  lda,
-                                  vl,
-                                  vu,
-                                  il,
-                                  iu,
-                                  nev,
-                                  W,
-                                  (hipFloatComplex*)work,
-                                  lwork,
-                                  info);
+        return hipsolverDnDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t               API,
-                                                 hipsolverHandle_t       handle,
-                                                 hipsolverEigMode_t      jobz,
-                                                 hipsolverEigRange_t     range,
-                                                 hipsolverFillMode_t     uplo,
-                                                 int                     n,
-                                                 hipsolverDoubleComplex* A,
-                                                 int                     lda,
-                                                 int                     stA,
-                                                 double                  vl,
-                                                 double                  vu,
-                                                 int                     il,
-                                                 int                     iu,
-                                                 int*                    nev,
-                                                 double*                 W,
-                                                 int                     stW,
-                                                 hipsolverDoubleComplex* work,
-                                                 int                     lwork,
-                                                 int*                    info,
-                                                 int                     bc)
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZheevdx(handle,
-                                jobz,
-                                range,
-                                uplo,
-                                n,
-                                (hipDoubleComplex*)A,
-                                lda,
-                                vl,
-                                vu,
-                                il,
-                                iu,
-                                nev,
-                                W,
-                                (hipDoubleComplex*)work,
-                                lwork,
-                                info);
+        return hipsolverCpotrsBatched(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      (hipFloatComplex**)A,
+                                      lda,
+                                      (hipFloatComplex**)B,
+                                      ldb,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
+    case API_FORTRAN:
+        return hipsolverCpotrsBatchedFortran(handle,
+                                             uplo,
+                                             n,
+                                             nrhs,
+                                             (hipFloatComplex**)A,
+                                             lda,
+                                             (hipFloatComplex**)B,
+                                             ldb,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
     case API_COMPAT:
-        return hipsolverDnZheevdx(handle,
-                                  jobz,
-                                  range,
-                                  uplo,
-                                  n,
-                                  (hipDoubleComplex*)A,
-                                  lda,
-                                  vl,
-                                  vu,
-                                  il,
-                                  iu,
-                                  nev,
-                                  W,
-                                  (hipDoubleComplex*)work,
-                                  lwork,
-                                  info);
+        return hipsolverDnCpotrsBatched(
+            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
 
-/******************** SYEVJ/HEEVJ ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
-                                                          bool                 STRIDED,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverEigMode_t   jobz,
-                                                          hipsolverFillMode_t  uplo,
-                                                          int                  n,
-                                                          float*               A,
-                                                          int                  lda,
-                                                          float*               W,
-                                                          int*                 lwork,
-                                                          hipsolverSyevjInfo_t params,
-                                                          int                  bc)
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A[],
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* B[],
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrsBatched(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      (hipDoubleComplex**)A,
+                                      lda,
+                                      (hipDoubleComplex**)B,
+                                      ldb,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
+    case API_FORTRAN:
+        return hipsolverZpotrsBatchedFortran(handle,
+                                             uplo,
+                                             n,
+                                             nrhs,
+                                             (hipDoubleComplex**)A,
+                                             lda,
+                                             (hipDoubleComplex**)B,
+                                             ldb,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case API_COMPAT:
+        return hipsolverDnZpotrsBatched(handle,
+                                        uplo,
+                                        n,
+                                        nrhs,
+                                        (hipDoubleComplex**)A,
+                                        lda,
+                                        (hipDoubleComplex**)B,
+                                        ldb,
+                                        info,
+                                        bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYEVD/HEEVD ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          float*              W,
+                                                          int                 stW,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
     switch(api2marshal(API, STRIDED))
     {
     case C_NORMAL:
-        return hipsolverSsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+        return hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork);
     case C_NORMAL_ALT:
-        return hipsolverSsyevjBatched_bufferSize(
-            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+        return hipsolverSsyevdStridedBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, stA, W, stW, lwork, bc);
     case FORTRAN_NORMAL:
-        return hipsolverSsyevj_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork, params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverSsyevjBatched_bufferSizeFortran(
-            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnSsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnSsyevjBatched_bufferSize(
-            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+        return hipsolverSsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
-                                                          bool                 STRIDED,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverEigMode_t   jobz,
-                                                          hipsolverFillMode_t  uplo,
-                                                          int                  n,
-                                                          double*              A,
-                                                          int                  lda,
-                                                          double*              W,
-                                                          int*                 lwork,
-                                                          hipsolverSyevjInfo_t params,
-                                                          int                  bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          double*             W,
+                                                          int                 stW,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
     switch(api2marshal(API, STRIDED))
     {
     case C_NORMAL:
-        return hipsolverDsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+        return hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork);
     case C_NORMAL_ALT:
-        return hipsolverDsyevjBatched_bufferSize(
-            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+        return hipsolverDsyevdStridedBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, stA, W, stW, lwork, bc);
     case FORTRAN_NORMAL:
-        return hipsolverDsyevj_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork, params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverDsyevjBatched_bufferSizeFortran(
-            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnDsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnDsyevjBatched_bufferSize(
-            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+        return hipsolverDsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
-                                                          bool                 STRIDED,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverEigMode_t   jobz,
-                                                          hipsolverFillMode_t  uplo,
-                                                          int                  n,
-                                                          hipsolverComplex*    A,
-                                                          int                  lda,
-                                                          float*               W,
-                                                          int*                 lwork,
-                                                          hipsolverSyevjInfo_t params,
-                                                          int                  bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          float*              W,
+                                                          int                 stW,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
     switch(api2marshal(API, STRIDED))
     {
     case C_NORMAL:
-        return hipsolverCheevj_bufferSize(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params);
+        return hipsolverCheevd_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork);
     case C_NORMAL_ALT:
-        return hipsolverCheevjBatched_bufferSize(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params, bc);
+        return hipsolverCheevdStridedBatched_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, stA, W, stW, lwork, bc);
     case FORTRAN_NORMAL:
-        return hipsolverCheevj_bufferSizeFortran(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverCheevjBatched_bufferSizeFortran(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params, bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnCheevj_bufferSize(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnCheevjBatched_bufferSize(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params, bc);
+        return hipsolverCheevd_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t               API,
                                                           bool                    STRIDED,
                                                           hipsolverHandle_t       handle,
                                                           hipsolverEigMode_t      jobz,
@@ -7377,135 +8857,108 @@ inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t
                                                           int                     n,
                                                           hipsolverDoubleComplex* A,
                                                           int                     lda,
+                                                          int                     stA,
                                                           double*                 W,
+                                                          int                     stW,
                                                           int*                    lwork,
-                                                          hipsolverSyevjInfo_t    params,
                                                           int                     bc)
 {
     switch(api2marshal(API, STRIDED))
     {
     case C_NORMAL:
-        return hipsolverZheevj_bufferSize(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params);
+        return hipsolverZheevd_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork);
     case C_NORMAL_ALT:
-        return hipsolverZheevjBatched_bufferSize(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params, bc);
+        return hipsolverZheevdStridedBatched_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, stA, W, stW, lwork, bc);
     case FORTRAN_NORMAL:
-        return hipsolverZheevj_bufferSizeFortran(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverZheevjBatched_bufferSizeFortran(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params, bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnZheevj_bufferSize(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnZheevjBatched_bufferSize(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params, bc);
+        return hipsolverZheevd_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
-                                               bool                 STRIDED,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverEigMode_t   jobz,
-                                               hipsolverFillMode_t  uplo,
-                                               int                  n,
-                                               float*               A,
-                                               int                  lda,
-                                               int                  stA,
-                                               float*               W,
-                                               int                  stW,
-                                               float*               work,
-                                               int                  lwork,
-                                               int*                 info,
-                                               hipsolverSyevjInfo_t params,
-                                               int                  bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              W,
+                                               int                 stW,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
     switch(api2marshal(API, STRIDED))
     {
     case C_NORMAL:
-        return hipsolverSsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+        return hipsolverSsyevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info);
     case C_NORMAL_ALT:
-        return hipsolverSsyevjBatched(
-            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+        return hipsolverSsyevdStridedBatched(
+            handle, jobz, uplo, n, A, lda, stA, W, stW, work, lwork, info, bc);
     case FORTRAN_NORMAL:
-        return hipsolverSsyevjFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverSsyevjBatchedFortran(
-            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnSsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnSsyevjBatched(
-            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+        return hipsolverSsyevdFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
-                                               bool                 STRIDED,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverEigMode_t   jobz,
-                                               hipsolverFillMode_t  uplo,
-                                               int                  n,
-                                               double*              A,
-                                               int                  lda,
-                                               int                  stA,
-                                               double*              W,
-                                               int                  stW,
-                                               double*              work,
-                                               int                  lwork,
-                                               int*                 info,
-                                               hipsolverSyevjInfo_t params,
-                                               int                  bc)
-{
-    switch(api2marshal(API, STRIDED))
-    {
-    case C_NORMAL:
-        return hipsolverDsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 stA,
+                                               double*             W,
+                                               int                 stW,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info);
     case C_NORMAL_ALT:
-        return hipsolverDsyevjBatched(
-            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+        return hipsolverDsyevdStridedBatched(
+            handle, jobz, uplo, n, A, lda, stA, W, stW, work, lwork, info, bc);
     case FORTRAN_NORMAL:
-        return hipsolverDsyevjFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverDsyevjBatchedFortran(
-            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnDsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnDsyevjBatched(
-            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+        return hipsolverDsyevdFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
-                                               bool                 STRIDED,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverEigMode_t   jobz,
-                                               hipsolverFillMode_t  uplo,
-                                               int                  n,
-                                               hipsolverComplex*    A,
-                                               int                  lda,
-                                               int                  stA,
-                                               float*               W,
-                                               int                  stW,
-                                               hipsolverComplex*    work,
-                                               int                  lwork,
-                                               int*                 info,
-                                               hipsolverSyevjInfo_t params,
-                                               int                  bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipsolverComplex*   A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              W,
+                                               int                 stW,
+                                               hipsolverComplex*   work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
     switch(api2marshal(API, STRIDED))
     {
     case C_NORMAL:
-        return hipsolverCheevj(handle,
+        return hipsolverCheevd(handle,
                                jobz,
                                uplo,
                                n,
@@ -7514,77 +8967,38 @@ inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
                                W,
                                (hipFloatComplex*)work,
                                lwork,
-                               info,
-                               params);
+                               info);
     case C_NORMAL_ALT:
-        return hipsolverCheevjBatched(handle,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      W,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info,
-                                      params,
-                                      bc);
-    case FORTRAN_NORMAL:
-        return hipsolverCheevjFortran(handle,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      W,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info,
-                                      params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverCheevjBatchedFortran(handle,
+        return hipsolverCheevdStridedBatched(handle,
                                              jobz,
                                              uplo,
                                              n,
                                              (hipFloatComplex*)A,
                                              lda,
+                                             stA,
                                              W,
+                                             stW,
                                              (hipFloatComplex*)work,
                                              lwork,
                                              info,
-                                             params,
                                              bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnCheevj(handle,
-                                 jobz,
-                                 uplo,
-                                 n,
-                                 (hipFloatComplex*)A,
-                                 lda,
-                                 W,
-                                 (hipFloatComplex*)work,
-                                 lwork,
-                                 info,
-                                 params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnCheevjBatched(handle,
-                                        jobz,
-                                        uplo,
-                                        n,
-                                        (hipFloatComplex*)A,
-                                        lda,
-                                        W,
-                                        (hipFloatComplex*)work,
-                                        lwork,
-                                        info,
-                                        params,
-                                        bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCheevdFortran(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      W,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t               API,
                                                bool                    STRIDED,
                                                hipsolverHandle_t       handle,
                                                hipsolverEigMode_t      jobz,
@@ -7598,13 +9012,12 @@ inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t               API,
                                                hipsolverDoubleComplex* work,
                                                int                     lwork,
                                                int*                    info,
-                                               hipsolverSyevjInfo_t    params,
                                                int                     bc)
 {
     switch(api2marshal(API, STRIDED))
     {
     case C_NORMAL:
-        return hipsolverZheevj(handle,
+        return hipsolverZheevd(handle,
                                jobz,
                                uplo,
                                n,
@@ -7613,723 +9026,1919 @@ inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t               API,
                                W,
                                (hipDoubleComplex*)work,
                                lwork,
-                               info,
-                               params);
+                               info);
     case C_NORMAL_ALT:
-        return hipsolverZheevjBatched(handle,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      W,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info,
-                                      params,
-                                      bc);
-    case FORTRAN_NORMAL:
-        return hipsolverZheevjFortran(handle,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      W,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info,
-                                      params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverZheevjBatchedFortran(handle,
+        return hipsolverZheevdStridedBatched(handle,
                                              jobz,
                                              uplo,
                                              n,
                                              (hipDoubleComplex*)A,
                                              lda,
+                                             stA,
                                              W,
+                                             stW,
                                              (hipDoubleComplex*)work,
                                              lwork,
                                              info,
-                                             params,
                                              bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnZheevj(handle,
-                                 jobz,
-                                 uplo,
-                                 n,
-                                 (hipDoubleComplex*)A,
-                                 lda,
-                                 W,
-                                 (hipDoubleComplex*)work,
-                                 lwork,
-                                 info,
-                                 params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnZheevjBatched(handle,
-                                        jobz,
-                                        uplo,
-                                        n,
-                                        (hipDoubleComplex*)A,
-                                        lda,
-                                        W,
-                                        (hipDoubleComplex*)work,
-                                        lwork,
-                                        info,
-                                        params,
-                                        bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZheevdFortran(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      W,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 /********************************************************/
 
-/******************** SYGVD/HEGVD ********************/
+/******************** SYEVDX/HEEVDX ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverEigType_t  itype,
-                                                          hipsolverEigMode_t  jobz,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          float*              A,
-                                                          int                 lda,
-                                                          float*              B,
-                                                          int                 ldb,
-                                                          float*              W,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            float*              A,
+                                                            int                 lda,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            float*              W,
+                                                            int*                lwork)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
-    case API_FORTRAN:
-        return hipsolverSsygvd_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+        return hipsolverSsyevdx_bufferSize(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+    case API_COMPAT:
+        return hipsolverDnSsyevdx_bufferSize(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverEigType_t  itype,
-                                                          hipsolverEigMode_t  jobz,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          double*             A,
-                                                          int                 lda,
-                                                          double*             B,
-                                                          int                 ldb,
-                                                          double*             W,
-                                                          int*                lwork)
-{
-    switch(API)
-    {
-    case API_NORMAL:
-        return hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
-    case API_FORTRAN:
-        return hipsolverDsygvd_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            double*             A,
+                                                            int                 lda,
+                                                            double              vl,
+                                                            double              vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            double*             W,
+                                                            int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsyevdx_bufferSize(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+    case API_COMPAT:
+        return hipsolverDnDsyevdx_bufferSize(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverEigType_t  itype,
-                                                          hipsolverEigMode_t  jobz,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          hipsolverComplex*   A,
-                                                          int                 lda,
-                                                          hipsolverComplex*   B,
-                                                          int                 ldb,
-                                                          float*              W,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipsolverComplex*   A,
+                                                            int                 lda,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            float*              W,
+                                                            int*                lwork)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverChegvd_bufferSize(handle,
-                                          itype,
-                                          jobz,
-                                          uplo,
-                                          n,
-                                          (hipFloatComplex*)A,
-                                          lda,
-                                          (hipFloatComplex*)B,
-                                          ldb,
-                                          W,
-                                          lwork);
-    case API_FORTRAN:
-        return hipsolverChegvd_bufferSizeFortran(handle,
-                                                 itype,
-                                                 jobz,
-                                                 uplo,
-                                                 n,
-                                                 (hipFloatComplex*)A,
-                                                 lda,
-                                                 (hipFloatComplex*)B,
-                                                 ldb,
-                                                 W,
-                                                 lwork);
+        return hipsolverCheevdx_bufferSize(
+            handle, jobz, range, uplo, n, (hipFloatComplex*)A, lda, vl, vu, il, iu, nev, W, lwork);
+    case API_COMPAT:
+        return hipsolverDnCheevdx_bufferSize(
+            handle, jobz, range, uplo, n, (hipFloatComplex*)A, lda, vl, vu, il, iu, nev, W, lwork);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t               API,
-                                                          hipsolverHandle_t       handle,
-                                                          hipsolverEigType_t      itype,
-                                                          hipsolverEigMode_t      jobz,
-                                                          hipsolverFillMode_t     uplo,
-                                                          int                     n,
-                                                          hipsolverDoubleComplex* A,
-                                                          int                     lda,
-                                                          hipsolverDoubleComplex* B,
-                                                          int                     ldb,
-                                                          double*                 W,
-                                                          int*                    lwork)
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t               API,
+                                                            hipsolverHandle_t       handle,
+                                                            hipsolverEigMode_t      jobz,
+                                                            hipsolverEigRange_t     range,
+                                                            hipsolverFillMode_t     uplo,
+                                                            int                     n,
+                                                            hipsolverDoubleComplex* A,
+                                                            int                     lda,
+                                                            double                  vl,
+                                                            double                  vu,
+                                                            int                     il,
+                                                            int                     iu,
+                                                            int*                    nev,
+                                                            double*                 W,
+                                                            int*                    lwork)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZhegvd_bufferSize(handle,
-                                          itype,
-                                          jobz,
-                                          uplo,
-                                          n,
-                                          (hipDoubleComplex*)A,
-                                          lda,
-                                          (hipDoubleComplex*)B,
-                                          ldb,
-                                          W,
-                                          lwork);
-    case API_FORTRAN:
-        return hipsolverZhegvd_bufferSizeFortran(handle,
-                                                 itype,
-                                                 jobz,
-                                                 uplo,
-                                                 n,
-                                                 (hipDoubleComplex*)A,
-                                                 lda,
-                                                 (hipDoubleComplex*)B,
-                                                 ldb,
-                                                 W,
-                                                 lwork);
+        return hipsolverZheevdx_bufferSize(
+            handle, jobz, range, uplo, n, (hipDoubleComplex*)A, lda, vl, vu, il, iu, nev, W, lwork);
+    case API_COMPAT:
+        return hipsolverDnZheevdx_bufferSize(
+            handle, jobz, range, uplo, n, (hipDoubleComplex*)A, lda, vl, vu, il, iu, nev, W, lwork);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverEigType_t  itype,
-                                               hipsolverEigMode_t  jobz,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               float*              A,
-                                               int                 lda,
-                                               int                 stA,
-                                               float*              B,
-                                               int                 ldb,
-                                               int                 stB,
-                                               float*              W,
-                                               int                 stW,
-                                               float*              work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 float*              A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 float*              W,
+                                                 int                 stW,
+                                                 float*              work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSsygvdFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+        return hipsolverSsyevdx(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnSsyevdx(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverEigType_t  itype,
-                                               hipsolverEigMode_t  jobz,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               double*             A,
-                                               int                 lda,
-                                               int                 stA,
-                                               double*             B,
-                                               int                 ldb,
-                                               int                 stB,
-                                               double*             W,
-                                               int                 stW,
-                                               double*             work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 double*             A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 double              vl,
+                                                 double              vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 double*             W,
+                                                 int                 stW,
+                                                 double*             work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDsygvdFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+        return hipsolverDsyevdx(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnDsyevdx(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverEigType_t  itype,
-                                               hipsolverEigMode_t  jobz,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               hipsolverComplex*   A,
-                                               int                 lda,
-                                               int                 stA,
-                                               hipsolverComplex*   B,
-                                               int                 ldb,
-                                               int                 stB,
-                                               float*              W,
-                                               int                 stW,
-                                               hipsolverComplex*   work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
-{
-    switch(API)
-    {
-    case API_NORMAL:
-        return hipsolverChegvd(handle,
-                               itype,
-                               jobz,
-                               uplo,
-                               n,
-                               (hipFloatComplex*)A,
-                               lda,
-                               (hipFloatComplex*)B,
-                               ldb,
-                               W,
-                               (hipFloatComplex*)work,
-                               lwork,
-                               info);
-    case API_FORTRAN:
-        return hipsolverChegvdFortran(handle,
-                                      itype,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      (hipFloatComplex*)B,
-                                      ldb,
-                                      W,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info);
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 hipsolverComplex*   A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 float*              W,
+                                                 int                 stW,
+                                                 hipsolverComplex*   work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCheevdx(handle,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                (hipFloatComplex*)A,
+                                lda,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                (hipFloatComplex*)work,
+                                lwork,
+                                info);
+    case API_COMPAT:
+        return hipsolverDnCheevdx(handle,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  (hipFloatComplex*)A,
+                                  lda,
+                                  vl,
+                                  vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  W,
+                                  (hipFloatComplex*)work,
+                                  lwork,
+                                  info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t               API,
-                                               hipsolverHandle_t       handle,
-                                               hipsolverEigType_t      itype,
-                                               hipsolverEigMode_t      jobz,
-                                               hipsolverFillMode_t     uplo,
-                                               int                     n,
-                                               hipsolverDoubleComplex* A,
-                                               int                     lda,
-                                               int                     stA,
-                                               hipsolverDoubleComplex* B,
-                                               int                     ldb,
-                                               int                     stB,
-                                               double*                 W,
-                                               int                     stW,
-                                               hipsolverDoubleComplex* work,
-                                               int                     lwork,
-                                               int*                    info,
-                                               int                     bc)
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t               API,
+                                                 hipsolverHandle_t       handle,
+                                                 hipsolverEigMode_t      jobz,
+                                                 hipsolverEigRange_t     range,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* A,
+                                                 int                     lda,
+                                                 int                     stA,
+                                                 double                  vl,
+                                                 double                  vu,
+                                                 int                     il,
+                                                 int                     iu,
+                                                 int*                    nev,
+                                                 double*                 W,
+                                                 int                     stW,
+                                                 hipsolverDoubleComplex* work,
+                                                 int                     lwork,
+                                                 int*                    info,
+                                                 int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZhegvd(handle,
-                               itype,
-                               jobz,
-                               uplo,
-                               n,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               (hipDoubleComplex*)B,
-                               ldb,
-                               W,
-                               (hipDoubleComplex*)work,
-                               lwork,
-                               info);
-    case API_FORTRAN:
-        return hipsolverZhegvdFortran(handle,
-                                      itype,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      (hipDoubleComplex*)B,
-                                      ldb,
-                                      W,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info);
+        return hipsolverZheevdx(handle,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                (hipDoubleComplex*)A,
+                                lda,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                (hipDoubleComplex*)work,
+                                lwork,
+                                info);
+    case API_COMPAT:
+        return hipsolverDnZheevdx(handle,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  (hipDoubleComplex*)A,
+                                  lda,
+                                  vl,
+                                  vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  W,
+                                  (hipDoubleComplex*)work,
+                                  lwork,
+                                  info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 /********************************************************/
 
-/******************** SYGVDX/HEGVDX ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t           API,
-                                                            hipsolverHandle_t   handle,
-                                                            hipsolverEigType_t  itype,
-                                                            hipsolverEigMode_t  jobz,
-                                                            hipsolverEigRange_t range,
-                                                            hipsolverFillMode_t uplo,
-                                                            int                 n,
-                                                            float*              A,
-                                                            int                 lda,
-                                                            float*              B,
-                                                            int                 ldb,
-                                                            float               vl,
-                                                            float               vu,
-                                                            int                 il,
-                                                            int                 iu,
-                                                            int*                nev,
-                                                            float*              W,
-                                                            int*                lwork)
+/******************** SYEV_AUTO ********************/
+// strided_batched
+inline hipsolverStatus_t hipsolver_syev_auto_bufferSize(testAPI_t           API,
+                                                        hipsolverHandle_t   handle,
+                                                        hipsolverDnParams_t params,
+                                                        hipsolverEigMode_t  jobz,
+                                                        hipsolverEigRange_t range,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        float*              A,
+                                                        int                 lda,
+                                                        int                 stA,
+                                                        int                 il,
+                                                        int                 iu,
+                                                        float*              W,
+                                                        int                 stW,
+                                                        size_t*             lworkOnDevice,
+                                                        size_t*             lworkOnHost,
+                                                        int                 bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverSsygvdx_bufferSize(
-            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
     case API_COMPAT:
-        return hipsolverDnSsygvdx_bufferSize(
-            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+        return hipsolverDnXsyevAuto_bufferSize(handle,
+                                               params,
+                                               jobz,
+                                               range,
+                                               uplo,
+                                               n,
+                                               HIP_R_32F,
+                                               A,
+                                               lda,
+                                               stA,
+                                               il,
+                                               iu,
+                                               HIP_R_32F,
+                                               W,
+                                               stW,
+                                               HIP_R_32F,
+                                               lworkOnDevice,
+                                               lworkOnHost,
+                                               bc);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t           API,
-                                                            hipsolverHandle_t   handle,
-                                                            hipsolverEigType_t  itype,
-                                                            hipsolverEigMode_t  jobz,
-                                                            hipsolverEigRange_t range,
-                                                            hipsolverFillMode_t uplo,
-                                                            int                 n,
-                                                            double*             A,
-                                                            int                 lda,
-                                                            double*             B,
-                                                            int                 ldb,
-                                                            double              vl,
-                                                            double              vu,
-                                                            int                 il,
-                                                            int                 iu,
-                                                            int*                nev,
-                                                            double*             W,
-                                                            int*                lwork)
+inline hipsolverStatus_t hipsolver_syev_auto_bufferSize(testAPI_t           API,
+                                                        hipsolverHandle_t   handle,
+                                                        hipsolverDnParams_t params,
+                                                        hipsolverEigMode_t  jobz,
+                                                        hipsolverEigRange_t range,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        double*             A,
+                                                        int                 lda,
+                                                        int                 stA,
+                                                        int                 il,
+                                                        int                 iu,
+                                                        double*             W,
+                                                        int                 stW,
+                                                        size_t*             lworkOnDevice,
+                                                        size_t*             lworkOnHost,
+                                                        int                 bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverDsygvdx_bufferSize(
-            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
     case API_COMPAT:
-        return hipsolverDnDsygvdx_bufferSize(
-            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+        return hipsolverDnXsyevAuto_bufferSize(handle,
+                                               params,
+                                               jobz,
+                                               range,
+                                               uplo,
+                                               n,
+                                               HIP_R_64F,
+                                               A,
+                                               lda,
+                                               stA,
+                                               il,
+                                               iu,
+                                               HIP_R_64F,
+                                               W,
+                                               stW,
+                                               HIP_R_64F,
+                                               lworkOnDevice,
+                                               lworkOnHost,
+                                               bc);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t           API,
-                                                            hipsolverHandle_t   handle,
-                                                            hipsolverEigType_t  itype,
-                                                            hipsolverEigMode_t  jobz,
-                                                            hipsolverEigRange_t range,
-                                                            hipsolverFillMode_t uplo,
-                                                            int                 n,
-                                                            hipsolverComplex*   A,
-                                                            int                 lda,
-                                                            hipsolverComplex*   B,
-                                                            int                 ldb,
-                                                            float               vl,
-                                                            float               vu,
-                                                            int                 il,
-                                                            int                 iu,
-                                                            int*                nev,
-                                                            float*              W,
-                                                            int*                lwork)
+inline hipsolverStatus_t hipsolver_syev_auto_bufferSize(testAPI_t           API,
+                                                        hipsolverHandle_t   handle,
+                                                        hipsolverDnParams_t params,
+                                                        hipsolverEigMode_t  jobz,
+                                                        hipsolverEigRange_t range,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        hipsolverComplex*   A,
+                                                        int                 lda,
+                                                        int                 stA,
+                                                        int                 il,
+                                                        int                 iu,
+                                                        float*              W,
+                                                        int                 stW,
+                                                        size_t*             lworkOnDevice,
+                                                        size_t*             lworkOnHost,
+                                                        int                 bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverChegvdx_bufferSize(handle,
-                                           itype,
-                                           jobz,
-                                           range,
-                                           uplo,
-                                           n,
-                                           (hipFloatComplex*)A,
-                                           lda,
-                                           (hipFloatComplex*)B,
-                                           ldb,
-                                           vl,
-                                           vu,
-                                           il,
-                                           iu,
-                                           nev,
-                                           W,
-                                           lwork);
     case API_COMPAT:
-        return hipsolverDnChegvdx_bufferSize(handle,
-                                             itype,
-                                             jobz,
-                                             range,
-                                             uplo,
-                                             n,
-                                             (hipFloatComplex*)A,
-                                             lda,
-                                             (hipFloatComplex*)B,
-                                             ldb,
-                                             vl,
-                                             vu,
-                                             il,
-                                             iu,
-                                             nev,
-                                             W,
-                                             lwork);
+        return hipsolverDnXsyevAuto_bufferSize(handle,
+                                               params,
+                                               jobz,
+                                               range,
+                                               uplo,
+                                               n,
+                                               HIP_C_32F,
+                                               A,
+                                               lda,
+                                               stA,
+                                               il,
+                                               iu,
+                                               HIP_R_32F,
+                                               W,
+                                               stW,
+                                               HIP_C_32F,
+                                               lworkOnDevice,
+                                               lworkOnHost,
+                                               bc);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t               API,
-                                                            hipsolverHandle_t       handle,
-                                                            hipsolverEigType_t      itype,
-                                                            hipsolverEigMode_t      jobz,
-                                                            hipsolverEigRange_t     range,
-                                                            hipsolverFillMode_t     uplo,
-                                                            int                     n,
-                                                            hipsolverDoubleComplex* A,
-                                                            int                     lda,
-                                                            hipsolverDoubleComplex* B,
-                                                            int                     ldb,
-                                                            double                  vl,
-                                                            double                  vu,
-                                                            int                     il,
-                                                            int                     iu,
-                                                            int*                    nev,
-                                                            double*                 W,
-                                                            int*                    lwork)
+inline hipsolverStatus_t hipsolver_syev_auto_bufferSize(testAPI_t               API,
+                                                        hipsolverHandle_t       handle,
+                                                        hipsolverDnParams_t     params,
+                                                        hipsolverEigMode_t      jobz,
+                                                        hipsolverEigRange_t     range,
+                                                        hipsolverFillMode_t     uplo,
+                                                        int                     n,
+                                                        hipsolverDoubleComplex* A,
+                                                        int                     lda,
+                                                        int                     stA,
+                                                        int                     il,
+                                                        int                     iu,
+                                                        double*                 W,
+                                                        int                     stW,
+                                                        size_t*                 lworkOnDevice,
+                                                        size_t*                 lworkOnHost,
+                                                        int                     bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverZhegvdx_bufferSize(handle,
-                                           itype,
-                                           jobz,
-                                           range,
-                                           uplo,
-                                           n,
-                                           (hipDoubleComplex*)A,
-                                           lda,
-                                           (hipDoubleComplex*)B,
-                                           ldb,
-                                           vl,
-                                           vu,
-                                           il,
-                                           iu,
-                                           nev,
-                                           W,
-                                           lwork);
     case API_COMPAT:
-        return hipsolverDnZhegvdx_bufferSize(handle,
-                                             itype,
-                                             jobz,
-                                             range,
-                                             uplo,
-                                             n,
-                                             (hipDoubleComplex*)A,
-                                             lda,
-                                             (hipDoubleComplex*)B,
-                                             ldb,
-                                             vl,
-                                             vu,
-                                             il,
-                                             iu,
-                                             nev,
-                                             W,
-                                             lwork);
+        return hipsolverDnXsyevAuto_bufferSize(handle,
+                                               params,
+                                               jobz,
+                                               range,
+                                               uplo,
+                                               n,
+                                               HIP_C_64F,
+                                               A,
+                                               lda,
+                                               stA,
+                                               il,
+                                               iu,
+                                               HIP_R_64F,
+                                               W,
+                                               stW,
+                                               HIP_C_64F,
+                                               lworkOnDevice,
+                                               lworkOnHost,
+                                               bc);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t           API,
-                                                 hipsolverHandle_t   handle,
-                                                 hipsolverEigType_t  itype,
-                                                 hipsolverEigMode_t  jobz,
-                                                 hipsolverEigRange_t range,
-                                                 hipsolverFillMode_t uplo,
-                                                 int                 n,
-                                                 float*              A,
-                                                 int                 lda,
-                                                 int                 stA,
-                                                 float*              B,
-                                                 int                 ldb,
-                                                 int                 stB,
-                                                 float               vl,
-                                                 float               vu,
-                                                 int                 il,
-                                                 int                 iu,
-                                                 int*                nev,
-                                                 float*              W,
-                                                 int                 stW,
-                                                 float*              work,
-                                                 int                 lwork,
-                                                 int*                info,
-                                                 int                 bc)
+inline hipsolverStatus_t hipsolver_syev_auto(testAPI_t           API,
+                                             hipsolverHandle_t   handle,
+                                             hipsolverDnParams_t params,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverEigRange_t range,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             int                 stA,
+                                             int                 il,
+                                             int                 iu,
+                                             float*              W,
+                                             int                 stW,
+                                             float*              workOnDevice,
+                                             size_t              lworkOnDevice,
+                                             float*              workOnHost,
+                                             size_t              lworkOnHost,
+                                             int*                info,
+                                             int                 bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverSsygvdx(handle,
-                                itype,
-                                jobz,
-                                range,
-                                uplo,
-                                n,
-                                A,
-                                lda,
-                                B,
-                                ldb,
-                                vl,
-                                vu,
-                                il,
-                                iu,
-                                nev,
-                                W,
-                                work,
-                                lwork,
-                                info);
     case API_COMPAT:
-        return hipsolverDnSsygvdx(handle,
-                                  itype,
-                                  jobz,
-                                  range,
-                                  uplo,
-                                  n,
-                                  A,
-                                  lda,
-                                  B,
-                                  ldb,
-                                  vl,
-                                  vu,
-                                  il,
-                                  iu,
-                                  nev,
-                                  W,
-                                  work,
-                                  lwork,
-                                  info);
+        return hipsolverDnXsyevAuto(handle,
+                                    params,
+                                    jobz,
+                                    range,
+                                    uplo,
+                                    n,
+                                    HIP_R_32F,
+                                    A,
+                                    lda,
+                                    stA,
+                                    il,
+                                    iu,
+                                    HIP_R_32F,
+                                    W,
+                                    stW,
+                                    HIP_R_32F,
+                                    workOnDevice,
+                                    lworkOnDevice,
+                                    workOnHost,
+                                    lworkOnHost,
+                                    info,
+                                    bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syev_auto(testAPI_t           API,
+                                             hipsolverHandle_t   handle,
+                                             hipsolverDnParams_t params,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverEigRange_t range,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             int                 stA,
+                                             int                 il,
+                                             int                 iu,
+                                             double*             W,
+                                             int                 stW,
+                                             double*             workOnDevice,
+                                             size_t              lworkOnDevice,
+                                             double*             workOnHost,
+                                             size_t              lworkOnHost,
+                                             int*                info,
+                                             int                 bc)
+{
+    switch(API)
+    {
+    case API_COMPAT:
+        return hipsolverDnXsyevAuto(handle,
+                                    params,
+                                    jobz,
+                                    range,
+                                    uplo,
+                                    n,
+                                    HIP_R_64F,
+                                    A,
+                                    lda,
+                                    stA,
+                                    il,
+                                    iu,
+                                    HIP_R_64F,
+                                    W,
+                                    stW,
+                                    HIP_R_64F,
+                                    workOnDevice,
+                                    lworkOnDevice,
+                                    workOnHost,
+                                    lworkOnHost,
+                                    info,
+                                    bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syev_auto(testAPI_t           API,
+                                             hipsolverHandle_t   handle,
+                                             hipsolverDnParams_t params,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverEigRange_t range,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipsolverComplex*   A,
+                                             int                 lda,
+                                             int                 stA,
+                                             int                 il,
+                                             int                 iu,
+                                             float*              W,
+                                             int                 stW,
+                                             hipsolverComplex*   workOnDevice,
+                                             size_t              lworkOnDevice,
+                                             hipsolverComplex*   workOnHost,
+                                             size_t              lworkOnHost,
+                                             int*                info,
+                                             int                 bc)
+{
+    switch(API)
+    {
+    case API_COMPAT:
+        return hipsolverDnXsyevAuto(handle,
+                                    params,
+                                    jobz,
+                                    range,
+                                    uplo,
+                                    n,
+                                    HIP_C_32F,
+                                    A,
+                                    lda,
+                                    stA,
+                                    il,
+                                    iu,
+                                    HIP_R_32F,
+                                    W,
+                                    stW,
+                                    HIP_C_32F,
+                                    workOnDevice,
+                                    lworkOnDevice,
+                                    workOnHost,
+                                    lworkOnHost,
+                                    info,
+                                    bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syev_auto(testAPI_t               API,
+                                             hipsolverHandle_t       handle,
+                                             hipsolverDnParams_t     params,
+                                             hipsolverEigMode_t      jobz,
+                                             hipsolverEigRange_t     range,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             int                     stA,
+                                             int                     il,
+                                             int                     iu,
+                                             double*                 W,
+                                             int                     stW,
+                                             hipsolverDoubleComplex* workOnDevice,
+                                             size_t                  lworkOnDevice,
+                                             hipsolverDoubleComplex* workOnHost,
+                                             size_t                  lworkOnHost,
+                                             int*                    info,
+                                             int                     bc)
+{
+    switch(API)
+    {
+    case API_COMPAT:
+        return hipsolverDnXsyevAuto(handle,
+                                    params,
+                                    jobz,
+                                    range,
+                                    uplo,
+                                    n,
+                                    HIP_C_64F,
+                                    A,
+                                    lda,
+                                    stA,
+                                    il,
+                                    iu,
+                                    HIP_R_64F,
+                                    W,
+                                    stW,
+                                    HIP_C_64F,
+                                    workOnDevice,
+                                    lworkOnDevice,
+                                    workOnHost,
+                                    lworkOnHost,
+                                    info,
+                                    bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
+/********************************************************/
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t           API,
-                                                 hipsolverHandle_t   handle,
-                                                 hipsolverEigType_t  itype,
-                                                 hipsolverEigMode_t  jobz,
-                                                 hipsolverEigRange_t range,
-                                                 hipsolverFillMode_t uplo,
-                                                 int                 n,
-                                                 double*             A,
-                                                 int                 lda,
-                                                 int                 stA,
-                                                 double*             B,
-                                                 int                 ldb,
-                                                 int                 stB,
-                                                 double              vl,
-                                                 double              vu,
-                                                 int                 il,
-                                                 int                 iu,
-                                                 int*                nev,
-                                                 double*             W,
-                                                 int                 stW,
-                                                 double*             work,
-                                                 int                 lwork,
-                                                 int*                info,
-                                                 int                 bc)
+/******************** SYEVJ/HEEVJ ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          float*               A,
+                                                          int                  lda,
+                                                          float*               W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDsygvdx(handle,
-                                itype,
-                                jobz,
-                                range,
-                                uplo,
-                                n,
-                                A,
-                                lda,
-                                B,
-                                ldb,
-                                vl,
-                                vu,
-                                il,
-                                iu,
-                                nev,
-                                W,
-                                work,
-                                lwork,
-                                info);
-    case API_COMPAT:
-        return hipsolverDnDsygvdx(handle,
-                                  itype,
-                                  jobz,
-                                  range,
-                                  uplo,
-                                  n,
-                                  A,
-                                  lda,
-                                  B,
-                                  ldb,
-                                  vl,
-                                  vu,
-                                  il,
-                                  iu,
-                                  nev,
-                                  W,
-                                  work,
-                                  lwork,
-                                  info);
+    case C_NORMAL:
+        return hipsolverSsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case C_NORMAL_ALT:
+        return hipsolverSsyevjBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSsyevj_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverSsyevjBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnSsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnSsyevjBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          double*              A,
+                                                          int                  lda,
+                                                          double*              W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case C_NORMAL_ALT:
+        return hipsolverDsyevjBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsyevj_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverDsyevjBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnDsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnDsyevjBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          hipsolverComplex*    A,
+                                                          int                  lda,
+                                                          float*               W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCheevj_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params);
+    case C_NORMAL_ALT:
+        return hipsolverCheevjBatched_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCheevj_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverCheevjBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnCheevj_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnCheevjBatched_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t               API,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          double*                 W,
+                                                          int*                    lwork,
+                                                          hipsolverSyevjInfo_t    params,
+                                                          int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZheevj_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params);
+    case C_NORMAL_ALT:
+        return hipsolverZheevjBatched_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZheevj_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverZheevjBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnZheevj_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnZheevjBatched_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               float*               A,
+                                               int                  lda,
+                                               int                  stA,
+                                               float*               W,
+                                               int                  stW,
+                                               float*               work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case C_NORMAL_ALT:
+        return hipsolverSsyevjBatched(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSsyevjFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverSsyevjBatchedFortran(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnSsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnSsyevjBatched(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               double*              A,
+                                               int                  lda,
+                                               int                  stA,
+                                               double*              W,
+                                               int                  stW,
+                                               double*              work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case C_NORMAL_ALT:
+        return hipsolverDsyevjBatched(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsyevjFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverDsyevjBatchedFortran(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnDsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnDsyevjBatched(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               hipsolverComplex*    A,
+                                               int                  lda,
+                                               int                  stA,
+                                               float*               W,
+                                               int                  stW,
+                                               hipsolverComplex*    work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCheevj(handle,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               W,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info,
+                               params);
+    case C_NORMAL_ALT:
+        return hipsolverCheevjBatched(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      W,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info,
+                                      params,
+                                      bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCheevjFortran(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      W,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info,
+                                      params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverCheevjBatchedFortran(handle,
+                                             jobz,
+                                             uplo,
+                                             n,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             W,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             params,
+                                             bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnCheevj(handle,
+                                 jobz,
+                                 uplo,
+                                 n,
+                                 (hipFloatComplex*)A,
+                                 lda,
+                                 W,
+                                 (hipFloatComplex*)work,
+                                 lwork,
+                                 info,
+                                 params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnCheevjBatched(handle,
+                                        jobz,
+                                        uplo,
+                                        n,
+                                        (hipFloatComplex*)A,
+                                        lda,
+                                        W,
+                                        (hipFloatComplex*)work,
+                                        lwork,
+                                        info,
+                                        params,
+                                        bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t               API,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               int                     stA,
+                                               double*                 W,
+                                               int                     stW,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               hipsolverSyevjInfo_t    params,
+                                               int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZheevj(handle,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               W,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info,
+                               params);
+    case C_NORMAL_ALT:
+        return hipsolverZheevjBatched(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      W,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info,
+                                      params,
+                                      bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZheevjFortran(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      W,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info,
+                                      params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverZheevjBatchedFortran(handle,
+                                             jobz,
+                                             uplo,
+                                             n,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             W,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             params,
+                                             bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnZheevj(handle,
+                                 jobz,
+                                 uplo,
+                                 n,
+                                 (hipDoubleComplex*)A,
+                                 lda,
+                                 W,
+                                 (hipDoubleComplex*)work,
+                                 lwork,
+                                 info,
+                                 params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnZheevjBatched(handle,
+                                        jobz,
+                                        uplo,
+                                        n,
+                                        (hipDoubleComplex*)A,
+                                        lda,
+                                        W,
+                                        (hipDoubleComplex*)work,
+                                        lwork,
+                                        info,
+                                        params,
+                                        bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYGVD/HEGVD ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigType_t  itype,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          float*              B,
+                                                          int                 ldb,
+                                                          int                 stB,
+                                                          float*              W,
+                                                          int                 stW,
+                                                          int*                lwork,
+                                                          int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverSsygvdStridedBatched_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, W, stW, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSsygvd_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigType_t  itype,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          double*             B,
+                                                          int                 ldb,
+                                                          int                 stB,
+                                                          double*             W,
+                                                          int                 stW,
+                                                          int*                lwork,
+                                                          int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverDsygvdStridedBatched_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, W, stW, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsygvd_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigType_t  itype,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          hipsolverComplex*   B,
+                                                          int                 ldb,
+                                                          int                 stB,
+                                                          float*              W,
+                                                          int                 stW,
+                                                          int*                lwork,
+                                                          int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverChegvd_bufferSize(handle,
+                                          itype,
+                                          jobz,
+                                          uplo,
+                                          n,
+                                          (hipFloatComplex*)A,
+                                          lda,
+                                          (hipFloatComplex*)B,
+                                          ldb,
+                                          W,
+                                          lwork);
+    case C_NORMAL_ALT:
+        return hipsolverChegvdStridedBatched_bufferSize(handle,
+                                                        itype,
+                                                        jobz,
+                                                        uplo,
+                                                        n,
+                                                        (hipFloatComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        (hipFloatComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        W,
+                                                        stW,
+                                                        lwork,
+                                                        bc);
+    case FORTRAN_NORMAL:
+        return hipsolverChegvd_bufferSizeFortran(handle,
+                                                 itype,
+                                                 jobz,
+                                                 uplo,
+                                                 n,
+                                                 (hipFloatComplex*)A,
+                                                 lda,
+                                                 (hipFloatComplex*)B,
+                                                 ldb,
+                                                 W,
+                                                 lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t               API,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverEigType_t      itype,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          int                     stA,
+                                                          hipsolverDoubleComplex* B,
+                                                          int                     ldb,
+                                                          int                     stB,
+                                                          double*                 W,
+                                                          int                     stW,
+                                                          int*                    lwork,
+                                                          int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZhegvd_bufferSize(handle,
+                                          itype,
+                                          jobz,
+                                          uplo,
+                                          n,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          W,
+                                          lwork);
+    case C_NORMAL_ALT:
+        return hipsolverZhegvdStridedBatched_bufferSize(handle,
+                                                        itype,
+                                                        jobz,
+                                                        uplo,
+                                                        n,
+                                                        (hipDoubleComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        (hipDoubleComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        W,
+                                                        stW,
+                                                        lwork,
+                                                        bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZhegvd_bufferSizeFortran(handle,
+                                                 itype,
+                                                 jobz,
+                                                 uplo,
+                                                 n,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 (hipDoubleComplex*)B,
+                                                 ldb,
+                                                 W,
+                                                 lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              B,
+                                               int                 ldb,
+                                               int                 stB,
+                                               float*              W,
+                                               int                 stW,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverSsygvdStridedBatched(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, W, stW, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSsygvdFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 stA,
+                                               double*             B,
+                                               int                 ldb,
+                                               int                 stB,
+                                               double*             W,
+                                               int                 stW,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverDsygvdStridedBatched(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, W, stW, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsygvdFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipsolverComplex*   A,
+                                               int                 lda,
+                                               int                 stA,
+                                               hipsolverComplex*   B,
+                                               int                 ldb,
+                                               int                 stB,
+                                               float*              W,
+                                               int                 stW,
+                                               hipsolverComplex*   work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverChegvd(handle,
+                               itype,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               W,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverChegvdStridedBatched(handle,
+                                             itype,
+                                             jobz,
+                                             uplo,
+                                             n,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             stA,
+                                             (hipFloatComplex*)B,
+                                             ldb,
+                                             stB,
+                                             W,
+                                             stW,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverChegvdFortran(handle,
+                                      itype,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      (hipFloatComplex*)B,
+                                      ldb,
+                                      W,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t               API,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverEigType_t      itype,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               int                     stA,
+                                               hipsolverDoubleComplex* B,
+                                               int                     ldb,
+                                               int                     stB,
+                                               double*                 W,
+                                               int                     stW,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZhegvd(handle,
+                               itype,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               W,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverZhegvdStridedBatched(handle,
+                                             itype,
+                                             jobz,
+                                             uplo,
+                                             n,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             stA,
+                                             (hipDoubleComplex*)B,
+                                             ldb,
+                                             stB,
+                                             W,
+                                             stW,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZhegvdFortran(handle,
+                                      itype,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
+                                      W,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYGVDX/HEGVDX ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            float*              A,
+                                                            int                 lda,
+                                                            float*              B,
+                                                            int                 ldb,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            float*              W,
+                                                            int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsygvdx_bufferSize(
+            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+    case API_COMPAT:
+        return hipsolverDnSsygvdx_bufferSize(
+            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            double*             A,
+                                                            int                 lda,
+                                                            double*             B,
+                                                            int                 ldb,
+                                                            double              vl,
+                                                            double              vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            double*             W,
+                                                            int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsygvdx_bufferSize(
+            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+    case API_COMPAT:
+        return hipsolverDnDsygvdx_bufferSize(
+            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipsolverComplex*   A,
+                                                            int                 lda,
+                                                            hipsolverComplex*   B,
+                                                            int                 ldb,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            float*              W,
+                                                            int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverChegvdx_bufferSize(handle,
+                                           itype,
+                                           jobz,
+                                           range,
+                                           uplo,
+                                           n,
+                                           (hipFloatComplex*)A,
+                                           lda,
+                                           (hipFloatComplex*)B,
+                                           ldb,
+                                           vl,
+                                           vu,
+                                           il,
+                                           iu,
+                                           nev,
+                                           W,
+                                           lwork);
+    case API_COMPAT:
+        return hipsolverDnChegvdx_bufferSize(handle,
+                                             itype,
+                                             jobz,
+                                             range,
+                                             uplo,
+                                             n,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             (hipFloatComplex*)B,
+                                             ldb,
+                                             vl,
+                                             vu,
+                                             il,
+                                             iu,
+                                             nev,
+                                             W,
+                                             lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t               API,
+                                                            hipsolverHandle_t       handle,
+                                                            hipsolverEigType_t      itype,
+                                                            hipsolverEigMode_t      jobz,
+                                                            hipsolverEigRange_t     range,
+                                                            hipsolverFillMode_t     uplo,
+                                                            int                     n,
+                                                            hipsolverDoubleComplex* A,
+                                                            int                     lda,
+                                                            hipsolverDoubleComplex* B,
+                                                            int                     ldb,
+                                                            double                  vl,
+                                                            double                  vu,
+                                                            int                     il,
+                                                            int                     iu,
+                                                            int*                    nev,
+                                                            double*                 W,
+                                                            int*                    lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhegvdx_bufferSize(handle,
+                                           itype,
+                                           jobz,
+                                           range,
+                                           uplo,
+                                           n,
+                                           (hipDoubleComplex*)A,
+                                           lda,
+                                           (hipDoubleComplex*)B,
+                                           ldb,
+                                           vl,
+                                           vu,
+                                           il,
+                                           iu,
+                                           nev,
+                                           W,
+                                           lwork);
+    case API_COMPAT:
+        return hipsolverDnZhegvdx_bufferSize(handle,
+                                             itype,
+                                             jobz,
+                                             range,
+                                             uplo,
+                                             n,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             (hipDoubleComplex*)B,
+                                             ldb,
+                                             vl,
+                                             vu,
+                                             il,
+                                             iu,
+                                             nev,
+                                             W,
+                                             lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigType_t  itype,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 float*              A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 float*              B,
+                                                 int                 ldb,
+                                                 int                 stB,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 float*              W,
+                                                 int                 stW,
+                                                 float*              work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsygvdx(handle,
+                                itype,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                work,
+                                lwork,
+                                info);
+    case API_COMPAT:
+        return hipsolverDnSsygvdx(handle,
+                                  itype,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  A,
+                                  lda,
+                                  B,
+                                  ldb,
+                                  vl,
+                                  vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  W,
+                                  work,
+                                  lwork,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigType_t  itype,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 double*             A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 double*             B,
+                                                 int                 ldb,
+                                                 int                 stB,
+                                                 double              vl,
+                                                 double              vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 double*             W,
+                                                 int                 stW,
+                                                 double*             work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsygvdx(handle,
+                                itype,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                work,
+                                lwork,
+                                info);
+    case API_COMPAT:
+        return hipsolverDnDsygvdx(handle,
+                                  itype,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  A,
+                                  lda,
+                                  B,
+                                  ldb,
+                                  vl,
+                                  vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  W,
+                                  work,
+                                  lwork,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t           API,
                                                  hipsolverHandle_t   handle,
                                                  hipsolverEigType_t  itype,
                                                  hipsolverEigMode_t  jobz,
@@ -8357,930 +10966,2101 @@ inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t           API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverChegvdx(handle,
-                                itype,
-                                jobz,
-                                range,
-                                uplo,
-                                n,
-                                (hipFloatComplex*)A,
-                                lda,
-                                (hipFloatComplex*)B,
-                                ldb,
-                                vl,
-                                vu,
-                                il,
-                                iu,
-                                nev,
-                                W,
-                                (hipFloatComplex*)work,
-                                lwork,
-                                info);
-    case API_COMPAT:
-        return hipsolverDnChegvdx(handle,
-                                  itype,
-                                  jobz,
-                                  range,
-                                  uplo,
-                                  n,
-                                  (hipFloatComplex*)A,
-                                  lda,
-                                  (hipFloatComplex*)B,
-                                  ldb,
-                                  vl,
-                                  vu,
-                                  il,
-                                  iu,
-                                  nev,
-                                  W,
-                                  (hipFloatComplex*)work,
-                                  lwork,
-                                  info);
+        return hipsolverChegvdx(handle,
+                                itype,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                (hipFloatComplex*)A,
+                                lda,
+                                (hipFloatComplex*)B,
+                                ldb,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                (hipFloatComplex*)work,
+                                lwork,
+                                info);
+    case API_COMPAT:
+        return hipsolverDnChegvdx(handle,
+                                  itype,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  (hipFloatComplex*)A,
+                                  lda,
+                                  (hipFloatComplex*)B,
+                                  ldb,
+                                  vl,
+                                  vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  W,
+                                  (hipFloatComplex*)work,
+                                  lwork,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t               API,
+                                                 hipsolverHandle_t       handle,
+                                                 hipsolverEigType_t      itype,
+                                                 hipsolverEigMode_t      jobz,
+                                                 hipsolverEigRange_t     range,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* A,
+                                                 int                     lda,
+                                                 int                     stA,
+                                                 hipsolverDoubleComplex* B,
+                                                 int                     ldb,
+                                                 int                     stB,
+                                                 double                  vl,
+                                                 double                  vu,
+                                                 int                     il,
+                                                 int                     iu,
+                                                 int*                    nev,
+                                                 double*                 W,
+                                                 int                     stW,
+                                                 hipsolverDoubleComplex* work,
+                                                 int                     lwork,
+                                                 int*                    info,
+                                                 int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhegvdx(handle,
+                                itype,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                (hipDoubleComplex*)A,
+                                lda,
+                                (hipDoubleComplex*)B,
+                                ldb,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                (hipDoubleComplex*)work,
+                                lwork,
+                                info);
+    case API_COMPAT:
+        return hipsolverDnZhegvdx(handle,
+                                  itype,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  (hipDoubleComplex*)A,
+                                  lda,
+                                  (hipDoubleComplex*)B,
+                                  ldb,
+                                  vl,
+                                  vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  W,
+                                  (hipDoubleComplex*)work,
+                                  lwork,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYGVJ/HEGVJ ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t            API,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigType_t   itype,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          float*               A,
+                                                          int                  lda,
+                                                          float*               B,
+                                                          int                  ldb,
+                                                          float*               W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsygvj_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    case API_FORTRAN:
+        return hipsolverSsygvj_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    case API_COMPAT:
+        return hipsolverDnSsygvj_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t            API,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigType_t   itype,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          double*              A,
+                                                          int                  lda,
+                                                          double*              B,
+                                                          int                  ldb,
+                                                          double*              W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsygvj_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    case API_FORTRAN:
+        return hipsolverDsygvj_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    case API_COMPAT:
+        return hipsolverDnDsygvj_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t            API,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigType_t   itype,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          hipsolverComplex*    A,
+                                                          int                  lda,
+                                                          hipsolverComplex*    B,
+                                                          int                  ldb,
+                                                          float*               W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverChegvj_bufferSize(handle,
+                                          itype,
+                                          jobz,
+                                          uplo,
+                                          n,
+                                          (hipFloatComplex*)A,
+                                          lda,
+                                          (hipFloatComplex*)B,
+                                          ldb,
+                                          W,
+                                          lwork,
+                                          params);
+    case API_FORTRAN:
+        return hipsolverChegvj_bufferSizeFortran(handle,
+                                                 itype,
+                                                 jobz,
+                                                 uplo,
+                                                 n,
+                                                 (hipFloatComplex*)A,
+                                                 lda,
+                                                 (hipFloatComplex*)B,
+                                                 ldb,
+                                                 W,
+                                                 lwork,
+                                                 params);
+    case API_COMPAT:
+        return hipsolverDnChegvj_bufferSize(handle,
+                                            itype,
+                                            jobz,
+                                            uplo,
+                                            n,
+                                            (hipFloatComplex*)A,
+                                            lda,
+                                            (hipFloatComplex*)B,
+                                            ldb,
+                                            W,
+                                            lwork,
+                                            params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t               API,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverEigType_t      itype,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          hipsolverDoubleComplex* B,
+                                                          int                     ldb,
+                                                          double*                 W,
+                                                          int*                    lwork,
+                                                          hipsolverSyevjInfo_t    params)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhegvj_bufferSize(handle,
+                                          itype,
+                                          jobz,
+                                          uplo,
+                                          n,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          W,
+                                          lwork,
+                                          params);
+    case API_FORTRAN:
+        return hipsolverZhegvj_bufferSizeFortran(handle,
+                                                 itype,
+                                                 jobz,
+                                                 uplo,
+                                                 n,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 (hipDoubleComplex*)B,
+                                                 ldb,
+                                                 W,
+                                                 lwork,
+                                                 params);
+    case API_COMPAT:
+        return hipsolverDnZhegvj_bufferSize(handle,
+                                            itype,
+                                            jobz,
+                                            uplo,
+                                            n,
+                                            (hipDoubleComplex*)A,
+                                            lda,
+                                            (hipDoubleComplex*)B,
+                                            ldb,
+                                            W,
+                                            lwork,
+                                            params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t            API,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigType_t   itype,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               float*               A,
+                                               int                  lda,
+                                               int                  stA,
+                                               float*               B,
+                                               int                  ldb,
+                                               int                  stB,
+                                               float*               W,
+                                               int                  stW,
+                                               float*               work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsygvj(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    case API_FORTRAN:
+        return hipsolverSsygvjFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    case API_COMPAT:
+        return hipsolverDnSsygvj(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t            API,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigType_t   itype,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               double*              A,
+                                               int                  lda,
+                                               int                  stA,
+                                               double*              B,
+                                               int                  ldb,
+                                               int                  stB,
+                                               double*              W,
+                                               int                  stW,
+                                               double*              work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsygvj(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    case API_FORTRAN:
+        return hipsolverDsygvjFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    case API_COMPAT:
+        return hipsolverDnDsygvj(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t            API,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigType_t   itype,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               hipsolverComplex*    A,
+                                               int                  lda,
+                                               int                  stA,
+                                               hipsolverComplex*    B,
+                                               int                  ldb,
+                                               int                  stB,
+                                               float*               W,
+                                               int                  stW,
+                                               hipsolverComplex*    work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverChegvj(handle,
+                               itype,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               W,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info,
+                               params);
+    case API_FORTRAN:
+        return hipsolverChegvjFortran(handle,
+                                      itype,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      (hipFloatComplex*)B,
+                                      ldb,
+                                      W,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info,
+                                      params);
+    case API_COMPAT:
+        return hipsolverDnChegvj(handle,
+                                 itype,
+                                 jobz,
+                                 uplo,
+                                 n,
+                                 (hipFloatComplex*)A,
+                                 lda,
+                                 (hipFloatComplex*)B,
+                                 ldb,
+                                 W,
+                                 (hipFloatComplex*)work,
+                                 lwork,
+                                 info,
+                                 params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t               API,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverEigType_t      itype,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               int                     stA,
+                                               hipsolverDoubleComplex* B,
+                                               int                     ldb,
+                                               int                     stB,
+                                               double*                 W,
+                                               int                     stW,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               hipsolverSyevjInfo_t    params,
+                                               int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhegvj(handle,
+                               itype,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               W,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info,
+                               params);
+    case API_FORTRAN:
+        return hipsolverZhegvjFortran(handle,
+                                      itype,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
+                                      W,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info,
+                                      params);
+    case API_COMPAT:
+        return hipsolverDnZhegvj(handle,
+                                 itype,
+                                 jobz,
+                                 uplo,
+                                 n,
+                                 (hipDoubleComplex*)A,
+                                 lda,
+                                 (hipDoubleComplex*)B,
+                                 ldb,
+                                 W,
+                                 (hipDoubleComplex*)work,
+                                 lwork,
+                                 info,
+                                 params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYTRD/HETRD ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t           API,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          float*              D,
+                                                          float*              E,
+                                                          float*              tau,
+                                                          int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case API_FORTRAN:
+        return hipsolverSsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t           API,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          double*             D,
+                                                          double*             E,
+                                                          double*             tau,
+                                                          int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case API_FORTRAN:
+        return hipsolverDsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t           API,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A,
+                                                          int                 lda,
+                                                          float*              D,
+                                                          float*              E,
+                                                          hipsolverComplex*   tau,
+                                                          int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverChetrd_bufferSize(
+            handle, uplo, n, (hipFloatComplex*)A, lda, D, E, (hipFloatComplex*)tau, lwork);
+    case API_FORTRAN:
+        return hipsolverChetrd_bufferSizeFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, D, E, (hipFloatComplex*)tau, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t               API,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          double*                 D,
+                                                          double*                 E,
+                                                          hipsolverDoubleComplex* tau,
+                                                          int*                    lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhetrd_bufferSize(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, D, E, (hipDoubleComplex*)tau, lwork);
+    case API_FORTRAN:
+        return hipsolverZhetrd_bufferSizeFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, D, E, (hipDoubleComplex*)tau, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t           API,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              D,
+                                               int                 stD,
+                                               float*              E,
+                                               int                 stE,
+                                               float*              tau,
+                                               int                 stP,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverSsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t           API,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 stA,
+                                               double*             D,
+                                               int                 stD,
+                                               double*             E,
+                                               int                 stE,
+                                               double*             tau,
+                                               int                 stP,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverDsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t           API,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipsolverComplex*   A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              D,
+                                               int                 stD,
+                                               float*              E,
+                                               int                 stE,
+                                               hipsolverComplex*   tau,
+                                               int                 stP,
+                                               hipsolverComplex*   work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverChetrd(handle,
+                               uplo,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               D,
+                               E,
+                               (hipFloatComplex*)tau,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    case API_FORTRAN:
+        return hipsolverChetrdFortran(handle,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      D,
+                                      E,
+                                      (hipFloatComplex*)tau,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t               API,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               int                     stA,
+                                               double*                 D,
+                                               int                     stD,
+                                               double*                 E,
+                                               int                     stE,
+                                               hipsolverDoubleComplex* tau,
+                                               int                     stP,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhetrd(handle,
+                               uplo,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               D,
+                               E,
+                               (hipDoubleComplex*)tau,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    case API_FORTRAN:
+        return hipsolverZhetrdFortran(handle,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      D,
+                                      E,
+                                      (hipDoubleComplex*)tau,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYTRF ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    testAPI_t API, hipsolverHandle_t handle, int n, float* A, int lda, int* lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsytrf_bufferSize(handle, n, A, lda, lwork);
+    case API_FORTRAN:
+        return hipsolverSsytrf_bufferSizeFortran(handle, n, A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    testAPI_t API, hipsolverHandle_t handle, int n, double* A, int lda, int* lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsytrf_bufferSize(handle, n, A, lda, lwork);
+    case API_FORTRAN:
+        return hipsolverDsytrf_bufferSizeFortran(handle, n, A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    testAPI_t API, hipsolverHandle_t handle, int n, hipsolverComplex* A, int lda, int* lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCsytrf_bufferSize(handle, n, (hipFloatComplex*)A, lda, lwork);
+    case API_FORTRAN:
+        return hipsolverCsytrf_bufferSizeFortran(handle, n, (hipFloatComplex*)A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    testAPI_t API, hipsolverHandle_t handle, int n, hipsolverDoubleComplex* A, int lda, int* lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZsytrf_bufferSize(handle, n, (hipDoubleComplex*)A, lda, lwork);
+    case API_FORTRAN:
+        return hipsolverZsytrf_bufferSizeFortran(handle, n, (hipDoubleComplex*)A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverSsytrfFortran(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverDsytrfFortran(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCsytrf(
+            handle, uplo, n, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverCsytrfFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZsytrf(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, ipiv, (hipDoubleComplex*)work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverZsytrfFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, ipiv, (hipDoubleComplex*)work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYTRS ********************/
+// normal, batched and strided_batched
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                ipiv,
+                                                    int                 stP,
+                                                    float*              B,
+                                                    int                 ldb,
+                                                    int                 stB,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverSsytrsStridedBatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         float*              B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverSsytrsStridedBatched(
+            handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                ipiv,
+                                                    int                 stP,
+                                                    float*              B[],
+                                                    int                 ldb,
+                                                    int                 stB,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrsBatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         float*              B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrsBatched(
+            handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t               API,
-                                                 hipsolverHandle_t       handle,
-                                                 hipsolverEigType_t      itype,
-                                                 hipsolverEigMode_t      jobz,
-                                                 hipsolverEigRange_t     range,
-                                                 hipsolverFillMode_t     uplo,
-                                                 int                     n,
-                                                 hipsolverDoubleComplex* A,
-                                                 int                     lda,
-                                                 int                     stA,
-                                                 hipsolverDoubleComplex* B,
-                                                 int                     ldb,
-                                                 int                     stB,
-                                                 double                  vl,
-                                                 double                  vu,
-                                                 int                     il,
-                                                 int                     iu,
-                                                 int*                    nev,
-                                                 double*                 W,
-                                                 int                     stW,
-                                                 hipsolverDoubleComplex* work,
-                                                 int                     lwork,
-                                                 int*                    info,
-                                                 int                     bc)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int64_t             n,
+                                                    int64_t             nrhs,
+                                                    float*              A,
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    int64_t*            ipiv,
+                                                    int64_t             stP,
+                                                    float*              B,
+                                                    int64_t             ldb,
+                                                    int64_t             stB,
+                                                    size_t*             lwork,
+                                                    int                 bc)
 {
-    switch(API)
+    size_t lworkOnHost;
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZhegvdx(handle,
-                                itype,
-                                jobz,
-                                range,
-                                uplo,
-                                n,
-                                (hipDoubleComplex*)A,
-                                lda,
-                                (hipDoubleComplex*)B,
-                                ldb,
-                                vl,
-                                vu,
-                                il,
-                                iu,
-                                nev,
-                                W,
-                                (hipDoubleComplex*)work,
-                                lwork,
-                                info);
-    case API_COMPAT:
-        return hipsolverDnZhegvdx(handle,
-                                  itype,
-                                  jobz,
-                                  range,
-                                  uplo,
-                                  n,
-                                  (hipDoubleComplex*)A,
-                                  lda,
-                                  (hipDoubleComplex*)B,
-                                  ldb,
-                                  vl,
-                                  vu,
-                                  il,
-                                  iu,
-                                  nev,
-                                  W,
-                                  (hipDoubleComplex*)work,
-                                  lwork,
-                                  info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXsytrs_bufferSize(
+            handle, uplo, n, nrhs, HIP_R_32F, A, lda, ipiv, HIP_R_32F, B, ldb, lwork, &lworkOnHost);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
 
-/******************** SYGVJ/HEGVJ ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t            API,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverEigType_t   itype,
-                                                          hipsolverEigMode_t   jobz,
-                                                          hipsolverFillMode_t  uplo,
-                                                          int                  n,
-                                                          float*               A,
-                                                          int                  lda,
-                                                          float*               B,
-                                                          int                  ldb,
-                                                          float*               W,
-                                                          int*                 lwork,
-                                                          hipsolverSyevjInfo_t params)
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int64_t             n,
+                                         int64_t             nrhs,
+                                         float*              A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         float*              B,
+                                         int64_t             ldb,
+                                         int64_t             stB,
+                                         float*              work,
+                                         size_t              lwork,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    size_t lworkOnDevice, lworkOnHost;
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSsygvj_bufferSize(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
-    case API_FORTRAN:
-        return hipsolverSsygvj_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
-    case API_COMPAT:
-        return hipsolverDnSsygvj_bufferSize(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    case COMPAT_NORMAL:
+    {
+        hipsolverStatus_t status = hipsolverDnXsytrs_bufferSize(handle,
+                                                                uplo,
+                                                                n,
+                                                                nrhs,
+                                                                HIP_R_32F,
+                                                                A,
+                                                                lda,
+                                                                ipiv,
+                                                                HIP_R_32F,
+                                                                B,
+                                                                ldb,
+                                                                &lworkOnDevice,
+                                                                &lworkOnHost);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        std::vector<char> workOnHost(lworkOnHost);
+        return hipsolverDnXsytrs(handle,
+                                 uplo,
+                                 n,
+                                 nrhs,
+                                 HIP_R_32F,
+                                 A,
+                                 lda,
+                                 ipiv,
+                                 HIP_R_32F,
+                                 B,
+                                 ldb,
+                                 work,
+                                 lwork,
+                                 workOnHost.data(),
+                                 lworkOnHost,
+                                 info);
+    }
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t            API,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverEigType_t   itype,
-                                                          hipsolverEigMode_t   jobz,
-                                                          hipsolverFillMode_t  uplo,
-                                                          int                  n,
-                                                          double*              A,
-                                                          int                  lda,
-                                                          double*              B,
-                                                          int                  ldb,
-                                                          double*              W,
-                                                          int*                 lwork,
-                                                          hipsolverSyevjInfo_t params)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int64_t             n,
+                                                    int64_t             nrhs,
+                                                    float*              A[],
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    int64_t*            ipiv,
+                                                    int64_t             stP,
+                                                    float*              B[],
+                                                    int64_t             ldb,
+                                                    int64_t             stB,
+                                                    size_t*             lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverDsygvj_bufferSize(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
-    case API_FORTRAN:
-        return hipsolverDsygvj_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
-    case API_COMPAT:
-        return hipsolverDnDsygvj_bufferSize(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t            API,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverEigType_t   itype,
-                                                          hipsolverEigMode_t   jobz,
-                                                          hipsolverFillMode_t  uplo,
-                                                          int                  n,
-                                                          hipsolverComplex*    A,
-                                                          int                  lda,
-                                                          hipsolverComplex*    B,
-                                                          int                  ldb,
-                                                          float*               W,
-                                                          int*                 lwork,
-                                                          hipsolverSyevjInfo_t params)
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int64_t             n,
+                                         int64_t             nrhs,
+                                         float*              A[],
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         float*              B[],
+                                         int64_t             ldb,
+                                         int64_t             stB,
+                                         float*              work,
+                                         size_t              lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverChegvj_bufferSize(handle,
-                                          itype,
-                                          jobz,
-                                          uplo,
-                                          n,
-                                          (hipFloatComplex*)A,
-                                          lda,
-                                          (hipFloatComplex*)B,
-                                          ldb,
-                                          W,
-                                          lwork,
-                                          params);
-    case API_FORTRAN:
-        return hipsolverChegvj_bufferSizeFortran(handle,
-                                                 itype,
-                                                 jobz,
-                                                 uplo,
-                                                 n,
-                                                 (hipFloatComplex*)A,
-                                                 lda,
-                                                 (hipFloatComplex*)B,
-                                                 ldb,
-                                                 W,
-                                                 lwork,
-                                                 params);
-    case API_COMPAT:
-        return hipsolverDnChegvj_bufferSize(handle,
-                                            itype,
-                                            jobz,
-                                            uplo,
-                                            n,
-                                            (hipFloatComplex*)A,
-                                            lda,
-                                            (hipFloatComplex*)B,
-                                            ldb,
-                                            W,
-                                            lwork,
-                                            params);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t               API,
-                                                          hipsolverHandle_t       handle,
-                                                          hipsolverEigType_t      itype,
-                                                          hipsolverEigMode_t      jobz,
-                                                          hipsolverFillMode_t     uplo,
-                                                          int                     n,
-                                                          hipsolverDoubleComplex* A,
-                                                          int                     lda,
-                                                          hipsolverDoubleComplex* B,
-                                                          int                     ldb,
-                                                          double*                 W,
-                                                          int*                    lwork,
-                                                          hipsolverSyevjInfo_t    params)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                ipiv,
+                                                    int                 stP,
+                                                    double*             B,
+                                                    int                 ldb,
+                                                    int                 stB,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverDsytrsStridedBatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         double*             B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZhegvj_bufferSize(handle,
-                                          itype,
-                                          jobz,
-                                          uplo,
-                                          n,
-                                          (hipDoubleComplex*)A,
-                                          lda,
-                                          (hipDoubleComplex*)B,
-                                          ldb,
-                                          W,
-                                          lwork,
-                                          params);
-    case API_FORTRAN:
-        return hipsolverZhegvj_bufferSizeFortran(handle,
-                                                 itype,
-                                                 jobz,
-                                                 uplo,
-                                                 n,
-                                                 (hipDoubleComplex*)A,
-                                                 lda,
-                                                 (hipDoubleComplex*)B,
-                                                 ldb,
-                                                 W,
-                                                 lwork,
-                                                 params);
-    case API_COMPAT:
-        return hipsolverDnZhegvj_bufferSize(handle,
-                                            itype,
-                                            jobz,
-                                            uplo,
-                                            n,
-                                            (hipDoubleComplex*)A,
-                                            lda,
-                                            (hipDoubleComplex*)B,
-                                            ldb,
-                                            W,
-                                            lwork,
-                                            params);
+    case C_NORMAL:
+        return hipsolverDsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverDsytrsStridedBatched(
+            handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t            API,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverEigType_t   itype,
-                                               hipsolverEigMode_t   jobz,
-                                               hipsolverFillMode_t  uplo,
-                                               int                  n,
-                                               float*               A,
-                                               int                  lda,
-                                               int                  stA,
-                                               float*               B,
-                                               int                  ldb,
-                                               int                  stB,
-                                               float*               W,
-                                               int                  stW,
-                                               float*               work,
-                                               int                  lwork,
-                                               int*                 info,
-                                               hipsolverSyevjInfo_t params,
-                                               int                  bc)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                ipiv,
+                                                    int                 stP,
+                                                    double*             B[],
+                                                    int                 ldb,
+                                                    int                 stB,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSsygvj(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
-    case API_FORTRAN:
-        return hipsolverSsygvjFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
-    case API_COMPAT:
-        return hipsolverDnSsygvj(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    case C_NORMAL:
+        return hipsolverDsytrsBatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t            API,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverEigType_t   itype,
-                                               hipsolverEigMode_t   jobz,
-                                               hipsolverFillMode_t  uplo,
-                                               int                  n,
-                                               double*              A,
-                                               int                  lda,
-                                               int                  stA,
-                                               double*              B,
-                                               int                  ldb,
-                                               int                  stB,
-                                               double*              W,
-                                               int                  stW,
-                                               double*              work,
-                                               int                  lwork,
-                                               int*                 info,
-                                               hipsolverSyevjInfo_t params,
-                                               int                  bc)
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         double*             B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDsygvj(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
-    case API_FORTRAN:
-        return hipsolverDsygvjFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
-    case API_COMPAT:
-        return hipsolverDnDsygvj(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    case C_NORMAL:
+        return hipsolverDsytrsBatched(
+            handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t            API,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverEigType_t   itype,
-                                               hipsolverEigMode_t   jobz,
-                                               hipsolverFillMode_t  uplo,
-                                               int                  n,
-                                               hipsolverComplex*    A,
-                                               int                  lda,
-                                               int                  stA,
-                                               hipsolverComplex*    B,
-                                               int                  ldb,
-                                               int                  stB,
-                                               float*               W,
-                                               int                  stW,
-                                               hipsolverComplex*    work,
-                                               int                  lwork,
-                                               int*                 info,
-                                               hipsolverSyevjInfo_t params,
-                                               int                  bc)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int64_t             n,
+                                                    int64_t             nrhs,
+                                                    double*             A,
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    int64_t*            ipiv,
+                                                    int64_t             stP,
+                                                    double*             B,
+                                                    int64_t             ldb,
+                                                    int64_t             stB,
+                                                    size_t*             lwork,
+                                                    int                 bc)
 {
-    switch(API)
+    size_t lworkOnHost;
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverChegvj(handle,
-                               itype,
-                               jobz,
-                               uplo,
-                               n,
-                               (hipFloatComplex*)A,
-                               lda,
-                               (hipFloatComplex*)B,
-                               ldb,
-                               W,
-                               (hipFloatComplex*)work,
-                               lwork,
-                               info,
-                               params);
-    case API_FORTRAN:
-        return hipsolverChegvjFortran(handle,
-                                      itype,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      (hipFloatComplex*)B,
-                                      ldb,
-                                      W,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info,
-                                      params);
-    case API_COMPAT:
-        return hipsolverDnChegvj(handle,
-                                 itype,
-                                 jobz,
+    case COMPAT_NORMAL:
+        return hipsolverDnXsytrs_bufferSize(
+            handle, uplo, n, nrhs, HIP_R_64F, A, lda, ipiv, HIP_R_64F, B, ldb, lwork, &lworkOnHost);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int64_t             n,
+                                         int64_t             nrhs,
+                                         double*             A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         double*             B,
+                                         int64_t             ldb,
+                                         int64_t             stB,
+                                         double*             work,
+                                         size_t              lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    size_t lworkOnDevice, lworkOnHost;
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+    {
+        hipsolverStatus_t status = hipsolverDnXsytrs_bufferSize(handle,
+                                                                uplo,
+                                                                n,
+                                                                nrhs,
+                                                                HIP_R_64F,
+                                                                A,
+                                                                lda,
+                                                                ipiv,
+                                                                HIP_R_64F,
+                                                                B,
+                                                                ldb,
+                                                                &lworkOnDevice,
+                                                                &lworkOnHost);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        std::vector<char> workOnHost(lworkOnHost);
+        return hipsolverDnXsytrs(handle,
                                  uplo,
                                  n,
-                                 (hipFloatComplex*)A,
+                                 nrhs,
+                                 HIP_R_64F,
+                                 A,
                                  lda,
-                                 (hipFloatComplex*)B,
+                                 ipiv,
+                                 HIP_R_64F,
+                                 B,
                                  ldb,
-                                 W,
-                                 (hipFloatComplex*)work,
+                                 work,
                                  lwork,
-                                 info,
-                                 params);
+                                 workOnHost.data(),
+                                 lworkOnHost,
+                                 info);
+    }
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t               API,
-                                               hipsolverHandle_t       handle,
-                                               hipsolverEigType_t      itype,
-                                               hipsolverEigMode_t      jobz,
-                                               hipsolverFillMode_t     uplo,
-                                               int                     n,
-                                               hipsolverDoubleComplex* A,
-                                               int                     lda,
-                                               int                     stA,
-                                               hipsolverDoubleComplex* B,
-                                               int                     ldb,
-                                               int                     stB,
-                                               double*                 W,
-                                               int                     stW,
-                                               hipsolverDoubleComplex* work,
-                                               int                     lwork,
-                                               int*                    info,
-                                               hipsolverSyevjInfo_t    params,
-                                               int                     bc)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int64_t             n,
+                                                    int64_t             nrhs,
+                                                    double*             A[],
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    int64_t*            ipiv,
+                                                    int64_t             stP,
+                                                    double*             B[],
+                                                    int64_t             ldb,
+                                                    int64_t             stB,
+                                                    size_t*             lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverZhegvj(handle,
-                               itype,
-                               jobz,
-                               uplo,
-                               n,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               (hipDoubleComplex*)B,
-                               ldb,
-                               W,
-                               (hipDoubleComplex*)work,
-                               lwork,
-                               info,
-                               params);
-    case API_FORTRAN:
-        return hipsolverZhegvjFortran(handle,
-                                      itype,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      (hipDoubleComplex*)B,
-                                      ldb,
-                                      W,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info,
-                                      params);
-    case API_COMPAT:
-        return hipsolverDnZhegvj(handle,
-                                 itype,
-                                 jobz,
-                                 uplo,
-                                 n,
-                                 (hipDoubleComplex*)A,
-                                 lda,
-                                 (hipDoubleComplex*)B,
-                                 ldb,
-                                 W,
-                                 (hipDoubleComplex*)work,
-                                 lwork,
-                                 info,
-                                 params);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
 
-/******************** SYTRD/HETRD ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          float*              A,
-                                                          int                 lda,
-                                                          float*              D,
-                                                          float*              E,
-                                                          float*              tau,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int64_t             n,
+                                         int64_t             nrhs,
+                                         double*             A[],
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         double*             B[],
+                                         int64_t             ldb,
+                                         int64_t             stB,
+                                         double*             work,
+                                         size_t              lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
-    case API_FORTRAN:
-        return hipsolverSsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          double*             A,
-                                                          int                 lda,
-                                                          double*             D,
-                                                          double*             E,
-                                                          double*             tau,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                ipiv,
+                                                    int                 stP,
+                                                    hipsolverComplex*   B,
+                                                    int                 ldb,
+                                                    int                 stB,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
-    case API_FORTRAN:
-        return hipsolverDsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case C_NORMAL:
+        return hipsolverCsytrs_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverCsytrsStridedBatched_bufferSize(handle,
+                                                        uplo,
+                                                        n,
+                                                        nrhs,
+                                                        (hipFloatComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        ipiv,
+                                                        stP,
+                                                        (hipFloatComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        lwork,
+                                                        bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          hipsolverComplex*   A,
-                                                          int                 lda,
-                                                          float*              D,
-                                                          float*              E,
-                                                          hipsolverComplex*   tau,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         hipsolverComplex*   B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverChetrd_bufferSize(
-            handle, uplo, n, (hipFloatComplex*)A, lda, D, E, (hipFloatComplex*)tau, lwork);
-    case API_FORTRAN:
-        return hipsolverChetrd_bufferSizeFortran(
-            handle, uplo, n, (hipFloatComplex*)A, lda, D, E, (hipFloatComplex*)tau, lwork);
+    case C_NORMAL:
+        return hipsolverCsytrs(handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               (hipFloatComplex*)A,
+                               lda,
+                               ipiv,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverCsytrsStridedBatched(handle,
+                                             uplo,
+                                             n,
+                                             nrhs,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             stA,
+                                             ipiv,
+                                             stP,
+                                             (hipFloatComplex*)B,
+                                             ldb,
+                                             stB,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t               API,
-                                                          hipsolverHandle_t       handle,
-                                                          hipsolverFillMode_t     uplo,
-                                                          int                     n,
-                                                          hipsolverDoubleComplex* A,
-                                                          int                     lda,
-                                                          double*                 D,
-                                                          double*                 E,
-                                                          hipsolverDoubleComplex* tau,
-                                                          int*                    lwork)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   A[],
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                ipiv,
+                                                    int                 stP,
+                                                    hipsolverComplex*   B[],
+                                                    int                 ldb,
+                                                    int                 stB,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCsytrsBatched_bufferSize(handle,
+                                                 uplo,
+                                                 n,
+                                                 nrhs,
+                                                 (hipFloatComplex**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (hipFloatComplex**)B,
+                                                 ldb,
+                                                 lwork,
+                                                 bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         hipsolverComplex*   B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZhetrd_bufferSize(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, D, E, (hipDoubleComplex*)tau, lwork);
-    case API_FORTRAN:
-        return hipsolverZhetrd_bufferSizeFortran(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, D, E, (hipDoubleComplex*)tau, lwork);
+    case C_NORMAL:
+        return hipsolverCsytrsBatched(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      (hipFloatComplex**)A,
+                                      lda,
+                                      ipiv,
+                                      (hipFloatComplex**)B,
+                                      ldb,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               float*              A,
-                                               int                 lda,
-                                               int                 stA,
-                                               float*              D,
-                                               int                 stD,
-                                               float*              E,
-                                               int                 stE,
-                                               float*              tau,
-                                               int                 stP,
-                                               float*              work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int64_t             n,
+                                                    int64_t             nrhs,
+                                                    hipsolverComplex*   A,
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    int64_t*            ipiv,
+                                                    int64_t             stP,
+                                                    hipsolverComplex*   B,
+                                                    int64_t             ldb,
+                                                    int64_t             stB,
+                                                    size_t*             lwork,
+                                                    int                 bc)
 {
-    switch(API)
+    size_t lworkOnHost;
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXsytrs_bufferSize(
+            handle, uplo, n, nrhs, HIP_C_32F, A, lda, ipiv, HIP_C_32F, B, ldb, lwork, &lworkOnHost);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               double*             A,
-                                               int                 lda,
-                                               int                 stA,
-                                               double*             D,
-                                               int                 stD,
-                                               double*             E,
-                                               int                 stE,
-                                               double*             tau,
-                                               int                 stP,
-                                               double*             work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int64_t             n,
+                                         int64_t             nrhs,
+                                         hipsolverComplex*   A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         hipsolverComplex*   B,
+                                         int64_t             ldb,
+                                         int64_t             stB,
+                                         hipsolverComplex*   work,
+                                         size_t              lwork,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    size_t lworkOnDevice, lworkOnHost;
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case COMPAT_NORMAL:
+    {
+        hipsolverStatus_t status = hipsolverDnXsytrs_bufferSize(handle,
+                                                                uplo,
+                                                                n,
+                                                                nrhs,
+                                                                HIP_C_32F,
+                                                                A,
+                                                                lda,
+                                                                ipiv,
+                                                                HIP_C_32F,
+                                                                B,
+                                                                ldb,
+                                                                &lworkOnDevice,
+                                                                &lworkOnHost);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        std::vector<char> workOnHost(lworkOnHost);
+        return hipsolverDnXsytrs(handle,
+                                 uplo,
+                                 n,
+                                 nrhs,
+                                 HIP_C_32F,
+                                 A,
+                                 lda,
+                                 ipiv,
+                                 HIP_C_32F,
+                                 B,
+                                 ldb,
+                                 work,
+                                 lwork,
+                                 workOnHost.data(),
+                                 lworkOnHost,
+                                 info);
+    }
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               hipsolverComplex*   A,
-                                               int                 lda,
-                                               int                 stA,
-                                               float*              D,
-                                               int                 stD,
-                                               float*              E,
-                                               int                 stE,
-                                               hipsolverComplex*   tau,
-                                               int                 stP,
-                                               hipsolverComplex*   work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int64_t             n,
+                                                    int64_t             nrhs,
+                                                    hipsolverComplex*   A[],
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    int64_t*            ipiv,
+                                                    int64_t             stP,
+                                                    hipsolverComplex*   B[],
+                                                    int64_t             ldb,
+                                                    int64_t             stB,
+                                                    size_t*             lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverChetrd(handle,
-                               uplo,
-                               n,
-                               (hipFloatComplex*)A,
-                               lda,
-                               D,
-                               E,
-                               (hipFloatComplex*)tau,
-                               (hipFloatComplex*)work,
-                               lwork,
-                               info);
-    case API_FORTRAN:
-        return hipsolverChetrdFortran(handle,
-                                      uplo,
-                                      n,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      D,
-                                      E,
-                                      (hipFloatComplex*)tau,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t               API,
-                                               hipsolverHandle_t       handle,
-                                               hipsolverFillMode_t     uplo,
-                                               int                     n,
-                                               hipsolverDoubleComplex* A,
-                                               int                     lda,
-                                               int                     stA,
-                                               double*                 D,
-                                               int                     stD,
-                                               double*                 E,
-                                               int                     stE,
-                                               hipsolverDoubleComplex* tau,
-                                               int                     stP,
-                                               hipsolverDoubleComplex* work,
-                                               int                     lwork,
-                                               int*                    info,
-                                               int                     bc)
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int64_t             n,
+                                         int64_t             nrhs,
+                                         hipsolverComplex*   A[],
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         hipsolverComplex*   B[],
+                                         int64_t             ldb,
+                                         int64_t             stB,
+                                         hipsolverComplex*   work,
+                                         size_t              lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverZhetrd(handle,
-                               uplo,
-                               n,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               D,
-                               E,
-                               (hipDoubleComplex*)tau,
-                               (hipDoubleComplex*)work,
-                               lwork,
-                               info);
-    case API_FORTRAN:
-        return hipsolverZhetrdFortran(handle,
-                                      uplo,
-                                      n,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      D,
-                                      E,
-                                      (hipDoubleComplex*)tau,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
 
-/******************** SYTRF ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
-    testAPI_t API, hipsolverHandle_t handle, int n, float* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int*                    ipiv,
+                                                    int                     stP,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int                     stB,
+                                                    int*                    lwork,
+                                                    int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSsytrf_bufferSize(handle, n, A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverSsytrf_bufferSizeFortran(handle, n, A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverZsytrs_bufferSize(handle,
+                                          uplo,
+                                          n,
+                                          nrhs,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          ipiv,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          lwork);
+    case C_NORMAL_ALT:
+        return hipsolverZsytrsStridedBatched_bufferSize(handle,
+                                                        uplo,
+                                                        n,
+                                                        nrhs,
+                                                        (hipDoubleComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        ipiv,
+                                                        stP,
+                                                        (hipDoubleComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        lwork,
+                                                        bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
-    testAPI_t API, hipsolverHandle_t handle, int n, double* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t               API,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDsytrf_bufferSize(handle, n, A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverDsytrf_bufferSizeFortran(handle, n, A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverZsytrs(handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               ipiv,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverZsytrsStridedBatched(handle,
+                                             uplo,
+                                             n,
+                                             nrhs,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             stA,
+                                             ipiv,
+                                             stP,
+                                             (hipDoubleComplex*)B,
+                                             ldb,
+                                             stB,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
-    testAPI_t API, hipsolverHandle_t handle, int n, hipsolverComplex* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int*                    ipiv,
+                                                    int                     stP,
+                                                    hipsolverDoubleComplex* B[],
+                                                    int                     ldb,
+                                                    int                     stB,
+                                                    int*                    lwork,
+                                                    int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCsytrf_bufferSize(handle, n, (hipFloatComplex*)A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverCsytrf_bufferSizeFortran(handle, n, (hipFloatComplex*)A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverZsytrsBatched_bufferSize(handle,
+                                                 uplo,
+                                                 n,
+                                                 nrhs,
+                                                 (hipDoubleComplex**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (hipDoubleComplex**)B,
+                                                 ldb,
+                                                 lwork,
+                                                 bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
-    testAPI_t API, hipsolverHandle_t handle, int n, hipsolverDoubleComplex* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t               API,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A[],
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* B[],
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZsytrf_bufferSize(handle, n, (hipDoubleComplex*)A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverZsytrf_bufferSizeFortran(handle, n, (hipDoubleComplex*)A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverZsytrsBatched(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      (hipDoubleComplex**)A,
+                                      lda,
+                                      ipiv,
+                                      (hipDoubleComplex**)B,
+                                      ldb,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A,
-                                         int                 lda,
-                                         int                 stA,
-                                         int*                ipiv,
-                                         int                 stP,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int64_t                 n,
+                                                    int64_t                 nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int64_t                 lda,
+                                                    int64_t                 stA,
+                                                    int64_t*                ipiv,
+                                                    int64_t                 stP,
+                                                    hipsolverDoubleComplex* B,
+                                                    int64_t                 ldb,
+                                                    int64_t                 stB,
+                                                    size_t*                 lwork,
+                                                    int                     bc)
 {
-    switch(API)
+    size_t lworkOnHost;
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSsytrfFortran(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXsytrs_bufferSize(
+            handle, uplo, n, nrhs, HIP_C_64F, A, lda, ipiv, HIP_C_64F, B, ldb, lwork, &lworkOnHost);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A,
-                                         int                 lda,
-                                         int                 stA,
-                                         int*                ipiv,
-                                         int                 stP,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t               API,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int64_t                 n,
+                                         int64_t                 nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int64_t                 lda,
+                                         int64_t                 stA,
+                                         int64_t*                ipiv,
+                                         int64_t                 stP,
+                                         hipsolverDoubleComplex* B,
+                                         int64_t                 ldb,
+                                         int64_t                 stB,
+                                         hipsolverDoubleComplex* work,
+                                         size_t                  lwork,
+                                         int*                    info,
+                                         int                     bc)
 {
-    switch(API)
+    size_t lworkOnDevice, lworkOnHost;
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDsytrfFortran(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    case COMPAT_NORMAL:
+    {
+        hipsolverStatus_t status = hipsolverDnXsytrs_bufferSize(handle,
+                                                                uplo,
+                                                                n,
+                                                                nrhs,
+                                                                HIP_C_64F,
+                                                                A,
+                                                                lda,
+                                                                ipiv,
+                                                                HIP_C_64F,
+                                                                B,
+                                                                ldb,
+                                                                &lworkOnDevice,
+                                                                &lworkOnHost);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        std::vector<char> workOnHost(lworkOnHost);
+        return hipsolverDnXsytrs(handle,
+                                 uplo,
+                                 n,
+                                 nrhs,
+                                 HIP_C_64F,
+                                 A,
+                                 lda,
+                                 ipiv,
+                                 HIP_C_64F,
+                                 B,
+                                 ldb,
+                                 work,
+                                 lwork,
+                                 workOnHost.data(),
+                                 lworkOnHost,
+                                 info);
+    }
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipsolverComplex*   A,
-                                         int                 lda,
-                                         int                 stA,
-                                         int*                ipiv,
-                                         int                 stP,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int64_t                 n,
+                                                    int64_t                 nrhs,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int64_t                 lda,
+                                                    int64_t                 stA,
+                                                    int64_t*                ipiv,
+                                                    int64_t                 stP,
+                                                    hipsolverDoubleComplex* B[],
+                                                    int64_t                 ldb,
+                                                    int64_t                 stB,
+                                                    size_t*                 lwork,
+                                                    int                     bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverCsytrf(
-            handle, uplo, n, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverCsytrfFortran(
-            handle, uplo, n, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)work, lwork, info);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t               API,
+                                         bool                    STRIDED,
                                          hipsolverHandle_t       handle,
                                          hipsolverFillMode_t     uplo,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         int*                    ipiv,
-                                         int                     stP,
+                                         int64_t                 n,
+                                         int64_t                 nrhs,
+                                         hipsolverDoubleComplex* A[],
+                                         int64_t                 lda,
+                                         int64_t                 stA,
+                                         int64_t*                ipiv,
+                                         int64_t                 stP,
+                                         hipsolverDoubleComplex* B[],
+                                         int64_t                 ldb,
+                                         int64_t                 stB,
                                          hipsolverDoubleComplex* work,
-                                         int                     lwork,
+                                         size_t                  lwork,
                                          int*                    info,
                                          int                     bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverZsytrf(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, ipiv, (hipDoubleComplex*)work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverZsytrfFortran(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, ipiv, (hipDoubleComplex*)work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
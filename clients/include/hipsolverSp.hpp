@@ -119,6 +119,50 @@ inline hipsolverStatus_t hipsolver_csrlsvchol(bool                      HOST,
             handle, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
 }
 
+inline hipsolverStatus_t hipsolver_csrlsvchol(bool                      HOST,
+                                              hipsolverSpHandle_t       handle,
+                                              int64_t                   n,
+                                              int64_t                   nnz,
+                                              const hipsparseMatDescr_t descrA,
+                                              const float*              csrVal,
+                                              const int64_t*            csrRowPtr,
+                                              const int64_t*            csrColInd,
+                                              const float*              b,
+                                              float                     tol,
+                                              int                       reorder,
+                                              float*                    x,
+                                              int64_t*                  singularity)
+{
+    if(!HOST)
+        return hipsolverSpScsrlsvchol64(
+            handle, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    else
+        return hipsolverSpScsrlsvcholHost64(
+            handle, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+}
+
+inline hipsolverStatus_t hipsolver_csrlsvchol(bool                      HOST,
+                                              hipsolverSpHandle_t       handle,
+                                              int64_t                   n,
+                                              int64_t                   nnz,
+                                              const hipsparseMatDescr_t descrA,
+                                              const double*             csrVal,
+                                              const int64_t*            csrRowPtr,
+                                              const int64_t*            csrColInd,
+                                              const double*             b,
+                                              double                    tol,
+                                              int                       reorder,
+                                              double*                   x,
+                                              int64_t*                  singularity)
+{
+    if(!HOST)
+        return hipsolverSpDcsrlsvchol64(
+            handle, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    else
+        return hipsolverSpDcsrlsvcholHost64(
+            handle, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+}
+
 /*inline hipsolverStatus_t hipsolver_csrlsvchol(bool                      HOST,
                                               hipsolverSpHandle_t       handle,
                                               int                       n,
@@ -204,6 +248,97 @@ inline hipsolverStatus_t hipsolver_csrlsvchol(bool                          HOST
 }*/
 /********************************************************/
 
+/******************** CSRLSVLDL ********************/
+inline hipsolverStatus_t hipsolver_csrlsvldl(bool                      HOST,
+                                             hipsolverSpHandle_t       handle,
+                                             int                       n,
+                                             int                       nnz,
+                                             const hipsparseMatDescr_t descrA,
+                                             const float*              csrVal,
+                                             const int*                csrRowPtr,
+                                             const int*                csrColInd,
+                                             const float*              b,
+                                             float                     tol,
+                                             int                       reorder,
+                                             float                     perturb,
+                                             float*                    x,
+                                             int*                      singularity)
+{
+    if(!HOST)
+        return hipsolverSpScsrlsvldl(handle,
+                                     n,
+                                     nnz,
+                                     descrA,
+                                     csrVal,
+                                     csrRowPtr,
+                                     csrColInd,
+                                     b,
+                                     tol,
+                                     reorder,
+                                     perturb,
+                                     x,
+                                     singularity);
+    else
+        return hipsolverSpScsrlsvldlHost(handle,
+                                         n,
+                                         nnz,
+                                         descrA,
+                                         csrVal,
+                                         csrRowPtr,
+                                         csrColInd,
+                                         b,
+                                         tol,
+                                         reorder,
+                                         perturb,
+                                         x,
+                                         singularity);
+}
+
+inline hipsolverStatus_t hipsolver_csrlsvldl(bool                      HOST,
+                                             hipsolverSpHandle_t       handle,
+                                             int                       n,
+                                             int                       nnz,
+                                             const hipsparseMatDescr_t descrA,
+                                             const double*             csrVal,
+                                             const int*                csrRowPtr,
+                                             const int*                csrColInd,
+                                             const double*             b,
+                                             double                    tol,
+                                             int                       reorder,
+                                             double                    perturb,
+                                             double*                   x,
+                                             int*                      singularity)
+{
+    if(!HOST)
+        return hipsolverSpDcsrlsvldl(handle,
+                                     n,
+                                     nnz,
+                                     descrA,
+                                     csrVal,
+                                     csrRowPtr,
+                                     csrColInd,
+                                     b,
+                                     tol,
+                                     reorder,
+                                     perturb,
+                                     x,
+                                     singularity);
+    else
+        return hipsolverSpDcsrlsvldlHost(handle,
+                                         n,
+                                         nnz,
+                                         descrA,
+                                         csrVal,
+                                         csrRowPtr,
+                                         csrColInd,
+                                         b,
+                                         tol,
+                                         reorder,
+                                         perturb,
+                                         x,
+                                         singularity);
+}
+
 /******************** CSRLSVQR ********************/
 // normal and strided_batched
 inline hipsolverStatus_t hipsolver_csrlsvqr(bool                      HOST,
@@ -309,4 +444,216 @@ inline hipsolverStatus_t hipsolver_csrlsvqr(bool                          HOST,
     else
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }*/
+/******************** CSRPCG ********************/
+inline hipsolverStatus_t hipsolver_csrpcg(bool                      HOST,
+                                          hipsolverSpHandle_t       handle,
+                                          int                       n,
+                                          int                       nnz,
+                                          const hipsparseMatDescr_t descrA,
+                                          const float*              csrVal,
+                                          const int*                csrRowPtr,
+                                          const int*                csrColInd,
+                                          const float*              b,
+                                          float                     tol,
+                                          int                       maxiter,
+                                          hipsolverSpPrecond_t      precond,
+                                          int                       reusePrecond,
+                                          float*                    x,
+                                          int*                      niters,
+                                          float*                    resHistory)
+{
+    if(!HOST)
+        return hipsolverSpScsrpcg(handle,
+                                  n,
+                                  nnz,
+                                  descrA,
+                                  csrVal,
+                                  csrRowPtr,
+                                  csrColInd,
+                                  b,
+                                  tol,
+                                  maxiter,
+                                  precond,
+                                  reusePrecond,
+                                  x,
+                                  niters,
+                                  resHistory);
+    else
+        return hipsolverSpScsrpcgHost(handle,
+                                      n,
+                                      nnz,
+                                      descrA,
+                                      csrVal,
+                                      csrRowPtr,
+                                      csrColInd,
+                                      b,
+                                      tol,
+                                      maxiter,
+                                      precond,
+                                      reusePrecond,
+                                      x,
+                                      niters,
+                                      resHistory);
+}
+
+inline hipsolverStatus_t hipsolver_csrpcg(bool                      HOST,
+                                          hipsolverSpHandle_t       handle,
+                                          int                       n,
+                                          int                       nnz,
+                                          const hipsparseMatDescr_t descrA,
+                                          const double*             csrVal,
+                                          const int*                csrRowPtr,
+                                          const int*                csrColInd,
+                                          const double*             b,
+                                          double                    tol,
+                                          int                       maxiter,
+                                          hipsolverSpPrecond_t      precond,
+                                          int                       reusePrecond,
+                                          double*                   x,
+                                          int*                      niters,
+                                          double*                   resHistory)
+{
+    if(!HOST)
+        return hipsolverSpDcsrpcg(handle,
+                                  n,
+                                  nnz,
+                                  descrA,
+                                  csrVal,
+                                  csrRowPtr,
+                                  csrColInd,
+                                  b,
+                                  tol,
+                                  maxiter,
+                                  precond,
+                                  reusePrecond,
+                                  x,
+                                  niters,
+                                  resHistory);
+    else
+        return hipsolverSpDcsrpcgHost(handle,
+                                      n,
+                                      nnz,
+                                      descrA,
+                                      csrVal,
+                                      csrRowPtr,
+                                      csrColInd,
+                                      b,
+                                      tol,
+                                      maxiter,
+                                      precond,
+                                      reusePrecond,
+                                      x,
+                                      niters,
+                                      resHistory);
+}
+
+/******************** CSRGMRES ********************/
+inline hipsolverStatus_t hipsolver_csrgmres(bool                      HOST,
+                                            hipsolverSpHandle_t       handle,
+                                            int                       n,
+                                            int                       nnz,
+                                            const hipsparseMatDescr_t descrA,
+                                            const float*              csrVal,
+                                            const int*                csrRowPtr,
+                                            const int*                csrColInd,
+                                            const float*              b,
+                                            float                     tol,
+                                            int                       maxiter,
+                                            int                       restart,
+                                            hipsolverSpPrecond_t      precond,
+                                            int                       reusePrecond,
+                                            float*                    x,
+                                            int*                      niters,
+                                            float*                    resHistory)
+{
+    if(!HOST)
+        return hipsolverSpScsrgmres(handle,
+                                    n,
+                                    nnz,
+                                    descrA,
+                                    csrVal,
+                                    csrRowPtr,
+                                    csrColInd,
+                                    b,
+                                    tol,
+                                    maxiter,
+                                    restart,
+                                    precond,
+                                    reusePrecond,
+                                    x,
+                                    niters,
+                                    resHistory);
+    else
+        return hipsolverSpScsrgmresHost(handle,
+                                        n,
+                                        nnz,
+                                        descrA,
+                                        csrVal,
+                                        csrRowPtr,
+                                        csrColInd,
+                                        b,
+                                        tol,
+                                        maxiter,
+                                        restart,
+                                        precond,
+                                        reusePrecond,
+                                        x,
+                                        niters,
+                                        resHistory);
+}
+
+inline hipsolverStatus_t hipsolver_csrgmres(bool                      HOST,
+                                            hipsolverSpHandle_t       handle,
+                                            int                       n,
+                                            int                       nnz,
+                                            const hipsparseMatDescr_t descrA,
+                                            const double*             csrVal,
+                                            const int*                csrRowPtr,
+                                            const int*                csrColInd,
+                                            const double*             b,
+                                            double                    tol,
+                                            int                       maxiter,
+                                            int                       restart,
+                                            hipsolverSpPrecond_t      precond,
+                                            int                       reusePrecond,
+                                            double*                   x,
+                                            int*                      niters,
+                                            double*                   resHistory)
+{
+    if(!HOST)
+        return hipsolverSpDcsrgmres(handle,
+                                    n,
+                                    nnz,
+                                    descrA,
+                                    csrVal,
+                                    csrRowPtr,
+                                    csrColInd,
+                                    b,
+                                    tol,
+                                    maxiter,
+                                    restart,
+                                    precond,
+                                    reusePrecond,
+                                    x,
+                                    niters,
+                                    resHistory);
+    else
+        return hipsolverSpDcsrgmresHost(handle,
+                                        n,
+                                        nnz,
+                                        descrA,
+                                        csrVal,
+                                        csrRowPtr,
+                                        csrColInd,
+                                        b,
+                                        tol,
+                                        maxiter,
+                                        restart,
+                                        precond,
+                                        reusePrecond,
+                                        x,
+                                        niters,
+                                        resHistory);
+}
+
 /********************************************************/
@@ -106,3 +106,5 @@ hipsolverEigMode_t char2hipsolver_evect(char value);
 hipsolverEigType_t char2hipsolver_eform(char value);
 
 hipsolverEigRange_t char2hipsolver_erange(char value);
+
+hipsolverSyevAlgorithm_t char2hipsolver_syev_alg(char value);
@@ -33,6 +33,8 @@
 #include "testing_gesv.hpp"
 #include "testing_gesvd.hpp"
 #include "testing_gesvda.hpp"
+#include "testing_gesvdp.hpp"
+#include "testing_gesvdr.hpp"
 #include "testing_gesvdj.hpp"
 #include "testing_getrf.hpp"
 #include "testing_getrs.hpp"
@@ -44,6 +46,7 @@
 #include "testing_potrf.hpp"
 #include "testing_potri.hpp"
 #include "testing_potrs.hpp"
+#include "testing_syev_auto.hpp"
 #include "testing_syevd_heevd.hpp"
 #include "testing_syevdx_heevdx.hpp"
 #include "testing_syevj_heevj.hpp"
@@ -52,10 +55,14 @@
 #include "testing_sygvj_hegvj.hpp"
 #include "testing_sytrd_hetrd.hpp"
 #include "testing_sytrf.hpp"
+#include "testing_sytrs.hpp"
 
 #ifdef HAVE_HIPSPARSE
+#include "testing_csrgmres.hpp"
 #include "testing_csrlsvchol.hpp"
+#include "testing_csrlsvldl.hpp"
 #include "testing_csrlsvqr.hpp"
+#include "testing_csrpcg.hpp"
 #endif
 
 struct str_less
@@ -81,21 +88,32 @@ class hipsolver_dispatcher
             {"gels", testing_gels<API_NORMAL, false, false, false, T>},
             {"geqrf", testing_geqrf<API_NORMAL, false, false, T, int, int>},
             {"geqrf_64", testing_geqrf<API_COMPAT, false, false, T, int64_t, size_t>},
+            {"geqrf_strided_batched", testing_geqrf<API_NORMAL, false, true, T, int, int>},
             {"gesv", testing_gesv<API_NORMAL, false, false, false, T>},
             {"gesvd", testing_gesvd<API_NORMAL, false, false, false, T>},
+            {"gesvd_strided_batched", testing_gesvd<API_NORMAL, false, true, false, T>},
             {"gesvda_strided_batched", testing_gesvda<API_COMPAT, false, true, T>},
+            {"gesvdp", testing_gesvdp<API_COMPAT, T>},
+            {"gesvdr", testing_gesvdr<API_COMPAT, false, T>},
+            {"gesvdr_strided_batched", testing_gesvdr<API_COMPAT, true, T>},
             {"gesvdj", testing_gesvdj<API_NORMAL, false, false, T>},
             {"gesvdj_batched", testing_gesvdj<API_NORMAL, false, true, T>},
             {"getrf", testing_getrf<API_NORMAL, false, false, false, T, int, int>},
             {"getrf_64", testing_getrf<API_COMPAT, false, false, false, T, int64_t, size_t>},
+            {"getrf_strided_batched", testing_getrf<API_NORMAL, false, true, false, T, int, int>},
             {"getrs", testing_getrs<API_NORMAL, false, false, T, int, int>},
             {"getrs_64", testing_getrs<API_COMPAT, false, false, T, int64_t, size_t>},
+            {"getrs_strided_batched", testing_getrs<API_NORMAL, false, true, T, int, int>},
             {"potrf", testing_potrf<API_NORMAL, false, false, T>},
             {"potrf_batched", testing_potrf<API_NORMAL, true, false, T>},
             {"potri", testing_potri<API_NORMAL, false, false, T>},
             {"potrs", testing_potrs<API_NORMAL, false, false, T>},
             {"potrs_batched", testing_potrs<API_NORMAL, true, false, T>},
             {"sytrf", testing_sytrf<API_NORMAL, false, false, T>},
+            {"sytrs", testing_sytrs<API_NORMAL, false, false, T, int, int>},
+            {"sytrs_batched", testing_sytrs<API_NORMAL, true, false, T, int, int>},
+            {"sytrs_strided_batched", testing_sytrs<API_NORMAL, false, true, T, int, int>},
+            {"sytrs_64", testing_sytrs<API_COMPAT, false, false, T, int64_t, size_t>},
         };
 
         // Grab function from the map and execute
@@ -119,11 +137,15 @@ class hipsolver_dispatcher
             {"orgtr", testing_orgtr_ungtr<API_NORMAL, T>},
             {"ormqr", testing_ormqr_unmqr<API_NORMAL, T>},
             {"ormtr", testing_ormtr_unmtr<API_NORMAL, T>},
+            {"syev_auto", testing_syev_auto<API_COMPAT, T>},
+            {"syev_auto_tune", tune_syev_auto<API_COMPAT, T>},
             {"syevd", testing_syevd_heevd<API_NORMAL, false, false, T>},
+            {"syevd_strided_batched", testing_syevd_heevd<API_NORMAL, false, true, T>},
             {"syevdx", testing_syevdx_heevdx<API_NORMAL, false, false, T>},
             {"syevj", testing_syevj_heevj<API_NORMAL, false, false, T>},
             {"syevj_batched", testing_syevj_heevj<API_NORMAL, false, true, T>},
             {"sygvd", testing_sygvd_hegvd<API_NORMAL, false, false, T>},
+            {"sygvd_strided_batched", testing_sygvd_hegvd<API_NORMAL, false, true, T>},
             {"sygvdx", testing_sygvdx_hegvdx<API_NORMAL, false, false, T>},
             {"sygvj", testing_sygvj_hegvj<API_NORMAL, false, false, T>},
             {"sytrd", testing_sytrd_hetrd<API_NORMAL, false, false, T>},
@@ -131,7 +153,15 @@ class hipsolver_dispatcher
 #ifdef HAVE_HIPSPARSE
             {"csrlsvchol", testing_csrlsvchol<false, T>},
             {"csrlsvcholHost", testing_csrlsvchol<true, T>},
+            {"csrlsvchol_64", testing_csrlsvchol<false, T, int64_t>},
+            {"csrlsvcholHost_64", testing_csrlsvchol<true, T, int64_t>},
+            {"csrlsvldl", testing_csrlsvldl<false, T>},
+            {"csrlsvldlHost", testing_csrlsvldl<true, T>},
             {"csrlsvqr", testing_csrlsvqr<false, T>},
+            {"csrpcg", testing_csrpcg<false, T>},
+            {"csrpcgHost", testing_csrpcg<true, T>},
+            {"csrgmres", testing_csrgmres<false, T>},
+            {"csrgmresHost", testing_csrgmres<true, T>},
 #endif
         };
 
@@ -156,11 +186,15 @@ class hipsolver_dispatcher
             {"ungtr", testing_orgtr_ungtr<API_NORMAL, T>},
             {"unmqr", testing_ormqr_unmqr<API_NORMAL, T>},
             {"unmtr", testing_ormtr_unmtr<API_NORMAL, T>},
+            {"heev_auto", testing_syev_auto<API_COMPAT, T>},
+            {"heev_auto_tune", tune_syev_auto<API_COMPAT, T>},
             {"heevd", testing_syevd_heevd<API_NORMAL, false, false, T>},
+            {"heevd_strided_batched", testing_syevd_heevd<API_NORMAL, false, true, T>},
             {"heevdx", testing_syevdx_heevdx<API_NORMAL, false, false, T>},
             {"heevj", testing_syevj_heevj<API_NORMAL, false, false, T>},
             {"heevj_batched", testing_syevj_heevj<API_NORMAL, false, true, T>},
             {"hegvd", testing_sygvd_hegvd<API_NORMAL, false, false, T>},
+            {"hegvd_strided_batched", testing_sygvd_hegvd<API_NORMAL, false, true, T>},
             {"hegvdx", testing_sygvdx_hegvdx<API_NORMAL, false, false, T>},
             {"hegvj", testing_sygvj_hegvj<API_NORMAL, false, false, T>},
             {"hetrd", testing_sytrd_hetrd<API_NORMAL, false, false, T>},
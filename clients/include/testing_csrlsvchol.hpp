@@ -7,17 +7,17 @@
 #include "clientcommon.hpp"
 #include "hipsolverSp.hpp"
 
-template <bool HOST, typename T>
+template <bool HOST, typename T, typename I>
 void csrlsvchol_checkBadArgs(hipsolverSpHandle_t       handle,
-                             const int                 n,
-                             const int                 nnzA,
+                             const I                   n,
+                             const I                   nnzA,
                              const hipsparseMatDescr_t descrA,
-                             int*                      ptrA,
-                             int*                      indA,
+                             I*                        ptrA,
+                             I*                        indA,
                              T                         valA,
                              T                         B,
                              T                         X,
-                             int*                      singularity)
+                             I*                        singularity)
 {
     // handle
     EXPECT_ROCBLAS_STATUS(
@@ -40,11 +40,11 @@ void csrlsvchol_checkBadArgs(hipsolverSpHandle_t       handle,
         HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(
         hipsolver_csrlsvchol(
-            HOST, handle, n, nnzA, descrA, valA, (int*)nullptr, indA, B, 0, 0, X, singularity),
+            HOST, handle, n, nnzA, descrA, valA, (I*)nullptr, indA, B, 0, 0, X, singularity),
         HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(
         hipsolver_csrlsvchol(
-            HOST, handle, n, nnzA, descrA, valA, ptrA, (int*)nullptr, B, 0, 0, X, singularity),
+            HOST, handle, n, nnzA, descrA, valA, ptrA, (I*)nullptr, B, 0, 0, X, singularity),
         HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(
         hipsolver_csrlsvchol(
@@ -57,13 +57,13 @@ void csrlsvchol_checkBadArgs(hipsolverSpHandle_t       handle,
 #endif
 }
 
-template <bool HOST, typename T>
+template <bool HOST, typename T, typename I = int>
 void testing_csrlsvchol_bad_arg()
 {
     // safe arguments
     hipsolverSp_local_handle handle;
-    int                      n    = 1;
-    int                      nnzA = 1;
+    I                        n    = 1;
+    I                        nnzA = 1;
 
     hipsparse_local_mat_descr descrA;
     hipsparseSetMatType(descrA, HIPSPARSE_MATRIX_TYPE_GENERAL);
@@ -72,12 +72,12 @@ void testing_csrlsvchol_bad_arg()
     if(HOST)
     {
         // memory allocations
-        host_strided_batch_vector<int> singularity(1, 1, 1, 1);
-        host_strided_batch_vector<int> ptrA(1, 1, 1, 1);
-        host_strided_batch_vector<int> indA(1, 1, 1, 1);
-        host_strided_batch_vector<T>   valA(1, 1, 1, 1);
-        host_strided_batch_vector<T>   B(1, 1, 1, 1);
-        host_strided_batch_vector<T>   X(1, 1, 1, 1);
+        host_strided_batch_vector<I> singularity(1, 1, 1, 1);
+        host_strided_batch_vector<I> ptrA(1, 1, 1, 1);
+        host_strided_batch_vector<I> indA(1, 1, 1, 1);
+        host_strided_batch_vector<T> valA(1, 1, 1, 1);
+        host_strided_batch_vector<T> B(1, 1, 1, 1);
+        host_strided_batch_vector<T> X(1, 1, 1, 1);
 
         // check bad arguments
         csrlsvchol_checkBadArgs<HOST>(handle,
@@ -94,12 +94,12 @@ void testing_csrlsvchol_bad_arg()
     else
     {
         // memory allocations
-        host_strided_batch_vector<int>   singularity(1, 1, 1, 1);
-        device_strided_batch_vector<int> ptrA(1, 1, 1, 1);
-        device_strided_batch_vector<int> indA(1, 1, 1, 1);
-        device_strided_batch_vector<T>   valA(1, 1, 1, 1);
-        device_strided_batch_vector<T>   B(1, 1, 1, 1);
-        device_strided_batch_vector<T>   X(1, 1, 1, 1);
+        host_strided_batch_vector<I>   singularity(1, 1, 1, 1);
+        device_strided_batch_vector<I> ptrA(1, 1, 1, 1);
+        device_strided_batch_vector<I> indA(1, 1, 1, 1);
+        device_strided_batch_vector<T> valA(1, 1, 1, 1);
+        device_strided_batch_vector<T> B(1, 1, 1, 1);
+        device_strided_batch_vector<T> X(1, 1, 1, 1);
         CHECK_HIP_ERROR(ptrA.memcheck());
         CHECK_HIP_ERROR(indA.memcheck());
         CHECK_HIP_ERROR(valA.memcheck());
@@ -120,10 +120,17 @@ void testing_csrlsvchol_bad_arg()
     }
 }
 
-template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool CPU,
+          bool GPU,
+          typename T,
+          typename I,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
 void csrlsvchol_initData(hipsolverSpHandle_t handle,
-                         const int           n,
-                         const int           nnzA,
+                         const I             n,
+                         const I             nnzA,
                          hipsparseMatDescr_t descrA,
                          Ud&                 dptrA,
                          Ud&                 dindA,
@@ -165,10 +172,10 @@ void csrlsvchol_initData(hipsolverSpHandle_t handle,
         hipsparseIndexBase_t indbase = hipsparseGetMatIndexBase(descrA);
         if(indbase == HIPSPARSE_INDEX_BASE_ONE)
         {
-            for(rocblas_int i = 0; i <= n; i++)
+            for(I i = 0; i <= n; i++)
                 hptrA[0][i]++;
 
-            for(rocblas_int i = 0; i < nnzA; i++)
+            for(I i = 0; i < nnzA; i++)
                 hindA[0][i]++;
         }
     }
@@ -182,10 +189,17 @@ void csrlsvchol_initData(hipsolverSpHandle_t handle,
     }
 }
 
-template <bool HOST, typename T, typename S, typename Td, typename Ud, typename Th, typename Uh>
+template <bool HOST,
+          typename T,
+          typename S,
+          typename I,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
 void csrlsvchol_getError(hipsolverSpHandle_t       handle,
-                         const int                 n,
-                         const int                 nnzA,
+                         const I                   n,
+                         const I                   nnzA,
                          const hipsparseMatDescr_t descrA,
                          Ud&                       dptrA,
                          Ud&                       dindA,
@@ -233,19 +247,57 @@ void csrlsvchol_getError(hipsolverSpHandle_t       handle,
     err      = norm_error('I', n, 1, n, hX[0], hXRes[0]);
     *max_err = err > *max_err ? err : *max_err;
 
-    // TODO: Add non-positive definite test matrices
     // also check info for singularities
     err = 0;
     EXPECT_EQ(hSingularity[0][0], -1);
     if(hSingularity[0][0] != -1)
         err++;
+
+    // negate the last diagonal entry so that A is no longer positive definite, and check that
+    // the failed pivot is reported
+    if(n > 0)
+    {
+        int base = (hipsparseGetMatIndexBase(descrA) == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+        for(I k = hptrA[0][n - 1] - base; k < hptrA[0][n] - base; k++)
+        {
+            if(hindA[0][k] - base == n - 1)
+                hvalA[0][k] = -hvalA[0][k];
+        }
+        CHECK_HIP_ERROR(dvalA.transfer_from(hvalA));
+
+        CHECK_ROCBLAS_ERROR(hipsolver_csrlsvchol(HOST,
+                                                 handle,
+                                                 n,
+                                                 nnzA,
+                                                 descrA,
+                                                 dvalA.data(),
+                                                 dptrA.data(),
+                                                 dindA.data(),
+                                                 dB.data(),
+                                                 tolerance,
+                                                 reorder,
+                                                 dX.data(),
+                                                 hSingularity.data()));
+
+        EXPECT_GE(hSingularity[0][0], 0);
+        EXPECT_LT(hSingularity[0][0], n);
+        if(hSingularity[0][0] < 0 || hSingularity[0][0] >= n)
+            err++;
+    }
     *max_err += err;
 }
 
-template <bool HOST, typename T, typename S, typename Td, typename Ud, typename Th, typename Uh>
+template <bool HOST,
+          typename T,
+          typename S,
+          typename I,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
 void csrlsvchol_getPerfData(hipsolverSpHandle_t       handle,
-                            const int                 n,
-                            const int                 nnzA,
+                            const I                   n,
+                            const I                   nnzA,
                             const hipsparseMatDescr_t descrA,
                             Ud&                       dptrA,
                             Ud&                       dindA,
@@ -262,6 +314,7 @@ void csrlsvchol_getPerfData(hipsolverSpHandle_t       handle,
                             Uh&                       hSingularity,
                             double*                   gpu_time_used,
                             double*                   cpu_time_used,
+                            double*                   host_mem_used,
                             const int                 hot_calls,
                             const bool                perf,
                             const fs::path            testcase)
@@ -307,7 +360,7 @@ void csrlsvchol_getPerfData(hipsolverSpHandle_t       handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    double start, host_mem;
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
@@ -326,6 +379,10 @@ void csrlsvchol_getPerfData(hipsolverSpHandle_t       handle,
                                             hX,
                                             testcase);
 
+        // peak host memory allocated by a single call
+        reset_host_peak_memory();
+        host_mem = get_host_memory_kb();
+
         start = get_time_us_sync(stream);
         hipsolver_csrlsvchol(HOST,
                              handle,
@@ -341,19 +398,22 @@ void csrlsvchol_getPerfData(hipsolverSpHandle_t       handle,
                              dX.data(),
                              hSingularity.data());
         *gpu_time_used += get_time_us_sync(stream) - start;
+
+        host_mem       = get_host_peak_memory_kb() - host_mem;
+        *host_mem_used = iter == 0 ? host_mem : std::max(*host_mem_used, host_mem);
     }
     *gpu_time_used /= hot_calls;
 }
 
-template <bool HOST, typename T>
+template <bool HOST, typename T, typename I = int>
 void testing_csrlsvchol(Arguments& argus)
 {
     using S = decltype(std::real(T{}));
 
     // get arguments
     hipsolverSp_local_handle handle;
-    int                      n         = argus.get<int>("n");
-    int                      nnzA      = argus.get<int>("nnzA");
+    I                        n         = argus.get<int>("n");
+    I                        nnzA      = argus.get<int>("nnzA");
     double                   tolerance = argus.get<double>("tolerance", 0);
     int                      reorder   = argus.get<int>("reorder", 0);
     int                      base1     = argus.get<int>("base1", 0);
@@ -372,13 +432,13 @@ void testing_csrlsvchol(Arguments& argus)
                                                    nnzA,
                                                    (hipsparseMatDescr_t) nullptr,
                                                    (T*)nullptr,
-                                                   (int*)nullptr,
-                                                   (int*)nullptr,
+                                                   (I*)nullptr,
+                                                   (I*)nullptr,
                                                    (T*)nullptr,
                                                    tolerance,
                                                    reorder,
                                                    (T*)nullptr,
-                                                   (int*)nullptr),
+                                                   (I*)nullptr),
                               HIPSOLVER_STATUS_INVALID_VALUE);
 
         if(argus.timing)
@@ -442,7 +502,7 @@ void testing_csrlsvchol(Arguments& argus)
     if(argus.unit_check || argus.norm_check)
         size_BXres = size_BX;
 
-    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0, host_mem_used = 0;
 
     // memory allocations (all cases)
     hipsparse_local_mat_descr descrA;
@@ -452,22 +512,22 @@ void testing_csrlsvchol(Arguments& argus)
     else
         hipsparseSetMatIndexBase(descrA, HIPSPARSE_INDEX_BASE_ONE);
 
-    host_strided_batch_vector<int> hptrA(size_ptrA, 1, size_ptrA, 1);
-    host_strided_batch_vector<int> hindA(size_indA, 1, size_indA, 1);
-    host_strided_batch_vector<T>   hvalA(size_valA, 1, size_valA, 1);
-    host_strided_batch_vector<T>   hB(size_BX, 1, size_BX, 1);
-    host_strided_batch_vector<T>   hX(size_BX, 1, size_BX, 1);
-    host_strided_batch_vector<T>   hXRes(size_BXres, 1, size_BXres, 1);
-    host_strided_batch_vector<int> hSingularity(1, 1, 1, 1);
+    host_strided_batch_vector<I> hptrA(size_ptrA, 1, size_ptrA, 1);
+    host_strided_batch_vector<I> hindA(size_indA, 1, size_indA, 1);
+    host_strided_batch_vector<T> hvalA(size_valA, 1, size_valA, 1);
+    host_strided_batch_vector<T> hB(size_BX, 1, size_BX, 1);
+    host_strided_batch_vector<T> hX(size_BX, 1, size_BX, 1);
+    host_strided_batch_vector<T> hXRes(size_BXres, 1, size_BXres, 1);
+    host_strided_batch_vector<I> hSingularity(1, 1, 1, 1);
 
     if(HOST)
     {
         // memory allocations
-        host_strided_batch_vector<int> dptrA(size_ptrA, 1, size_ptrA, 1);
-        host_strided_batch_vector<int> dindA(size_indA, 1, size_indA, 1);
-        host_strided_batch_vector<T>   dvalA(size_valA, 1, size_valA, 1);
-        host_strided_batch_vector<T>   dB(size_BX, 1, size_BX, 1);
-        host_strided_batch_vector<T>   dX(size_BX, 1, size_BX, 1);
+        host_strided_batch_vector<I> dptrA(size_ptrA, 1, size_ptrA, 1);
+        host_strided_batch_vector<I> dindA(size_indA, 1, size_indA, 1);
+        host_strided_batch_vector<T> dvalA(size_valA, 1, size_valA, 1);
+        host_strided_batch_vector<T> dB(size_BX, 1, size_BX, 1);
+        host_strided_batch_vector<T> dX(size_BX, 1, size_BX, 1);
         CHECK_HIP_ERROR(dptrA.memcheck());
         if(size_indA)
             CHECK_HIP_ERROR(dindA.memcheck());
@@ -522,6 +582,7 @@ void testing_csrlsvchol(Arguments& argus)
                                             hSingularity,
                                             &gpu_time_used,
                                             &cpu_time_used,
+                                            &host_mem_used,
                                             hot_calls,
                                             argus.perf,
                                             testcase);
@@ -530,11 +591,11 @@ void testing_csrlsvchol(Arguments& argus)
     else
     {
         // memory allocations
-        device_strided_batch_vector<int> dptrA(size_ptrA, 1, size_ptrA, 1);
-        device_strided_batch_vector<int> dindA(size_indA, 1, size_indA, 1);
-        device_strided_batch_vector<T>   dvalA(size_valA, 1, size_valA, 1);
-        device_strided_batch_vector<T>   dB(size_BX, 1, size_BX, 1);
-        device_strided_batch_vector<T>   dX(size_BX, 1, size_BX, 1);
+        device_strided_batch_vector<I> dptrA(size_ptrA, 1, size_ptrA, 1);
+        device_strided_batch_vector<I> dindA(size_indA, 1, size_indA, 1);
+        device_strided_batch_vector<T> dvalA(size_valA, 1, size_valA, 1);
+        device_strided_batch_vector<T> dB(size_BX, 1, size_BX, 1);
+        device_strided_batch_vector<T> dX(size_BX, 1, size_BX, 1);
         CHECK_HIP_ERROR(dptrA.memcheck());
         if(size_indA)
             CHECK_HIP_ERROR(dindA.memcheck());
@@ -589,6 +650,7 @@ void testing_csrlsvchol(Arguments& argus)
                                             hSingularity,
                                             &gpu_time_used,
                                             &cpu_time_used,
+                                            &host_mem_used,
                                             hot_calls,
                                             argus.perf,
                                             testcase);
@@ -615,13 +677,13 @@ void testing_csrlsvchol(Arguments& argus)
             std::cerr << "============================================\n";
             if(argus.norm_check)
             {
-                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
-                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "host_peak_kb", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, host_mem_used, max_error);
             }
             else
             {
-                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
-                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "host_peak_kb");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, host_mem_used);
             }
             std::cerr << std::endl;
         }
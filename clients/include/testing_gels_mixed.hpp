@@ -0,0 +1,462 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "testing_gels.hpp"
+
+template <testAPI_t API, bool HALF, typename T>
+void gels_mixed_checkBadArgs(const hipsolverHandle_t handle,
+                             const int               m,
+                             const int               n,
+                             const int               nrhs,
+                             T                       dA,
+                             const int               lda,
+                             T                       dB,
+                             const int               ldb,
+                             T                       dX,
+                             const int               ldx,
+                             T                       dWork,
+                             const size_t            lwork,
+                             int*                    niters,
+                             int*                    dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels_mixed(API,
+                                               HALF,
+                                               nullptr,
+                                               m,
+                                               n,
+                                               nrhs,
+                                               dA,
+                                               lda,
+                                               dB,
+                                               ldb,
+                                               dX,
+                                               ldx,
+                                               dWork,
+                                               lwork,
+                                               niters,
+                                               dInfo),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    // N/A
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels_mixed(API,
+                                               HALF,
+                                               handle,
+                                               m,
+                                               n,
+                                               nrhs,
+                                               (T) nullptr,
+                                               lda,
+                                               dB,
+                                               ldb,
+                                               dX,
+                                               ldx,
+                                               dWork,
+                                               lwork,
+                                               niters,
+                                               dInfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels_mixed(API,
+                                               HALF,
+                                               handle,
+                                               m,
+                                               n,
+                                               nrhs,
+                                               dA,
+                                               lda,
+                                               (T) nullptr,
+                                               ldb,
+                                               dX,
+                                               ldx,
+                                               dWork,
+                                               lwork,
+                                               niters,
+                                               dInfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels_mixed(API,
+                                               HALF,
+                                               handle,
+                                               m,
+                                               n,
+                                               nrhs,
+                                               dA,
+                                               lda,
+                                               dB,
+                                               ldb,
+                                               (T) nullptr,
+                                               ldx,
+                                               dWork,
+                                               lwork,
+                                               niters,
+                                               dInfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels_mixed(API,
+                                               HALF,
+                                               handle,
+                                               m,
+                                               n,
+                                               nrhs,
+                                               dA,
+                                               lda,
+                                               dB,
+                                               ldb,
+                                               dX,
+                                               ldx,
+                                               dWork,
+                                               lwork,
+                                               (int*)nullptr,
+                                               dInfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels_mixed(API,
+                                               HALF,
+                                               handle,
+                                               m,
+                                               n,
+                                               nrhs,
+                                               dA,
+                                               lda,
+                                               dB,
+                                               ldb,
+                                               dX,
+                                               ldx,
+                                               dWork,
+                                               lwork,
+                                               niters,
+                                               (int*)nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, bool HALF, typename T>
+void testing_gels_mixed_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    m    = 1;
+    int                    n    = 1;
+    int                    nrhs = 1;
+    int                    lda  = 1;
+    int                    ldb  = 1;
+    int                    ldx  = 1;
+
+    // memory allocations
+    host_strided_batch_vector<int>   hNiters(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dB(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dX(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dX.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    size_t size_W;
+    hipsolver_gels_mixed_bufferSize(
+        API, HALF, handle, m, n, nrhs, dA.data(), lda, dB.data(), ldb, dX.data(), ldx, &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    gels_mixed_checkBadArgs<API, HALF>(handle,
+                                       m,
+                                       n,
+                                       nrhs,
+                                       dA.data(),
+                                       lda,
+                                       dB.data(),
+                                       ldb,
+                                       dX.data(),
+                                       ldx,
+                                       dWork.data(),
+                                       size_W,
+                                       hNiters.data(),
+                                       dInfo.data());
+}
+
+template <testAPI_t API,
+          bool      HALF,
+          bool      INPLACE,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
+void gels_mixed_getError(const hipsolverHandle_t handle,
+                         const int               m,
+                         const int               n,
+                         const int               nrhs,
+                         Td&                     dA,
+                         const int               lda,
+                         Td&                     dB,
+                         const int               ldb,
+                         Td&                     dX,
+                         const int               ldx,
+                         Td&                     dWork,
+                         const size_t            lwork,
+                         Ud&                     dInfo,
+                         Th&                     hA,
+                         Th&                     hARes,
+                         Th&                     hB,
+                         Th&                     hBRes,
+                         Th&                     hX,
+                         Th&                     hXRes,
+                         Uh&                     hNiters,
+                         Uh&                     hInfo,
+                         Uh&                     hInfoRes,
+                         const bool              overflow,
+                         double*                 max_err)
+{
+    int            ldres = !INPLACE ? ldx : ldb;
+    int            sizeW = max(1, min(m, n) + max(min(m, n), nrhs));
+    std::vector<T> hW(sizeW);
+
+    // input data initialization
+    // (if overflow is set, the data is scaled beyond the range of the lower precision, which
+    // forces the full-precision fallback; the scale is kept small enough for the Householder
+    // reflectors of the fallback not to overflow in double precision)
+    gels_initData<true, false, T>(
+        handle, m, n, nrhs, dA, lda, lda * n, dB, ldb, ldb * nrhs, dInfo, 1, hA, hB, hX, hInfo);
+    if(overflow)
+    {
+        const T scale(1e40);
+        for(size_t i = 0; i < size_t(lda) * n; i++)
+            hA[0][i] *= scale;
+        for(size_t i = 0; i < size_t(ldb) * nrhs; i++)
+            hB[0][i] *= scale;
+        for(size_t i = 0; i < size_t(max(m, n)) * nrhs; i++)
+            hX[0][i] *= scale;
+    }
+    gels_initData<false, true, T>(
+        handle, m, n, nrhs, dA, lda, lda * n, dB, ldb, ldb * nrhs, dInfo, 1, hA, hB, hX, hInfo);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_gels_mixed(API,
+                                             HALF,
+                                             handle,
+                                             m,
+                                             n,
+                                             nrhs,
+                                             dA.data(),
+                                             lda,
+                                             dB.data(),
+                                             ldb,
+                                             !INPLACE ? dX.data() : dB.data(),
+                                             ldres,
+                                             dWork.data(),
+                                             lwork,
+                                             hNiters.data(),
+                                             dInfo.data()));
+    if(!INPLACE)
+        CHECK_HIP_ERROR(hXRes.transfer_from(dX));
+    else
+        CHECK_HIP_ERROR(hXRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // the refinement converges for the well-conditioned data, and then leaves A unchanged;
+    // data that overflows is reported as such (niters = -2)
+    double err = 0;
+    if(!overflow)
+    {
+        EXPECT_GE(hNiters[0][0], 0);
+        if(hNiters[0][0] < 0)
+            err++;
+
+        for(size_t i = 0; i < size_t(lda) * n; i++)
+        {
+            if(hARes[0][i] != hA[0][i])
+            {
+                err++;
+                break;
+            }
+        }
+        EXPECT_EQ(err, 0) << "A was modified although the refinement converged";
+    }
+    else
+    {
+        EXPECT_EQ(hNiters[0][0], -2);
+        if(hNiters[0][0] != -2)
+            err++;
+    }
+
+    // CPU lapack
+    cpu_gels(HIPSOLVER_OP_N, m, n, nrhs, hA[0], lda, hX[0], max(m, n), hW.data(), sizeW, hInfo[0]);
+
+    // error is ||hX - hXRes|| / ||hX||, and B must be unchanged if it is not X
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    *max_err = 0;
+    if(!INPLACE)
+        *max_err = norm_error('F', m, nrhs, ldb, hB[0], hBRes[0]);
+    if(hInfo[0][0] == 0)
+        *max_err = max(*max_err, norm_error('I', n, nrhs, max(m, n), hX[0], hXRes[0], ldres));
+
+    // also check info for singularities
+    EXPECT_EQ(hInfo[0][0], hInfoRes[0][0]);
+    if(hInfo[0][0] != hInfoRes[0][0])
+        err++;
+    *max_err += err;
+}
+
+template <testAPI_t API, bool HALF, bool INPLACE, typename T>
+void testing_gels_mixed(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    int                    m    = argus.get<int>("m");
+    int                    n    = argus.get<int>("n", m);
+    int                    nrhs = argus.get<int>("nrhs", n);
+    int                    lda  = argus.get<int>("lda", m);
+    int                    ldb  = argus.get<int>("ldb", m);
+    int                    ldx  = argus.get<int>("ldx", n);
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_B    = size_t(ldb) * nrhs;
+    size_t size_X    = size_t(ldx) * nrhs;
+    double max_error = 0;
+
+    size_t size_XRes = !INPLACE ? size_X : size_B;
+
+    // check invalid sizes
+    // (the mixed-precision solvers only handle overdetermined and square systems)
+    bool invalid_size = (m < 0 || n < 0 || nrhs < 0 || m < n || lda < m || ldb < m || ldx < n);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_gels_mixed(API,
+                                                   HALF,
+                                                   handle,
+                                                   m,
+                                                   n,
+                                                   nrhs,
+                                                   (T*)nullptr,
+                                                   lda,
+                                                   (T*)nullptr,
+                                                   ldb,
+                                                   (T*)nullptr,
+                                                   ldx,
+                                                   (T*)nullptr,
+                                                   0,
+                                                   (int*)nullptr,
+                                                   (int*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        return;
+    }
+
+    // memory size query is necessary
+    size_t size_W;
+    hipsolver_gels_mixed_bufferSize(API,
+                                    HALF,
+                                    handle,
+                                    m,
+                                    n,
+                                    nrhs,
+                                    (T*)nullptr,
+                                    lda,
+                                    (T*)nullptr,
+                                    ldb,
+                                    (T*)nullptr,
+                                    ldx,
+                                    &size_W);
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hARes(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hB(size_B, 1, size_B, 1);
+    host_strided_batch_vector<T>     hBRes(size_B, 1, size_B, 1);
+    host_strided_batch_vector<T>     hX(max(m, n) * nrhs, 1, max(m, n) * nrhs, 1);
+    host_strided_batch_vector<T>     hXRes(size_XRes, 1, size_XRes, 1);
+    host_strided_batch_vector<int>   hNiters(1, 1, 1, 1);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, 1);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T>   dB(size_B, 1, size_B, 1);
+    device_strided_batch_vector<T>   dX(size_X, 1, size_X, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dWork(size_W, 1, size_W, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    if(size_X)
+        CHECK_HIP_ERROR(dX.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations, with data the lower precision can hold and with data that overflows it
+    if(argus.unit_check || argus.norm_check)
+    {
+        for(bool overflow : {false, true})
+        {
+            double err;
+            gels_mixed_getError<API, HALF, INPLACE, T>(handle,
+                                                       m,
+                                                       n,
+                                                       nrhs,
+                                                       dA,
+                                                       lda,
+                                                       dB,
+                                                       ldb,
+                                                       dX,
+                                                       ldx,
+                                                       dWork,
+                                                       size_W,
+                                                       dInfo,
+                                                       hA,
+                                                       hARes,
+                                                       hB,
+                                                       hBRes,
+                                                       hX,
+                                                       hXRes,
+                                                       hNiters,
+                                                       hInfo,
+                                                       hInfoRes,
+                                                       overflow,
+                                                       &err);
+            max_error = err > max_error ? err : max_error;
+        }
+    }
+
+    // validate results for rocsolver-test
+    // using max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, max(m, n));
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
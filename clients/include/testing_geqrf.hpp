@@ -25,7 +25,13 @@
 
 #include "clientcommon.hpp"
 
-template <testAPI_t API, typename I, typename SIZE, typename Td, typename INTd, typename Th>
+template <testAPI_t API,
+          bool STRIDED,
+          typename I,
+          typename SIZE,
+          typename Td,
+          typename INTd,
+          typename Th>
 void geqrf_checkBadArgs(const hipsolverHandle_t   handle,
                         const hipsolverDnParams_t params,
                         const I                   m,
@@ -44,6 +50,7 @@ void geqrf_checkBadArgs(const hipsolverHandle_t   handle,
 {
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_geqrf(API,
+                                          STRIDED,
                                           nullptr,
                                           params,
                                           m,
@@ -68,6 +75,7 @@ void geqrf_checkBadArgs(const hipsolverHandle_t   handle,
     // pointers
     if constexpr(!std::is_same<I, int>::value)
         EXPECT_ROCBLAS_STATUS(hipsolver_geqrf(API,
+                                              STRIDED,
                                               handle,
                                               (hipsolverDnParams_t) nullptr,
                                               m,
@@ -85,6 +93,7 @@ void geqrf_checkBadArgs(const hipsolverHandle_t   handle,
                                               bc),
                               HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_geqrf(API,
+                                          STRIDED,
                                           handle,
                                           params,
                                           m,
@@ -102,6 +111,7 @@ void geqrf_checkBadArgs(const hipsolverHandle_t   handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_geqrf(API,
+                                          STRIDED,
                                           handle,
                                           params,
                                           m,
@@ -119,6 +129,7 @@ void geqrf_checkBadArgs(const hipsolverHandle_t   handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_geqrf(API,
+                                          STRIDED,
                                           handle,
                                           params,
                                           m,
@@ -197,29 +208,40 @@ void testing_geqrf_bad_arg()
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         SIZE size_dW, size_hW;
-        hipsolver_geqrf_bufferSize(
-            API, handle, params, m, n, dA.data(), lda, dIpiv.data(), &size_dW, &size_hW);
+        hipsolver_geqrf_bufferSize(API,
+                                   STRIDED,
+                                   handle,
+                                   params,
+                                   m,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   &size_dW,
+                                   &size_hW,
+                                   bc);
         host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
         device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
         if(size_dW)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        geqrf_checkBadArgs<API>(handle,
-                                params,
-                                m,
-                                n,
-                                dA.data(),
-                                lda,
-                                stA,
-                                dIpiv.data(),
-                                stP,
-                                dWork.data(),
-                                size_dW,
-                                hWork.data(),
-                                size_hW,
-                                dInfo.data(),
-                                bc);
+        geqrf_checkBadArgs<API, STRIDED>(handle,
+                                         params,
+                                         m,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         dWork.data(),
+                                         size_dW,
+                                         hWork.data(),
+                                         size_hW,
+                                         dInfo.data(),
+                                         bc);
     }
 }
 
@@ -271,6 +293,7 @@ void geqrf_initData(const hipsolverHandle_t handle,
 }
 
 template <testAPI_t API,
+          bool STRIDED,
           typename T,
           typename I,
           typename SIZE,
@@ -310,6 +333,7 @@ void geqrf_getError(const hipsolverHandle_t   handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_geqrf(API,
+                                        STRIDED,
                                         handle,
                                         params,
                                         m,
@@ -356,6 +380,7 @@ void geqrf_getError(const hipsolverHandle_t   handle,
 }
 
 template <testAPI_t API,
+          bool STRIDED,
           typename T,
           typename I,
           typename SIZE,
@@ -409,6 +434,7 @@ void geqrf_getPerfData(const hipsolverHandle_t   handle,
         geqrf_initData<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
         CHECK_ROCBLAS_ERROR(hipsolver_geqrf(API,
+                                            STRIDED,
                                             handle,
                                             params,
                                             m,
@@ -437,6 +463,7 @@ void geqrf_getPerfData(const hipsolverHandle_t   handle,
 
         start = get_time_us_sync(stream);
         hipsolver_geqrf(API,
+                        STRIDED,
                         handle,
                         params,
                         m,
@@ -511,6 +538,7 @@ void testing_geqrf(Arguments& argus)
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_geqrf(API,
+                                                  STRIDED,
                                                   handle,
                                                   params,
                                                   m,
@@ -537,8 +565,19 @@ void testing_geqrf(Arguments& argus)
 
     // memory size query is necessary
     SIZE size_dW, size_hW;
-    hipsolver_geqrf_bufferSize(
-        API, handle, params, m, n, (T*)nullptr, lda, (T*)nullptr, &size_dW, &size_hW);
+    hipsolver_geqrf_bufferSize(API,
+                               STRIDED,
+                               handle,
+                               params,
+                               m,
+                               n,
+                               (T*)nullptr,
+                               lda,
+                               stA,
+                               (T*)nullptr,
+                               &size_dW,
+                               &size_hW,
+                               bc);
 
     if(argus.mem_query)
     {
@@ -640,52 +679,52 @@ void testing_geqrf(Arguments& argus)
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            geqrf_getError<API, T>(handle,
-                                   params,
-                                   m,
-                                   n,
-                                   dA,
-                                   lda,
-                                   stA,
-                                   dIpiv,
-                                   stP,
-                                   dWork,
-                                   size_dW,
-                                   hWork,
-                                   size_hW,
-                                   dInfo,
-                                   bc,
-                                   hA,
-                                   hARes,
-                                   hIpiv,
-                                   hInfo,
-                                   hInfoRes,
-                                   &max_error);
+            geqrf_getError<API, STRIDED, T>(handle,
+                                            params,
+                                            m,
+                                            n,
+                                            dA,
+                                            lda,
+                                            stA,
+                                            dIpiv,
+                                            stP,
+                                            dWork,
+                                            size_dW,
+                                            hWork,
+                                            size_hW,
+                                            dInfo,
+                                            bc,
+                                            hA,
+                                            hARes,
+                                            hIpiv,
+                                            hInfo,
+                                            hInfoRes,
+                                            &max_error);
 
         // collect performance data
         if(argus.timing)
-            geqrf_getPerfData<API, T>(handle,
-                                      params,
-                                      m,
-                                      n,
-                                      dA,
-                                      lda,
-                                      stA,
-                                      dIpiv,
-                                      stP,
-                                      dWork,
-                                      size_dW,
-                                      hWork,
-                                      size_hW,
-                                      dInfo,
-                                      bc,
-                                      hA,
-                                      hIpiv,
-                                      hInfo,
-                                      &gpu_time_used,
-                                      &cpu_time_used,
-                                      hot_calls,
-                                      argus.perf);
+            geqrf_getPerfData<API, STRIDED, T>(handle,
+                                               params,
+                                               m,
+                                               n,
+                                               dA,
+                                               lda,
+                                               stA,
+                                               dIpiv,
+                                               stP,
+                                               dWork,
+                                               size_dW,
+                                               hWork,
+                                               size_hW,
+                                               dInfo,
+                                               bc,
+                                               hA,
+                                               hIpiv,
+                                               hInfo,
+                                               &gpu_time_used,
+                                               &cpu_time_used,
+                                               hot_calls,
+                                               argus.perf);
     }
 
     // validate results for rocsolver-test
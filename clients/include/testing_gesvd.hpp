@@ -25,7 +25,7 @@
 
 #include "clientcommon.hpp"
 
-template <testAPI_t API, typename T, typename TT, typename W, typename U>
+template <testAPI_t API, bool STRIDED, typename T, typename TT, typename W, typename U>
 void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                         const char              left_svect,
                         const char              right_svect,
@@ -52,6 +52,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
+                                          STRIDED,
                                           nullptr,
                                           left_svect,
                                           right_svect,
@@ -79,6 +80,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
+                                          STRIDED,
                                           handle,
                                           '\0',
                                           right_svect,
@@ -104,6 +106,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
+                                          STRIDED,
                                           handle,
                                           left_svect,
                                           '\0',
@@ -129,6 +132,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
+                                          STRIDED,
                                           handle,
                                           'O',
                                           'O',
@@ -157,6 +161,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
+                                          STRIDED,
                                           handle,
                                           left_svect,
                                           right_svect,
@@ -182,6 +187,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
+                                          STRIDED,
                                           handle,
                                           left_svect,
                                           right_svect,
@@ -207,6 +213,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
+                                          STRIDED,
                                           handle,
                                           left_svect,
                                           right_svect,
@@ -232,6 +239,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
+                                          STRIDED,
                                           handle,
                                           left_svect,
                                           right_svect,
@@ -257,6 +265,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
+                                          STRIDED,
                                           handle,
                                           left_svect,
                                           right_svect,
@@ -349,34 +358,34 @@ void testing_gesvd_bad_arg()
 
         int size_W;
         hipsolver_gesvd_bufferSize(
-            API, handle, left_svect, right_svect, m, n, dA.data(), lda, &size_W);
+            API, STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, &size_W, bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        gesvd_checkBadArgs<API>(handle,
-                                left_svect,
-                                right_svect,
-                                m,
-                                n,
-                                dA.data(),
-                                lda,
-                                stA,
-                                dS.data(),
-                                stS,
-                                dU.data(),
-                                ldu,
-                                stU,
-                                dV.data(),
-                                ldv,
-                                stV,
-                                dWork.data(),
-                                size_W,
-                                dE.data(),
-                                stE,
-                                dinfo.data(),
-                                bc);
+        gesvd_checkBadArgs<API, STRIDED>(handle,
+                                         left_svect,
+                                         right_svect,
+                                         m,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dS.data(),
+                                         stS,
+                                         dU.data(),
+                                         ldu,
+                                         stU,
+                                         dV.data(),
+                                         ldv,
+                                         stV,
+                                         dWork.data(),
+                                         size_W,
+                                         dE.data(),
+                                         stE,
+                                         dinfo.data(),
+                                         bc);
     }
 }
 
@@ -432,6 +441,7 @@ void gesvd_initData(const hipsolverHandle_t handle,
 
 template <testAPI_t API,
           bool      NRWK,
+          bool      STRIDED,
           typename T,
           typename Wd,
           typename Td,
@@ -501,6 +511,7 @@ void gesvd_getError(const hipsolverHandle_t handle,
     // we don't combine results computed by gemm_batched with results computed by gemm_strided_batched)
     CHECK_ROCBLAS_ERROR(hipsolver_gesvd(API,
                                         NRWK,
+                                        STRIDED,
                                         handle,
                                         left_svectT,
                                         right_svectT,
@@ -552,6 +563,7 @@ void gesvd_getError(const hipsolverHandle_t handle,
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_gesvd(API,
                                         NRWK,
+                                        STRIDED,
                                         handle,
                                         left_svect,
                                         right_svect,
@@ -655,6 +667,7 @@ void gesvd_getError(const hipsolverHandle_t handle,
 
 template <testAPI_t API,
           bool      NRWK,
+          bool      STRIDED,
           typename T,
           typename Wd,
           typename Td,
@@ -737,6 +750,7 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
 
         CHECK_ROCBLAS_ERROR(hipsolver_gesvd(API,
                                             NRWK,
+                                            STRIDED,
                                             handle,
                                             left_svect,
                                             right_svect,
@@ -774,6 +788,7 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
         start = get_time_us_sync(stream);
         hipsolver_gesvd(API,
                         NRWK,
+                        STRIDED,
                         handle,
                         left_svect,
                         right_svect,
@@ -859,6 +874,7 @@ void testing_gesvd(Arguments& argus)
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                                   NRWK,
+                                                  STRIDED,
                                                   handle,
                                                   leftv,
                                                   rightv,
@@ -1026,6 +1042,7 @@ void testing_gesvd(Arguments& argus)
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                                   NRWK,
+                                                  STRIDED,
                                                   handle,
                                                   leftv,
                                                   rightv,
@@ -1059,10 +1076,33 @@ void testing_gesvd(Arguments& argus)
 
     // memory size query is necessary
     int size_W, w1, w2;
-    hipsolver_gesvd_bufferSize(API, handle, leftv, rightv, m, n, (T*)nullptr, lda, &w1);
-    hipsolver_gesvd_bufferSize(API, handle, leftvT, rightvT, mT, nT, (T*)nullptr, lda, &w2);
+    hipsolver_gesvd_bufferSize(
+        API, STRIDED, handle, leftv, rightv, m, n, (T*)nullptr, lda, &w1, bc);
+    hipsolver_gesvd_bufferSize(
+        API, STRIDED, handle, leftvT, rightvT, mT, nT, (T*)nullptr, lda, &w2, bc);
     size_W = max(w1, w2);
 
+    // the compatibility API must provide enough workspace for every choice of jobu and jobv
+    if(API == API_COMPAT)
+    {
+        const signed char svects[] = {'N', 'A', 'S', 'O'};
+        for(signed char jobu : svects)
+        {
+            for(signed char jobv : svects)
+            {
+                if(jobu == 'O' && jobv == 'O')
+                    continue;
+
+                int wj;
+                EXPECT_ROCBLAS_STATUS(
+                    hipsolver_gesvd_bufferSize(
+                        API_NORMAL, false, handle, jobu, jobv, m, n, (T*)nullptr, lda, &wj, bc),
+                    HIPSOLVER_STATUS_SUCCESS);
+                EXPECT_GE(w1, wj) << "where jobu = " << jobu << ", jobv = " << jobv;
+            }
+        }
+    }
+
     if(argus.mem_query)
     {
         rocsolver_bench_inform(inform_mem_query, size_W);
@@ -1215,90 +1255,90 @@ void testing_gesvd(Arguments& argus)
         // check computations
         if(argus.unit_check || argus.norm_check)
         {
-            gesvd_getError<API, NRWK, T>(handle,
-                                         leftv,
-                                         rightv,
-                                         m,
-                                         n,
-                                         dA,
-                                         lda,
-                                         stA,
-                                         dS,
-                                         stS,
-                                         dU,
-                                         ldu,
-                                         stU,
-                                         dV,
-                                         ldv,
-                                         stV,
-                                         dWork,
-                                         size_W,
-                                         dE,
-                                         stE,
-                                         dinfo,
-                                         bc,
-                                         leftvT,
-                                         rightvT,
-                                         mT,
-                                         nT,
-                                         dUT,
-                                         lduT,
-                                         stUT,
-                                         dVT,
-                                         ldvT,
-                                         stVT,
-                                         hA,
-                                         hS,
-                                         hSres,
-                                         hU,
-                                         Ures,
-                                         ldures,
-                                         hV,
-                                         Vres,
-                                         ldvres,
-                                         hE,
-                                         hEres,
-                                         hinfo,
-                                         hinfoRes,
-                                         &max_error,
-                                         &max_errorv);
+            gesvd_getError<API, NRWK, STRIDED, T>(handle,
+                                                  leftv,
+                                                  rightv,
+                                                  m,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  stA,
+                                                  dS,
+                                                  stS,
+                                                  dU,
+                                                  ldu,
+                                                  stU,
+                                                  dV,
+                                                  ldv,
+                                                  stV,
+                                                  dWork,
+                                                  size_W,
+                                                  dE,
+                                                  stE,
+                                                  dinfo,
+                                                  bc,
+                                                  leftvT,
+                                                  rightvT,
+                                                  mT,
+                                                  nT,
+                                                  dUT,
+                                                  lduT,
+                                                  stUT,
+                                                  dVT,
+                                                  ldvT,
+                                                  stVT,
+                                                  hA,
+                                                  hS,
+                                                  hSres,
+                                                  hU,
+                                                  Ures,
+                                                  ldures,
+                                                  hV,
+                                                  Vres,
+                                                  ldvres,
+                                                  hE,
+                                                  hEres,
+                                                  hinfo,
+                                                  hinfoRes,
+                                                  &max_error,
+                                                  &max_errorv);
         }
 
         // collect performance data
         if(argus.timing)
         {
-            gesvd_getPerfData<API, NRWK, T>(handle,
-                                            leftv,
-                                            rightv,
-                                            m,
-                                            n,
-                                            dA,
-                                            lda,
-                                            stA,
-                                            dS,
-                                            stS,
-                                            dU,
-                                            ldu,
-                                            stU,
-                                            dV,
-                                            ldv,
-                                            stV,
-                                            dWork,
-                                            size_W,
-                                            dE,
-                                            stE,
-                                            dinfo,
-                                            bc,
-                                            hA,
-                                            hS,
-                                            hU,
-                                            hV,
-                                            hE,
-                                            hinfo,
-                                            &gpu_time_used,
-                                            &cpu_time_used,
-                                            hot_calls,
-                                            argus.perf);
+            gesvd_getPerfData<API, NRWK, STRIDED, T>(handle,
+                                                     leftv,
+                                                     rightv,
+                                                     m,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dS,
+                                                     stS,
+                                                     dU,
+                                                     ldu,
+                                                     stU,
+                                                     dV,
+                                                     ldv,
+                                                     stV,
+                                                     dWork,
+                                                     size_W,
+                                                     dE,
+                                                     stE,
+                                                     dinfo,
+                                                     bc,
+                                                     hA,
+                                                     hS,
+                                                     hU,
+                                                     hV,
+                                                     hE,
+                                                     hinfo,
+                                                     &gpu_time_used,
+                                                     &cpu_time_used,
+                                                     hot_calls,
+                                                     argus.perf);
         }
     }
 
@@ -507,8 +507,28 @@ void gesvdj_getError(const hipsolverHandle_t handle,
         CHECK_HIP_ERROR(Vres.transfer_from(dV));
     }
 
-    hipsolverXgesvdjGetResidual(handle, params, hResidualRes.data());
-    hipsolverXgesvdjGetSweeps(handle, params, hSweepsRes.data());
+    // batched results are retrieved asynchronously, on the stream of the handle
+    bool   async_results = false;
+    double max_residual  = 0;
+    int    max_executed  = 0;
+    if(STRIDED)
+    {
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+        async_results
+            = hipsolverXgesvdjGetResidualAsync(handle, params, hResidualRes.data())
+                  == HIPSOLVER_STATUS_SUCCESS
+              && hipsolverXgesvdjGetSweepsAsync(handle, params, hSweepsRes.data())
+                     == HIPSOLVER_STATUS_SUCCESS
+              && hipsolverXgesvdjGetMaxAsync(handle, params, &max_residual, &max_executed)
+                     == HIPSOLVER_STATUS_SUCCESS;
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+    else
+    {
+        hipsolverXgesvdjGetResidual(handle, params, hResidualRes.data());
+        hipsolverXgesvdjGetSweeps(handle, params, hSweepsRes.data());
+    }
 
     // CPU lapack
     // Only singular values needed
@@ -538,7 +558,7 @@ void gesvdj_getError(const hipsolverHandle_t handle,
             *max_err += 1;
     }
 
-    if(!STRIDED)
+    if(!STRIDED || async_results)
     {
         // Also check validity of residual
         for(rocblas_int b = 0; b < bc; ++b)
@@ -556,6 +576,22 @@ void gesvdj_getError(const hipsolverHandle_t handle,
             if(hSweepsRes[b][0] < 0 || hSweepsRes[b][0] > max_sweeps)
                 *max_err += 1;
         }
+
+        // Also check the maximums over the batch
+        if(async_results)
+        {
+            double expected_residual = 0;
+            int    expected_sweeps   = 0;
+            for(rocblas_int b = 0; b < bc; ++b)
+            {
+                expected_residual = std::max(expected_residual, double(hResidualRes[b][0]));
+                expected_sweeps   = std::max(expected_sweeps, int(hSweepsRes[b][0]));
+            }
+            EXPECT_EQ(max_residual, expected_residual);
+            EXPECT_EQ(max_executed, expected_sweeps);
+            if(max_residual != expected_residual || max_executed != expected_sweeps)
+                *max_err += 1;
+        }
     }
 
     // (We expect the used input matrices to always converge. Testing
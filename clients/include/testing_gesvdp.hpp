@@ -0,0 +1,837 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <testAPI_t API, typename T, typename S, typename U>
+void gesvdp_checkBadArgs(const hipsolverHandle_t   handle,
+                         const hipsolverDnParams_t params,
+                         const hipsolverEigMode_t  jobz,
+                         const int                 econ,
+                         const int                 m,
+                         const int                 n,
+                         T                         dA,
+                         const int                 lda,
+                         S                         dS,
+                         T                         dU,
+                         const int                 ldu,
+                         T                         dV,
+                         const int                 ldv,
+                         T                         dWork,
+                         const size_t              lwork,
+                         T                         hWork,
+                         const size_t              lhwork,
+                         U                         dinfo,
+                         double*                   hErrSigma)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdp(API,
+                                           nullptr,
+                                           params,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           dS,
+                                           dU,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hErrSigma),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // params
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdp(API,
+                                           handle,
+                                           (hipsolverDnParams_t) nullptr,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           dS,
+                                           dU,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hErrSigma),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdp(API,
+                                           handle,
+                                           params,
+                                           hipsolverEigMode_t(-1),
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           dS,
+                                           dU,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hErrSigma),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdp(API,
+                                           handle,
+                                           params,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           (T) nullptr,
+                                           lda,
+                                           dS,
+                                           dU,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hErrSigma),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdp(API,
+                                           handle,
+                                           params,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           (S) nullptr,
+                                           dU,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hErrSigma),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdp(API,
+                                           handle,
+                                           params,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           dS,
+                                           (T) nullptr,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hErrSigma),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdp(API,
+                                           handle,
+                                           params,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           dS,
+                                           dU,
+                                           ldu,
+                                           (T) nullptr,
+                                           ldv,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hErrSigma),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdp(API,
+                                           handle,
+                                           params,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           dS,
+                                           dU,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           (U) nullptr,
+                                           hErrSigma),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, typename T>
+void testing_gesvdp_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolver_local_params params;
+    hipsolverEigMode_t     jobz = HIPSOLVER_EIG_MODE_VECTOR;
+    int                    econ = 0;
+    int                    m    = 2;
+    int                    n    = 2;
+    int                    lda  = 2;
+    int                    ldu  = 2;
+    int                    ldv  = 2;
+    double                 hErrSigma;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<S>   dS(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dU(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dV(1, 1, 1, 1);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dS.memcheck());
+    CHECK_HIP_ERROR(dU.memcheck());
+    CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    size_t size_dW, size_hW;
+    hipsolver_gesvdp_bufferSize(API,
+                                handle,
+                                params,
+                                jobz,
+                                econ,
+                                m,
+                                n,
+                                dA.data(),
+                                lda,
+                                dS.data(),
+                                dU.data(),
+                                ldu,
+                                dV.data(),
+                                ldv,
+                                &size_dW,
+                                &size_hW);
+    host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
+    device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
+    if(size_dW)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    gesvdp_checkBadArgs<API>(handle,
+                             params,
+                             jobz,
+                             econ,
+                             m,
+                             n,
+                             dA.data(),
+                             lda,
+                             dS.data(),
+                             dU.data(),
+                             ldu,
+                             dV.data(),
+                             ldv,
+                             dWork.data(),
+                             size_dW,
+                             hWork.data(),
+                             size_hW,
+                             dinfo.data(),
+                             &hErrSigma);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gesvdp_initData(const hipsolverHandle_t handle,
+                     const int               m,
+                     const int               n,
+                     Td&                     dA,
+                     const int               lda,
+                     Th&                     hA,
+                     std::vector<T>&         A)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(int i = 0; i < m; i++)
+        {
+            for(int j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hA[0][i + j * lda] += 400;
+                else
+                    hA[0][i + j * lda] -= 4;
+            }
+        }
+
+        // make copy of original data to test vectors
+        for(int i = 0; i < m; i++)
+        {
+            for(int j = 0; j < n; j++)
+                A[i + j * lda] = hA[0][i + j * lda];
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Wd,
+          typename Td,
+          typename Ud,
+          typename Id,
+          typename Wh,
+          typename Th,
+          typename Uh,
+          typename Ih>
+void gesvdp_getError(const hipsolverHandle_t   handle,
+                     const hipsolverDnParams_t params,
+                     const hipsolverEigMode_t  jobz,
+                     const int                 econ,
+                     const int                 m,
+                     const int                 n,
+                     Wd&                       dA,
+                     const int                 lda,
+                     Td&                       dS,
+                     Ud&                       dU,
+                     const int                 ldu,
+                     Ud&                       dV,
+                     const int                 ldv,
+                     Ud&                       dWork,
+                     const size_t              lwork,
+                     Uh&                       hWork,
+                     const size_t              lhwork,
+                     Id&                       dinfo,
+                     Wh&                       hA,
+                     Th&                       hS,
+                     Th&                       hSres,
+                     Uh&                       hUres,
+                     Uh&                       hVres,
+                     Ih&                       hinfoRes,
+                     double*                   max_err,
+                     double*                   max_errv)
+{
+    using S = decltype(std::real(T{}));
+
+    int            mn     = min(m, n);
+    int            size_W = 5 * max(m, n);
+    int            ucols  = econ ? mn : m;
+    int            vcols  = econ ? mn : n;
+    std::vector<S> hE(size_W);
+    std::vector<T> hW(size_W);
+    std::vector<T> A(size_t(lda) * n);
+    double         hErrSigma;
+
+    // input data initialization
+    gesvdp_initData<true, true, T>(handle, m, n, dA, lda, hA, A);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_gesvdp(API,
+                                         handle,
+                                         params,
+                                         jobz,
+                                         econ,
+                                         m,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         dS.data(),
+                                         dU.data(),
+                                         ldu,
+                                         dV.data(),
+                                         ldv,
+                                         dWork.data(),
+                                         lwork,
+                                         hWork.data(),
+                                         lhwork,
+                                         dinfo.data(),
+                                         &hErrSigma));
+    CHECK_HIP_ERROR(hSres.transfer_from(dS));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+    {
+        CHECK_HIP_ERROR(hUres.transfer_from(dU));
+        CHECK_HIP_ERROR(hVres.transfer_from(dV));
+    }
+
+    // CPU lapack
+    int info;
+    cpu_gesvd<T>('N',
+                 'N',
+                 m,
+                 n,
+                 hA[0],
+                 lda,
+                 hS[0],
+                 nullptr,
+                 1,
+                 nullptr,
+                 1,
+                 hW.data(),
+                 size_W,
+                 hE.data(),
+                 &info);
+
+    // check info
+    EXPECT_EQ(hinfoRes[0][0], 0);
+
+    // error is ||hS - hSres||
+    *max_err = norm_error('F', 1, mn, 1, hS[0], hSres[0]);
+    if(hinfoRes[0][0] != 0)
+        *max_err += 1;
+
+    // check the singular vectors: A * V = U * S for the first min(m, n) columns, and U and V
+    // have orthonormal columns, including the completed ones when econ = 0
+    *max_errv = 0;
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+    {
+        double err = 0;
+        for(int j = 0; j < mn; ++j)
+        {
+            for(int i = 0; i < m; ++i)
+            {
+                T tmp = 0;
+                for(int t = 0; t < n; ++t)
+                    tmp += A[i + t * lda] * hVres[0][t + j * ldv];
+                tmp -= hSres[0][j] * hUres[0][i + j * ldu];
+                err += double(std::abs(tmp)) * std::abs(tmp);
+            }
+        }
+        err       = std::sqrt(err) / double(snorm('F', m, n, A.data(), lda));
+        *max_errv = err;
+
+        err = 0;
+        for(int j = 0; j < ucols; ++j)
+        {
+            for(int i = 0; i < ucols; ++i)
+            {
+                T tmp = (i == j) ? -1 : 0;
+                for(int t = 0; t < m; ++t)
+                    tmp += std::conj(hUres[0][t + i * ldu]) * hUres[0][t + j * ldu];
+                err += double(std::abs(tmp)) * std::abs(tmp);
+            }
+        }
+        for(int j = 0; j < vcols; ++j)
+        {
+            for(int i = 0; i < vcols; ++i)
+            {
+                T tmp = (i == j) ? -1 : 0;
+                for(int t = 0; t < n; ++t)
+                    tmp += std::conj(hVres[0][t + i * ldv]) * hVres[0][t + j * ldv];
+                err += double(std::abs(tmp)) * std::abs(tmp);
+            }
+        }
+        err       = std::sqrt(err);
+        *max_errv = err > *max_errv ? err : *max_errv;
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Wd,
+          typename Td,
+          typename Ud,
+          typename Id,
+          typename Wh,
+          typename Uh>
+void gesvdp_getPerfData(const hipsolverHandle_t   handle,
+                        const hipsolverDnParams_t params,
+                        const hipsolverEigMode_t  jobz,
+                        const int                 econ,
+                        const int                 m,
+                        const int                 n,
+                        Wd&                       dA,
+                        const int                 lda,
+                        Td&                       dS,
+                        Ud&                       dU,
+                        const int                 ldu,
+                        Ud&                       dV,
+                        const int                 ldv,
+                        Ud&                       dWork,
+                        const size_t              lwork,
+                        Uh&                       hWork,
+                        const size_t              lhwork,
+                        Id&                       dinfo,
+                        Wh&                       hA,
+                        double*                   gpu_time_used,
+                        double*                   cpu_time_used,
+                        const int                 hot_calls,
+                        const bool                perf)
+{
+    std::vector<T> A(size_t(lda) * n);
+    double         hErrSigma;
+
+    if(!perf)
+    {
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = nan("");
+    }
+
+    gesvdp_initData<true, false, T>(handle, m, n, dA, lda, hA, A);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gesvdp_initData<false, true, T>(handle, m, n, dA, lda, hA, A);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_gesvdp(API,
+                                             handle,
+                                             params,
+                                             jobz,
+                                             econ,
+                                             m,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             dS.data(),
+                                             dU.data(),
+                                             ldu,
+                                             dV.data(),
+                                             ldv,
+                                             dWork.data(),
+                                             lwork,
+                                             hWork.data(),
+                                             lhwork,
+                                             dinfo.data(),
+                                             &hErrSigma));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        gesvdp_initData<false, true, T>(handle, m, n, dA, lda, hA, A);
+
+        start = get_time_us_sync(stream);
+        hipsolver_gesvdp(API,
+                         handle,
+                         params,
+                         jobz,
+                         econ,
+                         m,
+                         n,
+                         dA.data(),
+                         lda,
+                         dS.data(),
+                         dU.data(),
+                         ldu,
+                         dV.data(),
+                         ldv,
+                         dWork.data(),
+                         lwork,
+                         hWork.data(),
+                         lhwork,
+                         dinfo.data(),
+                         &hErrSigma);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <testAPI_t API, typename T>
+void testing_gesvdp(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    hipsolver_local_handle handle;
+    hipsolver_local_params params;
+    char                   jobzC = argus.get<char>("jobz");
+    int                    econ  = argus.get<int>("econ", 0);
+    int                    m     = argus.get<int>("m");
+    int                    n     = argus.get<int>("n", m);
+    int                    lda   = argus.get<int>("lda", m);
+    int                    ldu   = argus.get<int>("ldu", m);
+    int                    ldv   = argus.get<int>("ldv", n);
+
+    hipsolverEigMode_t jobz      = char2hipsolver_evect(jobzC);
+    int                hot_calls = argus.iters;
+
+    // determine sizes
+    int    mn         = min(m, n);
+    size_t size_A     = size_t(lda) * n;
+    size_t size_S     = size_t(mn);
+    size_t size_U     = 0;
+    size_t size_V     = 0;
+    size_t size_Sres  = 0;
+    size_t size_hUres = 0;
+    size_t size_hVres = 0;
+
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+    {
+        size_U = size_t(ldu) * (econ ? mn : m);
+        size_V = size_t(ldv) * (econ ? mn : n);
+    }
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        size_Sres  = size_S;
+        size_hUres = size_U;
+        size_hVres = size_V;
+    }
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0, max_errorv = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || m < 0 || lda < max(m, 1));
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+        invalid_size = invalid_size || ldu < max(m, 1) || ldv < max(n, 1);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_gesvdp(API,
+                                               handle,
+                                               params,
+                                               jobz,
+                                               econ,
+                                               m,
+                                               n,
+                                               (T*)nullptr,
+                                               lda,
+                                               (S*)nullptr,
+                                               (T*)nullptr,
+                                               ldu,
+                                               (T*)nullptr,
+                                               ldv,
+                                               (T*)nullptr,
+                                               0,
+                                               (T*)nullptr,
+                                               0,
+                                               (int*)nullptr,
+                                               (double*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    size_t size_dW, size_hW;
+    hipsolver_gesvdp_bufferSize(API,
+                                handle,
+                                params,
+                                jobz,
+                                econ,
+                                m,
+                                n,
+                                (T*)nullptr,
+                                lda,
+                                (S*)nullptr,
+                                (T*)nullptr,
+                                ldu,
+                                (T*)nullptr,
+                                ldv,
+                                &size_dW,
+                                &size_hW);
+
+    if(argus.mem_query)
+    {
+        rocsolver_bench_inform(inform_mem_query, size_dW);
+        return;
+    }
+
+    // memory allocations
+    // host
+    host_strided_batch_vector<T>   hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<S>   hS(size_S, 1, size_S, 1);
+    host_strided_batch_vector<int> hinfoRes(1, 1, 1, 1);
+    host_strided_batch_vector<S>   hSres(size_Sres, 1, size_Sres, 1);
+    host_strided_batch_vector<T>   hUres(size_hUres, 1, size_hUres, 1);
+    host_strided_batch_vector<T>   hVres(size_hVres, 1, size_hVres, 1);
+    host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
+    // device
+    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<S>   dS(size_S, 1, size_S, 1);
+    device_strided_batch_vector<T>   dU(size_U, 1, size_U, 1);
+    device_strided_batch_vector<T>   dV(size_V, 1, size_V, 1);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dWork(size_dW, 1, size_dW, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_S)
+        CHECK_HIP_ERROR(dS.memcheck());
+    if(size_U)
+        CHECK_HIP_ERROR(dU.memcheck());
+    if(size_V)
+        CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    if(size_dW)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+    {
+        gesvdp_getError<API, T>(handle,
+                                params,
+                                jobz,
+                                econ,
+                                m,
+                                n,
+                                dA,
+                                lda,
+                                dS,
+                                dU,
+                                ldu,
+                                dV,
+                                ldv,
+                                dWork,
+                                size_dW,
+                                hWork,
+                                size_hW,
+                                dinfo,
+                                hA,
+                                hS,
+                                hSres,
+                                hUres,
+                                hVres,
+                                hinfoRes,
+                                &max_error,
+                                &max_errorv);
+    }
+
+    // collect performance data
+    if(argus.timing)
+    {
+        gesvdp_getPerfData<API, T>(handle,
+                                   params,
+                                   jobz,
+                                   econ,
+                                   m,
+                                   n,
+                                   dA,
+                                   lda,
+                                   dS,
+                                   dU,
+                                   ldu,
+                                   dV,
+                                   ldv,
+                                   dWork,
+                                   size_dW,
+                                   hWork,
+                                   size_hW,
+                                   dinfo,
+                                   hA,
+                                   &gpu_time_used,
+                                   &cpu_time_used,
+                                   hot_calls,
+                                   argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using 3 * min(m, n) * machine_precision as tolerance
+    if(argus.unit_check)
+    {
+        ROCSOLVER_TEST_CHECK(T, max_error, 3 * mn);
+        if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+            ROCSOLVER_TEST_CHECK(T, max_errorv, 3 * max(m, n));
+    }
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+            max_error = (max_error >= max_errorv) ? max_error : max_errorv;
+
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("jobz", "econ", "m", "n", "lda", "ldu", "ldv");
+            rocsolver_bench_output(jobzC, econ, m, n, lda, ldu, ldv);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
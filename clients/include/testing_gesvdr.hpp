@@ -0,0 +1,1104 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <testAPI_t API, bool STRIDED, typename T, typename TT, typename U>
+void gesvdr_checkBadArgs(const hipsolverHandle_t   handle,
+                         const hipsolverDnParams_t params,
+                         const char                jobu,
+                         const char                jobv,
+                         const int                 m,
+                         const int                 n,
+                         const int                 k,
+                         const int                 p,
+                         const int                 niters,
+                         T                         dA,
+                         const int                 lda,
+                         const int                 stA,
+                         TT                        dS,
+                         const int                 stS,
+                         T                         dU,
+                         const int                 ldu,
+                         const int                 stU,
+                         T                         dV,
+                         const int                 ldv,
+                         const int                 stV,
+                         T                         dWork,
+                         const size_t              lwork,
+                         T                         hWork,
+                         const size_t              lhwork,
+                         U                         dinfo,
+                         double*                   hRnrmF,
+                         const int                 bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           STRIDED,
+                                           nullptr,
+                                           params,
+                                           jobu,
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hRnrmF,
+                                           bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // params
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           STRIDED,
+                                           handle,
+                                           (hipsolverDnParams_t) nullptr,
+                                           jobu,
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hRnrmF,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           STRIDED,
+                                           handle,
+                                           params,
+                                           'A',
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hRnrmF,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           STRIDED,
+                                           handle,
+                                           params,
+                                           jobu,
+                                           'A',
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hRnrmF,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           STRIDED,
+                                           handle,
+                                           params,
+                                           jobu,
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           (T) nullptr,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hRnrmF,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           STRIDED,
+                                           handle,
+                                           params,
+                                           jobu,
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           (TT) nullptr,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hRnrmF,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           STRIDED,
+                                           handle,
+                                           params,
+                                           jobu,
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           (T) nullptr,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hRnrmF,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           STRIDED,
+                                           handle,
+                                           params,
+                                           jobu,
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           (T) nullptr,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           dinfo,
+                                           hRnrmF,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           STRIDED,
+                                           handle,
+                                           params,
+                                           jobu,
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           hWork,
+                                           lhwork,
+                                           (U) nullptr,
+                                           hRnrmF,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, bool STRIDED, typename T>
+void testing_gesvdr_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolver_local_params params;
+    char                   jobu   = 'S';
+    char                   jobv   = 'S';
+    int                    m      = 2;
+    int                    n      = 2;
+    int                    k      = 1;
+    int                    p      = 1;
+    int                    niters = 1;
+    int                    lda    = 2;
+    int                    ldu    = 2;
+    int                    ldv    = 2;
+    int                    stA    = 4;
+    int                    stS    = 1;
+    int                    stU    = 2;
+    int                    stV    = 2;
+    int                    bc     = 1;
+
+    // memory allocations
+    host_strided_batch_vector<double> hRnrmF(1, 1, 1, 1);
+    device_strided_batch_vector<T>    dA(4, 1, 4, 1);
+    device_strided_batch_vector<S>    dS(1, 1, 1, 1);
+    device_strided_batch_vector<T>    dU(2, 1, 2, 1);
+    device_strided_batch_vector<T>    dV(2, 1, 2, 1);
+    device_strided_batch_vector<int>  dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dS.memcheck());
+    CHECK_HIP_ERROR(dU.memcheck());
+    CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    size_t size_dW, size_hW;
+    hipsolver_gesvdr_bufferSize(API,
+                                STRIDED,
+                                handle,
+                                params,
+                                jobu,
+                                jobv,
+                                m,
+                                n,
+                                k,
+                                p,
+                                niters,
+                                dA.data(),
+                                lda,
+                                stA,
+                                dS.data(),
+                                stS,
+                                dU.data(),
+                                ldu,
+                                stU,
+                                dV.data(),
+                                ldv,
+                                stV,
+                                &size_dW,
+                                &size_hW,
+                                bc);
+    host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
+    device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
+    if(size_dW)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    gesvdr_checkBadArgs<API, STRIDED>(handle,
+                                      params,
+                                      jobu,
+                                      jobv,
+                                      m,
+                                      n,
+                                      k,
+                                      p,
+                                      niters,
+                                      dA.data(),
+                                      lda,
+                                      stA,
+                                      dS.data(),
+                                      stS,
+                                      dU.data(),
+                                      ldu,
+                                      stU,
+                                      dV.data(),
+                                      ldv,
+                                      stV,
+                                      dWork.data(),
+                                      size_dW,
+                                      hWork.data(),
+                                      size_hW,
+                                      dinfo.data(),
+                                      hRnrmF.data(),
+                                      bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gesvdr_initData(const hipsolverHandle_t handle,
+                     const int               m,
+                     const int               n,
+                     const int               rankA,
+                     Td&                     dA,
+                     const int               lda,
+                     const int               bc,
+                     Th&                     hA,
+                     std::vector<T>&         A)
+{
+    if(CPU)
+    {
+        std::vector<T> X(size_t(m) * rankA);
+        std::vector<T> Y(size_t(rankA) * n);
+
+        for(int b = 0; b < bc; ++b)
+        {
+            // A = X * Y has rank rankA
+            for(auto& x : X)
+                x = random_generator<T>();
+            for(auto& y : Y)
+                y = random_generator_negative<T>();
+
+            for(int i = 0; i < m; i++)
+            {
+                for(int j = 0; j < n; j++)
+                {
+                    T tmp = 0;
+                    for(int t = 0; t < rankA; t++)
+                        tmp += X[i + t * m] * Y[t + j * rankA];
+                    hA[b][i + j * lda] = tmp;
+                }
+            }
+
+            // make copy of original data to test vectors
+            for(int i = 0; i < m; i++)
+            {
+                for(int j = 0; j < n; j++)
+                    A[b * lda * n + i + j * lda] = hA[b][i + j * lda];
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <testAPI_t API,
+          bool      STRIDED,
+          typename T,
+          typename Wd,
+          typename Td,
+          typename Ud,
+          typename Id,
+          typename Wh,
+          typename Th,
+          typename Uh,
+          typename Ih>
+void gesvdr_getError(const hipsolverHandle_t   handle,
+                     const hipsolverDnParams_t params,
+                     const char                jobu,
+                     const char                jobv,
+                     const int                 m,
+                     const int                 n,
+                     const int                 k,
+                     const int                 p,
+                     const int                 niters,
+                     const int                 rankA,
+                     Wd&                       dA,
+                     const int                 lda,
+                     const int                 stA,
+                     Td&                       dS,
+                     const int                 stS,
+                     Ud&                       dU,
+                     const int                 ldu,
+                     const int                 stU,
+                     Ud&                       dV,
+                     const int                 ldv,
+                     const int                 stV,
+                     Ud&                       dWork,
+                     const size_t              lwork,
+                     Uh&                       hWork,
+                     const size_t              lhwork,
+                     Id&                       dinfo,
+                     double*                   hRnrmF,
+                     const int                 bc,
+                     Wh&                       hA,
+                     Th&                       hS,
+                     Th&                       hSres,
+                     Uh&                       hUres,
+                     Uh&                       hVres,
+                     Ih&                       hinfoRes,
+                     double*                   max_err,
+                     double*                   max_errv,
+                     double*                   max_errr)
+{
+    using S = decltype(std::real(T{}));
+
+    int            size_W = 5 * max(m, n);
+    std::vector<S> hE(size_W);
+    std::vector<T> hW(size_W);
+    std::vector<T> A(size_t(lda) * n * bc);
+
+    // input data initialization
+    gesvdr_initData<true, true, T>(handle, m, n, rankA, dA, lda, bc, hA, A);
+
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_gesvdr(API,
+                                         STRIDED,
+                                         handle,
+                                         params,
+                                         jobu,
+                                         jobv,
+                                         m,
+                                         n,
+                                         k,
+                                         p,
+                                         niters,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dS.data(),
+                                         stS,
+                                         dU.data(),
+                                         ldu,
+                                         stU,
+                                         dV.data(),
+                                         ldv,
+                                         stV,
+                                         dWork.data(),
+                                         lwork,
+                                         hWork.data(),
+                                         lhwork,
+                                         dinfo.data(),
+                                         hRnrmF,
+                                         bc));
+
+    CHECK_HIP_ERROR(hSres.transfer_from(dS));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+    if(jobu == 'S')
+        CHECK_HIP_ERROR(hUres.transfer_from(dU));
+    if(jobv == 'S')
+        CHECK_HIP_ERROR(hVres.transfer_from(dV));
+
+    // CPU lapack
+    // A has rank at most k + p, so its range is captured exactly by the sketch and the
+    // computed singular triplets must match those of the full SVD
+    for(int b = 0; b < bc; ++b)
+    {
+        int info;
+        cpu_gesvd<T>('N',
+                     'N',
+                     m,
+                     n,
+                     hA[b],
+                     lda,
+                     hS[b],
+                     nullptr,
+                     1,
+                     nullptr,
+                     1,
+                     hW.data(),
+                     size_W,
+                     hE.data(),
+                     &info);
+    }
+
+    double err;
+    *max_err  = 0;
+    *max_errv = 0;
+    *max_errr = 0;
+
+    for(int b = 0; b < bc; ++b)
+    {
+        // check info
+        EXPECT_EQ(hinfoRes[b][0], 0) << "where b = " << b;
+        if(hinfoRes[b][0] != 0)
+            *max_err += 1;
+
+        // error is ||hS - hSres||
+        err      = norm_error('F', 1, k, 1, hS[b], hSres[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        double normA = double(snorm('F', m, n, A.data() + b * lda * n, lda));
+
+        // check the singular vectors implicitly (A*v_j = s_j*u_j) if both are computed
+        if(jobu == 'S' && jobv == 'S')
+        {
+            err = 0;
+            for(int j = 0; j < k; ++j)
+            {
+                for(int i = 0; i < m; ++i)
+                {
+                    T tmp = 0;
+                    for(int t = 0; t < n; ++t)
+                        tmp += A[b * lda * n + i + t * lda] * hVres[b][t + j * ldv];
+                    tmp -= hSres[b][j] * hUres[b][i + j * ldu];
+                    err += double(std::abs(tmp)) * std::abs(tmp);
+                }
+            }
+            err       = std::sqrt(err) / normA;
+            *max_errv = err > *max_errv ? err : *max_errv;
+        }
+
+        // the residual reported in hRnrmF must match the norm of the discarded singular values.
+        // It is obtained by a difference of squares, so its squared relative error is compared
+        if(STRIDED)
+        {
+            double tail = 0;
+            for(int i = k; i < min(m, n); ++i)
+                tail += double(hS[b][i]) * hS[b][i];
+            err       = (hRnrmF[b] - std::sqrt(tail)) / normA;
+            err       = err * err;
+            *max_errr = err > *max_errr ? err : *max_errr;
+        }
+    }
+}
+
+template <testAPI_t API,
+          bool      STRIDED,
+          typename T,
+          typename Wd,
+          typename Td,
+          typename Ud,
+          typename Id,
+          typename Wh,
+          typename Uh>
+void gesvdr_getPerfData(const hipsolverHandle_t   handle,
+                        const hipsolverDnParams_t params,
+                        const char                jobu,
+                        const char                jobv,
+                        const int                 m,
+                        const int                 n,
+                        const int                 k,
+                        const int                 p,
+                        const int                 niters,
+                        const int                 rankA,
+                        Wd&                       dA,
+                        const int                 lda,
+                        const int                 stA,
+                        Td&                       dS,
+                        const int                 stS,
+                        Ud&                       dU,
+                        const int                 ldu,
+                        const int                 stU,
+                        Ud&                       dV,
+                        const int                 ldv,
+                        const int                 stV,
+                        Ud&                       dWork,
+                        const size_t              lwork,
+                        Uh&                       hWork,
+                        const size_t              lhwork,
+                        Id&                       dinfo,
+                        double*                   hRnrmF,
+                        const int                 bc,
+                        Wh&                       hA,
+                        double*                   gpu_time_used,
+                        double*                   cpu_time_used,
+                        const int                 hot_calls,
+                        const bool                perf)
+{
+    std::vector<T> A(size_t(lda) * n * bc);
+
+    if(!perf)
+    {
+        // there is no randomized SVD in LAPACK to time against
+        *cpu_time_used = nan("");
+    }
+
+    gesvdr_initData<true, false, T>(handle, m, n, rankA, dA, lda, bc, hA, A);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gesvdr_initData<false, true, T>(handle, m, n, rankA, dA, lda, bc, hA, A);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_gesvdr(API,
+                                             STRIDED,
+                                             handle,
+                                             params,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             k,
+                                             p,
+                                             niters,
+                                             dA.data(),
+                                             lda,
+                                             stA,
+                                             dS.data(),
+                                             stS,
+                                             dU.data(),
+                                             ldu,
+                                             stU,
+                                             dV.data(),
+                                             ldv,
+                                             stV,
+                                             dWork.data(),
+                                             lwork,
+                                             hWork.data(),
+                                             lhwork,
+                                             dinfo.data(),
+                                             hRnrmF,
+                                             bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        gesvdr_initData<false, true, T>(handle, m, n, rankA, dA, lda, bc, hA, A);
+
+        start = get_time_us_sync(stream);
+        hipsolver_gesvdr(API,
+                         STRIDED,
+                         handle,
+                         params,
+                         jobu,
+                         jobv,
+                         m,
+                         n,
+                         k,
+                         p,
+                         niters,
+                         dA.data(),
+                         lda,
+                         stA,
+                         dS.data(),
+                         stS,
+                         dU.data(),
+                         ldu,
+                         stU,
+                         dV.data(),
+                         ldv,
+                         stV,
+                         dWork.data(),
+                         lwork,
+                         hWork.data(),
+                         lhwork,
+                         dinfo.data(),
+                         hRnrmF,
+                         bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <testAPI_t API, bool STRIDED, typename T>
+void testing_gesvdr(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    hipsolver_local_handle handle;
+    hipsolver_local_params params;
+    char                   jobu   = argus.get<char>("jobu");
+    char                   jobv   = argus.get<char>("jobv");
+    int                    m      = argus.get<int>("m");
+    int                    n      = argus.get<int>("n", m);
+    int                    k      = argus.get<int>("k", 1);
+    int                    p      = argus.get<int>("p", 0);
+    int                    niters = argus.get<int>("niters", 2);
+    int                    rankA  = argus.get<int>("rankA", k + p);
+    int                    lda    = argus.get<int>("lda", m);
+    int                    ldu    = argus.get<int>("ldu", m);
+    int                    ldv    = argus.get<int>("ldv", n);
+    int                    stA    = argus.get<int>("strideA", lda * n);
+    int                    stS    = argus.get<int>("strideS", k);
+    int                    stU    = argus.get<int>("strideU", ldu * k);
+    int                    stV    = argus.get<int>("strideV", ldv * k);
+
+    int bc        = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    int stUres = 0;
+    int stVres = 0;
+
+    // determine sizes
+    size_t size_A     = size_t(lda) * n;
+    size_t size_S     = size_t(k);
+    size_t size_S_cpu = size_t(min(m, n));
+    size_t size_U     = jobu == 'S' ? size_t(ldu) * k : 0;
+    size_t size_V     = jobv == 'S' ? size_t(ldv) * k : 0;
+
+    size_t size_Sres  = 0;
+    size_t size_hUres = 0;
+    size_t size_hVres = 0;
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        size_Sres  = size_S;
+        size_hUres = size_U;
+        size_hVres = size_V;
+        stUres     = stU;
+        stVres     = stV;
+    }
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0, max_errorv = 0, max_errorr = 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || k < 1 || p < 0 || k + p > min(m, n) || niters < 0
+                         || lda < max(m, 1) || bc < 0)
+                        || (jobu == 'S' && ldu < max(m, 1)) || (jobv == 'S' && ldv < max(n, 1));
+
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                               STRIDED,
+                                               handle,
+                                               params,
+                                               jobu,
+                                               jobv,
+                                               m,
+                                               n,
+                                               k,
+                                               p,
+                                               niters,
+                                               (T*)nullptr,
+                                               lda,
+                                               stA,
+                                               (S*)nullptr,
+                                               stS,
+                                               (T*)nullptr,
+                                               ldu,
+                                               stU,
+                                               (T*)nullptr,
+                                               ldv,
+                                               stV,
+                                               (T*)nullptr,
+                                               0,
+                                               (T*)nullptr,
+                                               0,
+                                               (int*)nullptr,
+                                               (double*)nullptr,
+                                               bc),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    size_t size_dW, size_hW;
+    hipsolver_gesvdr_bufferSize(API,
+                                STRIDED,
+                                handle,
+                                params,
+                                jobu,
+                                jobv,
+                                m,
+                                n,
+                                k,
+                                p,
+                                niters,
+                                (T*)nullptr,
+                                lda,
+                                stA,
+                                (S*)nullptr,
+                                stS,
+                                (T*)nullptr,
+                                ldu,
+                                stU,
+                                (T*)nullptr,
+                                ldv,
+                                stV,
+                                &size_dW,
+                                &size_hW,
+                                bc);
+
+    if(argus.mem_query)
+    {
+        rocsolver_bench_inform(inform_mem_query, size_dW);
+        return;
+    }
+
+    // memory allocations
+    // host
+    host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+    host_strided_batch_vector<S> hS(
+        size_S_cpu, 1, size_S_cpu, bc); // extra space for cpu_gesvd call
+    host_strided_batch_vector<double> hRnrmF(1, 1, 1, bc);
+    host_strided_batch_vector<int>    hinfoRes(1, 1, 1, bc);
+    host_strided_batch_vector<S>      hSres(size_Sres, 1, stS, bc);
+    host_strided_batch_vector<T>      hUres(size_hUres, 1, stUres, bc);
+    host_strided_batch_vector<T>      hVres(size_hVres, 1, stVres, bc);
+    host_strided_batch_vector<T>      hWork(size_hW, 1, size_hW, 1);
+    // device
+    device_strided_batch_vector<T>   dA(size_A, 1, stA, bc);
+    device_strided_batch_vector<S>   dS(size_S, 1, stS, bc);
+    device_strided_batch_vector<T>   dU(size_U, 1, stU, bc);
+    device_strided_batch_vector<T>   dV(size_V, 1, stV, bc);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, bc);
+    device_strided_batch_vector<T>   dWork(size_dW, 1, size_dW, 1); // size_dW accounts for bc
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_S)
+        CHECK_HIP_ERROR(dS.memcheck());
+    if(size_U)
+        CHECK_HIP_ERROR(dU.memcheck());
+    if(size_V)
+        CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    if(size_dW)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+    {
+        gesvdr_getError<API, STRIDED, T>(handle,
+                                         params,
+                                         jobu,
+                                         jobv,
+                                         m,
+                                         n,
+                                         k,
+                                         p,
+                                         niters,
+                                         rankA,
+                                         dA,
+                                         lda,
+                                         stA,
+                                         dS,
+                                         stS,
+                                         dU,
+                                         ldu,
+                                         stU,
+                                         dV,
+                                         ldv,
+                                         stV,
+                                         dWork,
+                                         size_dW,
+                                         hWork,
+                                         size_hW,
+                                         dinfo,
+                                         hRnrmF.data(),
+                                         bc,
+                                         hA,
+                                         hS,
+                                         hSres,
+                                         hUres,
+                                         hVres,
+                                         hinfoRes,
+                                         &max_error,
+                                         &max_errorv,
+                                         &max_errorr);
+    }
+
+    // collect performance data
+    if(argus.timing)
+    {
+        gesvdr_getPerfData<API, STRIDED, T>(handle,
+                                            params,
+                                            jobu,
+                                            jobv,
+                                            m,
+                                            n,
+                                            k,
+                                            p,
+                                            niters,
+                                            rankA,
+                                            dA,
+                                            lda,
+                                            stA,
+                                            dS,
+                                            stS,
+                                            dU,
+                                            ldu,
+                                            stU,
+                                            dV,
+                                            ldv,
+                                            stV,
+                                            dWork,
+                                            size_dW,
+                                            hWork,
+                                            size_hW,
+                                            dinfo,
+                                            hRnrmF.data(),
+                                            bc,
+                                            hA,
+                                            &gpu_time_used,
+                                            &cpu_time_used,
+                                            hot_calls,
+                                            argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using 3 * min(m, n) * machine_precision as tolerance
+    if(argus.unit_check)
+    {
+        ROCSOLVER_TEST_CHECK(T, max_error, 3 * min(m, n));
+        if(jobu == 'S' && jobv == 'S')
+            ROCSOLVER_TEST_CHECK(T, max_errorv, 3 * min(m, n));
+        if(STRIDED)
+            ROCSOLVER_TEST_CHECK(T, max_errorr, 3 * max(m, n));
+    }
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        max_error = (max_error >= max_errorv) ? max_error : max_errorv;
+
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            if(STRIDED)
+            {
+                rocsolver_bench_output("jobu",
+                                       "jobv",
+                                       "m",
+                                       "n",
+                                       "k",
+                                       "p",
+                                       "niters",
+                                       "lda",
+                                       "strideA",
+                                       "strideS",
+                                       "ldu",
+                                       "strideU",
+                                       "ldv",
+                                       "strideV",
+                                       "batch_c");
+                rocsolver_bench_output(
+                    jobu, jobv, m, n, k, p, niters, lda, stA, stS, ldu, stU, ldv, stV, bc);
+            }
+            else
+            {
+                rocsolver_bench_output(
+                    "jobu", "jobv", "m", "n", "k", "p", "niters", "lda", "ldu", "ldv");
+                rocsolver_bench_output(jobu, jobv, m, n, k, p, niters, lda, ldu, ldv);
+            }
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
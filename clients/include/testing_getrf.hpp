@@ -24,6 +24,7 @@
 #include "clientcommon.hpp"
 
 template <testAPI_t API,
+          bool STRIDED,
           typename I,
           typename SIZE,
           typename Td,
@@ -49,6 +50,7 @@ void getrf_checkBadArgs(const hipsolverHandle_t   handle,
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_getrf(API,
                                           false,
+                                          STRIDED,
                                           nullptr,
                                           params,
                                           m,
@@ -74,6 +76,7 @@ void getrf_checkBadArgs(const hipsolverHandle_t   handle,
     if constexpr(!std::is_same<I, int>::value)
         EXPECT_ROCBLAS_STATUS(hipsolver_getrf(API,
                                               false,
+                                              STRIDED,
                                               handle,
                                               (hipsolverDnParams_t) nullptr,
                                               m,
@@ -92,6 +95,7 @@ void getrf_checkBadArgs(const hipsolverHandle_t   handle,
                               HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrf(API,
                                           false,
+                                          STRIDED,
                                           handle,
                                           params,
                                           m,
@@ -110,6 +114,7 @@ void getrf_checkBadArgs(const hipsolverHandle_t   handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrf(API,
                                           false,
+                                          STRIDED,
                                           handle,
                                           params,
                                           m,
@@ -174,28 +179,29 @@ void testing_getrf_bad_arg()
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         SIZE size_dW, size_hW;
-        hipsolver_getrf_bufferSize(API, handle, params, m, n, dA.data(), lda, &size_dW, &size_hW);
+        hipsolver_getrf_bufferSize(
+            API, STRIDED, handle, params, m, n, dA.data(), lda, stA, &size_dW, &size_hW, bc);
         host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
         device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
         if(size_dW)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        getrf_checkBadArgs<API>(handle,
-                                params,
-                                m,
-                                n,
-                                dA.data(),
-                                lda,
-                                stA,
-                                dIpiv.data(),
-                                stP,
-                                dWork.data(),
-                                size_dW,
-                                hWork.data(),
-                                size_hW,
-                                dInfo.data(),
-                                bc);
+        getrf_checkBadArgs<API, STRIDED>(handle,
+                                         params,
+                                         m,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         dWork.data(),
+                                         size_dW,
+                                         hWork.data(),
+                                         size_hW,
+                                         dInfo.data(),
+                                         bc);
     }
 }
 
@@ -270,6 +276,7 @@ void getrf_initData(const hipsolverHandle_t   handle,
 
 template <testAPI_t API,
           bool      NPVT,
+          bool      STRIDED,
           typename T,
           typename I,
           typename SIZE,
@@ -310,6 +317,7 @@ void getrf_getError(const hipsolverHandle_t   handle,
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_getrf(API,
                                         NPVT,
+                                        STRIDED,
                                         handle,
                                         params,
                                         m,
@@ -372,6 +380,7 @@ void getrf_getError(const hipsolverHandle_t   handle,
 
 template <testAPI_t API,
           bool      NPVT,
+          bool      STRIDED,
           typename T,
           typename I,
           typename SIZE,
@@ -426,6 +435,7 @@ void getrf_getPerfData(const hipsolverHandle_t   handle,
 
         CHECK_ROCBLAS_ERROR(hipsolver_getrf(API,
                                             NPVT,
+                                            STRIDED,
                                             handle,
                                             params,
                                             m,
@@ -456,6 +466,7 @@ void getrf_getPerfData(const hipsolverHandle_t   handle,
         start = get_time_us_sync(stream);
         hipsolver_getrf(API,
                         NPVT,
+                        STRIDED,
                         handle,
                         params,
                         m,
@@ -541,6 +552,7 @@ void testing_getrf(Arguments& argus)
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_getrf(API,
                                                   NPVT,
+                                                  STRIDED,
                                                   handle,
                                                   params,
                                                   m,
@@ -568,7 +580,8 @@ void testing_getrf(Arguments& argus)
 
     // memory size query is necessary
     SIZE size_dW, size_hW;
-    hipsolver_getrf_bufferSize(API, handle, params, m, n, (T*)nullptr, lda, &size_dW, &size_hW);
+    hipsolver_getrf_bufferSize(
+        API, STRIDED, handle, params, m, n, (T*)nullptr, lda, stA, &size_dW, &size_hW, bc);
 
     if(argus.mem_query)
     {
@@ -673,53 +686,53 @@ void testing_getrf(Arguments& argus)
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            getrf_getError<API, NPVT, T>(handle,
-                                         params,
-                                         m,
-                                         n,
-                                         dA,
-                                         lda,
-                                         stA,
-                                         dIpiv,
-                                         stP,
-                                         dWork,
-                                         size_dW,
-                                         hWork,
-                                         size_hW,
-                                         dInfo,
-                                         bc,
-                                         hA,
-                                         hARes,
-                                         hIpiv,
-                                         hIpivRes,
-                                         hInfo,
-                                         hInfoRes,
-                                         &max_error);
+            getrf_getError<API, NPVT, STRIDED, T>(handle,
+                                                  params,
+                                                  m,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  stA,
+                                                  dIpiv,
+                                                  stP,
+                                                  dWork,
+                                                  size_dW,
+                                                  hWork,
+                                                  size_hW,
+                                                  dInfo,
+                                                  bc,
+                                                  hA,
+                                                  hARes,
+                                                  hIpiv,
+                                                  hIpivRes,
+                                                  hInfo,
+                                                  hInfoRes,
+                                                  &max_error);
 
         // collect performance data
         if(argus.timing)
-            getrf_getPerfData<API, NPVT, T>(handle,
-                                            params,
-                                            m,
-                                            n,
-                                            dA,
-                                            lda,
-                                            stA,
-                                            dIpiv,
-                                            stP,
-                                            dWork,
-                                            size_dW,
-                                            hWork,
-                                            size_hW,
-                                            dInfo,
-                                            bc,
-                                            hA,
-                                            hIpiv,
-                                            hInfo,
-                                            &gpu_time_used,
-                                            &cpu_time_used,
-                                            hot_calls,
-                                            argus.perf);
+            getrf_getPerfData<API, NPVT, STRIDED, T>(handle,
+                                                     params,
+                                                     m,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dIpiv,
+                                                     stP,
+                                                     dWork,
+                                                     size_dW,
+                                                     hWork,
+                                                     size_hW,
+                                                     dInfo,
+                                                     bc,
+                                                     hA,
+                                                     hIpiv,
+                                                     hInfo,
+                                                     &gpu_time_used,
+                                                     &cpu_time_used,
+                                                     hot_calls,
+                                                     argus.perf);
     }
 
     // validate results for rocsolver-test
@@ -25,7 +25,13 @@
 
 #include "clientcommon.hpp"
 
-template <testAPI_t API, typename I, typename SIZE, typename Td, typename Id, typename INTd>
+template <testAPI_t API,
+          bool STRIDED,
+          typename I,
+          typename SIZE,
+          typename Td,
+          typename Id,
+          typename INTd>
 void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                         const hipsolverDnParams_t  params,
                         const hipsolverOperation_t trans,
@@ -46,6 +52,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
 {
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                          STRIDED,
                                           nullptr,
                                           params,
                                           trans,
@@ -67,6 +74,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                          STRIDED,
                                           handle,
                                           params,
                                           hipsolverOperation_t(-1),
@@ -90,6 +98,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
     // pointers
     if constexpr(!std::is_same<I, int>::value)
         EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                              STRIDED,
                                               handle,
                                               (hipsolverDnParams_t) nullptr,
                                               trans,
@@ -109,6 +118,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                                               bc),
                               HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                          STRIDED,
                                           handle,
                                           params,
                                           trans,
@@ -128,6 +138,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                          STRIDED,
                                           handle,
                                           params,
                                           trans,
@@ -147,6 +158,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                          STRIDED,
                                           handle,
                                           params,
                                           trans,
@@ -166,6 +178,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                          STRIDED,
                                           handle,
                                           params,
                                           trans,
@@ -252,6 +265,7 @@ void testing_getrs_bad_arg()
 
         SIZE size_W;
         hipsolver_getrs_bufferSize(API,
+                                   STRIDED,
                                    handle,
                                    params,
                                    trans,
@@ -259,32 +273,36 @@ void testing_getrs_bad_arg()
                                    nrhs,
                                    dA.data(),
                                    lda,
+                                   stA,
                                    dIpiv.data(),
+                                   stP,
                                    dB.data(),
                                    ldb,
-                                   &size_W);
+                                   stB,
+                                   &size_W,
+                                   bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        getrs_checkBadArgs<API>(handle,
-                                params,
-                                trans,
-                                m,
-                                nrhs,
-                                dA.data(),
-                                lda,
-                                stA,
-                                dIpiv.data(),
-                                stP,
-                                dB.data(),
-                                ldb,
-                                stB,
-                                dWork.data(),
-                                size_W,
-                                dInfo.data(),
-                                bc);
+        getrs_checkBadArgs<API, STRIDED>(handle,
+                                         params,
+                                         trans,
+                                         m,
+                                         nrhs,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         dB.data(),
+                                         ldb,
+                                         stB,
+                                         dWork.data(),
+                                         size_W,
+                                         dInfo.data(),
+                                         bc);
     }
 }
 
@@ -357,6 +375,7 @@ void getrs_initData(const hipsolverHandle_t    handle,
 }
 
 template <testAPI_t API,
+          bool STRIDED,
           typename T,
           typename I,
           typename SIZE,
@@ -415,6 +434,7 @@ void getrs_getError(const hipsolverHandle_t    handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_getrs(API,
+                                        STRIDED,
                                         handle,
                                         params,
                                         trans,
@@ -465,6 +485,7 @@ void getrs_getError(const hipsolverHandle_t    handle,
 }
 
 template <testAPI_t API,
+          bool STRIDED,
           typename T,
           typename I,
           typename SIZE,
@@ -573,6 +594,7 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
                                        hB);
 
         CHECK_ROCBLAS_ERROR(hipsolver_getrs(API,
+                                            STRIDED,
                                             handle,
                                             params,
                                             trans,
@@ -620,6 +642,7 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
 
         start = get_time_us_sync(stream);
         hipsolver_getrs(API,
+                        STRIDED,
                         handle,
                         params,
                         trans,
@@ -703,6 +726,7 @@ void testing_getrs(Arguments& argus)
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                                  STRIDED,
                                                   handle,
                                                   params,
                                                   trans,
@@ -732,6 +756,7 @@ void testing_getrs(Arguments& argus)
     // memory size query is necessary
     SIZE size_W;
     hipsolver_getrs_bufferSize(API,
+                               STRIDED,
                                handle,
                                params,
                                trans,
@@ -739,10 +764,14 @@ void testing_getrs(Arguments& argus)
                                nrhs,
                                (T*)nullptr,
                                lda,
+                               stA,
                                (I*)nullptr,
+                               stP,
                                (T*)nullptr,
                                ldb,
-                               &size_W);
+                               stB,
+                               &size_W,
+                               bc);
 
     if(argus.mem_query)
     {
@@ -860,60 +889,60 @@ void testing_getrs(Arguments& argus)
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            getrs_getError<API, T>(handle,
-                                   params,
-                                   trans,
-                                   m,
-                                   nrhs,
-                                   dA,
-                                   lda,
-                                   stA,
-                                   dIpiv,
-                                   stP,
-                                   dB,
-                                   ldb,
-                                   stB,
-                                   dWork,
-                                   size_W,
-                                   dInfo,
-                                   bc,
-                                   hA,
-                                   hIpiv,
-                                   hIpiv_cpu,
-                                   hB,
-                                   hBRes,
-                                   hInfo,
-                                   hInfoRes,
-                                   &max_error);
+            getrs_getError<API, STRIDED, T>(handle,
+                                            params,
+                                            trans,
+                                            m,
+                                            nrhs,
+                                            dA,
+                                            lda,
+                                            stA,
+                                            dIpiv,
+                                            stP,
+                                            dB,
+                                            ldb,
+                                            stB,
+                                            dWork,
+                                            size_W,
+                                            dInfo,
+                                            bc,
+                                            hA,
+                                            hIpiv,
+                                            hIpiv_cpu,
+                                            hB,
+                                            hBRes,
+                                            hInfo,
+                                            hInfoRes,
+                                            &max_error);
 
         // collect performance data
         if(argus.timing)
-            getrs_getPerfData<API, T>(handle,
-                                      params,
-                                      trans,
-                                      m,
-                                      nrhs,
-                                      dA,
-                                      lda,
-                                      stA,
-                                      dIpiv,
-                                      stP,
-                                      dB,
-                                      ldb,
-                                      stB,
-                                      dWork,
-                                      size_W,
-                                      dInfo,
-                                      bc,
-                                      hA,
-                                      hIpiv,
-                                      hIpiv_cpu,
-                                      hB,
-                                      hInfo,
-                                      &gpu_time_used,
-                                      &cpu_time_used,
-                                      hot_calls,
-                                      argus.perf);
+            getrs_getPerfData<API, STRIDED, T>(handle,
+                                               params,
+                                               trans,
+                                               m,
+                                               nrhs,
+                                               dA,
+                                               lda,
+                                               stA,
+                                               dIpiv,
+                                               stP,
+                                               dB,
+                                               ldb,
+                                               stB,
+                                               dWork,
+                                               size_W,
+                                               dInfo,
+                                               bc,
+                                               hA,
+                                               hIpiv,
+                                               hIpiv_cpu,
+                                               hB,
+                                               hInfo,
+                                               &gpu_time_used,
+                                               &cpu_time_used,
+                                               hot_calls,
+                                               argus.perf);
     }
 
     // validate results for rocsolver-test
@@ -0,0 +1,1079 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "syev_heuristic.hpp"
+
+template <testAPI_t API, typename T, typename S, typename U>
+void syev_auto_checkBadArgs(const hipsolverHandle_t   handle,
+                            const hipsolverDnParams_t params,
+                            const hipsolverEigMode_t  jobz,
+                            const hipsolverEigRange_t range,
+                            const hipsolverFillMode_t uplo,
+                            const int                 n,
+                            T                         dA,
+                            const int                 lda,
+                            const int                 stA,
+                            const int                 il,
+                            const int                 iu,
+                            S                         dW,
+                            const int                 stW,
+                            T                         dWork,
+                            const size_t              lwork,
+                            T                         hWork,
+                            const size_t              lhwork,
+                            U                         dinfo,
+                            const int                 bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_syev_auto(API,
+                                              nullptr,
+                                              params,
+                                              jobz,
+                                              range,
+                                              uplo,
+                                              n,
+                                              dA,
+                                              lda,
+                                              stA,
+                                              il,
+                                              iu,
+                                              dW,
+                                              stW,
+                                              dWork,
+                                              lwork,
+                                              hWork,
+                                              lhwork,
+                                              dinfo,
+                                              bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // params
+    EXPECT_ROCBLAS_STATUS(hipsolver_syev_auto(API,
+                                              handle,
+                                              (hipsolverDnParams_t) nullptr,
+                                              jobz,
+                                              range,
+                                              uplo,
+                                              n,
+                                              dA,
+                                              lda,
+                                              stA,
+                                              il,
+                                              iu,
+                                              dW,
+                                              stW,
+                                              dWork,
+                                              lwork,
+                                              hWork,
+                                              lhwork,
+                                              dinfo,
+                                              bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_syev_auto(API,
+                                              handle,
+                                              params,
+                                              hipsolverEigMode_t(-1),
+                                              range,
+                                              uplo,
+                                              n,
+                                              dA,
+                                              lda,
+                                              stA,
+                                              il,
+                                              iu,
+                                              dW,
+                                              stW,
+                                              dWork,
+                                              lwork,
+                                              hWork,
+                                              lhwork,
+                                              dinfo,
+                                              bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syev_auto(API,
+                                              handle,
+                                              params,
+                                              jobz,
+                                              hipsolverEigRange_t(-1),
+                                              uplo,
+                                              n,
+                                              dA,
+                                              lda,
+                                              stA,
+                                              il,
+                                              iu,
+                                              dW,
+                                              stW,
+                                              dWork,
+                                              lwork,
+                                              hWork,
+                                              lhwork,
+                                              dinfo,
+                                              bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syev_auto(API,
+                                              handle,
+                                              params,
+                                              jobz,
+                                              range,
+                                              hipsolverFillMode_t(-1),
+                                              n,
+                                              dA,
+                                              lda,
+                                              stA,
+                                              il,
+                                              iu,
+                                              dW,
+                                              stW,
+                                              dWork,
+                                              lwork,
+                                              hWork,
+                                              lhwork,
+                                              dinfo,
+                                              bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_syev_auto(API,
+                                              handle,
+                                              params,
+                                              jobz,
+                                              range,
+                                              uplo,
+                                              n,
+                                              (T) nullptr,
+                                              lda,
+                                              stA,
+                                              il,
+                                              iu,
+                                              dW,
+                                              stW,
+                                              dWork,
+                                              lwork,
+                                              hWork,
+                                              lhwork,
+                                              dinfo,
+                                              bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syev_auto(API,
+                                              handle,
+                                              params,
+                                              jobz,
+                                              range,
+                                              uplo,
+                                              n,
+                                              dA,
+                                              lda,
+                                              stA,
+                                              il,
+                                              iu,
+                                              (S) nullptr,
+                                              stW,
+                                              dWork,
+                                              lwork,
+                                              hWork,
+                                              lhwork,
+                                              dinfo,
+                                              bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syev_auto(API,
+                                              handle,
+                                              params,
+                                              jobz,
+                                              range,
+                                              uplo,
+                                              n,
+                                              dA,
+                                              lda,
+                                              stA,
+                                              il,
+                                              iu,
+                                              dW,
+                                              stW,
+                                              dWork,
+                                              lwork,
+                                              hWork,
+                                              lhwork,
+                                              (U) nullptr,
+                                              bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, typename T>
+void testing_syev_auto_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolver_local_params params;
+    hipsolverEigMode_t     jobz  = HIPSOLVER_EIG_MODE_VECTOR;
+    hipsolverEigRange_t    range = HIPSOLVER_EIG_RANGE_I;
+    hipsolverFillMode_t    uplo  = HIPSOLVER_FILL_MODE_LOWER;
+    int                    n     = 1;
+    int                    lda   = 1;
+    int                    stA   = 1;
+    int                    il    = 1;
+    int                    iu    = 1;
+    int                    stW   = 1;
+    int                    bc    = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<S>   dW(1, 1, 1, 1);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    size_t size_dW, size_hW;
+    hipsolver_syev_auto_bufferSize(API,
+                                   handle,
+                                   params,
+                                   jobz,
+                                   range,
+                                   uplo,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   il,
+                                   iu,
+                                   dW.data(),
+                                   stW,
+                                   &size_dW,
+                                   &size_hW,
+                                   bc);
+    host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
+    device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
+    if(size_dW)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    syev_auto_checkBadArgs<API>(handle,
+                                params,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                dA.data(),
+                                lda,
+                                stA,
+                                il,
+                                iu,
+                                dW.data(),
+                                stW,
+                                dWork.data(),
+                                size_dW,
+                                hWork.data(),
+                                size_hW,
+                                dinfo.data(),
+                                bc);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // algorithm selection
+    hipsolverSyevAlgorithm_t alg;
+    EXPECT_ROCBLAS_STATUS(hipsolverDnSetSyevAutoAlgorithm(nullptr, HIPSOLVER_SYEV_ALG_SYEVD),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnSetSyevAutoAlgorithm(handle, hipsolverSyevAlgorithm_t(-1)),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDnGetSyevAutoAlgorithm(handle, jobz, range, n, il, iu, bc, nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDnGetSyevAutoAlgorithm(handle, jobz, HIPSOLVER_EIG_RANGE_V, n, il, iu, bc, &alg),
+        HIPSOLVER_STATUS_NOT_SUPPORTED);
+#endif
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void syev_auto_initData(const hipsolverHandle_t  handle,
+                        const hipsolverEigMode_t jobz,
+                        const int                n,
+                        Td&                      dA,
+                        const int                lda,
+                        const int                bc,
+                        Th&                      hA,
+                        std::vector<T>&          A,
+                        bool                     test = true)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(int b = 0; b < bc; ++b)
+        {
+            for(int i = 0; i < n; i++)
+            {
+                for(int j = i; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] = std::real(hA[b][i + j * lda]) + 10;
+                    else
+                    {
+                        if(j == i + 1)
+                        {
+                            hA[b][i + j * lda] = (hA[b][i + j * lda] - 5) / 10;
+                            hA[b][j + i * lda] = conj(hA[b][i + j * lda]);
+                        }
+                        else
+                            hA[b][j + i * lda] = hA[b][i + j * lda] = 0;
+                    }
+                }
+                if(i == n / 4 || i == n / 2 || i == n - 1 || i == n / 7 || i == n / 5 || i == n / 3)
+                    hA[b][i + i * lda] *= -1;
+            }
+
+            // make copy of original data to test vectors if required
+            if(test && jobz == HIPSOLVER_EIG_MODE_VECTOR)
+            {
+                for(int i = 0; i < n; i++)
+                {
+                    for(int j = 0; j < n; j++)
+                        A[b * lda * n + i + j * lda] = hA[b][i + j * lda];
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Sd,
+          typename Td,
+          typename Id,
+          typename Sh,
+          typename Th,
+          typename Ih>
+void syev_auto_getError(const hipsolverHandle_t   handle,
+                        const hipsolverDnParams_t params,
+                        const hipsolverEigMode_t  jobz,
+                        const hipsolverEigRange_t range,
+                        const hipsolverFillMode_t uplo,
+                        const int                 n,
+                        Td&                       dA,
+                        const int                 lda,
+                        const int                 stA,
+                        const int                 il,
+                        const int                 iu,
+                        Sd&                       dW,
+                        const int                 stW,
+                        Td&                       dWork,
+                        const size_t              lwork,
+                        Th&                       hWork,
+                        const size_t              lhwork,
+                        Id&                       dinfo,
+                        const int                 bc,
+                        Th&                       hA,
+                        Th&                       hARes,
+                        Sh&                       hW,
+                        Sh&                       hWRes,
+                        Ih&                       hinfo,
+                        Ih&                       hinfoRes,
+                        double*                   max_err)
+{
+    using S                = decltype(std::real(T{}));
+    constexpr bool COMPLEX = is_complex<T>;
+
+    int size_work  = !COMPLEX ? 35 * n : 33 * n;
+    int size_rwork = !COMPLEX ? 0 : 7 * n;
+    int size_iwork = 5 * n;
+
+    std::vector<T>   work(size_work);
+    std::vector<S>   rwork(size_rwork);
+    std::vector<int> iwork(size_iwork);
+    std::vector<T>   A(lda * n * bc);
+    std::vector<T>   Z(lda * n);
+    std::vector<int> ifail(n);
+    int              nev;
+
+    S abstol = 2 * get_safemin<S>();
+
+    // input data initialization
+    syev_auto_initData<true, true, T>(handle, jobz, n, dA, lda, bc, hA, A);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_syev_auto(API,
+                                            handle,
+                                            params,
+                                            jobz,
+                                            range,
+                                            uplo,
+                                            n,
+                                            dA.data(),
+                                            lda,
+                                            stA,
+                                            il,
+                                            iu,
+                                            dW.data(),
+                                            stW,
+                                            dWork.data(),
+                                            lwork,
+                                            hWork.data(),
+                                            lhwork,
+                                            dinfo.data(),
+                                            bc));
+
+    CHECK_HIP_ERROR(hWRes.transfer_from(dW));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+        CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    // CPU lapack
+    for(int b = 0; b < bc; ++b)
+        cpu_syevx_heevx(jobz,
+                        range,
+                        uplo,
+                        n,
+                        hA[b],
+                        lda,
+                        S(0),
+                        S(0),
+                        il,
+                        iu,
+                        abstol,
+                        &nev,
+                        hW[b],
+                        Z.data(),
+                        lda,
+                        work.data(),
+                        size_work,
+                        rwork.data(),
+                        iwork.data(),
+                        ifail.data(),
+                        hinfo[b]);
+
+    // Check info for non-convergence
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hinfo[b][0], hinfoRes[b][0]) << "where b = " << b;
+        if(hinfo[b][0] != hinfoRes[b][0])
+            *max_err += 1;
+    }
+
+    // (We expect the used input matrices to always converge. Testing
+    // implicitly the equivalent non-converged matrix is very complicated and it boils
+    // down to essentially run the algorithm again and until convergence is achieved).
+
+    double err = 0;
+
+    for(int b = 0; b < bc; ++b)
+    {
+        if(jobz != HIPSOLVER_EIG_MODE_VECTOR)
+        {
+            // only eigenvalues needed; can compare with LAPACK
+
+            // error is ||hW - hWRes|| / ||hW||
+            // using frobenius norm
+            if(hinfo[b][0] == 0)
+                err = norm_error('F', 1, nev, 1, hW[b], hWRes[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+        else
+        {
+            // both eigenvalues and eigenvectors needed; need to implicitly test
+            // eigenvectors due to non-uniqueness of eigenvectors under scaling
+            if(hinfo[b][0] == 0)
+            {
+                // multiply A with each of the nev eigenvectors and divide by corresponding
+                // eigenvalues
+                T alpha;
+                T beta = 0;
+                for(int j = 0; j < nev; j++)
+                {
+                    alpha = T(1) / hWRes[b][j];
+                    cpu_symv_hemv(uplo,
+                                  n,
+                                  alpha,
+                                  A.data() + b * lda * n,
+                                  lda,
+                                  hARes[b] + j * lda,
+                                  1,
+                                  beta,
+                                  hA[b] + j * lda,
+                                  1);
+                }
+
+                // error is ||hA - hARes|| / ||hA||
+                // using frobenius norm
+                err      = norm_error('F', n, nev, lda, hA[b], hARes[b]);
+                *max_err = err > *max_err ? err : *max_err;
+            }
+        }
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Sd,
+          typename Td,
+          typename Id,
+          typename Sh,
+          typename Th,
+          typename Ih>
+void syev_auto_getPerfData(const hipsolverHandle_t   handle,
+                           const hipsolverDnParams_t params,
+                           const hipsolverEigMode_t  jobz,
+                           const hipsolverEigRange_t range,
+                           const hipsolverFillMode_t uplo,
+                           const int                 n,
+                           Td&                       dA,
+                           const int                 lda,
+                           const int                 stA,
+                           const int                 il,
+                           const int                 iu,
+                           Sd&                       dW,
+                           const int                 stW,
+                           Td&                       dWork,
+                           const size_t              lwork,
+                           Th&                       hWork,
+                           const size_t              lhwork,
+                           Id&                       dinfo,
+                           const int                 bc,
+                           Th&                       hA,
+                           Sh&                       hW,
+                           Ih&                       hinfo,
+                           double*                   gpu_time_used,
+                           double*                   cpu_time_used,
+                           const int                 hot_calls,
+                           const bool                perf)
+{
+    using S                = decltype(std::real(T{}));
+    constexpr bool COMPLEX = is_complex<T>;
+
+    int size_work  = !COMPLEX ? 35 * n : 33 * n;
+    int size_rwork = !COMPLEX ? 0 : 7 * n;
+    int size_iwork = 5 * n;
+
+    std::vector<T>   work(size_work);
+    std::vector<S>   rwork(size_rwork);
+    std::vector<int> iwork(size_iwork);
+    std::vector<T>   A;
+    std::vector<T>   Z(lda * n);
+    std::vector<int> ifail(n);
+    int              nev;
+
+    S abstol = 2 * get_safemin<S>();
+
+    if(!perf)
+    {
+        syev_auto_initData<true, false, T>(handle, jobz, n, dA, lda, bc, hA, A, 0);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(int b = 0; b < bc; ++b)
+            cpu_syevx_heevx(jobz,
+                            range,
+                            uplo,
+                            n,
+                            hA[b],
+                            lda,
+                            S(0),
+                            S(0),
+                            il,
+                            iu,
+                            abstol,
+                            &nev,
+                            hW[b],
+                            Z.data(),
+                            lda,
+                            work.data(),
+                            size_work,
+                            rwork.data(),
+                            iwork.data(),
+                            ifail.data(),
+                            hinfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    syev_auto_initData<true, false, T>(handle, jobz, n, dA, lda, bc, hA, A, 0);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        syev_auto_initData<false, true, T>(handle, jobz, n, dA, lda, bc, hA, A, 0);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_syev_auto(API,
+                                                handle,
+                                                params,
+                                                jobz,
+                                                range,
+                                                uplo,
+                                                n,
+                                                dA.data(),
+                                                lda,
+                                                stA,
+                                                il,
+                                                iu,
+                                                dW.data(),
+                                                stW,
+                                                dWork.data(),
+                                                lwork,
+                                                hWork.data(),
+                                                lhwork,
+                                                dinfo.data(),
+                                                bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        syev_auto_initData<false, true, T>(handle, jobz, n, dA, lda, bc, hA, A, 0);
+
+        start = get_time_us_sync(stream);
+        hipsolver_syev_auto(API,
+                            handle,
+                            params,
+                            jobz,
+                            range,
+                            uplo,
+                            n,
+                            dA.data(),
+                            lda,
+                            stA,
+                            il,
+                            iu,
+                            dW.data(),
+                            stW,
+                            dWork.data(),
+                            lwork,
+                            hWork.data(),
+                            lhwork,
+                            dinfo.data(),
+                            bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <testAPI_t API, typename T>
+void testing_syev_auto(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    hipsolver_local_handle handle;
+    hipsolver_local_params params;
+    char                   jobzC  = argus.get<char>("jobz");
+    char                   rangeC = argus.get<char>("range");
+    char                   uploC  = argus.get<char>("uplo");
+    char                   algC   = argus.get<char>("alg", 'A');
+    int                    n      = argus.get<int>("n");
+    int                    lda    = argus.get<int>("lda", n);
+    int                    stA    = argus.get<int>("strideA", lda * n);
+    int                    stW    = argus.get<int>("strideW", n);
+
+    int il = argus.get<int>("il", rangeC == 'I' ? 1 : 0);
+    int iu = argus.get<int>("iu", rangeC == 'I' ? 1 : 0);
+
+    hipsolverEigMode_t  jobz      = char2hipsolver_evect(jobzC);
+    hipsolverEigRange_t range     = char2hipsolver_erange(rangeC);
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 bc        = argus.batch_count;
+    int                 hot_calls = argus.iters;
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // A = chosen by the table of the device
+    CHECK_ROCBLAS_ERROR(hipsolverDnSetSyevAutoAlgorithm(handle, char2hipsolver_syev_alg(algC)));
+#endif
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_W    = n;
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_WRes = (argus.unit_check || argus.norm_check) ? size_W : 0;
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size
+        = (n < 0 || lda < max(n, 1) || bc < 0
+           || (range == HIPSOLVER_EIG_RANGE_I && n > 0 && (il < 1 || iu < il || iu > n)));
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_syev_auto(API,
+                                                  handle,
+                                                  params,
+                                                  jobz,
+                                                  range,
+                                                  uplo,
+                                                  n,
+                                                  (T*)nullptr,
+                                                  lda,
+                                                  stA,
+                                                  il,
+                                                  iu,
+                                                  (S*)nullptr,
+                                                  stW,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  bc),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    size_t size_dW, size_hW;
+    hipsolver_syev_auto_bufferSize(API,
+                                   handle,
+                                   params,
+                                   jobz,
+                                   range,
+                                   uplo,
+                                   n,
+                                   (T*)nullptr,
+                                   lda,
+                                   stA,
+                                   il,
+                                   iu,
+                                   (S*)nullptr,
+                                   stW,
+                                   &size_dW,
+                                   &size_hW,
+                                   bc);
+
+    if(argus.mem_query)
+    {
+        rocsolver_bench_inform(inform_mem_query, size_dW);
+        return;
+    }
+
+    // memory allocations
+    // host
+    host_strided_batch_vector<T>   hA(size_A, 1, stA, bc);
+    host_strided_batch_vector<T>   hARes(size_ARes, 1, stA, bc);
+    host_strided_batch_vector<S>   hW(size_W, 1, stW, bc);
+    host_strided_batch_vector<S>   hWRes(size_WRes, 1, stW, bc);
+    host_strided_batch_vector<int> hinfo(1, 1, 1, bc);
+    host_strided_batch_vector<int> hinfoRes(1, 1, 1, bc);
+    host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
+    // device
+    device_strided_batch_vector<T>   dA(size_A, 1, stA, bc);
+    device_strided_batch_vector<S>   dW(size_W, 1, stW, bc);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, bc);
+    device_strided_batch_vector<T>   dWork(size_dW, 1, size_dW, 1); // size_dW accounts for bc
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_W)
+        CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    if(size_dW)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+    {
+        syev_auto_getError<API, T>(handle,
+                                   params,
+                                   jobz,
+                                   range,
+                                   uplo,
+                                   n,
+                                   dA,
+                                   lda,
+                                   stA,
+                                   il,
+                                   iu,
+                                   dW,
+                                   stW,
+                                   dWork,
+                                   size_dW,
+                                   hWork,
+                                   size_hW,
+                                   dinfo,
+                                   bc,
+                                   hA,
+                                   hARes,
+                                   hW,
+                                   hWRes,
+                                   hinfo,
+                                   hinfoRes,
+                                   &max_error);
+    }
+
+    // collect performance data
+    if(argus.timing)
+    {
+        syev_auto_getPerfData<API, T>(handle,
+                                      params,
+                                      jobz,
+                                      range,
+                                      uplo,
+                                      n,
+                                      dA,
+                                      lda,
+                                      stA,
+                                      il,
+                                      iu,
+                                      dW,
+                                      stW,
+                                      dWork,
+                                      size_dW,
+                                      hWork,
+                                      size_hW,
+                                      dinfo,
+                                      bc,
+                                      hA,
+                                      hW,
+                                      hinfo,
+                                      &gpu_time_used,
+                                      &cpu_time_used,
+                                      hot_calls,
+                                      argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using 4 * n * machine_precision as tolerance, as for syevj
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, 4 * n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("jobz",
+                                   "range",
+                                   "uplo",
+                                   "n",
+                                   "lda",
+                                   "strideA",
+                                   "il",
+                                   "iu",
+                                   "strideW",
+                                   "alg",
+                                   "batch_c");
+            rocsolver_bench_output(jobzC, rangeC, uploC, n, lda, stA, il, iu, stW, algC, bc);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+/* Tuning mode of hipsolver-bench. syevd, syevj and syevdx are timed on a grid of problems, with
+   sizes and batch counts up to n and batch_count, and the fastest for each problem is written to
+   the table that syevAuto reads from HIPSOLVER_TUNING_DIR. Problems whose matrices would take more
+   than a quarter of the device memory are skipped. */
+template <testAPI_t API, typename T>
+void tune_syev_auto(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    hipsolver_local_handle handle;
+    hipsolver_local_params params;
+    hipsolverFillMode_t    uplo      = HIPSOLVER_FILL_MODE_LOWER;
+    int                    max_n     = argus.get<int>("n", 1024);
+    int                    max_bc    = argus.batch_count;
+    int                    hot_calls = argus.iters;
+
+    // tables are named after the architecture, without its feature flags
+    int             device;
+    hipDeviceProp_t props;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&props, device));
+    std::string arch = props.gcnArchName;
+    arch             = arch.substr(0, arch.find(':'));
+
+    std::string output = argus.get<std::string>("tune_output", "syev_auto_" + arch + ".json");
+
+    // in the order of hipsolver::syev_algorithm
+    const hipsolverSyevAlgorithm_t algs[]
+        = {HIPSOLVER_SYEV_ALG_SYEVD, HIPSOLVER_SYEV_ALG_SYEVJ, HIPSOLVER_SYEV_ALG_SYEVDX};
+
+    hipsolver::syev_heuristic table;
+    table.device = arch;
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+
+    rocsolver_bench_output("jobz", "n", "batch_c", "fraction", "algorithm", "gpu_time");
+    for(char jobzC : {'N', 'V'})
+    {
+        for(int n = 16; n <= max_n; n *= 2)
+        {
+            for(int bc = 1; bc <= max_bc; bc *= 8)
+            {
+                if(sizeof(T) * n * n * bc > props.totalGlobalMem / 4)
+                    continue;
+
+                for(double fraction : {0.1, 1.0})
+                {
+                    hipsolverEigMode_t  jobz  = char2hipsolver_evect(jobzC);
+                    hipsolverEigRange_t range
+                        = fraction < 1 ? HIPSOLVER_EIG_RANGE_I : HIPSOLVER_EIG_RANGE_ALL;
+                    int lda = n;
+                    int stA = lda * n;
+                    int stW = n;
+                    int il  = 1;
+                    int iu  = max(int(n * fraction), 1);
+
+                    // memory allocations
+                    std::vector<T>                   A;
+                    host_strided_batch_vector<T>     hA(size_t(lda) * n, 1, stA, bc);
+                    device_strided_batch_vector<T>   dA(size_t(lda) * n, 1, stA, bc);
+                    device_strided_batch_vector<S>   dW(n, 1, stW, bc);
+                    device_strided_batch_vector<int> dinfo(1, 1, 1, bc);
+                    CHECK_HIP_ERROR(dA.memcheck());
+                    CHECK_HIP_ERROR(dW.memcheck());
+                    CHECK_HIP_ERROR(dinfo.memcheck());
+
+                    syev_auto_initData<true, false, T>(handle, jobz, n, dA, lda, bc, hA, A, false);
+
+                    double                    best_time = -1;
+                    hipsolver::syev_algorithm best      = hipsolver::syev_alg_syevd;
+                    for(int a = 0; a < hipsolver::syev_algorithm_count; a++)
+                    {
+                        CHECK_ROCBLAS_ERROR(hipsolverDnSetSyevAutoAlgorithm(handle, algs[a]));
+
+                        size_t size_dW, size_hW;
+                        CHECK_ROCBLAS_ERROR(hipsolver_syev_auto_bufferSize(API,
+                                                                           handle,
+                                                                           params,
+                                                                           jobz,
+                                                                           range,
+                                                                           uplo,
+                                                                           n,
+                                                                           dA.data(),
+                                                                           lda,
+                                                                           stA,
+                                                                           il,
+                                                                           iu,
+                                                                           dW.data(),
+                                                                           stW,
+                                                                           &size_dW,
+                                                                           &size_hW,
+                                                                           bc));
+                        host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
+                        device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
+                        if(size_dW)
+                            CHECK_HIP_ERROR(dWork.memcheck());
+
+                        // the first call is not timed
+                        double time = 0;
+                        for(int iter = 0; iter <= hot_calls; iter++)
+                        {
+                            syev_auto_initData<false, true, T>(
+                                handle, jobz, n, dA, lda, bc, hA, A, false);
+
+                            double start = get_time_us_sync(stream);
+                            CHECK_ROCBLAS_ERROR(hipsolver_syev_auto(API,
+                                                                    handle,
+                                                                    params,
+                                                                    jobz,
+                                                                    range,
+                                                                    uplo,
+                                                                    n,
+                                                                    dA.data(),
+                                                                    lda,
+                                                                    stA,
+                                                                    il,
+                                                                    iu,
+                                                                    dW.data(),
+                                                                    stW,
+                                                                    dWork.data(),
+                                                                    size_dW,
+                                                                    hWork.data(),
+                                                                    size_hW,
+                                                                    dinfo.data(),
+                                                                    bc));
+                            if(iter > 0)
+                                time += get_time_us_sync(stream) - start;
+                        }
+                        time /= hot_calls;
+
+                        if(best_time < 0 || time < best_time)
+                        {
+                            best_time = time;
+                            best      = hipsolver::syev_algorithm(a);
+                        }
+                    }
+
+                    table.entries.push_back({n, bc, jobzC == 'V', fraction, best});
+                    rocsolver_bench_output(
+                        jobzC, n, bc, fraction, hipsolver::syev_algorithm_name(best), best_time);
+                }
+            }
+        }
+    }
+
+    if(table.write(output))
+        std::cerr << "Wrote the syevAuto table for " << arch << " to " << output << std::endl;
+    else
+        std::cerr << "Could not write the syevAuto table to " << output << std::endl;
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
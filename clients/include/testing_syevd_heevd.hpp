@@ -25,7 +25,7 @@
 
 #include "clientcommon.hpp"
 
-template <testAPI_t API, typename T, typename S, typename U>
+template <testAPI_t API, bool STRIDED, typename T, typename S, typename U>
 void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
                               const hipsolverEigMode_t  evect,
                               const hipsolverFillMode_t uplo,
@@ -43,11 +43,12 @@ void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
     // handle
     EXPECT_ROCBLAS_STATUS(
         hipsolver_syevd_heevd(
-            API, nullptr, evect, uplo, n, dA, lda, stA, dD, stD, dWork, lwork, dinfo, bc),
+            API, STRIDED, nullptr, evect, uplo, n, dA, lda, stA, dD, stD, dWork, lwork, dinfo, bc),
         HIPSOLVER_STATUS_NOT_INITIALIZED);
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(API,
+                                                STRIDED,
                                                 handle,
                                                 hipsolverEigMode_t(-1),
                                                 uplo,
@@ -63,6 +64,7 @@ void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
     EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(API,
+                                                STRIDED,
                                                 handle,
                                                 evect,
                                                 hipsolverFillMode_t(-1),
@@ -81,16 +83,55 @@ void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
     EXPECT_ROCBLAS_STATUS(
-        hipsolver_syevd_heevd(
-            API, handle, evect, uplo, n, (T) nullptr, lda, stA, dD, stD, dWork, lwork, dinfo, bc),
+        hipsolver_syevd_heevd(API,
+                              STRIDED,
+                              handle,
+                              evect,
+                              uplo,
+                              n,
+                              (T) nullptr,
+                              lda,
+                              stA,
+                              dD,
+                              stD,
+                              dWork,
+                              lwork,
+                              dinfo,
+                              bc),
         HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(
-        hipsolver_syevd_heevd(
-            API, handle, evect, uplo, n, dA, lda, stA, (S) nullptr, stD, dWork, lwork, dinfo, bc),
+        hipsolver_syevd_heevd(API,
+                              STRIDED,
+                              handle,
+                              evect,
+                              uplo,
+                              n,
+                              dA,
+                              lda,
+                              stA,
+                              (S) nullptr,
+                              stD,
+                              dWork,
+                              lwork,
+                              dinfo,
+                              bc),
         HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(
-        hipsolver_syevd_heevd(
-            API, handle, evect, uplo, n, dA, lda, stA, dD, stD, dWork, lwork, (U) nullptr, bc),
+        hipsolver_syevd_heevd(API,
+                              STRIDED,
+                              handle,
+                              evect,
+                              uplo,
+                              n,
+                              dA,
+                              lda,
+                              stA,
+                              dD,
+                              stD,
+                              dWork,
+                              lwork,
+                              (U) nullptr,
+                              bc),
         HIPSOLVER_STATUS_INVALID_VALUE);
 #endif
 }
@@ -154,25 +195,25 @@ void testing_syevd_heevd_bad_arg()
 
         int size_W;
         hipsolver_syevd_heevd_bufferSize(
-            API, handle, evect, uplo, n, dA.data(), lda, dD.data(), &size_W);
+            API, STRIDED, handle, evect, uplo, n, dA.data(), lda, stA, dD.data(), stD, &size_W, bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        syevd_heevd_checkBadArgs<API>(handle,
-                                      evect,
-                                      uplo,
-                                      n,
-                                      dA.data(),
-                                      lda,
-                                      stA,
-                                      dD.data(),
-                                      stD,
-                                      dWork.data(),
-                                      size_W,
-                                      dinfo.data(),
-                                      bc);
+        syevd_heevd_checkBadArgs<API, STRIDED>(handle,
+                                               evect,
+                                               uplo,
+                                               n,
+                                               dA.data(),
+                                               lda,
+                                               stA,
+                                               dD.data(),
+                                               stD,
+                                               dWork.data(),
+                                               size_W,
+                                               dinfo.data(),
+                                               bc);
     }
 }
 
@@ -225,6 +266,7 @@ void syevd_heevd_initData(const hipsolverHandle_t  handle,
 }
 
 template <testAPI_t API,
+          bool STRIDED,
           typename T,
           typename Sd,
           typename Td,
@@ -280,6 +322,7 @@ void syevd_heevd_getError(const hipsolverHandle_t   handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_syevd_heevd(API,
+                                              STRIDED,
                                               handle,
                                               evect,
                                               uplo,
@@ -377,6 +420,7 @@ void syevd_heevd_getError(const hipsolverHandle_t   handle,
 }
 
 template <testAPI_t API,
+          bool STRIDED,
           typename T,
           typename Sd,
           typename Td,
@@ -457,6 +501,7 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
         syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
         CHECK_ROCBLAS_ERROR(hipsolver_syevd_heevd(API,
+                                                  STRIDED,
                                                   handle,
                                                   evect,
                                                   uplo,
@@ -483,6 +528,7 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
 
         start = get_time_us_sync(stream);
         hipsolver_syevd_heevd(API,
+                              STRIDED,
                               handle,
                               evect,
                               uplo,
@@ -553,6 +599,7 @@ void testing_syevd_heevd(Arguments& argus)
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(API,
+                                                        STRIDED,
                                                         handle,
                                                         evect,
                                                         uplo,
@@ -578,7 +625,7 @@ void testing_syevd_heevd(Arguments& argus)
     // memory size query is necessary
     int size_W;
     hipsolver_syevd_heevd_bufferSize(
-        API, handle, evect, uplo, n, (T*)nullptr, lda, (S*)nullptr, &size_W);
+        API, STRIDED, handle, evect, uplo, n, (T*)nullptr, lda, stA, (S*)nullptr, stD, &size_W, bc);
 
     if(argus.mem_query)
     {
@@ -674,51 +721,51 @@ void testing_syevd_heevd(Arguments& argus)
         // check computations
         if(argus.unit_check || argus.norm_check)
         {
-            syevd_heevd_getError<API, T>(handle,
-                                         evect,
-                                         uplo,
-                                         n,
-                                         dA,
-                                         lda,
-                                         stA,
-                                         dD,
-                                         stD,
-                                         dWork,
-                                         size_W,
-                                         dinfo,
-                                         bc,
-                                         hA,
-                                         hAres,
-                                         hD,
-                                         hDres,
-                                         hinfo,
-                                         hinfoRes,
-                                         &max_error);
+            syevd_heevd_getError<API, STRIDED, T>(handle,
+                                                  evect,
+                                                  uplo,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  stA,
+                                                  dD,
+                                                  stD,
+                                                  dWork,
+                                                  size_W,
+                                                  dinfo,
+                                                  bc,
+                                                  hA,
+                                                  hAres,
+                                                  hD,
+                                                  hDres,
+                                                  hinfo,
+                                                  hinfoRes,
+                                                  &max_error);
         }
 
         // collect performance data
         if(argus.timing)
         {
-            syevd_heevd_getPerfData<API, T>(handle,
-                                            evect,
-                                            uplo,
-                                            n,
-                                            dA,
-                                            lda,
-                                            stA,
-                                            dD,
-                                            stD,
-                                            dWork,
-                                            size_W,
-                                            dinfo,
-                                            bc,
-                                            hA,
-                                            hD,
-                                            hinfo,
-                                            &gpu_time_used,
-                                            &cpu_time_used,
-                                            hot_calls,
-                                            argus.perf);
+            syevd_heevd_getPerfData<API, STRIDED, T>(handle,
+                                                     evect,
+                                                     uplo,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dD,
+                                                     stD,
+                                                     dWork,
+                                                     size_W,
+                                                     dinfo,
+                                                     bc,
+                                                     hA,
+                                                     hD,
+                                                     hinfo,
+                                                     &gpu_time_used,
+                                                     &cpu_time_used,
+                                                     hot_calls,
+                                                     argus.perf);
         }
     }
 
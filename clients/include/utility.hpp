@@ -648,6 +648,34 @@ inline void
 
     fclose(mat);
 }
+
+// 64-bit integers:
+inline void
+    read_matrix(const std::string filenameS, const int m, const int n, int64_t* A, const int lda)
+{
+    const char* filename = filenameS.c_str();
+    FILE*       mat;
+    mat = fopen(filename, "r");
+    long long v;
+
+    if(mat == NULL)
+        throw std::invalid_argument(std::string("Error: Could not open file ") + filename
+                                    + " with test data...");
+
+    for(int j = 0; j < n; ++j)
+    {
+        for(int i = 0; i < m; ++i)
+        {
+            int read = fscanf(mat, "%lld", &v);
+            if(read != 1)
+                throw std::out_of_range(std::string("Error: Could not read element from file ")
+                                        + filename);
+            A[i + j * lda] = v;
+        }
+    }
+
+    fclose(mat);
+}
 inline void read_last(const std::string filenameS, int* A)
 {
     const char* filename = filenameS.c_str();
@@ -666,6 +694,24 @@ inline void read_last(const std::string filenameS, int* A)
 
     *A = v;
 }
+inline void read_last(const std::string filenameS, int64_t* A)
+{
+    const char* filename = filenameS.c_str();
+    FILE*       mat;
+    mat = fopen(filename, "r");
+    long long v;
+
+    if(mat == NULL)
+        throw std::invalid_argument(std::string("Error: Could not open file ") + filename
+                                    + " with test data...");
+
+    while(fscanf(mat, "%lld", &v) == 1)
+    {
+        // do nothing
+    }
+
+    *A = v;
+}
 
 // singles:
 inline void
@@ -802,6 +848,18 @@ double get_time_us_sync(hipStream_t stream);
 /*! \brief  CPU Timer(in microsecond): no GPU synchronization and return wall time */
 double get_time_us_no_sync();
 
+/* ============================================================================================ */
+/*  host memory: resident set size of the process, as reported by the operating system*/
+
+/*! \brief  Host memory(in KiB): current resident set size, or NaN if not available */
+double get_host_memory_kb();
+
+/*! \brief  Host memory(in KiB): peak resident set size since the last reset, or NaN */
+double get_host_peak_memory_kb();
+
+/*! \brief  Host memory: reset the peak resident set size to the current resident set size */
+void reset_host_peak_memory();
+
 #ifdef __cplusplus
 }
 #endif
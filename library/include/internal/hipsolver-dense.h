@@ -750,6 +750,90 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZZgels(hipsolverHandle_t handle,
                                                      int*              niters,
                                                      int*              devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDSgels_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                double*           A,
+                                                                int               lda,
+                                                                double*           B,
+                                                                int               ldb,
+                                                                double*           X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDHgels_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                double*           A,
+                                                                int               lda,
+                                                                double*           B,
+                                                                int               ldb,
+                                                                double*           X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZCgels_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                hipDoubleComplex* A,
+                                                                int               lda,
+                                                                hipDoubleComplex* B,
+                                                                int               ldb,
+                                                                hipDoubleComplex* X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDSgels(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     double*           A,
+                                                     int               lda,
+                                                     double*           B,
+                                                     int               ldb,
+                                                     double*           X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDHgels(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     double*           A,
+                                                     int               lda,
+                                                     double*           B,
+                                                     int               ldb,
+                                                     double*           X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZCgels(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     hipDoubleComplex* A,
+                                                     int               lda,
+                                                     hipDoubleComplex* B,
+                                                     int               ldb,
+                                                     hipDoubleComplex* X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
 // geqrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnSgeqrf_bufferSize(
     hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
@@ -916,6 +1000,118 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZZgesv(hipsolverHandle_t handle,
                                                      int*              niters,
                                                      int*              devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDSgesv_bufferSize(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                double*           A,
+                                                                int               lda,
+                                                                int*              devIpiv,
+                                                                double*           B,
+                                                                int               ldb,
+                                                                double*           X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDHgesv_bufferSize(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                double*           A,
+                                                                int               lda,
+                                                                int*              devIpiv,
+                                                                double*           B,
+                                                                int               ldb,
+                                                                double*           X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZCgesv_bufferSize(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                hipDoubleComplex* A,
+                                                                int               lda,
+                                                                int*              devIpiv,
+                                                                hipDoubleComplex* B,
+                                                                int               ldb,
+                                                                hipDoubleComplex* X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZKgesv_bufferSize(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                hipDoubleComplex* A,
+                                                                int               lda,
+                                                                int*              devIpiv,
+                                                                hipDoubleComplex* B,
+                                                                int               ldb,
+                                                                hipDoubleComplex* X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDSgesv(hipsolverHandle_t handle,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     double*           A,
+                                                     int               lda,
+                                                     int*              devIpiv,
+                                                     double*           B,
+                                                     int               ldb,
+                                                     double*           X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDHgesv(hipsolverHandle_t handle,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     double*           A,
+                                                     int               lda,
+                                                     int*              devIpiv,
+                                                     double*           B,
+                                                     int               ldb,
+                                                     double*           X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZCgesv(hipsolverHandle_t handle,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     hipDoubleComplex* A,
+                                                     int               lda,
+                                                     int*              devIpiv,
+                                                     hipDoubleComplex* B,
+                                                     int               ldb,
+                                                     hipDoubleComplex* X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZKgesv(hipsolverHandle_t handle,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     hipDoubleComplex* A,
+                                                     int               lda,
+                                                     int*              devIpiv,
+                                                     hipDoubleComplex* B,
+                                                     int               ldb,
+                                                     hipDoubleComplex* X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
 // gesvd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnSgesvd_bufferSize(hipsolverHandle_t handle,
                                                                 int               m,
@@ -19,8 +19,18 @@ typedef enum
 typedef enum
 {
     HIPSOLVERDN_GETRF = 0,
+    HIPSOLVERDN_POTRF = 1,
+    HIPSOLVERDN_GEQRF = 2,
 } hipsolverDnFunction_t;
 
+typedef enum
+{
+    HIPSOLVER_SYEV_ALG_AUTO   = 281,
+    HIPSOLVER_SYEV_ALG_SYEVD  = 282,
+    HIPSOLVER_SYEV_ALG_SYEVJ  = 283,
+    HIPSOLVER_SYEV_ALG_SYEVDX = 284,
+} hipsolverSyevAlgorithm_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -90,6 +100,36 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgetrf(hipsolverDnHandle_t handle,
                                                      size_t              lworkOnHost,
                                                      int*                devInfo);
 
+// getrfOutOfCore
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDnXgetrfOutOfCore_bufferSize(hipsolverDnHandle_t handle,
+                                          hipsolverDnParams_t params,
+                                          int64_t             m,
+                                          int64_t             n,
+                                          hipDataType         dataTypeA,
+                                          const void*         A,
+                                          int64_t             lda,
+                                          hipDataType         computeType,
+                                          int64_t             tileSize,
+                                          size_t*             lworkOnDevice,
+                                          size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgetrfOutOfCore(hipsolverDnHandle_t handle,
+                                                              hipsolverDnParams_t params,
+                                                              int64_t             m,
+                                                              int64_t             n,
+                                                              hipDataType         dataTypeA,
+                                                              void*               A,
+                                                              int64_t             lda,
+                                                              int64_t*            hostIpiv,
+                                                              hipDataType         computeType,
+                                                              int64_t             tileSize,
+                                                              void*               workOnDevice,
+                                                              size_t              lworkOnDevice,
+                                                              void*               workOnHost,
+                                                              size_t              lworkOnHost,
+                                                              int*                hostInfo);
+
 // getrs
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgetrs(hipsolverDnHandle_t  handle,
                                                      hipsolverDnParams_t  params,
@@ -131,6 +171,35 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrf(hipsolverDnHandle_t handle,
                                                      size_t              lworkOnHost,
                                                      int*                info);
 
+// potrfOutOfCore
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDnXpotrfOutOfCore_bufferSize(hipsolverDnHandle_t handle,
+                                          hipsolverDnParams_t params,
+                                          hipsolverFillMode_t uplo,
+                                          int64_t             n,
+                                          hipDataType         dataTypeA,
+                                          const void*         A,
+                                          int64_t             lda,
+                                          hipDataType         computeType,
+                                          int64_t             tileSize,
+                                          size_t*             lworkOnDevice,
+                                          size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrfOutOfCore(hipsolverDnHandle_t handle,
+                                                              hipsolverDnParams_t params,
+                                                              hipsolverFillMode_t uplo,
+                                                              int64_t             n,
+                                                              hipDataType         dataTypeA,
+                                                              void*               A,
+                                                              int64_t             lda,
+                                                              hipDataType         computeType,
+                                                              int64_t             tileSize,
+                                                              void*               workOnDevice,
+                                                              size_t              lworkOnDevice,
+                                                              void*               workOnHost,
+                                                              size_t              lworkOnHost,
+                                                              int*                hostInfo);
+
 // potrs
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrs(hipsolverDnHandle_t handle,
                                                      hipsolverDnParams_t params,
@@ -145,6 +214,406 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrs(hipsolverDnHandle_t handle,
                                                      int64_t             ldb,
                                                      int*                info);
 
+// syevd
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsyevd_bufferSize(hipsolverDnHandle_t handle,
+                                                                hipsolverDnParams_t params,
+                                                                hipsolverEigMode_t  jobz,
+                                                                hipsolverFillMode_t uplo,
+                                                                int64_t             n,
+                                                                hipDataType         dataTypeA,
+                                                                const void*         A,
+                                                                int64_t             lda,
+                                                                hipDataType         dataTypeW,
+                                                                const void*         W,
+                                                                hipDataType         computeType,
+                                                                size_t*             lworkOnDevice,
+                                                                size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsyevd(hipsolverDnHandle_t handle,
+                                                     hipsolverDnParams_t params,
+                                                     hipsolverEigMode_t  jobz,
+                                                     hipsolverFillMode_t uplo,
+                                                     int64_t             n,
+                                                     hipDataType         dataTypeA,
+                                                     void*               A,
+                                                     int64_t             lda,
+                                                     hipDataType         dataTypeW,
+                                                     void*               W,
+                                                     hipDataType         computeType,
+                                                     void*               workOnDevice,
+                                                     size_t              lworkOnDevice,
+                                                     void*               workOnHost,
+                                                     size_t              lworkOnHost,
+                                                     int*                info);
+
+// syevdx
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsyevdx_bufferSize(hipsolverDnHandle_t handle,
+                                                                 hipsolverDnParams_t params,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverEigRange_t range,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int64_t             n,
+                                                                 hipDataType         dataTypeA,
+                                                                 const void*         A,
+                                                                 int64_t             lda,
+                                                                 void*               vl,
+                                                                 void*               vu,
+                                                                 int64_t             il,
+                                                                 int64_t             iu,
+                                                                 int64_t*            nev,
+                                                                 hipDataType         dataTypeW,
+                                                                 const void*         W,
+                                                                 hipDataType         computeType,
+                                                                 size_t*             lworkOnDevice,
+                                                                 size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsyevdx(hipsolverDnHandle_t handle,
+                                                      hipsolverDnParams_t params,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverEigRange_t range,
+                                                      hipsolverFillMode_t uplo,
+                                                      int64_t             n,
+                                                      hipDataType         dataTypeA,
+                                                      void*               A,
+                                                      int64_t             lda,
+                                                      void*               vl,
+                                                      void*               vu,
+                                                      int64_t             il,
+                                                      int64_t             iu,
+                                                      int64_t*            nev,
+                                                      hipDataType         dataTypeW,
+                                                      void*               W,
+                                                      hipDataType         computeType,
+                                                      void*               workOnDevice,
+                                                      size_t              lworkOnDevice,
+                                                      void*               workOnHost,
+                                                      size_t              lworkOnHost,
+                                                      int*                info);
+
+// syevAuto
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnSetSyevAutoAlgorithm(hipsolverDnHandle_t      handle,
+                                                                   hipsolverSyevAlgorithm_t alg);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDnGetSyevAutoAlgorithm(hipsolverDnHandle_t       handle,
+                                    hipsolverEigMode_t        jobz,
+                                    hipsolverEigRange_t       range,
+                                    int64_t                   n,
+                                    int64_t                   il,
+                                    int64_t                   iu,
+                                    int64_t                   batch_count,
+                                    hipsolverSyevAlgorithm_t* alg);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDnXsyevAuto_bufferSize(hipsolverDnHandle_t handle,
+                                    hipsolverDnParams_t params,
+                                    hipsolverEigMode_t  jobz,
+                                    hipsolverEigRange_t range,
+                                    hipsolverFillMode_t uplo,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    const void*         A,
+                                    int64_t             lda,
+                                    int64_t             strideA,
+                                    int64_t             il,
+                                    int64_t             iu,
+                                    hipDataType         dataTypeW,
+                                    const void*         W,
+                                    int64_t             strideW,
+                                    hipDataType         computeType,
+                                    size_t*             lworkOnDevice,
+                                    size_t*             lworkOnHost,
+                                    int64_t             batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsyevAuto(hipsolverDnHandle_t handle,
+                                                        hipsolverDnParams_t params,
+                                                        hipsolverEigMode_t  jobz,
+                                                        hipsolverEigRange_t range,
+                                                        hipsolverFillMode_t uplo,
+                                                        int64_t             n,
+                                                        hipDataType         dataTypeA,
+                                                        void*               A,
+                                                        int64_t             lda,
+                                                        int64_t             strideA,
+                                                        int64_t             il,
+                                                        int64_t             iu,
+                                                        hipDataType         dataTypeW,
+                                                        void*               W,
+                                                        int64_t             strideW,
+                                                        hipDataType         computeType,
+                                                        void*               workOnDevice,
+                                                        size_t              lworkOnDevice,
+                                                        void*               workOnHost,
+                                                        size_t              lworkOnHost,
+                                                        int*                info,
+                                                        int64_t             batch_count);
+
+// gesvd
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgesvd_bufferSize(hipsolverDnHandle_t handle,
+                                                                hipsolverDnParams_t params,
+                                                                signed char         jobu,
+                                                                signed char         jobv,
+                                                                int64_t             m,
+                                                                int64_t             n,
+                                                                hipDataType         dataTypeA,
+                                                                const void*         A,
+                                                                int64_t             lda,
+                                                                hipDataType         dataTypeS,
+                                                                const void*         S,
+                                                                hipDataType         dataTypeU,
+                                                                const void*         U,
+                                                                int64_t             ldu,
+                                                                hipDataType         dataTypeV,
+                                                                const void*         V,
+                                                                int64_t             ldv,
+                                                                hipDataType         computeType,
+                                                                size_t*             lworkOnDevice,
+                                                                size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgesvd(hipsolverDnHandle_t handle,
+                                                     hipsolverDnParams_t params,
+                                                     signed char         jobu,
+                                                     signed char         jobv,
+                                                     int64_t             m,
+                                                     int64_t             n,
+                                                     hipDataType         dataTypeA,
+                                                     void*               A,
+                                                     int64_t             lda,
+                                                     hipDataType         dataTypeS,
+                                                     void*               S,
+                                                     hipDataType         dataTypeU,
+                                                     void*               U,
+                                                     int64_t             ldu,
+                                                     hipDataType         dataTypeV,
+                                                     void*               V,
+                                                     int64_t             ldv,
+                                                     hipDataType         computeType,
+                                                     void*               workOnDevice,
+                                                     size_t              lworkOnDevice,
+                                                     void*               workOnHost,
+                                                     size_t              lworkOnHost,
+                                                     int*                info);
+
+// gesvdp
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgesvdp_bufferSize(hipsolverDnHandle_t handle,
+                                                                 hipsolverDnParams_t params,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 int                 econ,
+                                                                 int64_t             m,
+                                                                 int64_t             n,
+                                                                 hipDataType         dataTypeA,
+                                                                 const void*         A,
+                                                                 int64_t             lda,
+                                                                 hipDataType         dataTypeS,
+                                                                 const void*         S,
+                                                                 hipDataType         dataTypeU,
+                                                                 const void*         U,
+                                                                 int64_t             ldu,
+                                                                 hipDataType         dataTypeV,
+                                                                 const void*         V,
+                                                                 int64_t             ldv,
+                                                                 hipDataType         computeType,
+                                                                 size_t*             lworkOnDevice,
+                                                                 size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgesvdp(hipsolverDnHandle_t handle,
+                                                      hipsolverDnParams_t params,
+                                                      hipsolverEigMode_t  jobz,
+                                                      int                 econ,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      hipDataType         dataTypeA,
+                                                      void*               A,
+                                                      int64_t             lda,
+                                                      hipDataType         dataTypeS,
+                                                      void*               S,
+                                                      hipDataType         dataTypeU,
+                                                      void*               U,
+                                                      int64_t             ldu,
+                                                      hipDataType         dataTypeV,
+                                                      void*               V,
+                                                      int64_t             ldv,
+                                                      hipDataType         computeType,
+                                                      void*               workOnDevice,
+                                                      size_t              lworkOnDevice,
+                                                      void*               workOnHost,
+                                                      size_t              lworkOnHost,
+                                                      int*                info,
+                                                      double*             hErrSigma);
+
+// gesvdr
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgesvdr_bufferSize(hipsolverDnHandle_t handle,
+                                                                 hipsolverDnParams_t params,
+                                                                 signed char         jobu,
+                                                                 signed char         jobv,
+                                                                 int64_t             m,
+                                                                 int64_t             n,
+                                                                 int64_t             k,
+                                                                 int64_t             p,
+                                                                 int64_t             niters,
+                                                                 hipDataType         dataTypeA,
+                                                                 const void*         A,
+                                                                 int64_t             lda,
+                                                                 hipDataType         dataTypeSrand,
+                                                                 const void*         Srand,
+                                                                 hipDataType         dataTypeUrand,
+                                                                 const void*         Urand,
+                                                                 int64_t             ldUrand,
+                                                                 hipDataType         dataTypeVrand,
+                                                                 const void*         Vrand,
+                                                                 int64_t             ldVrand,
+                                                                 hipDataType         computeType,
+                                                                 size_t*             lworkOnDevice,
+                                                                 size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgesvdr(hipsolverDnHandle_t handle,
+                                                      hipsolverDnParams_t params,
+                                                      signed char         jobu,
+                                                      signed char         jobv,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      int64_t             k,
+                                                      int64_t             p,
+                                                      int64_t             niters,
+                                                      hipDataType         dataTypeA,
+                                                      void*               A,
+                                                      int64_t             lda,
+                                                      hipDataType         dataTypeSrand,
+                                                      void*               Srand,
+                                                      hipDataType         dataTypeUrand,
+                                                      void*               Urand,
+                                                      int64_t             ldUrand,
+                                                      hipDataType         dataTypeVrand,
+                                                      void*               Vrand,
+                                                      int64_t             ldVrand,
+                                                      hipDataType         computeType,
+                                                      void*               workOnDevice,
+                                                      size_t              lworkOnDevice,
+                                                      void*               workOnHost,
+                                                      size_t              lworkOnHost,
+                                                      int*                info);
+
+// gesvdr_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDnXgesvdrStridedBatched_bufferSize(hipsolverDnHandle_t handle,
+                                                hipsolverDnParams_t params,
+                                                signed char         jobu,
+                                                signed char         jobv,
+                                                int64_t             m,
+                                                int64_t             n,
+                                                int64_t             k,
+                                                int64_t             p,
+                                                int64_t             niters,
+                                                hipDataType         dataTypeA,
+                                                const void*         A,
+                                                int64_t             lda,
+                                                int64_t             strideA,
+                                                hipDataType         dataTypeSrand,
+                                                const void*         Srand,
+                                                int64_t             strideS,
+                                                hipDataType         dataTypeUrand,
+                                                const void*         Urand,
+                                                int64_t             ldUrand,
+                                                int64_t             strideU,
+                                                hipDataType         dataTypeVrand,
+                                                const void*         Vrand,
+                                                int64_t             ldVrand,
+                                                int64_t             strideV,
+                                                hipDataType         computeType,
+                                                size_t*             lworkOnDevice,
+                                                size_t*             lworkOnHost,
+                                                int64_t             batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDnXgesvdrStridedBatched(hipsolverDnHandle_t handle,
+                                     hipsolverDnParams_t params,
+                                     signed char         jobu,
+                                     signed char         jobv,
+                                     int64_t             m,
+                                     int64_t             n,
+                                     int64_t             k,
+                                     int64_t             p,
+                                     int64_t             niters,
+                                     hipDataType         dataTypeA,
+                                     void*               A,
+                                     int64_t             lda,
+                                     int64_t             strideA,
+                                     hipDataType         dataTypeSrand,
+                                     void*               Srand,
+                                     int64_t             strideS,
+                                     hipDataType         dataTypeUrand,
+                                     void*               Urand,
+                                     int64_t             ldUrand,
+                                     int64_t             strideU,
+                                     hipDataType         dataTypeVrand,
+                                     void*               Vrand,
+                                     int64_t             ldVrand,
+                                     int64_t             strideV,
+                                     hipDataType         computeType,
+                                     void*               workOnDevice,
+                                     size_t              lworkOnDevice,
+                                     void*               workOnHost,
+                                     size_t              lworkOnHost,
+                                     int*                info,
+                                     double*             hRnrmF,
+                                     int64_t             batch_count);
+
+// sytrs
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsytrs_bufferSize(hipsolverDnHandle_t handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int64_t             n,
+                                                                int64_t             nrhs,
+                                                                hipDataType         dataTypeA,
+                                                                const void*         A,
+                                                                int64_t             lda,
+                                                                const int64_t*      devIpiv,
+                                                                hipDataType         dataTypeB,
+                                                                void*               B,
+                                                                int64_t             ldb,
+                                                                size_t*             lworkOnDevice,
+                                                                size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsytrs(hipsolverDnHandle_t handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int64_t             n,
+                                                     int64_t             nrhs,
+                                                     hipDataType         dataTypeA,
+                                                     const void*         A,
+                                                     int64_t             lda,
+                                                     const int64_t*      devIpiv,
+                                                     hipDataType         dataTypeB,
+                                                     void*               B,
+                                                     int64_t             ldb,
+                                                     void*               workOnDevice,
+                                                     size_t              lworkOnDevice,
+                                                     void*               workOnHost,
+                                                     size_t              lworkOnHost,
+                                                     int*                info);
+
+// trtri
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXtrtri_bufferSize(hipsolverDnHandle_t handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                hipsolverDiagType_t diag,
+                                                                int64_t             n,
+                                                                hipDataType         dataTypeA,
+                                                                void*               A,
+                                                                int64_t             lda,
+                                                                size_t*             lworkOnDevice,
+                                                                size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXtrtri(hipsolverDnHandle_t handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     hipsolverDiagType_t diag,
+                                                     int64_t             n,
+                                                     hipDataType         dataTypeA,
+                                                     void*               A,
+                                                     int64_t             lda,
+                                                     void*               workOnDevice,
+                                                     size_t              lworkOnDevice,
+                                                     void*               workOnHost,
+                                                     size_t              lworkOnHost,
+                                                     int*                info);
+
 #ifdef __cplusplus
 }
 #endif
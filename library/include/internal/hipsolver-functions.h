@@ -33,6 +33,92 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetDeterministicMode(hipsolverHandle
 HIPSOLVER_EXPORT hipsolverStatus_t
     hipsolverGetDeterministicMode(hipsolverHandle_t handle, hipsolverDeterministicMode_t* mode);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetBufferSizeCacheStats(hipsolverHandle_t handle,
+                                                                    size_t*           hits,
+                                                                    size_t*           misses);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverClearBufferSizeCache(hipsolverHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetMemoryBudget(hipsolverHandle_t handle, size_t bytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetMemoryUsage(hipsolverHandle_t       handle,
+                                                           hipsolverMemoryUsage_t* usage);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetHybridMode(hipsolverHandle_t     handle,
+                                                          hipsolverHybridMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetHybridMode(hipsolverHandle_t      handle,
+                                                          hipsolverHybridMode_t* mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetHybridThreshold(hipsolverHandle_t         handle,
+                                                               hipsolverHybridFunction_t function,
+                                                               int                       n);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetHybridThreshold(hipsolverHandle_t         handle,
+                                                               hipsolverHybridFunction_t function,
+                                                               int*                      n);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCalibrateHybridThresholds(hipsolverHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetHybridStats(hipsolverHandle_t handle,
+                                                           size_t*           hostCalls,
+                                                           size_t*           deviceCalls);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSetStrideDetectionMode(hipsolverHandle_t handle, hipsolverStrideDetectionMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverGetStrideDetectionMode(hipsolverHandle_t handle, hipsolverStrideDetectionMode_t* mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetStrideDetectionStats(hipsolverHandle_t handle,
+                                                                    size_t*           stridedCalls,
+                                                                    size_t*           batchedCalls);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetCaptureMode(hipsolverHandle_t      handle,
+                                                           hipsolverCaptureMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetCaptureMode(hipsolverHandle_t       handle,
+                                                           hipsolverCaptureMode_t* mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverReserveWorkspace(hipsolverHandle_t handle,
+                                                             size_t            bytes);
+
+// workspace pool
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCreateWorkspacePool(hipsolverWorkspacePool_t* pool);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDestroyWorkspacePool(hipsolverWorkspacePool_t pool);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverWorkspacePoolSetWatermarks(hipsolverWorkspacePool_t pool,
+                                        size_t                   low_watermark,
+                                        size_t                   high_watermark);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverWorkspacePoolTrim(hipsolverWorkspacePool_t pool);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverWorkspacePoolGetStats(hipsolverWorkspacePool_t       pool,
+                                   hipsolverWorkspacePoolStats_t* stats);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetWorkspacePool(hipsolverHandle_t        handle,
+                                                             hipsolverWorkspacePool_t pool);
+
+// handle pool
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCreateHandlePool(hipsolverHandlePool_t* pool,
+                                                             int                    device,
+                                                             int                    capacity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDestroyHandlePool(hipsolverHandlePool_t pool);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolReserve(hipsolverHandlePool_t pool,
+                                                              int                   count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolAcquire(hipsolverHandlePool_t pool,
+                                                              hipStream_t           stream,
+                                                              hipsolverHandle_t*    handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolRelease(hipsolverHandlePool_t pool,
+                                                              hipsolverHandle_t     handle);
+
 // gesvdj params
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCreateGesvdjInfo(hipsolverGesvdjInfo_t* info);
 
@@ -55,6 +141,20 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXgesvdjGetSweeps(hipsolverHandle_t
                                                              hipsolverGesvdjInfo_t info,
                                                              int*                  executed_sweeps);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXgesvdjGetResidualAsync(hipsolverHandle_t     handle,
+                                                                    hipsolverGesvdjInfo_t info,
+                                                                    double*               residual);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverXgesvdjGetSweepsAsync(hipsolverHandle_t     handle,
+                                   hipsolverGesvdjInfo_t info,
+                                   int*                  executed_sweeps);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXgesvdjGetMaxAsync(hipsolverHandle_t     handle,
+                                                               hipsolverGesvdjInfo_t info,
+                                                               double*               max_residual,
+                                                               int*                  max_sweeps);
+
 // syevj params
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCreateSyevjInfo(hipsolverSyevjInfo_t* info);
 
@@ -77,6 +177,20 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjGetSweeps(hipsolverHandle_t
                                                             hipsolverSyevjInfo_t info,
                                                             int*                 executed_sweeps);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjGetResidualAsync(hipsolverHandle_t    handle,
+                                                                   hipsolverSyevjInfo_t info,
+                                                                   double*              residual);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverXsyevjGetSweepsAsync(hipsolverHandle_t    handle,
+                                  hipsolverSyevjInfo_t info,
+                                  int*                 executed_sweeps);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjGetMaxAsync(hipsolverHandle_t    handle,
+                                                              hipsolverSyevjInfo_t info,
+                                                              double*              max_residual,
+                                                              int*                 max_sweeps);
+
 // orgbr/ungbr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgbr_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverSideMode_t side,
@@ -716,6 +830,87 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgels(hipsolverHandle_t handle,
                                                    int*              niters,
                                                    int*              devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDSgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDHgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZCgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipDoubleComplex* A,
+                                                              int               lda,
+                                                              hipDoubleComplex* B,
+                                                              int               ldb,
+                                                              hipDoubleComplex* X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDSgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDHgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZCgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* A,
+                                                   int               lda,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   hipDoubleComplex* X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
 // geqrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrf_bufferSize(
     hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
@@ -769,6 +964,99 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrf(hipsolverHandle_t handle,
                                                    int               lwork,
                                                    int*              devInfo);
 
+// geqrf_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgeqrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A,
+                                             int               lda,
+                                             long long int     strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgeqrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A,
+                                             int               lda,
+                                             long long int     strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgeqrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             long long int     strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgeqrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             long long int     strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 float*            A,
+                                                                 int               lda,
+                                                                 long long int     strideA,
+                                                                 float*            tau,
+                                                                 long long int     strideT,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 double*           A,
+                                                                 int               lda,
+                                                                 long long int     strideA,
+                                                                 double*           tau,
+                                                                 long long int     strideT,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipFloatComplex*  A,
+                                                                 int               lda,
+                                                                 long long int     strideA,
+                                                                 hipFloatComplex*  tau,
+                                                                 long long int     strideT,
+                                                                 hipFloatComplex*  work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipDoubleComplex* A,
+                                                                 int               lda,
+                                                                 long long int     strideA,
+                                                                 hipDoubleComplex* tau,
+                                                                 long long int     strideT,
+                                                                 hipDoubleComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
 // gesv
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgesv_bufferSize(hipsolverHandle_t handle,
                                                               int               n,
@@ -878,6 +1166,114 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgesv(hipsolverHandle_t handle,
                                                    int*              niters,
                                                    int*              devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDSgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDHgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZCgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipDoubleComplex* A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              hipDoubleComplex* B,
+                                                              int               ldb,
+                                                              hipDoubleComplex* X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZKgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipDoubleComplex* A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              hipDoubleComplex* B,
+                                                              int               ldb,
+                                                              hipDoubleComplex* X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDSgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDHgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZCgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   hipDoubleComplex* X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZKgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   hipDoubleComplex* X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
 // gesvd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvd_bufferSize(
     hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork);
@@ -959,6 +1355,127 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvd(hipsolverHandle_t handle,
                                                    double*           rwork,
                                                    int*              devInfo);
 
+// gesvd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             signed char       jobu,
+                                             signed char       jobv,
+                                             int               m,
+                                             int               n,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             signed char       jobu,
+                                             signed char       jobv,
+                                             int               m,
+                                             int               n,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             signed char       jobu,
+                                             signed char       jobv,
+                                             int               m,
+                                             int               n,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             signed char       jobu,
+                                             signed char       jobv,
+                                             int               m,
+                                             int               n,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 float*            A,
+                                                                 int               lda,
+                                                                 long long int     strideA,
+                                                                 float*            S,
+                                                                 long long int     strideS,
+                                                                 float*            U,
+                                                                 int               ldu,
+                                                                 long long int     strideU,
+                                                                 float*            V,
+                                                                 int               ldv,
+                                                                 long long int     strideV,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 double*           A,
+                                                                 int               lda,
+                                                                 long long int     strideA,
+                                                                 double*           S,
+                                                                 long long int     strideS,
+                                                                 double*           U,
+                                                                 int               ldu,
+                                                                 long long int     strideU,
+                                                                 double*           V,
+                                                                 int               ldv,
+                                                                 long long int     strideV,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipFloatComplex*  A,
+                                                                 int               lda,
+                                                                 long long int     strideA,
+                                                                 float*            S,
+                                                                 long long int     strideS,
+                                                                 hipFloatComplex*  U,
+                                                                 int               ldu,
+                                                                 long long int     strideU,
+                                                                 hipFloatComplex*  V,
+                                                                 int               ldv,
+                                                                 long long int     strideV,
+                                                                 hipFloatComplex*  work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipDoubleComplex* A,
+                                                                 int               lda,
+                                                                 long long int     strideA,
+                                                                 double*           S,
+                                                                 long long int     strideS,
+                                                                 hipDoubleComplex* U,
+                                                                 int               ldu,
+                                                                 long long int     strideU,
+                                                                 hipDoubleComplex* V,
+                                                                 int               ldv,
+                                                                 long long int     strideV,
+                                                                 hipDoubleComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
 // gesvdj
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdj_bufferSize(hipsolverHandle_t     handle,
                                                                hipsolverEigMode_t    jobz,
@@ -1270,6 +1787,99 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrf(hipsolverHandle_t handle,
                                                    int*              devIpiv,
                                                    int*              devInfo);
 
+// getrf_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A,
+                                             int               lda,
+                                             long long int     strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A,
+                                             int               lda,
+                                             long long int     strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             long long int     strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             long long int     strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 float*            A,
+                                                                 int               lda,
+                                                                 long long int     strideA,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 long long int     strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 double*           A,
+                                                                 int               lda,
+                                                                 long long int     strideA,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 long long int     strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipFloatComplex*  A,
+                                                                 int               lda,
+                                                                 long long int     strideA,
+                                                                 hipFloatComplex*  work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 long long int     strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipDoubleComplex* A,
+                                                                 int               lda,
+                                                                 long long int     strideA,
+                                                                 hipDoubleComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 long long int     strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
 // getrs
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
                                                               hipsolverOperation_t trans,
@@ -1367,6 +1977,139 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
                                                    int                  lwork,
                                                    int*                 devInfo);
 
+// getrs_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A,
+                                             int                  lda,
+                                             long long int        strideA,
+                                             int*                 devIpiv,
+                                             long long int        strideP,
+                                             float*               B,
+                                             int                  ldb,
+                                             long long int        strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A,
+                                             int                  lda,
+                                             long long int        strideA,
+                                             int*                 devIpiv,
+                                             long long int        strideP,
+                                             double*              B,
+                                             int                  ldb,
+                                             long long int        strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             long long int        strideA,
+                                             int*                 devIpiv,
+                                             long long int        strideP,
+                                             hipFloatComplex*     B,
+                                             int                  ldb,
+                                             long long int        strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             long long int        strideA,
+                                             int*                 devIpiv,
+                                             long long int        strideP,
+                                             hipDoubleComplex*    B,
+                                             int                  ldb,
+                                             long long int        strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 float*               A,
+                                                                 int                  lda,
+                                                                 long long int        strideA,
+                                                                 int*                 devIpiv,
+                                                                 long long int        strideP,
+                                                                 float*               B,
+                                                                 int                  ldb,
+                                                                 long long int        strideB,
+                                                                 float*               work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 double*              A,
+                                                                 int                  lda,
+                                                                 long long int        strideA,
+                                                                 int*                 devIpiv,
+                                                                 long long int        strideP,
+                                                                 double*              B,
+                                                                 int                  ldb,
+                                                                 long long int        strideB,
+                                                                 double*              work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 hipFloatComplex*     A,
+                                                                 int                  lda,
+                                                                 long long int        strideA,
+                                                                 int*                 devIpiv,
+                                                                 long long int        strideP,
+                                                                 hipFloatComplex*     B,
+                                                                 int                  ldb,
+                                                                 long long int        strideB,
+                                                                 hipFloatComplex*     work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 hipDoubleComplex*    A,
+                                                                 int                  lda,
+                                                                 long long int        strideA,
+                                                                 int*                 devIpiv,
+                                                                 long long int        strideP,
+                                                                 hipDoubleComplex*    B,
+                                                                 int                  ldb,
+                                                                 long long int        strideB,
+                                                                 hipDoubleComplex*    work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
 // potrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf_bufferSize(
     hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
@@ -1821,6 +2564,115 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevd(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+// syevd_strided_batched/heevd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             long long int       strideA,
+                                             float*              W,
+                                             long long int       strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             long long int       strideA,
+                                             double*             W,
+                                             long long int       strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             long long int       strideA,
+                                             float*              W,
+                                             long long int       strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             long long int       strideA,
+                                             double*             W,
+                                             long long int       strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 long long int       strideA,
+                                                                 float*              W,
+                                                                 long long int       strideW,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 long long int       strideA,
+                                                                 double*             W,
+                                                                 long long int       strideW,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 long long int       strideA,
+                                                                 float*              W,
+                                                                 long long int       strideW,
+                                                                 hipFloatComplex*    work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 long long int       strideA,
+                                                                 double*             W,
+                                                                 long long int       strideW,
+                                                                 hipDoubleComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
 // syevdx/heevdx
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdx_bufferSize(hipsolverHandle_t   handle,
                                                                hipsolverEigMode_t  jobz,
@@ -2241,6 +3093,147 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+// sygvd_strided_batched/hegvd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsygvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             long long int       strideA,
+                                             float*              B,
+                                             int                 ldb,
+                                             long long int       strideB,
+                                             float*              W,
+                                             long long int       strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsygvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             long long int       strideA,
+                                             double*             B,
+                                             int                 ldb,
+                                             long long int       strideB,
+                                             double*             W,
+                                             long long int       strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChegvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             long long int       strideA,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             long long int       strideB,
+                                             float*              W,
+                                             long long int       strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             long long int       strideA,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             long long int       strideB,
+                                             double*             W,
+                                             long long int       strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 long long int       strideA,
+                                                                 float*              B,
+                                                                 int                 ldb,
+                                                                 long long int       strideB,
+                                                                 float*              W,
+                                                                 long long int       strideW,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 long long int       strideA,
+                                                                 double*             B,
+                                                                 int                 ldb,
+                                                                 long long int       strideB,
+                                                                 double*             W,
+                                                                 long long int       strideW,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 long long int       strideA,
+                                                                 hipFloatComplex*    B,
+                                                                 int                 ldb,
+                                                                 long long int       strideB,
+                                                                 float*              W,
+                                                                 long long int       strideW,
+                                                                 hipFloatComplex*    work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 long long int       strideA,
+                                                                 hipDoubleComplex*   B,
+                                                                 int                 ldb,
+                                                                 long long int       strideB,
+                                                                 double*             W,
+                                                                 long long int       strideW,
+                                                                 hipDoubleComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
 // sygvdx/hegvdx
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvdx_bufferSize(hipsolverHandle_t   handle,
                                                                hipsolverEigType_t  itype,
@@ -2649,6 +3642,341 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrf(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+// sytrs
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              float*              A,
+                                                              int                 lda,
+                                                              int*                ipiv,
+                                                              float*              B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              double*             A,
+                                                              int                 lda,
+                                                              int*                ipiv,
+                                                              double*             B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              hipFloatComplex*    A,
+                                                              int                 lda,
+                                                              int*                ipiv,
+                                                              hipFloatComplex*    B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              hipDoubleComplex*   A,
+                                                              int                 lda,
+                                                              int*                ipiv,
+                                                              hipDoubleComplex*   B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipFloatComplex*    A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   hipFloatComplex*    B,
+                                                   int                 ldb,
+                                                   hipFloatComplex*    work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipDoubleComplex*   A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   hipDoubleComplex*   B,
+                                                   int                 ldb,
+                                                   hipDoubleComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+// sytrs_batched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 nrhs,
+                                                                     float*              A[],
+                                                                     int                 lda,
+                                                                     int*                ipiv,
+                                                                     float*              B[],
+                                                                     int                 ldb,
+                                                                     int*                lwork,
+                                                                     int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 nrhs,
+                                                                     double*             A[],
+                                                                     int                 lda,
+                                                                     int*                ipiv,
+                                                                     double*             B[],
+                                                                     int                 ldb,
+                                                                     int*                lwork,
+                                                                     int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 nrhs,
+                                                                     hipFloatComplex*    A[],
+                                                                     int                 lda,
+                                                                     int*                ipiv,
+                                                                     hipFloatComplex*    B[],
+                                                                     int                 ldb,
+                                                                     int*                lwork,
+                                                                     int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 nrhs,
+                                                                     hipDoubleComplex*   A[],
+                                                                     int                 lda,
+                                                                     int*                ipiv,
+                                                                     hipDoubleComplex*   B[],
+                                                                     int                 ldb,
+                                                                     int*                lwork,
+                                                                     int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrsBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          int*                ipiv,
+                                                          float*              B[],
+                                                          int                 ldb,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrsBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          int*                ipiv,
+                                                          double*             B[],
+                                                          int                 ldb,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrsBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          hipFloatComplex*    A[],
+                                                          int                 lda,
+                                                          int*                ipiv,
+                                                          hipFloatComplex*    B[],
+                                                          int                 ldb,
+                                                          hipFloatComplex*    work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrsBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          hipDoubleComplex*   A[],
+                                                          int                 lda,
+                                                          int*                ipiv,
+                                                          hipDoubleComplex*   B[],
+                                                          int                 ldb,
+                                                          hipDoubleComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+// sytrs_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsytrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             float*              A,
+                                             int                 lda,
+                                             long long int       strideA,
+                                             int*                ipiv,
+                                             long long int       strideP,
+                                             float*              B,
+                                             int                 ldb,
+                                             long long int       strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsytrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             double*             A,
+                                             int                 lda,
+                                             long long int       strideA,
+                                             int*                ipiv,
+                                             long long int       strideP,
+                                             double*             B,
+                                             int                 ldb,
+                                             long long int       strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCsytrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             long long int       strideA,
+                                             int*                ipiv,
+                                             long long int       strideP,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             long long int       strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZsytrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             long long int       strideA,
+                                             int*                ipiv,
+                                             long long int       strideP,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             long long int       strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 long long int       strideA,
+                                                                 int*                ipiv,
+                                                                 long long int       strideP,
+                                                                 float*              B,
+                                                                 int                 ldb,
+                                                                 long long int       strideB,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 long long int       strideA,
+                                                                 int*                ipiv,
+                                                                 long long int       strideP,
+                                                                 double*             B,
+                                                                 int                 ldb,
+                                                                 long long int       strideB,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 long long int       strideA,
+                                                                 int*                ipiv,
+                                                                 long long int       strideP,
+                                                                 hipFloatComplex*    B,
+                                                                 int                 ldb,
+                                                                 long long int       strideB,
+                                                                 hipFloatComplex*    work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 long long int       strideA,
+                                                                 int*                ipiv,
+                                                                 long long int       strideP,
+                                                                 hipDoubleComplex*   B,
+                                                                 int                 ldb,
+                                                                 long long int       strideB,
+                                                                 hipDoubleComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
 #ifdef __cplusplus
 }
 #endif
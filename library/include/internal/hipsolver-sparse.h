@@ -11,6 +11,13 @@ typedef void* hipsolverSpHandle_t;
 
 typedef void* hipsparseMatDescr_t;
 
+typedef enum
+{
+    HIPSOLVER_SP_PRECOND_NONE = 0, // no preconditioner
+    HIPSOLVER_SP_PRECOND_IC0  = 1, // incomplete Cholesky with zero fill-in
+    HIPSOLVER_SP_PRECOND_ILU0 = 2, // incomplete LU with zero fill-in
+} hipsolverSpPrecond_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -75,6 +82,115 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrlsvcholHost(hipsolverSpHandle_
                                                               double*                   x,
                                                               int* singularity);
 
+// linear solver based on Cholesky (64-bit indices)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrlsvchol64(hipsolverSpHandle_t       handle,
+                                                            int64_t                   n,
+                                                            int64_t                   nnzA,
+                                                            const hipsparseMatDescr_t descrA,
+                                                            const float*              csrVal,
+                                                            const int64_t*            csrRowPtr,
+                                                            const int64_t*            csrColInd,
+                                                            const float*              b,
+                                                            float                     tolerance,
+                                                            int                       reorder,
+                                                            float*                    x,
+                                                            int64_t*                  singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrlsvchol64(hipsolverSpHandle_t       handle,
+                                                            int64_t                   n,
+                                                            int64_t                   nnzA,
+                                                            const hipsparseMatDescr_t descrA,
+                                                            const double*             csrVal,
+                                                            const int64_t*            csrRowPtr,
+                                                            const int64_t*            csrColInd,
+                                                            const double*             b,
+                                                            double                    tolerance,
+                                                            int                       reorder,
+                                                            double*                   x,
+                                                            int64_t*                  singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrlsvcholHost64(hipsolverSpHandle_t       handle,
+                                                                int64_t                   n,
+                                                                int64_t                   nnzA,
+                                                                const hipsparseMatDescr_t descrA,
+                                                                const float*              csrVal,
+                                                                const int64_t*            csrRowPtr,
+                                                                const int64_t*            csrColInd,
+                                                                const float*              b,
+                                                                float                     tolerance,
+                                                                int                       reorder,
+                                                                float*                    x,
+                                                                int64_t* singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrlsvcholHost64(hipsolverSpHandle_t       handle,
+                                                                int64_t                   n,
+                                                                int64_t                   nnzA,
+                                                                const hipsparseMatDescr_t descrA,
+                                                                const double*             csrVal,
+                                                                const int64_t*            csrRowPtr,
+                                                                const int64_t*            csrColInd,
+                                                                const double*             b,
+                                                                double                    tolerance,
+                                                                int                       reorder,
+                                                                double*                   x,
+                                                                int64_t* singularity);
+// linear solver based on LDL'
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrlsvldl(hipsolverSpHandle_t       handle,
+                                                         int                       n,
+                                                         int                       nnzA,
+                                                         const hipsparseMatDescr_t descrA,
+                                                         const float*              csrVal,
+                                                         const int*                csrRowPtr,
+                                                         const int*                csrColInd,
+                                                         const float*              b,
+                                                         float                     tolerance,
+                                                         int                       reorder,
+                                                         float                     perturb,
+                                                         float*                    x,
+                                                         int*                      singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrlsvldl(hipsolverSpHandle_t       handle,
+                                                         int                       n,
+                                                         int                       nnzA,
+                                                         const hipsparseMatDescr_t descrA,
+                                                         const double*             csrVal,
+                                                         const int*                csrRowPtr,
+                                                         const int*                csrColInd,
+                                                         const double*             b,
+                                                         double                    tolerance,
+                                                         int                       reorder,
+                                                         double                    perturb,
+                                                         double*                   x,
+                                                         int*                      singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrlsvldlHost(hipsolverSpHandle_t       handle,
+                                                             int                       n,
+                                                             int                       nnzA,
+                                                             const hipsparseMatDescr_t descrA,
+                                                             const float*              csrVal,
+                                                             const int*                csrRowPtr,
+                                                             const int*                csrColInd,
+                                                             const float*              b,
+                                                             float                     tolerance,
+                                                             int                       reorder,
+                                                             float                     perturb,
+                                                             float*                    x,
+                                                             int*                      singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrlsvldlHost(hipsolverSpHandle_t       handle,
+                                                             int                       n,
+                                                             int                       nnzA,
+                                                             const hipsparseMatDescr_t descrA,
+                                                             const double*             csrVal,
+                                                             const int*                csrRowPtr,
+                                                             const int*                csrColInd,
+                                                             const double*             b,
+                                                             double                    tolerance,
+                                                             int                       reorder,
+                                                             double                    perturb,
+                                                             double*                   x,
+                                                             int*                      singularity);
+
 // linear solver based on QR
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrlsvqr(hipsolverSpHandle_t       handle,
                                                         int                       n,
@@ -102,6 +218,140 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrlsvqr(hipsolverSpHandle_t
                                                         double*                   x,
                                                         int*                      singularity);
 
+// iterative linear solver based on preconditioned conjugate gradient
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrpcg(hipsolverSpHandle_t       handle,
+                                                      int                       n,
+                                                      int                       nnzA,
+                                                      const hipsparseMatDescr_t descrA,
+                                                      const float*              csrVal,
+                                                      const int*                csrRowPtr,
+                                                      const int*                csrColInd,
+                                                      const float*              b,
+                                                      float                     tolerance,
+                                                      int                       maxiter,
+                                                      hipsolverSpPrecond_t      precond,
+                                                      int                       reusePrecond,
+                                                      float*                    x,
+                                                      int*                      niters,
+                                                      float*                    resHistory);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrpcg(hipsolverSpHandle_t       handle,
+                                                      int                       n,
+                                                      int                       nnzA,
+                                                      const hipsparseMatDescr_t descrA,
+                                                      const double*             csrVal,
+                                                      const int*                csrRowPtr,
+                                                      const int*                csrColInd,
+                                                      const double*             b,
+                                                      double                    tolerance,
+                                                      int                       maxiter,
+                                                      hipsolverSpPrecond_t      precond,
+                                                      int                       reusePrecond,
+                                                      double*                   x,
+                                                      int*                      niters,
+                                                      double*                   resHistory);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrpcgHost(hipsolverSpHandle_t       handle,
+                                                          int                       n,
+                                                          int                       nnzA,
+                                                          const hipsparseMatDescr_t descrA,
+                                                          const float*              csrVal,
+                                                          const int*                csrRowPtr,
+                                                          const int*                csrColInd,
+                                                          const float*              b,
+                                                          float                     tolerance,
+                                                          int                       maxiter,
+                                                          hipsolverSpPrecond_t      precond,
+                                                          int                       reusePrecond,
+                                                          float*                    x,
+                                                          int*                      niters,
+                                                          float*                    resHistory);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrpcgHost(hipsolverSpHandle_t       handle,
+                                                          int                       n,
+                                                          int                       nnzA,
+                                                          const hipsparseMatDescr_t descrA,
+                                                          const double*             csrVal,
+                                                          const int*                csrRowPtr,
+                                                          const int*                csrColInd,
+                                                          const double*             b,
+                                                          double                    tolerance,
+                                                          int                       maxiter,
+                                                          hipsolverSpPrecond_t      precond,
+                                                          int                       reusePrecond,
+                                                          double*                   x,
+                                                          int*                      niters,
+                                                          double*                   resHistory);
+
+// iterative linear solver based on restarted GMRES
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrgmres(hipsolverSpHandle_t       handle,
+                                                        int                       n,
+                                                        int                       nnzA,
+                                                        const hipsparseMatDescr_t descrA,
+                                                        const float*              csrVal,
+                                                        const int*                csrRowPtr,
+                                                        const int*                csrColInd,
+                                                        const float*              b,
+                                                        float                     tolerance,
+                                                        int                       maxiter,
+                                                        int                       restart,
+                                                        hipsolverSpPrecond_t      precond,
+                                                        int                       reusePrecond,
+                                                        float*                    x,
+                                                        int*                      niters,
+                                                        float*                    resHistory);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrgmres(hipsolverSpHandle_t       handle,
+                                                        int                       n,
+                                                        int                       nnzA,
+                                                        const hipsparseMatDescr_t descrA,
+                                                        const double*             csrVal,
+                                                        const int*                csrRowPtr,
+                                                        const int*                csrColInd,
+                                                        const double*             b,
+                                                        double                    tolerance,
+                                                        int                       maxiter,
+                                                        int                       restart,
+                                                        hipsolverSpPrecond_t      precond,
+                                                        int                       reusePrecond,
+                                                        double*                   x,
+                                                        int*                      niters,
+                                                        double*                   resHistory);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrgmresHost(hipsolverSpHandle_t       handle,
+                                                            int                       n,
+                                                            int                       nnzA,
+                                                            const hipsparseMatDescr_t descrA,
+                                                            const float*              csrVal,
+                                                            const int*                csrRowPtr,
+                                                            const int*                csrColInd,
+                                                            const float*              b,
+                                                            float                     tolerance,
+                                                            int                       maxiter,
+                                                            int                       restart,
+                                                            hipsolverSpPrecond_t      precond,
+                                                            int                       reusePrecond,
+                                                            float*                    x,
+                                                            int*                      niters,
+                                                            float*                    resHistory);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrgmresHost(hipsolverSpHandle_t       handle,
+                                                            int                       n,
+                                                            int                       nnzA,
+                                                            const hipsparseMatDescr_t descrA,
+                                                            const double*             csrVal,
+                                                            const int*                csrRowPtr,
+                                                            const int*                csrColInd,
+                                                            const double*             b,
+                                                            double                    tolerance,
+                                                            int                       maxiter,
+                                                            int                       restart,
+                                                            hipsolverSpPrecond_t      precond,
+                                                            int                       reusePrecond,
+                                                            double*                   x,
+                                                            int*                      niters,
+                                                            double*                   resHistory);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,29 @@ typedef void* hipsolverHandle_t;
 typedef void* hipsolverGesvdjInfo_t;
 typedef void* hipsolverSyevjInfo_t;
 
+typedef void* hipsolverWorkspacePool_t;
+typedef void* hipsolverHandlePool_t;
+
+/*! \brief Statistics of a workspace pool. */
+typedef struct
+{
+    size_t bytes_in_use; /**< Bytes held by the handles attached to the pool. */
+    size_t peak_bytes_in_use; /**< Largest value reached by bytes_in_use. */
+    size_t bytes_reserved; /**< Device memory reserved by the pool, including cached blocks. */
+    size_t reallocations; /**< Number of blocks allocated to serve workspace requests. */
+    size_t trims; /**< Number of times the pool was trimmed to its low watermark. */
+} hipsolverWorkspacePoolStats_t;
+
+/*! \brief Device memory used by a handle, measured against its memory budget. */
+typedef struct
+{
+    size_t budget; /**< Memory budget of the handle, or 0 if it has none. */
+    size_t bytes_in_use; /**< Workspace and internal buffers held by hipSOLVER for the handle. */
+    size_t peak_bytes_in_use; /**< Largest value reached by bytes_in_use. */
+    size_t rejected_calls; /**< Calls that failed because their memory exceeded the budget. */
+    size_t degraded_calls; /**< Calls that used a lower-memory algorithm to fit in the budget. */
+} hipsolverMemoryUsage_t;
+
 typedef enum
 {
     HIPSOLVER_STATUS_SUCCESS           = 0, // Function succeeds
@@ -38,6 +61,7 @@ typedef enum
     HIPSOLVER_STATUS_UNKNOWN           = 11, // back-end returned an unsupported status code
     HIPSOLVER_STATUS_ZERO_PIVOT        = 12,
     HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED = 13,
+    HIPSOLVER_STATUS_NOT_CAPTURABLE = 14, // call would allocate or synchronize in capture-safe mode
 } hipsolverStatus_t;
 
 #ifndef HIPBLAS_OPERATION_DECLARED
@@ -132,6 +156,32 @@ typedef enum
     HIPSOLVER_ALLOW_NON_DETERMINISTIC_RESULTS = 242,
 } hipsolverDeterministicMode_t;
 
+typedef enum
+{
+    HIPSOLVER_HYBRID_MODE_OFF  = 251,
+    HIPSOLVER_HYBRID_MODE_AUTO = 252,
+} hipsolverHybridMode_t;
+
+typedef enum
+{
+    HIPSOLVER_HYBRID_GETRF = 261,
+    HIPSOLVER_HYBRID_GETRS = 262,
+    HIPSOLVER_HYBRID_POTRF = 263,
+    HIPSOLVER_HYBRID_POTRS = 264,
+} hipsolverHybridFunction_t;
+
+typedef enum
+{
+    HIPSOLVER_STRIDE_DETECTION_OFF  = 271,
+    HIPSOLVER_STRIDE_DETECTION_AUTO = 272,
+} hipsolverStrideDetectionMode_t;
+
+typedef enum
+{
+    HIPSOLVER_CAPTURE_MODE_OFF  = 291,
+    HIPSOLVER_CAPTURE_MODE_SAFE = 292,
+} hipsolverCaptureMode_t;
+
 // Aliases for hipBLAS enums
 
 /*! \brief Alias of hipblasOperation_t. HIPSOLVER_OP_N, HIPSOLVER_OP_T, and HIPSOLVER_OP_C
@@ -149,6 +199,13 @@ typedef hipblasFillMode_t hipsolverFillMode_t;
 #define HIPSOLVER_FILL_MODE_UPPER HIPBLAS_FILL_MODE_UPPER
 #define HIPSOLVER_FILL_MODE_LOWER HIPBLAS_FILL_MODE_LOWER
 
+/*! \brief Alias of hipblasDiagType_t. HIPSOLVER_DIAG_NON_UNIT and HIPSOLVER_DIAG_UNIT
+ *  are provided as equivalents to HIPBLAS_DIAG_NON_UNIT and HIPBLAS_DIAG_UNIT.
+ ********************************************************************************/
+typedef hipblasDiagType_t hipsolverDiagType_t;
+#define HIPSOLVER_DIAG_NON_UNIT HIPBLAS_DIAG_NON_UNIT
+#define HIPSOLVER_DIAG_UNIT HIPBLAS_DIAG_UNIT
+
 /*! \brief Alias of hipblasSideMode_t. HIPSOLVER_SIDE_LEFT and HIPSOLVER_SIDE_RIGHT
  *  are provided as equivalents to HIPBLAS_SIDE_LEFT and HIPBLAS_SIDE_RIGHT.
  ********************************************************************************/
@@ -30,6 +30,7 @@ fp_cholmod_start            g_cholmod_start;
 fp_cholmod_finish           g_cholmod_finish;
 fp_cholmod_allocate_sparse  g_cholmod_allocate_sparse;
 fp_cholmod_free_sparse      g_cholmod_free_sparse;
+fp_cholmod_copy_sparse      g_cholmod_copy_sparse;
 fp_cholmod_allocate_dense   g_cholmod_allocate_dense;
 fp_cholmod_free_dense       g_cholmod_free_dense;
 fp_cholmod_free_factor      g_cholmod_free_factor;
@@ -39,6 +40,19 @@ fp_cholmod_analyze_ordering g_cholmod_analyze_ordering;
 fp_cholmod_factorize        g_cholmod_factorize;
 fp_cholmod_solve            g_cholmod_solve;
 
+fp_cholmod_l_start           g_cholmod_l_start;
+fp_cholmod_l_finish          g_cholmod_l_finish;
+fp_cholmod_l_allocate_sparse g_cholmod_l_allocate_sparse;
+fp_cholmod_l_free_sparse     g_cholmod_l_free_sparse;
+fp_cholmod_l_copy_sparse     g_cholmod_l_copy_sparse;
+fp_cholmod_l_allocate_dense  g_cholmod_l_allocate_dense;
+fp_cholmod_l_free_dense      g_cholmod_l_free_dense;
+fp_cholmod_l_free_factor     g_cholmod_l_free_factor;
+fp_cholmod_l_drop            g_cholmod_l_drop;
+fp_cholmod_l_analyze         g_cholmod_l_analyze;
+fp_cholmod_l_factorize       g_cholmod_l_factorize;
+fp_cholmod_l_solve           g_cholmod_l_solve;
+
 static bool load_cholmod()
 {
 #ifndef HIPSOLVER_STATIC_LIB
@@ -86,6 +100,8 @@ static bool load_cholmod()
         return false;
     if(!load_function(handle, "cholmod_free_sparse", g_cholmod_free_sparse))
         return false;
+    if(!load_function(handle, "cholmod_copy_sparse", g_cholmod_copy_sparse))
+        return false;
     if(!load_function(handle, "cholmod_allocate_dense", g_cholmod_allocate_dense))
         return false;
     if(!load_function(handle, "cholmod_free_dense", g_cholmod_free_dense))
@@ -104,6 +120,33 @@ static bool load_cholmod()
     if(!load_function(handle, "cholmod_solve", g_cholmod_solve))
         return false;
 
+    if(!load_function(handle, "cholmod_l_start", g_cholmod_l_start))
+        return false;
+    if(!load_function(handle, "cholmod_l_finish", g_cholmod_l_finish))
+        return false;
+
+    if(!load_function(handle, "cholmod_l_allocate_sparse", g_cholmod_l_allocate_sparse))
+        return false;
+    if(!load_function(handle, "cholmod_l_free_sparse", g_cholmod_l_free_sparse))
+        return false;
+    if(!load_function(handle, "cholmod_l_copy_sparse", g_cholmod_l_copy_sparse))
+        return false;
+    if(!load_function(handle, "cholmod_l_allocate_dense", g_cholmod_l_allocate_dense))
+        return false;
+    if(!load_function(handle, "cholmod_l_free_dense", g_cholmod_l_free_dense))
+        return false;
+    if(!load_function(handle, "cholmod_l_free_factor", g_cholmod_l_free_factor))
+        return false;
+
+    if(!load_function(handle, "cholmod_l_drop", g_cholmod_l_drop))
+        return false;
+    if(!load_function(handle, "cholmod_l_analyze", g_cholmod_l_analyze))
+        return false;
+    if(!load_function(handle, "cholmod_l_factorize", g_cholmod_l_factorize))
+        return false;
+    if(!load_function(handle, "cholmod_l_solve", g_cholmod_l_solve))
+        return false;
+
     return true;
 #else /* HIPSOLVER_STATIC_LIB */
     return false;
@@ -56,6 +56,10 @@
 #define CHOLMOD_P 7
 #define CHOLMOD_Pt 8
 
+#define CHOLMOD_SIMPLICIAL 0
+#define CHOLMOD_AUTO 1
+#define CHOLMOD_SUPERNODAL 2
+
 #define CHOLMOD_HOST_SUPERNODE_BUFFERS 8
 #define CHOLMOD_MAXMETHODS 9
 
@@ -287,6 +291,10 @@ typedef int (*fp_cholmod_free_sparse)(cholmod_sparse** A, cholmod_common* common
 extern fp_cholmod_free_sparse g_cholmod_free_sparse;
 #define cholmod_free_sparse ::hipsolver::g_cholmod_free_sparse
 
+typedef cholmod_sparse* (*fp_cholmod_copy_sparse)(cholmod_sparse* A, cholmod_common* common);
+extern fp_cholmod_copy_sparse g_cholmod_copy_sparse;
+#define cholmod_copy_sparse ::hipsolver::g_cholmod_copy_sparse
+
 typedef cholmod_dense* (*fp_cholmod_allocate_dense)(
     size_t nrow, size_t ncol, size_t d, int xtype, cholmod_common* common);
 extern fp_cholmod_allocate_dense g_cholmod_allocate_dense;
@@ -333,6 +341,66 @@ typedef cholmod_dense* (*fp_cholmod_solve)(int             sys,
 extern fp_cholmod_solve g_cholmod_solve;
 #define cholmod_solve ::hipsolver::g_cholmod_solve
 
+// function declarations (long integer interface)
+typedef int (*fp_cholmod_l_start)(cholmod_common* common);
+extern fp_cholmod_l_start g_cholmod_l_start;
+#define cholmod_l_start ::hipsolver::g_cholmod_l_start
+
+typedef int (*fp_cholmod_l_finish)(cholmod_common* common);
+extern fp_cholmod_l_finish g_cholmod_l_finish;
+#define cholmod_l_finish ::hipsolver::g_cholmod_l_finish
+
+typedef cholmod_sparse* (*fp_cholmod_l_allocate_sparse)(size_t          nrow,
+                                                        size_t          ncol,
+                                                        size_t          nzmax,
+                                                        int             sorted,
+                                                        int             packed,
+                                                        int             stype,
+                                                        int             xtype,
+                                                        cholmod_common* common);
+extern fp_cholmod_l_allocate_sparse g_cholmod_l_allocate_sparse;
+#define cholmod_l_allocate_sparse ::hipsolver::g_cholmod_l_allocate_sparse
+
+typedef int (*fp_cholmod_l_free_sparse)(cholmod_sparse** A, cholmod_common* common);
+extern fp_cholmod_l_free_sparse g_cholmod_l_free_sparse;
+#define cholmod_l_free_sparse ::hipsolver::g_cholmod_l_free_sparse
+
+typedef cholmod_sparse* (*fp_cholmod_l_copy_sparse)(cholmod_sparse* A, cholmod_common* common);
+extern fp_cholmod_l_copy_sparse g_cholmod_l_copy_sparse;
+#define cholmod_l_copy_sparse ::hipsolver::g_cholmod_l_copy_sparse
+
+typedef cholmod_dense* (*fp_cholmod_l_allocate_dense)(
+    size_t nrow, size_t ncol, size_t d, int xtype, cholmod_common* common);
+extern fp_cholmod_l_allocate_dense g_cholmod_l_allocate_dense;
+#define cholmod_l_allocate_dense ::hipsolver::g_cholmod_l_allocate_dense
+
+typedef int (*fp_cholmod_l_free_dense)(cholmod_dense** A, cholmod_common* common);
+extern fp_cholmod_l_free_dense g_cholmod_l_free_dense;
+#define cholmod_l_free_dense ::hipsolver::g_cholmod_l_free_dense
+
+typedef int (*fp_cholmod_l_free_factor)(cholmod_factor** L, cholmod_common* common);
+extern fp_cholmod_l_free_factor g_cholmod_l_free_factor;
+#define cholmod_l_free_factor ::hipsolver::g_cholmod_l_free_factor
+
+typedef int (*fp_cholmod_l_drop)(double tol, cholmod_sparse* A, cholmod_common* common);
+extern fp_cholmod_l_drop g_cholmod_l_drop;
+#define cholmod_l_drop ::hipsolver::g_cholmod_l_drop
+
+typedef cholmod_factor* (*fp_cholmod_l_analyze)(cholmod_sparse* A, cholmod_common* common);
+extern fp_cholmod_l_analyze g_cholmod_l_analyze;
+#define cholmod_l_analyze ::hipsolver::g_cholmod_l_analyze
+
+typedef int (*fp_cholmod_l_factorize)(cholmod_sparse* A, cholmod_factor* L, cholmod_common* common);
+extern fp_cholmod_l_factorize g_cholmod_l_factorize;
+#define cholmod_l_factorize ::hipsolver::g_cholmod_l_factorize
+
+typedef cholmod_dense* (*fp_cholmod_l_solve)(int             sys,
+                                             cholmod_factor* L,
+                                             cholmod_dense*  B,
+                                             cholmod_common* common);
+extern fp_cholmod_l_solve g_cholmod_l_solve;
+#define cholmod_l_solve ::hipsolver::g_cholmod_l_solve
+
 HIPSOLVER_END_NAMESPACE
 
 #endif // HAVE_ROCSPARSE
@@ -0,0 +1,131 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+#include "lapack.hpp"
+#include "load_function.hpp"
+
+#include <string>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+static host_lapack<float>            g_slapack;
+static host_lapack<double>           g_dlapack;
+static host_lapack<hipFloatComplex>  g_clapack;
+static host_lapack<hipDoubleComplex> g_zlapack;
+
+template <>
+const host_lapack<float>& get_host_lapack<float>()
+{
+    return g_slapack;
+}
+
+template <>
+const host_lapack<double>& get_host_lapack<double>()
+{
+    return g_dlapack;
+}
+
+template <>
+const host_lapack<hipFloatComplex>& get_host_lapack<hipFloatComplex>()
+{
+    return g_clapack;
+}
+
+template <>
+const host_lapack<hipDoubleComplex>& get_host_lapack<hipDoubleComplex>()
+{
+    return g_zlapack;
+}
+
+template <typename T>
+static bool load_lapack_functions(void* handle, host_lapack<T>& lapack, const std::string& prefix)
+{
+    if(!load_function(handle, (prefix + "getrf_").c_str(), lapack.getrf))
+        return false;
+    if(!load_function(handle, (prefix + "getrs_").c_str(), lapack.getrs))
+        return false;
+    if(!load_function(handle, (prefix + "potrf_").c_str(), lapack.potrf))
+        return false;
+    if(!load_function(handle, (prefix + "potrs_").c_str(), lapack.potrs))
+        return false;
+
+    return true;
+}
+
+static bool load_lapack()
+{
+#ifndef HIPSOLVER_STATIC_LIB
+#ifdef _WIN32
+    // Library users will need to call SetErrorMode(SEM_FAILCRITICALERRORS) if
+    // they wish to avoid an error message box when this library is not found.
+    // The call is not done by hipSOLVER directly, as it is not thread-safe and
+    // will affect the global state of the program.
+    void* handle = LoadLibraryW(L"liblapack.dll");
+#else
+    void* handle = dlopen("liblapack.so.3", RTLD_NOW | RTLD_LOCAL);
+    char* err    = dlerror(); // clear errors
+
+    if(!handle)
+    {
+        handle = dlopen("libopenblas.so.0", RTLD_NOW | RTLD_LOCAL);
+        err    = dlerror(); // clear errors
+    }
+
+    if(!handle)
+    {
+        handle = dlopen("liblapack.so", RTLD_NOW | RTLD_LOCAL);
+        err    = dlerror(); // clear errors
+    }
+#ifndef NDEBUG
+    if(!handle)
+        std::cerr << "hipsolver: error loading liblapack.so: " << err << std::endl;
+#endif
+#endif /* _WIN32 */
+    if(!handle)
+        return false;
+
+    if(!load_lapack_functions(handle, g_slapack, "s"))
+        return false;
+    if(!load_lapack_functions(handle, g_dlapack, "d"))
+        return false;
+    if(!load_lapack_functions(handle, g_clapack, "c"))
+        return false;
+    if(!load_lapack_functions(handle, g_zlapack, "z"))
+        return false;
+
+    return true;
+#else /* HIPSOLVER_STATIC_LIB */
+    return false;
+#endif
+}
+
+bool try_load_lapack()
+{
+    // Function-scope static initialization has been thread-safe since C++11.
+    // There is an implicit mutex guarding the initialization.
+    static bool result = load_lapack();
+    return result;
+}
+
+HIPSOLVER_END_NAMESPACE
@@ -0,0 +1,49 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hybrid_dispatch.hpp"
+#include "lib_macros.hpp"
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+// entry points of the host LAPACK library, loaded by try_load_lapack
+template <typename T>
+const host_lapack<T>& get_host_lapack();
+
+template <>
+const host_lapack<float>& get_host_lapack<float>();
+template <>
+const host_lapack<double>& get_host_lapack<double>();
+template <>
+const host_lapack<hipFloatComplex>& get_host_lapack<hipFloatComplex>();
+template <>
+const host_lapack<hipDoubleComplex>& get_host_lapack<hipDoubleComplex>();
+
+// load methods
+bool try_load_lapack();
+
+HIPSOLVER_END_NAMESPACE
@@ -28,6 +28,7 @@ HIPSOLVER_BEGIN_NAMESPACE
 
 fp_rocsparse_create_handle      g_rocsparse_create_handle;
 fp_rocsparse_destroy_handle     g_rocsparse_destroy_handle;
+fp_rocsparse_set_stream         g_rocsparse_set_stream;
 fp_rocsparse_create_mat_descr   g_rocsparse_create_mat_descr;
 fp_rocsparse_destroy_mat_descr  g_rocsparse_destroy_mat_descr;
 fp_rocsparse_get_mat_type       g_rocsparse_get_mat_type;
@@ -36,6 +37,10 @@ fp_rocsparse_scsr2dense         g_rocsparse_scsr2dense;
 fp_rocsparse_dcsr2dense         g_rocsparse_dcsr2dense;
 fp_rocsparse_ccsr2dense         g_rocsparse_ccsr2dense;
 fp_rocsparse_zcsr2dense         g_rocsparse_zcsr2dense;
+fp_rocsparse_scsrmv             g_rocsparse_scsrmv;
+fp_rocsparse_dcsrmv             g_rocsparse_dcsrmv;
+fp_rocsparse_sgthr              g_rocsparse_sgthr;
+fp_rocsparse_dgthr              g_rocsparse_dgthr;
 
 static bool load_rocsparse()
 {
@@ -61,6 +66,8 @@ static bool load_rocsparse()
         return false;
     if(!load_function(handle, "rocsparse_destroy_handle", g_rocsparse_destroy_handle))
         return false;
+    if(!load_function(handle, "rocsparse_set_stream", g_rocsparse_set_stream))
+        return false;
     if(!load_function(handle, "rocsparse_create_mat_descr", g_rocsparse_create_mat_descr))
         return false;
     if(!load_function(handle, "rocsparse_destroy_mat_descr", g_rocsparse_destroy_mat_descr))
@@ -79,6 +86,16 @@ static bool load_rocsparse()
     if(!load_function(handle, "rocsparse_zcsr2dense", g_rocsparse_zcsr2dense))
         return false;
 
+    if(!load_function(handle, "rocsparse_scsrmv", g_rocsparse_scsrmv))
+        return false;
+    if(!load_function(handle, "rocsparse_dcsrmv", g_rocsparse_dcsrmv))
+        return false;
+
+    if(!load_function(handle, "rocsparse_sgthr", g_rocsparse_sgthr))
+        return false;
+    if(!load_function(handle, "rocsparse_dgthr", g_rocsparse_dgthr))
+        return false;
+
     return true;
 #else /* HIPSOLVER_STATIC_LIB */
     return false;
@@ -67,8 +67,16 @@ typedef enum rocsparse_matrix_type_
     rocsparse_matrix_type_triangular = 3 /**< triangular matrix type. */
 } rocsparse_matrix_type;
 
+typedef enum rocsparse_operation_
+{
+    rocsparse_operation_none                = 111, /**< Operate with matrix. */
+    rocsparse_operation_transpose           = 112, /**< Operate with transpose. */
+    rocsparse_operation_conjugate_transpose = 113 /**< Operate with conj. transpose. */
+} rocsparse_operation;
+
 typedef struct _rocsparse_handle*    rocsparse_handle;
 typedef struct _rocsparse_mat_descr* rocsparse_mat_descr;
+typedef struct _rocsparse_mat_info*  rocsparse_mat_info;
 
 typedef struct
 {
@@ -91,6 +99,10 @@ typedef rocsparse_status (*fp_rocsparse_destroy_handle)(rocsparse_handle handle)
 extern fp_rocsparse_destroy_handle g_rocsparse_destroy_handle;
 #define rocsparse_destroy_handle ::hipsolver::g_rocsparse_destroy_handle
 
+typedef rocsparse_status (*fp_rocsparse_set_stream)(rocsparse_handle handle, hipStream_t stream);
+extern fp_rocsparse_set_stream g_rocsparse_set_stream;
+#define rocsparse_set_stream ::hipsolver::g_rocsparse_set_stream
+
 typedef rocsparse_status (*fp_rocsparse_create_mat_descr)(rocsparse_mat_descr* descr);
 extern fp_rocsparse_create_mat_descr g_rocsparse_create_mat_descr;
 #define rocsparse_create_mat_descr ::hipsolver::g_rocsparse_create_mat_descr
@@ -155,6 +167,58 @@ typedef rocsparse_status (*fp_rocsparse_zcsr2dense)(rocsparse_handle
 extern fp_rocsparse_zcsr2dense g_rocsparse_zcsr2dense;
 #define rocsparse_zcsr2dense ::hipsolver::g_rocsparse_zcsr2dense
 
+typedef rocsparse_status (*fp_rocsparse_scsrmv)(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             nnz,
+                                                const float*              alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const float*              x,
+                                                const float*              beta,
+                                                float*                    y);
+extern fp_rocsparse_scsrmv g_rocsparse_scsrmv;
+#define rocsparse_scsrmv ::hipsolver::g_rocsparse_scsrmv
+
+typedef rocsparse_status (*fp_rocsparse_dcsrmv)(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             nnz,
+                                                const double*             alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const double*             x,
+                                                const double*             beta,
+                                                double*                   y);
+extern fp_rocsparse_dcsrmv g_rocsparse_dcsrmv;
+#define rocsparse_dcsrmv ::hipsolver::g_rocsparse_dcsrmv
+
+typedef rocsparse_status (*fp_rocsparse_sgthr)(rocsparse_handle     handle,
+                                               rocsparse_int        nnz,
+                                               const float*         y,
+                                               float*               x_val,
+                                               const rocsparse_int* x_ind,
+                                               rocsparse_index_base idx_base);
+extern fp_rocsparse_sgthr g_rocsparse_sgthr;
+#define rocsparse_sgthr ::hipsolver::g_rocsparse_sgthr
+
+typedef rocsparse_status (*fp_rocsparse_dgthr)(rocsparse_handle     handle,
+                                               rocsparse_int        nnz,
+                                               const double*        y,
+                                               double*              x_val,
+                                               const rocsparse_int* x_ind,
+                                               rocsparse_index_base idx_base);
+extern fp_rocsparse_dgthr g_rocsparse_dgthr;
+#define rocsparse_dgthr ::hipsolver::g_rocsparse_dgthr
+
 HIPSOLVER_END_NAMESPACE
 
 #endif // HAVE_ROCSPARSE
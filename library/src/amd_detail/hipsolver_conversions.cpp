@@ -111,6 +111,32 @@ hipsolverSideMode_t rocblas2hip_side(rocblas_side_ side)
     }
 }
 
+rocblas_diagonal_ hip2rocblas_diag(hipsolverDiagType_t diag)
+{
+    switch(diag)
+    {
+    case HIPSOLVER_DIAG_NON_UNIT:
+        return rocblas_diagonal_non_unit;
+    case HIPSOLVER_DIAG_UNIT:
+        return rocblas_diagonal_unit;
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
+hipsolverDiagType_t rocblas2hip_diag(rocblas_diagonal_ diag)
+{
+    switch(diag)
+    {
+    case rocblas_diagonal_non_unit:
+        return HIPSOLVER_DIAG_NON_UNIT;
+    case rocblas_diagonal_unit:
+        return HIPSOLVER_DIAG_UNIT;
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
 rocblas_evect_ hip2rocblas_evect(hipsolverEigMode_t eig)
 {
     switch(eig)
@@ -285,6 +311,51 @@ rocblas_svect_ char2rocblas_svect(signed char svect)
     }
 }
 
+hybrid_function hip2hybrid_function(hipsolverHybridFunction_t func)
+{
+    switch(func)
+    {
+    case HIPSOLVER_HYBRID_GETRF:
+        return hybrid_getrf;
+    case HIPSOLVER_HYBRID_GETRS:
+        return hybrid_getrs;
+    case HIPSOLVER_HYBRID_POTRF:
+        return hybrid_potrf;
+    case HIPSOLVER_HYBRID_POTRS:
+        return hybrid_potrs;
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
+char hip2char_operation(hipsolverOperation_t op)
+{
+    switch(op)
+    {
+    case HIPSOLVER_OP_N:
+        return 'N';
+    case HIPSOLVER_OP_T:
+        return 'T';
+    case HIPSOLVER_OP_C:
+        return 'C';
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
+char hip2char_fill(hipsolverFillMode_t fill)
+{
+    switch(fill)
+    {
+    case HIPSOLVER_FILL_MODE_UPPER:
+        return 'U';
+    case HIPSOLVER_FILL_MODE_LOWER:
+        return 'L';
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
 hipsolverStatus_t rocblas2hip_status(rocblas_status_ error)
 {
     switch(error)
@@ -24,6 +24,7 @@
 #pragma once
 
 #include "hipsolver.h"
+#include "hybrid_dispatch.hpp"
 #include "lib_macros.hpp"
 #include "rocblas/rocblas.h"
 #include "rocsolver/rocsolver.h"
@@ -42,6 +43,10 @@ rocblas_side_ hip2rocblas_side(hipsolverSideMode_t side);
 
 hipsolverSideMode_t rocblas2hip_side(rocblas_side_ side);
 
+rocblas_diagonal_ hip2rocblas_diag(hipsolverDiagType_t diag);
+
+hipsolverDiagType_t rocblas2hip_diag(rocblas_diagonal_ diag);
+
 rocblas_evect_ hip2rocblas_evect(hipsolverEigMode_t eig);
 
 hipsolverEigMode_t rocblas2hip_evect(rocblas_evect_ eig);
@@ -66,6 +71,12 @@ hipsolverDeterministicMode_t rocblas2hip_deterministic(rocblas_atomics_mode_ mod
 
 rocblas_svect_ char2rocblas_svect(signed char svect);
 
+hybrid_function hip2hybrid_function(hipsolverHybridFunction_t func);
+
+char hip2char_operation(hipsolverOperation_t op);
+
+char hip2char_fill(hipsolverFillMode_t fill);
+
 hipsolverStatus_t rocblas2hip_status(rocblas_status_ error);
 
 HIPSOLVER_END_NAMESPACE
@@ -27,171 +27,116 @@
  */
 
 #include "hipsolver.h"
+#include "exceptions.hpp"
+#include "hipsolver_conversions.hpp"
+#include "hipsolver_handle.hpp"
 #include "lib_macros.hpp"
+
+#include "rocblas/rocblas.h"
+#include "rocsolver/rocsolver.h"
 #include <algorithm>
+#include <climits>
 #include <iostream>
 
+/* The workspace of gesvd depends on jobu and jobv, which hipsolverDnXgesvd_bufferSize does not
+   receive. All valid combinations are evaluated inside a single device memory size query, so
+   that rocBLAS keeps the largest of them, and the result is cached in the handle. */
+template <typename S, typename F>
+static hipsolverStatus_t gesvd_max_bufferSize(
+    F rocsolver_gesvd, hipsolverHandle_t handle, const char* func, int m, int n, int* lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolver::bufferSize_memo memo(handle, func, m, n);
+    if(memo.find(lwork))
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    const rocblas_svect svects[] = {rocblas_svect_none,
+                                    rocblas_svect_all,
+                                    rocblas_svect_singular,
+                                    rocblas_svect_overwrite};
+
+    hipsolverStatus_t status = HIPSOLVER_STATUS_SUCCESS;
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    for(rocblas_svect left_svect : svects)
+    {
+        for(rocblas_svect right_svect : svects)
+        {
+            if(left_svect == rocblas_svect_overwrite && right_svect == rocblas_svect_overwrite)
+                continue;
+
+            hipsolverStatus_t stat
+                = hipsolver::rocblas2hip_status(rocsolver_gesvd((rocblas_handle)handle,
+                                                                left_svect,
+                                                                right_svect,
+                                                                m,
+                                                                n,
+                                                                nullptr,
+                                                                m,
+                                                                nullptr,
+                                                                nullptr,
+                                                                std::max(m, 1),
+                                                                nullptr,
+                                                                std::max(n, 1),
+                                                                nullptr,
+                                                                rocblas_outofplace,
+                                                                nullptr));
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = stat;
+        }
+    }
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    // space for E array (aka rwork)
+    size_t size_E = std::min(m, n) > 0 ? sizeof(S) * std::min(m, n) : 0;
+
+    // update size
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E);
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    memo.save(sz);
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
 extern "C" {
 
 // gesvd
 hipsolverStatus_t hipsolverDnSgesvd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
 {
-    int temp1, temp2, temp3, temp4, temp5, temp6, temp7, temp8, temp9, temp10, temp11, temp12,
-        temp13, temp14, temp15;
-
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'N', 'N', m, n, &temp1));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'N', 'A', m, n, &temp2));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'N', 'S', m, n, &temp3));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'N', 'O', m, n, &temp4));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'A', 'N', m, n, &temp5));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'A', 'A', m, n, &temp6));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'A', 'S', m, n, &temp7));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'A', 'O', m, n, &temp8));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'S', 'N', m, n, &temp9));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'S', 'A', m, n, &temp10));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'S', 'S', m, n, &temp11));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'S', 'O', m, n, &temp12));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'O', 'N', m, n, &temp13));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'O', 'A', m, n, &temp14));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'O', 'S', m, n, &temp15));
-
-    *lwork = std::max({temp1,
-                       temp2,
-                       temp3,
-                       temp4,
-                       temp5,
-                       temp6,
-                       temp7,
-                       temp8,
-                       temp9,
-                       temp10,
-                       temp11,
-                       temp12,
-                       temp13,
-                       temp14,
-                       temp15});
-
-    return HIPSOLVER_STATUS_SUCCESS;
+    return gesvd_max_bufferSize<float>(rocsolver_sgesvd, handle, __func__, m, n, lwork);
 }
 
 hipsolverStatus_t hipsolverDnDgesvd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
 {
-    int temp1, temp2, temp3, temp4, temp5, temp6, temp7, temp8, temp9, temp10, temp11, temp12,
-        temp13, temp14, temp15;
-
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'N', 'N', m, n, &temp1));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'N', 'A', m, n, &temp2));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'N', 'S', m, n, &temp3));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'N', 'O', m, n, &temp4));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'A', 'N', m, n, &temp5));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'A', 'A', m, n, &temp6));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'A', 'S', m, n, &temp7));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'A', 'O', m, n, &temp8));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'S', 'N', m, n, &temp9));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'S', 'A', m, n, &temp10));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'S', 'S', m, n, &temp11));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'S', 'O', m, n, &temp12));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'O', 'N', m, n, &temp13));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'O', 'A', m, n, &temp14));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'O', 'S', m, n, &temp15));
-
-    *lwork = std::max({temp1,
-                       temp2,
-                       temp3,
-                       temp4,
-                       temp5,
-                       temp6,
-                       temp7,
-                       temp8,
-                       temp9,
-                       temp10,
-                       temp11,
-                       temp12,
-                       temp13,
-                       temp14,
-                       temp15});
-
-    return HIPSOLVER_STATUS_SUCCESS;
+    return gesvd_max_bufferSize<double>(rocsolver_dgesvd, handle, __func__, m, n, lwork);
 }
 
 hipsolverStatus_t hipsolverDnCgesvd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
 {
-    int temp1, temp2, temp3, temp4, temp5, temp6, temp7, temp8, temp9, temp10, temp11, temp12,
-        temp13, temp14, temp15;
-
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'N', 'N', m, n, &temp1));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'N', 'A', m, n, &temp2));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'N', 'S', m, n, &temp3));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'N', 'O', m, n, &temp4));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'A', 'N', m, n, &temp5));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'A', 'A', m, n, &temp6));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'A', 'S', m, n, &temp7));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'A', 'O', m, n, &temp8));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'S', 'N', m, n, &temp9));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'S', 'A', m, n, &temp10));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'S', 'S', m, n, &temp11));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'S', 'O', m, n, &temp12));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'O', 'N', m, n, &temp13));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'O', 'A', m, n, &temp14));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'O', 'S', m, n, &temp15));
-
-    *lwork = std::max({temp1,
-                       temp2,
-                       temp3,
-                       temp4,
-                       temp5,
-                       temp6,
-                       temp7,
-                       temp8,
-                       temp9,
-                       temp10,
-                       temp11,
-                       temp12,
-                       temp13,
-                       temp14,
-                       temp15});
-
-    return HIPSOLVER_STATUS_SUCCESS;
+    return gesvd_max_bufferSize<float>(rocsolver_cgesvd, handle, __func__, m, n, lwork);
 }
 
 hipsolverStatus_t hipsolverDnZgesvd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
 {
-    int temp1, temp2, temp3, temp4, temp5, temp6, temp7, temp8, temp9, temp10, temp11, temp12,
-        temp13, temp14, temp15;
-
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'N', 'N', m, n, &temp1));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'N', 'A', m, n, &temp2));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'N', 'S', m, n, &temp3));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'N', 'O', m, n, &temp4));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'A', 'N', m, n, &temp5));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'A', 'A', m, n, &temp6));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'A', 'S', m, n, &temp7));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'A', 'O', m, n, &temp8));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'S', 'N', m, n, &temp9));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'S', 'A', m, n, &temp10));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'S', 'S', m, n, &temp11));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'S', 'O', m, n, &temp12));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'O', 'N', m, n, &temp13));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'O', 'A', m, n, &temp14));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'O', 'S', m, n, &temp15));
-
-    *lwork = std::max({temp1,
-                       temp2,
-                       temp3,
-                       temp4,
-                       temp5,
-                       temp6,
-                       temp7,
-                       temp8,
-                       temp9,
-                       temp10,
-                       temp11,
-                       temp12,
-                       temp13,
-                       temp14,
-                       temp15});
-
-    return HIPSOLVER_STATUS_SUCCESS;
+    return gesvd_max_bufferSize<double>(rocsolver_zgesvd, handle, __func__, m, n, lwork);
 }
 
 // getrf
@@ -29,7 +29,10 @@
 #include "exceptions.hpp"
 #include "hipsolver.h"
 #include "hipsolver_conversions.hpp"
+#include "hipsolver_handle.hpp"
+#include "hipsolver_sytrs.hpp"
 #include "lib_macros.hpp"
+#include "tiled_factorization.hpp"
 #include "utility.hpp"
 
 #include "rocblas/internal/rocblas_device_malloc.hpp"
@@ -40,6 +43,8 @@
 #include <functional>
 #include <iostream>
 #include <math.h>
+#include <random>
+#include <vector>
 
 extern "C" {
 
@@ -133,73 +138,4611 @@ rocblas_status rocsolver_zpotrf_info32(rocblas_handle          handle,
                                        const int64_t           lda,
                                        rocblas_int*            info);
 
-/******************** PARAMS ********************/
-struct hipsolverParams
+rocblas_status rocsolver_ssyevdx_inplace(rocblas_handle       handle,
+                                         const rocblas_evect  evect,
+                                         const rocblas_erange erange,
+                                         const rocblas_fill   uplo,
+                                         const rocblas_int    n,
+                                         float*               A,
+                                         const rocblas_int    lda,
+                                         const float          vl,
+                                         const float          vu,
+                                         const rocblas_int    il,
+                                         const rocblas_int    iu,
+                                         const float          abstol,
+                                         rocblas_int*         nev,
+                                         float*               W,
+                                         rocblas_int*         info);
+
+rocblas_status rocsolver_dsyevdx_inplace(rocblas_handle       handle,
+                                         const rocblas_evect  evect,
+                                         const rocblas_erange erange,
+                                         const rocblas_fill   uplo,
+                                         const rocblas_int    n,
+                                         double*              A,
+                                         const rocblas_int    lda,
+                                         const double         vl,
+                                         const double         vu,
+                                         const rocblas_int    il,
+                                         const rocblas_int    iu,
+                                         const double         abstol,
+                                         rocblas_int*         nev,
+                                         double*              W,
+                                         rocblas_int*         info);
+
+rocblas_status rocsolver_cheevdx_inplace(rocblas_handle         handle,
+                                         const rocblas_evect    evect,
+                                         const rocblas_erange   erange,
+                                         const rocblas_fill     uplo,
+                                         const rocblas_int      n,
+                                         rocblas_float_complex* A,
+                                         const rocblas_int      lda,
+                                         const float            vl,
+                                         const float            vu,
+                                         const rocblas_int      il,
+                                         const rocblas_int      iu,
+                                         const float            abstol,
+                                         rocblas_int*           nev,
+                                         float*                 W,
+                                         rocblas_int*           info);
+
+rocblas_status rocsolver_zheevdx_inplace(rocblas_handle          handle,
+                                         const rocblas_evect     evect,
+                                         const rocblas_erange    erange,
+                                         const rocblas_fill      uplo,
+                                         const rocblas_int       n,
+                                         rocblas_double_complex* A,
+                                         const rocblas_int       lda,
+                                         const double            vl,
+                                         const double            vu,
+                                         const rocblas_int       il,
+                                         const rocblas_int       iu,
+                                         const double            abstol,
+                                         rocblas_int*            nev,
+                                         double*                 W,
+                                         rocblas_int*            info);
+
+
+} // extern C
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/******************** 32-BIT FALLBACKS ********************/
+/* rocSOLVER does not provide 64-bit versions of every function. In that case the 32-bit version
+   is called, and sizes that do not fit in a rocblas_int are not supported. Negative sizes are
+   passed through so that rocSOLVER can report them. */
+static rocblas_int to_rocblas_int(int64_t value)
 {
-    hipsolverDnFunction_t func;
-    hipsolverAlgMode_t    alg;
+    if(value > INT_MAX)
+        throw HIPSOLVER_STATUS_NOT_SUPPORTED;
+    return value < INT_MIN ? INT_MIN : rocblas_int(value);
+}
 
-    // Constructor
-    explicit hipsolverParams()
-        : func(HIPSOLVERDN_GETRF)
-        , alg(HIPSOLVER_ALG_0)
+// Size of a buffer at the start of the workspace, rounded up to keep the rest aligned
+static size_t aligned_size(size_t size)
+{
+    return ((size + 127) / 128) * 128;
+}
+
+// Workspace size of a function that needs an extra device buffer besides its rocSOLVER workspace
+static size_t workspace_with_extra(rocblas_handle handle, size_t size, size_t size_extra)
+{
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, size, aligned_size(size_extra));
+    rocblas_stop_device_memory_size_query(handle, &size);
+    return size;
+}
+
+/* Sets up the workspace and the extra device buffer of a function. The buffer is taken from the
+   start of the user-provided workspace, if any, or allocated from the workspace of the handle. */
+static hipsolverStatus_t prepare_workspace(rocblas_handle         handle,
+                                           void*                  work,
+                                           size_t                 lwork,
+                                           size_t                 size_extra,
+                                           rocblas_device_malloc& mem,
+                                           void**                 extra)
+{
+    *extra = nullptr;
+    if(work)
+    {
+        size_t offset = aligned_size(size_extra);
+        if(lwork < offset)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        *extra = work;
+        CHECK_ROCBLAS_ERROR(
+            hipsolverSetUserWorkspace(handle, (char*)work + offset, lwork - offset));
+    }
+    else
+    {
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace(handle, lwork));
+
+        if(size_extra > 0)
+        {
+            mem = rocblas_device_malloc(handle, size_extra);
+            if(!mem)
+                return HIPSOLVER_STATUS_ALLOC_FAILED;
+            *extra = mem[0];
+        }
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// Reads a real scalar of the given type from host memory
+static double host_real(const void* x, hipDataType type)
+{
+    if(!x)
+        return 0;
+    return type == HIP_R_64F ? *(const double*)x : *(const float*)x;
+}
+
+/******************** SYEVD ********************/
+template <typename T, typename S>
+using syevd_t = rocblas_status (*)(rocblas_handle,
+                                   rocblas_evect,
+                                   rocblas_fill,
+                                   rocblas_int,
+                                   T*,
+                                   rocblas_int,
+                                   S*,
+                                   S*,
+                                   rocblas_int*);
+
+template <typename T, typename S>
+static hipsolverStatus_t syevd_bufferSize(syevd_t<T, S>       solver,
+                                          rocblas_handle      handle,
+                                          hipsolverEigMode_t  jobz,
+                                          hipsolverFillMode_t uplo,
+                                          int64_t             n,
+                                          int64_t             lda,
+                                          size_t*             lwork)
+{
+    rocblas_evect evect = hip2rocblas_evect(jobz);
+    rocblas_fill  fill  = hip2rocblas_fill(uplo);
+    rocblas_int   n32   = to_rocblas_int(n);
+    rocblas_int   lda32 = to_rocblas_int(lda);
+    size_t        sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        solver(handle, evect, fill, n32, nullptr, lda32, nullptr, nullptr, nullptr));
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for E array
+    size_t size_E = n32 > 0 ? sizeof(S) * n32 : 0;
+
+    *lwork = workspace_with_extra(handle, sz, size_E);
+    return status;
+}
+
+template <typename T, typename S>
+static hipsolverStatus_t syevd(syevd_t<T, S>       solver,
+                               rocblas_handle      handle,
+                               hipsolverEigMode_t  jobz,
+                               hipsolverFillMode_t uplo,
+                               int64_t             n,
+                               void*               A,
+                               int64_t             lda,
+                               void*               W,
+                               void*               work,
+                               size_t              lwork,
+                               int*                info)
+{
+    rocblas_evect evect = hip2rocblas_evect(jobz);
+    rocblas_fill  fill  = hip2rocblas_fill(uplo);
+    rocblas_int   n32   = to_rocblas_int(n);
+    rocblas_int   lda32 = to_rocblas_int(lda);
+
+    rocblas_device_malloc mem(handle);
+    void*                 E;
+    CHECK_HIPSOLVER_ERROR(
+        prepare_workspace(handle, work, lwork, n32 > 0 ? sizeof(S) * n32 : 0, mem, &E));
+
+    return rocblas2hip_status(solver(handle, evect, fill, n32, (T*)A, lda32, (S*)W, (S*)E, info));
+}
+
+/******************** SYEVDX ********************/
+template <typename T, typename S>
+using syevdx_t = rocblas_status (*)(rocblas_handle,
+                                    rocblas_evect,
+                                    rocblas_erange,
+                                    rocblas_fill,
+                                    rocblas_int,
+                                    T*,
+                                    rocblas_int,
+                                    S,
+                                    S,
+                                    rocblas_int,
+                                    rocblas_int,
+                                    S,
+                                    rocblas_int*,
+                                    S*,
+                                    rocblas_int*);
+
+template <typename T, typename S>
+static hipsolverStatus_t syevdx_bufferSize(syevdx_t<T, S>      solver,
+                                           rocblas_handle      handle,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverEigRange_t range,
+                                           hipsolverFillMode_t uplo,
+                                           int64_t             n,
+                                           int64_t             lda,
+                                           const void*         vl,
+                                           const void*         vu,
+                                           int64_t             il,
+                                           int64_t             iu,
+                                           size_t*             lwork)
+{
+    rocblas_evect  evect  = hip2rocblas_evect(jobz);
+    rocblas_erange erange = hip2rocblas_erange(range);
+    rocblas_fill   fill   = hip2rocblas_fill(uplo);
+    rocblas_int    n32    = to_rocblas_int(n);
+    rocblas_int    lda32  = to_rocblas_int(lda);
+    rocblas_int    il32   = to_rocblas_int(il);
+    rocblas_int    iu32   = to_rocblas_int(iu);
+    S              vl_val = vl ? *(const S*)vl : S(0);
+    S              vu_val = vu ? *(const S*)vu : S(0);
+
+    rocblas_start_device_memory_size_query(handle);
+    hipsolverStatus_t status = rocblas2hip_status(solver(handle,
+                                                         evect,
+                                                         erange,
+                                                         fill,
+                                                         n32,
+                                                         nullptr,
+                                                         lda32,
+                                                         vl_val,
+                                                         vu_val,
+                                                         il32,
+                                                         iu32,
+                                                         0,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr));
+    rocblas_stop_device_memory_size_query(handle, lwork);
+
+    return status;
+}
+
+template <typename T, typename S>
+static hipsolverStatus_t syevdx(syevdx_t<T, S>      solver,
+                                rocblas_handle      handle,
+                                hipsolverEigMode_t  jobz,
+                                hipsolverEigRange_t range,
+                                hipsolverFillMode_t uplo,
+                                int64_t             n,
+                                void*               A,
+                                int64_t             lda,
+                                const void*         vl,
+                                const void*         vu,
+                                int64_t             il,
+                                int64_t             iu,
+                                int64_t*            nev,
+                                void*               W,
+                                void*               work,
+                                size_t              lwork,
+                                int*                info)
+{
+    rocblas_evect  evect  = hip2rocblas_evect(jobz);
+    rocblas_erange erange = hip2rocblas_erange(range);
+    rocblas_fill   fill   = hip2rocblas_fill(uplo);
+    rocblas_int    n32    = to_rocblas_int(n);
+    rocblas_int    lda32  = to_rocblas_int(lda);
+    rocblas_int    il32   = to_rocblas_int(il);
+    rocblas_int    iu32   = to_rocblas_int(iu);
+    S              vl_val = vl ? *(const S*)vl : S(0);
+    S              vu_val = vu ? *(const S*)vu : S(0);
+
+    if(work)
+        CHECK_ROCBLAS_ERROR(hipsolverSetUserWorkspace(handle, work, lwork));
+    else
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace(handle, lwork));
+
+    // the number of eigenvalues is returned on the host
+    rocblas_int       nev32;
+    hipsolverStatus_t status = rocblas2hip_status(solver(handle,
+                                                         evect,
+                                                         erange,
+                                                         fill,
+                                                         n32,
+                                                         (T*)A,
+                                                         lda32,
+                                                         vl_val,
+                                                         vu_val,
+                                                         il32,
+                                                         iu32,
+                                                         0,
+                                                         nev ? &nev32 : nullptr,
+                                                         (S*)W,
+                                                         info));
+
+    if(status == HIPSOLVER_STATUS_SUCCESS && nev)
+        *nev = nev32;
+    return status;
+}
+
+/******************** GESVD ********************/
+template <typename T, typename S>
+using gesvd_t = rocblas_status (*)(rocblas_handle,
+                                   rocblas_svect,
+                                   rocblas_svect,
+                                   rocblas_int,
+                                   rocblas_int,
+                                   T*,
+                                   rocblas_int,
+                                   S*,
+                                   T*,
+                                   rocblas_int,
+                                   T*,
+                                   rocblas_int,
+                                   S*,
+                                   rocblas_workmode,
+                                   rocblas_int*);
+
+template <typename T, typename S>
+static hipsolverStatus_t gesvd_bufferSize(gesvd_t<T, S>  solver,
+                                          rocblas_handle handle,
+                                          signed char    jobu,
+                                          signed char    jobv,
+                                          int64_t        m,
+                                          int64_t        n,
+                                          int64_t        lda,
+                                          size_t*        lwork)
+{
+    rocblas_svect left  = char2rocblas_svect(jobu);
+    rocblas_svect right = char2rocblas_svect(jobv);
+    rocblas_int   m32   = to_rocblas_int(m);
+    rocblas_int   n32   = to_rocblas_int(n);
+    rocblas_int   lda32 = to_rocblas_int(lda);
+    size_t        sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    hipsolverStatus_t status = rocblas2hip_status(solver(handle,
+                                                         left,
+                                                         right,
+                                                         m32,
+                                                         n32,
+                                                         nullptr,
+                                                         lda32,
+                                                         nullptr,
+                                                         nullptr,
+                                                         std::max(m32, 1),
+                                                         nullptr,
+                                                         std::max(n32, 1),
+                                                         nullptr,
+                                                         rocblas_outofplace,
+                                                         nullptr));
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for E array (aka rwork)
+    size_t size_E = std::min(m32, n32) > 0 ? sizeof(S) * std::min(m32, n32) : 0;
+
+    *lwork = workspace_with_extra(handle, sz, size_E);
+    return status;
+}
+
+template <typename T, typename S>
+static hipsolverStatus_t gesvd(gesvd_t<T, S>  solver,
+                               rocblas_handle handle,
+                               signed char    jobu,
+                               signed char    jobv,
+                               int64_t        m,
+                               int64_t        n,
+                               void*          A,
+                               int64_t        lda,
+                               void*          Sv,
+                               void*          U,
+                               int64_t        ldu,
+                               void*          V,
+                               int64_t        ldv,
+                               void*          work,
+                               size_t         lwork,
+                               int*           info)
+{
+    rocblas_svect left  = char2rocblas_svect(jobu);
+    rocblas_svect right = char2rocblas_svect(jobv);
+    rocblas_int   m32   = to_rocblas_int(m);
+    rocblas_int   n32   = to_rocblas_int(n);
+    rocblas_int   lda32 = to_rocblas_int(lda);
+    rocblas_int   ldu32 = to_rocblas_int(ldu);
+    rocblas_int   ldv32 = to_rocblas_int(ldv);
+
+    // space for E array (aka rwork)
+    size_t size_E = std::min(m32, n32) > 0 ? sizeof(S) * std::min(m32, n32) : 0;
+
+    rocblas_device_malloc mem(handle);
+    void*                 E;
+    CHECK_HIPSOLVER_ERROR(prepare_workspace(handle, work, lwork, size_E, mem, &E));
+
+    return rocblas2hip_status(solver(handle,
+                                     left,
+                                     right,
+                                     m32,
+                                     n32,
+                                     (T*)A,
+                                     lda32,
+                                     (S*)Sv,
+                                     (T*)U,
+                                     ldu32,
+                                     (T*)V,
+                                     ldv32,
+                                     (S*)E,
+                                     rocblas_outofplace,
+                                     info));
+}
+
+/******************** GESVDP ********************/
+/* rocSOLVER has no polar-decomposition-based SVD, so it is composed from rocBLAS and rocSOLVER
+   routines. The polar factor Up of a tall matrix B = Up * H is computed with the QDWH iteration,
+   which only needs QR and Cholesky factorizations and matrix products. The SVD then follows from
+   the eigendecomposition H = W * Sigma * W^H as B = (Up * W) * Sigma * W^H. A wide matrix is
+   handled through its conjugate transpose. */
+template <typename T>
+struct gesvdp_routines;
+
+template <>
+struct gesvdp_routines<float>
+{
+    static constexpr auto gemm  = rocblas_sgemm;
+    static constexpr auto geam  = rocblas_sgeam;
+    static constexpr auto herk  = rocblas_ssyrk;
+    static constexpr auto trsm  = rocblas_strsm;
+    static constexpr auto nrm2  = rocblas_snrm2;
+    static constexpr auto rscal = rocblas_sscal;
+    static constexpr auto axpy  = rocblas_saxpy;
+    static constexpr auto geqrf = rocsolver_sgeqrf;
+    static constexpr auto ungqr = rocsolver_sorgqr;
+    static constexpr auto potrf = rocsolver_spotrf;
+    static constexpr auto heevd = rocsolver_ssyevd;
+};
+
+template <>
+struct gesvdp_routines<double>
+{
+    static constexpr auto gemm  = rocblas_dgemm;
+    static constexpr auto geam  = rocblas_dgeam;
+    static constexpr auto herk  = rocblas_dsyrk;
+    static constexpr auto trsm  = rocblas_dtrsm;
+    static constexpr auto nrm2  = rocblas_dnrm2;
+    static constexpr auto rscal = rocblas_dscal;
+    static constexpr auto axpy  = rocblas_daxpy;
+    static constexpr auto geqrf = rocsolver_dgeqrf;
+    static constexpr auto ungqr = rocsolver_dorgqr;
+    static constexpr auto potrf = rocsolver_dpotrf;
+    static constexpr auto heevd = rocsolver_dsyevd;
+};
+
+template <>
+struct gesvdp_routines<rocblas_float_complex>
+{
+    static constexpr auto gemm  = rocblas_cgemm;
+    static constexpr auto geam  = rocblas_cgeam;
+    static constexpr auto herk  = rocblas_cherk;
+    static constexpr auto trsm  = rocblas_ctrsm;
+    static constexpr auto nrm2  = rocblas_scnrm2;
+    static constexpr auto rscal = rocblas_csscal;
+    static constexpr auto axpy  = rocblas_caxpy;
+    static constexpr auto geqrf = rocsolver_cgeqrf;
+    static constexpr auto ungqr = rocsolver_cungqr;
+    static constexpr auto potrf = rocsolver_cpotrf;
+    static constexpr auto heevd = rocsolver_cheevd;
+};
+
+template <>
+struct gesvdp_routines<rocblas_double_complex>
+{
+    static constexpr auto gemm  = rocblas_zgemm;
+    static constexpr auto geam  = rocblas_zgeam;
+    static constexpr auto herk  = rocblas_zherk;
+    static constexpr auto trsm  = rocblas_ztrsm;
+    static constexpr auto nrm2  = rocblas_dznrm2;
+    static constexpr auto rscal = rocblas_zdscal;
+    static constexpr auto axpy  = rocblas_zaxpy;
+    static constexpr auto geqrf = rocsolver_zgeqrf;
+    static constexpr auto ungqr = rocsolver_zungqr;
+    static constexpr auto potrf = rocsolver_zpotrf;
+    static constexpr auto heevd = rocsolver_zheevd;
+};
+
+// QDWH converges in at most six iterations in double precision
+constexpr int gesvdp_max_iters = 12;
+
+// Above this weight, the QR-based iteration is used, as the Cholesky-based one loses stability
+constexpr double gesvdp_qr_weight = 100;
+
+/* Dynamically weighted Halley parameters for a lower bound l of the smallest singular value of
+   the current iterate. They tend to Halley's (3, 1, 3) as l tends to 1. */
+static void gesvdp_weights(double l, double* a, double* b, double* c)
+{
+    double l2 = l * l;
+    double d  = std::cbrt(4 * (1 - l2) / (l2 * l2));
+    double sq = sqrt(1 + d);
+    *a        = sq + 0.5 * sqrt(8 - 4 * d + 8 * (2 - l2) / (l2 * sq));
+    *b        = (*a - 1) * (*a - 1) / 4;
+    *c        = *a + *b - 1;
+}
+
+static hipsolverStatus_t gesvdp_argCheck(hipsolverEigMode_t jobz,
+                                         int64_t            m,
+                                         int64_t            n,
+                                         int64_t            lda,
+                                         int64_t            ldu,
+                                         int64_t            ldv)
+{
+    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR && jobz != HIPSOLVER_EIG_MODE_VECTOR)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(m < 0 || n < 0 || lda < std::max(m, int64_t(1)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR
+       && (ldu < std::max(m, int64_t(1)) || ldv < std::max(n, int64_t(1))))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/* Device buffers of gesvdp, for the p x q (p >= q) matrix B = A or B = A^H. X holds the iterate
+   and Xp the previous one, Y the stacked matrix of the QR-based iteration (or a copy of X in the
+   Cholesky-based one), H the Hermitian polar factor and Z the Cholesky factor or the
+   eigenvectors. */
+template <typename T, typename S>
+struct gesvdp_layout
+{
+    size_t X, Xp, Y, H, Z, tau, ones, E, iinfo, size;
+
+    gesvdp_layout(rocblas_int p, rocblas_int q)
+    {
+        X     = 0;
+        Xp    = X + aligned_size(sizeof(T) * p * q);
+        Y     = Xp + aligned_size(sizeof(T) * p * q);
+        H     = Y + aligned_size(sizeof(T) * (p + q) * q);
+        Z     = H + aligned_size(sizeof(T) * q * q);
+        tau   = Z + aligned_size(sizeof(T) * q * q);
+        ones  = tau + aligned_size(sizeof(T) * q);
+        E     = ones + aligned_size(sizeof(T) * q);
+        iinfo = E + aligned_size(sizeof(S) * q);
+        size  = iinfo + sizeof(rocblas_int);
+    }
+};
+
+template <typename T, typename S>
+static hipsolverStatus_t gesvdp_bufferSize(rocblas_handle     handle,
+                                           hipsolverEigMode_t jobz,
+                                           int                econ,
+                                           int64_t            m,
+                                           int64_t            n,
+                                           int64_t            lda,
+                                           int64_t            ldu,
+                                           int64_t            ldv,
+                                           size_t*            lwork)
+{
+    using R = gesvdp_routines<T>;
+
+    CHECK_HIPSOLVER_ERROR(gesvdp_argCheck(jobz, m, n, lda, ldu, ldv));
+
+    rocblas_int   p     = to_rocblas_int(std::max(m, n));
+    rocblas_int   q     = to_rocblas_int(std::min(m, n));
+    rocblas_int   pq    = to_rocblas_int(int64_t(p) * q);
+    rocblas_evect evect = hip2rocblas_evect(jobz);
+    bool          full  = jobz == HIPSOLVER_EIG_MODE_VECTOR && !econ && p > q;
+    size_t        sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status[] = {
+        R::geqrf(handle, p + q, q, nullptr, p + q, nullptr),
+        R::ungqr(handle, p + q, q, q, nullptr, p + q, nullptr),
+        R::potrf(handle, rocblas_fill_upper, q, nullptr, std::max(q, 1), nullptr),
+        R::trsm(handle,
+                rocblas_side_right,
+                rocblas_fill_upper,
+                rocblas_operation_none,
+                rocblas_diagonal_non_unit,
+                p,
+                q,
+                nullptr,
+                nullptr,
+                std::max(q, 1),
+                nullptr,
+                std::max(p, 1)),
+        R::nrm2(handle, pq, nullptr, 1, nullptr),
+        R::heevd(handle,
+                 evect,
+                 rocblas_fill_upper,
+                 q,
+                 nullptr,
+                 std::max(q, 1),
+                 nullptr,
+                 nullptr,
+                 nullptr),
+        full ? R::geqrf(handle, p, q, nullptr, p, nullptr) : rocblas_status_success,
+        full ? R::ungqr(handle, p, p, q, nullptr, p, nullptr) : rocblas_status_success,
+    };
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    for(rocblas_status st : status)
+    {
+        if(rocblas2hip_status(st) != HIPSOLVER_STATUS_SUCCESS)
+            return rocblas2hip_status(st);
+    }
+
+    *lwork = workspace_with_extra(handle, sz, gesvdp_layout<T, S>(p, q).size);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T, typename S>
+static hipsolverStatus_t gesvdp(rocblas_handle     handle,
+                                hipsolverEigMode_t jobz,
+                                int                econ,
+                                int64_t            m,
+                                int64_t            n,
+                                void*              A,
+                                int64_t            lda,
+                                void*              Sv,
+                                void*              U,
+                                int64_t            ldu,
+                                void*              V,
+                                int64_t            ldv,
+                                void*              work,
+                                size_t             lwork,
+                                int*               info,
+                                double*            hErrSigma)
+{
+    using R = gesvdp_routines<T>;
+
+    CHECK_HIPSOLVER_ERROR(gesvdp_argCheck(jobz, m, n, lda, ldu, ldv));
+    bool vectors = jobz == HIPSOLVER_EIG_MODE_VECTOR;
+    if(!A || !Sv || !info || (vectors && (!U || !V)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocblas_int p     = to_rocblas_int(std::max(m, n));
+    rocblas_int q     = to_rocblas_int(std::min(m, n));
+    rocblas_int pq    = to_rocblas_int(int64_t(p) * q);
+    rocblas_int lda32 = to_rocblas_int(lda);
+    bool        wide  = m < n;
+    bool        full  = vectors && !econ && p > q;
+
+    gesvdp_layout<T, S> layout(p, q);
+
+    // the identity and the error bound are staged through the host
+    CHECK_HIPSOLVER_ERROR(check_capture(handle, capture_step_synchronize));
+
+    rocblas_device_malloc mem(handle);
+    void*                 extra;
+    CHECK_HIPSOLVER_ERROR(prepare_workspace(handle, work, lwork, layout.size, mem, &extra));
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    if(hErrSigma)
+        *hErrSigma = 0;
+    if(q == 0)
+    {
+        CHECK_HIP_ERROR(hipMemsetAsync(info, 0, sizeof(int), stream));
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    T*           X     = (T*)((char*)extra + layout.X);
+    T*           Xp    = (T*)((char*)extra + layout.Xp);
+    T*           Y     = (T*)((char*)extra + layout.Y);
+    T*           H     = (T*)((char*)extra + layout.H);
+    T*           Z     = (T*)((char*)extra + layout.Z);
+    T*           tau   = (T*)((char*)extra + layout.tau);
+    T*           ones  = (T*)((char*)extra + layout.ones);
+    S*           E     = (S*)((char*)extra + layout.E);
+    rocblas_int* iinfo = (rocblas_int*)((char*)extra + layout.iinfo);
+
+    const rocblas_operation none    = rocblas_operation_none;
+    const rocblas_operation adjoint = rocblas_operation_conjugate_transpose;
+    const T                 one     = T(1);
+    const T                 zero    = T(0);
+
+    pointer_mode_host_scope scope(handle);
+
+    // the diagonals of identity matrices are copied from a vector of ones
+    std::vector<T> hones(q, one);
+    CHECK_HIP_ERROR(
+        hipMemcpyAsync(ones, hones.data(), sizeof(T) * q, hipMemcpyHostToDevice, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // X = B / ||B||_F, so that all its singular values are at most 1
+    if(wide)
+        CHECK_ROCBLAS_ERROR(
+            R::geam(handle, adjoint, none, p, q, &one, (T*)A, lda32, &zero, X, p, X, p));
+    else
+        CHECK_HIP_ERROR(hipMemcpy2DAsync(X,
+                                         sizeof(T) * p,
+                                         A,
+                                         sizeof(T) * lda,
+                                         sizeof(T) * p,
+                                         q,
+                                         hipMemcpyDeviceToDevice,
+                                         stream));
+
+    S alpha;
+    CHECK_ROCBLAS_ERROR(R::nrm2(handle, pq, X, 1, &alpha));
+    if(alpha == 0)
+    {
+        // any matrix with orthonormal columns is a polar factor of zero
+        CHECK_HIP_ERROR(hipMemsetAsync(X, 0, sizeof(T) * p * q, stream));
+        CHECK_HIP_ERROR(hipMemcpy2DAsync(X,
+                                         sizeof(T) * (p + 1),
+                                         ones,
+                                         sizeof(T),
+                                         sizeof(T),
+                                         q,
+                                         hipMemcpyDeviceToDevice,
+                                         stream));
+    }
+    else
+    {
+        S scale = 1 / alpha;
+        CHECK_ROCBLAS_ERROR(R::rscal(handle, pq, &scale, X, 1));
+
+        /* The smallest singular value of X is not estimated; eps is used as its lower bound,
+           which costs at most one or two iterations more than a condition number estimate. */
+        const double eps = std::numeric_limits<S>::epsilon();
+        double       l   = eps;
+        double       diff = 0;
+
+        for(int it = 0; it < gesvdp_max_iters; it++)
+        {
+            double a, b, c;
+            gesvdp_weights(l, &a, &b, &c);
+            const T bc = T(S(b / c));
+
+            CHECK_HIP_ERROR(hipMemcpyAsync(
+                Xp, X, sizeof(T) * p * q, hipMemcpyDeviceToDevice, stream));
+
+            if(c > gesvdp_qr_weight)
+            {
+                // [sqrt(c) * X; I] = [Q1; Q2] * R and X = b/c * X + (a - b/c) / sqrt(c) * Q1 * Q2^H
+                const T sc   = T(S(sqrt(c)));
+                const T coef = T(S((a - b / c) / sqrt(c)));
+                CHECK_ROCBLAS_ERROR(
+                    R::geam(handle, none, none, p, q, &sc, X, p, &zero, Y, p + q, Y, p + q));
+                CHECK_HIP_ERROR(hipMemset2DAsync(
+                    Y + p, sizeof(T) * (p + q), 0, sizeof(T) * q, q, stream));
+                CHECK_HIP_ERROR(hipMemcpy2DAsync(Y + p,
+                                                 sizeof(T) * (p + q + 1),
+                                                 ones,
+                                                 sizeof(T),
+                                                 sizeof(T),
+                                                 q,
+                                                 hipMemcpyDeviceToDevice,
+                                                 stream));
+                CHECK_ROCBLAS_ERROR(R::geqrf(handle, p + q, q, Y, p + q, tau));
+                CHECK_ROCBLAS_ERROR(R::ungqr(handle, p + q, q, q, Y, p + q, tau));
+                CHECK_ROCBLAS_ERROR(R::gemm(
+                    handle, none, adjoint, p, q, q, &coef, Y, p + q, Y + p, p + q, &bc, X, p));
+            }
+            else
+            {
+                // I + c * X^H * X = W^H * W and X = b/c * X + (a - b/c) * X * W^-1 * W^-H
+                const S sc   = S(c);
+                const S sone = 1;
+                const T coef = T(S(a - b / c));
+                CHECK_HIP_ERROR(hipMemsetAsync(Z, 0, sizeof(T) * q * q, stream));
+                CHECK_HIP_ERROR(hipMemcpy2DAsync(Z,
+                                                 sizeof(T) * (q + 1),
+                                                 ones,
+                                                 sizeof(T),
+                                                 sizeof(T),
+                                                 q,
+                                                 hipMemcpyDeviceToDevice,
+                                                 stream));
+                CHECK_ROCBLAS_ERROR(
+                    R::herk(handle, rocblas_fill_upper, adjoint, q, p, &sc, X, p, &sone, Z, q));
+                CHECK_ROCBLAS_ERROR(R::potrf(handle, rocblas_fill_upper, q, Z, q, iinfo));
+
+                CHECK_HIP_ERROR(hipMemcpyAsync(
+                    Y, X, sizeof(T) * p * q, hipMemcpyDeviceToDevice, stream));
+                CHECK_ROCBLAS_ERROR(R::trsm(handle,
+                                            rocblas_side_right,
+                                            rocblas_fill_upper,
+                                            none,
+                                            rocblas_diagonal_non_unit,
+                                            p,
+                                            q,
+                                            &one,
+                                            Z,
+                                            q,
+                                            Y,
+                                            p));
+                CHECK_ROCBLAS_ERROR(R::trsm(handle,
+                                            rocblas_side_right,
+                                            rocblas_fill_upper,
+                                            adjoint,
+                                            rocblas_diagonal_non_unit,
+                                            p,
+                                            q,
+                                            &one,
+                                            Z,
+                                            q,
+                                            Y,
+                                            p));
+
+                const S sbc = S(b / c);
+                CHECK_ROCBLAS_ERROR(R::rscal(handle, pq, &sbc, X, 1));
+                CHECK_ROCBLAS_ERROR(R::axpy(handle, pq, &coef, Y, 1, X, 1));
+            }
+
+            // ||X - Xp||_F, which also waits for the iteration to finish
+            const T minus_one = T(-1);
+            S       hdiff;
+            CHECK_ROCBLAS_ERROR(R::axpy(handle, pq, &minus_one, X, 1, Xp, 1));
+            CHECK_ROCBLAS_ERROR(R::nrm2(handle, pq, Xp, 1, &hdiff));
+            diff = hdiff;
+
+            l = std::min(1.0, l * (a + b * l * l) / (1 + c * l * l));
+            if(1 - l <= 5 * eps && diff <= std::cbrt(5 * eps))
+                break;
+        }
+
+        if(hErrSigma)
+            *hErrSigma = diff;
+    }
+
+    // -H = -(Up^H * B + B^H * Up) / 2, so that the eigenvalues come in decreasing order of the
+    // singular values
+    const T half = T(S(-0.5));
+    CHECK_ROCBLAS_ERROR(R::gemm(handle,
+                                adjoint,
+                                wide ? adjoint : none,
+                                q,
+                                q,
+                                p,
+                                &one,
+                                X,
+                                p,
+                                (T*)A,
+                                lda32,
+                                &zero,
+                                H,
+                                q));
+    CHECK_ROCBLAS_ERROR(R::geam(handle, none, adjoint, q, q, &half, H, q, &half, H, q, Z, q));
+    CHECK_ROCBLAS_ERROR(R::heevd(
+        handle, hip2rocblas_evect(jobz), rocblas_fill_upper, q, Z, q, (S*)Sv, E, info));
+
+    const S minus_one = -1;
+    CHECK_ROCBLAS_ERROR(gesvdp_routines<S>::rscal(handle, q, &minus_one, (S*)Sv, 1));
+
+    if(vectors)
+    {
+        // the left singular vectors of B are Up * W and the right ones are W
+        T*          L   = (T*)(wide ? V : U);
+        T*          Rv  = (T*)(wide ? U : V);
+        rocblas_int ldl = to_rocblas_int(wide ? ldv : ldu);
+        rocblas_int ldr = to_rocblas_int(wide ? ldu : ldv);
+
+        CHECK_ROCBLAS_ERROR(R::gemm(handle, none, none, p, q, q, &one, X, p, Z, q, &zero, L, ldl));
+        if(full)
+        {
+            // complete the basis from the QR factorization of Up * W, then restore its columns
+            CHECK_ROCBLAS_ERROR(R::geqrf(handle, p, q, L, ldl, tau));
+            CHECK_ROCBLAS_ERROR(R::ungqr(handle, p, p, q, L, ldl, tau));
+            CHECK_ROCBLAS_ERROR(
+                R::gemm(handle, none, none, p, q, q, &one, X, p, Z, q, &zero, L, ldl));
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy2DAsync(Rv,
+                                         sizeof(T) * ldr,
+                                         Z,
+                                         sizeof(T) * q,
+                                         sizeof(T) * q,
+                                         q,
+                                         hipMemcpyDeviceToDevice,
+                                         stream));
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** GESVDR ********************/
+/* Building blocks of the randomized SVD. The range of A is sampled with a Gaussian sketch,
+   refined by power iterations, and the SVD of the projection of A on that range is computed
+   with gesvd. The functions compute C = op(A) * op(B) with the scalars on the host. */
+static rocblas_status gesvdr_gemm(rocblas_handle    handle,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  rocblas_int       m,
+                                  rocblas_int       n,
+                                  rocblas_int       k,
+                                  float*            A,
+                                  rocblas_int       lda,
+                                  float*            B,
+                                  rocblas_int       ldb,
+                                  float*            C,
+                                  rocblas_int       ldc)
+{
+    const float one = 1, zero = 0;
+    return rocblas_sgemm(handle, transA, transB, m, n, k, &one, A, lda, B, ldb, &zero, C, ldc);
+}
+
+static rocblas_status gesvdr_gemm(rocblas_handle    handle,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  rocblas_int       m,
+                                  rocblas_int       n,
+                                  rocblas_int       k,
+                                  double*           A,
+                                  rocblas_int       lda,
+                                  double*           B,
+                                  rocblas_int       ldb,
+                                  double*           C,
+                                  rocblas_int       ldc)
+{
+    const double one = 1, zero = 0;
+    return rocblas_dgemm(handle, transA, transB, m, n, k, &one, A, lda, B, ldb, &zero, C, ldc);
+}
+
+static rocblas_status gesvdr_gemm(rocblas_handle         handle,
+                                  rocblas_operation      transA,
+                                  rocblas_operation      transB,
+                                  rocblas_int            m,
+                                  rocblas_int            n,
+                                  rocblas_int            k,
+                                  rocblas_float_complex* A,
+                                  rocblas_int            lda,
+                                  rocblas_float_complex* B,
+                                  rocblas_int            ldb,
+                                  rocblas_float_complex* C,
+                                  rocblas_int            ldc)
+{
+    const rocblas_float_complex one = {1, 0}, zero = {0, 0};
+    return rocblas_cgemm(handle, transA, transB, m, n, k, &one, A, lda, B, ldb, &zero, C, ldc);
+}
+
+static rocblas_status gesvdr_gemm(rocblas_handle          handle,
+                                  rocblas_operation       transA,
+                                  rocblas_operation       transB,
+                                  rocblas_int             m,
+                                  rocblas_int             n,
+                                  rocblas_int             k,
+                                  rocblas_double_complex* A,
+                                  rocblas_int             lda,
+                                  rocblas_double_complex* B,
+                                  rocblas_int             ldb,
+                                  rocblas_double_complex* C,
+                                  rocblas_int             ldc)
+{
+    const rocblas_double_complex one = {1, 0}, zero = {0, 0};
+    return rocblas_zgemm(handle, transA, transB, m, n, k, &one, A, lda, B, ldb, &zero, C, ldc);
+}
+
+static rocblas_status gesvdr_geqrf(rocblas_handle handle,
+                                   rocblas_int    m,
+                                   rocblas_int    n,
+                                   float*         A,
+                                   rocblas_int    lda,
+                                   float*         tau)
+{
+    return rocsolver_sgeqrf(handle, m, n, A, lda, tau);
+}
+
+static rocblas_status gesvdr_geqrf(rocblas_handle handle,
+                                   rocblas_int    m,
+                                   rocblas_int    n,
+                                   double*        A,
+                                   rocblas_int    lda,
+                                   double*        tau)
+{
+    return rocsolver_dgeqrf(handle, m, n, A, lda, tau);
+}
+
+static rocblas_status gesvdr_geqrf(rocblas_handle         handle,
+                                   rocblas_int            m,
+                                   rocblas_int            n,
+                                   rocblas_float_complex* A,
+                                   rocblas_int            lda,
+                                   rocblas_float_complex* tau)
+{
+    return rocsolver_cgeqrf(handle, m, n, A, lda, tau);
+}
+
+static rocblas_status gesvdr_geqrf(rocblas_handle          handle,
+                                   rocblas_int             m,
+                                   rocblas_int             n,
+                                   rocblas_double_complex* A,
+                                   rocblas_int             lda,
+                                   rocblas_double_complex* tau)
+{
+    return rocsolver_zgeqrf(handle, m, n, A, lda, tau);
+}
+
+static rocblas_status gesvdr_orgqr(rocblas_handle handle,
+                                   rocblas_int    m,
+                                   rocblas_int    n,
+                                   float*         A,
+                                   rocblas_int    lda,
+                                   float*         tau)
+{
+    return rocsolver_sorgqr(handle, m, n, n, A, lda, tau);
+}
+
+static rocblas_status gesvdr_orgqr(rocblas_handle handle,
+                                   rocblas_int    m,
+                                   rocblas_int    n,
+                                   double*        A,
+                                   rocblas_int    lda,
+                                   double*        tau)
+{
+    return rocsolver_dorgqr(handle, m, n, n, A, lda, tau);
+}
+
+static rocblas_status gesvdr_orgqr(rocblas_handle         handle,
+                                   rocblas_int            m,
+                                   rocblas_int            n,
+                                   rocblas_float_complex* A,
+                                   rocblas_int            lda,
+                                   rocblas_float_complex* tau)
+{
+    return rocsolver_cungqr(handle, m, n, n, A, lda, tau);
+}
+
+static rocblas_status gesvdr_orgqr(rocblas_handle          handle,
+                                   rocblas_int             m,
+                                   rocblas_int             n,
+                                   rocblas_double_complex* A,
+                                   rocblas_int             lda,
+                                   rocblas_double_complex* tau)
+{
+    return rocsolver_zungqr(handle, m, n, n, A, lda, tau);
+}
+
+// Replaces the m-by-n matrix A with an orthonormal basis of its range
+template <typename T>
+static rocblas_status
+    gesvdr_orth(rocblas_handle handle, rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* tau)
+{
+    rocblas_status status = gesvdr_geqrf(handle, m, n, A, lda, tau);
+    if(status != rocblas_status_success)
+        return status;
+    return gesvdr_orgqr(handle, m, n, A, lda, tau);
+}
+
+/* SVD of the n-by-l matrix B^H, whose left singular vectors overwrite it and whose right
+   singular vectors, transposed, are written to XH */
+static rocblas_status gesvdr_gesvd(rocblas_handle handle,
+                                   rocblas_int    n,
+                                   rocblas_int    l,
+                                   float*         BH,
+                                   float*         sigma,
+                                   float*         XH,
+                                   float*         E,
+                                   rocblas_int*   info)
+{
+    return rocsolver_sgesvd(handle,
+                            rocblas_svect_overwrite,
+                            rocblas_svect_singular,
+                            n,
+                            l,
+                            BH,
+                            n,
+                            sigma,
+                            nullptr,
+                            n,
+                            XH,
+                            l,
+                            E,
+                            rocblas_outofplace,
+                            info);
+}
+
+static rocblas_status gesvdr_gesvd(rocblas_handle handle,
+                                   rocblas_int    n,
+                                   rocblas_int    l,
+                                   double*        BH,
+                                   double*        sigma,
+                                   double*        XH,
+                                   double*        E,
+                                   rocblas_int*   info)
+{
+    return rocsolver_dgesvd(handle,
+                            rocblas_svect_overwrite,
+                            rocblas_svect_singular,
+                            n,
+                            l,
+                            BH,
+                            n,
+                            sigma,
+                            nullptr,
+                            n,
+                            XH,
+                            l,
+                            E,
+                            rocblas_outofplace,
+                            info);
+}
+
+static rocblas_status gesvdr_gesvd(rocblas_handle         handle,
+                                   rocblas_int            n,
+                                   rocblas_int            l,
+                                   rocblas_float_complex* BH,
+                                   float*                 sigma,
+                                   rocblas_float_complex* XH,
+                                   float*                 E,
+                                   rocblas_int*           info)
+{
+    return rocsolver_cgesvd(handle,
+                            rocblas_svect_overwrite,
+                            rocblas_svect_singular,
+                            n,
+                            l,
+                            BH,
+                            n,
+                            sigma,
+                            nullptr,
+                            n,
+                            XH,
+                            l,
+                            E,
+                            rocblas_outofplace,
+                            info);
+}
+
+static rocblas_status gesvdr_gesvd(rocblas_handle          handle,
+                                   rocblas_int             n,
+                                   rocblas_int             l,
+                                   rocblas_double_complex* BH,
+                                   double*                 sigma,
+                                   rocblas_double_complex* XH,
+                                   double*                 E,
+                                   rocblas_int*            info)
+{
+    return rocsolver_zgesvd(handle,
+                            rocblas_svect_overwrite,
+                            rocblas_svect_singular,
+                            n,
+                            l,
+                            BH,
+                            n,
+                            sigma,
+                            nullptr,
+                            n,
+                            XH,
+                            l,
+                            E,
+                            rocblas_outofplace,
+                            info);
+}
+
+// Euclidean norms of the n columns of the m-by-n matrix A
+static rocblas_status gesvdr_nrm2(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, float* A, rocblas_int lda, float* norms)
+{
+    return rocblas_snrm2_strided_batched(handle, m, A, 1, lda, n, norms);
+}
+
+static rocblas_status gesvdr_nrm2(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, double* A, rocblas_int lda, double* norms)
+{
+    return rocblas_dnrm2_strided_batched(handle, m, A, 1, lda, n, norms);
+}
+
+static rocblas_status gesvdr_nrm2(rocblas_handle         handle,
+                                  rocblas_int            m,
+                                  rocblas_int            n,
+                                  rocblas_float_complex* A,
+                                  rocblas_int            lda,
+                                  float*                 norms)
+{
+    return rocblas_scnrm2_strided_batched(handle, m, A, 1, lda, n, norms);
+}
+
+static rocblas_status gesvdr_nrm2(rocblas_handle          handle,
+                                  rocblas_int             m,
+                                  rocblas_int             n,
+                                  rocblas_double_complex* A,
+                                  rocblas_int             lda,
+                                  double*                 norms)
+{
+    return rocblas_dznrm2_strided_batched(handle, m, A, 1, lda, n, norms);
+}
+
+// Fills the host array x with samples of the standard normal distribution
+template <typename S>
+static void gesvdr_sketch(std::mt19937_64& gen, std::vector<S>& x)
+{
+    std::normal_distribution<S> dist;
+    for(S& v : x)
+        v = dist(gen);
+}
+
+template <typename S>
+static void gesvdr_sketch(std::mt19937_64& gen, std::vector<rocblas_complex_num<S>>& x)
+{
+    std::normal_distribution<S> dist;
+    for(auto& v : x)
+    {
+        S re = dist(gen);
+        S im = dist(gen);
+        v    = {re, im};
+    }
+}
+
+static hipsolverStatus_t gesvdr_argCheck(signed char jobu,
+                                         signed char jobv,
+                                         int64_t     m,
+                                         int64_t     n,
+                                         int64_t     k,
+                                         int64_t     p,
+                                         int64_t     niters,
+                                         int64_t     lda,
+                                         int64_t     ldu,
+                                         int64_t     ldv,
+                                         int64_t     batch_count)
+{
+    if((jobu != 'S' && jobu != 'N') || (jobv != 'S' && jobv != 'N'))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(m < 0 || n < 0 || k < 1 || p < 0 || k + p > std::min(m, n) || niters < 0
+       || lda < std::max(m, int64_t(1)) || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(jobu == 'S' && ldu < std::max(m, int64_t(1)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(jobv == 'S' && ldv < std::max(n, int64_t(1)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/* Layout of the extra device buffer of gesvdr, for a sketch of l = k + p columns. The sketch
+   is shared by all the problems of a batch; the other arrays are reused. */
+template <typename T, typename S>
+struct gesvdr_layout
+{
+    size_t Omega, Y, Z, XH, tau, sigma, E, size;
+
+    gesvdr_layout(rocblas_int m, rocblas_int n, rocblas_int l)
     {
+        Omega = 0;
+        Y     = Omega + aligned_size(sizeof(T) * n * l);
+        Z     = Y + aligned_size(sizeof(T) * m * l);
+        XH    = Z + aligned_size(sizeof(T) * n * l);
+        tau   = XH + aligned_size(sizeof(T) * l * l);
+        sigma = tau + aligned_size(sizeof(T) * l);
+        E     = sigma + aligned_size(sizeof(S) * l);
+        size  = E + sizeof(S) * l;
     }
 };
 
-hipsolverStatus_t hipsolverDnCreateParams(hipsolverDnParams_t* info)
+template <typename T, typename S>
+static hipsolverStatus_t gesvdr_bufferSize(rocblas_handle handle,
+                                           signed char    jobu,
+                                           signed char    jobv,
+                                           int64_t        m,
+                                           int64_t        n,
+                                           int64_t        k,
+                                           int64_t        p,
+                                           int64_t        niters,
+                                           int64_t        lda,
+                                           int64_t        ldu,
+                                           int64_t        ldv,
+                                           int64_t        batch_count,
+                                           size_t*        lwork)
+{
+    CHECK_HIPSOLVER_ERROR(
+        gesvdr_argCheck(jobu, jobv, m, n, k, p, niters, lda, ldu, ldv, batch_count));
+
+    rocblas_int m32 = to_rocblas_int(m);
+    rocblas_int n32 = to_rocblas_int(n);
+    rocblas_int l   = to_rocblas_int(k + p);
+    size_t      sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status[] = {
+        gesvdr_geqrf(handle, m32, l, (T*)nullptr, m32, (T*)nullptr),
+        gesvdr_orgqr(handle, m32, l, (T*)nullptr, m32, (T*)nullptr),
+        gesvdr_geqrf(handle, n32, l, (T*)nullptr, n32, (T*)nullptr),
+        gesvdr_orgqr(handle, n32, l, (T*)nullptr, n32, (T*)nullptr),
+        gesvdr_gesvd(handle, n32, l, (T*)nullptr, (S*)nullptr, (T*)nullptr, (S*)nullptr, nullptr),
+        gesvdr_nrm2(handle, m32, n32, (T*)nullptr, m32, (S*)nullptr),
+    };
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    for(rocblas_status st : status)
+    {
+        if(rocblas2hip_status(st) != HIPSOLVER_STATUS_SUCCESS)
+            return rocblas2hip_status(st);
+    }
+
+    *lwork = workspace_with_extra(handle, sz, gesvdr_layout<T, S>(m32, n32, l).size);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T, typename S>
+static hipsolverStatus_t gesvdr(rocblas_handle handle,
+                                signed char    jobu,
+                                signed char    jobv,
+                                int64_t        m,
+                                int64_t        n,
+                                int64_t        k,
+                                int64_t        p,
+                                int64_t        niters,
+                                void*          A,
+                                int64_t        lda,
+                                int64_t        strideA,
+                                void*          Sv,
+                                int64_t        strideS,
+                                void*          U,
+                                int64_t        ldu,
+                                int64_t        strideU,
+                                void*          V,
+                                int64_t        ldv,
+                                int64_t        strideV,
+                                void*          work,
+                                size_t         lwork,
+                                int*           info,
+                                double*        hRnrmF,
+                                int64_t        batch_count)
+{
+    CHECK_HIPSOLVER_ERROR(
+        gesvdr_argCheck(jobu, jobv, m, n, k, p, niters, lda, ldu, ldv, batch_count));
+    if(!A || !Sv || !info || (jobu == 'S' && !U) || (jobv == 'S' && !V))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    rocblas_int m32   = to_rocblas_int(m);
+    rocblas_int n32   = to_rocblas_int(n);
+    rocblas_int k32   = to_rocblas_int(k);
+    rocblas_int l     = to_rocblas_int(k + p);
+    rocblas_int lda32 = to_rocblas_int(lda);
+    rocblas_int ldu32 = jobu == 'S' ? to_rocblas_int(ldu) : 1;
+
+    gesvdr_layout<T, S> layout(m32, n32, l);
+
+    // the sketch is drawn on the host
+    CHECK_HIPSOLVER_ERROR(check_capture(handle, capture_step_synchronize));
+
+    rocblas_device_malloc mem(handle);
+    void*                 extra;
+    CHECK_HIPSOLVER_ERROR(prepare_workspace(handle, work, lwork, layout.size, mem, &extra));
+
+    T* Omega = (T*)((char*)extra + layout.Omega);
+    T* Y     = (T*)((char*)extra + layout.Y);
+    T* Z     = (T*)((char*)extra + layout.Z);
+    T* XH    = (T*)((char*)extra + layout.XH);
+    T* tau   = (T*)((char*)extra + layout.tau);
+    S* sigma = (S*)((char*)extra + layout.sigma);
+    S* E     = (S*)((char*)extra + layout.E);
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    // rocBLAS has no random number generator, so the sketch is drawn on the host with a fixed
+    // seed, which makes the results reproducible
+    std::mt19937_64 gen(0x5eed);
+    std::vector<T>  hOmega(size_t(n32) * l);
+    gesvdr_sketch(gen, hOmega);
+    CHECK_HIP_ERROR(hipMemcpyAsync(
+        Omega, hOmega.data(), sizeof(T) * hOmega.size(), hipMemcpyHostToDevice, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    const rocblas_operation none    = rocblas_operation_none;
+    const rocblas_operation adjoint = rocblas_operation_conjugate_transpose;
+
+    pointer_mode_host_scope scope(handle);
+    std::vector<S>          hnorms, hsigma;
+
+    for(int64_t b = 0; b < batch_count; b++)
+    {
+        T* Ab = (T*)A + b * strideA;
+
+        // Q = orth(A * Omega), refined by power iterations
+        CHECK_ROCBLAS_ERROR(
+            gesvdr_gemm(handle, none, none, m32, l, n32, Ab, lda32, Omega, n32, Y, m32));
+        CHECK_ROCBLAS_ERROR(gesvdr_orth(handle, m32, l, Y, m32, tau));
+        for(int64_t it = 0; it < niters; it++)
+        {
+            CHECK_ROCBLAS_ERROR(
+                gesvdr_gemm(handle, adjoint, none, n32, l, m32, Ab, lda32, Y, m32, Z, n32));
+            CHECK_ROCBLAS_ERROR(gesvdr_orth(handle, n32, l, Z, n32, tau));
+            CHECK_ROCBLAS_ERROR(
+                gesvdr_gemm(handle, none, none, m32, l, n32, Ab, lda32, Z, n32, Y, m32));
+            CHECK_ROCBLAS_ERROR(gesvdr_orth(handle, m32, l, Y, m32, tau));
+        }
+
+        // B^H = A^H * Q = W * Sigma * X^H, so that A ~ (Q * X) * Sigma * W^H
+        CHECK_ROCBLAS_ERROR(
+            gesvdr_gemm(handle, adjoint, none, n32, l, m32, Ab, lda32, Y, m32, Z, n32));
+        CHECK_ROCBLAS_ERROR(gesvdr_gesvd(handle, n32, l, Z, sigma, XH, E, info + b));
+
+        CHECK_HIP_ERROR(hipMemcpyAsync((S*)Sv + b * strideS,
+                                       sigma,
+                                       sizeof(S) * k32,
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+        if(jobu == 'S')
+        {
+            T* Ub = (T*)U + b * strideU;
+            CHECK_ROCBLAS_ERROR(
+                gesvdr_gemm(handle, none, adjoint, m32, k32, l, Y, m32, XH, l, Ub, ldu32));
+        }
+        if(jobv == 'S')
+        {
+            T* Vb = (T*)V + b * strideV;
+            CHECK_HIP_ERROR(hipMemcpy2DAsync(Vb,
+                                             sizeof(T) * ldv,
+                                             Z,
+                                             sizeof(T) * n32,
+                                             sizeof(T) * n32,
+                                             k32,
+                                             hipMemcpyDeviceToDevice,
+                                             stream));
+        }
+
+        /* Since Q has orthonormal columns, ||A - U * S * V^H||_F^2 = ||A||_F^2 - sum(S.^2).
+           The residual is therefore obtained from the norms of the columns of A without
+           forming it, but it cannot be resolved below about sqrt(eps) * ||A||_F. */
+        if(hRnrmF)
+        {
+            hnorms.resize(n32);
+            hsigma.resize(k32);
+            CHECK_ROCBLAS_ERROR(gesvdr_nrm2(handle, m32, n32, Ab, lda32, hnorms.data()));
+            CHECK_HIP_ERROR(hipMemcpyAsync(
+                hsigma.data(), sigma, sizeof(S) * k32, hipMemcpyDeviceToHost, stream));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+            double sq = 0;
+            for(S x : hnorms)
+                sq += double(x) * x;
+            for(S x : hsigma)
+                sq -= double(x) * x;
+            hRnrmF[b] = sqrt(std::max(sq, 0.0));
+        }
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** SYTRS ********************/
+template <typename T>
+static hipsolverStatus_t sytrs_64_bufferSize(rocblas_handle      handle,
+                                             hipsolverFillMode_t uplo,
+                                             int64_t             n,
+                                             int64_t             nrhs,
+                                             int64_t             lda,
+                                             int64_t             ldb,
+                                             size_t*             lwork)
+{
+    rocblas_int n32    = to_rocblas_int(n);
+    rocblas_int nrhs32 = to_rocblas_int(nrhs);
+    rocblas_int lda32  = to_rocblas_int(lda);
+    rocblas_int ldb32  = to_rocblas_int(ldb);
+    CHECK_HIPSOLVER_ERROR(sytrs_argCheck(uplo, n32, nrhs32, lda32, ldb32, 1));
+
+    size_t sz;
+    rocblas_start_device_memory_size_query(handle);
+    hipsolverStatus_t status
+        = rocblas2hip_status(sytrs_rocblas_size<T>(handle, uplo, n32, nrhs32, ldb32));
+    rocblas_stop_device_memory_size_query(handle, &sz);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *lwork = workspace_with_extra(handle, sz, sytrs_extra_size<T>(n32, nrhs32, 1));
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+static hipsolverStatus_t sytrs_64(rocblas_handle      handle,
+                                  hipsolverFillMode_t uplo,
+                                  int64_t             n,
+                                  int64_t             nrhs,
+                                  const void*         A,
+                                  int64_t             lda,
+                                  const int64_t*      ipiv,
+                                  void*               B,
+                                  int64_t             ldb,
+                                  void*               work,
+                                  size_t              lwork,
+                                  int*                info)
+{
+    rocblas_int n32    = to_rocblas_int(n);
+    rocblas_int nrhs32 = to_rocblas_int(nrhs);
+    rocblas_int lda32  = to_rocblas_int(lda);
+    rocblas_int ldb32  = to_rocblas_int(ldb);
+    CHECK_HIPSOLVER_ERROR(sytrs_argCheck(uplo, n32, nrhs32, lda32, ldb32, 1));
+    if((n32 && (!A || !ipiv)) || (n32 && nrhs32 && !B) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocblas_device_malloc mem(handle);
+    void*                 extra;
+    CHECK_HIPSOLVER_ERROR(prepare_workspace(
+        handle, work, lwork, sytrs_extra_size<T>(n32, nrhs32, 1), mem, &extra));
+
+    CHECK_ROCBLAS_ERROR(hipsolverZeroInfo(handle, info, 1));
+
+    return hipsolver::sytrs<T>(
+        handle, uplo, n32, nrhs32, {(T*)A}, lda32, ipiv, n32, {(T*)B}, ldb32, 1, extra);
+}
+
+/******************** TRTRI ********************/
+template <typename T>
+using trtri_t = rocblas_status (*)(
+    rocblas_handle, rocblas_fill, rocblas_diagonal, rocblas_int, T*, rocblas_int, rocblas_int*);
+
+template <typename T>
+static hipsolverStatus_t trtri_bufferSize(trtri_t<T>          solver,
+                                          rocblas_handle      handle,
+                                          hipsolverFillMode_t uplo,
+                                          hipsolverDiagType_t diag,
+                                          int64_t             n,
+                                          int64_t             lda,
+                                          size_t*             lwork)
+{
+    rocblas_fill     fill  = hip2rocblas_fill(uplo);
+    rocblas_diagonal dg    = hip2rocblas_diag(diag);
+    rocblas_int      n32   = to_rocblas_int(n);
+    rocblas_int      lda32 = to_rocblas_int(lda);
+
+    rocblas_start_device_memory_size_query(handle);
+    hipsolverStatus_t status
+        = rocblas2hip_status(solver(handle, fill, dg, n32, nullptr, lda32, nullptr));
+    rocblas_stop_device_memory_size_query(handle, lwork);
+
+    return status;
+}
+
+template <typename T>
+static hipsolverStatus_t trtri(trtri_t<T>          solver,
+                               rocblas_handle      handle,
+                               hipsolverFillMode_t uplo,
+                               hipsolverDiagType_t diag,
+                               int64_t             n,
+                               void*               A,
+                               int64_t             lda,
+                               void*               work,
+                               size_t              lwork,
+                               int*                info)
+{
+    rocblas_fill     fill  = hip2rocblas_fill(uplo);
+    rocblas_diagonal dg    = hip2rocblas_diag(diag);
+    rocblas_int      n32   = to_rocblas_int(n);
+    rocblas_int      lda32 = to_rocblas_int(lda);
+
+    if(work)
+        CHECK_ROCBLAS_ERROR(hipsolverSetUserWorkspace(handle, work, lwork));
+    else
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace(handle, lwork));
+
+    return rocblas2hip_status(solver(handle, fill, dg, n32, (T*)A, lda32, info));
+}
+
+/******************** ALGORITHM SELECTION ********************/
+/* HIPSOLVER_ALG_1 selects the unblocked rocSOLVER routines for getrf, potrf and geqrf, which need
+   less workspace than the blocked ones and skip their trailing updates. This pays off on narrow
+   matrices, whose panel is the whole factorization. getf2 and potf2 report info as a 64-bit
+   integer, which is kept in an extra device buffer and narrowed into the 32-bit info. */
+template <typename T>
+struct unblocked_routines;
+
+template <>
+struct unblocked_routines<float>
+{
+    static constexpr auto getf2      = rocsolver_sgetf2_64;
+    static constexpr auto getf2_npvt = rocsolver_sgetf2_npvt_64;
+    static constexpr auto potf2      = rocsolver_spotf2_64;
+    static constexpr auto geqr2      = rocsolver_sgeqr2_64;
+};
+
+template <>
+struct unblocked_routines<double>
+{
+    static constexpr auto getf2      = rocsolver_dgetf2_64;
+    static constexpr auto getf2_npvt = rocsolver_dgetf2_npvt_64;
+    static constexpr auto potf2      = rocsolver_dpotf2_64;
+    static constexpr auto geqr2      = rocsolver_dgeqr2_64;
+};
+
+template <>
+struct unblocked_routines<rocblas_float_complex>
+{
+    static constexpr auto getf2      = rocsolver_cgetf2_64;
+    static constexpr auto getf2_npvt = rocsolver_cgetf2_npvt_64;
+    static constexpr auto potf2      = rocsolver_cpotf2_64;
+    static constexpr auto geqr2      = rocsolver_cgeqr2_64;
+};
+
+template <>
+struct unblocked_routines<rocblas_double_complex>
+{
+    static constexpr auto getf2      = rocsolver_zgetf2_64;
+    static constexpr auto getf2_npvt = rocsolver_zgetf2_npvt_64;
+    static constexpr auto potf2      = rocsolver_zpotf2_64;
+    static constexpr auto geqr2      = rocsolver_zgeqr2_64;
+};
+
+/* Copies a 64-bit info computed on the device to the 32-bit info of the caller. The device is
+   little-endian, so the low-order half comes first; as with the info32 variants of rocSOLVER,
+   values that do not fit in an int are truncated. */
+static hipsolverStatus_t narrow_info(rocblas_handle handle, const void* info64, int* info)
+{
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    CHECK_HIP_ERROR(hipMemcpyAsync(info, info64, sizeof(int), hipMemcpyDeviceToDevice, stream));
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+static hipsolverStatus_t
+    getf2_bufferSize(rocblas_handle handle, int64_t m, int64_t n, int64_t lda, size_t* lwork)
+{
+    size_t sz;
+    rocblas_start_device_memory_size_query(handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        unblocked_routines<T>::getf2(handle, m, n, nullptr, lda, nullptr, nullptr));
+    unblocked_routines<T>::getf2_npvt(handle, m, n, nullptr, lda, nullptr);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = workspace_with_extra(handle, sz, sizeof(int64_t));
+    return status;
+}
+
+template <typename T>
+static hipsolverStatus_t getf2(rocblas_handle handle,
+                               int64_t        m,
+                               int64_t        n,
+                               void*          A,
+                               int64_t        lda,
+                               int64_t*       ipiv,
+                               void*          work,
+                               size_t         lwork,
+                               int*           info)
+{
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocblas_device_malloc mem(handle);
+    void*                 info64;
+    CHECK_HIPSOLVER_ERROR(prepare_workspace(handle, work, lwork, sizeof(int64_t), mem, &info64));
+
+    if(ipiv)
+        CHECK_ROCBLAS_ERROR(
+            unblocked_routines<T>::getf2(handle, m, n, (T*)A, lda, ipiv, (int64_t*)info64));
+    else
+        CHECK_ROCBLAS_ERROR(
+            unblocked_routines<T>::getf2_npvt(handle, m, n, (T*)A, lda, (int64_t*)info64));
+
+    return narrow_info(handle, info64, info);
+}
+
+template <typename T>
+static hipsolverStatus_t potf2_bufferSize(
+    rocblas_handle handle, hipsolverFillMode_t uplo, int64_t n, int64_t lda, size_t* lwork)
+{
+    size_t sz;
+    rocblas_start_device_memory_size_query(handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        unblocked_routines<T>::potf2(handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = workspace_with_extra(handle, sz, sizeof(int64_t));
+    return status;
+}
+
+template <typename T>
+static hipsolverStatus_t potf2(rocblas_handle      handle,
+                               hipsolverFillMode_t uplo,
+                               int64_t             n,
+                               void*               A,
+                               int64_t             lda,
+                               void*               work,
+                               size_t              lwork,
+                               int*                info)
+{
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocblas_device_malloc mem(handle);
+    void*                 info64;
+    CHECK_HIPSOLVER_ERROR(prepare_workspace(handle, work, lwork, sizeof(int64_t), mem, &info64));
+
+    CHECK_ROCBLAS_ERROR(unblocked_routines<T>::potf2(
+        handle, hip2rocblas_fill(uplo), n, (T*)A, lda, (int64_t*)info64));
+
+    return narrow_info(handle, info64, info);
+}
+
+template <typename T>
+static hipsolverStatus_t
+    geqr2_bufferSize(rocblas_handle handle, int64_t m, int64_t n, int64_t lda, size_t* lwork)
+{
+    rocblas_start_device_memory_size_query(handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        unblocked_routines<T>::geqr2(handle, m, n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query(handle, lwork);
+
+    return status;
+}
+
+template <typename T>
+static hipsolverStatus_t geqr2(rocblas_handle handle,
+                               int64_t        m,
+                               int64_t        n,
+                               void*          A,
+                               int64_t        lda,
+                               void*          tau,
+                               void*          work,
+                               size_t         lwork,
+                               int*           info)
+{
+    if(work)
+        CHECK_ROCBLAS_ERROR(hipsolverSetUserWorkspace(handle, work, lwork));
+    else
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace(handle, lwork));
+
+    CHECK_ROCBLAS_ERROR(hipsolverZeroInfo(handle, info, 1));
+
+    return rocblas2hip_status(unblocked_routines<T>::geqr2(handle, m, n, (T*)A, lda, (T*)tau));
+}
+
+/******************** SYEV AUTO ********************/
+/* syevAuto runs the algorithm chosen for the problem by choose_syev_algorithm. syevd and syevj
+   compute the whole spectrum of the batch in a single call, so when only eigenvalues il to iu
+   are wanted they are computed into an extra buffer, and the wanted eigenvalues and eigenvectors
+   are then moved to the front. rocSOLVER has no batched syevdx, which therefore runs one matrix
+   at a time. */
+template <typename T>
+struct syev_auto_routines;
+
+template <>
+struct syev_auto_routines<float>
+{
+    static constexpr auto syevd  = rocsolver_ssyevd_strided_batched;
+    static constexpr auto syevj  = rocsolver_ssyevj_strided_batched;
+    static constexpr auto syevdx = rocsolver_ssyevdx_inplace;
+};
+
+template <>
+struct syev_auto_routines<double>
+{
+    static constexpr auto syevd  = rocsolver_dsyevd_strided_batched;
+    static constexpr auto syevj  = rocsolver_dsyevj_strided_batched;
+    static constexpr auto syevdx = rocsolver_dsyevdx_inplace;
+};
+
+template <>
+struct syev_auto_routines<rocblas_float_complex>
+{
+    static constexpr auto syevd  = rocsolver_cheevd_strided_batched;
+    static constexpr auto syevj  = rocsolver_cheevj_strided_batched;
+    static constexpr auto syevdx = rocsolver_cheevdx_inplace;
+};
+
+template <>
+struct syev_auto_routines<rocblas_double_complex>
+{
+    static constexpr auto syevd  = rocsolver_zheevd_strided_batched;
+    static constexpr auto syevj  = rocsolver_zheevj_strided_batched;
+    static constexpr auto syevdx = rocsolver_zheevdx_inplace;
+};
+
+// Same limit as the default of hipsolverSyevjInfo_t
+static constexpr rocblas_int syevAuto_max_sweeps = 100;
+
+/* Checks the arguments of syevAuto. A range of values is not supported, as the number of
+   eigenvalues it holds is not known before they are computed. */
+static hipsolverStatus_t syevAuto_argCheck(hipsolverEigMode_t  jobz,
+                                           hipsolverEigRange_t range,
+                                           hipsolverFillMode_t uplo,
+                                           int64_t             n,
+                                           int64_t             lda,
+                                           int64_t             il,
+                                           int64_t             iu,
+                                           int64_t             batch_count)
+{
+    hip2rocblas_evect(jobz);
+    hip2rocblas_erange(range);
+    hip2rocblas_fill(uplo);
+
+    if(range == HIPSOLVER_EIG_RANGE_V)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    if(n < 0 || lda < std::max(n, int64_t(1)) || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(range == HIPSOLVER_EIG_RANGE_I && n > 0 && (il < 1 || iu < il || iu > n))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// Algorithm used by syevAuto, from the fraction of the spectrum that is wanted
+static hipsolverSyevAlgorithm_t syevAuto_algorithm(rocblas_handle      handle,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverEigRange_t range,
+                                                   int64_t             n,
+                                                   int64_t             il,
+                                                   int64_t             iu,
+                                                   int64_t             batch_count)
+{
+    double fraction = 1;
+    if(range == HIPSOLVER_EIG_RANGE_I && n > 0)
+        fraction = double(iu - il + 1) / n;
+
+    return choose_syev_algorithm(
+        handle, jobz == HIPSOLVER_EIG_MODE_VECTOR, n, batch_count, fraction);
+}
+
+/* Layout of the extra device buffer of syevAuto: the off-diagonal of the tridiagonal form for
+   syevd, the residuals and sweep counts for syevj, and the whole spectrum when only part of it
+   is wanted. */
+template <typename S>
+struct syevAuto_layout
+{
+    size_t E, W, residual, sweeps, size;
+
+    syevAuto_layout(hipsolverSyevAlgorithm_t alg, rocblas_int n, rocblas_int bc, bool select)
+    {
+        bool syevd = alg == HIPSOLVER_SYEV_ALG_SYEVD;
+        bool syevj = alg == HIPSOLVER_SYEV_ALG_SYEVJ;
+
+        E        = 0;
+        W        = E + aligned_size(syevd ? sizeof(S) * n * bc : 0);
+        residual = W + aligned_size(select && (syevd || syevj) ? sizeof(S) * n * bc : 0);
+        sweeps   = residual + aligned_size(syevj ? sizeof(S) * bc : 0);
+        size     = sweeps + (syevj ? sizeof(rocblas_int) * bc : 0);
+    }
+};
+
+// Whether eigenvalues il to iu are wanted but not all of them
+static bool syevAuto_select(hipsolverEigRange_t range, int64_t n, int64_t il, int64_t iu)
+{
+    return range == HIPSOLVER_EIG_RANGE_I && n > 0 && (il > 1 || iu < n);
+}
+
+template <typename T, typename S>
+static hipsolverStatus_t syevAuto_bufferSize(rocblas_handle           handle,
+                                             hipsolverSyevAlgorithm_t alg,
+                                             hipsolverEigMode_t       jobz,
+                                             hipsolverEigRange_t      range,
+                                             hipsolverFillMode_t      uplo,
+                                             int64_t                  n,
+                                             int64_t                  lda,
+                                             int64_t                  strideA,
+                                             int64_t                  il,
+                                             int64_t                  iu,
+                                             int64_t                  batch_count,
+                                             size_t*                  lwork)
+{
+    CHECK_HIPSOLVER_ERROR(syevAuto_argCheck(jobz, range, uplo, n, lda, il, iu, batch_count));
+    if(range == HIPSOLVER_EIG_RANGE_ALL)
+    {
+        il = 1;
+        iu = n;
+    }
+
+    rocblas_evect  evect  = hip2rocblas_evect(jobz);
+    rocblas_erange erange = hip2rocblas_erange(range);
+    rocblas_fill   fill   = hip2rocblas_fill(uplo);
+    rocblas_int    n32    = to_rocblas_int(n);
+    rocblas_int    lda32  = to_rocblas_int(lda);
+    rocblas_int    il32   = to_rocblas_int(il);
+    rocblas_int    iu32   = to_rocblas_int(iu);
+    rocblas_int    bc32   = to_rocblas_int(batch_count);
+    size_t         sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status;
+    if(alg == HIPSOLVER_SYEV_ALG_SYEVD)
+        status = syev_auto_routines<T>::syevd(handle,
+                                              evect,
+                                              fill,
+                                              n32,
+                                              nullptr,
+                                              lda32,
+                                              strideA,
+                                              nullptr,
+                                              n32,
+                                              nullptr,
+                                              n32,
+                                              nullptr,
+                                              bc32);
+    else if(alg == HIPSOLVER_SYEV_ALG_SYEVJ)
+        status = syev_auto_routines<T>::syevj(handle,
+                                              rocblas_esort_ascending,
+                                              evect,
+                                              fill,
+                                              n32,
+                                              nullptr,
+                                              lda32,
+                                              strideA,
+                                              S(0),
+                                              nullptr,
+                                              syevAuto_max_sweeps,
+                                              nullptr,
+                                              nullptr,
+                                              n32,
+                                              nullptr,
+                                              bc32);
+    else
+        status = syev_auto_routines<T>::syevdx(handle,
+                                               evect,
+                                               erange,
+                                               fill,
+                                               n32,
+                                               nullptr,
+                                               lda32,
+                                               S(0),
+                                               S(0),
+                                               il32,
+                                               iu32,
+                                               S(0),
+                                               nullptr,
+                                               nullptr,
+                                               nullptr);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    if(rocblas2hip_status(status) != HIPSOLVER_STATUS_SUCCESS)
+        return rocblas2hip_status(status);
+
+    bool select = syevAuto_select(range, n, il, iu);
+    *lwork      = workspace_with_extra(handle, sz, syevAuto_layout<S>(alg, n32, bc32, select).size);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/* Moves eigenvalues il to iu of each problem, and their eigenvectors, to the front of W and A.
+   The columns are moved in increasing order, so that none is overwritten before it is moved. */
+template <typename T, typename S>
+static hipsolverStatus_t syevAuto_gather(rocblas_handle     handle,
+                                         hipsolverEigMode_t jobz,
+                                         rocblas_int        n,
+                                         T*                 A,
+                                         rocblas_int        lda,
+                                         int64_t            strideA,
+                                         rocblas_int        il,
+                                         rocblas_int        iu,
+                                         const S*           Wfull,
+                                         S*                 W,
+                                         int64_t            strideW,
+                                         rocblas_int        bc)
+{
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    // a single problem may be given a zero stride, which is not a valid pitch
+    rocblas_int nev    = iu - il + 1;
+    size_t      pitchW = sizeof(S) * (bc > 1 ? strideW : nev);
+    size_t      pitchA = sizeof(T) * (bc > 1 ? strideA : int64_t(lda) * n);
+
+    CHECK_HIP_ERROR(hipMemcpy2DAsync(W,
+                                     pitchW,
+                                     Wfull + (il - 1),
+                                     sizeof(S) * n,
+                                     sizeof(S) * nev,
+                                     bc,
+                                     hipMemcpyDeviceToDevice,
+                                     stream));
+
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR && il > 1)
+    {
+        for(rocblas_int k = 0; k < nev; k++)
+            CHECK_HIP_ERROR(hipMemcpy2DAsync(A + int64_t(lda) * k,
+                                             pitchA,
+                                             A + int64_t(lda) * (il - 1 + k),
+                                             pitchA,
+                                             sizeof(T) * n,
+                                             bc,
+                                             hipMemcpyDeviceToDevice,
+                                             stream));
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T, typename S>
+static hipsolverStatus_t syevAuto(rocblas_handle           handle,
+                                  hipsolverSyevAlgorithm_t alg,
+                                  hipsolverEigMode_t       jobz,
+                                  hipsolverEigRange_t      range,
+                                  hipsolverFillMode_t      uplo,
+                                  int64_t                  n,
+                                  void*                    A,
+                                  int64_t                  lda,
+                                  int64_t                  strideA,
+                                  int64_t                  il,
+                                  int64_t                  iu,
+                                  void*                    W,
+                                  int64_t                  strideW,
+                                  void*                    work,
+                                  size_t                   lwork,
+                                  int*                     info,
+                                  int64_t                  batch_count)
+{
+    CHECK_HIPSOLVER_ERROR(syevAuto_argCheck(jobz, range, uplo, n, lda, il, iu, batch_count));
+    if(batch_count > 0 && ((n > 0 && (!A || !W)) || !info))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+    if(range == HIPSOLVER_EIG_RANGE_ALL)
+    {
+        il = 1;
+        iu = n;
+    }
+
+    rocblas_evect  evect  = hip2rocblas_evect(jobz);
+    rocblas_erange erange = hip2rocblas_erange(range);
+    rocblas_fill   fill   = hip2rocblas_fill(uplo);
+    rocblas_int    n32    = to_rocblas_int(n);
+    rocblas_int    lda32  = to_rocblas_int(lda);
+    rocblas_int    il32   = to_rocblas_int(il);
+    rocblas_int    iu32   = to_rocblas_int(iu);
+    rocblas_int    bc32   = to_rocblas_int(batch_count);
+    bool           select = syevAuto_select(range, n, il, iu);
+
+    syevAuto_layout<S> layout(alg, n32, bc32, select);
+
+    rocblas_device_malloc mem(handle);
+    void*                 extra;
+    CHECK_HIPSOLVER_ERROR(prepare_workspace(handle, work, lwork, layout.size, mem, &extra));
+
+    if(alg == HIPSOLVER_SYEV_ALG_SYEVDX)
+    {
+        // the number of eigenvalues is known in advance, so the one returned is not needed
+        rocblas_int nev;
+        for(int64_t b = 0; b < batch_count; b++)
+            CHECK_ROCBLAS_ERROR(syev_auto_routines<T>::syevdx(handle,
+                                                              evect,
+                                                              erange,
+                                                              fill,
+                                                              n32,
+                                                              (T*)A + b * strideA,
+                                                              lda32,
+                                                              S(0),
+                                                              S(0),
+                                                              il32,
+                                                              iu32,
+                                                              S(0),
+                                                              &nev,
+                                                              (S*)W + b * strideW,
+                                                              info + b));
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    S*           E           = (S*)((char*)extra + layout.E);
+    S*           residual    = (S*)((char*)extra + layout.residual);
+    rocblas_int* sweeps      = (rocblas_int*)((char*)extra + layout.sweeps);
+    S*           Wfull       = select ? (S*)((char*)extra + layout.W) : (S*)W;
+    int64_t      strideWfull = select ? n32 : strideW;
+
+    if(alg == HIPSOLVER_SYEV_ALG_SYEVD)
+        CHECK_ROCBLAS_ERROR(syev_auto_routines<T>::syevd(handle,
+                                                         evect,
+                                                         fill,
+                                                         n32,
+                                                         (T*)A,
+                                                         lda32,
+                                                         strideA,
+                                                         Wfull,
+                                                         strideWfull,
+                                                         E,
+                                                         n32,
+                                                         info,
+                                                         bc32));
+    else
+        CHECK_ROCBLAS_ERROR(syev_auto_routines<T>::syevj(handle,
+                                                         rocblas_esort_ascending,
+                                                         evect,
+                                                         fill,
+                                                         n32,
+                                                         (T*)A,
+                                                         lda32,
+                                                         strideA,
+                                                         S(0),
+                                                         residual,
+                                                         syevAuto_max_sweeps,
+                                                         sweeps,
+                                                         Wfull,
+                                                         strideWfull,
+                                                         info,
+                                                         bc32));
+
+    if(select)
+        return syevAuto_gather(
+            handle, jobz, n32, (T*)A, lda32, strideA, il32, iu32, Wfull, (S*)W, strideW, bc32);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** OUT-OF-CORE ********************/
+/* The out-of-core factorizations run the schedule of tiled_factorization.hpp on three queues:
+   the stream of the handle computes, and two streams created for the call copy block columns
+   to and from the host matrix. A task waits for tasks of other streams through events, and the
+   tasks of the host run on the calling thread once the events they depend on have completed.
+   The host matrix is pinned for the duration of the call if it is not already, so that the
+   copies overlap the computation. */
+template <typename T>
+struct tiled_routines;
+
+template <>
+struct tiled_routines<float>
+{
+    using S = float;
+
+    static constexpr rocblas_operation conj  = rocblas_operation_transpose;
+    static constexpr auto              potrf = rocsolver_spotrf;
+    static constexpr auto              getrf = rocsolver_sgetrf;
+    static constexpr auto              laswp = rocsolver_slaswp;
+    static constexpr auto              trsm  = rocblas_strsm;
+    static constexpr auto              gemm  = rocblas_sgemm;
+    static constexpr auto              herk  = rocblas_ssyrk;
+};
+
+template <>
+struct tiled_routines<double>
+{
+    using S = double;
+
+    static constexpr rocblas_operation conj  = rocblas_operation_transpose;
+    static constexpr auto              potrf = rocsolver_dpotrf;
+    static constexpr auto              getrf = rocsolver_dgetrf;
+    static constexpr auto              laswp = rocsolver_dlaswp;
+    static constexpr auto              trsm  = rocblas_dtrsm;
+    static constexpr auto              gemm  = rocblas_dgemm;
+    static constexpr auto              herk  = rocblas_dsyrk;
+};
+
+template <>
+struct tiled_routines<rocblas_float_complex>
+{
+    using S = float;
+
+    static constexpr rocblas_operation conj  = rocblas_operation_conjugate_transpose;
+    static constexpr auto              potrf = rocsolver_cpotrf;
+    static constexpr auto              getrf = rocsolver_cgetrf;
+    static constexpr auto              laswp = rocsolver_claswp;
+    static constexpr auto              trsm  = rocblas_ctrsm;
+    static constexpr auto              gemm  = rocblas_cgemm;
+    static constexpr auto              herk  = rocblas_cherk;
+};
+
+template <>
+struct tiled_routines<rocblas_double_complex>
+{
+    using S = double;
+
+    static constexpr rocblas_operation conj  = rocblas_operation_conjugate_transpose;
+    static constexpr auto              potrf = rocsolver_zpotrf;
+    static constexpr auto              getrf = rocsolver_zgetrf;
+    static constexpr auto              laswp = rocsolver_zlaswp;
+    static constexpr auto              trsm  = rocblas_ztrsm;
+    static constexpr auto              gemm  = rocblas_zgemm;
+    static constexpr auto              herk  = rocblas_zherk;
+};
+
+// Size of the device buffers, pivots and info of a schedule, in bytes
+static size_t tiled_extra_size(const tile_schedule& s, size_t elem_size)
+{
+    int64_t pivots       = std::max(std::min(s.m, s.n), int64_t(1));
+    size_t  size_buffers = aligned_size(elem_size * s.buffer_elements());
+    size_t  size_ipiv    = aligned_size(sizeof(rocblas_int) * pivots);
+    size_t  size_info    = sizeof(rocblas_int) * std::max(s.factored(), int64_t(1));
+    return size_buffers + size_ipiv + size_info;
+}
+
+/* Checks the arguments of an out-of-core factorization and returns its schedule. A tile size of
+   0 takes the default for the memory budget of the handle. */
+static hipsolverStatus_t tiled_plan(rocblas_handle      handle,
+                                    bool                lu,
+                                    hipsolverFillMode_t uplo,
+                                    int64_t             m,
+                                    int64_t             n,
+                                    int64_t             lda,
+                                    int64_t             tileSize,
+                                    size_t              elem_size,
+                                    tile_schedule*      s)
+{
+    if(!lu)
+        hip2rocblas_fill(uplo);
+    if(m < 0 || n < 0 || lda < std::max(m, int64_t(1)) || tileSize < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    to_rocblas_int(m);
+    to_rocblas_int(n);
+
+    int64_t nb = tileSize;
+    if(nb == 0)
+    {
+        handle_data_lock data(handle);
+        nb = tile_schedule::default_tile_size(m, n, elem_size, data->budget.limit);
+    }
+    nb = std::max(std::min(nb, n), int64_t(1));
+
+    *s = lu ? tile_schedule::getrf(m, n, nb) : tile_schedule::cholesky(n, nb);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/* Workspace of rocBLAS and rocSOLVER needed by the tasks of a schedule. Must be called between
+   rocblas_start_device_memory_size_query and rocblas_stop_device_memory_size_query. */
+template <typename T>
+static hipsolverStatus_t
+    tiled_rocblas_size(rocblas_handle handle, const tile_schedule& s, rocblas_fill fill)
+{
+    using R = tiled_routines<T>;
+
+    rocblas_int m32  = to_rocblas_int(s.m);
+    rocblas_int nb32 = to_rocblas_int(s.width(0));
+    rocblas_int ld32 = to_rocblas_int(s.ld());
+    if(s.lu)
+    {
+        CHECK_HIPSOLVER_ERROR(
+            rocblas2hip_status(R::getrf(handle, m32, nb32, nullptr, ld32, nullptr, nullptr)));
+        return rocblas2hip_status(R::trsm(handle,
+                                          rocblas_side_left,
+                                          rocblas_fill_lower,
+                                          rocblas_operation_none,
+                                          rocblas_diagonal_unit,
+                                          nb32,
+                                          nb32,
+                                          nullptr,
+                                          nullptr,
+                                          ld32,
+                                          nullptr,
+                                          ld32));
+    }
+
+    bool        upper = fill == rocblas_fill_upper;
+    rocblas_int ldd32 = upper ? nb32 : ld32;
+    CHECK_HIPSOLVER_ERROR(
+        rocblas2hip_status(R::potrf(handle, fill, nb32, nullptr, ldd32, nullptr)));
+    return rocblas2hip_status(R::trsm(handle,
+                                      upper ? rocblas_side_left : rocblas_side_right,
+                                      fill,
+                                      R::conj,
+                                      rocblas_diagonal_non_unit,
+                                      upper ? nb32 : m32,
+                                      upper ? m32 : nb32,
+                                      nullptr,
+                                      nullptr,
+                                      ldd32,
+                                      nullptr,
+                                      ldd32));
+}
+
+/*! \brief Runs the schedule of an out-of-core factorization of the host matrix A.
+
+    The device buffers of the schedule hold block columns of the lower triangle, or of A for
+    LU, with leading dimension s.ld(). For the upper triangle they hold the block rows that
+    are the transpose of those block columns, with leading dimension s.nb, so that every copy
+    is a plain two-dimensional copy of a block of A. */
+template <typename T>
+class tiled_executor
+{
+public:
+    tiled_executor(rocblas_handle       handle,
+                   const tile_schedule& s,
+                   bool                 upper,
+                   T*                   A,
+                   int64_t              lda,
+                   int64_t*             ipiv,
+                   void*                extra)
+        : handle(handle)
+        , s(s)
+        , upper(upper)
+        , A(A)
+        , lda(lda)
+        , ipiv(ipiv)
+        , events(s.tasks.size(), nullptr)
+        , hipiv(std::max(std::min(s.m, s.n), int64_t(1)))
+    {
+        const int buffers = tile_schedule::panel_buffers + tile_schedule::stream_buffers;
+        size_t    elems   = s.buffer_elements() / buffers;
+        for(int i = 0; i < tile_schedule::panel_buffers; i++)
+            panel[i] = (T*)extra + i * elems;
+        for(int i = 0; i < tile_schedule::stream_buffers; i++)
+            stream[i] = (T*)extra + (tile_schedule::panel_buffers + i) * elems;
+
+        char* ptr = (char*)extra + aligned_size(sizeof(T) * s.buffer_elements());
+        dipiv     = (rocblas_int*)ptr;
+        dinfo     = (rocblas_int*)(ptr + aligned_size(sizeof(rocblas_int) * hipiv.size()));
+    }
+
+    ~tiled_executor()
+    {
+        for(hipStream_t q : queues)
+        {
+            if(q)
+                (void)hipStreamSynchronize(q);
+        }
+        for(hipEvent_t e : events)
+        {
+            if(e)
+                (void)hipEventDestroy(e);
+        }
+        for(int q : {tile_queue_load, tile_queue_store})
+        {
+            if(queues[q])
+                (void)hipStreamDestroy(queues[q]);
+        }
+        if(registered)
+            (void)hipHostUnregister(A);
+    }
+
+    hipsolverStatus_t run(int* info)
+    {
+        CHECK_HIPSOLVER_ERROR(setup());
+
+        std::vector<char> waited(s.tasks.size(), 0);
+        for(const tile_task& t : s.tasks)
+            for(int d : t.deps)
+                waited[d] |= s.tasks[d].queue() != t.queue();
+
+        for(size_t i = 0; i < s.tasks.size(); i++)
+        {
+            const tile_task& t = s.tasks[i];
+            tile_queue       q = t.queue();
+
+            // events are only recorded on the device; host tasks run in order
+            if(q == tile_queue_host)
+            {
+                for(int d : t.deps)
+                    if(events[d])
+                        CHECK_HIP_ERROR(hipEventSynchronize(events[d]));
+                run_host(t);
+                continue;
+            }
+
+            for(int d : t.deps)
+                if(events[d] && s.tasks[d].queue() != q)
+                    CHECK_HIP_ERROR(hipStreamWaitEvent(queues[q], events[d], 0));
+            CHECK_HIPSOLVER_ERROR(run_device(t, queues[q]));
+
+            if(waited[i])
+            {
+                CHECK_HIP_ERROR(hipEventCreateWithFlags(&events[i], hipEventDisableTiming));
+                CHECK_HIP_ERROR(hipEventRecord(events[i], queues[q]));
+            }
+        }
+
+        std::vector<rocblas_int> hinfo(s.factored());
+        hipStream_t              compute = queues[tile_queue_compute];
+        CHECK_HIP_ERROR(hipMemcpyAsync(hinfo.data(),
+                                       dinfo,
+                                       sizeof(rocblas_int) * hinfo.size(),
+                                       hipMemcpyDeviceToHost,
+                                       compute));
+        for(hipStream_t q : queues)
+            CHECK_HIP_ERROR(hipStreamSynchronize(q));
+
+        *info = 0;
+        for(size_t j = 0; j < hinfo.size(); j++)
+        {
+            if(hinfo[j] > 0)
+            {
+                *info = int(hinfo[j] + j * s.nb);
+                break;
+            }
+        }
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+private:
+    rocblas_handle       handle;
+    const tile_schedule& s;
+    bool                 upper;
+    T*                   A;
+    int64_t              lda;
+    int64_t*             ipiv;
+    bool                 registered = false;
+
+    hipStream_t             queues[tile_queue_host] = {};
+    std::vector<hipEvent_t> events;
+
+    T*                       panel[tile_schedule::panel_buffers];
+    T*                       stream[tile_schedule::stream_buffers];
+    rocblas_int*             dipiv;
+    rocblas_int*             dinfo;
+    std::vector<rocblas_int> hipiv;
+
+    hipsolverStatus_t setup()
+    {
+        // copies from pageable memory are staged and do not overlap the computation
+        hipPointerAttribute_t attr;
+        bool                  pinned = hipPointerGetAttributes(&attr, A) == hipSuccess
+                      && attr.type == hipMemoryTypeHost;
+        if(!pinned)
+        {
+            (void)hipGetLastError();
+            size_t size = sizeof(T) * (lda * (s.n - 1) + s.m);
+            registered  = hipHostRegister(A, size, hipHostRegisterDefault) == hipSuccess;
+            if(!registered)
+                (void)hipGetLastError();
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &queues[tile_queue_compute]));
+        for(int q : {tile_queue_load, tile_queue_store})
+            CHECK_HIP_ERROR(hipStreamCreateWithFlags(&queues[q], hipStreamNonBlocking));
+
+        // the copies start after the work already submitted to the stream of the handle
+        hipEvent_t start;
+        CHECK_HIP_ERROR(hipEventCreateWithFlags(&start, hipEventDisableTiming));
+        hipError_t err = hipEventRecord(start, queues[tile_queue_compute]);
+        for(int q : {tile_queue_load, tile_queue_store})
+        {
+            if(err == hipSuccess)
+                err = hipStreamWaitEvent(queues[q], start, 0);
+        }
+        (void)hipEventDestroy(start);
+        CHECK_HIP_ERROR(err);
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // Copies the block of rows and cols of the lower triangle at (row, col) to or from buf
+    hipsolverStatus_t copy(T*            buf,
+                           int64_t       row,
+                           int64_t       col,
+                           int64_t       rows,
+                           int64_t       cols,
+                           hipMemcpyKind kind,
+                           hipStream_t   q)
+    {
+        if(upper)
+        {
+            std::swap(row, col);
+            std::swap(rows, cols);
+        }
+
+        T*     host  = A + row + col * lda;
+        size_t ldd   = sizeof(T) * (upper ? s.nb : s.ld());
+        size_t ldh   = sizeof(T) * lda;
+        size_t width = sizeof(T) * rows;
+        if(kind == hipMemcpyHostToDevice)
+            CHECK_HIP_ERROR(hipMemcpy2DAsync(buf, ldd, host, ldh, width, cols, kind, q));
+        else
+            CHECK_HIP_ERROR(hipMemcpy2DAsync(host, ldh, buf, ldd, width, cols, kind, q));
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // Block column k as loaded to update panel j
+    T* source(const tile_task& t) const
+    {
+        if(t.stream >= 0)
+            return stream[t.stream];
+
+        int64_t offset = s.block_row(t.j, t.k) - s.panel_row(t.k);
+        return panel[t.k % tile_schedule::panel_buffers] + offset * (upper ? s.nb : 1);
+    }
+
+    hipsolverStatus_t run_device(const tile_task& t, hipStream_t q)
+    {
+        T*      P   = panel[t.j % tile_schedule::panel_buffers];
+        int64_t row = s.panel_row(t.j);
+        switch(t.op)
+        {
+        case tile_op_load_panel:
+            return copy(P, row, t.j * s.nb, s.m - row, s.width(t.j), hipMemcpyHostToDevice, q);
+        case tile_op_load_block:
+            row = s.block_row(t.j, t.k);
+            return copy(stream[t.stream],
+                        row,
+                        t.k * s.nb,
+                        s.m - row,
+                        s.width(t.k),
+                        hipMemcpyHostToDevice,
+                        q);
+        case tile_op_store_panel:
+            return copy(P, row, t.j * s.nb, s.m - row, s.width(t.j), hipMemcpyDeviceToHost, q);
+        case tile_op_store_pivots:
+            CHECK_HIP_ERROR(hipMemcpyAsync(hipiv.data() + t.j * s.nb,
+                                           dipiv + t.j * s.nb,
+                                           sizeof(rocblas_int) * s.pivots(t.j),
+                                           hipMemcpyDeviceToHost,
+                                           q));
+            return HIPSOLVER_STATUS_SUCCESS;
+        case tile_op_update:
+            return s.lu ? update_lu(t, P) : update_cholesky(t, P);
+        case tile_op_factor:
+            return s.lu ? factor_lu(t, P) : factor_cholesky(t, P);
+        default:
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    // P -= B * B(0:w, :)**H, where B holds rows j * nb to n of block column k
+    hipsolverStatus_t update_cholesky(const tile_task& t, T* P)
+    {
+        using R = tiled_routines<T>;
+
+        const typename R::S minus_one = -1, one = 1;
+        const T             tminus_one = T(-1), tone = T(1);
+
+        T*          B   = source(t);
+        rocblas_int h   = rocblas_int(s.n - t.j * s.nb);
+        rocblas_int w   = rocblas_int(s.width(t.j));
+        rocblas_int wk  = rocblas_int(s.width(t.k));
+        rocblas_int ldd = rocblas_int(upper ? s.nb : s.ld());
+        if(upper)
+        {
+            CHECK_ROCBLAS_ERROR(R::herk(
+                handle, rocblas_fill_upper, R::conj, w, wk, &minus_one, B, ldd, &one, P, ldd));
+            if(h > w)
+                CHECK_ROCBLAS_ERROR(R::gemm(handle,
+                                            R::conj,
+                                            rocblas_operation_none,
+                                            w,
+                                            h - w,
+                                            wk,
+                                            &tminus_one,
+                                            B,
+                                            ldd,
+                                            B + w * ldd,
+                                            ldd,
+                                            &tone,
+                                            P + w * ldd,
+                                            ldd));
+        }
+        else
+        {
+            CHECK_ROCBLAS_ERROR(R::herk(handle,
+                                        rocblas_fill_lower,
+                                        rocblas_operation_none,
+                                        w,
+                                        wk,
+                                        &minus_one,
+                                        B,
+                                        ldd,
+                                        &one,
+                                        P,
+                                        ldd));
+            if(h > w)
+                CHECK_ROCBLAS_ERROR(R::gemm(handle,
+                                            rocblas_operation_none,
+                                            R::conj,
+                                            h - w,
+                                            w,
+                                            wk,
+                                            &tminus_one,
+                                            B + w,
+                                            ldd,
+                                            B,
+                                            ldd,
+                                            &tone,
+                                            P + w,
+                                            ldd));
+        }
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipsolverStatus_t factor_cholesky(const tile_task& t, T* P)
+    {
+        using R = tiled_routines<T>;
+
+        const T one = T(1);
+
+        rocblas_int h   = rocblas_int(s.n - t.j * s.nb);
+        rocblas_int w   = rocblas_int(s.width(t.j));
+        rocblas_int ldd = rocblas_int(upper ? s.nb : s.ld());
+        rocblas_fill fill = upper ? rocblas_fill_upper : rocblas_fill_lower;
+        CHECK_ROCBLAS_ERROR(R::potrf(handle, fill, w, P, ldd, dinfo + t.j));
+        if(h > w)
+            CHECK_ROCBLAS_ERROR(R::trsm(handle,
+                                        upper ? rocblas_side_left : rocblas_side_right,
+                                        fill,
+                                        R::conj,
+                                        rocblas_diagonal_non_unit,
+                                        upper ? w : h - w,
+                                        upper ? h - w : w,
+                                        &one,
+                                        P,
+                                        ldd,
+                                        P + w * (upper ? ldd : 1),
+                                        ldd));
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    /* Solves and updates P with the unit lower triangular factor of block column k. The
+       interchanges of the block columns factored before P are applied to P before its first
+       update, and those of the block columns between k and P to the streamed rows k * nb to m
+       of block column k, so that the rows of both are in the same order. */
+    hipsolverStatus_t update_lu(const tile_task& t, T* P)
+    {
+        using R = tiled_routines<T>;
+
+        const T minus_one = T(-1), one = T(1);
+
+        T*          B   = source(t);
+        rocblas_int r   = rocblas_int(t.k * s.nb);
+        rocblas_int p   = rocblas_int(s.pivots(t.k));
+        rocblas_int w   = rocblas_int(s.width(t.j));
+        rocblas_int ld  = rocblas_int(s.ld());
+        rocblas_int low = rocblas_int(s.m) - r - p;
+        for(int64_t i = 0; t.k == 0 && i < std::min(t.j, s.factored()); i++)
+        {
+            rocblas_int ri = rocblas_int(i * s.nb);
+            rocblas_int pi = rocblas_int(s.pivots(i));
+            CHECK_ROCBLAS_ERROR(R::laswp(handle, w, P + ri, ld, 1, pi, dipiv + ri, 1));
+        }
+        for(int64_t i = t.k + 1; t.stream >= 0 && i < std::min(t.j, s.factored()); i++)
+        {
+            rocblas_int ri = rocblas_int(i * s.nb);
+            rocblas_int pi = rocblas_int(s.pivots(i));
+            CHECK_ROCBLAS_ERROR(R::laswp(handle,
+                                         rocblas_int(s.width(t.k)),
+                                         B + ri - r,
+                                         ld,
+                                         1,
+                                         pi,
+                                         dipiv + ri,
+                                         1));
+        }
+        CHECK_ROCBLAS_ERROR(R::trsm(handle,
+                                    rocblas_side_left,
+                                    rocblas_fill_lower,
+                                    rocblas_operation_none,
+                                    rocblas_diagonal_unit,
+                                    p,
+                                    w,
+                                    &one,
+                                    B,
+                                    ld,
+                                    P + r,
+                                    ld));
+        if(low > 0)
+            CHECK_ROCBLAS_ERROR(R::gemm(handle,
+                                        rocblas_operation_none,
+                                        rocblas_operation_none,
+                                        low,
+                                        w,
+                                        p,
+                                        &minus_one,
+                                        B + p,
+                                        ld,
+                                        P + r,
+                                        ld,
+                                        &one,
+                                        P + r + p,
+                                        ld));
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipsolverStatus_t factor_lu(const tile_task& t, T* P)
+    {
+        using R = tiled_routines<T>;
+
+        rocblas_int r  = rocblas_int(t.j * s.nb);
+        rocblas_int ld = rocblas_int(s.ld());
+        return rocblas2hip_status(R::getrf(handle,
+                                           rocblas_int(s.m) - r,
+                                           rocblas_int(s.width(t.j)),
+                                           P + r,
+                                           ld,
+                                           dipiv + r,
+                                           dinfo + t.j));
+    }
+
+    void run_host(const tile_task& t)
+    {
+        int64_t r = t.j * s.nb;
+        int64_t p = s.pivots(t.j);
+        if(t.op == tile_op_pivots)
+        {
+            // the pivots of rocSOLVER are relative to the first row of the panel
+            for(int64_t i = r; i < r + p; i++)
+                ipiv[i] = hipiv[i] + r;
+            return;
+        }
+
+        for(int64_t c = t.k * s.nb; c < t.k * s.nb + s.width(t.k); c++)
+        {
+            T* col = A + c * lda;
+            for(int64_t i = r; i < r + p; i++)
+                std::swap(col[i], col[ipiv[i] - 1]);
+        }
+    }
+};
+
+template <typename T>
+static hipsolverStatus_t tiled_bufferSize(rocblas_handle      handle,
+                                          bool                lu,
+                                          hipsolverFillMode_t uplo,
+                                          int64_t             m,
+                                          int64_t             n,
+                                          int64_t             lda,
+                                          int64_t             tileSize,
+                                          size_t*             lwork)
+{
+    tile_schedule s;
+    CHECK_HIPSOLVER_ERROR(tiled_plan(handle, lu, uplo, m, n, lda, tileSize, sizeof(T), &s));
+
+    size_t sz = 0;
+    if(m > 0 && n > 0)
+    {
+        rocblas_start_device_memory_size_query(handle);
+        hipsolverStatus_t status
+            = tiled_rocblas_size<T>(handle, s, lu ? rocblas_fill_lower : hip2rocblas_fill(uplo));
+        rocblas_stop_device_memory_size_query(handle, &sz);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+
+    *lwork = workspace_with_extra(handle, sz, tiled_extra_size(s, sizeof(T)));
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+static hipsolverStatus_t tiled_factorize(rocblas_handle      handle,
+                                         bool                lu,
+                                         hipsolverFillMode_t uplo,
+                                         int64_t             m,
+                                         int64_t             n,
+                                         void*               A,
+                                         int64_t             lda,
+                                         int64_t*            ipiv,
+                                         int64_t             tileSize,
+                                         void*               work,
+                                         size_t              lwork,
+                                         int*                info)
+{
+    tile_schedule s;
+    CHECK_HIPSOLVER_ERROR(tiled_plan(handle, lu, uplo, m, n, lda, tileSize, sizeof(T), &s));
+    if((m && n && !A) || (lu && m && n && !ipiv) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *info = 0;
+    if(m == 0 || n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    // the host matrix is registered, and the interchanges of the LU are applied on the host
+    CHECK_HIPSOLVER_ERROR(check_capture(handle, capture_step_synchronize));
+
+    rocblas_device_malloc mem(handle);
+    void*                 extra;
+    CHECK_HIPSOLVER_ERROR(
+        prepare_workspace(handle, work, lwork, tiled_extra_size(s, sizeof(T)), mem, &extra));
+
+    pointer_mode_host_scope scope(handle);
+    bool                    upper = !lu && uplo == HIPSOLVER_FILL_MODE_UPPER;
+    tiled_executor<T>       executor(handle, s, upper, (T*)A, lda, ipiv, extra);
+    return executor.run(info);
+}
+
+HIPSOLVER_END_NAMESPACE
+
+extern "C" {
+
+/******************** PARAMS ********************/
+struct hipsolverParams
+{
+    static constexpr int function_count = 3;
+
+    // algorithm selected for each hipsolverDnFunction_t
+    hipsolverAlgMode_t alg[function_count];
+
+    // Constructor
+    explicit hipsolverParams()
+    {
+        std::fill(alg, alg + function_count, HIPSOLVER_ALG_0);
+    }
+};
+
+/* The unblocked routines selected by HIPSOLVER_ALG_1 only win while the panel of the blocked ones
+   covers most of the matrix. On wider matrices the blocked routines spend their time in trailing
+   updates that the unblocked ones do column by column, so ALG_1 falls back to them beyond
+   unblocked_max_n columns. */
+static constexpr int64_t unblocked_max_n = 64;
+
+static bool use_unblocked(hipsolverDnParams_t params, hipsolverDnFunction_t func, int64_t n)
+{
+    return ((hipsolverParams*)params)->alg[func] == HIPSOLVER_ALG_1 && n <= unblocked_max_n;
+}
+
+hipsolverStatus_t hipsolverDnCreateParams(hipsolverDnParams_t* info)
+try
+{
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *info = new hipsolverParams;
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnDestroyParams(hipsolverDnParams_t info)
+try
+{
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolverParams* params = (hipsolverParams*)info;
+    delete params;
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnSetAdvOptions(hipsolverDnParams_t   params,
+                                           hipsolverDnFunction_t func,
+                                           hipsolverAlgMode_t    alg)
+try
+{
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(func != HIPSOLVERDN_GETRF && func != HIPSOLVERDN_POTRF && func != HIPSOLVERDN_GEQRF)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(alg != HIPSOLVER_ALG_0 && alg != HIPSOLVER_ALG_1)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    ((hipsolverParams*)params)->alg[func] = alg;
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** GEQRF ********************/
+hipsolverStatus_t hipsolverDnXgeqrf_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverDnParams_t params,
+                                               int64_t             m,
+                                               int64_t             n,
+                                               hipDataType         dataTypeA,
+                                               const void*         A,
+                                               int64_t             lda,
+                                               hipDataType         dataTypeTau,
+                                               const void*         tau,
+                                               hipDataType         computeType,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    hipsolverAlgMode_t alg = ((hipsolverParams*)params)->alg[HIPSOLVERDN_GEQRF];
+    hipsolver::bufferSize_memo memo(
+        handle, __func__, m, n, dataTypeA, lda, dataTypeTau, computeType, alg);
+    if(memo.find(lworkOnDevice))
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    if(use_unblocked(params, HIPSOLVERDN_GEQRF, n))
+    {
+        hipsolverStatus_t status;
+        if(dataTypeA == HIP_R_32F && dataTypeTau == HIP_R_32F && computeType == HIP_R_32F)
+        {
+            status = hipsolver::geqr2_bufferSize<float>(
+                (rocblas_handle)handle, m, n, lda, lworkOnDevice);
+        }
+        else if(dataTypeA == HIP_R_64F && dataTypeTau == HIP_R_64F && computeType == HIP_R_64F)
+        {
+            status = hipsolver::geqr2_bufferSize<double>(
+                (rocblas_handle)handle, m, n, lda, lworkOnDevice);
+        }
+        else if(dataTypeA == HIP_C_32F && dataTypeTau == HIP_C_32F && computeType == HIP_C_32F)
+        {
+            status = hipsolver::geqr2_bufferSize<rocblas_float_complex>(
+                (rocblas_handle)handle, m, n, lda, lworkOnDevice);
+        }
+        else if(dataTypeA == HIP_C_64F && dataTypeTau == HIP_C_64F && computeType == HIP_C_64F)
+        {
+            status = hipsolver::geqr2_bufferSize<rocblas_double_complex>(
+                (rocblas_handle)handle, m, n, lda, lworkOnDevice);
+        }
+        else
+            return HIPSOLVER_STATUS_INVALID_ENUM;
+
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            memo.save(*lworkOnDevice);
+        return status;
+    }
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status;
+    if(dataTypeA == HIP_R_32F && dataTypeTau == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_sgeqrf_64((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeTau == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_dgeqrf_64((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeTau == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_cgeqrf_64((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeTau == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_zgeqrf_64((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lworkOnDevice);
+
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        memo.save(*lworkOnDevice);
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgeqrf(hipsolverDnHandle_t handle,
+                                    hipsolverDnParams_t params,
+                                    int64_t             m,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    void*               A,
+                                    int64_t             lda,
+                                    hipDataType         dataTypeTau,
+                                    void*               tau,
+                                    hipDataType         computeType,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(use_unblocked(params, HIPSOLVERDN_GEQRF, n))
+    {
+        if(!workOnDevice || !lworkOnDevice)
+        {
+            CHECK_HIPSOLVER_ERROR(hipsolverDnXgeqrf_bufferSize((rocblas_handle)handle,
+                                                               params,
+                                                               m,
+                                                               n,
+                                                               dataTypeA,
+                                                               A,
+                                                               lda,
+                                                               dataTypeTau,
+                                                               tau,
+                                                               computeType,
+                                                               &lworkOnDevice,
+                                                               &lworkOnHost));
+            workOnDevice = nullptr;
+        }
+
+        if(dataTypeA == HIP_R_32F && dataTypeTau == HIP_R_32F && computeType == HIP_R_32F)
+        {
+            return hipsolver::geqr2<float>(
+                (rocblas_handle)handle, m, n, A, lda, tau, workOnDevice, lworkOnDevice, devInfo);
+        }
+        else if(dataTypeA == HIP_R_64F && dataTypeTau == HIP_R_64F && computeType == HIP_R_64F)
+        {
+            return hipsolver::geqr2<double>(
+                (rocblas_handle)handle, m, n, A, lda, tau, workOnDevice, lworkOnDevice, devInfo);
+        }
+        else if(dataTypeA == HIP_C_32F && dataTypeTau == HIP_C_32F && computeType == HIP_C_32F)
+        {
+            return hipsolver::geqr2<rocblas_float_complex>(
+                (rocblas_handle)handle, m, n, A, lda, tau, workOnDevice, lworkOnDevice, devInfo);
+        }
+        else if(dataTypeA == HIP_C_64F && dataTypeTau == HIP_C_64F && computeType == HIP_C_64F)
+        {
+            return hipsolver::geqr2<rocblas_double_complex>(
+                (rocblas_handle)handle, m, n, A, lda, tau, workOnDevice, lworkOnDevice, devInfo);
+        }
+        else
+            return HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+
+    if(workOnDevice && lworkOnDevice)
+        CHECK_ROCBLAS_ERROR(
+            hipsolverSetUserWorkspace((rocblas_handle)handle, workOnDevice, lworkOnDevice));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXgeqrf_bufferSize((rocblas_handle)handle,
+                                                           params,
+                                                           m,
+                                                           n,
+                                                           dataTypeA,
+                                                           A,
+                                                           lda,
+                                                           dataTypeTau,
+                                                           tau,
+                                                           computeType,
+                                                           &lworkOnDevice,
+                                                           &lworkOnHost));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lworkOnDevice));
+    }
+
+    CHECK_ROCBLAS_ERROR(hipsolverZeroInfo((rocblas_handle)handle, devInfo, 1));
+
+    if(dataTypeA == HIP_R_32F && dataTypeTau == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        return hipsolver::rocblas2hip_status(
+            rocsolver_sgeqrf_64((rocblas_handle)handle, m, n, (float*)A, lda, (float*)tau));
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeTau == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        return hipsolver::rocblas2hip_status(
+            rocsolver_dgeqrf_64((rocblas_handle)handle, m, n, (double*)A, lda, (double*)tau));
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeTau == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_cgeqrf_64((rocblas_handle)handle,
+                                                                 m,
+                                                                 n,
+                                                                 (rocblas_float_complex*)A,
+                                                                 lda,
+                                                                 (rocblas_float_complex*)tau));
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeTau == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_zgeqrf_64((rocblas_handle)handle,
+                                                                 m,
+                                                                 n,
+                                                                 (rocblas_double_complex*)A,
+                                                                 lda,
+                                                                 (rocblas_double_complex*)tau));
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** GETRF ********************/
+hipsolverStatus_t hipsolverDnXgetrf_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverDnParams_t params,
+                                               int64_t             m,
+                                               int64_t             n,
+                                               hipDataType         dataTypeA,
+                                               const void*         A,
+                                               int64_t             lda,
+                                               hipDataType         computeType,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    hipsolverAlgMode_t alg = ((hipsolverParams*)params)->alg[HIPSOLVERDN_GETRF];
+    hipsolver::bufferSize_memo memo(handle, __func__, m, n, dataTypeA, lda, computeType, alg);
+    if(memo.find(lworkOnDevice))
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    if(use_unblocked(params, HIPSOLVERDN_GETRF, n))
+    {
+        hipsolverStatus_t status;
+        if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+        {
+            status = hipsolver::getf2_bufferSize<float>(
+                (rocblas_handle)handle, m, n, lda, lworkOnDevice);
+        }
+        else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+        {
+            status = hipsolver::getf2_bufferSize<double>(
+                (rocblas_handle)handle, m, n, lda, lworkOnDevice);
+        }
+        else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+        {
+            status = hipsolver::getf2_bufferSize<rocblas_float_complex>(
+                (rocblas_handle)handle, m, n, lda, lworkOnDevice);
+        }
+        else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+        {
+            status = hipsolver::getf2_bufferSize<rocblas_double_complex>(
+                (rocblas_handle)handle, m, n, lda, lworkOnDevice);
+        }
+        else
+            return HIPSOLVER_STATUS_INVALID_ENUM;
+
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            memo.save(*lworkOnDevice);
+        return status;
+    }
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status;
+    if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_sgetrf_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
+        rocsolver_sgetrf_npvt_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    }
+    else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_dgetrf_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
+        rocsolver_dgetrf_npvt_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    }
+    else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_cgetrf_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
+        rocsolver_cgetrf_npvt_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    }
+    else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_zgetrf_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
+        rocsolver_zgetrf_npvt_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lworkOnDevice);
+
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        memo.save(*lworkOnDevice);
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgetrf(hipsolverDnHandle_t handle,
+                                    hipsolverDnParams_t params,
+                                    int64_t             m,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    void*               A,
+                                    int64_t             lda,
+                                    int64_t*            devIpiv,
+                                    hipDataType         computeType,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(use_unblocked(params, HIPSOLVERDN_GETRF, n))
+    {
+        if(!workOnDevice || !lworkOnDevice)
+        {
+            CHECK_HIPSOLVER_ERROR(hipsolverDnXgetrf_bufferSize((rocblas_handle)handle,
+                                                               params,
+                                                               m,
+                                                               n,
+                                                               dataTypeA,
+                                                               A,
+                                                               lda,
+                                                               computeType,
+                                                               &lworkOnDevice,
+                                                               &lworkOnHost));
+            workOnDevice = nullptr;
+        }
+
+        if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+        {
+            return hipsolver::getf2<float>((rocblas_handle)handle,
+                                           m,
+                                           n,
+                                           A,
+                                           lda,
+                                           devIpiv,
+                                           workOnDevice,
+                                           lworkOnDevice,
+                                           devInfo);
+        }
+        else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+        {
+            return hipsolver::getf2<double>((rocblas_handle)handle,
+                                            m,
+                                            n,
+                                            A,
+                                            lda,
+                                            devIpiv,
+                                            workOnDevice,
+                                            lworkOnDevice,
+                                            devInfo);
+        }
+        else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+        {
+            return hipsolver::getf2<rocblas_float_complex>((rocblas_handle)handle,
+                                                           m,
+                                                           n,
+                                                           A,
+                                                           lda,
+                                                           devIpiv,
+                                                           workOnDevice,
+                                                           lworkOnDevice,
+                                                           devInfo);
+        }
+        else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+        {
+            return hipsolver::getf2<rocblas_double_complex>((rocblas_handle)handle,
+                                                            m,
+                                                            n,
+                                                            A,
+                                                            lda,
+                                                            devIpiv,
+                                                            workOnDevice,
+                                                            lworkOnDevice,
+                                                            devInfo);
+        }
+        else
+            return HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+
+    if(workOnDevice && lworkOnDevice)
+        CHECK_ROCBLAS_ERROR(
+            hipsolverSetUserWorkspace((rocblas_handle)handle, workOnDevice, lworkOnDevice));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXgetrf_bufferSize((rocblas_handle)handle,
+                                                           params,
+                                                           m,
+                                                           n,
+                                                           dataTypeA,
+                                                           A,
+                                                           lda,
+                                                           computeType,
+                                                           &lworkOnDevice,
+                                                           &lworkOnHost));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lworkOnDevice));
+    }
+
+    if(devIpiv != nullptr)
+    {
+        if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+        {
+            return hipsolver::rocblas2hip_status(rocsolver_sgetrf_info32(
+                (rocblas_handle)handle, m, n, (float*)A, lda, devIpiv, devInfo));
+        }
+        else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+        {
+            return hipsolver::rocblas2hip_status(rocsolver_dgetrf_info32(
+                (rocblas_handle)handle, m, n, (double*)A, lda, devIpiv, devInfo));
+        }
+        else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+        {
+            return hipsolver::rocblas2hip_status(rocsolver_cgetrf_info32(
+                (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, devIpiv, devInfo));
+        }
+        else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+        {
+            return hipsolver::rocblas2hip_status(rocsolver_zgetrf_info32(
+                (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, devIpiv, devInfo));
+        }
+        else
+            return HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+    else
+    {
+        if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+        {
+            return hipsolver::rocblas2hip_status(rocsolver_sgetrf_npvt_info32(
+                (rocblas_handle)handle, m, n, (float*)A, lda, devInfo));
+        }
+        else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+        {
+            return hipsolver::rocblas2hip_status(rocsolver_dgetrf_npvt_info32(
+                (rocblas_handle)handle, m, n, (double*)A, lda, devInfo));
+        }
+        else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+        {
+            return hipsolver::rocblas2hip_status(rocsolver_cgetrf_npvt_info32(
+                (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, devInfo));
+        }
+        else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+        {
+            return hipsolver::rocblas2hip_status(rocsolver_zgetrf_npvt_info32(
+                (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, devInfo));
+        }
+        else
+            return HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** GETRF OUT-OF-CORE ********************/
+hipsolverStatus_t hipsolverDnXgetrfOutOfCore_bufferSize(hipsolverDnHandle_t handle,
+                                                        hipsolverDnParams_t params,
+                                                        int64_t             m,
+                                                        int64_t             n,
+                                                        hipDataType         dataTypeA,
+                                                        const void*         A,
+                                                        int64_t             lda,
+                                                        hipDataType         computeType,
+                                                        int64_t             tileSize,
+                                                        size_t*             lworkOnDevice,
+                                                        size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        return hipsolver::tiled_bufferSize<float>((rocblas_handle)handle,
+                                                  true,
+                                                  HIPSOLVER_FILL_MODE_LOWER,
+                                                  m,
+                                                  n,
+                                                  lda,
+                                                  tileSize,
+                                                  lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        return hipsolver::tiled_bufferSize<double>((rocblas_handle)handle,
+                                                   true,
+                                                   HIPSOLVER_FILL_MODE_LOWER,
+                                                   m,
+                                                   n,
+                                                   lda,
+                                                   tileSize,
+                                                   lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        return hipsolver::tiled_bufferSize<rocblas_float_complex>((rocblas_handle)handle,
+                                                                  true,
+                                                                  HIPSOLVER_FILL_MODE_LOWER,
+                                                                  m,
+                                                                  n,
+                                                                  lda,
+                                                                  tileSize,
+                                                                  lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        return hipsolver::tiled_bufferSize<rocblas_double_complex>((rocblas_handle)handle,
+                                                                   true,
+                                                                   HIPSOLVER_FILL_MODE_LOWER,
+                                                                   m,
+                                                                   n,
+                                                                   lda,
+                                                                   tileSize,
+                                                                   lworkOnDevice);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgetrfOutOfCore(hipsolverDnHandle_t handle,
+                                             hipsolverDnParams_t params,
+                                             int64_t             m,
+                                             int64_t             n,
+                                             hipDataType         dataTypeA,
+                                             void*               A,
+                                             int64_t             lda,
+                                             int64_t*            hostIpiv,
+                                             hipDataType         computeType,
+                                             int64_t             tileSize,
+                                             void*               workOnDevice,
+                                             size_t              lworkOnDevice,
+                                             void*               workOnHost,
+                                             size_t              lworkOnHost,
+                                             int*                hostInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(!workOnDevice || !lworkOnDevice)
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXgetrfOutOfCore_bufferSize(handle,
+                                                                    params,
+                                                                    m,
+                                                                    n,
+                                                                    dataTypeA,
+                                                                    A,
+                                                                    lda,
+                                                                    computeType,
+                                                                    tileSize,
+                                                                    &lworkOnDevice,
+                                                                    &lworkOnHost));
+        workOnDevice = nullptr;
+    }
+
+    if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        return hipsolver::tiled_factorize<float>((rocblas_handle)handle,
+                                                 true,
+                                                 HIPSOLVER_FILL_MODE_LOWER,
+                                                 m,
+                                                 n,
+                                                 A,
+                                                 lda,
+                                                 hostIpiv,
+                                                 tileSize,
+                                                 workOnDevice,
+                                                 lworkOnDevice,
+                                                 hostInfo);
+    }
+    else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        return hipsolver::tiled_factorize<double>((rocblas_handle)handle,
+                                                  true,
+                                                  HIPSOLVER_FILL_MODE_LOWER,
+                                                  m,
+                                                  n,
+                                                  A,
+                                                  lda,
+                                                  hostIpiv,
+                                                  tileSize,
+                                                  workOnDevice,
+                                                  lworkOnDevice,
+                                                  hostInfo);
+    }
+    else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        return hipsolver::tiled_factorize<rocblas_float_complex>((rocblas_handle)handle,
+                                                                 true,
+                                                                 HIPSOLVER_FILL_MODE_LOWER,
+                                                                 m,
+                                                                 n,
+                                                                 A,
+                                                                 lda,
+                                                                 hostIpiv,
+                                                                 tileSize,
+                                                                 workOnDevice,
+                                                                 lworkOnDevice,
+                                                                 hostInfo);
+    }
+    else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        return hipsolver::tiled_factorize<rocblas_double_complex>((rocblas_handle)handle,
+                                                                  true,
+                                                                  HIPSOLVER_FILL_MODE_LOWER,
+                                                                  m,
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  hostIpiv,
+                                                                  tileSize,
+                                                                  workOnDevice,
+                                                                  lworkOnDevice,
+                                                                  hostInfo);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** GETRS ********************/
+hipsolverStatus_t hipsolverInternalXgetrs_bufferSize(hipsolverHandle_t    handle,
+                                                     hipsolverDnParams_t  params,
+                                                     hipsolverOperation_t trans,
+                                                     int64_t              n,
+                                                     int64_t              nrhs,
+                                                     hipDataType          dataTypeA,
+                                                     const void*          A,
+                                                     int64_t              lda,
+                                                     const int64_t*       devIpiv,
+                                                     hipDataType          dataTypeB,
+                                                     void*                B,
+                                                     int64_t              ldb,
+                                                     size_t*              lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+
+    hipsolver::bufferSize_memo memo(
+        handle, __func__, trans, n, nrhs, dataTypeA, lda, dataTypeB, ldb);
+    if(memo.find(lwork))
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status;
+    if(dataTypeA == HIP_R_32F && dataTypeB == HIP_R_32F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_sgetrs_64((rocblas_handle)handle,
+                                hipsolver::hip2rocblas_operation(trans),
+                                n,
+                                nrhs,
+                                nullptr,
+                                lda,
+                                nullptr,
+                                nullptr,
+                                ldb));
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeB == HIP_R_64F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_dgetrs_64((rocblas_handle)handle,
+                                hipsolver::hip2rocblas_operation(trans),
+                                n,
+                                nrhs,
+                                nullptr,
+                                lda,
+                                nullptr,
+                                nullptr,
+                                ldb));
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeB == HIP_C_32F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_cgetrs_64((rocblas_handle)handle,
+                                hipsolver::hip2rocblas_operation(trans),
+                                n,
+                                nrhs,
+                                nullptr,
+                                lda,
+                                nullptr,
+                                nullptr,
+                                ldb));
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeB == HIP_C_64F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_zgetrs_64((rocblas_handle)handle,
+                                hipsolver::hip2rocblas_operation(trans),
+                                n,
+                                nrhs,
+                                nullptr,
+                                lda,
+                                nullptr,
+                                nullptr,
+                                ldb));
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lwork);
+
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        memo.save(*lwork);
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgetrs(hipsolverDnHandle_t  handle,
+                                    hipsolverDnParams_t  params,
+                                    hipsolverOperation_t trans,
+                                    int64_t              n,
+                                    int64_t              nrhs,
+                                    hipDataType          dataTypeA,
+                                    const void*          A,
+                                    int64_t              lda,
+                                    const int64_t*       devIpiv,
+                                    hipDataType          dataTypeB,
+                                    void*                B,
+                                    int64_t              ldb,
+                                    int*                 devInfo)
+try
+{
+    size_t lwork;
+    CHECK_HIPSOLVER_ERROR(hipsolverInternalXgetrs_bufferSize((rocblas_handle)handle,
+                                                             params,
+                                                             trans,
+                                                             n,
+                                                             nrhs,
+                                                             dataTypeA,
+                                                             A,
+                                                             lda,
+                                                             devIpiv,
+                                                             dataTypeB,
+                                                             B,
+                                                             ldb,
+                                                             &lwork));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+    CHECK_ROCBLAS_ERROR(hipsolverZeroInfo((rocblas_handle)handle, devInfo, 1));
+
+    if(dataTypeA == HIP_R_32F && dataTypeB == HIP_R_32F)
+    {
+        return hipsolver::rocblas2hip_status(
+            rocsolver_sgetrs_64((rocblas_handle)handle,
+                                hipsolver::hip2rocblas_operation(trans),
+                                n,
+                                nrhs,
+                                (float*)const_cast<void*>(A),
+                                lda,
+                                const_cast<int64_t*>(devIpiv),
+                                (float*)B,
+                                ldb));
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeB == HIP_R_64F)
+    {
+        return hipsolver::rocblas2hip_status(
+            rocsolver_dgetrs_64((rocblas_handle)handle,
+                                hipsolver::hip2rocblas_operation(trans),
+                                n,
+                                nrhs,
+                                (double*)const_cast<void*>(A),
+                                lda,
+                                const_cast<int64_t*>(devIpiv),
+                                (double*)B,
+                                ldb));
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeB == HIP_C_32F)
+    {
+        return hipsolver::rocblas2hip_status(
+            rocsolver_cgetrs_64((rocblas_handle)handle,
+                                hipsolver::hip2rocblas_operation(trans),
+                                n,
+                                nrhs,
+                                (rocblas_float_complex*)const_cast<void*>(A),
+                                lda,
+                                const_cast<int64_t*>(devIpiv),
+                                (rocblas_float_complex*)B,
+                                ldb));
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeB == HIP_C_64F)
+    {
+        return hipsolver::rocblas2hip_status(
+            rocsolver_zgetrs_64((rocblas_handle)handle,
+                                hipsolver::hip2rocblas_operation(trans),
+                                n,
+                                nrhs,
+                                (rocblas_double_complex*)const_cast<void*>(A),
+                                lda,
+                                const_cast<int64_t*>(devIpiv),
+                                (rocblas_double_complex*)B,
+                                ldb));
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** POTRF ********************/
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrf_bufferSize(hipsolverDnHandle_t handle,
+                                                                hipsolverDnParams_t params,
+                                                                hipsolverFillMode_t uplo,
+                                                                int64_t             n,
+                                                                hipDataType         dataTypeA,
+                                                                const void*         A,
+                                                                int64_t             lda,
+                                                                hipDataType         computeType,
+                                                                size_t*             lworkOnDevice,
+                                                                size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    hipsolverAlgMode_t alg = ((hipsolverParams*)params)->alg[HIPSOLVERDN_POTRF];
+    hipsolver::bufferSize_memo memo(
+        handle, __func__, uplo, n, dataTypeA, lda, computeType, alg);
+    if(memo.find(lworkOnDevice))
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    if(use_unblocked(params, HIPSOLVERDN_POTRF, n))
+    {
+        hipsolverStatus_t status;
+        if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+        {
+            status = hipsolver::potf2_bufferSize<float>(
+                (rocblas_handle)handle, uplo, n, lda, lworkOnDevice);
+        }
+        else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+        {
+            status = hipsolver::potf2_bufferSize<double>(
+                (rocblas_handle)handle, uplo, n, lda, lworkOnDevice);
+        }
+        else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+        {
+            status = hipsolver::potf2_bufferSize<rocblas_float_complex>(
+                (rocblas_handle)handle, uplo, n, lda, lworkOnDevice);
+        }
+        else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+        {
+            status = hipsolver::potf2_bufferSize<rocblas_double_complex>(
+                (rocblas_handle)handle, uplo, n, lda, lworkOnDevice);
+        }
+        else
+            return HIPSOLVER_STATUS_INVALID_ENUM;
+
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            memo.save(*lworkOnDevice);
+        return status;
+    }
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status;
+
+    if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        status = hipsolver::rocblas2hip_status(rocsolver_spotrf_64(
+            (rocblas_handle)handle, hipsolver::hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    }
+    else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        status = hipsolver::rocblas2hip_status(rocsolver_dpotrf_64(
+            (rocblas_handle)handle, hipsolver::hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    }
+    else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        status = hipsolver::rocblas2hip_status(rocsolver_cpotrf_64(
+            (rocblas_handle)handle, hipsolver::hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    }
+    else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        status = hipsolver::rocblas2hip_status(rocsolver_zpotrf_64(
+            (rocblas_handle)handle, hipsolver::hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lworkOnDevice);
+
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        memo.save(*lworkOnDevice);
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrf(hipsolverDnHandle_t handle,
+                                                     hipsolverDnParams_t params,
+                                                     hipsolverFillMode_t uplo,
+                                                     int64_t             n,
+                                                     hipDataType         dataTypeA,
+                                                     void*               A,
+                                                     int64_t             lda,
+                                                     hipDataType         computeType,
+                                                     void*               workOnDevice,
+                                                     size_t              lworkOnDevice,
+                                                     void*               workOnHost,
+                                                     size_t              lworkOnHost,
+                                                     int*                info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(use_unblocked(params, HIPSOLVERDN_POTRF, n))
+    {
+        if(!workOnDevice || !lworkOnDevice)
+        {
+            CHECK_HIPSOLVER_ERROR(hipsolverDnXpotrf_bufferSize((rocblas_handle)handle,
+                                                               params,
+                                                               uplo,
+                                                               n,
+                                                               dataTypeA,
+                                                               A,
+                                                               lda,
+                                                               computeType,
+                                                               &lworkOnDevice,
+                                                               &lworkOnHost));
+            workOnDevice = nullptr;
+        }
+
+        if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+        {
+            return hipsolver::potf2<float>(
+                (rocblas_handle)handle, uplo, n, A, lda, workOnDevice, lworkOnDevice, info);
+        }
+        else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+        {
+            return hipsolver::potf2<double>(
+                (rocblas_handle)handle, uplo, n, A, lda, workOnDevice, lworkOnDevice, info);
+        }
+        else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+        {
+            return hipsolver::potf2<rocblas_float_complex>(
+                (rocblas_handle)handle, uplo, n, A, lda, workOnDevice, lworkOnDevice, info);
+        }
+        else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+        {
+            return hipsolver::potf2<rocblas_double_complex>(
+                (rocblas_handle)handle, uplo, n, A, lda, workOnDevice, lworkOnDevice, info);
+        }
+        else
+            return HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+
+    if(workOnDevice && lworkOnDevice)
+        CHECK_ROCBLAS_ERROR(
+            hipsolverSetUserWorkspace((rocblas_handle)handle, workOnDevice, lworkOnDevice));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXpotrf_bufferSize((rocblas_handle)handle,
+                                                           params,
+                                                           uplo,
+                                                           n,
+                                                           dataTypeA,
+                                                           A,
+                                                           lda,
+                                                           computeType,
+                                                           &lworkOnDevice,
+                                                           &lworkOnHost));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lworkOnDevice));
+    }
+
+    if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_spotrf_info32(
+            (rocblas_handle)handle, hipsolver::hip2rocblas_fill(uplo), n, (float*)A, lda, info));
+    }
+    else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_dpotrf_info32(
+            (rocblas_handle)handle, hipsolver::hip2rocblas_fill(uplo), n, (double*)A, lda, info));
+    }
+    else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        return hipsolver::rocblas2hip_status(
+            rocsolver_cpotrf_info32((rocblas_handle)handle,
+                                    hipsolver::hip2rocblas_fill(uplo),
+                                    n,
+                                    (rocblas_float_complex*)A,
+                                    lda,
+                                    info));
+    }
+    else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        return hipsolver::rocblas2hip_status(
+            rocsolver_zpotrf_info32((rocblas_handle)handle,
+                                    hipsolver::hip2rocblas_fill(uplo),
+                                    n,
+                                    (rocblas_double_complex*)A,
+                                    lda,
+                                    info));
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** POTRF OUT-OF-CORE ********************/
+hipsolverStatus_t hipsolverDnXpotrfOutOfCore_bufferSize(hipsolverDnHandle_t handle,
+                                                        hipsolverDnParams_t params,
+                                                        hipsolverFillMode_t uplo,
+                                                        int64_t             n,
+                                                        hipDataType         dataTypeA,
+                                                        const void*         A,
+                                                        int64_t             lda,
+                                                        hipDataType         computeType,
+                                                        int64_t             tileSize,
+                                                        size_t*             lworkOnDevice,
+                                                        size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        return hipsolver::tiled_bufferSize<float>((rocblas_handle)handle,
+                                                  false,
+                                                  uplo,
+                                                  n,
+                                                  n,
+                                                  lda,
+                                                  tileSize,
+                                                  lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        return hipsolver::tiled_bufferSize<double>((rocblas_handle)handle,
+                                                   false,
+                                                   uplo,
+                                                   n,
+                                                   n,
+                                                   lda,
+                                                   tileSize,
+                                                   lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        return hipsolver::tiled_bufferSize<rocblas_float_complex>((rocblas_handle)handle,
+                                                                  false,
+                                                                  uplo,
+                                                                  n,
+                                                                  n,
+                                                                  lda,
+                                                                  tileSize,
+                                                                  lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        return hipsolver::tiled_bufferSize<rocblas_double_complex>((rocblas_handle)handle,
+                                                                   false,
+                                                                   uplo,
+                                                                   n,
+                                                                   n,
+                                                                   lda,
+                                                                   tileSize,
+                                                                   lworkOnDevice);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXpotrfOutOfCore(hipsolverDnHandle_t handle,
+                                             hipsolverDnParams_t params,
+                                             hipsolverFillMode_t uplo,
+                                             int64_t             n,
+                                             hipDataType         dataTypeA,
+                                             void*               A,
+                                             int64_t             lda,
+                                             hipDataType         computeType,
+                                             int64_t             tileSize,
+                                             void*               workOnDevice,
+                                             size_t              lworkOnDevice,
+                                             void*               workOnHost,
+                                             size_t              lworkOnHost,
+                                             int*                hostInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(!workOnDevice || !lworkOnDevice)
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXpotrfOutOfCore_bufferSize(handle,
+                                                                    params,
+                                                                    uplo,
+                                                                    n,
+                                                                    dataTypeA,
+                                                                    A,
+                                                                    lda,
+                                                                    computeType,
+                                                                    tileSize,
+                                                                    &lworkOnDevice,
+                                                                    &lworkOnHost));
+        workOnDevice = nullptr;
+    }
+
+    if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        return hipsolver::tiled_factorize<float>((rocblas_handle)handle,
+                                                 false,
+                                                 uplo,
+                                                 n,
+                                                 n,
+                                                 A,
+                                                 lda,
+                                                 nullptr,
+                                                 tileSize,
+                                                 workOnDevice,
+                                                 lworkOnDevice,
+                                                 hostInfo);
+    }
+    else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        return hipsolver::tiled_factorize<double>((rocblas_handle)handle,
+                                                  false,
+                                                  uplo,
+                                                  n,
+                                                  n,
+                                                  A,
+                                                  lda,
+                                                  nullptr,
+                                                  tileSize,
+                                                  workOnDevice,
+                                                  lworkOnDevice,
+                                                  hostInfo);
+    }
+    else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        return hipsolver::tiled_factorize<rocblas_float_complex>((rocblas_handle)handle,
+                                                                 false,
+                                                                 uplo,
+                                                                 n,
+                                                                 n,
+                                                                 A,
+                                                                 lda,
+                                                                 nullptr,
+                                                                 tileSize,
+                                                                 workOnDevice,
+                                                                 lworkOnDevice,
+                                                                 hostInfo);
+    }
+    else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        return hipsolver::tiled_factorize<rocblas_double_complex>((rocblas_handle)handle,
+                                                                  false,
+                                                                  uplo,
+                                                                  n,
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  nullptr,
+                                                                  tileSize,
+                                                                  workOnDevice,
+                                                                  lworkOnDevice,
+                                                                  hostInfo);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** POTRS ********************/
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrs(hipsolverDnHandle_t handle,
+                                                     hipsolverDnParams_t params,
+                                                     hipsolverFillMode_t uplo,
+                                                     int64_t             n,
+                                                     int64_t             nrhs,
+                                                     hipDataType         dataTypeA,
+                                                     const void*         A,
+                                                     int64_t             lda,
+                                                     hipDataType         dataTypeB,
+                                                     void*               B,
+                                                     int64_t             ldb,
+                                                     int*                info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(dataTypeA == HIP_R_32F && dataTypeB == HIP_R_32F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_spotrs((rocblas_handle)handle,
+                                                              hipsolver::hip2rocblas_fill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              (float*)A,
+                                                              lda,
+                                                              (float*)B,
+                                                              ldb));
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeB == HIP_R_64F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_dpotrs((rocblas_handle)handle,
+                                                              hipsolver::hip2rocblas_fill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              (double*)A,
+                                                              lda,
+                                                              (double*)B,
+                                                              ldb));
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeB == HIP_C_32F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_cpotrs((rocblas_handle)handle,
+                                                              hipsolver::hip2rocblas_fill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              (rocblas_float_complex*)B,
+                                                              ldb));
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeB == HIP_C_64F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_zpotrs((rocblas_handle)handle,
+                                                              hipsolver::hip2rocblas_fill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              (rocblas_double_complex*)B,
+                                                              ldb));
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYEVD ********************/
+hipsolverStatus_t hipsolverDnXsyevd_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverDnParams_t params,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int64_t             n,
+                                               hipDataType         dataTypeA,
+                                               const void*         A,
+                                               int64_t             lda,
+                                               hipDataType         dataTypeW,
+                                               const void*         W,
+                                               hipDataType         computeType,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    hipsolver::bufferSize_memo memo(
+        handle, __func__, jobz, uplo, n, dataTypeA, lda, dataTypeW, computeType);
+    if(memo.find(lworkOnDevice))
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolverStatus_t status;
+    if(dataTypeA == HIP_R_32F && dataTypeW == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        status = hipsolver::syevd_bufferSize(
+            rocsolver_ssyevd, (rocblas_handle)handle, jobz, uplo, n, lda, lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeW == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        status = hipsolver::syevd_bufferSize(
+            rocsolver_dsyevd, (rocblas_handle)handle, jobz, uplo, n, lda, lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeW == HIP_R_32F && computeType == HIP_C_32F)
+    {
+        status = hipsolver::syevd_bufferSize(
+            rocsolver_cheevd, (rocblas_handle)handle, jobz, uplo, n, lda, lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeW == HIP_R_64F && computeType == HIP_C_64F)
+    {
+        status = hipsolver::syevd_bufferSize(
+            rocsolver_zheevd, (rocblas_handle)handle, jobz, uplo, n, lda, lworkOnDevice);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        memo.save(*lworkOnDevice);
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsyevd(hipsolverDnHandle_t handle,
+                                    hipsolverDnParams_t params,
+                                    hipsolverEigMode_t  jobz,
+                                    hipsolverFillMode_t uplo,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    void*               A,
+                                    int64_t             lda,
+                                    hipDataType         dataTypeW,
+                                    void*               W,
+                                    hipDataType         computeType,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
 try
 {
-    if(!info)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *info = new hipsolverParams;
+    if(!workOnDevice || !lworkOnDevice)
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXsyevd_bufferSize((rocblas_handle)handle,
+                                                           params,
+                                                           jobz,
+                                                           uplo,
+                                                           n,
+                                                           dataTypeA,
+                                                           A,
+                                                           lda,
+                                                           dataTypeW,
+                                                           W,
+                                                           computeType,
+                                                           &lworkOnDevice,
+                                                           &lworkOnHost));
+        workOnDevice = nullptr;
+    }
 
-    return HIPSOLVER_STATUS_SUCCESS;
+    if(dataTypeA == HIP_R_32F && dataTypeW == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        return hipsolver::syevd(rocsolver_ssyevd,
+                                (rocblas_handle)handle,
+                                jobz,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                W,
+                                workOnDevice,
+                                lworkOnDevice,
+                                info);
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeW == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        return hipsolver::syevd(rocsolver_dsyevd,
+                                (rocblas_handle)handle,
+                                jobz,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                W,
+                                workOnDevice,
+                                lworkOnDevice,
+                                info);
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeW == HIP_R_32F && computeType == HIP_C_32F)
+    {
+        return hipsolver::syevd(rocsolver_cheevd,
+                                (rocblas_handle)handle,
+                                jobz,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                W,
+                                workOnDevice,
+                                lworkOnDevice,
+                                info);
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeW == HIP_R_64F && computeType == HIP_C_64F)
+    {
+        return hipsolver::syevd(rocsolver_zheevd,
+                                (rocblas_handle)handle,
+                                jobz,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                W,
+                                workOnDevice,
+                                lworkOnDevice,
+                                info);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnDestroyParams(hipsolverDnParams_t info)
+/******************** SYEVDX ********************/
+hipsolverStatus_t hipsolverDnXsyevdx_bufferSize(hipsolverDnHandle_t handle,
+                                                hipsolverDnParams_t params,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverEigRange_t range,
+                                                hipsolverFillMode_t uplo,
+                                                int64_t             n,
+                                                hipDataType         dataTypeA,
+                                                const void*         A,
+                                                int64_t             lda,
+                                                void*               vl,
+                                                void*               vu,
+                                                int64_t             il,
+                                                int64_t             iu,
+                                                int64_t*            nev,
+                                                hipDataType         dataTypeW,
+                                                const void*         W,
+                                                hipDataType         computeType,
+                                                size_t*             lworkOnDevice,
+                                                size_t*             lworkOnHost)
 try
 {
-    if(!info)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    hipsolverParams* params = (hipsolverParams*)info;
-    delete params;
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
 
-    return HIPSOLVER_STATUS_SUCCESS;
+    hipsolver::bufferSize_memo memo(handle,
+                                    __func__,
+                                    jobz,
+                                    range,
+                                    uplo,
+                                    n,
+                                    dataTypeA,
+                                    lda,
+                                    hipsolver::host_real(vl, dataTypeW),
+                                    hipsolver::host_real(vu, dataTypeW),
+                                    il,
+                                    iu,
+                                    dataTypeW,
+                                    computeType);
+    if(memo.find(lworkOnDevice))
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolverStatus_t status;
+    if(dataTypeA == HIP_R_32F && dataTypeW == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        status = hipsolver::syevdx_bufferSize(rocsolver_ssyevdx_inplace,
+                                              (rocblas_handle)handle,
+                                              jobz,
+                                              range,
+                                              uplo,
+                                              n,
+                                              lda,
+                                              vl,
+                                              vu,
+                                              il,
+                                              iu,
+                                              lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeW == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        status = hipsolver::syevdx_bufferSize(rocsolver_dsyevdx_inplace,
+                                              (rocblas_handle)handle,
+                                              jobz,
+                                              range,
+                                              uplo,
+                                              n,
+                                              lda,
+                                              vl,
+                                              vu,
+                                              il,
+                                              iu,
+                                              lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeW == HIP_R_32F && computeType == HIP_C_32F)
+    {
+        status = hipsolver::syevdx_bufferSize(rocsolver_cheevdx_inplace,
+                                              (rocblas_handle)handle,
+                                              jobz,
+                                              range,
+                                              uplo,
+                                              n,
+                                              lda,
+                                              vl,
+                                              vu,
+                                              il,
+                                              iu,
+                                              lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeW == HIP_R_64F && computeType == HIP_C_64F)
+    {
+        status = hipsolver::syevdx_bufferSize(rocsolver_zheevdx_inplace,
+                                              (rocblas_handle)handle,
+                                              jobz,
+                                              range,
+                                              uplo,
+                                              n,
+                                              lda,
+                                              vl,
+                                              vu,
+                                              il,
+                                              iu,
+                                              lworkOnDevice);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        memo.save(*lworkOnDevice);
+    return status;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnSetAdvOptions(hipsolverDnParams_t   params,
-                                           hipsolverDnFunction_t func,
-                                           hipsolverAlgMode_t    alg)
+hipsolverStatus_t hipsolverDnXsyevdx(hipsolverDnHandle_t handle,
+                                     hipsolverDnParams_t params,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverEigRange_t range,
+                                     hipsolverFillMode_t uplo,
+                                     int64_t             n,
+                                     hipDataType         dataTypeA,
+                                     void*               A,
+                                     int64_t             lda,
+                                     void*               vl,
+                                     void*               vu,
+                                     int64_t             il,
+                                     int64_t             iu,
+                                     int64_t*            nev,
+                                     hipDataType         dataTypeW,
+                                     void*               W,
+                                     hipDataType         computeType,
+                                     void*               workOnDevice,
+                                     size_t              lworkOnDevice,
+                                     void*               workOnHost,
+                                     size_t              lworkOnHost,
+                                     int*                info)
 try
 {
-    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(!workOnDevice || !lworkOnDevice)
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXsyevdx_bufferSize((rocblas_handle)handle,
+                                                            params,
+                                                            jobz,
+                                                            range,
+                                                            uplo,
+                                                            n,
+                                                            dataTypeA,
+                                                            A,
+                                                            lda,
+                                                            vl,
+                                                            vu,
+                                                            il,
+                                                            iu,
+                                                            nev,
+                                                            dataTypeW,
+                                                            W,
+                                                            computeType,
+                                                            &lworkOnDevice,
+                                                            &lworkOnHost));
+        workOnDevice = nullptr;
+    }
+
+    if(dataTypeA == HIP_R_32F && dataTypeW == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        return hipsolver::syevdx(rocsolver_ssyevdx_inplace,
+                                 (rocblas_handle)handle,
+                                 jobz,
+                                 range,
+                                 uplo,
+                                 n,
+                                 A,
+                                 lda,
+                                 vl,
+                                 vu,
+                                 il,
+                                 iu,
+                                 nev,
+                                 W,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 info);
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeW == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        return hipsolver::syevdx(rocsolver_dsyevdx_inplace,
+                                 (rocblas_handle)handle,
+                                 jobz,
+                                 range,
+                                 uplo,
+                                 n,
+                                 A,
+                                 lda,
+                                 vl,
+                                 vu,
+                                 il,
+                                 iu,
+                                 nev,
+                                 W,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 info);
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeW == HIP_R_32F && computeType == HIP_C_32F)
+    {
+        return hipsolver::syevdx(rocsolver_cheevdx_inplace,
+                                 (rocblas_handle)handle,
+                                 jobz,
+                                 range,
+                                 uplo,
+                                 n,
+                                 A,
+                                 lda,
+                                 vl,
+                                 vu,
+                                 il,
+                                 iu,
+                                 nev,
+                                 W,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 info);
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeW == HIP_R_64F && computeType == HIP_C_64F)
+    {
+        return hipsolver::syevdx(rocsolver_zheevdx_inplace,
+                                 (rocblas_handle)handle,
+                                 jobz,
+                                 range,
+                                 uplo,
+                                 n,
+                                 A,
+                                 lda,
+                                 vl,
+                                 vu,
+                                 il,
+                                 iu,
+                                 nev,
+                                 W,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 info);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** GEQRF ********************/
-hipsolverStatus_t hipsolverDnXgeqrf_bufferSize(hipsolverDnHandle_t handle,
+/******************** GESVD ********************/
+hipsolverStatus_t hipsolverDnXgesvd_bufferSize(hipsolverDnHandle_t handle,
                                                hipsolverDnParams_t params,
+                                               signed char         jobu,
+                                               signed char         jobv,
                                                int64_t             m,
                                                int64_t             n,
                                                hipDataType         dataTypeA,
                                                const void*         A,
                                                int64_t             lda,
-                                               hipDataType         dataTypeTau,
-                                               const void*         tau,
+                                               hipDataType         dataTypeS,
+                                               const void*         S,
+                                               hipDataType         dataTypeU,
+                                               const void*         U,
+                                               int64_t             ldu,
+                                               hipDataType         dataTypeV,
+                                               const void*         V,
+                                               int64_t             ldv,
                                                hipDataType         computeType,
                                                size_t*             lworkOnDevice,
                                                size_t*             lworkOnHost)
@@ -215,32 +4758,51 @@ try
     *lworkOnDevice = 0;
     *lworkOnHost   = 0;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolver::bufferSize_memo memo(handle,
+                                    __func__,
+                                    jobu,
+                                    jobv,
+                                    m,
+                                    n,
+                                    dataTypeA,
+                                    lda,
+                                    dataTypeS,
+                                    dataTypeU,
+                                    dataTypeV,
+                                    computeType);
+    if(memo.find(lworkOnDevice))
+        return HIPSOLVER_STATUS_SUCCESS;
+
     hipsolverStatus_t status;
-    if(dataTypeA == HIP_R_32F && dataTypeTau == HIP_R_32F && computeType == HIP_R_32F)
+    if(dataTypeA == HIP_R_32F && dataTypeS == HIP_R_32F && dataTypeU == HIP_R_32F
+       && dataTypeV == HIP_R_32F && computeType == HIP_R_32F)
     {
-        status = hipsolver::rocblas2hip_status(
-            rocsolver_sgeqrf_64((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+        status = hipsolver::gesvd_bufferSize(
+            rocsolver_sgesvd, (rocblas_handle)handle, jobu, jobv, m, n, lda, lworkOnDevice);
     }
-    else if(dataTypeA == HIP_R_64F && dataTypeTau == HIP_R_64F && computeType == HIP_R_64F)
+    else if(dataTypeA == HIP_R_64F && dataTypeS == HIP_R_64F && dataTypeU == HIP_R_64F
+            && dataTypeV == HIP_R_64F && computeType == HIP_R_64F)
     {
-        status = hipsolver::rocblas2hip_status(
-            rocsolver_dgeqrf_64((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+        status = hipsolver::gesvd_bufferSize(
+            rocsolver_dgesvd, (rocblas_handle)handle, jobu, jobv, m, n, lda, lworkOnDevice);
     }
-    else if(dataTypeA == HIP_C_32F && dataTypeTau == HIP_C_32F && computeType == HIP_C_32F)
+    else if(dataTypeA == HIP_C_32F && dataTypeS == HIP_R_32F && dataTypeU == HIP_C_32F
+            && dataTypeV == HIP_C_32F && computeType == HIP_C_32F)
     {
-        status = hipsolver::rocblas2hip_status(
-            rocsolver_cgeqrf_64((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+        status = hipsolver::gesvd_bufferSize(
+            rocsolver_cgesvd, (rocblas_handle)handle, jobu, jobv, m, n, lda, lworkOnDevice);
     }
-    else if(dataTypeA == HIP_C_64F && dataTypeTau == HIP_C_64F && computeType == HIP_C_64F)
+    else if(dataTypeA == HIP_C_64F && dataTypeS == HIP_R_64F && dataTypeU == HIP_C_64F
+            && dataTypeV == HIP_C_64F && computeType == HIP_C_64F)
     {
-        status = hipsolver::rocblas2hip_status(
-            rocsolver_zgeqrf_64((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+        status = hipsolver::gesvd_bufferSize(
+            rocsolver_zgesvd, (rocblas_handle)handle, jobu, jobv, m, n, lda, lworkOnDevice);
     }
     else
         return HIPSOLVER_STATUS_INVALID_ENUM;
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lworkOnDevice);
 
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        memo.save(*lworkOnDevice);
     return status;
 }
 catch(...)
@@ -248,21 +4810,29 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnXgeqrf(hipsolverDnHandle_t handle,
+hipsolverStatus_t hipsolverDnXgesvd(hipsolverDnHandle_t handle,
                                     hipsolverDnParams_t params,
+                                    signed char         jobu,
+                                    signed char         jobv,
                                     int64_t             m,
                                     int64_t             n,
                                     hipDataType         dataTypeA,
                                     void*               A,
                                     int64_t             lda,
-                                    hipDataType         dataTypeTau,
-                                    void*               tau,
+                                    hipDataType         dataTypeS,
+                                    void*               S,
+                                    hipDataType         dataTypeU,
+                                    void*               U,
+                                    int64_t             ldu,
+                                    hipDataType         dataTypeV,
+                                    void*               V,
+                                    int64_t             ldv,
                                     hipDataType         computeType,
                                     void*               workOnDevice,
                                     size_t              lworkOnDevice,
                                     void*               workOnHost,
                                     size_t              lworkOnHost,
-                                    int*                devInfo)
+                                    int*                info)
 try
 {
     if(!handle)
@@ -270,55 +4840,682 @@ try
     if(!params)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    if(workOnDevice && lworkOnDevice)
-        CHECK_ROCBLAS_ERROR(
-            rocblas_set_workspace((rocblas_handle)handle, workOnDevice, lworkOnDevice));
-    else
+    if(!workOnDevice || !lworkOnDevice)
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDnXgeqrf_bufferSize((rocblas_handle)handle,
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXgesvd_bufferSize((rocblas_handle)handle,
                                                            params,
+                                                           jobu,
+                                                           jobv,
                                                            m,
                                                            n,
                                                            dataTypeA,
                                                            A,
                                                            lda,
-                                                           dataTypeTau,
-                                                           tau,
+                                                           dataTypeS,
+                                                           S,
+                                                           dataTypeU,
+                                                           U,
+                                                           ldu,
+                                                           dataTypeV,
+                                                           V,
+                                                           ldv,
                                                            computeType,
                                                            &lworkOnDevice,
                                                            &lworkOnHost));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lworkOnDevice));
+        workOnDevice = nullptr;
+    }
+
+    if(dataTypeA == HIP_R_32F && dataTypeS == HIP_R_32F && dataTypeU == HIP_R_32F
+       && dataTypeV == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        return hipsolver::gesvd(rocsolver_sgesvd,
+                                (rocblas_handle)handle,
+                                jobu,
+                                jobv,
+                                m,
+                                n,
+                                A,
+                                lda,
+                                S,
+                                U,
+                                ldu,
+                                V,
+                                ldv,
+                                workOnDevice,
+                                lworkOnDevice,
+                                info);
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeS == HIP_R_64F && dataTypeU == HIP_R_64F
+            && dataTypeV == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        return hipsolver::gesvd(rocsolver_dgesvd,
+                                (rocblas_handle)handle,
+                                jobu,
+                                jobv,
+                                m,
+                                n,
+                                A,
+                                lda,
+                                S,
+                                U,
+                                ldu,
+                                V,
+                                ldv,
+                                workOnDevice,
+                                lworkOnDevice,
+                                info);
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeS == HIP_R_32F && dataTypeU == HIP_C_32F
+            && dataTypeV == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        return hipsolver::gesvd(rocsolver_cgesvd,
+                                (rocblas_handle)handle,
+                                jobu,
+                                jobv,
+                                m,
+                                n,
+                                A,
+                                lda,
+                                S,
+                                U,
+                                ldu,
+                                V,
+                                ldv,
+                                workOnDevice,
+                                lworkOnDevice,
+                                info);
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeS == HIP_R_64F && dataTypeU == HIP_C_64F
+            && dataTypeV == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        return hipsolver::gesvd(rocsolver_zgesvd,
+                                (rocblas_handle)handle,
+                                jobu,
+                                jobv,
+                                m,
+                                n,
+                                A,
+                                lda,
+                                S,
+                                U,
+                                ldu,
+                                V,
+                                ldv,
+                                workOnDevice,
+                                lworkOnDevice,
+                                info);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** GESVDP ********************/
+hipsolverStatus_t hipsolverDnXgesvdp_bufferSize(hipsolverDnHandle_t handle,
+                                                hipsolverDnParams_t params,
+                                                hipsolverEigMode_t  jobz,
+                                                int                 econ,
+                                                int64_t             m,
+                                                int64_t             n,
+                                                hipDataType         dataTypeA,
+                                                const void*         A,
+                                                int64_t             lda,
+                                                hipDataType         dataTypeS,
+                                                const void*         S,
+                                                hipDataType         dataTypeU,
+                                                const void*         U,
+                                                int64_t             ldu,
+                                                hipDataType         dataTypeV,
+                                                const void*         V,
+                                                int64_t             ldv,
+                                                hipDataType         computeType,
+                                                size_t*             lworkOnDevice,
+                                                size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    hipsolver::bufferSize_memo memo(handle,
+                                    __func__,
+                                    jobz,
+                                    econ,
+                                    m,
+                                    n,
+                                    dataTypeA,
+                                    lda,
+                                    dataTypeS,
+                                    dataTypeU,
+                                    ldu,
+                                    dataTypeV,
+                                    ldv,
+                                    computeType);
+    if(memo.find(lworkOnDevice))
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolverStatus_t status;
+    if(dataTypeA == HIP_R_32F && dataTypeS == HIP_R_32F && dataTypeU == HIP_R_32F
+       && dataTypeV == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        status = hipsolver::gesvdp_bufferSize<float, float>((rocblas_handle)handle,
+                                                            jobz,
+                                                            econ,
+                                                            m,
+                                                            n,
+                                                            lda,
+                                                            ldu,
+                                                            ldv,
+                                                            lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeS == HIP_R_64F && dataTypeU == HIP_R_64F
+            && dataTypeV == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        status = hipsolver::gesvdp_bufferSize<double, double>((rocblas_handle)handle,
+                                                              jobz,
+                                                              econ,
+                                                              m,
+                                                              n,
+                                                              lda,
+                                                              ldu,
+                                                              ldv,
+                                                              lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeS == HIP_R_32F && dataTypeU == HIP_C_32F
+            && dataTypeV == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        status = hipsolver::gesvdp_bufferSize<rocblas_float_complex, float>((rocblas_handle)handle,
+                                                                            jobz,
+                                                                            econ,
+                                                                            m,
+                                                                            n,
+                                                                            lda,
+                                                                            ldu,
+                                                                            ldv,
+                                                                            lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeS == HIP_R_64F && dataTypeU == HIP_C_64F
+            && dataTypeV == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        status = hipsolver::gesvdp_bufferSize<rocblas_double_complex, double>(
+            (rocblas_handle)handle, jobz, econ, m, n, lda, ldu, ldv, lworkOnDevice);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        memo.save(*lworkOnDevice);
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgesvdp(hipsolverDnHandle_t handle,
+                                     hipsolverDnParams_t params,
+                                     hipsolverEigMode_t  jobz,
+                                     int                 econ,
+                                     int64_t             m,
+                                     int64_t             n,
+                                     hipDataType         dataTypeA,
+                                     void*               A,
+                                     int64_t             lda,
+                                     hipDataType         dataTypeS,
+                                     void*               S,
+                                     hipDataType         dataTypeU,
+                                     void*               U,
+                                     int64_t             ldu,
+                                     hipDataType         dataTypeV,
+                                     void*               V,
+                                     int64_t             ldv,
+                                     hipDataType         computeType,
+                                     void*               workOnDevice,
+                                     size_t              lworkOnDevice,
+                                     void*               workOnHost,
+                                     size_t              lworkOnHost,
+                                     int*                info,
+                                     double*             hErrSigma)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(!workOnDevice || !lworkOnDevice)
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXgesvdp_bufferSize((rocblas_handle)handle,
+                                                            params,
+                                                            jobz,
+                                                            econ,
+                                                            m,
+                                                            n,
+                                                            dataTypeA,
+                                                            A,
+                                                            lda,
+                                                            dataTypeS,
+                                                            S,
+                                                            dataTypeU,
+                                                            U,
+                                                            ldu,
+                                                            dataTypeV,
+                                                            V,
+                                                            ldv,
+                                                            computeType,
+                                                            &lworkOnDevice,
+                                                            &lworkOnHost));
+        workOnDevice = nullptr;
+    }
+
+    if(dataTypeA == HIP_R_32F && dataTypeS == HIP_R_32F && dataTypeU == HIP_R_32F
+       && dataTypeV == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        return hipsolver::gesvdp<float, float>((rocblas_handle)handle,
+                                               jobz,
+                                               econ,
+                                               m,
+                                               n,
+                                               A,
+                                               lda,
+                                               S,
+                                               U,
+                                               ldu,
+                                               V,
+                                               ldv,
+                                               workOnDevice,
+                                               lworkOnDevice,
+                                               info,
+                                               hErrSigma);
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeS == HIP_R_64F && dataTypeU == HIP_R_64F
+            && dataTypeV == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        return hipsolver::gesvdp<double, double>((rocblas_handle)handle,
+                                                 jobz,
+                                                 econ,
+                                                 m,
+                                                 n,
+                                                 A,
+                                                 lda,
+                                                 S,
+                                                 U,
+                                                 ldu,
+                                                 V,
+                                                 ldv,
+                                                 workOnDevice,
+                                                 lworkOnDevice,
+                                                 info,
+                                                 hErrSigma);
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeS == HIP_R_32F && dataTypeU == HIP_C_32F
+            && dataTypeV == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        return hipsolver::gesvdp<rocblas_float_complex, float>((rocblas_handle)handle,
+                                                               jobz,
+                                                               econ,
+                                                               m,
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               S,
+                                                               U,
+                                                               ldu,
+                                                               V,
+                                                               ldv,
+                                                               workOnDevice,
+                                                               lworkOnDevice,
+                                                               info,
+                                                               hErrSigma);
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeS == HIP_R_64F && dataTypeU == HIP_C_64F
+            && dataTypeV == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        return hipsolver::gesvdp<rocblas_double_complex, double>((rocblas_handle)handle,
+                                                                 jobz,
+                                                                 econ,
+                                                                 m,
+                                                                 n,
+                                                                 A,
+                                                                 lda,
+                                                                 S,
+                                                                 U,
+                                                                 ldu,
+                                                                 V,
+                                                                 ldv,
+                                                                 workOnDevice,
+                                                                 lworkOnDevice,
+                                                                 info,
+                                                                 hErrSigma);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** GESVDR ********************/
+hipsolverStatus_t hipsolverDnXgesvdr_bufferSize(hipsolverDnHandle_t handle,
+                                                hipsolverDnParams_t params,
+                                                signed char         jobu,
+                                                signed char         jobv,
+                                                int64_t             m,
+                                                int64_t             n,
+                                                int64_t             k,
+                                                int64_t             p,
+                                                int64_t             niters,
+                                                hipDataType         dataTypeA,
+                                                const void*         A,
+                                                int64_t             lda,
+                                                hipDataType         dataTypeSrand,
+                                                const void*         Srand,
+                                                hipDataType         dataTypeUrand,
+                                                const void*         Urand,
+                                                int64_t             ldUrand,
+                                                hipDataType         dataTypeVrand,
+                                                const void*         Vrand,
+                                                int64_t             ldVrand,
+                                                hipDataType         computeType,
+                                                size_t*             lworkOnDevice,
+                                                size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    hipsolver::bufferSize_memo memo(handle,
+                                    __func__,
+                                    jobu,
+                                    jobv,
+                                    m,
+                                    n,
+                                    k,
+                                    p,
+                                    niters,
+                                    dataTypeA,
+                                    lda,
+                                    dataTypeSrand,
+                                    dataTypeUrand,
+                                    ldUrand,
+                                    dataTypeVrand,
+                                    ldVrand,
+                                    computeType);
+    if(memo.find(lworkOnDevice))
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolverStatus_t status;
+    if(dataTypeA == HIP_R_32F && dataTypeSrand == HIP_R_32F && dataTypeUrand == HIP_R_32F
+       && dataTypeVrand == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        status = hipsolver::gesvdr_bufferSize<float, float>((rocblas_handle)handle,
+                                                            jobu,
+                                                            jobv,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            p,
+                                                            niters,
+                                                            lda,
+                                                            ldUrand,
+                                                            ldVrand,
+                                                            1,
+                                                            lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeSrand == HIP_R_64F && dataTypeUrand == HIP_R_64F
+            && dataTypeVrand == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        status = hipsolver::gesvdr_bufferSize<double, double>((rocblas_handle)handle,
+                                                              jobu,
+                                                              jobv,
+                                                              m,
+                                                              n,
+                                                              k,
+                                                              p,
+                                                              niters,
+                                                              lda,
+                                                              ldUrand,
+                                                              ldVrand,
+                                                              1,
+                                                              lworkOnDevice);
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeSrand == HIP_R_32F && dataTypeUrand == HIP_C_32F
+            && dataTypeVrand == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        status = hipsolver::gesvdr_bufferSize<rocblas_float_complex, float>((rocblas_handle)handle,
+                                                                            jobu,
+                                                                            jobv,
+                                                                            m,
+                                                                            n,
+                                                                            k,
+                                                                            p,
+                                                                            niters,
+                                                                            lda,
+                                                                            ldUrand,
+                                                                            ldVrand,
+                                                                            1,
+                                                                            lworkOnDevice);
     }
+    else if(dataTypeA == HIP_C_64F && dataTypeSrand == HIP_R_64F && dataTypeUrand == HIP_C_64F
+            && dataTypeVrand == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        status = hipsolver::gesvdr_bufferSize<rocblas_double_complex, double>(
+            (rocblas_handle)handle,
+            jobu,
+            jobv,
+            m,
+            n,
+            k,
+            p,
+            niters,
+            lda,
+            ldUrand,
+            ldVrand,
+            1,
+            lworkOnDevice);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        memo.save(*lworkOnDevice);
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgesvdr(hipsolverDnHandle_t handle,
+                                     hipsolverDnParams_t params,
+                                     signed char         jobu,
+                                     signed char         jobv,
+                                     int64_t             m,
+                                     int64_t             n,
+                                     int64_t             k,
+                                     int64_t             p,
+                                     int64_t             niters,
+                                     hipDataType         dataTypeA,
+                                     void*               A,
+                                     int64_t             lda,
+                                     hipDataType         dataTypeSrand,
+                                     void*               Srand,
+                                     hipDataType         dataTypeUrand,
+                                     void*               Urand,
+                                     int64_t             ldUrand,
+                                     hipDataType         dataTypeVrand,
+                                     void*               Vrand,
+                                     int64_t             ldVrand,
+                                     hipDataType         computeType,
+                                     void*               workOnDevice,
+                                     size_t              lworkOnDevice,
+                                     void*               workOnHost,
+                                     size_t              lworkOnHost,
+                                     int*                info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    CHECK_ROCBLAS_ERROR(hipsolverZeroInfo((rocblas_handle)handle, devInfo, 1));
+    if(!workOnDevice || !lworkOnDevice)
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXgesvdr_bufferSize(
+            handle,
+            params,
+            jobu,
+            jobv,
+            m,
+            n,
+            k,
+            p,
+            niters,
+            dataTypeA,
+            A,
+            lda,
+            dataTypeSrand,
+            Srand,
+            dataTypeUrand,
+            Urand,
+            ldUrand,
+            dataTypeVrand,
+            Vrand,
+            ldVrand,
+            computeType,
+            &lworkOnDevice,
+            &lworkOnHost));
+        workOnDevice = nullptr;
+    }
 
-    if(dataTypeA == HIP_R_32F && dataTypeTau == HIP_R_32F && computeType == HIP_R_32F)
+    if(dataTypeA == HIP_R_32F && dataTypeSrand == HIP_R_32F && dataTypeUrand == HIP_R_32F
+       && dataTypeVrand == HIP_R_32F && computeType == HIP_R_32F)
     {
-        return hipsolver::rocblas2hip_status(
-            rocsolver_sgeqrf_64((rocblas_handle)handle, m, n, (float*)A, lda, (float*)tau));
+        return hipsolver::gesvdr<float, float>((rocblas_handle)handle,
+                                               jobu,
+                                               jobv,
+                                               m,
+                                               n,
+                                               k,
+                                               p,
+                                               niters,
+                                               A,
+                                               lda,
+                                               0,
+                                               Srand,
+                                               0,
+                                               Urand,
+                                               ldUrand,
+                                               0,
+                                               Vrand,
+                                               ldVrand,
+                                               0,
+                                               workOnDevice,
+                                               lworkOnDevice,
+                                               info,
+                                               nullptr,
+                                               1);
     }
-    else if(dataTypeA == HIP_R_64F && dataTypeTau == HIP_R_64F && computeType == HIP_R_64F)
+    else if(dataTypeA == HIP_R_64F && dataTypeSrand == HIP_R_64F && dataTypeUrand == HIP_R_64F
+            && dataTypeVrand == HIP_R_64F && computeType == HIP_R_64F)
     {
-        return hipsolver::rocblas2hip_status(
-            rocsolver_dgeqrf_64((rocblas_handle)handle, m, n, (double*)A, lda, (double*)tau));
+        return hipsolver::gesvdr<double, double>((rocblas_handle)handle,
+                                                 jobu,
+                                                 jobv,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 p,
+                                                 niters,
+                                                 A,
+                                                 lda,
+                                                 0,
+                                                 Srand,
+                                                 0,
+                                                 Urand,
+                                                 ldUrand,
+                                                 0,
+                                                 Vrand,
+                                                 ldVrand,
+                                                 0,
+                                                 workOnDevice,
+                                                 lworkOnDevice,
+                                                 info,
+                                                 nullptr,
+                                                 1);
     }
-    else if(dataTypeA == HIP_C_32F && dataTypeTau == HIP_C_32F && computeType == HIP_C_32F)
+    else if(dataTypeA == HIP_C_32F && dataTypeSrand == HIP_R_32F && dataTypeUrand == HIP_C_32F
+            && dataTypeVrand == HIP_C_32F && computeType == HIP_C_32F)
     {
-        return hipsolver::rocblas2hip_status(rocsolver_cgeqrf_64((rocblas_handle)handle,
-                                                                 m,
-                                                                 n,
-                                                                 (rocblas_float_complex*)A,
-                                                                 lda,
-                                                                 (rocblas_float_complex*)tau));
+        return hipsolver::gesvdr<rocblas_float_complex, float>((rocblas_handle)handle,
+                                                               jobu,
+                                                               jobv,
+                                                               m,
+                                                               n,
+                                                               k,
+                                                               p,
+                                                               niters,
+                                                               A,
+                                                               lda,
+                                                               0,
+                                                               Srand,
+                                                               0,
+                                                               Urand,
+                                                               ldUrand,
+                                                               0,
+                                                               Vrand,
+                                                               ldVrand,
+                                                               0,
+                                                               workOnDevice,
+                                                               lworkOnDevice,
+                                                               info,
+                                                               nullptr,
+                                                               1);
     }
-    else if(dataTypeA == HIP_C_64F && dataTypeTau == HIP_C_64F && computeType == HIP_C_64F)
+    else if(dataTypeA == HIP_C_64F && dataTypeSrand == HIP_R_64F && dataTypeUrand == HIP_C_64F
+            && dataTypeVrand == HIP_C_64F && computeType == HIP_C_64F)
     {
-        return hipsolver::rocblas2hip_status(rocsolver_zgeqrf_64((rocblas_handle)handle,
+        return hipsolver::gesvdr<rocblas_double_complex, double>((rocblas_handle)handle,
+                                                                 jobu,
+                                                                 jobv,
                                                                  m,
                                                                  n,
-                                                                 (rocblas_double_complex*)A,
+                                                                 k,
+                                                                 p,
+                                                                 niters,
+                                                                 A,
                                                                  lda,
-                                                                 (rocblas_double_complex*)tau));
+                                                                 0,
+                                                                 Srand,
+                                                                 0,
+                                                                 Urand,
+                                                                 ldUrand,
+                                                                 0,
+                                                                 Vrand,
+                                                                 ldVrand,
+                                                                 0,
+                                                                 workOnDevice,
+                                                                 lworkOnDevice,
+                                                                 info,
+                                                                 nullptr,
+                                                                 1);
     }
     else
         return HIPSOLVER_STATUS_INVALID_ENUM;
@@ -328,17 +5525,35 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/******************** GETRF ********************/
-hipsolverStatus_t hipsolverDnXgetrf_bufferSize(hipsolverDnHandle_t handle,
-                                               hipsolverDnParams_t params,
-                                               int64_t             m,
-                                               int64_t             n,
-                                               hipDataType         dataTypeA,
-                                               const void*         A,
-                                               int64_t             lda,
-                                               hipDataType         computeType,
-                                               size_t*             lworkOnDevice,
-                                               size_t*             lworkOnHost)
+/******************** GESVDR_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverDnXgesvdrStridedBatched_bufferSize(hipsolverDnHandle_t handle,
+                                                              hipsolverDnParams_t params,
+                                                              signed char         jobu,
+                                                              signed char         jobv,
+                                                              int64_t             m,
+                                                              int64_t             n,
+                                                              int64_t             k,
+                                                              int64_t             p,
+                                                              int64_t             niters,
+                                                              hipDataType         dataTypeA,
+                                                              const void*         A,
+                                                              int64_t             lda,
+                                                              int64_t             strideA,
+                                                              hipDataType         dataTypeSrand,
+                                                              const void*         Srand,
+                                                              int64_t             strideS,
+                                                              hipDataType         dataTypeUrand,
+                                                              const void*         Urand,
+                                                              int64_t             ldUrand,
+                                                              int64_t             strideU,
+                                                              hipDataType         dataTypeVrand,
+                                                              const void*         Vrand,
+                                                              int64_t             ldVrand,
+                                                              int64_t             strideV,
+                                                              hipDataType         computeType,
+                                                              size_t*             lworkOnDevice,
+                                                              size_t*             lworkOnHost,
+                                                              int64_t             batch_count)
 try
 {
     if(!handle)
@@ -351,36 +5566,102 @@ try
     *lworkOnDevice = 0;
     *lworkOnHost   = 0;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolver::bufferSize_memo memo(handle,
+                                    __func__,
+                                    jobu,
+                                    jobv,
+                                    m,
+                                    n,
+                                    k,
+                                    p,
+                                    niters,
+                                    dataTypeA,
+                                    lda,
+                                    dataTypeSrand,
+                                    dataTypeUrand,
+                                    ldUrand,
+                                    dataTypeVrand,
+                                    ldVrand,
+                                    computeType,
+                                    batch_count);
+    if(memo.find(lworkOnDevice))
+        return HIPSOLVER_STATUS_SUCCESS;
+
     hipsolverStatus_t status;
-    if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+    if(dataTypeA == HIP_R_32F && dataTypeSrand == HIP_R_32F && dataTypeUrand == HIP_R_32F
+       && dataTypeVrand == HIP_R_32F && computeType == HIP_R_32F)
     {
-        status = hipsolver::rocblas2hip_status(
-            rocsolver_sgetrf_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
-        rocsolver_sgetrf_npvt_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+        status = hipsolver::gesvdr_bufferSize<float, float>((rocblas_handle)handle,
+                                                            jobu,
+                                                            jobv,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            p,
+                                                            niters,
+                                                            lda,
+                                                            ldUrand,
+                                                            ldVrand,
+                                                            batch_count,
+                                                            lworkOnDevice);
     }
-    else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+    else if(dataTypeA == HIP_R_64F && dataTypeSrand == HIP_R_64F && dataTypeUrand == HIP_R_64F
+            && dataTypeVrand == HIP_R_64F && computeType == HIP_R_64F)
     {
-        status = hipsolver::rocblas2hip_status(
-            rocsolver_dgetrf_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
-        rocsolver_dgetrf_npvt_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+        status = hipsolver::gesvdr_bufferSize<double, double>((rocblas_handle)handle,
+                                                              jobu,
+                                                              jobv,
+                                                              m,
+                                                              n,
+                                                              k,
+                                                              p,
+                                                              niters,
+                                                              lda,
+                                                              ldUrand,
+                                                              ldVrand,
+                                                              batch_count,
+                                                              lworkOnDevice);
     }
-    else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+    else if(dataTypeA == HIP_C_32F && dataTypeSrand == HIP_R_32F && dataTypeUrand == HIP_C_32F
+            && dataTypeVrand == HIP_C_32F && computeType == HIP_C_32F)
     {
-        status = hipsolver::rocblas2hip_status(
-            rocsolver_cgetrf_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
-        rocsolver_cgetrf_npvt_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+        status = hipsolver::gesvdr_bufferSize<rocblas_float_complex, float>((rocblas_handle)handle,
+                                                                            jobu,
+                                                                            jobv,
+                                                                            m,
+                                                                            n,
+                                                                            k,
+                                                                            p,
+                                                                            niters,
+                                                                            lda,
+                                                                            ldUrand,
+                                                                            ldVrand,
+                                                                            batch_count,
+                                                                            lworkOnDevice);
     }
-    else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+    else if(dataTypeA == HIP_C_64F && dataTypeSrand == HIP_R_64F && dataTypeUrand == HIP_C_64F
+            && dataTypeVrand == HIP_C_64F && computeType == HIP_C_64F)
     {
-        status = hipsolver::rocblas2hip_status(
-            rocsolver_zgetrf_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
-        rocsolver_zgetrf_npvt_info32((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+        status = hipsolver::gesvdr_bufferSize<rocblas_double_complex, double>(
+            (rocblas_handle)handle,
+            jobu,
+            jobv,
+            m,
+            n,
+            k,
+            p,
+            niters,
+            lda,
+            ldUrand,
+            ldVrand,
+            batch_count,
+            lworkOnDevice);
     }
     else
         return HIPSOLVER_STATUS_INVALID_ENUM;
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lworkOnDevice);
 
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        memo.save(*lworkOnDevice);
     return status;
 }
 catch(...)
@@ -388,20 +5669,38 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnXgetrf(hipsolverDnHandle_t handle,
-                                    hipsolverDnParams_t params,
-                                    int64_t             m,
-                                    int64_t             n,
-                                    hipDataType         dataTypeA,
-                                    void*               A,
-                                    int64_t             lda,
-                                    int64_t*            devIpiv,
-                                    hipDataType         computeType,
-                                    void*               workOnDevice,
-                                    size_t              lworkOnDevice,
-                                    void*               workOnHost,
-                                    size_t              lworkOnHost,
-                                    int*                devInfo)
+hipsolverStatus_t hipsolverDnXgesvdrStridedBatched(hipsolverDnHandle_t handle,
+                                                   hipsolverDnParams_t params,
+                                                   signed char         jobu,
+                                                   signed char         jobv,
+                                                   int64_t             m,
+                                                   int64_t             n,
+                                                   int64_t             k,
+                                                   int64_t             p,
+                                                   int64_t             niters,
+                                                   hipDataType         dataTypeA,
+                                                   void*               A,
+                                                   int64_t             lda,
+                                                   int64_t             strideA,
+                                                   hipDataType         dataTypeSrand,
+                                                   void*               Srand,
+                                                   int64_t             strideS,
+                                                   hipDataType         dataTypeUrand,
+                                                   void*               Urand,
+                                                   int64_t             ldUrand,
+                                                   int64_t             strideU,
+                                                   hipDataType         dataTypeVrand,
+                                                   void*               Vrand,
+                                                   int64_t             ldVrand,
+                                                   int64_t             strideV,
+                                                   hipDataType         computeType,
+                                                   void*               workOnDevice,
+                                                   size_t              lworkOnDevice,
+                                                   void*               workOnHost,
+                                                   size_t              lworkOnHost,
+                                                   int*                info,
+                                                   double*             hRnrmF,
+                                                   int64_t             batch_count)
 try
 {
     if(!handle)
@@ -409,163 +5708,215 @@ try
     if(!params)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    if(workOnDevice && lworkOnDevice)
-        CHECK_ROCBLAS_ERROR(
-            rocblas_set_workspace((rocblas_handle)handle, workOnDevice, lworkOnDevice));
-    else
+    if(!workOnDevice || !lworkOnDevice)
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDnXgetrf_bufferSize((rocblas_handle)handle,
-                                                           params,
-                                                           m,
-                                                           n,
-                                                           dataTypeA,
-                                                           A,
-                                                           lda,
-                                                           computeType,
-                                                           &lworkOnDevice,
-                                                           &lworkOnHost));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lworkOnDevice));
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXgesvdrStridedBatched_bufferSize(
+            handle,
+            params,
+            jobu,
+            jobv,
+            m,
+            n,
+            k,
+            p,
+            niters,
+            dataTypeA,
+            A,
+            lda,
+            strideA,
+            dataTypeSrand,
+            Srand,
+            strideS,
+            dataTypeUrand,
+            Urand,
+            ldUrand,
+            strideU,
+            dataTypeVrand,
+            Vrand,
+            ldVrand,
+            strideV,
+            computeType,
+            &lworkOnDevice,
+            &lworkOnHost,
+            batch_count));
+        workOnDevice = nullptr;
     }
 
-    if(devIpiv != nullptr)
+    if(dataTypeA == HIP_R_32F && dataTypeSrand == HIP_R_32F && dataTypeUrand == HIP_R_32F
+       && dataTypeVrand == HIP_R_32F && computeType == HIP_R_32F)
     {
-        if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
-        {
-            return hipsolver::rocblas2hip_status(rocsolver_sgetrf_info32(
-                (rocblas_handle)handle, m, n, (float*)A, lda, devIpiv, devInfo));
-        }
-        else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
-        {
-            return hipsolver::rocblas2hip_status(rocsolver_dgetrf_info32(
-                (rocblas_handle)handle, m, n, (double*)A, lda, devIpiv, devInfo));
-        }
-        else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
-        {
-            return hipsolver::rocblas2hip_status(rocsolver_cgetrf_info32(
-                (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, devIpiv, devInfo));
-        }
-        else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
-        {
-            return hipsolver::rocblas2hip_status(rocsolver_zgetrf_info32(
-                (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, devIpiv, devInfo));
-        }
-        else
-            return HIPSOLVER_STATUS_INVALID_ENUM;
+        return hipsolver::gesvdr<float, float>((rocblas_handle)handle,
+                                               jobu,
+                                               jobv,
+                                               m,
+                                               n,
+                                               k,
+                                               p,
+                                               niters,
+                                               A,
+                                               lda,
+                                               strideA,
+                                               Srand,
+                                               strideS,
+                                               Urand,
+                                               ldUrand,
+                                               strideU,
+                                               Vrand,
+                                               ldVrand,
+                                               strideV,
+                                               workOnDevice,
+                                               lworkOnDevice,
+                                               info,
+                                               hRnrmF,
+                                               batch_count);
     }
-    else
+    else if(dataTypeA == HIP_R_64F && dataTypeSrand == HIP_R_64F && dataTypeUrand == HIP_R_64F
+            && dataTypeVrand == HIP_R_64F && computeType == HIP_R_64F)
     {
-        if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
-        {
-            return hipsolver::rocblas2hip_status(rocsolver_sgetrf_npvt_info32(
-                (rocblas_handle)handle, m, n, (float*)A, lda, devInfo));
-        }
-        else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
-        {
-            return hipsolver::rocblas2hip_status(rocsolver_dgetrf_npvt_info32(
-                (rocblas_handle)handle, m, n, (double*)A, lda, devInfo));
-        }
-        else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
-        {
-            return hipsolver::rocblas2hip_status(rocsolver_cgetrf_npvt_info32(
-                (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, devInfo));
-        }
-        else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
-        {
-            return hipsolver::rocblas2hip_status(rocsolver_zgetrf_npvt_info32(
-                (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, devInfo));
-        }
-        else
-            return HIPSOLVER_STATUS_INVALID_ENUM;
+        return hipsolver::gesvdr<double, double>((rocblas_handle)handle,
+                                                 jobu,
+                                                 jobv,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 p,
+                                                 niters,
+                                                 A,
+                                                 lda,
+                                                 strideA,
+                                                 Srand,
+                                                 strideS,
+                                                 Urand,
+                                                 ldUrand,
+                                                 strideU,
+                                                 Vrand,
+                                                 ldVrand,
+                                                 strideV,
+                                                 workOnDevice,
+                                                 lworkOnDevice,
+                                                 info,
+                                                 hRnrmF,
+                                                 batch_count);
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeSrand == HIP_R_32F && dataTypeUrand == HIP_C_32F
+            && dataTypeVrand == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        return hipsolver::gesvdr<rocblas_float_complex, float>((rocblas_handle)handle,
+                                                               jobu,
+                                                               jobv,
+                                                               m,
+                                                               n,
+                                                               k,
+                                                               p,
+                                                               niters,
+                                                               A,
+                                                               lda,
+                                                               strideA,
+                                                               Srand,
+                                                               strideS,
+                                                               Urand,
+                                                               ldUrand,
+                                                               strideU,
+                                                               Vrand,
+                                                               ldVrand,
+                                                               strideV,
+                                                               workOnDevice,
+                                                               lworkOnDevice,
+                                                               info,
+                                                               hRnrmF,
+                                                               batch_count);
     }
+    else if(dataTypeA == HIP_C_64F && dataTypeSrand == HIP_R_64F && dataTypeUrand == HIP_C_64F
+            && dataTypeVrand == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        return hipsolver::gesvdr<rocblas_double_complex, double>((rocblas_handle)handle,
+                                                                 jobu,
+                                                                 jobv,
+                                                                 m,
+                                                                 n,
+                                                                 k,
+                                                                 p,
+                                                                 niters,
+                                                                 A,
+                                                                 lda,
+                                                                 strideA,
+                                                                 Srand,
+                                                                 strideS,
+                                                                 Urand,
+                                                                 ldUrand,
+                                                                 strideU,
+                                                                 Vrand,
+                                                                 ldVrand,
+                                                                 strideV,
+                                                                 workOnDevice,
+                                                                 lworkOnDevice,
+                                                                 info,
+                                                                 hRnrmF,
+                                                                 batch_count);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** GETRS ********************/
-hipsolverStatus_t hipsolverInternalXgetrs_bufferSize(hipsolverHandle_t    handle,
-                                                     hipsolverDnParams_t  params,
-                                                     hipsolverOperation_t trans,
-                                                     int64_t              n,
-                                                     int64_t              nrhs,
-                                                     hipDataType          dataTypeA,
-                                                     const void*          A,
-                                                     int64_t              lda,
-                                                     const int64_t*       devIpiv,
-                                                     hipDataType          dataTypeB,
-                                                     void*                B,
-                                                     int64_t              ldb,
-                                                     size_t*              lwork)
+/******************** SYTRS ********************/
+hipsolverStatus_t hipsolverDnXsytrs_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverFillMode_t uplo,
+                                               int64_t             n,
+                                               int64_t             nrhs,
+                                               hipDataType         dataTypeA,
+                                               const void*         A,
+                                               int64_t             lda,
+                                               const int64_t*      devIpiv,
+                                               hipDataType         dataTypeB,
+                                               void*               B,
+                                               int64_t             ldb,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!params)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!lwork)
+    if(!lworkOnDevice || !lworkOnHost)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    hipsolver::bufferSize_memo memo(
+        handle, __func__, uplo, n, nrhs, dataTypeA, lda, dataTypeB, ldb);
+    if(memo.find(lworkOnDevice))
+        return HIPSOLVER_STATUS_SUCCESS;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status;
     if(dataTypeA == HIP_R_32F && dataTypeB == HIP_R_32F)
     {
-        status = hipsolver::rocblas2hip_status(
-            rocsolver_sgetrs_64((rocblas_handle)handle,
-                                hipsolver::hip2rocblas_operation(trans),
-                                n,
-                                nrhs,
-                                nullptr,
-                                lda,
-                                nullptr,
-                                nullptr,
-                                ldb));
+        status = hipsolver::sytrs_64_bufferSize<float>(
+            (rocblas_handle)handle, uplo, n, nrhs, lda, ldb, lworkOnDevice);
     }
     else if(dataTypeA == HIP_R_64F && dataTypeB == HIP_R_64F)
     {
-        status = hipsolver::rocblas2hip_status(
-            rocsolver_dgetrs_64((rocblas_handle)handle,
-                                hipsolver::hip2rocblas_operation(trans),
-                                n,
-                                nrhs,
-                                nullptr,
-                                lda,
-                                nullptr,
-                                nullptr,
-                                ldb));
+        status = hipsolver::sytrs_64_bufferSize<double>(
+            (rocblas_handle)handle, uplo, n, nrhs, lda, ldb, lworkOnDevice);
     }
     else if(dataTypeA == HIP_C_32F && dataTypeB == HIP_C_32F)
     {
-        status = hipsolver::rocblas2hip_status(
-            rocsolver_cgetrs_64((rocblas_handle)handle,
-                                hipsolver::hip2rocblas_operation(trans),
-                                n,
-                                nrhs,
-                                nullptr,
-                                lda,
-                                nullptr,
-                                nullptr,
-                                ldb));
+        status = hipsolver::sytrs_64_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, uplo, n, nrhs, lda, ldb, lworkOnDevice);
     }
     else if(dataTypeA == HIP_C_64F && dataTypeB == HIP_C_64F)
     {
-        status = hipsolver::rocblas2hip_status(
-            rocsolver_zgetrs_64((rocblas_handle)handle,
-                                hipsolver::hip2rocblas_operation(trans),
-                                n,
-                                nrhs,
-                                nullptr,
-                                lda,
-                                nullptr,
-                                nullptr,
-                                ldb));
+        status = hipsolver::sytrs_64_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, uplo, n, nrhs, lda, ldb, lworkOnDevice);
     }
     else
         return HIPSOLVER_STATUS_INVALID_ENUM;
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lwork);
 
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        memo.save(*lworkOnDevice);
     return status;
 }
 catch(...)
@@ -573,90 +5924,104 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnXgetrs(hipsolverDnHandle_t  handle,
-                                    hipsolverDnParams_t  params,
-                                    hipsolverOperation_t trans,
-                                    int64_t              n,
-                                    int64_t              nrhs,
-                                    hipDataType          dataTypeA,
-                                    const void*          A,
-                                    int64_t              lda,
-                                    const int64_t*       devIpiv,
-                                    hipDataType          dataTypeB,
-                                    void*                B,
-                                    int64_t              ldb,
-                                    int*                 devInfo)
+hipsolverStatus_t hipsolverDnXsytrs(hipsolverDnHandle_t handle,
+                                    hipsolverFillMode_t uplo,
+                                    int64_t             n,
+                                    int64_t             nrhs,
+                                    hipDataType         dataTypeA,
+                                    const void*         A,
+                                    int64_t             lda,
+                                    const int64_t*      devIpiv,
+                                    hipDataType         dataTypeB,
+                                    void*               B,
+                                    int64_t             ldb,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
 try
 {
-    size_t lwork;
-    CHECK_HIPSOLVER_ERROR(hipsolverInternalXgetrs_bufferSize((rocblas_handle)handle,
-                                                             params,
-                                                             trans,
-                                                             n,
-                                                             nrhs,
-                                                             dataTypeA,
-                                                             A,
-                                                             lda,
-                                                             devIpiv,
-                                                             dataTypeB,
-                                                             B,
-                                                             ldb,
-                                                             &lwork));
-    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    CHECK_ROCBLAS_ERROR(hipsolverZeroInfo((rocblas_handle)handle, devInfo, 1));
+    if(!workOnDevice || !lworkOnDevice)
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXsytrs_bufferSize((rocblas_handle)handle,
+                                                           uplo,
+                                                           n,
+                                                           nrhs,
+                                                           dataTypeA,
+                                                           A,
+                                                           lda,
+                                                           devIpiv,
+                                                           dataTypeB,
+                                                           B,
+                                                           ldb,
+                                                           &lworkOnDevice,
+                                                           &lworkOnHost));
+        workOnDevice = nullptr;
+    }
 
     if(dataTypeA == HIP_R_32F && dataTypeB == HIP_R_32F)
     {
-        return hipsolver::rocblas2hip_status(
-            rocsolver_sgetrs_64((rocblas_handle)handle,
-                                hipsolver::hip2rocblas_operation(trans),
-                                n,
-                                nrhs,
-                                (float*)const_cast<void*>(A),
-                                lda,
-                                const_cast<int64_t*>(devIpiv),
-                                (float*)B,
-                                ldb));
+        return hipsolver::sytrs_64<float>((rocblas_handle)handle,
+                                          uplo,
+                                          n,
+                                          nrhs,
+                                          A,
+                                          lda,
+                                          devIpiv,
+                                          B,
+                                          ldb,
+                                          workOnDevice,
+                                          lworkOnDevice,
+                                          info);
     }
     else if(dataTypeA == HIP_R_64F && dataTypeB == HIP_R_64F)
     {
-        return hipsolver::rocblas2hip_status(
-            rocsolver_dgetrs_64((rocblas_handle)handle,
-                                hipsolver::hip2rocblas_operation(trans),
-                                n,
-                                nrhs,
-                                (double*)const_cast<void*>(A),
-                                lda,
-                                const_cast<int64_t*>(devIpiv),
-                                (double*)B,
-                                ldb));
+        return hipsolver::sytrs_64<double>((rocblas_handle)handle,
+                                           uplo,
+                                           n,
+                                           nrhs,
+                                           A,
+                                           lda,
+                                           devIpiv,
+                                           B,
+                                           ldb,
+                                           workOnDevice,
+                                           lworkOnDevice,
+                                           info);
     }
     else if(dataTypeA == HIP_C_32F && dataTypeB == HIP_C_32F)
     {
-        return hipsolver::rocblas2hip_status(
-            rocsolver_cgetrs_64((rocblas_handle)handle,
-                                hipsolver::hip2rocblas_operation(trans),
-                                n,
-                                nrhs,
-                                (rocblas_float_complex*)const_cast<void*>(A),
-                                lda,
-                                const_cast<int64_t*>(devIpiv),
-                                (rocblas_float_complex*)B,
-                                ldb));
+        return hipsolver::sytrs_64<rocblas_float_complex>((rocblas_handle)handle,
+                                                          uplo,
+                                                          n,
+                                                          nrhs,
+                                                          A,
+                                                          lda,
+                                                          devIpiv,
+                                                          B,
+                                                          ldb,
+                                                          workOnDevice,
+                                                          lworkOnDevice,
+                                                          info);
     }
     else if(dataTypeA == HIP_C_64F && dataTypeB == HIP_C_64F)
     {
-        return hipsolver::rocblas2hip_status(
-            rocsolver_zgetrs_64((rocblas_handle)handle,
-                                hipsolver::hip2rocblas_operation(trans),
-                                n,
-                                nrhs,
-                                (rocblas_double_complex*)const_cast<void*>(A),
-                                lda,
-                                const_cast<int64_t*>(devIpiv),
-                                (rocblas_double_complex*)B,
-                                ldb));
+        return hipsolver::sytrs_64<rocblas_double_complex>((rocblas_handle)handle,
+                                                           uplo,
+                                                           n,
+                                                           nrhs,
+                                                           A,
+                                                           lda,
+                                                           devIpiv,
+                                                           B,
+                                                           ldb,
+                                                           workOnDevice,
+                                                           lworkOnDevice,
+                                                           info);
     }
     else
         return HIPSOLVER_STATUS_INVALID_ENUM;
@@ -666,55 +6031,56 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/******************** POTRF ********************/
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrf_bufferSize(hipsolverDnHandle_t handle,
-                                                                hipsolverDnParams_t params,
-                                                                hipsolverFillMode_t uplo,
-                                                                int64_t             n,
-                                                                hipDataType         dataTypeA,
-                                                                const void*         A,
-                                                                int64_t             lda,
-                                                                hipDataType         computeType,
-                                                                size_t*             lworkOnDevice,
-                                                                size_t*             lworkOnHost)
+/******************** TRTRI ********************/
+hipsolverStatus_t hipsolverDnXtrtri_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverFillMode_t uplo,
+                                               hipsolverDiagType_t diag,
+                                               int64_t             n,
+                                               hipDataType         dataTypeA,
+                                               void*               A,
+                                               int64_t             lda,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!params)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
     if(!lworkOnDevice || !lworkOnHost)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
     *lworkOnDevice = 0;
     *lworkOnHost   = 0;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status;
+    hipsolver::bufferSize_memo memo(handle, __func__, uplo, diag, n, dataTypeA, lda);
+    if(memo.find(lworkOnDevice))
+        return HIPSOLVER_STATUS_SUCCESS;
 
-    if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+    hipsolverStatus_t status;
+    if(dataTypeA == HIP_R_32F)
     {
-        status = hipsolver::rocblas2hip_status(rocsolver_spotrf_64(
-            (rocblas_handle)handle, hipsolver::hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+        status = hipsolver::trtri_bufferSize(
+            rocsolver_strtri, (rocblas_handle)handle, uplo, diag, n, lda, lworkOnDevice);
     }
-    else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+    else if(dataTypeA == HIP_R_64F)
     {
-        status = hipsolver::rocblas2hip_status(rocsolver_dpotrf_64(
-            (rocblas_handle)handle, hipsolver::hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+        status = hipsolver::trtri_bufferSize(
+            rocsolver_dtrtri, (rocblas_handle)handle, uplo, diag, n, lda, lworkOnDevice);
     }
-    else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+    else if(dataTypeA == HIP_C_32F)
     {
-        status = hipsolver::rocblas2hip_status(rocsolver_cpotrf_64(
-            (rocblas_handle)handle, hipsolver::hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+        status = hipsolver::trtri_bufferSize(
+            rocsolver_ctrtri, (rocblas_handle)handle, uplo, diag, n, lda, lworkOnDevice);
     }
-    else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+    else if(dataTypeA == HIP_C_64F)
     {
-        status = hipsolver::rocblas2hip_status(rocsolver_zpotrf_64(
-            (rocblas_handle)handle, hipsolver::hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+        status = hipsolver::trtri_bufferSize(
+            rocsolver_ztrtri, (rocblas_handle)handle, uplo, diag, n, lda, lworkOnDevice);
     }
     else
         return HIPSOLVER_STATUS_INVALID_ENUM;
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lworkOnDevice);
+
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        memo.save(*lworkOnDevice);
     return status;
 }
 catch(...)
@@ -722,73 +6088,88 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrf(hipsolverDnHandle_t handle,
-                                                     hipsolverDnParams_t params,
-                                                     hipsolverFillMode_t uplo,
-                                                     int64_t             n,
-                                                     hipDataType         dataTypeA,
-                                                     void*               A,
-                                                     int64_t             lda,
-                                                     hipDataType         computeType,
-                                                     void*               workOnDevice,
-                                                     size_t              lworkOnDevice,
-                                                     void*               workOnHost,
-                                                     size_t              lworkOnHost,
-                                                     int*                info)
+hipsolverStatus_t hipsolverDnXtrtri(hipsolverDnHandle_t handle,
+                                    hipsolverFillMode_t uplo,
+                                    hipsolverDiagType_t diag,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    void*               A,
+                                    int64_t             lda,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!params)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    if(workOnDevice && lworkOnDevice)
-        CHECK_ROCBLAS_ERROR(
-            rocblas_set_workspace((rocblas_handle)handle, workOnDevice, lworkOnDevice));
-    else
+    if(!workOnDevice || !lworkOnDevice)
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDnXpotrf_bufferSize((rocblas_handle)handle,
-                                                           params,
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXtrtri_bufferSize((rocblas_handle)handle,
                                                            uplo,
+                                                           diag,
                                                            n,
                                                            dataTypeA,
                                                            A,
                                                            lda,
-                                                           computeType,
                                                            &lworkOnDevice,
                                                            &lworkOnHost));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lworkOnDevice));
+        workOnDevice = nullptr;
     }
 
-    if(dataTypeA == HIP_R_32F && computeType == HIP_R_32F)
+    if(dataTypeA == HIP_R_32F)
     {
-        return hipsolver::rocblas2hip_status(rocsolver_spotrf_info32(
-            (rocblas_handle)handle, hipsolver::hip2rocblas_fill(uplo), n, (float*)A, lda, info));
+        return hipsolver::trtri(rocsolver_strtri,
+                                (rocblas_handle)handle,
+                                uplo,
+                                diag,
+                                n,
+                                A,
+                                lda,
+                                workOnDevice,
+                                lworkOnDevice,
+                                info);
     }
-    else if(dataTypeA == HIP_R_64F && computeType == HIP_R_64F)
+    else if(dataTypeA == HIP_R_64F)
     {
-        return hipsolver::rocblas2hip_status(rocsolver_dpotrf_info32(
-            (rocblas_handle)handle, hipsolver::hip2rocblas_fill(uplo), n, (double*)A, lda, info));
+        return hipsolver::trtri(rocsolver_dtrtri,
+                                (rocblas_handle)handle,
+                                uplo,
+                                diag,
+                                n,
+                                A,
+                                lda,
+                                workOnDevice,
+                                lworkOnDevice,
+                                info);
     }
-    else if(dataTypeA == HIP_C_32F && computeType == HIP_C_32F)
+    else if(dataTypeA == HIP_C_32F)
     {
-        return hipsolver::rocblas2hip_status(
-            rocsolver_cpotrf_info32((rocblas_handle)handle,
-                                    hipsolver::hip2rocblas_fill(uplo),
-                                    n,
-                                    (rocblas_float_complex*)A,
-                                    lda,
-                                    info));
+        return hipsolver::trtri(rocsolver_ctrtri,
+                                (rocblas_handle)handle,
+                                uplo,
+                                diag,
+                                n,
+                                A,
+                                lda,
+                                workOnDevice,
+                                lworkOnDevice,
+                                info);
     }
-    else if(dataTypeA == HIP_C_64F && computeType == HIP_C_64F)
+    else if(dataTypeA == HIP_C_64F)
     {
-        return hipsolver::rocblas2hip_status(
-            rocsolver_zpotrf_info32((rocblas_handle)handle,
-                                    hipsolver::hip2rocblas_fill(uplo),
-                                    n,
-                                    (rocblas_double_complex*)A,
-                                    lda,
-                                    info));
+        return hipsolver::trtri(rocsolver_ztrtri,
+                                (rocblas_handle)handle,
+                                uplo,
+                                diag,
+                                n,
+                                A,
+                                lda,
+                                workOnDevice,
+                                lworkOnDevice,
+                                info);
     }
     else
         return HIPSOLVER_STATUS_INVALID_ENUM;
@@ -798,69 +6179,316 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/******************** POTRS ********************/
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrs(hipsolverDnHandle_t handle,
-                                                     hipsolverDnParams_t params,
-                                                     hipsolverFillMode_t uplo,
-                                                     int64_t             n,
-                                                     int64_t             nrhs,
-                                                     hipDataType         dataTypeA,
-                                                     const void*         A,
-                                                     int64_t             lda,
-                                                     hipDataType         dataTypeB,
-                                                     void*               B,
-                                                     int64_t             ldb,
-                                                     int*                info)
+/******************** SYEV AUTO ********************/
+hipsolverStatus_t hipsolverDnSetSyevAutoAlgorithm(hipsolverDnHandle_t      handle,
+                                                  hipsolverSyevAlgorithm_t alg)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(alg != HIPSOLVER_SYEV_ALG_AUTO && alg != HIPSOLVER_SYEV_ALG_SYEVD
+       && alg != HIPSOLVER_SYEV_ALG_SYEVJ && alg != HIPSOLVER_SYEV_ALG_SYEVDX)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    hipsolver::handle_data_lock data((rocblas_handle)handle);
+    data->syev_algorithm = alg;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnGetSyevAutoAlgorithm(hipsolverDnHandle_t       handle,
+                                                  hipsolverEigMode_t        jobz,
+                                                  hipsolverEigRange_t       range,
+                                                  int64_t                   n,
+                                                  int64_t                   il,
+                                                  int64_t                   iu,
+                                                  int64_t                   batch_count,
+                                                  hipsolverSyevAlgorithm_t* alg)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!alg)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the arguments that do not affect the choice are given valid values
+    CHECK_HIPSOLVER_ERROR(hipsolver::syevAuto_argCheck(
+        jobz, range, HIPSOLVER_FILL_MODE_LOWER, n, std::max(n, int64_t(1)), il, iu, batch_count));
+
+    *alg = hipsolver::syevAuto_algorithm(
+        (rocblas_handle)handle, jobz, range, n, il, iu, batch_count);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsyevAuto_bufferSize(hipsolverDnHandle_t handle,
+                                                  hipsolverDnParams_t params,
+                                                  hipsolverEigMode_t  jobz,
+                                                  hipsolverEigRange_t range,
+                                                  hipsolverFillMode_t uplo,
+                                                  int64_t             n,
+                                                  hipDataType         dataTypeA,
+                                                  const void*         A,
+                                                  int64_t             lda,
+                                                  int64_t             strideA,
+                                                  int64_t             il,
+                                                  int64_t             iu,
+                                                  hipDataType         dataTypeW,
+                                                  const void*         W,
+                                                  int64_t             strideW,
+                                                  hipDataType         computeType,
+                                                  size_t*             lworkOnDevice,
+                                                  size_t*             lworkOnHost,
+                                                  int64_t             batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(!params)
         return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    if(dataTypeA == HIP_R_32F && dataTypeB == HIP_R_32F)
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    hipsolverSyevAlgorithm_t alg = hipsolver::syevAuto_algorithm(
+        (rocblas_handle)handle, jobz, range, n, il, iu, batch_count);
+
+    hipsolver::bufferSize_memo memo(handle,
+                                    __func__,
+                                    alg,
+                                    jobz,
+                                    range,
+                                    uplo,
+                                    n,
+                                    dataTypeA,
+                                    lda,
+                                    strideA,
+                                    il,
+                                    iu,
+                                    dataTypeW,
+                                    computeType,
+                                    batch_count);
+    if(memo.find(lworkOnDevice))
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolverStatus_t status;
+    if(dataTypeA == HIP_R_32F && dataTypeW == HIP_R_32F && computeType == HIP_R_32F)
     {
-        return hipsolver::rocblas2hip_status(rocsolver_spotrs((rocblas_handle)handle,
-                                                              hipsolver::hip2rocblas_fill(uplo),
+        status = hipsolver::syevAuto_bufferSize<float, float>((rocblas_handle)handle,
+                                                              alg,
+                                                              jobz,
+                                                              range,
+                                                              uplo,
                                                               n,
-                                                              nrhs,
-                                                              (float*)A,
                                                               lda,
-                                                              (float*)B,
-                                                              ldb));
+                                                              strideA,
+                                                              il,
+                                                              iu,
+                                                              batch_count,
+                                                              lworkOnDevice);
     }
-    else if(dataTypeA == HIP_R_64F && dataTypeB == HIP_R_64F)
+    else if(dataTypeA == HIP_R_64F && dataTypeW == HIP_R_64F && computeType == HIP_R_64F)
     {
-        return hipsolver::rocblas2hip_status(rocsolver_dpotrs((rocblas_handle)handle,
-                                                              hipsolver::hip2rocblas_fill(uplo),
-                                                              n,
-                                                              nrhs,
-                                                              (double*)A,
-                                                              lda,
-                                                              (double*)B,
-                                                              ldb));
+        status = hipsolver::syevAuto_bufferSize<double, double>((rocblas_handle)handle,
+                                                                alg,
+                                                                jobz,
+                                                                range,
+                                                                uplo,
+                                                                n,
+                                                                lda,
+                                                                strideA,
+                                                                il,
+                                                                iu,
+                                                                batch_count,
+                                                                lworkOnDevice);
     }
-    else if(dataTypeA == HIP_C_32F && dataTypeB == HIP_C_32F)
+    else if(dataTypeA == HIP_C_32F && dataTypeW == HIP_R_32F && computeType == HIP_C_32F)
     {
-        return hipsolver::rocblas2hip_status(rocsolver_cpotrs((rocblas_handle)handle,
-                                                              hipsolver::hip2rocblas_fill(uplo),
-                                                              n,
-                                                              nrhs,
-                                                              (rocblas_float_complex*)A,
-                                                              lda,
-                                                              (rocblas_float_complex*)B,
-                                                              ldb));
+        status = hipsolver::syevAuto_bufferSize<rocblas_float_complex, float>(
+            (rocblas_handle)handle,
+            alg,
+            jobz,
+            range,
+            uplo,
+            n,
+            lda,
+            strideA,
+            il,
+            iu,
+            batch_count,
+            lworkOnDevice);
     }
-    else if(dataTypeA == HIP_C_64F && dataTypeB == HIP_C_64F)
+    else if(dataTypeA == HIP_C_64F && dataTypeW == HIP_R_64F && computeType == HIP_C_64F)
     {
-        return hipsolver::rocblas2hip_status(rocsolver_zpotrs((rocblas_handle)handle,
-                                                              hipsolver::hip2rocblas_fill(uplo),
+        status = hipsolver::syevAuto_bufferSize<rocblas_double_complex, double>(
+            (rocblas_handle)handle,
+            alg,
+            jobz,
+            range,
+            uplo,
+            n,
+            lda,
+            strideA,
+            il,
+            iu,
+            batch_count,
+            lworkOnDevice);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        memo.save(*lworkOnDevice);
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsyevAuto(hipsolverDnHandle_t handle,
+                                       hipsolverDnParams_t params,
+                                       hipsolverEigMode_t  jobz,
+                                       hipsolverEigRange_t range,
+                                       hipsolverFillMode_t uplo,
+                                       int64_t             n,
+                                       hipDataType         dataTypeA,
+                                       void*               A,
+                                       int64_t             lda,
+                                       int64_t             strideA,
+                                       int64_t             il,
+                                       int64_t             iu,
+                                       hipDataType         dataTypeW,
+                                       void*               W,
+                                       int64_t             strideW,
+                                       hipDataType         computeType,
+                                       void*               workOnDevice,
+                                       size_t              lworkOnDevice,
+                                       void*               workOnHost,
+                                       size_t              lworkOnHost,
+                                       int*                info,
+                                       int64_t             batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(!workOnDevice || !lworkOnDevice)
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXsyevAuto_bufferSize(handle,
+                                                              params,
+                                                              jobz,
+                                                              range,
+                                                              uplo,
                                                               n,
-                                                              nrhs,
-                                                              (rocblas_double_complex*)A,
+                                                              dataTypeA,
+                                                              A,
                                                               lda,
-                                                              (rocblas_double_complex*)B,
-                                                              ldb));
+                                                              strideA,
+                                                              il,
+                                                              iu,
+                                                              dataTypeW,
+                                                              W,
+                                                              strideW,
+                                                              computeType,
+                                                              &lworkOnDevice,
+                                                              &lworkOnHost,
+                                                              batch_count));
+        workOnDevice = nullptr;
+    }
+
+    hipsolverSyevAlgorithm_t alg = hipsolver::syevAuto_algorithm(
+        (rocblas_handle)handle, jobz, range, n, il, iu, batch_count);
+
+    if(dataTypeA == HIP_R_32F && dataTypeW == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        return hipsolver::syevAuto<float, float>((rocblas_handle)handle,
+                                                 alg,
+                                                 jobz,
+                                                 range,
+                                                 uplo,
+                                                 n,
+                                                 A,
+                                                 lda,
+                                                 strideA,
+                                                 il,
+                                                 iu,
+                                                 W,
+                                                 strideW,
+                                                 workOnDevice,
+                                                 lworkOnDevice,
+                                                 info,
+                                                 batch_count);
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeW == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        return hipsolver::syevAuto<double, double>((rocblas_handle)handle,
+                                                   alg,
+                                                   jobz,
+                                                   range,
+                                                   uplo,
+                                                   n,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   il,
+                                                   iu,
+                                                   W,
+                                                   strideW,
+                                                   workOnDevice,
+                                                   lworkOnDevice,
+                                                   info,
+                                                   batch_count);
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeW == HIP_R_32F && computeType == HIP_C_32F)
+    {
+        return hipsolver::syevAuto<rocblas_float_complex, float>((rocblas_handle)handle,
+                                                                 alg,
+                                                                 jobz,
+                                                                 range,
+                                                                 uplo,
+                                                                 n,
+                                                                 A,
+                                                                 lda,
+                                                                 strideA,
+                                                                 il,
+                                                                 iu,
+                                                                 W,
+                                                                 strideW,
+                                                                 workOnDevice,
+                                                                 lworkOnDevice,
+                                                                 info,
+                                                                 batch_count);
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeW == HIP_R_64F && computeType == HIP_C_64F)
+    {
+        return hipsolver::syevAuto<rocblas_double_complex, double>((rocblas_handle)handle,
+                                                                   alg,
+                                                                   jobz,
+                                                                   range,
+                                                                   uplo,
+                                                                   n,
+                                                                   A,
+                                                                   lda,
+                                                                   strideA,
+                                                                   il,
+                                                                   iu,
+                                                                   W,
+                                                                   strideW,
+                                                                   workOnDevice,
+                                                                   lworkOnDevice,
+                                                                   info,
+                                                                   batch_count);
     }
     else
         return HIPSOLVER_STATUS_INVALID_ENUM;
@@ -0,0 +1,346 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "hipsolver_handle.hpp"
+#include "utility.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/******************** BUFFERSIZE CACHE ********************/
+bool bufferSize_cache::find(const bufferSize_key& key, size_t* size)
+{
+    auto it = index.find(key);
+    if(it == index.end())
+    {
+        misses++;
+        return false;
+    }
+
+    entries.splice(entries.begin(), entries, it->second);
+    *size = it->second->second;
+    hits++;
+    return true;
+}
+
+void bufferSize_cache::insert(const bufferSize_key& key, size_t size)
+{
+    auto it = index.find(key);
+    if(it != index.end())
+    {
+        it->second->second = size;
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+
+    if(entries.size() >= capacity)
+    {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+
+    entries.emplace_front(key, size);
+    index[key] = entries.begin();
+}
+
+void bufferSize_cache::discard()
+{
+    entries.clear();
+    index.clear();
+}
+
+void bufferSize_cache::clear()
+{
+    discard();
+    hits   = 0;
+    misses = 0;
+}
+
+/******************** HANDLE REGISTRY ********************/
+using handle_registry = std::unordered_map<rocblas_handle, std::shared_ptr<handle_data>>;
+
+static handle_registry& get_registry()
+{
+    static handle_registry registry;
+    return registry;
+}
+
+static std::shared_mutex& get_registry_mutex()
+{
+    static std::shared_mutex mutex;
+    return mutex;
+}
+
+std::shared_ptr<handle_data> get_handle_data(rocblas_handle handle)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(get_registry_mutex());
+        auto                                it = get_registry().find(handle);
+        if(it != get_registry().end())
+            return it->second;
+    }
+
+    std::lock_guard<std::shared_mutex> lock(get_registry_mutex());
+    std::shared_ptr<handle_data>&      data = get_registry()[handle];
+    if(!data)
+        data = std::make_shared<handle_data>();
+    return data;
+}
+
+void destroy_handle_data(rocblas_handle handle)
+{
+    std::shared_ptr<handle_data> data;
+    {
+        std::lock_guard<std::shared_mutex> lock(get_registry_mutex());
+        auto                               it = get_registry().find(handle);
+        if(it == get_registry().end())
+            return;
+
+        data = std::move(it->second);
+        get_registry().erase(it);
+    }
+
+    std::lock_guard<std::mutex> lock(data->mutex);
+    if(data->capture_workspace)
+        (void)hipFree(data->capture_workspace);
+    data->capture_workspace = nullptr;
+}
+
+/******************** MEMORY BUDGET ********************/
+bool check_memory_budget(rocblas_handle handle, size_t size)
+{
+    handle_data_lock data(handle);
+    if(data->budget.allows(size))
+        return true;
+
+    data->budget.rejected++;
+    return false;
+}
+
+bool use_low_memory_variant(rocblas_handle handle, size_t size)
+{
+    handle_data_lock data(handle);
+    if(data->budget.allows(size))
+        return false;
+
+    data->budget.degraded++;
+    return true;
+}
+
+void record_workspace_size(rocblas_handle handle, size_t size)
+{
+    handle_data_lock data(handle);
+    data->budget.on_workspace(size);
+}
+
+std::shared_ptr<handle_data> charge_memory_budget(rocblas_handle handle, size_t size)
+{
+    std::shared_ptr<handle_data> data = get_handle_data(handle);
+    std::lock_guard<std::mutex>  lock(data->mutex);
+    if(!data->budget.allows_buffer(size))
+    {
+        data->budget.rejected++;
+        return nullptr;
+    }
+
+    data->budget.on_buffer(size, 0);
+    return data;
+}
+
+void refund_memory_budget(const std::weak_ptr<handle_data>& owner, size_t size)
+{
+    std::shared_ptr<handle_data> data = owner.lock();
+    if(!data)
+        return;
+
+    std::lock_guard<std::mutex> lock(data->mutex);
+    data->budget.on_buffer(0, size);
+}
+
+/******************** CAPTURE MODE ********************/
+capture_policy get_capture_policy(rocblas_handle handle)
+{
+    handle_data_lock data(handle);
+    return data->capture;
+}
+
+hipsolverStatus_t check_capture(rocblas_handle handle, capture_step step)
+{
+    if(get_capture_policy(handle).allows(step))
+        return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_CAPTURABLE;
+}
+
+/******************** WORKSPACE ********************/
+rocblas_status manage_workspace(rocblas_handle handle, size_t size)
+{
+    handle_data_lock data(handle);
+    switch(data->capture.workspace(size))
+    {
+    case workspace_managed:
+        break;
+    case workspace_unchanged:
+        return rocblas_status_success;
+    case workspace_refused:
+        throw HIPSOLVER_STATUS_NOT_CAPTURABLE;
+    default:
+        // the reserved workspace is owned by hipSOLVER, so switching to it frees nothing
+        return rocblas_set_workspace(handle, data->capture_workspace, data->capture.reserved);
+    }
+
+    if(!data->budget.allows(size))
+    {
+        data->budget.rejected++;
+        return rocblas_status_memory_error;
+    }
+
+    rocblas_status status;
+    if(pool_workspace(handle, *data, size, &status))
+        return status;
+
+    size_t current_size = 0;
+    if(rocblas_is_user_managing_device_memory(handle))
+        rocblas_get_device_memory_size(handle, &current_size);
+
+    if(size <= current_size)
+        return rocblas_status_success;
+
+    status = rocblas_set_device_memory_size(handle, size);
+    if(status == rocblas_status_success)
+    {
+        data->budget.on_workspace(size);
+        data->user_workspace = false;
+    }
+    return status;
+}
+
+rocblas_status set_user_workspace(rocblas_handle handle, void* work, size_t size)
+{
+    handle_data_lock data(handle);
+    rocblas_status   status = rocblas_set_workspace(handle, work, size);
+    if(status == rocblas_status_success)
+    {
+        // the device memory allocated by rocBLAS for the handle is freed
+        data->budget.on_workspace(0);
+        data->user_workspace = true;
+    }
+    return status;
+}
+
+/******************** SYEV HEURISTIC ********************/
+/* Tables are read once per architecture, from syev_auto_<arch>.json in the directory named by
+   HIPSOLVER_TUNING_DIR, as written by the tuning mode of hipsolver-bench. The defaults are used
+   when the variable is not set or the file cannot be read. */
+static std::shared_ptr<const syev_heuristic> find_syev_heuristic(int device)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::shared_ptr<const syev_heuristic>> tables;
+
+    // feature flags such as :sramecc+:xnack- do not change the winners
+    std::string     arch = "default";
+    hipDeviceProp_t props;
+    if(hipGetDeviceProperties(&props, device) == hipSuccess)
+    {
+        arch = props.gcnArchName;
+        arch = arch.substr(0, arch.find(':'));
+    }
+
+    std::lock_guard<std::mutex>            lock(mutex);
+    std::shared_ptr<const syev_heuristic>& table = tables[arch];
+    if(!table)
+    {
+        auto        loaded = std::make_shared<syev_heuristic>();
+        const char* dir    = std::getenv("HIPSOLVER_TUNING_DIR");
+        if(!dir
+           || !syev_heuristic::read(std::string(dir) + "/syev_auto_" + arch + ".json",
+                                    loaded.get()))
+            *loaded = syev_heuristic::defaults();
+        table = loaded;
+    }
+    return table;
+}
+
+void load_syev_heuristic(rocblas_handle handle)
+{
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return;
+
+    std::shared_ptr<const syev_heuristic> table = find_syev_heuristic(device);
+
+    handle_data_lock data(handle);
+    data->syev_table = table;
+}
+
+hipsolverSyevAlgorithm_t choose_syev_algorithm(
+    rocblas_handle handle, bool vectors, int64_t n, int64_t batch_count, double fraction)
+{
+    std::shared_ptr<const syev_heuristic> table;
+    {
+        handle_data_lock data(handle);
+        if(data->syev_algorithm != HIPSOLVER_SYEV_ALG_AUTO)
+            return data->syev_algorithm;
+        table = data->syev_table;
+    }
+
+    // handles that were not created by hipsolverCreate load their table on first use
+    if(!table)
+    {
+        load_syev_heuristic(handle);
+
+        handle_data_lock data(handle);
+        table = data->syev_table;
+    }
+
+    syev_algorithm alg = table ? table->choose(vectors, n, batch_count, fraction)
+                               : syev_heuristic::defaults().choose(
+                                   vectors, n, batch_count, fraction);
+    switch(alg)
+    {
+    case syev_alg_syevj:
+        return HIPSOLVER_SYEV_ALG_SYEVJ;
+    case syev_alg_syevdx:
+        return HIPSOLVER_SYEV_ALG_SYEVDX;
+    default:
+        return HIPSOLVER_SYEV_ALG_SYEVD;
+    }
+}
+
+/******************** BUFFERSIZE MEMO ********************/
+bool bufferSize_memo::lookup(size_t* size)
+{
+    handle_data_lock data(handle);
+    return data->cache.find(key, size);
+}
+
+void bufferSize_memo::save(size_t size)
+{
+    handle_data_lock data(handle);
+    data->cache.insert(key, size);
+}
+
+HIPSOLVER_END_NAMESPACE
@@ -0,0 +1,309 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief State kept by hipSOLVER alongside each rocBLAS handle.
+ *
+ *  On the rocSOLVER side a hipsolverHandle_t is a rocblas_handle, so any state that
+ *  hipSOLVER needs to attach to a handle is kept in a registry keyed by the handle.
+ */
+
+#pragma once
+
+#include "capture_mode.hpp"
+#include "hipsolver.h"
+#include "hybrid_dispatch.hpp"
+#include "lib_macros.hpp"
+#include "rocblas/rocblas.h"
+#include "stride_detection.hpp"
+#include "syev_heuristic.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+
+struct hipsolverWorkspacePool;
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/*! \brief The arguments of a bufferSize query that determine the size of the workspace. */
+struct bufferSize_key
+{
+    static constexpr int max_args = 16;
+
+    const char* func;
+    int         nargs;
+    int64_t     args[max_args];
+
+    bool operator==(const bufferSize_key& other) const
+    {
+        return func == other.func && nargs == other.nargs
+               && std::memcmp(args, other.args, sizeof(int64_t) * nargs) == 0;
+    }
+};
+
+struct bufferSize_key_hash
+{
+    size_t operator()(const bufferSize_key& key) const
+    {
+        size_t h = std::hash<const void*>()(key.func);
+        for(int i = 0; i < key.nargs; i++)
+            h ^= std::hash<int64_t>()(key.args[i]) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        return h;
+    }
+};
+
+/*! \brief Least-recently-used map from bufferSize queries to workspace sizes.
+
+    The sizes reported by rocSOLVER depend on the device and on the atomics mode of
+    the handle. A handle stays bound to the device it was created on, and the entries
+    are discarded by hipsolverSetDeterministicMode when the atomics mode changes. */
+class bufferSize_cache
+{
+public:
+    static constexpr size_t capacity = 64;
+
+    size_t hits   = 0;
+    size_t misses = 0;
+
+    // Returns true and sets size if the query is in the cache
+    bool find(const bufferSize_key& key, size_t* size);
+
+    void insert(const bufferSize_key& key, size_t size);
+
+    // Discards all entries
+    void discard();
+
+    // Discards all entries and resets the counters
+    void clear();
+
+private:
+    using entry_t = std::pair<bufferSize_key, size_t>;
+
+    std::list<entry_t> entries; // most recently used first
+    std::unordered_map<bufferSize_key, std::list<entry_t>::iterator, bufferSize_key_hash> index;
+};
+
+/*! \brief Device memory budget of a handle, and the memory held against it: the workspace,
+    and the internal buffers allocated by calls on the handle that outlive them. */
+struct memory_budget
+{
+    size_t limit             = 0; // 0 if the handle has no budget
+    size_t workspace         = 0;
+    size_t buffers           = 0;
+    size_t bytes_in_use      = 0;
+    size_t peak_bytes_in_use = 0;
+    size_t rejected          = 0;
+    size_t degraded          = 0;
+
+    // Whether a workspace of the given size fits next to the buffers
+    bool allows(size_t size) const
+    {
+        return limit == 0 || (size <= limit && buffers <= limit - size);
+    }
+
+    // Whether a new buffer of the given size fits next to the workspace and the other buffers
+    bool allows_buffer(size_t size) const
+    {
+        return size <= SIZE_MAX - workspace && allows(workspace + size);
+    }
+
+    void on_workspace(size_t size)
+    {
+        workspace = size;
+        update();
+    }
+
+    void on_buffer(size_t allocated, size_t freed)
+    {
+        buffers += allocated;
+        buffers -= std::min(freed, buffers);
+        update();
+    }
+
+private:
+    void update()
+    {
+        bytes_in_use      = workspace + buffers;
+        peak_bytes_in_use = std::max(peak_bytes_in_use, bytes_in_use);
+    }
+};
+
+/*! \brief Per-handle state. Its members are protected by mutex, which is held through a
+    handle_data_lock while they are used. */
+struct handle_data
+{
+    std::mutex mutex;
+
+    bufferSize_cache cache;
+    memory_budget    budget;
+    hybrid_policy    hybrid;
+    stride_detection strides;
+    capture_policy   capture;
+    void*            capture_workspace = nullptr; // reserved workspace, if any
+    bool             user_workspace    = false; // whether the workspace was supplied by the caller
+
+    std::shared_ptr<hipsolverWorkspacePool> pool; // workspace pool attached to the handle, if any
+    std::shared_ptr<const syev_heuristic>   syev_table; // table of the device of the handle
+    hipsolverSyevAlgorithm_t                syev_algorithm = HIPSOLVER_SYEV_ALG_AUTO;
+};
+
+/*! \brief Sets the workspace of the handle from its workspace pool. Called with the state of the
+    handle locked. Returns false, leaving status untouched, if no pool is attached to the handle. */
+bool pool_workspace(rocblas_handle handle, handle_data& data, size_t size, rocblas_status* status);
+
+/*! \brief Returns the state of the given handle, creating it on first use. The registry is
+    only locked for writing when a handle is first seen, and the state stays valid for as long
+    as the returned pointer is held, so that calls on distinct handles never contend. */
+std::shared_ptr<handle_data> get_handle_data(rocblas_handle handle);
+
+/*! \brief Locks the state of a handle until the end of the scope. */
+class handle_data_lock
+{
+public:
+    explicit handle_data_lock(rocblas_handle handle)
+        : data(get_handle_data(handle))
+        , lock(data->mutex)
+    {
+    }
+
+    handle_data* operator->() const
+    {
+        return data.get();
+    }
+
+    handle_data& operator*() const
+    {
+        return *data;
+    }
+
+private:
+    std::shared_ptr<handle_data> data;
+    std::lock_guard<std::mutex>  lock;
+};
+
+/*! \brief Deletes the state of the given handle. Called when the handle is destroyed. */
+void destroy_handle_data(rocblas_handle handle);
+
+/*! \brief Charges an internal buffer of the given size to the memory budget of the handle, and
+    returns the state it was charged to. Returns nullptr, counting the request as rejected, if
+    the buffer does not fit next to the workspace and the other buffers of the handle. */
+std::shared_ptr<handle_data> charge_memory_budget(rocblas_handle handle, size_t size);
+
+/*! \brief Returns a buffer charged by charge_memory_budget, unless its handle has been
+    destroyed since. */
+void refund_memory_budget(const std::weak_ptr<handle_data>& owner, size_t size);
+
+/*! \brief Loads the syevAuto table of the current device into the state of the handle. Called
+    when the handle is created. */
+void load_syev_heuristic(rocblas_handle handle);
+
+/*! \brief Algorithm used by syevAuto on the given problem: the one set on the handle, or the
+    one chosen by its table if the handle is set to HIPSOLVER_SYEV_ALG_AUTO. */
+hipsolverSyevAlgorithm_t choose_syev_algorithm(
+    rocblas_handle handle, bool vectors, int64_t n, int64_t batch_count, double fraction);
+
+/*! \brief Memoizes the result of a bufferSize function.
+
+    Constructed at the start of a bufferSize function with the arguments that determine
+    the size of the workspace (pointer arguments must be left out). If find returns
+    true, the size of an identical earlier query has been written to lwork and the
+    dry run can be skipped; otherwise, save must be called with the computed size. */
+class bufferSize_memo
+{
+public:
+    template <typename... Args>
+    bufferSize_memo(hipsolverHandle_t handle, const char* func, Args... args)
+        : handle((rocblas_handle)handle)
+    {
+        static_assert(sizeof...(Args) <= bufferSize_key::max_args, "too many arguments");
+
+        key.func  = func;
+        key.nargs = 0;
+        (void)std::initializer_list<int>{(key.args[key.nargs++] = encode(args), 0)...};
+    }
+
+    template <typename T>
+    bool find(T* lwork)
+    {
+        size_t size;
+        if(!lookup(&size))
+            return false;
+
+        *lwork = (T)size;
+        return true;
+    }
+
+    void save(size_t size);
+
+private:
+    rocblas_handle handle;
+    bufferSize_key key;
+
+    bool lookup(size_t* size);
+
+    template <typename T, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+    static int64_t encode(T value)
+    {
+        double  d = value;
+        int64_t bits;
+        std::memcpy(&bits, &d, sizeof(bits));
+        return bits;
+    }
+
+    template <typename T, std::enable_if_t<!std::is_floating_point<T>::value, int> = 0>
+    static int64_t encode(T value)
+    {
+        return (int64_t)value;
+    }
+};
+
+/*! \brief Switches a handle to host pointer mode until the end of the scope, so that the BLAS
+    calls made by hipSOLVER can take their scalars from the host. */
+class pointer_mode_host_scope
+{
+public:
+    explicit pointer_mode_host_scope(rocblas_handle handle)
+        : handle(handle)
+    {
+        rocblas_get_pointer_mode(handle, &mode);
+        rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    }
+
+    ~pointer_mode_host_scope()
+    {
+        rocblas_set_pointer_mode(handle, mode);
+    }
+
+private:
+    rocblas_handle       handle;
+    rocblas_pointer_mode mode = rocblas_pointer_mode_host;
+};
+
+HIPSOLVER_END_NAMESPACE
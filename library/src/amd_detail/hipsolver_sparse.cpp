@@ -33,6 +33,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cmath>
 #include <functional>
 #include <iostream>
 #include <math.h>
@@ -55,6 +56,7 @@ struct hipsolverSpHandle
     rocsparse_handle sphandle;
     rocsolver_rfinfo rfinfo;
     cholmod_common   c_handle;
+    cholmod_common   c_handle64;
 
     rocblas_int h_n;
     rocblas_int d_n, d_nnzA, d_nnzT;
@@ -68,19 +70,79 @@ struct hipsolverSpHandle
 
     rocblas_int* dQ;
 
+    // 32-bit copies of the indices given to the 64-bit functions
+    rocblas_int *dPtrA32, *dIndA32;
+    char*        d32_buffer;
+    size_t       d32_size;
+
+    // diagonal of the Cholesky factor, used to locate a failed pivot
+    double* dDiag;
+    void*   hDiag;
+    size_t  hDiag_size;
+
     rocblas_int* hParent;
     rocblas_int *hWork1, *hWork2, *hWork3;
 
     char *d_buffer, *h_buffer;
 
+    // incomplete factorization used by the iterative solvers (device)
+    rocsolver_rfinfo     pc_rfinfo;
+    hipsolverSpPrecond_t pc_type;
+    bool                 pc_is_float;
+    rocblas_int          pc_n, pc_nnzA, pc_nnzM;
+    rocblas_int *        dPtrM, *dIndM, *dPermM;
+    rocblas_int *        dPtrA0, *dIndA0;
+    void*                dValM;
+    char*                pc_buffer;
+    size_t               pc_size;
+
+    // incomplete factorization used by the iterative solvers (host)
+    hipsolverSpPrecond_t hpc_type;
+    rocblas_int          hpc_n, hpc_nnzA;
+    std::vector<int>     hPtrM, hIndM, hDiagM;
+    std::vector<double>  hValM;
+
+    // state and workspace of the current iterative solve
+    bool                 k_host, k_is_float;
+    hipsolverSpPrecond_t k_precond;
+    rocsparse_index_base k_indbase;
+    rocsparse_mat_descr  k_descr;
+    rocblas_int          k_n, k_nnzA, k_ld;
+    const void*          k_val;
+    const int *          k_ptr, *k_ind;
+    char*                k_buffer;
+    size_t               k_size;
+    std::vector<double>  k_hwork;
+
+    // true if no device was found when the handle was created
+    bool host_only;
+
     // Constructor
     explicit hipsolverSpHandle()
         : h_n(0)
         , d_n(0)
         , d_nnzA(0)
         , d_nnzT(0)
+        , d32_buffer(nullptr)
+        , d32_size(0)
+        , hDiag(nullptr)
+        , hDiag_size(0)
         , d_buffer(nullptr)
         , h_buffer(nullptr)
+        , pc_rfinfo(nullptr)
+        , pc_type(HIPSOLVER_SP_PRECOND_NONE)
+        , pc_is_float(false)
+        , pc_n(0)
+        , pc_nnzA(0)
+        , pc_nnzM(0)
+        , pc_buffer(nullptr)
+        , pc_size(0)
+        , hpc_type(HIPSOLVER_SP_PRECOND_NONE)
+        , hpc_n(0)
+        , hpc_nnzA(0)
+        , k_buffer(nullptr)
+        , k_size(0)
+        , host_only(false)
     {
     }
 
@@ -99,14 +161,15 @@ struct hipsolverSpHandle
                 this->d_buffer = nullptr;
             }
 
-            size_t size_dPtrA = sizeof(rocblas_int) * (n + 1);
-            size_t size_dIndA = sizeof(rocblas_int) * nnzA;
+            size_t size_dPtrA = sizeof(rocblas_int) * (size_t(n) + 1);
+            size_t size_dIndA = sizeof(rocblas_int) * size_t(nnzA);
 
-            size_t size_dPtrT = sizeof(rocblas_int) * (n + 1);
-            size_t size_dIndT = sizeof(rocblas_int) * nnzT;
-            size_t size_dValT = sizeof(double) * nnzT;
+            size_t size_dPtrT = sizeof(rocblas_int) * (size_t(n) + 1);
+            size_t size_dIndT = sizeof(rocblas_int) * size_t(nnzT);
+            size_t size_dValT = sizeof(double) * size_t(nnzT);
 
-            size_t size_dQ = sizeof(rocblas_int) * n;
+            size_t size_dQ    = sizeof(rocblas_int) * size_t(n);
+            size_t size_dDiag = sizeof(double) * size_t(n);
 
             // 128 byte alignment
             size_dPtrA = ((size_dPtrA - 1) / 128 + 1) * 128;
@@ -115,9 +178,10 @@ struct hipsolverSpHandle
             size_dIndT = ((size_dIndT - 1) / 128 + 1) * 128;
             size_dValT = ((size_dValT - 1) / 128 + 1) * 128;
             size_dQ    = ((size_dQ - 1) / 128 + 1) * 128;
+            size_dDiag = ((size_dDiag - 1) / 128 + 1) * 128;
 
-            size_t size_buffer
-                = size_dPtrA + size_dIndA + size_dPtrT + size_dIndT + size_dValT + size_dQ;
+            size_t size_buffer = size_dPtrA + size_dIndA + size_dPtrT + size_dIndT + size_dValT
+                                 + size_dQ + size_dDiag;
 
             if(hipMalloc(&this->d_buffer, size_buffer) != hipSuccess)
                 return HIPSOLVER_STATUS_ALLOC_FAILED;
@@ -132,6 +196,7 @@ struct hipsolverSpHandle
             this->dQ = (rocblas_int*)(temp_buf += size_dIndT);
 
             this->dValT = (double*)(temp_buf += size_dQ);
+            this->dDiag = (double*)(temp_buf += size_dValT);
 
             this->d_n    = n;
             this->d_nnzT = nnzT;
@@ -140,6 +205,66 @@ struct hipsolverSpHandle
         return HIPSOLVER_STATUS_SUCCESS;
     }
 
+    // Allocate device memory for the 32-bit copies of the indices of A
+    hipsolverStatus_t malloc_narrow(int n, int nnzA)
+    {
+        if(n < 0 || nnzA < 0)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        size_t size_dPtrA = sizeof(rocblas_int) * (size_t(n) + 1);
+        size_t size_dIndA = sizeof(rocblas_int) * std::max(nnzA, 1);
+
+        // 128 byte alignment
+        size_dPtrA = ((size_dPtrA - 1) / 128 + 1) * 128;
+        size_dIndA = ((size_dIndA - 1) / 128 + 1) * 128;
+
+        size_t size_buffer = size_dPtrA + size_dIndA;
+        if(this->d32_size < size_buffer)
+        {
+            if(this->d32_buffer)
+            {
+                if(hipFree(this->d32_buffer) != hipSuccess)
+                    return HIPSOLVER_STATUS_INTERNAL_ERROR;
+                this->d32_buffer = nullptr;
+                this->d32_size   = 0;
+            }
+
+            if(hipMalloc(&this->d32_buffer, size_buffer) != hipSuccess)
+                return HIPSOLVER_STATUS_ALLOC_FAILED;
+            this->d32_size = size_buffer;
+        }
+
+        this->dPtrA32 = (rocblas_int*)this->d32_buffer;
+        this->dIndA32 = (rocblas_int*)(this->d32_buffer + size_dPtrA);
+
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // Allocate pinned host memory for the diagonal of the Cholesky factor
+    hipsolverStatus_t malloc_diag(int n)
+    {
+        if(n < 0)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        size_t size_hDiag = sizeof(double) * std::max(n, 1);
+        if(this->hDiag_size < size_hDiag)
+        {
+            if(this->hDiag)
+            {
+                if(hipHostFree(this->hDiag) != hipSuccess)
+                    return HIPSOLVER_STATUS_INTERNAL_ERROR;
+                this->hDiag      = nullptr;
+                this->hDiag_size = 0;
+            }
+
+            if(hipHostMalloc(&this->hDiag, size_hDiag) != hipSuccess)
+                return HIPSOLVER_STATUS_ALLOC_FAILED;
+            this->hDiag_size = size_hDiag;
+        }
+
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
     // Allocate host memory
     hipsolverStatus_t malloc_host(int n)
     {
@@ -195,8 +320,28 @@ struct hipsolverSpHandle
         free(this->h_buffer);
         this->h_buffer = nullptr;
 
+        if(this->host_only)
+            return;
+
         hipFree(this->d_buffer);
         this->d_buffer = nullptr;
+
+        hipFree(this->d32_buffer);
+        this->d32_buffer = nullptr;
+        this->d32_size   = 0;
+
+        hipHostFree(this->hDiag);
+        this->hDiag      = nullptr;
+        this->hDiag_size = 0;
+
+        hipFree(this->pc_buffer);
+        this->pc_buffer = nullptr;
+        this->pc_size   = 0;
+        this->pc_type   = HIPSOLVER_SP_PRECOND_NONE;
+
+        hipFree(this->k_buffer);
+        this->k_buffer = nullptr;
+        this->k_size   = 0;
     }
 
     // Convert base one indices to base zero, and copy float values into double array
@@ -226,6 +371,33 @@ struct hipsolverSpHandle
                 val[i] = (double)src_val[i];
         }
     }
+    // Convert base one indices to base zero, and copy float values into double array (64-bit)
+    void prep_input(rocsparse_index_base indbase,
+                    int64_t              n,
+                    int64_t              nnz,
+                    int64_t*             ptr,
+                    int64_t*             ind,
+                    double*              val,
+                    float*               src_val)
+    {
+        int64_t count;
+        if(indbase == rocsparse_index_base_one)
+        {
+            for(int64_t i = 0; i <= n; i++)
+                ptr[i] -= 1;
+            count = std::min(nnz, ptr[n]);
+            for(int64_t i = 0; i < count; i++)
+                ind[i] -= 1;
+        }
+        else
+            count = std::min(nnz, ptr[n]);
+
+        if(src_val)
+        {
+            for(int64_t i = 0; i < count; i++)
+                val[i] = (double)src_val[i];
+        }
+    }
     // Copy float values into double array
     void prep_input(int n, double* val, float* src_val)
     {
@@ -236,6 +408,96 @@ struct hipsolverSpHandle
         }
     }
 
+    // Copy float values into double array (64-bit size)
+    void prep_input(int64_t n, double* val, float* src_val)
+    {
+        if(src_val)
+        {
+            for(int64_t i = 0; i < n; i++)
+                val[i] = (double)src_val[i];
+        }
+    }
+
+    // Sets up c_A as a read-only view of the CSR arrays of A (with base zero indices) without
+    // copying them. CHOLMOD reads them as the CSC arrays of A', which is the same symmetric matrix
+    void view_sparse(cholmod_sparse* c_A,
+                     int64_t         n,
+                     int64_t         nnz,
+                     const void*     ptr,
+                     const void*     ind,
+                     const double*   val,
+                     int             itype)
+    {
+        memset(c_A, 0, sizeof(cholmod_sparse));
+        c_A->nrow   = n;
+        c_A->ncol   = n;
+        c_A->nzmax  = nnz;
+        c_A->p      = (void*)ptr;
+        c_A->i      = (void*)ind;
+        c_A->x      = (void*)val;
+        c_A->stype  = 1;
+        c_A->itype  = itype;
+        c_A->xtype  = val ? CHOLMOD_REAL : CHOLMOD_PATTERN;
+        c_A->dtype  = CHOLMOD_DOUBLE;
+        c_A->sorted = true;
+        c_A->packed = true;
+    }
+
+    // Returns the given indices if they are base zero. Base one indices are converted into tmp in a
+    // single pass
+    const int* view_index(rocsparse_index_base indbase,
+                          int64_t              count,
+                          const int*           src,
+                          std::vector<int>&    tmp)
+    {
+        if(indbase == rocsparse_index_base_zero)
+            return src;
+
+        tmp.resize(count);
+        for(int64_t k = 0; k < count; k++)
+            tmp[k] = src[k] - 1;
+        return tmp.data();
+    }
+    const int64_t* view_index(rocsparse_index_base  indbase,
+                              int64_t               count,
+                              const int64_t*        src,
+                              std::vector<int64_t>& tmp)
+    {
+        if(indbase == rocsparse_index_base_zero)
+            return src;
+
+        tmp.resize(count);
+        for(int64_t k = 0; k < count; k++)
+            tmp[k] = src[k] - 1;
+        return tmp.data();
+    }
+
+    // Returns the given values if they are double. Float values are converted into tmp
+    const double* view_values(int64_t count, const double* src, std::vector<double>& tmp)
+    {
+        return src;
+    }
+    const double* view_values(int64_t count, const float* src, std::vector<double>& tmp)
+    {
+        tmp.resize(count);
+        for(int64_t k = 0; k < count; k++)
+            tmp[k] = (double)src[k];
+        return tmp.data();
+    }
+
+    // Frees c_A if it is a copy owned by CHOLMOD rather than the given view of the input arrays
+    void free_input(cholmod_sparse** c_A, cholmod_sparse* view)
+    {
+        if(*c_A && *c_A != view)
+        {
+            if((*c_A)->itype == CHOLMOD_LONG)
+                cholmod_l_free_sparse(c_A, &this->c_handle64);
+            else
+                cholmod_free_sparse(c_A, &this->c_handle);
+        }
+        *c_A = nullptr;
+    }
+
     // Convert base zero indices to base one, and copy double values into float array
     void prep_output(rocsparse_index_base indbase,
                      int                  n,
@@ -272,6 +534,15 @@ struct hipsolverSpHandle
                 dest_val[i] = (float)val[i];
         }
     }
+    // Copy double values into float array (64-bit size)
+    void prep_output(int64_t n, double* val, float* dest_val)
+    {
+        if(dest_val)
+        {
+            for(int64_t i = 0; i < n; i++)
+                dest_val[i] = (float)val[i];
+        }
+    }
 
     // Generates the sparsity pattern of T given the sparsity pattern of A, the elimination tree (specified by parent),
     // and the ordering (specified by new2old)
@@ -324,302 +595,3098 @@ struct hipsolverSpHandle
             graph.clear();
         }
     }
-};
-
-hipsolverStatus_t hipsolverSpCreate(hipsolverSpHandle_t* handle)
-try
-{
-#ifndef HAVE_ROCSPARSE
-    if(!::hipsolver::try_load_rocsparse())
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    if(!::hipsolver::try_load_cholmod())
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-#endif // HAVE_ROCSPARSE
 
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    // Computes the symbolic factorization of A with the long integer interface of CHOLMOD. The
+    // number of nonzeros in L is returned in c_handle64.lnz
+    cholmod_factor* chol64_analyze(cholmod_sparse* c_A, int reorder)
+    {
+        this->c_handle64.nmethods  = 1; // use 1 reordering method
+        this->c_handle64.postorder = false; // no postordering
+        this->c_handle64.final_ll  = true; // factorize as LL' not LDL'
+        switch(reorder)
+        {
+        case 1:
+        case 2:
+            this->c_handle64.method[0].ordering = CHOLMOD_AMD;
+            break;
+        case 3:
+            this->c_handle64.method[0].ordering = CHOLMOD_METIS;
+            break;
+        default:
+            this->c_handle64.method[0].ordering = CHOLMOD_NATURAL;
+        }
 
-    hipsolverSpHandle* sp = new hipsolverSpHandle;
-    rocblas_status     status;
-    rocsparse_status   sp_status;
+        return cholmod_l_analyze(c_A, &this->c_handle64);
+    }
 
-    if((status = rocblas_create_handle(&sp->handle)) != rocblas_status_success)
+    // Computes the numeric factorization P*A*P' = L*L' with the long integer interface of
+    // CHOLMOD. If A is not positive definite, the position of the failed pivot is returned in
+    // singularity and c_L is freed
+    hipsolverStatus_t
+        chol64_factorize(cholmod_sparse* c_A, cholmod_factor** c_L, int64_t* singularity)
     {
-        delete sp;
-        return hipsolver::rocblas2hip_status(status);
+        int status = 0;
+        if(*c_L)
+            status = cholmod_l_factorize(c_A, *c_L, &this->c_handle64);
+
+        if(status != TRUE)
+        {
+            cholmod_l_free_factor(c_L, &this->c_handle64);
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+        if(this->c_handle64.status == CHOLMOD_NOT_POSDEF)
+        {
+            *singularity = (*c_L)->minor;
+            cholmod_l_free_factor(c_L, &this->c_handle64);
+        }
+
+        return HIPSOLVER_STATUS_SUCCESS;
     }
 
-    if((sp_status = rocsparse_create_handle(&sp->sphandle)) != rocsparse_status_success)
+    // Computes the simplicial factorization P*A*P' = L*D*L' with CHOLMOD. Pivots with magnitude
+    // smaller than perturb are replaced by +/-perturb. If a zero pivot is found, its position is
+    // returned in singularity and c_L is set to null
+    hipsolverStatus_t ldl_factorize(cholmod_sparse*  c_A,
+                                    int              reorder,
+                                    double           perturb,
+                                    cholmod_factor** c_L,
+                                    int*             singularity)
     {
-        rocblas_destroy_handle(sp->handle);
-        delete sp;
-        return HIPSOLVER_STATUS_ALLOC_FAILED;
+        this->c_handle.nmethods   = 1; // use 1 reordering method
+        this->c_handle.postorder  = false; // no postordering
+        this->c_handle.supernodal = CHOLMOD_SIMPLICIAL; // supernodal factors are always LL'
+        this->c_handle.final_ll   = false; // factorize as LDL' not LL'
+        this->c_handle.dbound     = std::max(perturb, 0.0);
+        switch(reorder)
+        {
+        case 1:
+        case 2:
+            this->c_handle.method[0].ordering = CHOLMOD_AMD;
+            break;
+        case 3:
+            this->c_handle.method[0].ordering = CHOLMOD_METIS;
+            break;
+        default:
+            this->c_handle.method[0].ordering = CHOLMOD_NATURAL;
+        }
+
+        int status = 0;
+        *c_L       = cholmod_analyze(c_A, &this->c_handle);
+        if(*c_L)
+            status = cholmod_factorize(c_A, *c_L, &this->c_handle);
+
+        // restore the defaults expected by the other solvers
+        this->c_handle.supernodal = CHOLMOD_AUTO;
+        this->c_handle.dbound     = 0.0;
+
+        if(status != TRUE)
+        {
+            cholmod_free_factor(c_L, &this->c_handle);
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+        if(this->c_handle.status == CHOLMOD_NOT_POSDEF)
+        {
+            *singularity = (*c_L)->minor;
+            cholmod_free_factor(c_L, &this->c_handle);
+        }
+
+        return HIPSOLVER_STATUS_SUCCESS;
     }
 
-    if((status = rocsolver_create_rfinfo(&sp->rfinfo, sp->handle)) != rocblas_status_success)
+    // Bundles the factors of P*A*P' = L*D*L' into T = (L - I) + D*L' in CSR format, so that the
+    // system can be solved with the LU-mode triangular solves of rocSOLVER
+    void ldl_bundle(cholmod_factor*      c_L,
+                    std::vector<int>&    Tp,
+                    std::vector<int>&    Ti,
+                    std::vector<double>& Tx)
     {
-        rocblas_destroy_handle(sp->handle);
-        rocsparse_destroy_handle(sp->sphandle);
-        delete sp;
-        return hipsolver::rocblas2hip_status(status);
+        int     n  = c_L->n;
+        int*    Lp = (int*)c_L->p;
+        int*    Li = (int*)c_L->i;
+        int*    Lz = (int*)c_L->nz;
+        double* Lx = (double*)c_L->x;
+
+        // D is stored in the diagonal of L; find it and count the entries of each row of T
+        std::vector<double> D(n, 0.0);
+        Tp.assign(n + 1, 0);
+        for(int j = 0; j < n; j++)
+        {
+            for(int k = Lp[j]; k < Lp[j] + Lz[j]; k++)
+            {
+                int i = Li[k];
+                if(i == j)
+                    D[j] = Lx[k];
+                else
+                {
+                    Tp[i + 1]++; // L(i,j) in row i
+                    Tp[j + 1]++; // D(j)*L(i,j) in row j
+                }
+            }
+            Tp[j + 1]++; // diagonal
+        }
+        for(int i = 0; i < n; i++)
+            Tp[i + 1] += Tp[i];
+
+        Ti.resize(Tp[n]);
+        Tx.resize(Tp[n]);
+        std::vector<int> next(Tp.begin(), Tp.end() - 1);
+        for(int j = 0; j < n; j++)
+        {
+            for(int k = Lp[j]; k < Lp[j] + Lz[j]; k++)
+            {
+                int i = Li[k];
+                if(i != j)
+                {
+                    Ti[next[i]]   = j;
+                    Tx[next[i]++] = Lx[k];
+                    Ti[next[j]]   = i;
+                    Tx[next[j]++] = D[j] * Lx[k];
+                }
+            }
+            Ti[next[j]]   = j;
+            Tx[next[j]++] = D[j];
+        }
+
+        // sort the column indices of each row
+        std::vector<std::pair<int, double>> row;
+        for(int i = 0; i < n; i++)
+        {
+            row.clear();
+            for(int k = Tp[i]; k < Tp[i + 1]; k++)
+                row.push_back(std::make_pair(Ti[k], Tx[k]));
+            std::sort(row.begin(), row.end());
+            for(int k = Tp[i]; k < Tp[i + 1]; k++)
+            {
+                Ti[k] = row[k - Tp[i]].first;
+                Tx[k] = row[k - Tp[i]].second;
+            }
+        }
     }
 
-    if(cholmod_start(&sp->c_handle) != TRUE)
+    // Generates the sparsity pattern of the incomplete factor M given the sparsity pattern of A.
+    // M keeps the lower triangle of A for IC0 and all of A for ILU0. Column indices in M are
+    // sorted, the diagonal is always present, and its position is returned in Mdiag
+    void gen_precond_pattern(hipsolverSpPrecond_t precond,
+                             int                  n,
+                             const int*           Ap,
+                             const int*           Ai,
+                             std::vector<int>&    Mp,
+                             std::vector<int>&    Mi,
+                             std::vector<int>&    Mdiag)
     {
-        rocblas_destroy_handle(sp->handle);
-        rocsparse_destroy_handle(sp->sphandle);
-        rocsolver_destroy_rfinfo(sp->rfinfo);
-        delete sp;
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
-    }
+        Mp.resize(n + 1);
+        Mdiag.resize(n);
+        Mi.clear();
+        Mp[0] = 0;
 
-    *handle = sp;
-    return HIPSOLVER_STATUS_SUCCESS;
-}
-catch(...)
-{
-    return hipsolver::exception2hip_status();
-}
+        std::set<int> row;
+        for(int i = 0; i < n; i++)
+        {
+            for(int k = Ap[i]; k < Ap[i + 1]; k++)
+            {
+                int j = Ai[k];
+                if(0 <= j && j < n && (precond == HIPSOLVER_SP_PRECOND_ILU0 || j <= i))
+                    row.insert(j);
+            }
 
-hipsolverStatus_t hipsolverSpDestroy(hipsolverSpHandle_t handle)
-try
-{
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+            row.insert(i);
+            Mdiag[i] = Mp[i] + std::distance(row.begin(), row.find(i));
+            Mi.insert(Mi.end(), row.begin(), row.end());
+            Mp[i + 1] = Mi.size();
+            row.clear();
+        }
+    }
 
-    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
-    sp->free_all();
-    rocblas_destroy_handle(sp->handle);
-    rocsparse_destroy_handle(sp->sphandle);
-    rocsolver_destroy_rfinfo(sp->rfinfo);
-    cholmod_finish(&sp->c_handle);
-    delete sp;
+    // Allocate device memory for the incomplete factorization
+    hipsolverStatus_t malloc_precond(int n, int nnzA, int nnzM, size_t val_size)
+    {
+        size_t size_dPtrM  = sizeof(rocblas_int) * (n + 1);
+        size_t size_dIndM  = sizeof(rocblas_int) * nnzM;
+        size_t size_dPermM = sizeof(rocblas_int) * n;
+        size_t size_dPtrA0 = sizeof(rocblas_int) * (n + 1);
+        size_t size_dIndA0 = sizeof(rocblas_int) * nnzA;
+        size_t size_dValM  = val_size * nnzM;
+
+        // 128 byte alignment
+        size_dPtrM  = ((size_dPtrM - 1) / 128 + 1) * 128;
+        size_dIndM  = ((size_dIndM - 1) / 128 + 1) * 128;
+        size_dPermM = ((size_dPermM - 1) / 128 + 1) * 128;
+        size_dPtrA0 = ((size_dPtrA0 - 1) / 128 + 1) * 128;
+        size_dIndA0 = ((size_dIndA0 - 1) / 128 + 1) * 128;
+        size_dValM  = ((size_dValM - 1) / 128 + 1) * 128;
+
+        size_t size_buffer
+            = size_dPtrM + size_dIndM + size_dPermM + size_dPtrA0 + size_dIndA0 + size_dValM;
+
+        if(this->pc_size < size_buffer)
+        {
+            if(this->pc_buffer)
+            {
+                if(hipFree(this->pc_buffer) != hipSuccess)
+                    return HIPSOLVER_STATUS_INTERNAL_ERROR;
+                this->pc_buffer = nullptr;
+                this->pc_size   = 0;
+            }
 
-    return HIPSOLVER_STATUS_SUCCESS;
-}
-catch(...)
-{
-    return hipsolver::exception2hip_status();
-}
+            if(hipMalloc(&this->pc_buffer, size_buffer) != hipSuccess)
+                return HIPSOLVER_STATUS_ALLOC_FAILED;
+            this->pc_size = size_buffer;
+        }
 
-hipsolverStatus_t hipsolverSpSetStream(hipsolverSpHandle_t handle, hipStream_t streamId)
-try
-{
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+        char* temp_buf;
+        this->dPtrM  = (rocblas_int*)(temp_buf = this->pc_buffer);
+        this->dIndM  = (rocblas_int*)(temp_buf += size_dPtrM);
+        this->dPermM = (rocblas_int*)(temp_buf += size_dIndM);
+        this->dPtrA0 = (rocblas_int*)(temp_buf += size_dPermM);
+        this->dIndA0 = (rocblas_int*)(temp_buf += size_dPtrA0);
+        this->dValM  = (void*)(temp_buf += size_dIndA0);
 
-    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
-    return hipsolver::rocblas2hip_status(rocblas_set_stream(sp->handle, streamId));
-}
-catch(...)
-{
-    return hipsolver::exception2hip_status();
-}
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
 
-/******************** CSRLSVCHOL ********************/
-hipsolverStatus_t hipsolverSpScsrlsvchol(hipsolverSpHandle_t       handle,
-                                         int                       n,
-                                         int                       nnzA,
-                                         const hipsparseMatDescr_t descrA,
-                                         const float*              csrVal,
-                                         const int*                csrRowPtr,
-                                         const int*                csrColInd,
-                                         const float*              b,
-                                         float                     tolerance,
-                                         int                       reorder,
-                                         float*                    x,
-                                         int*                      singularity)
-try
-{
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(n < 0 || nnzA < 0)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!descrA)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!b || !x || !singularity)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(reorder < 0 || reorder > 3)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    // Computes the incomplete factorization of A on the device using the refactorization
+    // functions of rocSOLVER. The sparsity pattern of the factor is restricted to that of A, so
+    // that rocSOLVER's incomplete Cholesky/LU refactorization yields IC0/ILU0 exactly
+    hipsolverStatus_t setup_precond_device(int reuse, void* work)
+    {
+        if(this->k_precond == HIPSOLVER_SP_PRECOND_NONE)
+            return HIPSOLVER_STATUS_SUCCESS;
+        if(reuse && this->pc_type == this->k_precond && this->pc_is_float == this->k_is_float
+           && this->pc_n == this->k_n && this->pc_nnzA == this->k_nnzA)
+            return HIPSOLVER_STATUS_SUCCESS;
+
+        int n         = this->k_n;
+        int nnzA      = this->k_nnzA;
+        this->pc_type = HIPSOLVER_SP_PRECOND_NONE;
+
+        // set up the sparsity pattern of M
+        std::vector<int> hAp(n + 1), hAi(nnzA);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hAp.data(), this->k_ptr, sizeof(int) * (n + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hAi.data(), this->k_ind, sizeof(int) * nnzA, hipMemcpyDeviceToHost));
+        this->prep_input(this->k_indbase, n, nnzA, hAp.data(), hAi.data(), nullptr, nullptr);
 
-    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
-    // rocsparse_fill_mode fillmode = rocsparse_get_mat_fill_mode((rocsparse_mat_descr)descrA);
-    // rocsparse_diag_type diagtype = rocsparse_get_mat_diag_type((rocsparse_mat_descr)descrA);
-    rocsparse_index_base indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
-    if(mattype != rocsparse_matrix_type_general)
-        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
-    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
-        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+        std::vector<int> hMp, hMi, hMdiag;
+        this->gen_precond_pattern(this->k_precond, n, hAp.data(), hAi.data(), hMp, hMi, hMdiag);
+        int nnzM = hMi.size();
 
-    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
-    *singularity          = -1;
+        std::vector<int> hPerm(n);
+        for(int i = 0; i < n; i++)
+            hPerm[i] = i;
 
-    sp->c_handle.nmethods  = 1; // use 1 reordering method
-    sp->c_handle.postorder = false; // no postordering
-    sp->c_handle.final_ll  = true; // factorize as LL' not LDL'
-    int ordering;
-    switch(reorder)
+        CHECK_HIPSOLVER_ERROR(this->malloc_precond(
+            n, nnzA, nnzM, this->k_is_float ? sizeof(float) : sizeof(double)));
+        CHECK_HIP_ERROR(
+            hipMemcpy(this->dPtrM, hMp.data(), sizeof(int) * (n + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(this->dIndM, hMi.data(), sizeof(int) * nnzM, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(this->dPermM, hPerm.data(), sizeof(int) * n, hipMemcpyHostToDevice));
+
+        // if indices are base one, need to use temp arrays and load base zero indices
+        int *dPtrA = (int*)this->k_ptr, *dIndA = (int*)this->k_ind;
+        if(this->k_indbase == rocsparse_index_base_one)
+        {
+            CHECK_HIP_ERROR(
+                hipMemcpy(this->dPtrA0, hAp.data(), sizeof(int) * (n + 1), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(
+                hipMemcpy(this->dIndA0, hAi.data(), sizeof(int) * nnzA, hipMemcpyHostToDevice));
+            dPtrA = this->dPtrA0;
+            dIndA = this->dIndA0;
+        }
+
+        // factorize A (numeric)
+        if(this->k_precond == HIPSOLVER_SP_PRECOND_IC0)
+        {
+            CHECK_ROCBLAS_ERROR(
+                rocsolver_set_rfinfo_mode(this->pc_rfinfo, rocsolver_rfinfo_mode_cholesky));
+            if(this->k_is_float)
+            {
+                CHECK_ROCBLAS_ERROR(rocsolver_scsrrf_analysis(this->handle,
+                                                              n,
+                                                              1,
+                                                              nnzA,
+                                                              dPtrA,
+                                                              dIndA,
+                                                              (float*)this->k_val,
+                                                              nnzM,
+                                                              this->dPtrM,
+                                                              this->dIndM,
+                                                              (float*)this->dValM,
+                                                              nullptr,
+                                                              this->dPermM,
+                                                              (float*)work,
+                                                              n,
+                                                              this->pc_rfinfo));
+                CHECK_ROCBLAS_ERROR(rocsolver_scsrrf_refactchol(this->handle,
+                                                                n,
+                                                                nnzA,
+                                                                dPtrA,
+                                                                dIndA,
+                                                                (float*)this->k_val,
+                                                                nnzM,
+                                                                this->dPtrM,
+                                                                this->dIndM,
+                                                                (float*)this->dValM,
+                                                                this->dPermM,
+                                                                this->pc_rfinfo));
+            }
+            else
+            {
+                CHECK_ROCBLAS_ERROR(rocsolver_dcsrrf_analysis(this->handle,
+                                                              n,
+                                                              1,
+                                                              nnzA,
+                                                              dPtrA,
+                                                              dIndA,
+                                                              (double*)this->k_val,
+                                                              nnzM,
+                                                              this->dPtrM,
+                                                              this->dIndM,
+                                                              (double*)this->dValM,
+                                                              nullptr,
+                                                              this->dPermM,
+                                                              (double*)work,
+                                                              n,
+                                                              this->pc_rfinfo));
+                CHECK_ROCBLAS_ERROR(rocsolver_dcsrrf_refactchol(this->handle,
+                                                                n,
+                                                                nnzA,
+                                                                dPtrA,
+                                                                dIndA,
+                                                                (double*)this->k_val,
+                                                                nnzM,
+                                                                this->dPtrM,
+                                                                this->dIndM,
+                                                                (double*)this->dValM,
+                                                                this->dPermM,
+                                                                this->pc_rfinfo));
+            }
+        }
+        else
+        {
+            CHECK_ROCBLAS_ERROR(rocsolver_set_rfinfo_mode(this->pc_rfinfo, rocsolver_rfinfo_mode_lu));
+            if(this->k_is_float)
+            {
+                CHECK_ROCBLAS_ERROR(rocsolver_scsrrf_analysis(this->handle,
+                                                              n,
+                                                              1,
+                                                              nnzA,
+                                                              dPtrA,
+                                                              dIndA,
+                                                              (float*)this->k_val,
+                                                              nnzM,
+                                                              this->dPtrM,
+                                                              this->dIndM,
+                                                              (float*)this->dValM,
+                                                              this->dPermM,
+                                                              this->dPermM,
+                                                              (float*)work,
+                                                              n,
+                                                              this->pc_rfinfo));
+                CHECK_ROCBLAS_ERROR(rocsolver_scsrrf_refactlu(this->handle,
+                                                              n,
+                                                              nnzA,
+                                                              dPtrA,
+                                                              dIndA,
+                                                              (float*)this->k_val,
+                                                              nnzM,
+                                                              this->dPtrM,
+                                                              this->dIndM,
+                                                              (float*)this->dValM,
+                                                              this->dPermM,
+                                                              this->dPermM,
+                                                              this->pc_rfinfo));
+            }
+            else
+            {
+                CHECK_ROCBLAS_ERROR(rocsolver_dcsrrf_analysis(this->handle,
+                                                              n,
+                                                              1,
+                                                              nnzA,
+                                                              dPtrA,
+                                                              dIndA,
+                                                              (double*)this->k_val,
+                                                              nnzM,
+                                                              this->dPtrM,
+                                                              this->dIndM,
+                                                              (double*)this->dValM,
+                                                              this->dPermM,
+                                                              this->dPermM,
+                                                              (double*)work,
+                                                              n,
+                                                              this->pc_rfinfo));
+                CHECK_ROCBLAS_ERROR(rocsolver_dcsrrf_refactlu(this->handle,
+                                                              n,
+                                                              nnzA,
+                                                              dPtrA,
+                                                              dIndA,
+                                                              (double*)this->k_val,
+                                                              nnzM,
+                                                              this->dPtrM,
+                                                              this->dIndM,
+                                                              (double*)this->dValM,
+                                                              this->dPermM,
+                                                              this->dPermM,
+                                                              this->pc_rfinfo));
+            }
+        }
+
+        this->pc_type     = this->k_precond;
+        this->pc_is_float = this->k_is_float;
+        this->pc_n        = n;
+        this->pc_nnzA     = nnzA;
+        this->pc_nnzM     = nnzM;
+
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // Computes the incomplete factorization of A on the host. Serves as the reference for the
+    // device preconditioner. Returns HIPSOLVER_STATUS_EXECUTION_FAILED on a zero (or, for IC0,
+    // non-positive) pivot
+    hipsolverStatus_t setup_precond_host(int reuse)
     {
-    case 1:
-    case 2:
-        ordering = CHOLMOD_AMD;
-        break;
-    case 3:
-        ordering = CHOLMOD_METIS;
-        break;
-    default:
-        ordering = CHOLMOD_NATURAL;
+        if(this->k_precond == HIPSOLVER_SP_PRECOND_NONE)
+            return HIPSOLVER_STATUS_SUCCESS;
+        if(reuse && this->hpc_type == this->k_precond && this->hpc_n == this->k_n
+           && this->hpc_nnzA == this->k_nnzA)
+            return HIPSOLVER_STATUS_SUCCESS;
+
+        int           n  = this->k_n;
+        const int*    Ap = this->k_ptr;
+        const int*    Ai = this->k_ind;
+        const double* Ax = (const double*)this->k_val;
+        this->hpc_type   = HIPSOLVER_SP_PRECOND_NONE;
+
+        std::vector<int>& Mp    = this->hPtrM;
+        std::vector<int>& Mi    = this->hIndM;
+        std::vector<int>& Mdiag = this->hDiagM;
+        this->gen_precond_pattern(this->k_precond, n, Ap, Ai, Mp, Mi, Mdiag);
+
+        // load the values of A into M
+        std::vector<double>& Mx = this->hValM;
+        std::vector<int>     pos(n, -1);
+        Mx.assign(Mi.size(), 0.0);
+        for(int i = 0; i < n; i++)
+        {
+            for(int k = Mp[i]; k < Mp[i + 1]; k++)
+                pos[Mi[k]] = k;
+            for(int k = Ap[i]; k < Ap[i + 1]; k++)
+            {
+                int j = Ai[k];
+                if(0 <= j && j < n && pos[j] >= 0)
+                    Mx[pos[j]] += Ax[k];
+            }
+            for(int k = Mp[i]; k < Mp[i + 1]; k++)
+                pos[Mi[k]] = -1;
+        }
+
+        // factorize M in place
+        for(int i = 0; i < n; i++)
+        {
+            for(int k = Mp[i]; k < Mp[i + 1]; k++)
+                pos[Mi[k]] = k;
+
+            if(this->k_precond == HIPSOLVER_SP_PRECOND_IC0)
+            {
+                double d = Mx[Mdiag[i]];
+                for(int k = Mp[i]; k < Mdiag[i]; k++)
+                {
+                    int    j = Mi[k];
+                    double s = Mx[k];
+                    for(int l = Mp[j]; l < Mdiag[j]; l++)
+                        if(pos[Mi[l]] >= 0)
+                            s -= Mx[pos[Mi[l]]] * Mx[l];
+                    Mx[k] = s / Mx[Mdiag[j]];
+                    d -= Mx[k] * Mx[k];
+                }
+                if(d <= 0)
+                    return HIPSOLVER_STATUS_EXECUTION_FAILED;
+                Mx[Mdiag[i]] = sqrt(d);
+            }
+            else
+            {
+                for(int k = Mp[i]; k < Mdiag[i]; k++)
+                {
+                    int j = Mi[k];
+                    Mx[k] /= Mx[Mdiag[j]];
+                    for(int l = Mdiag[j] + 1; l < Mp[j + 1]; l++)
+                        if(pos[Mi[l]] >= 0)
+                            Mx[pos[Mi[l]]] -= Mx[k] * Mx[l];
+                }
+                if(Mx[Mdiag[i]] == 0)
+                    return HIPSOLVER_STATUS_EXECUTION_FAILED;
+            }
+
+            for(int k = Mp[i]; k < Mp[i + 1]; k++)
+                pos[Mi[k]] = -1;
+        }
+
+        this->hpc_type = this->k_precond;
+        this->hpc_n    = n;
+        this->hpc_nnzA = this->k_nnzA;
+
+        return HIPSOLVER_STATUS_SUCCESS;
     }
-    sp->c_handle.method[0].ordering = ordering;
 
-    // set up A
-    cholmod_sparse* c_A
-        = cholmod_allocate_sparse(n, n, nnzA, true, true, 1, CHOLMOD_PATTERN, &sp->c_handle);
-    CHECK_HIP_ERROR(
-        hipMemcpy(c_A->p, csrRowPtr, sizeof(rocblas_int) * (n + 1), hipMemcpyDeviceToHost));
-    CHECK_HIP_ERROR(
-        hipMemcpy(c_A->i, csrColInd, sizeof(rocblas_int) * nnzA, hipMemcpyDeviceToHost));
-    sp->prep_input(indbase, n, nnzA, (int*)c_A->p, (int*)c_A->i, nullptr, nullptr);
+    // Sets up the state of an iterative solve. On the host, A must use base zero indices and
+    // double precision values
+    hipsolverStatus_t krylov_begin(bool                 host,
+                                   bool                 is_float,
+                                   hipsolverSpPrecond_t precond,
+                                   int                  reuse,
+                                   int                  n,
+                                   int                  nnzA,
+                                   rocsparse_mat_descr  descr,
+                                   const void*          val,
+                                   const int*           ptr,
+                                   const int*           ind,
+                                   int                  nvec)
+    {
+        this->k_host     = host;
+        this->k_is_float = is_float;
+        this->k_precond  = precond;
+        this->k_n        = n;
+        this->k_nnzA     = nnzA;
+        this->k_descr    = descr;
+        this->k_indbase  = host ? rocsparse_index_base_zero : rocsparse_get_mat_index_base(descr);
+        this->k_val      = val;
+        this->k_ptr      = ptr;
+        this->k_ind      = ind;
+        this->k_ld       = ((n - 1) / 32 + 1) * 32;
+
+        // work vectors (plus one for the preconditioner setup)
+        if(host)
+        {
+            this->k_hwork.resize(size_t(this->k_ld) * (nvec + 1));
+            return this->setup_precond_host(reuse);
+        }
+        else
+        {
+            size_t size = (is_float ? sizeof(float) : sizeof(double)) * this->k_ld * (nvec + 1);
+            if(this->k_size < size)
+            {
+                if(this->k_buffer)
+                {
+                    if(hipFree(this->k_buffer) != hipSuccess)
+                        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+                    this->k_buffer = nullptr;
+                    this->k_size   = 0;
+                }
 
-    if(tolerance > 0)
-        cholmod_drop(tolerance, c_A, &sp->c_handle);
+                if(hipMalloc(&this->k_buffer, size) != hipSuccess)
+                    return HIPSOLVER_STATUS_ALLOC_FAILED;
+                this->k_size = size;
+            }
+            return this->setup_precond_device(reuse, this->k_vector(nvec));
+        }
+    }
 
-    // factorize A (symbolic)
-    cholmod_factor* c_L = cholmod_analyze(c_A, &sp->c_handle);
+    // Returns the i-th work vector of the current iterative solve
+    void* k_vector(int i)
+    {
+        if(this->k_host)
+            return this->k_hwork.data() + size_t(this->k_ld) * i;
+        else
+            return this->k_buffer
+                   + (this->k_is_float ? sizeof(float) : sizeof(double)) * this->k_ld * i;
+    }
 
-    CHECK_HIPSOLVER_ERROR(sp->malloc_host(n));
-    int status = cholmod_analyze_ordering(c_A,
-                                          ordering,
-                                          (int*)c_L->Perm,
+    // Vector operations of the iterative solvers. Scalars are always double on the host
+    hipsolverStatus_t k_dot(const void* x, const void* y, double* result)
+    {
+        int n = this->k_n;
+        if(this->k_host)
+        {
+            double s = 0;
+            for(int i = 0; i < n; i++)
+                s += ((const double*)x)[i] * ((const double*)y)[i];
+            *result = s;
+        }
+        else if(this->k_is_float)
+        {
+            float s;
+            CHECK_ROCBLAS_ERROR(
+                rocblas_sdot(this->handle, n, (const float*)x, 1, (const float*)y, 1, &s));
+            *result = s;
+        }
+        else
+            CHECK_ROCBLAS_ERROR(
+                rocblas_ddot(this->handle, n, (const double*)x, 1, (const double*)y, 1, result));
+
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipsolverStatus_t k_nrm2(const void* x, double* result)
+    {
+        int n = this->k_n;
+        if(this->k_host)
+        {
+            double s = 0;
+            for(int i = 0; i < n; i++)
+                s += ((const double*)x)[i] * ((const double*)x)[i];
+            *result = sqrt(s);
+        }
+        else if(this->k_is_float)
+        {
+            float s;
+            CHECK_ROCBLAS_ERROR(rocblas_snrm2(this->handle, n, (const float*)x, 1, &s));
+            *result = s;
+        }
+        else
+            CHECK_ROCBLAS_ERROR(rocblas_dnrm2(this->handle, n, (const double*)x, 1, result));
+
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipsolverStatus_t k_axpy(double alpha, const void* x, void* y)
+    {
+        int n = this->k_n;
+        if(this->k_host)
+        {
+            for(int i = 0; i < n; i++)
+                ((double*)y)[i] += alpha * ((const double*)x)[i];
+        }
+        else if(this->k_is_float)
+        {
+            float a = alpha;
+            CHECK_ROCBLAS_ERROR(
+                rocblas_saxpy(this->handle, n, &a, (const float*)x, 1, (float*)y, 1));
+        }
+        else
+            CHECK_ROCBLAS_ERROR(
+                rocblas_daxpy(this->handle, n, &alpha, (const double*)x, 1, (double*)y, 1));
+
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipsolverStatus_t k_scal(double alpha, void* x)
+    {
+        int n = this->k_n;
+        if(this->k_host)
+        {
+            for(int i = 0; i < n; i++)
+                ((double*)x)[i] *= alpha;
+        }
+        else if(this->k_is_float)
+        {
+            float a = alpha;
+            CHECK_ROCBLAS_ERROR(rocblas_sscal(this->handle, n, &a, (float*)x, 1));
+        }
+        else
+            CHECK_ROCBLAS_ERROR(rocblas_dscal(this->handle, n, &alpha, (double*)x, 1));
+
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipsolverStatus_t k_copy(const void* x, void* y)
+    {
+        int n = this->k_n;
+        if(this->k_host)
+            memcpy(y, x, sizeof(double) * n);
+        else if(this->k_is_float)
+            CHECK_ROCBLAS_ERROR(rocblas_scopy(this->handle, n, (const float*)x, 1, (float*)y, 1));
+        else
+            CHECK_ROCBLAS_ERROR(
+                rocblas_dcopy(this->handle, n, (const double*)x, 1, (double*)y, 1));
+
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipsolverStatus_t k_zero(void* x)
+    {
+        int n = this->k_n;
+        if(this->k_host)
+            memset(x, 0, sizeof(double) * n);
+        else
+        {
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(this->handle, &stream));
+            CHECK_HIP_ERROR(hipMemsetAsync(
+                x, 0, (this->k_is_float ? sizeof(float) : sizeof(double)) * n, stream));
+        }
+
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // y = alpha * A * x + beta * y
+    hipsolverStatus_t k_spmv(double alpha, const void* x, double beta, void* y)
+    {
+        int n    = this->k_n;
+        int nnzA = this->k_nnzA;
+        if(this->k_host)
+        {
+            const double* Ax = (const double*)this->k_val;
+            for(int i = 0; i < n; i++)
+            {
+                double s = 0;
+                for(int k = this->k_ptr[i]; k < this->k_ptr[i + 1]; k++)
+                    s += Ax[k] * ((const double*)x)[this->k_ind[k]];
+                ((double*)y)[i] = alpha * s + (beta == 0 ? 0 : beta * ((double*)y)[i]);
+            }
+        }
+        else
+        {
+            rocsparse_status status;
+            if(this->k_is_float)
+            {
+                float a = alpha, b = beta;
+                status  = rocsparse_scsrmv(this->sphandle,
+                                          rocsparse_operation_none,
+                                          n,
+                                          n,
+                                          nnzA,
+                                          &a,
+                                          this->k_descr,
+                                          (const float*)this->k_val,
+                                          this->k_ptr,
+                                          this->k_ind,
                                           nullptr,
-                                          0,
-                                          sp->hParent,
-                                          sp->hWork1,
+                                          (const float*)x,
+                                          &b,
+                                          (float*)y);
+            }
+            else
+                status = rocsparse_dcsrmv(this->sphandle,
+                                          rocsparse_operation_none,
+                                          n,
+                                          n,
+                                          nnzA,
+                                          &alpha,
+                                          this->k_descr,
+                                          (const double*)this->k_val,
+                                          this->k_ptr,
+                                          this->k_ind,
                                           nullptr,
-                                          sp->hWork2,
-                                          sp->hWork3,
-                                          &sp->c_handle);
+                                          (const double*)x,
+                                          &beta,
+                                          (double*)y);
+            if(status != rocsparse_status_success)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
 
-    std::vector<int> hIndA;
-    sp->gen_sparsity_pattern(n,
-                             (int*)c_A->p,
-                             (int*)c_A->i,
-                             (int*)c_L->Perm,
-                             sp->hWork1,
-                             sp->hParent,
-                             sp->hWork2,
-                             sp->hPtrT,
-                             hIndA);
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
 
-    // set up A
-    int *dPtrA, *dIndA;
-    if(indbase == rocsparse_index_base_zero)
+    // z = M^-1 * z
+    hipsolverStatus_t k_precond_apply(void* z)
     {
-        // if indices are base zero, can use input arrays
-        CHECK_HIPSOLVER_ERROR(sp->malloc_device(n, 0, hIndA.size()));
-        dPtrA = (int*)csrRowPtr;
-        dIndA = (int*)csrColInd;
+        if(this->k_precond == HIPSOLVER_SP_PRECOND_NONE)
+            return HIPSOLVER_STATUS_SUCCESS;
+
+        int n = this->k_n;
+        if(this->k_host)
+        {
+            const int*    Mp    = this->hPtrM.data();
+            const int*    Mi    = this->hIndM.data();
+            const int*    Mdiag = this->hDiagM.data();
+            const double* Mx    = this->hValM.data();
+            double*       y     = (double*)z;
+
+            if(this->k_precond == HIPSOLVER_SP_PRECOND_IC0)
+            {
+                // solve L * L' * y = z
+                for(int i = 0; i < n; i++)
+                {
+                    for(int k = Mp[i]; k < Mdiag[i]; k++)
+                        y[i] -= Mx[k] * y[Mi[k]];
+                    y[i] /= Mx[Mdiag[i]];
+                }
+                for(int i = n - 1; i >= 0; i--)
+                {
+                    y[i] /= Mx[Mdiag[i]];
+                    for(int k = Mp[i]; k < Mdiag[i]; k++)
+                        y[Mi[k]] -= Mx[k] * y[i];
+                }
+            }
+            else
+            {
+                // solve L * U * y = z, with L unit lower triangular
+                for(int i = 0; i < n; i++)
+                {
+                    for(int k = Mp[i]; k < Mdiag[i]; k++)
+                        y[i] -= Mx[k] * y[Mi[k]];
+                }
+                for(int i = n - 1; i >= 0; i--)
+                {
+                    for(int k = Mdiag[i] + 1; k < Mp[i + 1]; k++)
+                        y[i] -= Mx[k] * y[Mi[k]];
+                    y[i] /= Mx[Mdiag[i]];
+                }
+            }
+        }
+        else
+        {
+            rocblas_int* pivP
+                = (this->k_precond == HIPSOLVER_SP_PRECOND_ILU0 ? this->dPermM : nullptr);
+            if(this->k_is_float)
+                CHECK_ROCBLAS_ERROR(rocsolver_scsrrf_solve(this->handle,
+                                                           n,
+                                                           1,
+                                                           this->pc_nnzM,
+                                                           this->dPtrM,
+                                                           this->dIndM,
+                                                           (float*)this->dValM,
+                                                           pivP,
+                                                           this->dPermM,
+                                                           (float*)z,
+                                                           n,
+                                                           this->pc_rfinfo));
+            else
+                CHECK_ROCBLAS_ERROR(rocsolver_dcsrrf_solve(this->handle,
+                                                           n,
+                                                           1,
+                                                           this->pc_nnzM,
+                                                           this->dPtrM,
+                                                           this->dIndM,
+                                                           (double*)this->dValM,
+                                                           pivP,
+                                                           this->dPermM,
+                                                           (double*)z,
+                                                           n,
+                                                           this->pc_rfinfo));
+        }
+
+        return HIPSOLVER_STATUS_SUCCESS;
     }
-    else
+
+    // Stores the k-th relative residual in the user's convergence history, if provided
+    void k_history(void* resHistory, int k, double value)
     {
-        // if indices are base one, need to use temp arrays and load base zero indices
-        CHECK_HIPSOLVER_ERROR(sp->malloc_device(n, nnzA, hIndA.size()));
-        dPtrA = sp->dPtrA;
-        dIndA = sp->dIndA;
-        CHECK_HIP_ERROR(hipMemcpy(
-            (void*)sp->dPtrA, c_A->p, sizeof(rocblas_int) * (n + 1), hipMemcpyHostToDevice));
-        CHECK_HIP_ERROR(
-            hipMemcpy((void*)sp->dIndA, c_A->i, sizeof(rocblas_int) * nnzA, hipMemcpyHostToDevice));
+        if(!resHistory)
+            return;
+        if(this->k_is_float)
+            ((float*)resHistory)[k] = (float)value;
+        else
+            ((double*)resHistory)[k] = value;
     }
 
-    // set up T
-    CHECK_HIP_ERROR(hipMemcpy(
-        (void*)sp->dPtrT, sp->hPtrT, sizeof(rocblas_int) * (n + 1), hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(
-        (void*)sp->dIndT, hIndA.data(), sizeof(rocblas_int) * hIndA.size(), hipMemcpyHostToDevice));
+    // Preconditioned conjugate gradient. Stops when ||b - A*x|| <= tolerance * ||b||.
+    // niters is set to the number of iterations performed, negated if the method did not
+    // converge (iteration limit or breakdown)
+    hipsolverStatus_t krylov_pcg(
+        const void* b, double tolerance, int maxiter, void* x, int* niters, void* resHistory)
+    {
+        void* r = this->k_vector(0);
+        void* z = this->k_vector(1);
+        void* p = this->k_vector(2);
+        void* q = this->k_vector(3);
 
-    // set up Q
-    CHECK_HIP_ERROR(
-        hipMemcpy((void*)sp->dQ, c_L->Perm, sizeof(rocblas_int) * n, hipMemcpyHostToDevice));
+        double bnorm, rnorm, rz, rz_old, pq;
+        int    k         = 0;
+        bool   converged = false;
 
-    // set up B
-    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(float) * n, hipMemcpyDeviceToDevice));
+        CHECK_HIPSOLVER_ERROR(this->k_nrm2(b, &bnorm));
+        if(bnorm == 0)
+        {
+            CHECK_HIPSOLVER_ERROR(this->k_zero(x));
+            this->k_history(resHistory, 0, 0);
+            *niters = 0;
+            return HIPSOLVER_STATUS_SUCCESS;
+        }
 
-    // factorize A (numeric)
-    CHECK_ROCBLAS_ERROR(rocsolver_set_rfinfo_mode(sp->rfinfo, rocsolver_rfinfo_mode_cholesky));
-    CHECK_ROCBLAS_ERROR(rocsolver_scsrrf_analysis(sp->handle,
-                                                  n,
-                                                  1,
-                                                  nnzA,
-                                                  dPtrA,
-                                                  dIndA,
-                                                  (float*)csrVal,
-                                                  hIndA.size(),
-                                                  sp->dPtrT,
-                                                  sp->dIndT,
-                                                  (float*)sp->dValT,
-                                                  nullptr,
-                                                  sp->dQ,
-                                                  x,
-                                                  n,
-                                                  sp->rfinfo));
-    CHECK_ROCBLAS_ERROR(rocsolver_scsrrf_refactchol(sp->handle,
-                                                    n,
-                                                    nnzA,
+        // r = b - A * x
+        CHECK_HIPSOLVER_ERROR(this->k_copy(b, r));
+        CHECK_HIPSOLVER_ERROR(this->k_spmv(-1, x, 1, r));
+        CHECK_HIPSOLVER_ERROR(this->k_nrm2(r, &rnorm));
+        this->k_history(resHistory, 0, rnorm / bnorm);
+        converged = (rnorm <= tolerance * bnorm);
+
+        if(!converged)
+        {
+            // p = z = M^-1 * r
+            CHECK_HIPSOLVER_ERROR(this->k_copy(r, z));
+            CHECK_HIPSOLVER_ERROR(this->k_precond_apply(z));
+            CHECK_HIPSOLVER_ERROR(this->k_copy(z, p));
+            CHECK_HIPSOLVER_ERROR(this->k_dot(r, z, &rz));
+
+            while(k < maxiter)
+            {
+                k++;
+
+                // q = A * p
+                CHECK_HIPSOLVER_ERROR(this->k_spmv(1, p, 0, q));
+                CHECK_HIPSOLVER_ERROR(this->k_dot(p, q, &pq));
+                if(!(pq > 0))
+                {
+                    // A (or M) is not positive definite
+                    this->k_history(resHistory, k, rnorm / bnorm);
+                    break;
+                }
+
+                double alpha = rz / pq;
+                CHECK_HIPSOLVER_ERROR(this->k_axpy(alpha, p, x));
+                CHECK_HIPSOLVER_ERROR(this->k_axpy(-alpha, q, r));
+                CHECK_HIPSOLVER_ERROR(this->k_nrm2(r, &rnorm));
+                this->k_history(resHistory, k, rnorm / bnorm);
+                if(rnorm <= tolerance * bnorm)
+                {
+                    converged = true;
+                    break;
+                }
+
+                // p = z + beta * p
+                CHECK_HIPSOLVER_ERROR(this->k_copy(r, z));
+                CHECK_HIPSOLVER_ERROR(this->k_precond_apply(z));
+                rz_old = rz;
+                CHECK_HIPSOLVER_ERROR(this->k_dot(r, z, &rz));
+                CHECK_HIPSOLVER_ERROR(this->k_scal(rz / rz_old, p));
+                CHECK_HIPSOLVER_ERROR(this->k_axpy(1, z, p));
+            }
+        }
+
+        *niters = converged ? k : -k;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // Restarted GMRES with right preconditioning. The Hessenberg matrix and the Givens rotations
+    // are kept on the host. Stops when the estimated ||b - A*x|| <= tolerance * ||b||.
+    // niters is set to the number of iterations performed, negated if the method did not
+    // converge
+    hipsolverStatus_t krylov_gmres(const void* b,
+                                   double      tolerance,
+                                   int         maxiter,
+                                   int         restart,
+                                   void*       x,
+                                   int*        niters,
+                                   void*       resHistory)
+    {
+        int   m = restart;
+        void* w = this->k_vector(m + 1);
+
+        std::vector<double> H((m + 1) * m), cs(m), sn(m), g(m + 1), y(m);
+
+        double bnorm, beta;
+        int    k         = 0;
+        bool   converged = false;
+
+        CHECK_HIPSOLVER_ERROR(this->k_nrm2(b, &bnorm));
+        if(bnorm == 0)
+        {
+            CHECK_HIPSOLVER_ERROR(this->k_zero(x));
+            this->k_history(resHistory, 0, 0);
+            *niters = 0;
+            return HIPSOLVER_STATUS_SUCCESS;
+        }
+
+        // v0 = b - A * x
+        CHECK_HIPSOLVER_ERROR(this->k_copy(b, this->k_vector(0)));
+        CHECK_HIPSOLVER_ERROR(this->k_spmv(-1, x, 1, this->k_vector(0)));
+        CHECK_HIPSOLVER_ERROR(this->k_nrm2(this->k_vector(0), &beta));
+        this->k_history(resHistory, 0, beta / bnorm);
+        converged = (beta <= tolerance * bnorm);
+
+        while(!converged && k < maxiter)
+        {
+            CHECK_HIPSOLVER_ERROR(this->k_scal(1.0 / beta, this->k_vector(0)));
+            std::fill(g.begin(), g.end(), 0.0);
+            g[0] = beta;
+
+            int j = 0;
+            while(j < m && k < maxiter)
+            {
+                void* vj  = this->k_vector(j);
+                void* vj1 = this->k_vector(j + 1);
+
+                // v(j+1) = A * M^-1 * v(j), orthogonalized against v(0:j)
+                CHECK_HIPSOLVER_ERROR(this->k_copy(vj, w));
+                CHECK_HIPSOLVER_ERROR(this->k_precond_apply(w));
+                CHECK_HIPSOLVER_ERROR(this->k_spmv(1, w, 0, vj1));
+                for(int i = 0; i <= j; i++)
+                {
+                    double h;
+                    CHECK_HIPSOLVER_ERROR(this->k_dot(this->k_vector(i), vj1, &h));
+                    CHECK_HIPSOLVER_ERROR(this->k_axpy(-h, this->k_vector(i), vj1));
+                    H[i + j * (m + 1)] = h;
+                }
+                double hnorm;
+                CHECK_HIPSOLVER_ERROR(this->k_nrm2(vj1, &hnorm));
+                H[j + 1 + j * (m + 1)] = hnorm;
+                if(hnorm != 0)
+                    CHECK_HIPSOLVER_ERROR(this->k_scal(1.0 / hnorm, vj1));
+
+                // apply previous rotations to column j and compute the new one
+                double* hj = H.data() + j * (m + 1);
+                for(int i = 0; i < j; i++)
+                {
+                    double t  = cs[i] * hj[i] + sn[i] * hj[i + 1];
+                    hj[i + 1] = -sn[i] * hj[i] + cs[i] * hj[i + 1];
+                    hj[i]     = t;
+                }
+                double den = std::hypot(hj[j], hj[j + 1]);
+                cs[j]      = (den == 0 ? 1 : hj[j] / den);
+                sn[j]      = (den == 0 ? 0 : hj[j + 1] / den);
+                hj[j]      = den;
+                hj[j + 1]  = 0;
+                g[j + 1]   = -sn[j] * g[j];
+                g[j]       = cs[j] * g[j];
+
+                j++;
+                k++;
+                this->k_history(resHistory, k, std::abs(g[j]) / bnorm);
+                if(std::abs(g[j]) <= tolerance * bnorm)
+                {
+                    converged = true;
+                    break;
+                }
+                if(hnorm == 0)
+                    break;
+            }
+
+            // solve H(0:j,0:j) * y = g(0:j)
+            for(int i = j - 1; i >= 0; i--)
+            {
+                double s = g[i];
+                for(int l = i + 1; l < j; l++)
+                    s -= H[i + l * (m + 1)] * y[l];
+                y[i] = (H[i + i * (m + 1)] != 0 ? s / H[i + i * (m + 1)] : 0);
+            }
+
+            // x = x + M^-1 * V * y
+            CHECK_HIPSOLVER_ERROR(this->k_zero(w));
+            for(int i = 0; i < j; i++)
+                CHECK_HIPSOLVER_ERROR(this->k_axpy(y[i], this->k_vector(i), w));
+            CHECK_HIPSOLVER_ERROR(this->k_precond_apply(w));
+            CHECK_HIPSOLVER_ERROR(this->k_axpy(1, w, x));
+
+            if(!converged)
+            {
+                // restart from the true residual
+                CHECK_HIPSOLVER_ERROR(this->k_copy(b, this->k_vector(0)));
+                CHECK_HIPSOLVER_ERROR(this->k_spmv(-1, x, 1, this->k_vector(0)));
+                CHECK_HIPSOLVER_ERROR(this->k_nrm2(this->k_vector(0), &beta));
+                converged = (beta <= tolerance * bnorm);
+            }
+        }
+
+        *niters = converged ? k : -k;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+};
+
+hipsolverStatus_t hipsolverSpCreate(hipsolverSpHandle_t* handle)
+try
+{
+#ifndef HAVE_ROCSPARSE
+    if(!::hipsolver::try_load_rocsparse())
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    if(!::hipsolver::try_load_cholmod())
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+#endif // HAVE_ROCSPARSE
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolverSpHandle* sp = new hipsolverSpHandle;
+    rocblas_status     status;
+    rocsparse_status   sp_status;
+
+    // without a device, only the host functions can be used
+    int device_count;
+    if(hipGetDeviceCount(&device_count) != hipSuccess || device_count == 0)
+    {
+        sp->host_only = true;
+        if(cholmod_start(&sp->c_handle) != TRUE)
+        {
+            delete sp;
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+        if(cholmod_l_start(&sp->c_handle64) != TRUE)
+        {
+            cholmod_finish(&sp->c_handle);
+            delete sp;
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+
+        *handle = sp;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    if((status = rocblas_create_handle(&sp->handle)) != rocblas_status_success)
+    {
+        delete sp;
+        return hipsolver::rocblas2hip_status(status);
+    }
+
+    if((sp_status = rocsparse_create_handle(&sp->sphandle)) != rocsparse_status_success)
+    {
+        rocblas_destroy_handle(sp->handle);
+        delete sp;
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+    }
+
+    if((status = rocsolver_create_rfinfo(&sp->rfinfo, sp->handle)) != rocblas_status_success)
+    {
+        rocblas_destroy_handle(sp->handle);
+        rocsparse_destroy_handle(sp->sphandle);
+        delete sp;
+        return hipsolver::rocblas2hip_status(status);
+    }
+
+    if((status = rocsolver_create_rfinfo(&sp->pc_rfinfo, sp->handle)) != rocblas_status_success)
+    {
+        rocblas_destroy_handle(sp->handle);
+        rocsparse_destroy_handle(sp->sphandle);
+        rocsolver_destroy_rfinfo(sp->rfinfo);
+        delete sp;
+        return hipsolver::rocblas2hip_status(status);
+    }
+
+    if(cholmod_start(&sp->c_handle) != TRUE)
+    {
+        rocblas_destroy_handle(sp->handle);
+        rocsparse_destroy_handle(sp->sphandle);
+        rocsolver_destroy_rfinfo(sp->rfinfo);
+        rocsolver_destroy_rfinfo(sp->pc_rfinfo);
+        delete sp;
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    if(cholmod_l_start(&sp->c_handle64) != TRUE)
+    {
+        rocblas_destroy_handle(sp->handle);
+        rocsparse_destroy_handle(sp->sphandle);
+        rocsolver_destroy_rfinfo(sp->rfinfo);
+        rocsolver_destroy_rfinfo(sp->pc_rfinfo);
+        cholmod_finish(&sp->c_handle);
+        delete sp;
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    *handle = sp;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDestroy(hipsolverSpHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    sp->free_all();
+    if(!sp->host_only)
+    {
+        rocblas_destroy_handle(sp->handle);
+        rocsparse_destroy_handle(sp->sphandle);
+        rocsolver_destroy_rfinfo(sp->rfinfo);
+        rocsolver_destroy_rfinfo(sp->pc_rfinfo);
+    }
+    cholmod_finish(&sp->c_handle);
+    cholmod_l_finish(&sp->c_handle64);
+    delete sp;
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpSetStream(hipsolverSpHandle_t handle, hipStream_t streamId)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    if(rocsparse_set_stream(sp->sphandle, streamId) != rocsparse_status_success)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return hipsolver::rocblas2hip_status(rocblas_set_stream(sp->handle, streamId));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** CSRLSVCHOL ********************/
+hipsolverStatus_t hipsolverSpScsrlsvchol(hipsolverSpHandle_t       handle,
+                                         int                       n,
+                                         int                       nnzA,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              csrVal,
+                                         const int*                csrRowPtr,
+                                         const int*                csrColInd,
+                                         const float*              b,
+                                         float                     tolerance,
+                                         int                       reorder,
+                                         float*                    x,
+                                         int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(reorder < 0 || reorder > 3)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    // rocsparse_fill_mode fillmode = rocsparse_get_mat_fill_mode((rocsparse_mat_descr)descrA);
+    // rocsparse_diag_type diagtype = rocsparse_get_mat_diag_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    *singularity = -1;
+
+    sp->c_handle.nmethods  = 1; // use 1 reordering method
+    sp->c_handle.postorder = false; // no postordering
+    sp->c_handle.final_ll  = true; // factorize as LL' not LDL'
+    int ordering;
+    switch(reorder)
+    {
+    case 1:
+    case 2:
+        ordering = CHOLMOD_AMD;
+        break;
+    case 3:
+        ordering = CHOLMOD_METIS;
+        break;
+    default:
+        ordering = CHOLMOD_NATURAL;
+    }
+    sp->c_handle.method[0].ordering = ordering;
+
+    // set up A
+    cholmod_sparse* c_A
+        = cholmod_allocate_sparse(n, n, nnzA, true, true, 1, CHOLMOD_PATTERN, &sp->c_handle);
+    CHECK_HIP_ERROR(
+        hipMemcpy(c_A->p, csrRowPtr, sizeof(rocblas_int) * (n + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(c_A->i, csrColInd, sizeof(rocblas_int) * nnzA, hipMemcpyDeviceToHost));
+    sp->prep_input(indbase, n, nnzA, (int*)c_A->p, (int*)c_A->i, nullptr, nullptr);
+
+    if(tolerance > 0)
+        cholmod_drop(tolerance, c_A, &sp->c_handle);
+
+    // factorize A (symbolic)
+    cholmod_factor* c_L = cholmod_analyze(c_A, &sp->c_handle);
+
+    // the pattern of L must be representable with 32-bit indices; use csrlsvchol64 otherwise
+    if(!c_L || sp->c_handle.lnz > INT_MAX)
+    {
+        hipsolverStatus_t status
+            = c_L ? HIPSOLVER_STATUS_NOT_SUPPORTED : HIPSOLVER_STATUS_INTERNAL_ERROR;
+        cholmod_free_sparse(&c_A, &sp->c_handle);
+        cholmod_free_factor(&c_L, &sp->c_handle);
+        return status;
+    }
+
+    CHECK_HIPSOLVER_ERROR(sp->malloc_host(n));
+    int status = cholmod_analyze_ordering(c_A,
+                                          ordering,
+                                          (int*)c_L->Perm,
+                                          nullptr,
+                                          0,
+                                          sp->hParent,
+                                          sp->hWork1,
+                                          nullptr,
+                                          sp->hWork2,
+                                          sp->hWork3,
+                                          &sp->c_handle);
+
+    std::vector<int> hIndA;
+    sp->gen_sparsity_pattern(n,
+                             (int*)c_A->p,
+                             (int*)c_A->i,
+                             (int*)c_L->Perm,
+                             sp->hWork1,
+                             sp->hParent,
+                             sp->hWork2,
+                             sp->hPtrT,
+                             hIndA);
+
+    // set up A
+    int *dPtrA, *dIndA;
+    if(indbase == rocsparse_index_base_zero)
+    {
+        // if indices are base zero, can use input arrays
+        CHECK_HIPSOLVER_ERROR(sp->malloc_device(n, 0, hIndA.size()));
+        dPtrA = (int*)csrRowPtr;
+        dIndA = (int*)csrColInd;
+    }
+    else
+    {
+        // if indices are base one, need to use temp arrays and load base zero indices
+        CHECK_HIPSOLVER_ERROR(sp->malloc_device(n, nnzA, hIndA.size()));
+        dPtrA = sp->dPtrA;
+        dIndA = sp->dIndA;
+        CHECK_HIP_ERROR(hipMemcpy(
+            (void*)sp->dPtrA, c_A->p, sizeof(rocblas_int) * (n + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy((void*)sp->dIndA, c_A->i, sizeof(rocblas_int) * nnzA, hipMemcpyHostToDevice));
+    }
+
+    // set up T
+    CHECK_HIP_ERROR(hipMemcpy(
+        (void*)sp->dPtrT, sp->hPtrT, sizeof(rocblas_int) * (n + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        (void*)sp->dIndT, hIndA.data(), sizeof(rocblas_int) * hIndA.size(), hipMemcpyHostToDevice));
+
+    // set up Q
+    CHECK_HIP_ERROR(
+        hipMemcpy((void*)sp->dQ, c_L->Perm, sizeof(rocblas_int) * n, hipMemcpyHostToDevice));
+
+    // set up B
+    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(float) * n, hipMemcpyDeviceToDevice));
+
+    // factorize A (numeric)
+    CHECK_ROCBLAS_ERROR(rocsolver_set_rfinfo_mode(sp->rfinfo, rocsolver_rfinfo_mode_cholesky));
+    CHECK_ROCBLAS_ERROR(rocsolver_scsrrf_analysis(sp->handle,
+                                                  n,
+                                                  1,
+                                                  nnzA,
+                                                  dPtrA,
+                                                  dIndA,
+                                                  (float*)csrVal,
+                                                  hIndA.size(),
+                                                  sp->dPtrT,
+                                                  sp->dIndT,
+                                                  (float*)sp->dValT,
+                                                  nullptr,
+                                                  sp->dQ,
+                                                  x,
+                                                  n,
+                                                  sp->rfinfo));
+    CHECK_ROCBLAS_ERROR(rocsolver_scsrrf_refactchol(sp->handle,
+                                                    n,
+                                                    nnzA,
+                                                    dPtrA,
+                                                    dIndA,
+                                                    (float*)csrVal,
+                                                    hIndA.size(),
+                                                    sp->dPtrT,
+                                                    sp->dIndT,
+                                                    (float*)sp->dValT,
+                                                    sp->dQ,
+                                                    sp->rfinfo));
+
+    // gather the diagonal of L and queue its copy to the host ahead of the solve, so that a failed
+    // pivot can be located after a single synchronization
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(sp->handle, &stream));
+    CHECK_HIPSOLVER_ERROR(sp->malloc_diag(n));
+    if(n > 0)
+    {
+        if(rocsparse_sgthr(sp->sphandle,
+                           n,
+                           (float*)sp->dValT,
+                           (float*)sp->dDiag,
+                           sp->dPtrT + 1,
+                           rocsparse_index_base_one)
+           != rocsparse_status_success)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        CHECK_HIP_ERROR(hipMemcpyAsync(
+            sp->hDiag, sp->dDiag, sizeof(float) * n, hipMemcpyDeviceToHost, stream));
+    }
+
+    // solve for x
+    CHECK_ROCBLAS_ERROR(rocsolver_scsrrf_solve(sp->handle,
+                                               n,
+                                               1,
+                                               hIndA.size(),
+                                               sp->dPtrT,
+                                               sp->dIndT,
+                                               (float*)sp->dValT,
+                                               nullptr,
+                                               sp->dQ,
+                                               x,
+                                               n,
+                                               sp->rfinfo));
+
+    // locate the first pivot that is not positive (refactchol leaves it as zero or NaN)
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    float* hDiag = (float*)sp->hDiag;
+    for(int i = 0; i < n; i++)
+    {
+        if(!(hDiag[i] > 0) || std::isinf(hDiag[i]))
+        {
+            *singularity = i;
+            break;
+        }
+    }
+
+    // free resources
+    cholmod_free_sparse(&c_A, &sp->c_handle);
+    cholmod_free_factor(&c_L, &sp->c_handle);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrlsvchol(hipsolverSpHandle_t       handle,
+                                         int                       n,
+                                         int                       nnzA,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             csrVal,
+                                         const int*                csrRowPtr,
+                                         const int*                csrColInd,
+                                         const double*             b,
+                                         double                    tolerance,
+                                         int                       reorder,
+                                         double*                   x,
+                                         int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(reorder < 0 || reorder > 3)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    // rocsparse_fill_mode fillmode = rocsparse_get_mat_fill_mode((rocsparse_mat_descr)descrA);
+    // rocsparse_diag_type diagtype = rocsparse_get_mat_diag_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    *singularity = -1;
+
+    sp->c_handle.nmethods  = 1; // use 1 reordering method
+    sp->c_handle.postorder = false; // no postordering
+    sp->c_handle.final_ll  = true; // factorize as LL' not LDL'
+    int ordering;
+    switch(reorder)
+    {
+    case 1:
+    case 2:
+        ordering = CHOLMOD_AMD;
+        break;
+    case 3:
+        ordering = CHOLMOD_METIS;
+        break;
+    default:
+        ordering = CHOLMOD_NATURAL;
+    }
+    sp->c_handle.method[0].ordering = ordering;
+
+    // set up A
+    cholmod_sparse* c_A
+        = cholmod_allocate_sparse(n, n, nnzA, true, true, 1, CHOLMOD_PATTERN, &sp->c_handle);
+    CHECK_HIP_ERROR(
+        hipMemcpy(c_A->p, csrRowPtr, sizeof(rocblas_int) * (n + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(c_A->i, csrColInd, sizeof(rocblas_int) * nnzA, hipMemcpyDeviceToHost));
+    sp->prep_input(indbase, n, nnzA, (int*)c_A->p, (int*)c_A->i, nullptr, nullptr);
+
+    if(tolerance > 0)
+        cholmod_drop(tolerance, c_A, &sp->c_handle);
+
+    // factorize A (symbolic)
+    cholmod_factor* c_L = cholmod_analyze(c_A, &sp->c_handle);
+
+    // the pattern of L must be representable with 32-bit indices; use csrlsvchol64 otherwise
+    if(!c_L || sp->c_handle.lnz > INT_MAX)
+    {
+        hipsolverStatus_t status
+            = c_L ? HIPSOLVER_STATUS_NOT_SUPPORTED : HIPSOLVER_STATUS_INTERNAL_ERROR;
+        cholmod_free_sparse(&c_A, &sp->c_handle);
+        cholmod_free_factor(&c_L, &sp->c_handle);
+        return status;
+    }
+
+    CHECK_HIPSOLVER_ERROR(sp->malloc_host(n));
+    int status = cholmod_analyze_ordering(c_A,
+                                          ordering,
+                                          (int*)c_L->Perm,
+                                          nullptr,
+                                          0,
+                                          sp->hParent,
+                                          sp->hWork1,
+                                          nullptr,
+                                          sp->hWork2,
+                                          sp->hWork3,
+                                          &sp->c_handle);
+
+    std::vector<int> hIndA;
+    sp->gen_sparsity_pattern(n,
+                             (int*)c_A->p,
+                             (int*)c_A->i,
+                             (int*)c_L->Perm,
+                             sp->hWork1,
+                             sp->hParent,
+                             sp->hWork2,
+                             sp->hPtrT,
+                             hIndA);
+
+    // set up A
+    int *dPtrA, *dIndA;
+    if(indbase == rocsparse_index_base_zero)
+    {
+        // if indices are base zero, can use input arrays
+        CHECK_HIPSOLVER_ERROR(sp->malloc_device(n, 0, hIndA.size()));
+        dPtrA = (int*)csrRowPtr;
+        dIndA = (int*)csrColInd;
+    }
+    else
+    {
+        // if indices are base one, need to use temp arrays and load base zero indices
+        CHECK_HIPSOLVER_ERROR(sp->malloc_device(n, nnzA, hIndA.size()));
+        dPtrA = sp->dPtrA;
+        dIndA = sp->dIndA;
+        CHECK_HIP_ERROR(hipMemcpy(
+            (void*)sp->dPtrA, c_A->p, sizeof(rocblas_int) * (n + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy((void*)sp->dIndA, c_A->i, sizeof(rocblas_int) * nnzA, hipMemcpyHostToDevice));
+    }
+
+    // set up T
+    CHECK_HIP_ERROR(hipMemcpy(
+        (void*)sp->dPtrT, sp->hPtrT, sizeof(rocblas_int) * (n + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        (void*)sp->dIndT, hIndA.data(), sizeof(rocblas_int) * hIndA.size(), hipMemcpyHostToDevice));
+
+    // set up Q
+    CHECK_HIP_ERROR(
+        hipMemcpy((void*)sp->dQ, c_L->Perm, sizeof(rocblas_int) * n, hipMemcpyHostToDevice));
+
+    // set up B
+    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(double) * n, hipMemcpyDeviceToDevice));
+
+    // factorize A (numeric)
+    CHECK_ROCBLAS_ERROR(rocsolver_set_rfinfo_mode(sp->rfinfo, rocsolver_rfinfo_mode_cholesky));
+    CHECK_ROCBLAS_ERROR(rocsolver_dcsrrf_analysis(sp->handle,
+                                                  n,
+                                                  1,
+                                                  nnzA,
+                                                  dPtrA,
+                                                  dIndA,
+                                                  (double*)csrVal,
+                                                  hIndA.size(),
+                                                  sp->dPtrT,
+                                                  sp->dIndT,
+                                                  sp->dValT,
+                                                  nullptr,
+                                                  sp->dQ,
+                                                  x,
+                                                  n,
+                                                  sp->rfinfo));
+    CHECK_ROCBLAS_ERROR(rocsolver_dcsrrf_refactchol(sp->handle,
+                                                    n,
+                                                    nnzA,
                                                     dPtrA,
                                                     dIndA,
-                                                    (float*)csrVal,
+                                                    (double*)csrVal,
                                                     hIndA.size(),
                                                     sp->dPtrT,
                                                     sp->dIndT,
-                                                    (float*)sp->dValT,
+                                                    sp->dValT,
                                                     sp->dQ,
                                                     sp->rfinfo));
 
-    // solve for x
-    CHECK_ROCBLAS_ERROR(rocsolver_scsrrf_solve(sp->handle,
-                                               n,
-                                               1,
-                                               hIndA.size(),
-                                               sp->dPtrT,
-                                               sp->dIndT,
-                                               (float*)sp->dValT,
-                                               nullptr,
-                                               sp->dQ,
-                                               x,
-                                               n,
-                                               sp->rfinfo));
+    // gather the diagonal of L and queue its copy to the host ahead of the solve, so that a failed
+    // pivot can be located after a single synchronization
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(sp->handle, &stream));
+    CHECK_HIPSOLVER_ERROR(sp->malloc_diag(n));
+    if(n > 0)
+    {
+        if(rocsparse_dgthr(sp->sphandle,
+                           n,
+                           (double*)sp->dValT,
+                           (double*)sp->dDiag,
+                           sp->dPtrT + 1,
+                           rocsparse_index_base_one)
+           != rocsparse_status_success)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        CHECK_HIP_ERROR(hipMemcpyAsync(
+            sp->hDiag, sp->dDiag, sizeof(double) * n, hipMemcpyDeviceToHost, stream));
+    }
+
+    // solve for x
+    CHECK_ROCBLAS_ERROR(rocsolver_dcsrrf_solve(sp->handle,
+                                               n,
+                                               1,
+                                               hIndA.size(),
+                                               sp->dPtrT,
+                                               sp->dIndT,
+                                               sp->dValT,
+                                               nullptr,
+                                               sp->dQ,
+                                               x,
+                                               n,
+                                               sp->rfinfo));
+
+    // locate the first pivot that is not positive (refactchol leaves it as zero or NaN)
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    double* hDiag = (double*)sp->hDiag;
+    for(int i = 0; i < n; i++)
+    {
+        if(!(hDiag[i] > 0) || std::isinf(hDiag[i]))
+        {
+            *singularity = i;
+            break;
+        }
+    }
+
+    // free resources
+    cholmod_free_sparse(&c_A, &sp->c_handle);
+    cholmod_free_factor(&c_L, &sp->c_handle);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/*hipsolverStatus_t hipsolverSpCcsrlsvchol(hipsolverSpHandle_t       handle,
+                                         int                       n,
+                                         int                       nnzA,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipFloatComplex*    csrVal,
+                                         const int*                csrRowPtr,
+                                         const int*                csrColInd,
+                                         const hipFloatComplex*    b,
+                                         float                     tolerance,
+                                         int                       reorder,
+                                         hipFloatComplex*          x,
+                                         int*                      singularity)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpZcsrlsvchol(hipsolverSpHandle_t       handle,
+                                         int                       n,
+                                         int                       nnzA,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipDoubleComplex*   csrVal,
+                                         const int*                csrRowPtr,
+                                         const int*                csrColInd,
+                                         const hipDoubleComplex*   b,
+                                         double                    tolerance,
+                                         int                       reorder,
+                                         hipDoubleComplex*         x,
+                                         int*                      singularity)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}*/
+
+hipsolverStatus_t hipsolverSpScsrlsvcholHost(hipsolverSpHandle_t       handle,
+                                             int                       n,
+                                             int                       nnzA,
+                                             const hipsparseMatDescr_t descrA,
+                                             const float*              csrVal,
+                                             const int*                csrRowPtr,
+                                             const int*                csrColInd,
+                                             const float*              b,
+                                             float                     tolerance,
+                                             int                       reorder,
+                                             float*                    x,
+                                             int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(reorder < 0 || reorder > 3)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    // rocsparse_fill_mode fillmode = rocsparse_get_mat_fill_mode((rocsparse_mat_descr)descrA);
+    // rocsparse_diag_type diagtype = rocsparse_get_mat_diag_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    *singularity          = -1;
+
+    sp->c_handle.nmethods  = 1; // use 1 reordering method
+    sp->c_handle.postorder = false; // no postordering
+    sp->c_handle.final_ll  = true; // factorize as LL' not LDL'
+    switch(reorder)
+    {
+    case 1:
+    case 2:
+        sp->c_handle.method[0].ordering = CHOLMOD_AMD;
+        break;
+    case 3:
+        sp->c_handle.method[0].ordering = CHOLMOD_METIS;
+        break;
+    default:
+        sp->c_handle.method[0].ordering = CHOLMOD_NATURAL;
+    }
+
+    // set up A (view of the input arrays; a copy is only needed if entries are dropped)
+    std::vector<int>    tPtr, tInd;
+    std::vector<double> tVal;
+    cholmod_sparse      v_A;
+    sp->view_sparse(&v_A,
+                    n,
+                    nnzA,
+                    sp->view_index(indbase, n + 1, csrRowPtr, tPtr),
+                    sp->view_index(indbase, nnzA, csrColInd, tInd),
+                    sp->view_values(nnzA, csrVal, tVal),
+                    CHOLMOD_INT);
+
+    cholmod_sparse* c_A = &v_A;
+    if(tolerance > 0)
+    {
+        c_A = cholmod_copy_sparse(&v_A, &sp->c_handle);
+        cholmod_drop(tolerance, c_A, &sp->c_handle);
+    }
+
+    // factorize A
+    cholmod_factor* c_L    = cholmod_analyze(c_A, &sp->c_handle);
+    int             status = cholmod_factorize(c_A, c_L, &sp->c_handle);
+    if(status != TRUE)
+    {
+        sp->free_input(&c_A, &v_A);
+        cholmod_free_factor(&c_L, &sp->c_handle);
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    if(sp->c_handle.status == CHOLMOD_NOT_POSDEF)
+    {
+        *singularity = c_L->minor;
+        sp->free_input(&c_A, &v_A);
+        cholmod_free_factor(&c_L, &sp->c_handle);
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // set up B
+    cholmod_dense* c_b = cholmod_allocate_dense(n, 1, n, CHOLMOD_REAL, &sp->c_handle);
+    sp->prep_input(n, (double*)c_b->x, (float*)b);
+
+    // solve for x
+    cholmod_dense* c_x = cholmod_solve(CHOLMOD_A, c_L, c_b, &sp->c_handle);
+
+    // copy back results
+    sp->prep_output(n, (double*)c_x->x, (float*)x);
+
+    // free resources
+    sp->free_input(&c_A, &v_A);
+    cholmod_free_factor(&c_L, &sp->c_handle);
+    cholmod_free_dense(&c_b, &sp->c_handle);
+    cholmod_free_dense(&c_x, &sp->c_handle);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrlsvcholHost(hipsolverSpHandle_t       handle,
+                                             int                       n,
+                                             int                       nnzA,
+                                             const hipsparseMatDescr_t descrA,
+                                             const double*             csrVal,
+                                             const int*                csrRowPtr,
+                                             const int*                csrColInd,
+                                             const double*             b,
+                                             double                    tolerance,
+                                             int                       reorder,
+                                             double*                   x,
+                                             int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(reorder < 0 || reorder > 3)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    // rocsparse_fill_mode fillmode = rocsparse_get_mat_fill_mode((rocsparse_mat_descr)descrA);
+    // rocsparse_diag_type diagtype = rocsparse_get_mat_diag_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    *singularity          = -1;
+
+    sp->c_handle.nmethods  = 1; // use 1 reordering method
+    sp->c_handle.postorder = false; // no postordering
+    sp->c_handle.final_ll  = true; // factorize as LL' not LDL'
+    switch(reorder)
+    {
+    case 1:
+    case 2:
+        sp->c_handle.method[0].ordering = CHOLMOD_AMD;
+        break;
+    case 3:
+        sp->c_handle.method[0].ordering = CHOLMOD_METIS;
+        break;
+    default:
+        sp->c_handle.method[0].ordering = CHOLMOD_NATURAL;
+    }
+
+    // set up A (view of the input arrays; a copy is only needed if entries are dropped)
+    std::vector<int>    tPtr, tInd;
+    std::vector<double> tVal;
+    cholmod_sparse      v_A;
+    sp->view_sparse(&v_A,
+                    n,
+                    nnzA,
+                    sp->view_index(indbase, n + 1, csrRowPtr, tPtr),
+                    sp->view_index(indbase, nnzA, csrColInd, tInd),
+                    sp->view_values(nnzA, csrVal, tVal),
+                    CHOLMOD_INT);
+
+    cholmod_sparse* c_A = &v_A;
+    if(tolerance > 0)
+    {
+        c_A = cholmod_copy_sparse(&v_A, &sp->c_handle);
+        cholmod_drop(tolerance, c_A, &sp->c_handle);
+    }
+
+    // factorize A
+    cholmod_factor* c_L    = cholmod_analyze(c_A, &sp->c_handle);
+    int             status = cholmod_factorize(c_A, c_L, &sp->c_handle);
+    if(status != TRUE)
+    {
+        sp->free_input(&c_A, &v_A);
+        cholmod_free_factor(&c_L, &sp->c_handle);
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    if(sp->c_handle.status == CHOLMOD_NOT_POSDEF)
+    {
+        *singularity = c_L->minor;
+        sp->free_input(&c_A, &v_A);
+        cholmod_free_factor(&c_L, &sp->c_handle);
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // set up B
+    cholmod_dense* c_b = cholmod_allocate_dense(n, 1, n, CHOLMOD_REAL, &sp->c_handle);
+    memcpy(c_b->x, b, sizeof(double) * n);
+
+    // solve for x
+    cholmod_dense* c_x = cholmod_solve(CHOLMOD_A, c_L, c_b, &sp->c_handle);
+
+    // copy back results
+    memcpy((void*)x, c_x->x, sizeof(double) * n);
+
+    // free resources
+    sp->free_input(&c_A, &v_A);
+    cholmod_free_factor(&c_L, &sp->c_handle);
+    cholmod_free_dense(&c_b, &sp->c_handle);
+    cholmod_free_dense(&c_x, &sp->c_handle);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/*hipsolverStatus_t hipsolverSpCcsrlsvcholHost(hipsolverSpHandle_t       handle,
+                                             int                       n,
+                                             int                       nnzA,
+                                             const hipsparseMatDescr_t descrA,
+                                             const hipFloatComplex*    csrVal,
+                                             const int*                csrRowPtr,
+                                             const int*                csrColInd,
+                                             const hipFloatComplex*    b,
+                                             float                     tolerance,
+                                             int                       reorder,
+                                             hipFloatComplex*          x,
+                                             int*                      singularity)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpZcsrlsvcholHost(hipsolverSpHandle_t       handle,
+                                             int                       n,
+                                             int                       nnzA,
+                                             const hipsparseMatDescr_t descrA,
+                                             const hipDoubleComplex*   csrVal,
+                                             const int*                csrRowPtr,
+                                             const int*                csrColInd,
+                                             const hipDoubleComplex*   b,
+                                             double                    tolerance,
+                                             int                       reorder,
+                                             hipDoubleComplex*         x,
+                                             int*                      singularity)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}*/
+
+/******************** CSRLSVCHOL64 ********************/
+hipsolverStatus_t hipsolverSpScsrlsvchol64(hipsolverSpHandle_t       handle,
+                                           int64_t                   n,
+                                           int64_t                   nnzA,
+                                           const hipsparseMatDescr_t descrA,
+                                           const float*              csrVal,
+                                           const int64_t*            csrRowPtr,
+                                           const int64_t*            csrColInd,
+                                           const float*              b,
+                                           float                     tolerance,
+                                           int                       reorder,
+                                           float*                    x,
+                                           int64_t*                  singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(reorder < 0 || reorder > 3)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    *singularity = -1;
+
+    // set up A (host)
+    cholmod_sparse* c_A
+        = cholmod_l_allocate_sparse(n, n, nnzA, true, true, 1, CHOLMOD_REAL, &sp->c_handle64);
+    if(!c_A)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+    CHECK_HIP_ERROR(
+        hipMemcpy(c_A->p, csrRowPtr, sizeof(int64_t) * (n + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(c_A->i, csrColInd, sizeof(int64_t) * nnzA, hipMemcpyDeviceToHost));
+    sp->prep_input(indbase, n, nnzA, (int64_t*)c_A->p, (int64_t*)c_A->i, nullptr, nullptr);
+
+    // factorize A (symbolic)
+    cholmod_factor* c_L = sp->chol64_analyze(c_A, reorder);
+    if(!c_L)
+    {
+        cholmod_l_free_sparse(&c_A, &sp->c_handle64);
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    if(n <= INT_MAX && nnzA <= INT_MAX && sp->c_handle64.lnz <= INT_MAX)
+    {
+        // the pattern of L fits in 32-bit indices, so narrow the indices of A and solve on the
+        // device with the 32-bit function
+        int64_t*         Ap    = (int64_t*)c_A->p;
+        int64_t*         Ai    = (int64_t*)c_A->i;
+        int64_t          base  = (indbase == rocsparse_index_base_one ? 1 : 0);
+        int64_t          count = std::min(nnzA, Ap[n]);
+        std::vector<int> hPtrA(n + 1), hIndA(std::max(nnzA, int64_t(1)));
+        for(int64_t i = 0; i <= n; i++)
+            hPtrA[i] = Ap[i] + base;
+        for(int64_t i = 0; i < count; i++)
+            hIndA[i] = Ai[i] + base;
+
+        cholmod_l_free_sparse(&c_A, &sp->c_handle64);
+        cholmod_l_free_factor(&c_L, &sp->c_handle64);
+
+        CHECK_HIPSOLVER_ERROR(sp->malloc_narrow(n, nnzA));
+        CHECK_HIP_ERROR(hipMemcpy((void*)sp->dPtrA32,
+                                  hPtrA.data(),
+                                  sizeof(rocblas_int) * (n + 1),
+                                  hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            (void*)sp->dIndA32, hIndA.data(), sizeof(rocblas_int) * nnzA, hipMemcpyHostToDevice));
+
+        int singularity32;
+        CHECK_HIPSOLVER_ERROR(hipsolverSpScsrlsvchol(handle,
+                                                     n,
+                                                     nnzA,
+                                                     descrA,
+                                                     csrVal,
+                                                     sp->dPtrA32,
+                                                     sp->dIndA32,
+                                                     b,
+                                                     tolerance,
+                                                     reorder,
+                                                     x,
+                                                     &singularity32));
+        *singularity = singularity32;
+
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // otherwise, the factorization cannot be handled by rocSOLVER and A is factorized on the host
+    std::vector<float> hVal(nnzA);
+    CHECK_HIP_ERROR(hipMemcpy(hVal.data(), csrVal, sizeof(float) * nnzA, hipMemcpyDeviceToHost));
+    sp->prep_input(nnzA, (double*)c_A->x, hVal.data());
+
+    if(tolerance > 0)
+    {
+        cholmod_l_drop(tolerance, c_A, &sp->c_handle64);
+        cholmod_l_free_factor(&c_L, &sp->c_handle64);
+        c_L = sp->chol64_analyze(c_A, reorder);
+    }
+
+    // factorize A (numeric)
+    hipsolverStatus_t status = sp->chol64_factorize(c_A, &c_L, singularity);
+    if(status != HIPSOLVER_STATUS_SUCCESS || *singularity >= 0)
+    {
+        cholmod_l_free_sparse(&c_A, &sp->c_handle64);
+        return status;
+    }
+
+    // set up B
+    cholmod_dense* c_b = cholmod_l_allocate_dense(n, 1, n, CHOLMOD_REAL, &sp->c_handle64);
+    std::vector<float> hB(n);
+    CHECK_HIP_ERROR(hipMemcpy(hB.data(), b, sizeof(float) * n, hipMemcpyDeviceToHost));
+    sp->prep_input(n, (double*)c_b->x, hB.data());
+
+    // solve for x
+    cholmod_dense* c_x = cholmod_l_solve(CHOLMOD_A, c_L, c_b, &sp->c_handle64);
+
+    // copy back results
+    std::vector<float> hX(n);
+    sp->prep_output(n, (double*)c_x->x, hX.data());
+    CHECK_HIP_ERROR(hipMemcpy((void*)x, hX.data(), sizeof(float) * n, hipMemcpyHostToDevice));
+
+    // free resources
+    cholmod_l_free_sparse(&c_A, &sp->c_handle64);
+    cholmod_l_free_factor(&c_L, &sp->c_handle64);
+    cholmod_l_free_dense(&c_b, &sp->c_handle64);
+    cholmod_l_free_dense(&c_x, &sp->c_handle64);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrlsvchol64(hipsolverSpHandle_t       handle,
+                                           int64_t                   n,
+                                           int64_t                   nnzA,
+                                           const hipsparseMatDescr_t descrA,
+                                           const double*             csrVal,
+                                           const int64_t*            csrRowPtr,
+                                           const int64_t*            csrColInd,
+                                           const double*             b,
+                                           double                    tolerance,
+                                           int                       reorder,
+                                           double*                   x,
+                                           int64_t*                  singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(reorder < 0 || reorder > 3)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    *singularity = -1;
+
+    // set up A (host)
+    cholmod_sparse* c_A
+        = cholmod_l_allocate_sparse(n, n, nnzA, true, true, 1, CHOLMOD_REAL, &sp->c_handle64);
+    if(!c_A)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+    CHECK_HIP_ERROR(
+        hipMemcpy(c_A->p, csrRowPtr, sizeof(int64_t) * (n + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(c_A->i, csrColInd, sizeof(int64_t) * nnzA, hipMemcpyDeviceToHost));
+    sp->prep_input(indbase, n, nnzA, (int64_t*)c_A->p, (int64_t*)c_A->i, nullptr, nullptr);
+
+    // factorize A (symbolic)
+    cholmod_factor* c_L = sp->chol64_analyze(c_A, reorder);
+    if(!c_L)
+    {
+        cholmod_l_free_sparse(&c_A, &sp->c_handle64);
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    if(n <= INT_MAX && nnzA <= INT_MAX && sp->c_handle64.lnz <= INT_MAX)
+    {
+        // the pattern of L fits in 32-bit indices, so narrow the indices of A and solve on the
+        // device with the 32-bit function
+        int64_t*         Ap    = (int64_t*)c_A->p;
+        int64_t*         Ai    = (int64_t*)c_A->i;
+        int64_t          base  = (indbase == rocsparse_index_base_one ? 1 : 0);
+        int64_t          count = std::min(nnzA, Ap[n]);
+        std::vector<int> hPtrA(n + 1), hIndA(std::max(nnzA, int64_t(1)));
+        for(int64_t i = 0; i <= n; i++)
+            hPtrA[i] = Ap[i] + base;
+        for(int64_t i = 0; i < count; i++)
+            hIndA[i] = Ai[i] + base;
+
+        cholmod_l_free_sparse(&c_A, &sp->c_handle64);
+        cholmod_l_free_factor(&c_L, &sp->c_handle64);
+
+        CHECK_HIPSOLVER_ERROR(sp->malloc_narrow(n, nnzA));
+        CHECK_HIP_ERROR(hipMemcpy((void*)sp->dPtrA32,
+                                  hPtrA.data(),
+                                  sizeof(rocblas_int) * (n + 1),
+                                  hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            (void*)sp->dIndA32, hIndA.data(), sizeof(rocblas_int) * nnzA, hipMemcpyHostToDevice));
+
+        int singularity32;
+        CHECK_HIPSOLVER_ERROR(hipsolverSpDcsrlsvchol(handle,
+                                                     n,
+                                                     nnzA,
+                                                     descrA,
+                                                     csrVal,
+                                                     sp->dPtrA32,
+                                                     sp->dIndA32,
+                                                     b,
+                                                     tolerance,
+                                                     reorder,
+                                                     x,
+                                                     &singularity32));
+        *singularity = singularity32;
+
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // otherwise, the factorization cannot be handled by rocSOLVER and A is factorized on the host
+    CHECK_HIP_ERROR(hipMemcpy(c_A->x, csrVal, sizeof(double) * nnzA, hipMemcpyDeviceToHost));
+
+    if(tolerance > 0)
+    {
+        cholmod_l_drop(tolerance, c_A, &sp->c_handle64);
+        cholmod_l_free_factor(&c_L, &sp->c_handle64);
+        c_L = sp->chol64_analyze(c_A, reorder);
+    }
+
+    // factorize A (numeric)
+    hipsolverStatus_t status = sp->chol64_factorize(c_A, &c_L, singularity);
+    if(status != HIPSOLVER_STATUS_SUCCESS || *singularity >= 0)
+    {
+        cholmod_l_free_sparse(&c_A, &sp->c_handle64);
+        return status;
+    }
+
+    // set up B
+    cholmod_dense* c_b = cholmod_l_allocate_dense(n, 1, n, CHOLMOD_REAL, &sp->c_handle64);
+    CHECK_HIP_ERROR(hipMemcpy(c_b->x, b, sizeof(double) * n, hipMemcpyDeviceToHost));
+
+    // solve for x
+    cholmod_dense* c_x = cholmod_l_solve(CHOLMOD_A, c_L, c_b, &sp->c_handle64);
+
+    // copy back results
+    CHECK_HIP_ERROR(hipMemcpy((void*)x, c_x->x, sizeof(double) * n, hipMemcpyHostToDevice));
+
+    // free resources
+    cholmod_l_free_sparse(&c_A, &sp->c_handle64);
+    cholmod_l_free_factor(&c_L, &sp->c_handle64);
+    cholmod_l_free_dense(&c_b, &sp->c_handle64);
+    cholmod_l_free_dense(&c_x, &sp->c_handle64);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpScsrlsvcholHost64(hipsolverSpHandle_t       handle,
+                                               int64_t                   n,
+                                               int64_t                   nnzA,
+                                               const hipsparseMatDescr_t descrA,
+                                               const float*              csrVal,
+                                               const int64_t*            csrRowPtr,
+                                               const int64_t*            csrColInd,
+                                               const float*              b,
+                                               float                     tolerance,
+                                               int                       reorder,
+                                               float*                    x,
+                                               int64_t*                  singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(reorder < 0 || reorder > 3)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    *singularity          = -1;
+
+    // set up A (view of the input arrays; a copy is only needed if entries are dropped)
+    std::vector<int64_t> tPtr, tInd;
+    std::vector<double>  tVal;
+    cholmod_sparse       v_A;
+    sp->view_sparse(&v_A,
+                    n,
+                    nnzA,
+                    sp->view_index(indbase, n + 1, csrRowPtr, tPtr),
+                    sp->view_index(indbase, nnzA, csrColInd, tInd),
+                    sp->view_values(nnzA, csrVal, tVal),
+                    CHOLMOD_LONG);
+
+    cholmod_sparse* c_A = &v_A;
+    if(tolerance > 0)
+    {
+        c_A = cholmod_l_copy_sparse(&v_A, &sp->c_handle64);
+        cholmod_l_drop(tolerance, c_A, &sp->c_handle64);
+    }
+
+    // factorize A
+    cholmod_factor*   c_L    = sp->chol64_analyze(c_A, reorder);
+    hipsolverStatus_t status = sp->chol64_factorize(c_A, &c_L, singularity);
+    if(status != HIPSOLVER_STATUS_SUCCESS || *singularity >= 0)
+    {
+        sp->free_input(&c_A, &v_A);
+        return status;
+    }
+
+    // set up B
+    cholmod_dense* c_b = cholmod_l_allocate_dense(n, 1, n, CHOLMOD_REAL, &sp->c_handle64);
+    sp->prep_input(n, (double*)c_b->x, (float*)b);
+
+    // solve for x
+    cholmod_dense* c_x = cholmod_l_solve(CHOLMOD_A, c_L, c_b, &sp->c_handle64);
+
+    // copy back results
+    sp->prep_output(n, (double*)c_x->x, (float*)x);
+
+    // free resources
+    sp->free_input(&c_A, &v_A);
+    cholmod_l_free_factor(&c_L, &sp->c_handle64);
+    cholmod_l_free_dense(&c_b, &sp->c_handle64);
+    cholmod_l_free_dense(&c_x, &sp->c_handle64);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrlsvcholHost64(hipsolverSpHandle_t       handle,
+                                               int64_t                   n,
+                                               int64_t                   nnzA,
+                                               const hipsparseMatDescr_t descrA,
+                                               const double*             csrVal,
+                                               const int64_t*            csrRowPtr,
+                                               const int64_t*            csrColInd,
+                                               const double*             b,
+                                               double                    tolerance,
+                                               int                       reorder,
+                                               double*                   x,
+                                               int64_t*                  singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(reorder < 0 || reorder > 3)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    *singularity          = -1;
+
+    // set up A (view of the input arrays; a copy is only needed if entries are dropped)
+    std::vector<int64_t> tPtr, tInd;
+    std::vector<double>  tVal;
+    cholmod_sparse       v_A;
+    sp->view_sparse(&v_A,
+                    n,
+                    nnzA,
+                    sp->view_index(indbase, n + 1, csrRowPtr, tPtr),
+                    sp->view_index(indbase, nnzA, csrColInd, tInd),
+                    sp->view_values(nnzA, csrVal, tVal),
+                    CHOLMOD_LONG);
+
+    cholmod_sparse* c_A = &v_A;
+    if(tolerance > 0)
+    {
+        c_A = cholmod_l_copy_sparse(&v_A, &sp->c_handle64);
+        cholmod_l_drop(tolerance, c_A, &sp->c_handle64);
+    }
+
+    // factorize A
+    cholmod_factor*   c_L    = sp->chol64_analyze(c_A, reorder);
+    hipsolverStatus_t status = sp->chol64_factorize(c_A, &c_L, singularity);
+    if(status != HIPSOLVER_STATUS_SUCCESS || *singularity >= 0)
+    {
+        sp->free_input(&c_A, &v_A);
+        return status;
+    }
+
+    // set up B
+    cholmod_dense* c_b = cholmod_l_allocate_dense(n, 1, n, CHOLMOD_REAL, &sp->c_handle64);
+    memcpy(c_b->x, b, sizeof(double) * n);
+
+    // solve for x
+    cholmod_dense* c_x = cholmod_l_solve(CHOLMOD_A, c_L, c_b, &sp->c_handle64);
+
+    // copy back results
+    memcpy((void*)x, c_x->x, sizeof(double) * n);
+
+    // free resources
+    sp->free_input(&c_A, &v_A);
+    cholmod_l_free_factor(&c_L, &sp->c_handle64);
+    cholmod_l_free_dense(&c_b, &sp->c_handle64);
+    cholmod_l_free_dense(&c_x, &sp->c_handle64);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** CSRLSVLDL ********************/
+hipsolverStatus_t hipsolverSpScsrlsvldl(hipsolverSpHandle_t       handle,
+                                        int                       n,
+                                        int                       nnzA,
+                                        const hipsparseMatDescr_t descrA,
+                                        const float*              csrVal,
+                                        const int*                csrRowPtr,
+                                        const int*                csrColInd,
+                                        const float*              b,
+                                        float                     tolerance,
+                                        int                       reorder,
+                                        float                     perturb,
+                                        float*                    x,
+                                        int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(reorder < 0 || reorder > 3 || perturb < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    *singularity = -1;
+
+    // set up A (host)
+    cholmod_sparse* c_A
+        = cholmod_allocate_sparse(n, n, nnzA, true, true, 1, CHOLMOD_REAL, &sp->c_handle);
+    std::vector<float> hVal(nnzA);
+    CHECK_HIP_ERROR(
+        hipMemcpy(hVal.data(), csrVal, sizeof(float) * nnzA, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(c_A->p, csrRowPtr, sizeof(rocblas_int) * (n + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(c_A->i, csrColInd, sizeof(rocblas_int) * nnzA, hipMemcpyDeviceToHost));
+    sp->prep_input(indbase, n, nnzA, (int*)c_A->p, (int*)c_A->i, (double*)c_A->x, hVal.data());
+
+    if(tolerance > 0)
+        cholmod_drop(tolerance, c_A, &sp->c_handle);
+
+    // factorize A (host)
+    cholmod_factor*   c_L;
+    hipsolverStatus_t status = sp->ldl_factorize(c_A, reorder, perturb, &c_L, singularity);
+    if(status != HIPSOLVER_STATUS_SUCCESS || *singularity >= 0)
+    {
+        cholmod_free_sparse(&c_A, &sp->c_handle);
+        return status;
+    }
+
+    // the bundled factors must be representable with 32-bit indices
+    if(2 * sp->c_handle.lnz - n > INT_MAX)
+    {
+        cholmod_free_sparse(&c_A, &sp->c_handle);
+        cholmod_free_factor(&c_L, &sp->c_handle);
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+
+    std::vector<int>    hPtrT, hIndT;
+    std::vector<double> hValT;
+    sp->ldl_bundle(c_L, hPtrT, hIndT, hValT);
+    int nnzT = hIndT.size();
+
+    // set up A (device)
+    int *dPtrA, *dIndA;
+    if(indbase == rocsparse_index_base_zero)
+    {
+        // if indices are base zero, can use input arrays
+        CHECK_HIPSOLVER_ERROR(sp->malloc_device(n, 0, nnzT));
+        dPtrA = (int*)csrRowPtr;
+        dIndA = (int*)csrColInd;
+    }
+    else
+    {
+        // if indices are base one, need to use temp arrays and load base zero indices
+        CHECK_HIPSOLVER_ERROR(sp->malloc_device(n, nnzA, nnzT));
+        dPtrA = sp->dPtrA;
+        dIndA = sp->dIndA;
+        CHECK_HIP_ERROR(hipMemcpy(
+            (void*)sp->dPtrA, c_A->p, sizeof(rocblas_int) * (n + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy((void*)sp->dIndA, c_A->i, sizeof(rocblas_int) * nnzA, hipMemcpyHostToDevice));
+    }
+
+    // set up T
+    CHECK_HIP_ERROR(hipMemcpy(
+        (void*)sp->dPtrT, hPtrT.data(), sizeof(rocblas_int) * (n + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        (void*)sp->dIndT, hIndT.data(), sizeof(rocblas_int) * nnzT, hipMemcpyHostToDevice));
+    std::vector<float> hValTs(nnzT);
+    sp->prep_output(nnzT, hValT.data(), hValTs.data());
+    CHECK_HIP_ERROR(hipMemcpy(
+        (void*)sp->dValT, hValTs.data(), sizeof(float) * nnzT, hipMemcpyHostToDevice));
+
+    // set up P = Q
+    CHECK_HIP_ERROR(
+        hipMemcpy((void*)sp->dQ, c_L->Perm, sizeof(rocblas_int) * n, hipMemcpyHostToDevice));
+
+    // set up B
+    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(float) * n, hipMemcpyDeviceToDevice));
+
+    // solve for x with L and D*L' as the factors of an LU factorization
+    CHECK_ROCBLAS_ERROR(rocsolver_set_rfinfo_mode(sp->rfinfo, rocsolver_rfinfo_mode_lu));
+    CHECK_ROCBLAS_ERROR(rocsolver_scsrrf_analysis(sp->handle,
+                                                  n,
+                                                  1,
+                                                  nnzA,
+                                                  dPtrA,
+                                                  dIndA,
+                                                  (float*)csrVal,
+                                                  nnzT,
+                                                  sp->dPtrT,
+                                                  sp->dIndT,
+                                                  (float*)sp->dValT,
+                                                  sp->dQ,
+                                                  sp->dQ,
+                                                  x,
+                                                  n,
+                                                  sp->rfinfo));
+    CHECK_ROCBLAS_ERROR(rocsolver_scsrrf_solve(sp->handle,
+                                               n,
+                                               1,
+                                               nnzT,
+                                               sp->dPtrT,
+                                               sp->dIndT,
+                                               (float*)sp->dValT,
+                                               sp->dQ,
+                                               sp->dQ,
+                                               x,
+                                               n,
+                                               sp->rfinfo));
+
+    // free resources
+    cholmod_free_sparse(&c_A, &sp->c_handle);
+    cholmod_free_factor(&c_L, &sp->c_handle);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrlsvldl(hipsolverSpHandle_t       handle,
+                                        int                       n,
+                                        int                       nnzA,
+                                        const hipsparseMatDescr_t descrA,
+                                        const double*             csrVal,
+                                        const int*                csrRowPtr,
+                                        const int*                csrColInd,
+                                        const double*             b,
+                                        double                    tolerance,
+                                        int                       reorder,
+                                        double                    perturb,
+                                        double*                   x,
+                                        int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(reorder < 0 || reorder > 3 || perturb < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    *singularity = -1;
+
+    // set up A (host)
+    cholmod_sparse* c_A
+        = cholmod_allocate_sparse(n, n, nnzA, true, true, 1, CHOLMOD_REAL, &sp->c_handle);
+    CHECK_HIP_ERROR(
+        hipMemcpy(c_A->x, csrVal, sizeof(double) * nnzA, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(c_A->p, csrRowPtr, sizeof(rocblas_int) * (n + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(c_A->i, csrColInd, sizeof(rocblas_int) * nnzA, hipMemcpyDeviceToHost));
+    sp->prep_input(indbase, n, nnzA, (int*)c_A->p, (int*)c_A->i, (double*)c_A->x, nullptr);
+
+    if(tolerance > 0)
+        cholmod_drop(tolerance, c_A, &sp->c_handle);
+
+    // factorize A (host)
+    cholmod_factor*   c_L;
+    hipsolverStatus_t status = sp->ldl_factorize(c_A, reorder, perturb, &c_L, singularity);
+    if(status != HIPSOLVER_STATUS_SUCCESS || *singularity >= 0)
+    {
+        cholmod_free_sparse(&c_A, &sp->c_handle);
+        return status;
+    }
+
+    // the bundled factors must be representable with 32-bit indices
+    if(2 * sp->c_handle.lnz - n > INT_MAX)
+    {
+        cholmod_free_sparse(&c_A, &sp->c_handle);
+        cholmod_free_factor(&c_L, &sp->c_handle);
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+
+    std::vector<int>    hPtrT, hIndT;
+    std::vector<double> hValT;
+    sp->ldl_bundle(c_L, hPtrT, hIndT, hValT);
+    int nnzT = hIndT.size();
+
+    // set up A (device)
+    int *dPtrA, *dIndA;
+    if(indbase == rocsparse_index_base_zero)
+    {
+        // if indices are base zero, can use input arrays
+        CHECK_HIPSOLVER_ERROR(sp->malloc_device(n, 0, nnzT));
+        dPtrA = (int*)csrRowPtr;
+        dIndA = (int*)csrColInd;
+    }
+    else
+    {
+        // if indices are base one, need to use temp arrays and load base zero indices
+        CHECK_HIPSOLVER_ERROR(sp->malloc_device(n, nnzA, nnzT));
+        dPtrA = sp->dPtrA;
+        dIndA = sp->dIndA;
+        CHECK_HIP_ERROR(hipMemcpy(
+            (void*)sp->dPtrA, c_A->p, sizeof(rocblas_int) * (n + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy((void*)sp->dIndA, c_A->i, sizeof(rocblas_int) * nnzA, hipMemcpyHostToDevice));
+    }
+
+    // set up T
+    CHECK_HIP_ERROR(hipMemcpy(
+        (void*)sp->dPtrT, hPtrT.data(), sizeof(rocblas_int) * (n + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        (void*)sp->dIndT, hIndT.data(), sizeof(rocblas_int) * nnzT, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        (void*)sp->dValT, hValT.data(), sizeof(double) * nnzT, hipMemcpyHostToDevice));
+
+    // set up P = Q
+    CHECK_HIP_ERROR(
+        hipMemcpy((void*)sp->dQ, c_L->Perm, sizeof(rocblas_int) * n, hipMemcpyHostToDevice));
+
+    // set up B
+    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(double) * n, hipMemcpyDeviceToDevice));
+
+    // solve for x with L and D*L' as the factors of an LU factorization
+    CHECK_ROCBLAS_ERROR(rocsolver_set_rfinfo_mode(sp->rfinfo, rocsolver_rfinfo_mode_lu));
+    CHECK_ROCBLAS_ERROR(rocsolver_dcsrrf_analysis(sp->handle,
+                                                  n,
+                                                  1,
+                                                  nnzA,
+                                                  dPtrA,
+                                                  dIndA,
+                                                  (double*)csrVal,
+                                                  nnzT,
+                                                  sp->dPtrT,
+                                                  sp->dIndT,
+                                                  (double*)sp->dValT,
+                                                  sp->dQ,
+                                                  sp->dQ,
+                                                  x,
+                                                  n,
+                                                  sp->rfinfo));
+    CHECK_ROCBLAS_ERROR(rocsolver_dcsrrf_solve(sp->handle,
+                                               n,
+                                               1,
+                                               nnzT,
+                                               sp->dPtrT,
+                                               sp->dIndT,
+                                               (double*)sp->dValT,
+                                               sp->dQ,
+                                               sp->dQ,
+                                               x,
+                                               n,
+                                               sp->rfinfo));
+
+    // free resources
+    cholmod_free_sparse(&c_A, &sp->c_handle);
+    cholmod_free_factor(&c_L, &sp->c_handle);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpScsrlsvldlHost(hipsolverSpHandle_t       handle,
+                                            int                       n,
+                                            int                       nnzA,
+                                            const hipsparseMatDescr_t descrA,
+                                            const float*              csrVal,
+                                            const int*                csrRowPtr,
+                                            const int*                csrColInd,
+                                            const float*              b,
+                                            float                     tolerance,
+                                            int                       reorder,
+                                            float                     perturb,
+                                            float*                    x,
+                                            int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(reorder < 0 || reorder > 3 || perturb < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    *singularity          = -1;
+
+    // set up A (view of the input arrays; a copy is only needed if entries are dropped)
+    std::vector<int>    tPtr, tInd;
+    std::vector<double> tVal;
+    cholmod_sparse      v_A;
+    sp->view_sparse(&v_A,
+                    n,
+                    nnzA,
+                    sp->view_index(indbase, n + 1, csrRowPtr, tPtr),
+                    sp->view_index(indbase, nnzA, csrColInd, tInd),
+                    sp->view_values(nnzA, csrVal, tVal),
+                    CHOLMOD_INT);
+
+    cholmod_sparse* c_A = &v_A;
+    if(tolerance > 0)
+    {
+        c_A = cholmod_copy_sparse(&v_A, &sp->c_handle);
+        cholmod_drop(tolerance, c_A, &sp->c_handle);
+    }
+
+    // factorize A
+    cholmod_factor*   c_L;
+    hipsolverStatus_t status = sp->ldl_factorize(c_A, reorder, perturb, &c_L, singularity);
+    if(status != HIPSOLVER_STATUS_SUCCESS || *singularity >= 0)
+    {
+        sp->free_input(&c_A, &v_A);
+        return status;
+    }
+
+    // set up B
+    cholmod_dense* c_b = cholmod_allocate_dense(n, 1, n, CHOLMOD_REAL, &sp->c_handle);
+    sp->prep_input(n, (double*)c_b->x, (float*)b);
+
+    // solve for x
+    cholmod_dense* c_x = cholmod_solve(CHOLMOD_A, c_L, c_b, &sp->c_handle);
+
+    // copy back results
+    sp->prep_output(n, (double*)c_x->x, (float*)x);
+
+    // free resources
+    sp->free_input(&c_A, &v_A);
+    cholmod_free_factor(&c_L, &sp->c_handle);
+    cholmod_free_dense(&c_b, &sp->c_handle);
+    cholmod_free_dense(&c_x, &sp->c_handle);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrlsvldlHost(hipsolverSpHandle_t       handle,
+                                            int                       n,
+                                            int                       nnzA,
+                                            const hipsparseMatDescr_t descrA,
+                                            const double*             csrVal,
+                                            const int*                csrRowPtr,
+                                            const int*                csrColInd,
+                                            const double*             b,
+                                            double                    tolerance,
+                                            int                       reorder,
+                                            double                    perturb,
+                                            double*                   x,
+                                            int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(reorder < 0 || reorder > 3 || perturb < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    *singularity          = -1;
+
+    // set up A (view of the input arrays; a copy is only needed if entries are dropped)
+    std::vector<int>    tPtr, tInd;
+    std::vector<double> tVal;
+    cholmod_sparse      v_A;
+    sp->view_sparse(&v_A,
+                    n,
+                    nnzA,
+                    sp->view_index(indbase, n + 1, csrRowPtr, tPtr),
+                    sp->view_index(indbase, nnzA, csrColInd, tInd),
+                    sp->view_values(nnzA, csrVal, tVal),
+                    CHOLMOD_INT);
+
+    cholmod_sparse* c_A = &v_A;
+    if(tolerance > 0)
+    {
+        c_A = cholmod_copy_sparse(&v_A, &sp->c_handle);
+        cholmod_drop(tolerance, c_A, &sp->c_handle);
+    }
+
+    // factorize A
+    cholmod_factor*   c_L;
+    hipsolverStatus_t status = sp->ldl_factorize(c_A, reorder, perturb, &c_L, singularity);
+    if(status != HIPSOLVER_STATUS_SUCCESS || *singularity >= 0)
+    {
+        sp->free_input(&c_A, &v_A);
+        return status;
+    }
+
+    // set up B
+    cholmod_dense* c_b = cholmod_allocate_dense(n, 1, n, CHOLMOD_REAL, &sp->c_handle);
+    memcpy(c_b->x, b, sizeof(double) * n);
+
+    // solve for x
+    cholmod_dense* c_x = cholmod_solve(CHOLMOD_A, c_L, c_b, &sp->c_handle);
+
+    // copy back results
+    memcpy(x, c_x->x, sizeof(double) * n);
+
+    // free resources
+    sp->free_input(&c_A, &v_A);
+    cholmod_free_factor(&c_L, &sp->c_handle);
+    cholmod_free_dense(&c_b, &sp->c_handle);
+    cholmod_free_dense(&c_x, &sp->c_handle);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** CSRLSVQR ********************/
+hipsolverStatus_t hipsolverSpScsrlsvqr(hipsolverSpHandle_t       handle,
+                                       int                       n,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descrA,
+                                       const float*              csrVal,
+                                       const int*                csrRowPtr,
+                                       const int*                csrColInd,
+                                       const float*              b,
+                                       double                    tolerance,
+                                       int                       reorder,
+                                       float*                    x,
+                                       int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnz < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    // if(reorder < 0 || reorder > 3)
+    //     return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    *singularity = -1;
+
+    // set up B
+    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(float) * n, hipMemcpyDeviceToDevice));
+
+    // convert A to dense matrix; the n-by-n copy is not charged to any memory budget
+    float* denseA;
+    CHECK_HIP_ERROR(hipMalloc(&denseA, sizeof(float) * n * n));
+    rocsparse_scsr2dense(
+        sp->sphandle, n, n, (rocsparse_mat_descr)descrA, csrVal, csrRowPtr, csrColInd, denseA, n);
+
+    int* info;
+    CHECK_HIP_ERROR(hipMalloc(&info, sizeof(int)));
+
+    rocblas_status st
+        = rocsolver_sgels(sp->handle, rocblas_operation_none, n, n, 1, denseA, n, x, n, info);
+
+    // finalize singularity
+    CHECK_HIP_ERROR(hipMemcpy((void*)singularity, info, sizeof(int), hipMemcpyDeviceToHost));
+    *singularity = *singularity - 1;
+
+    CHECK_HIP_ERROR(hipFree(denseA));
+    CHECK_HIP_ERROR(hipFree(info));
+
+    return hipsolver::rocblas2hip_status(st);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrlsvqr(hipsolverSpHandle_t       handle,
+                                       int                       n,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descrA,
+                                       const double*             csrVal,
+                                       const int*                csrRowPtr,
+                                       const int*                csrColInd,
+                                       const double*             b,
+                                       double                    tolerance,
+                                       int                       reorder,
+                                       double*                   x,
+                                       int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnz < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !singularity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    // if(reorder < 0 || reorder > 3)
+    //     return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    *singularity = -1;
+
+    // set up B
+    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(double) * n, hipMemcpyDeviceToDevice));
+
+    // convert A to dense matrix; the n-by-n copy is not charged to any memory budget
+    double* denseA;
+    CHECK_HIP_ERROR(hipMalloc(&denseA, sizeof(double) * n * n));
+    rocsparse_dcsr2dense(
+        sp->sphandle, n, n, (rocsparse_mat_descr)descrA, csrVal, csrRowPtr, csrColInd, denseA, n);
+
+    int* info;
+    CHECK_HIP_ERROR(hipMalloc(&info, sizeof(int)));
+
+    rocblas_status st
+        = rocsolver_dgels(sp->handle, rocblas_operation_none, n, n, 1, denseA, n, x, n, info);
+
+    // finalize singularity
+    CHECK_HIP_ERROR(hipMemcpy((void*)singularity, info, sizeof(int), hipMemcpyDeviceToHost));
+    *singularity = *singularity - 1;
 
-    // free resources
-    cholmod_free_sparse(&c_A, &sp->c_handle);
-    cholmod_free_factor(&c_L, &sp->c_handle);
+    CHECK_HIP_ERROR(hipFree(denseA));
+    CHECK_HIP_ERROR(hipFree(info));
 
-    return HIPSOLVER_STATUS_SUCCESS;
+    return hipsolver::rocblas2hip_status(st);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpDcsrlsvchol(hipsolverSpHandle_t       handle,
-                                         int                       n,
-                                         int                       nnzA,
-                                         const hipsparseMatDescr_t descrA,
-                                         const double*             csrVal,
-                                         const int*                csrRowPtr,
-                                         const int*                csrColInd,
-                                         const double*             b,
-                                         double                    tolerance,
-                                         int                       reorder,
-                                         double*                   x,
-                                         int*                      singularity)
+/*hipsolverStatus_t hipsolverSpCcsrlsvqr(hipsolverSpHandle_t       handle,
+                                       int                       n,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descrA,
+                                       const hipFloatComplex*    csrVal,
+                                       const int*                csrRowPtr,
+                                       const int*                csrColInd,
+                                       const hipFloatComplex*    b,
+                                       double                    tolerance,
+                                       int                       reorder,
+                                       hipFloatComplex*          x,
+                                       int*                      singularity)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(n < 0 || nnzA < 0)
+    if(n < 0 || nnz < 0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
     if(!descrA)
         return HIPSOLVER_STATUS_INVALID_VALUE;
@@ -631,9 +3698,7 @@ try
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
     rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
-    // rocsparse_fill_mode fillmode = rocsparse_get_mat_fill_mode((rocsparse_mat_descr)descrA);
-    // rocsparse_diag_type diagtype = rocsparse_get_mat_diag_type((rocsparse_mat_descr)descrA);
-    rocsparse_index_base indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
     if(mattype != rocsparse_matrix_type_general)
         return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
     if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
@@ -642,212 +3707,67 @@ try
     hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
     *singularity          = -1;
 
-    sp->c_handle.nmethods  = 1; // use 1 reordering method
-    sp->c_handle.postorder = false; // no postordering
-    sp->c_handle.final_ll  = true; // factorize as LL' not LDL'
-    int ordering;
-    switch(reorder)
-    {
-    case 1:
-    case 2:
-        ordering = CHOLMOD_AMD;
-        break;
-    case 3:
-        ordering = CHOLMOD_METIS;
-        break;
-    default:
-        ordering = CHOLMOD_NATURAL;
-    }
-    sp->c_handle.method[0].ordering = ordering;
-
-    // set up A
-    cholmod_sparse* c_A
-        = cholmod_allocate_sparse(n, n, nnzA, true, true, 1, CHOLMOD_PATTERN, &sp->c_handle);
-    CHECK_HIP_ERROR(
-        hipMemcpy(c_A->p, csrRowPtr, sizeof(rocblas_int) * (n + 1), hipMemcpyDeviceToHost));
-    CHECK_HIP_ERROR(
-        hipMemcpy(c_A->i, csrColInd, sizeof(rocblas_int) * nnzA, hipMemcpyDeviceToHost));
-    sp->prep_input(indbase, n, nnzA, (int*)c_A->p, (int*)c_A->i, nullptr, nullptr);
-
-    if(tolerance > 0)
-        cholmod_drop(tolerance, c_A, &sp->c_handle);
-
-    // factorize A (symbolic)
-    cholmod_factor* c_L = cholmod_analyze(c_A, &sp->c_handle);
-
-    CHECK_HIPSOLVER_ERROR(sp->malloc_host(n));
-    int status = cholmod_analyze_ordering(c_A,
-                                          ordering,
-                                          (int*)c_L->Perm,
-                                          nullptr,
-                                          0,
-                                          sp->hParent,
-                                          sp->hWork1,
-                                          nullptr,
-                                          sp->hWork2,
-                                          sp->hWork3,
-                                          &sp->c_handle);
-
-    std::vector<int> hIndA;
-    sp->gen_sparsity_pattern(n,
-                             (int*)c_A->p,
-                             (int*)c_A->i,
-                             (int*)c_L->Perm,
-                             sp->hWork1,
-                             sp->hParent,
-                             sp->hWork2,
-                             sp->hPtrT,
-                             hIndA);
-
-    // set up A
-    int *dPtrA, *dIndA;
-    if(indbase == rocsparse_index_base_zero)
-    {
-        // if indices are base zero, can use input arrays
-        CHECK_HIPSOLVER_ERROR(sp->malloc_device(n, 0, hIndA.size()));
-        dPtrA = (int*)csrRowPtr;
-        dIndA = (int*)csrColInd;
-    }
-    else
-    {
-        // if indices are base one, need to use temp arrays and load base zero indices
-        CHECK_HIPSOLVER_ERROR(sp->malloc_device(n, nnzA, hIndA.size()));
-        dPtrA = sp->dPtrA;
-        dIndA = sp->dIndA;
-        CHECK_HIP_ERROR(hipMemcpy(
-            (void*)sp->dPtrA, c_A->p, sizeof(rocblas_int) * (n + 1), hipMemcpyHostToDevice));
-        CHECK_HIP_ERROR(
-            hipMemcpy((void*)sp->dIndA, c_A->i, sizeof(rocblas_int) * nnzA, hipMemcpyHostToDevice));
-    }
-
-    // set up T
-    CHECK_HIP_ERROR(hipMemcpy(
-        (void*)sp->dPtrT, sp->hPtrT, sizeof(rocblas_int) * (n + 1), hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(
-        (void*)sp->dIndT, hIndA.data(), sizeof(rocblas_int) * hIndA.size(), hipMemcpyHostToDevice));
-
-    // set up Q
-    CHECK_HIP_ERROR(
-        hipMemcpy((void*)sp->dQ, c_L->Perm, sizeof(rocblas_int) * n, hipMemcpyHostToDevice));
-
     // set up B
-    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(double) * n, hipMemcpyDeviceToDevice));
-
-    // factorize A (numeric)
-    CHECK_ROCBLAS_ERROR(rocsolver_set_rfinfo_mode(sp->rfinfo, rocsolver_rfinfo_mode_cholesky));
-    CHECK_ROCBLAS_ERROR(rocsolver_dcsrrf_analysis(sp->handle,
-                                                  n,
-                                                  1,
-                                                  nnzA,
-                                                  dPtrA,
-                                                  dIndA,
-                                                  (double*)csrVal,
-                                                  hIndA.size(),
-                                                  sp->dPtrT,
-                                                  sp->dIndT,
-                                                  sp->dValT,
-                                                  nullptr,
-                                                  sp->dQ,
-                                                  x,
-                                                  n,
-                                                  sp->rfinfo));
-    CHECK_ROCBLAS_ERROR(rocsolver_dcsrrf_refactchol(sp->handle,
-                                                    n,
-                                                    nnzA,
-                                                    dPtrA,
-                                                    dIndA,
-                                                    (double*)csrVal,
-                                                    hIndA.size(),
-                                                    sp->dPtrT,
-                                                    sp->dIndT,
-                                                    sp->dValT,
-                                                    sp->dQ,
-                                                    sp->rfinfo));
-
-    // solve for x
-    CHECK_ROCBLAS_ERROR(rocsolver_dcsrrf_solve(sp->handle,
-                                               n,
-                                               1,
-                                               hIndA.size(),
-                                               sp->dPtrT,
-                                               sp->dIndT,
-                                               sp->dValT,
-                                               nullptr,
-                                               sp->dQ,
-                                               x,
-                                               n,
-                                               sp->rfinfo));
+    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(hipFloatComplex) * n, hipMemcpyDeviceToDevice));
 
-    // free resources
-    cholmod_free_sparse(&c_A, &sp->c_handle);
-    cholmod_free_factor(&c_L, &sp->c_handle);
+    // convert A to dense matrix; the n-by-n copy is not charged to any memory budget
+    hipFloatComplex* denseA;
+    CHECK_HIP_ERROR(hipMalloc(&denseA, sizeof(hipFloatComplex) * n * n));
+    rocsparse_ccsr2dense(sp->sphandle,
+                         n,
+                         n,
+                         (rocsparse_mat_descr)descrA,
+                         (rocsparse_float_complex*)csrVal,
+                         csrRowPtr,
+                         csrColInd,
+                         (rocsparse_float_complex*)denseA,
+                         n);
 
-    return HIPSOLVER_STATUS_SUCCESS;
-}
-catch(...)
-{
-    return hipsolver::exception2hip_status();
-}
+    int* info;
+    CHECK_HIP_ERROR(hipMalloc(&info, sizeof(int)));
 
-/*hipsolverStatus_t hipsolverSpCcsrlsvchol(hipsolverSpHandle_t       handle,
-                                         int                       n,
-                                         int                       nnzA,
-                                         const hipsparseMatDescr_t descrA,
-                                         const hipFloatComplex*    csrVal,
-                                         const int*                csrRowPtr,
-                                         const int*                csrColInd,
-                                         const hipFloatComplex*    b,
-                                         float                     tolerance,
-                                         int                       reorder,
-                                         hipFloatComplex*          x,
-                                         int*                      singularity)
-try
-{
-    return HIPSOLVER_STATUS_NOT_SUPPORTED;
-}
-catch(...)
-{
-    return hipsolver::exception2hip_status();
-}
+    rocblas_status st = rocsolver_cgels(sp->handle,
+                                        rocblas_operation_none,
+                                        n,
+                                        n,
+                                        1,
+                                        (rocblas_float_complex*)denseA,
+                                        n,
+                                        (rocblas_float_complex*)x,
+                                        n,
+                                        info);
 
-hipsolverStatus_t hipsolverSpZcsrlsvchol(hipsolverSpHandle_t       handle,
-                                         int                       n,
-                                         int                       nnzA,
-                                         const hipsparseMatDescr_t descrA,
-                                         const hipDoubleComplex*   csrVal,
-                                         const int*                csrRowPtr,
-                                         const int*                csrColInd,
-                                         const hipDoubleComplex*   b,
-                                         double                    tolerance,
-                                         int                       reorder,
-                                         hipDoubleComplex*         x,
-                                         int*                      singularity)
-try
-{
-    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    // finalize singularity
+    CHECK_HIP_ERROR(hipMemcpy((void*)singularity, info, sizeof(int), hipMemcpyDeviceToHost));
+    *singularity = *singularity - 1;
+
+    CHECK_HIP_ERROR(hipFree(denseA));
+    CHECK_HIP_ERROR(hipFree(info));
+
+    return hipsolver::rocblas2hip_status(st);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
-}*/
+}
 
-hipsolverStatus_t hipsolverSpScsrlsvcholHost(hipsolverSpHandle_t       handle,
-                                             int                       n,
-                                             int                       nnzA,
-                                             const hipsparseMatDescr_t descrA,
-                                             const float*              csrVal,
-                                             const int*                csrRowPtr,
-                                             const int*                csrColInd,
-                                             const float*              b,
-                                             float                     tolerance,
-                                             int                       reorder,
-                                             float*                    x,
-                                             int*                      singularity)
+hipsolverStatus_t hipsolverSpZcsrlsvqr(hipsolverSpHandle_t       handle,
+                                       int                       n,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descrA,
+                                       const hipDoubleComplex*   csrVal,
+                                       const int*                csrRowPtr,
+                                       const int*                csrColInd,
+                                       const hipDoubleComplex*   b,
+                                       double                    tolerance,
+                                       int                       reorder,
+                                       hipDoubleComplex*         x,
+                                       int*                      singularity)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(n < 0 || nnzA < 0)
+    if(n < 0 || nnz < 0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
     if(!descrA)
         return HIPSOLVER_STATUS_INVALID_VALUE;
@@ -859,183 +3779,273 @@ try
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
     rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
-    // rocsparse_fill_mode fillmode = rocsparse_get_mat_fill_mode((rocsparse_mat_descr)descrA);
-    // rocsparse_diag_type diagtype = rocsparse_get_mat_diag_type((rocsparse_mat_descr)descrA);
-    rocsparse_index_base indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
     if(mattype != rocsparse_matrix_type_general)
         return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
     if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
         return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
 
     hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
-    *singularity          = -1;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    *singularity = -1;
 
-    sp->c_handle.nmethods  = 1; // use 1 reordering method
-    sp->c_handle.postorder = false; // no postordering
-    sp->c_handle.final_ll  = true; // factorize as LL' not LDL'
-    switch(reorder)
-    {
-    case 1:
-    case 2:
-        sp->c_handle.method[0].ordering = CHOLMOD_AMD;
-        break;
-    case 3:
-        sp->c_handle.method[0].ordering = CHOLMOD_METIS;
-        break;
-    default:
-        sp->c_handle.method[0].ordering = CHOLMOD_NATURAL;
-    }
+    // set up B
+    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(hipDoubleComplex) * n, hipMemcpyDeviceToDevice));
 
-    // set up A
-    float*          sngVal = (float*)malloc(sizeof(float) * nnzA);
-    cholmod_sparse* c_A
-        = cholmod_allocate_sparse(n, n, nnzA, true, true, 1, CHOLMOD_REAL, &sp->c_handle);
-    memcpy(c_A->p, csrRowPtr, sizeof(rocblas_int) * (n + 1));
-    memcpy(c_A->i, csrColInd, sizeof(rocblas_int) * nnzA);
-    sp->prep_input(indbase, n, nnzA, (int*)c_A->p, (int*)c_A->i, (double*)c_A->x, (float*)csrVal);
-    free(sngVal);
+    // convert A to dense matrix; the n-by-n copy is not charged to any memory budget
+    hipFloatComplex* denseA;
+    CHECK_HIP_ERROR(hipMalloc(&denseA, sizeof(hipDoubleComplex) * n * n));
+    rocsparse_zcsr2dense(sp->sphandle,
+                         n,
+                         n,
+                         (rocsparse_mat_descr)descrA,
+                         (rocsparse_double_complex*)csrVal,
+                         csrRowPtr,
+                         csrColInd,
+                         (rocsparse_double_complex*)denseA,
+                         n);
 
-    if(tolerance > 0)
-        cholmod_drop(tolerance, c_A, &sp->c_handle);
+    int* info;
+    CHECK_HIP_ERROR(hipMalloc(&info, sizeof(int)));
 
-    // factorize A
-    cholmod_factor* c_L    = cholmod_analyze(c_A, &sp->c_handle);
-    int             status = cholmod_factorize(c_A, c_L, &sp->c_handle);
-    if(status != TRUE)
-    {
-        cholmod_free_sparse(&c_A, &sp->c_handle);
-        cholmod_free_factor(&c_L, &sp->c_handle);
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
-    }
-    if(sp->c_handle.status == CHOLMOD_NOT_POSDEF)
-    {
-        *singularity = c_L->minor;
-        cholmod_free_sparse(&c_A, &sp->c_handle);
-        cholmod_free_factor(&c_L, &sp->c_handle);
-        return HIPSOLVER_STATUS_SUCCESS;
-    }
+    rocblas_status st = rocsolver_zgels(sp->handle,
+                                        rocblas_operation_none,
+                                        n,
+                                        n,
+                                        1,
+                                        (rocblas_double_complex*)denseA,
+                                        n,
+                                        (rocblas_double_complex*)x,
+                                        n,
+                                        info);
 
-    // set up B
-    cholmod_dense* c_b = cholmod_allocate_dense(n, 1, n, CHOLMOD_REAL, &sp->c_handle);
-    sp->prep_input(n, (double*)c_b->x, (float*)b);
+    // finalize singularity
+    CHECK_HIP_ERROR(hipMemcpy((void*)singularity, info, sizeof(int), hipMemcpyDeviceToHost));
+    *singularity = *singularity - 1;
 
-    // solve for x
-    cholmod_dense* c_x = cholmod_solve(CHOLMOD_A, c_L, c_b, &sp->c_handle);
+    CHECK_HIP_ERROR(hipFree(denseA));
+    CHECK_HIP_ERROR(hipFree(info));
 
-    // copy back results
-    sp->prep_output(n, (double*)c_x->x, (float*)x);
+    return hipsolver::rocblas2hip_status(st);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}*/
 
-    // free resources
-    cholmod_free_sparse(&c_A, &sp->c_handle);
-    cholmod_free_factor(&c_L, &sp->c_handle);
-    cholmod_free_dense(&c_b, &sp->c_handle);
-    cholmod_free_dense(&c_x, &sp->c_handle);
+/******************** CSRPCG ********************/
+hipsolverStatus_t hipsolverSpScsrpcg(hipsolverSpHandle_t       handle,
+                                     int                       n,
+                                     int                       nnzA,
+                                     const hipsparseMatDescr_t descrA,
+                                     const float*              csrVal,
+                                     const int*                csrRowPtr,
+                                     const int*                csrColInd,
+                                     const float*              b,
+                                     float                     tolerance,
+                                     int                       maxiter,
+                                     hipsolverSpPrecond_t      precond,
+                                     int                       reusePrecond,
+                                     float*                    x,
+                                     int*                      niters,
+                                     float*                    resHistory)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0 || maxiter < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!(tolerance >= 0))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !niters)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(precond != HIPSOLVER_SP_PRECOND_NONE && precond != HIPSOLVER_SP_PRECOND_IC0
+       && precond != HIPSOLVER_SP_PRECOND_ILU0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return HIPSOLVER_STATUS_SUCCESS;
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    *niters = 0;
+
+    // quick return
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    CHECK_HIPSOLVER_ERROR(sp->krylov_begin(false,
+                                           true,
+                                           precond,
+                                           reusePrecond,
+                                           n,
+                                           nnzA,
+                                           (rocsparse_mat_descr)descrA,
+                                           csrVal,
+                                           csrRowPtr,
+                                           csrColInd,
+                                           4));
+
+    return sp->krylov_pcg(b, tolerance, maxiter, x, niters, resHistory);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpDcsrlsvcholHost(hipsolverSpHandle_t       handle,
-                                             int                       n,
-                                             int                       nnzA,
-                                             const hipsparseMatDescr_t descrA,
-                                             const double*             csrVal,
-                                             const int*                csrRowPtr,
-                                             const int*                csrColInd,
-                                             const double*             b,
-                                             double                    tolerance,
-                                             int                       reorder,
-                                             double*                   x,
-                                             int*                      singularity)
+hipsolverStatus_t hipsolverSpDcsrpcg(hipsolverSpHandle_t       handle,
+                                     int                       n,
+                                     int                       nnzA,
+                                     const hipsparseMatDescr_t descrA,
+                                     const double*             csrVal,
+                                     const int*                csrRowPtr,
+                                     const int*                csrColInd,
+                                     const double*             b,
+                                     double                    tolerance,
+                                     int                       maxiter,
+                                     hipsolverSpPrecond_t      precond,
+                                     int                       reusePrecond,
+                                     double*                   x,
+                                     int*                      niters,
+                                     double*                   resHistory)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(n < 0 || nnzA < 0)
+    if(n < 0 || nnzA < 0 || maxiter < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!(tolerance >= 0))
         return HIPSOLVER_STATUS_INVALID_VALUE;
     if(!descrA)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+    if(!csrRowPtr || !csrColInd || !csrVal)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!b || !x || !singularity)
+    if(!b || !x || !niters)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(reorder < 0 || reorder > 3)
+    if(precond != HIPSOLVER_SP_PRECOND_NONE && precond != HIPSOLVER_SP_PRECOND_IC0
+       && precond != HIPSOLVER_SP_PRECOND_ILU0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
     rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
-    // rocsparse_fill_mode fillmode = rocsparse_get_mat_fill_mode((rocsparse_mat_descr)descrA);
-    // rocsparse_diag_type diagtype = rocsparse_get_mat_diag_type((rocsparse_mat_descr)descrA);
-    rocsparse_index_base indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
     if(mattype != rocsparse_matrix_type_general)
         return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
     if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
         return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
 
     hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
-    *singularity          = -1;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    *niters = 0;
 
-    sp->c_handle.nmethods  = 1; // use 1 reordering method
-    sp->c_handle.postorder = false; // no postordering
-    sp->c_handle.final_ll  = true; // factorize as LL' not LDL'
-    switch(reorder)
-    {
-    case 1:
-    case 2:
-        sp->c_handle.method[0].ordering = CHOLMOD_AMD;
-        break;
-    case 3:
-        sp->c_handle.method[0].ordering = CHOLMOD_METIS;
-        break;
-    default:
-        sp->c_handle.method[0].ordering = CHOLMOD_NATURAL;
-    }
+    // quick return
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
 
-    // set up A
-    cholmod_sparse* c_A
-        = cholmod_allocate_sparse(n, n, nnzA, true, true, 1, CHOLMOD_REAL, &sp->c_handle);
-    memcpy(c_A->p, csrRowPtr, sizeof(rocblas_int) * (n + 1));
-    memcpy(c_A->i, csrColInd, sizeof(rocblas_int) * nnzA);
-    memcpy(c_A->x, csrVal, sizeof(double) * nnzA);
-    sp->prep_input(indbase, n, nnzA, (int*)c_A->p, (int*)c_A->i, (double*)c_A->x, nullptr);
+    CHECK_HIPSOLVER_ERROR(sp->krylov_begin(false,
+                                           false,
+                                           precond,
+                                           reusePrecond,
+                                           n,
+                                           nnzA,
+                                           (rocsparse_mat_descr)descrA,
+                                           csrVal,
+                                           csrRowPtr,
+                                           csrColInd,
+                                           4));
+
+    return sp->krylov_pcg(b, tolerance, maxiter, x, niters, resHistory);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
-    if(tolerance > 0)
-        cholmod_drop(tolerance, c_A, &sp->c_handle);
+hipsolverStatus_t hipsolverSpScsrpcgHost(hipsolverSpHandle_t       handle,
+                                         int                       n,
+                                         int                       nnzA,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              csrVal,
+                                         const int*                csrRowPtr,
+                                         const int*                csrColInd,
+                                         const float*              b,
+                                         float                     tolerance,
+                                         int                       maxiter,
+                                         hipsolverSpPrecond_t      precond,
+                                         int                       reusePrecond,
+                                         float*                    x,
+                                         int*                      niters,
+                                         float*                    resHistory)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0 || maxiter < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!(tolerance >= 0))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !niters)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(precond != HIPSOLVER_SP_PRECOND_NONE && precond != HIPSOLVER_SP_PRECOND_IC0
+       && precond != HIPSOLVER_SP_PRECOND_ILU0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    // factorize A
-    cholmod_factor* c_L    = cholmod_analyze(c_A, &sp->c_handle);
-    int             status = cholmod_factorize(c_A, c_L, &sp->c_handle);
-    if(status != TRUE)
-    {
-        cholmod_free_sparse(&c_A, &sp->c_handle);
-        cholmod_free_factor(&c_L, &sp->c_handle);
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
-    }
-    if(sp->c_handle.status == CHOLMOD_NOT_POSDEF)
-    {
-        *singularity = c_L->minor;
-        cholmod_free_sparse(&c_A, &sp->c_handle);
-        cholmod_free_factor(&c_L, &sp->c_handle);
-        return HIPSOLVER_STATUS_SUCCESS;
-    }
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
 
-    // set up B
-    cholmod_dense* c_b = cholmod_allocate_dense(n, 1, n, CHOLMOD_REAL, &sp->c_handle);
-    memcpy(c_b->x, b, sizeof(double) * n);
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    *niters = 0;
 
-    // solve for x
-    cholmod_dense* c_x = cholmod_solve(CHOLMOD_A, c_L, c_b, &sp->c_handle);
+    // quick return
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
 
-    // copy back results
-    memcpy((void*)x, c_x->x, sizeof(double) * n);
+    // set up A, b, and x
+    std::vector<int>    hPtrA(csrRowPtr, csrRowPtr + n + 1);
+    std::vector<int>    hIndA(csrColInd, csrColInd + nnzA);
+    std::vector<double> hValA(nnzA), hB(n), hX(n), hHist(resHistory ? maxiter + 1 : 0);
+    sp->prep_input(indbase, n, nnzA, hPtrA.data(), hIndA.data(), hValA.data(), (float*)csrVal);
+    sp->prep_input(n, hB.data(), (float*)b);
+    sp->prep_input(n, hX.data(), x);
+
+    CHECK_HIPSOLVER_ERROR(sp->krylov_begin(true,
+                                           false,
+                                           precond,
+                                           reusePrecond,
+                                           n,
+                                           nnzA,
+                                           nullptr,
+                                           hValA.data(),
+                                           hPtrA.data(),
+                                           hIndA.data(),
+                                           4));
 
-    // free resources
-    cholmod_free_sparse(&c_A, &sp->c_handle);
-    cholmod_free_factor(&c_L, &sp->c_handle);
-    cholmod_free_dense(&c_b, &sp->c_handle);
-    cholmod_free_dense(&c_x, &sp->c_handle);
+    // solve for x
+    CHECK_HIPSOLVER_ERROR(sp->krylov_pcg(
+        hB.data(), tolerance, maxiter, hX.data(), niters, resHistory ? hHist.data() : nullptr));
+
+    // copy back results
+    sp->prep_output(n, hX.data(), x);
+    if(resHistory)
+        sp->prep_output(std::abs(*niters) + 1, hHist.data(), resHistory);
 
     return HIPSOLVER_STATUS_SUCCESS;
 }
@@ -1044,75 +4054,115 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/*hipsolverStatus_t hipsolverSpCcsrlsvcholHost(hipsolverSpHandle_t       handle,
-                                             int                       n,
-                                             int                       nnzA,
-                                             const hipsparseMatDescr_t descrA,
-                                             const hipFloatComplex*    csrVal,
-                                             const int*                csrRowPtr,
-                                             const int*                csrColInd,
-                                             const hipFloatComplex*    b,
-                                             float                     tolerance,
-                                             int                       reorder,
-                                             hipFloatComplex*          x,
-                                             int*                      singularity)
+hipsolverStatus_t hipsolverSpDcsrpcgHost(hipsolverSpHandle_t       handle,
+                                         int                       n,
+                                         int                       nnzA,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             csrVal,
+                                         const int*                csrRowPtr,
+                                         const int*                csrColInd,
+                                         const double*             b,
+                                         double                    tolerance,
+                                         int                       maxiter,
+                                         hipsolverSpPrecond_t      precond,
+                                         int                       reusePrecond,
+                                         double*                   x,
+                                         int*                      niters,
+                                         double*                   resHistory)
 try
 {
-    return HIPSOLVER_STATUS_NOT_SUPPORTED;
-}
-catch(...)
-{
-    return hipsolver::exception2hip_status();
-}
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nnzA < 0 || maxiter < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!(tolerance >= 0))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!descrA)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!csrRowPtr || !csrColInd || !csrVal)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!b || !x || !niters)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(precond != HIPSOLVER_SP_PRECOND_NONE && precond != HIPSOLVER_SP_PRECOND_IC0
+       && precond != HIPSOLVER_SP_PRECOND_ILU0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-hipsolverStatus_t hipsolverSpZcsrlsvcholHost(hipsolverSpHandle_t       handle,
-                                             int                       n,
-                                             int                       nnzA,
-                                             const hipsparseMatDescr_t descrA,
-                                             const hipDoubleComplex*   csrVal,
-                                             const int*                csrRowPtr,
-                                             const int*                csrColInd,
-                                             const hipDoubleComplex*   b,
-                                             double                    tolerance,
-                                             int                       reorder,
-                                             hipDoubleComplex*         x,
-                                             int*                      singularity)
-try
-{
-    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
+    rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
+    if(mattype != rocsparse_matrix_type_general)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+    if(indbase != rocsparse_index_base_zero && indbase != rocsparse_index_base_one)
+        return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
+
+    hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
+    *niters = 0;
+
+    // quick return
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    // set up A, b, and x
+    std::vector<int>    hPtrA(csrRowPtr, csrRowPtr + n + 1);
+    std::vector<int>    hIndA(csrColInd, csrColInd + nnzA);
+    std::vector<double> hValA(csrVal, csrVal + nnzA);
+    sp->prep_input(indbase, n, nnzA, hPtrA.data(), hIndA.data(), nullptr, nullptr);
+
+    CHECK_HIPSOLVER_ERROR(sp->krylov_begin(true,
+                                           false,
+                                           precond,
+                                           reusePrecond,
+                                           n,
+                                           nnzA,
+                                           nullptr,
+                                           hValA.data(),
+                                           hPtrA.data(),
+                                           hIndA.data(),
+                                           4));
+
+    // solve for x
+    return sp->krylov_pcg(b, tolerance, maxiter, x, niters, resHistory);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
-}*/
+}
 
-/******************** CSRLSVQR ********************/
-hipsolverStatus_t hipsolverSpScsrlsvqr(hipsolverSpHandle_t       handle,
+/******************** CSRGMRES ********************/
+hipsolverStatus_t hipsolverSpScsrgmres(hipsolverSpHandle_t       handle,
                                        int                       n,
-                                       int                       nnz,
+                                       int                       nnzA,
                                        const hipsparseMatDescr_t descrA,
                                        const float*              csrVal,
                                        const int*                csrRowPtr,
                                        const int*                csrColInd,
                                        const float*              b,
-                                       double                    tolerance,
-                                       int                       reorder,
+                                       float                     tolerance,
+                                       int                       maxiter,
+                                       int                       restart,
+                                       hipsolverSpPrecond_t      precond,
+                                       int                       reusePrecond,
                                        float*                    x,
-                                       int*                      singularity)
+                                       int*                      niters,
+                                       float*                    resHistory)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(n < 0 || nnz < 0)
+    if(n < 0 || nnzA < 0 || maxiter < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(restart < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!(tolerance >= 0))
         return HIPSOLVER_STATUS_INVALID_VALUE;
     if(!descrA)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+    if(!csrRowPtr || !csrColInd || !csrVal)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!b || !x || !singularity)
+    if(!b || !x || !niters)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(precond != HIPSOLVER_SP_PRECOND_NONE && precond != HIPSOLVER_SP_PRECOND_IC0
+       && precond != HIPSOLVER_SP_PRECOND_ILU0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    // if(reorder < 0 || reorder > 3)
-    //     return HIPSOLVER_STATUS_INVALID_VALUE;
 
     rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
     rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
@@ -1122,63 +4172,69 @@ try
         return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
 
     hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
-    *singularity          = -1;
-
-    // set up B
-    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(float) * n, hipMemcpyDeviceToDevice));
-
-    // convert A to dense matrix
-    float* denseA;
-    CHECK_HIP_ERROR(hipMalloc(&denseA, sizeof(float) * n * n));
-    rocsparse_scsr2dense(
-        sp->sphandle, n, n, (rocsparse_mat_descr)descrA, csrVal, csrRowPtr, csrColInd, denseA, n);
-
-    int* info;
-    CHECK_HIP_ERROR(hipMalloc(&info, sizeof(int)));
-
-    rocblas_status st
-        = rocsolver_sgels(sp->handle, rocblas_operation_none, n, n, 1, denseA, n, x, n, info);
-
-    // finalize singularity
-    CHECK_HIP_ERROR(hipMemcpy((void*)singularity, info, sizeof(int), hipMemcpyDeviceToHost));
-    *singularity = *singularity - 1;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    *niters = 0;
 
-    CHECK_HIP_ERROR(hipFree(denseA));
-    CHECK_HIP_ERROR(hipFree(info));
+    // quick return
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
 
-    return hipsolver::rocblas2hip_status(st);
+    int m = std::min(restart, n);
+    CHECK_HIPSOLVER_ERROR(sp->krylov_begin(false,
+                                           true,
+                                           precond,
+                                           reusePrecond,
+                                           n,
+                                           nnzA,
+                                           (rocsparse_mat_descr)descrA,
+                                           csrVal,
+                                           csrRowPtr,
+                                           csrColInd,
+                                           m + 2));
+
+    return sp->krylov_gmres(b, tolerance, maxiter, m, x, niters, resHistory);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpDcsrlsvqr(hipsolverSpHandle_t       handle,
+hipsolverStatus_t hipsolverSpDcsrgmres(hipsolverSpHandle_t       handle,
                                        int                       n,
-                                       int                       nnz,
+                                       int                       nnzA,
                                        const hipsparseMatDescr_t descrA,
                                        const double*             csrVal,
                                        const int*                csrRowPtr,
                                        const int*                csrColInd,
                                        const double*             b,
                                        double                    tolerance,
-                                       int                       reorder,
+                                       int                       maxiter,
+                                       int                       restart,
+                                       hipsolverSpPrecond_t      precond,
+                                       int                       reusePrecond,
                                        double*                   x,
-                                       int*                      singularity)
+                                       int*                      niters,
+                                       double*                   resHistory)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(n < 0 || nnz < 0)
+    if(n < 0 || nnzA < 0 || maxiter < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(restart < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!(tolerance >= 0))
         return HIPSOLVER_STATUS_INVALID_VALUE;
     if(!descrA)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+    if(!csrRowPtr || !csrColInd || !csrVal)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!b || !x || !singularity)
+    if(!b || !x || !niters)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(precond != HIPSOLVER_SP_PRECOND_NONE && precond != HIPSOLVER_SP_PRECOND_IC0
+       && precond != HIPSOLVER_SP_PRECOND_ILU0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    // if(reorder < 0 || reorder > 3)
-    //     return HIPSOLVER_STATUS_INVALID_VALUE;
 
     rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
     rocsparse_index_base  indbase = rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA);
@@ -1188,62 +4244,68 @@ try
         return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
 
     hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
-    *singularity          = -1;
-
-    // set up B
-    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(double) * n, hipMemcpyDeviceToDevice));
-
-    // convert A to dense matrix
-    double* denseA;
-    CHECK_HIP_ERROR(hipMalloc(&denseA, sizeof(double) * n * n));
-    rocsparse_dcsr2dense(
-        sp->sphandle, n, n, (rocsparse_mat_descr)descrA, csrVal, csrRowPtr, csrColInd, denseA, n);
-
-    int* info;
-    CHECK_HIP_ERROR(hipMalloc(&info, sizeof(int)));
-
-    rocblas_status st
-        = rocsolver_dgels(sp->handle, rocblas_operation_none, n, n, 1, denseA, n, x, n, info);
-
-    // finalize singularity
-    CHECK_HIP_ERROR(hipMemcpy((void*)singularity, info, sizeof(int), hipMemcpyDeviceToHost));
-    *singularity = *singularity - 1;
+    if(sp->host_only)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    *niters = 0;
 
-    CHECK_HIP_ERROR(hipFree(denseA));
-    CHECK_HIP_ERROR(hipFree(info));
+    // quick return
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
 
-    return hipsolver::rocblas2hip_status(st);
+    int m = std::min(restart, n);
+    CHECK_HIPSOLVER_ERROR(sp->krylov_begin(false,
+                                           false,
+                                           precond,
+                                           reusePrecond,
+                                           n,
+                                           nnzA,
+                                           (rocsparse_mat_descr)descrA,
+                                           csrVal,
+                                           csrRowPtr,
+                                           csrColInd,
+                                           m + 2));
+
+    return sp->krylov_gmres(b, tolerance, maxiter, m, x, niters, resHistory);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/*hipsolverStatus_t hipsolverSpCcsrlsvqr(hipsolverSpHandle_t       handle,
-                                       int                       n,
-                                       int                       nnz,
-                                       const hipsparseMatDescr_t descrA,
-                                       const hipFloatComplex*    csrVal,
-                                       const int*                csrRowPtr,
-                                       const int*                csrColInd,
-                                       const hipFloatComplex*    b,
-                                       double                    tolerance,
-                                       int                       reorder,
-                                       hipFloatComplex*          x,
-                                       int*                      singularity)
+hipsolverStatus_t hipsolverSpScsrgmresHost(hipsolverSpHandle_t       handle,
+                                           int                       n,
+                                           int                       nnzA,
+                                           const hipsparseMatDescr_t descrA,
+                                           const float*              csrVal,
+                                           const int*                csrRowPtr,
+                                           const int*                csrColInd,
+                                           const float*              b,
+                                           float                     tolerance,
+                                           int                       maxiter,
+                                           int                       restart,
+                                           hipsolverSpPrecond_t      precond,
+                                           int                       reusePrecond,
+                                           float*                    x,
+                                           int*                      niters,
+                                           float*                    resHistory)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(n < 0 || nnz < 0)
+    if(n < 0 || nnzA < 0 || maxiter < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(restart < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!(tolerance >= 0))
         return HIPSOLVER_STATUS_INVALID_VALUE;
     if(!descrA)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+    if(!csrRowPtr || !csrColInd || !csrVal)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!b || !x || !singularity)
+    if(!b || !x || !niters)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(reorder < 0 || reorder > 3)
+    if(precond != HIPSOLVER_SP_PRECOND_NONE && precond != HIPSOLVER_SP_PRECOND_IC0
+       && precond != HIPSOLVER_SP_PRECOND_ILU0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
     rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
@@ -1254,77 +4316,83 @@ try
         return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
 
     hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
-    *singularity          = -1;
-
-    // set up B
-    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(hipFloatComplex) * n, hipMemcpyDeviceToDevice));
-
-    // convert A to dense matrix
-    hipFloatComplex* denseA;
-    CHECK_HIP_ERROR(hipMalloc(&denseA, sizeof(hipFloatComplex) * n * n));
-    rocsparse_ccsr2dense(sp->sphandle,
-                         n,
-                         n,
-                         (rocsparse_mat_descr)descrA,
-                         (rocsparse_float_complex*)csrVal,
-                         csrRowPtr,
-                         csrColInd,
-                         (rocsparse_float_complex*)denseA,
-                         n);
+    *niters = 0;
 
-    int* info;
-    CHECK_HIP_ERROR(hipMalloc(&info, sizeof(int)));
+    // quick return
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
 
-    rocblas_status st = rocsolver_cgels(sp->handle,
-                                        rocblas_operation_none,
-                                        n,
-                                        n,
-                                        1,
-                                        (rocblas_float_complex*)denseA,
-                                        n,
-                                        (rocblas_float_complex*)x,
-                                        n,
-                                        info);
+    // set up A, b, and x
+    std::vector<int>    hPtrA(csrRowPtr, csrRowPtr + n + 1);
+    std::vector<int>    hIndA(csrColInd, csrColInd + nnzA);
+    std::vector<double> hValA(nnzA), hB(n), hX(n), hHist(resHistory ? maxiter + 1 : 0);
+    sp->prep_input(indbase, n, nnzA, hPtrA.data(), hIndA.data(), hValA.data(), (float*)csrVal);
+    sp->prep_input(n, hB.data(), (float*)b);
+    sp->prep_input(n, hX.data(), x);
+
+    int m = std::min(restart, n);
+    CHECK_HIPSOLVER_ERROR(sp->krylov_begin(true,
+                                           false,
+                                           precond,
+                                           reusePrecond,
+                                           n,
+                                           nnzA,
+                                           nullptr,
+                                           hValA.data(),
+                                           hPtrA.data(),
+                                           hIndA.data(),
+                                           m + 2));
 
-    // finalize singularity
-    CHECK_HIP_ERROR(hipMemcpy((void*)singularity, info, sizeof(int), hipMemcpyDeviceToHost));
-    *singularity = *singularity - 1;
+    // solve for x
+    CHECK_HIPSOLVER_ERROR(sp->krylov_gmres(
+        hB.data(), tolerance, maxiter, m, hX.data(), niters, resHistory ? hHist.data() : nullptr));
 
-    CHECK_HIP_ERROR(hipFree(denseA));
-    CHECK_HIP_ERROR(hipFree(info));
+    // copy back results
+    sp->prep_output(n, hX.data(), x);
+    if(resHistory)
+        sp->prep_output(std::abs(*niters) + 1, hHist.data(), resHistory);
 
-    return hipsolver::rocblas2hip_status(st);
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpZcsrlsvqr(hipsolverSpHandle_t       handle,
-                                       int                       n,
-                                       int                       nnz,
-                                       const hipsparseMatDescr_t descrA,
-                                       const hipDoubleComplex*   csrVal,
-                                       const int*                csrRowPtr,
-                                       const int*                csrColInd,
-                                       const hipDoubleComplex*   b,
-                                       double                    tolerance,
-                                       int                       reorder,
-                                       hipDoubleComplex*         x,
-                                       int*                      singularity)
+hipsolverStatus_t hipsolverSpDcsrgmresHost(hipsolverSpHandle_t       handle,
+                                           int                       n,
+                                           int                       nnzA,
+                                           const hipsparseMatDescr_t descrA,
+                                           const double*             csrVal,
+                                           const int*                csrRowPtr,
+                                           const int*                csrColInd,
+                                           const double*             b,
+                                           double                    tolerance,
+                                           int                       maxiter,
+                                           int                       restart,
+                                           hipsolverSpPrecond_t      precond,
+                                           int                       reusePrecond,
+                                           double*                   x,
+                                           int*                      niters,
+                                           double*                   resHistory)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(n < 0 || nnz < 0)
+    if(n < 0 || nnzA < 0 || maxiter < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(restart < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!(tolerance >= 0))
         return HIPSOLVER_STATUS_INVALID_VALUE;
     if(!descrA)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!csrRowPtr || !csrColInd || !csrVal || !descrA)
+    if(!csrRowPtr || !csrColInd || !csrVal)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(!b || !x || !singularity)
+    if(!b || !x || !niters)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(reorder < 0 || reorder > 3)
+    if(precond != HIPSOLVER_SP_PRECOND_NONE && precond != HIPSOLVER_SP_PRECOND_IC0
+       && precond != HIPSOLVER_SP_PRECOND_ILU0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
     rocsparse_matrix_type mattype = rocsparse_get_mat_type((rocsparse_mat_descr)descrA);
@@ -1335,50 +4403,37 @@ try
         return HIPSOLVER_STATUS_MATRIX_TYPE_NOT_SUPPORTED;
 
     hipsolverSpHandle* sp = (hipsolverSpHandle*)handle;
-    *singularity          = -1;
-
-    // set up B
-    CHECK_HIP_ERROR(hipMemcpy((void*)x, b, sizeof(hipDoubleComplex) * n, hipMemcpyDeviceToDevice));
-
-    // convert A to dense matrix
-    hipFloatComplex* denseA;
-    CHECK_HIP_ERROR(hipMalloc(&denseA, sizeof(hipDoubleComplex) * n * n));
-    rocsparse_zcsr2dense(sp->sphandle,
-                         n,
-                         n,
-                         (rocsparse_mat_descr)descrA,
-                         (rocsparse_double_complex*)csrVal,
-                         csrRowPtr,
-                         csrColInd,
-                         (rocsparse_double_complex*)denseA,
-                         n);
-
-    int* info;
-    CHECK_HIP_ERROR(hipMalloc(&info, sizeof(int)));
-
-    rocblas_status st = rocsolver_zgels(sp->handle,
-                                        rocblas_operation_none,
-                                        n,
-                                        n,
-                                        1,
-                                        (rocblas_double_complex*)denseA,
-                                        n,
-                                        (rocblas_double_complex*)x,
-                                        n,
-                                        info);
+    *niters = 0;
 
-    // finalize singularity
-    CHECK_HIP_ERROR(hipMemcpy((void*)singularity, info, sizeof(int), hipMemcpyDeviceToHost));
-    *singularity = *singularity - 1;
+    // quick return
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
 
-    CHECK_HIP_ERROR(hipFree(denseA));
-    CHECK_HIP_ERROR(hipFree(info));
+    // set up A, b, and x
+    std::vector<int>    hPtrA(csrRowPtr, csrRowPtr + n + 1);
+    std::vector<int>    hIndA(csrColInd, csrColInd + nnzA);
+    std::vector<double> hValA(csrVal, csrVal + nnzA);
+    sp->prep_input(indbase, n, nnzA, hPtrA.data(), hIndA.data(), nullptr, nullptr);
+
+    int m = std::min(restart, n);
+    CHECK_HIPSOLVER_ERROR(sp->krylov_begin(true,
+                                           false,
+                                           precond,
+                                           reusePrecond,
+                                           n,
+                                           nnzA,
+                                           nullptr,
+                                           hValA.data(),
+                                           hPtrA.data(),
+                                           hIndA.data(),
+                                           m + 2));
 
-    return hipsolver::rocblas2hip_status(st);
+    // solve for x
+    return sp->krylov_gmres(b, tolerance, maxiter, m, x, niters, resHistory);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
-}*/
+}
 
 } //extern C
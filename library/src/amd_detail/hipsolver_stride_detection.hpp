@@ -0,0 +1,277 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Dispatch of potrfBatched and potrsBatched to the strided batched routines of
+ *  rocSOLVER when the pointer arrays describe a strided batch.
+ *
+ *  hipSOLVER does not launch kernels of its own, so the pointer array is read back to the
+ *  host the first time it is seen by a handle, and the layout found is cached by address and
+ *  length (see stride_detection.hpp). Subsequent calls with the same array cost a lookup.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_conversions.hpp"
+#include "hipsolver_handle.hpp"
+#include "lib_macros.hpp"
+#include "rocblas/rocblas.h"
+#include "rocsolver/rocsolver.h"
+#include "utility.hpp"
+
+#include <mutex>
+#include <vector>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+struct potr_strided_routines;
+
+template <>
+struct potr_strided_routines<float>
+{
+    static constexpr auto potrf = rocsolver_spotrf_strided_batched;
+    static constexpr auto potrs = rocsolver_spotrs_strided_batched;
+};
+
+template <>
+struct potr_strided_routines<double>
+{
+    static constexpr auto potrf = rocsolver_dpotrf_strided_batched;
+    static constexpr auto potrs = rocsolver_dpotrs_strided_batched;
+};
+
+template <>
+struct potr_strided_routines<rocblas_float_complex>
+{
+    static constexpr auto potrf = rocsolver_cpotrf_strided_batched;
+    static constexpr auto potrs = rocsolver_cpotrs_strided_batched;
+};
+
+template <>
+struct potr_strided_routines<rocblas_double_complex>
+{
+    static constexpr auto potrf = rocsolver_zpotrf_strided_batched;
+    static constexpr auto potrs = rocsolver_zpotrs_strided_batched;
+};
+
+inline bool stride_detection_enabled(rocblas_handle handle)
+{
+    handle_data_lock data(handle);
+    return data->strides.enabled;
+}
+
+inline void record_stride_dispatch(rocblas_handle handle, bool strided)
+{
+    handle_data_lock data(handle);
+    data->strides.on_dispatch(strided);
+}
+
+/*! \brief Finds whether the pointer array holds a strided batch of matrices spanning at least
+    min_stride elements each. If so, found is set to true, and base and stride are set to the
+    first matrix and to the stride between matrices. The lock is not held while the array is
+    read back. */
+template <typename T>
+inline hipsolverStatus_t find_strided_batch(rocblas_handle  handle,
+                                            T* const        array[],
+                                            int             batch_count,
+                                            rocblas_stride  min_stride,
+                                            T**             base,
+                                            rocblas_stride* stride,
+                                            bool*           found)
+{
+    *found = false;
+
+    pointer_layout layout;
+    bool           cached, allowed;
+    {
+        handle_data_lock data(handle);
+        cached  = data->strides.find(array, batch_count, &layout);
+        allowed = data->capture.allows_stride_detection(cached);
+    }
+
+    // reading a new array waits for the stream, which capture-safe handles cannot do
+    if(!allowed)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    if(!cached)
+    {
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        std::vector<T*> hptr(batch_count);
+        CHECK_HIP_ERROR(hipMemcpyAsync(
+            hptr.data(), array, sizeof(T*) * batch_count, hipMemcpyDeviceToHost, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        layout = detect_pointer_layout((const void* const*)hptr.data(), batch_count);
+
+        handle_data_lock data(handle);
+        data->strides.insert(array, batch_count, layout);
+    }
+
+    int64_t elems;
+    if(layout.as_strided(sizeof(T), min_stride, batch_count, &elems))
+    {
+        *base   = (T*)layout.base;
+        *stride = elems;
+        *found  = true;
+    }
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Sets up the workspace of a strided call whose size was queried as size. Returns false
+    if the workspace provided by the user is too small, in which case the batched routine is
+    used instead. */
+inline bool strided_workspace(
+    rocblas_handle handle, void* work, int lwork, size_t size, hipsolverStatus_t* status)
+{
+    if(work && lwork)
+    {
+        if(size_t(lwork) < size)
+            return false;
+        *status = rocblas2hip_status(rocblas_set_workspace(handle, work, lwork));
+    }
+    else
+        *status = rocblas2hip_status(hipsolverManageWorkspace(handle, size));
+    return true;
+}
+
+/*! \brief Computes potrfBatched with the strided batched routine if stride detection is enabled
+    and A holds a strided batch. dispatched is set to true if the call was made; otherwise, the
+    caller proceeds with the batched routine. Arguments that the batched routine would reject
+    are always left to it. */
+template <typename T>
+inline hipsolverStatus_t potrf_batched_strided(rocblas_handle      handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               T* const            A[],
+                                               int                 lda,
+                                               T*                  work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count,
+                                               bool*               dispatched)
+{
+    *dispatched = false;
+    if(!handle || !stride_detection_enabled(handle))
+        return HIPSOLVER_STATUS_SUCCESS;
+    if(n <= 0 || lda < n || batch_count <= 0 || !A || !devInfo)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    T*             base;
+    rocblas_stride strideA;
+    bool           found;
+    CHECK_HIPSOLVER_ERROR(
+        find_strided_batch(handle, A, batch_count, rocblas_stride(lda) * n, &base, &strideA, &found));
+
+    rocblas_fill      fill   = hip2rocblas_fill(uplo);
+    hipsolverStatus_t status = HIPSOLVER_STATUS_SUCCESS;
+    if(found)
+    {
+        size_t sz;
+        rocblas_start_device_memory_size_query(handle);
+        status = rocblas2hip_status(potr_strided_routines<T>::potrf(
+            handle, fill, n, nullptr, lda, strideA, nullptr, batch_count));
+        rocblas_stop_device_memory_size_query(handle, &sz);
+
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+        found = strided_workspace(handle, work, lwork, sz, &status);
+    }
+
+    record_stride_dispatch(handle, found);
+    if(!found)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    *dispatched = true;
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    return rocblas2hip_status(potr_strided_routines<T>::potrf(
+        handle, fill, n, base, lda, strideA, devInfo, batch_count));
+}
+
+/*! \brief Computes potrsBatched with the strided batched routine if stride detection is enabled
+    and both A and B hold strided batches. See potrf_batched_strided. */
+template <typename T>
+inline hipsolverStatus_t potrs_batched_strided(rocblas_handle      handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               T* const            A[],
+                                               int                 lda,
+                                               T* const            B[],
+                                               int                 ldb,
+                                               T*                  work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count,
+                                               bool*               dispatched)
+{
+    *dispatched = false;
+    if(!handle || !stride_detection_enabled(handle))
+        return HIPSOLVER_STATUS_SUCCESS;
+    if(n <= 0 || nrhs <= 0 || lda < n || ldb < n || batch_count <= 0 || !A || !B || !devInfo)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    T *            baseA, *baseB;
+    rocblas_stride strideA, strideB;
+    bool           found;
+    CHECK_HIPSOLVER_ERROR(find_strided_batch(
+        handle, A, batch_count, rocblas_stride(lda) * n, &baseA, &strideA, &found));
+    if(found)
+        CHECK_HIPSOLVER_ERROR(find_strided_batch(
+            handle, B, batch_count, rocblas_stride(ldb) * nrhs, &baseB, &strideB, &found));
+
+    rocblas_fill      fill   = hip2rocblas_fill(uplo);
+    hipsolverStatus_t status = HIPSOLVER_STATUS_SUCCESS;
+    if(found)
+    {
+        size_t sz;
+        rocblas_start_device_memory_size_query(handle);
+        status = rocblas2hip_status(potr_strided_routines<T>::potrs(
+            handle, fill, n, nrhs, nullptr, lda, strideA, nullptr, ldb, strideB, batch_count));
+        rocblas_stop_device_memory_size_query(handle, &sz);
+
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+        found = strided_workspace(handle, work, lwork, sz, &status);
+    }
+
+    record_stride_dispatch(handle, found);
+    if(!found)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    *dispatched = true;
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    CHECK_ROCBLAS_ERROR(hipsolverZeroInfo(handle, devInfo, batch_count));
+
+    return rocblas2hip_status(potr_strided_routines<T>::potrs(
+        handle, fill, n, nrhs, baseA, lda, strideA, baseB, ldb, strideB, batch_count));
+}
+
+HIPSOLVER_END_NAMESPACE
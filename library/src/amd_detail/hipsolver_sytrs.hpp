@@ -0,0 +1,463 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Solver for the symmetric indefinite factorization computed by sytrf.
+ *
+ *  rocSOLVER factorizes A = U*D*U**T or A = L*D*L**T with Bunch-Kaufman pivoting, but it
+ *  does not provide a solver for the factors. The solver is built here from rocBLAS and
+ *  rocSOLVER auxiliary functions, in the way of LAPACK's sytrs2: the interchanges are moved
+ *  out of a copy of the triangular factor, so that each solve with it is a single trsm, and
+ *  the block diagonal D is inverted on the host. The pivots and the diagonals of D are read
+ *  back with one synchronization per call; everything else stays on the device.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_conversions.hpp"
+#include "hipsolver_handle.hpp"
+#include "lib_macros.hpp"
+#include "rocblas/rocblas.h"
+#include "rocsolver/rocsolver.h"
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+struct sytrs_routines;
+
+template <>
+struct sytrs_routines<float>
+{
+    static constexpr auto swap  = rocblas_sswap;
+    static constexpr auto laswp = rocsolver_slaswp;
+    static constexpr auto trsm  = rocblas_strsm;
+    static constexpr auto dgmm  = rocblas_sdgmm;
+    static constexpr auto geam  = rocblas_sgeam;
+};
+
+template <>
+struct sytrs_routines<double>
+{
+    static constexpr auto swap  = rocblas_dswap;
+    static constexpr auto laswp = rocsolver_dlaswp;
+    static constexpr auto trsm  = rocblas_dtrsm;
+    static constexpr auto dgmm  = rocblas_ddgmm;
+    static constexpr auto geam  = rocblas_dgeam;
+};
+
+template <>
+struct sytrs_routines<rocblas_float_complex>
+{
+    static constexpr auto swap  = rocblas_cswap;
+    static constexpr auto laswp = rocsolver_claswp;
+    static constexpr auto trsm  = rocblas_ctrsm;
+    static constexpr auto dgmm  = rocblas_cdgmm;
+    static constexpr auto geam  = rocblas_cgeam;
+};
+
+template <>
+struct sytrs_routines<rocblas_double_complex>
+{
+    static constexpr auto swap  = rocblas_zswap;
+    static constexpr auto laswp = rocsolver_zlaswp;
+    static constexpr auto trsm  = rocblas_ztrsm;
+    static constexpr auto dgmm  = rocblas_zdgmm;
+    static constexpr auto geam  = rocblas_zgeam;
+};
+
+// The entries of D are inverted in double precision on the host
+inline std::complex<double> sytrs_widen(float x)
+{
+    return x;
+}
+
+inline std::complex<double> sytrs_widen(double x)
+{
+    return x;
+}
+
+template <typename S>
+inline std::complex<double> sytrs_widen(rocblas_complex_num<S> x)
+{
+    return std::complex<double>(x.real(), x.imag());
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+inline T sytrs_narrow(std::complex<double> x)
+{
+    return T(x.real());
+}
+
+template <typename T, std::enable_if_t<!std::is_floating_point<T>::value, int> = 0>
+inline T sytrs_narrow(std::complex<double> x)
+{
+    using S = decltype(sytrs_widen(T{}).real());
+    return T(S(x.real()), S(x.imag()));
+}
+
+inline hipsolverStatus_t sytrs_argCheck(
+    hipsolverFillMode_t uplo, int n, int nrhs, int lda, int ldb, int batch_count)
+{
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0 || nrhs < 0 || lda < std::max(n, 1) || ldb < std::max(n, 1) || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Size of the device buffer used by sytrs besides the workspace of rocBLAS: the
+    converted triangular factor and two n x nrhs blocks, which are reused by every problem in
+    the batch, plus the inverse of D, the diagonal of the converted factor and the interchanges
+    of each problem. */
+template <typename T>
+inline size_t sytrs_extra_size(int n, int nrhs, int batch_count)
+{
+    size_t size_W = sizeof(T) * n * n;
+    size_t size_X = sizeof(T) * 2 * n * nrhs;
+    size_t size_D = sizeof(T) * 3 * n * batch_count;
+    size_t size_P = sizeof(rocblas_int) * n * batch_count;
+    return size_W + size_X + size_D + size_P;
+}
+
+/*! \brief Workspace of rocBLAS needed by sytrs, which is that of trsm. Must be called between
+    rocblas_start_device_memory_size_query and rocblas_stop_device_memory_size_query. */
+template <typename T>
+inline rocblas_status
+    sytrs_rocblas_size(rocblas_handle handle, hipsolverFillMode_t uplo, int n, int nrhs, int ldb)
+{
+    return sytrs_routines<T>::trsm(handle,
+                                   rocblas_side_left,
+                                   hip2rocblas_fill(uplo),
+                                   rocblas_operation_transpose,
+                                   rocblas_diagonal_unit,
+                                   n,
+                                   nrhs,
+                                   nullptr,
+                                   nullptr,
+                                   std::max(n, 1),
+                                   nullptr,
+                                   ldb);
+}
+
+/*! \brief Copies an array of device pointers to the host. The pointers are null if the array
+    is null. */
+template <typename T>
+inline hipsolverStatus_t
+    sytrs_pointers(rocblas_handle handle, T* const dptr[], int batch_count, std::vector<T*>* hptr)
+{
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    hptr->assign(std::max(batch_count, 0), nullptr);
+    if(batch_count > 0 && dptr)
+    {
+        CHECK_HIP_ERROR(hipMemcpyAsync(
+            hptr->data(), dptr, sizeof(T*) * batch_count, hipMemcpyDeviceToHost, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Pointers to the problems of a strided batch. */
+template <typename T>
+inline std::vector<T*> sytrs_pointers(T* base, rocblas_stride stride, int batch_count)
+{
+    std::vector<T*> hptr(std::max(batch_count, 0));
+    for(int b = 0; b < batch_count; b++)
+        hptr[b] = base ? base + b * stride : nullptr;
+    return hptr;
+}
+
+/*! \brief Solves A_b * X_b = B_b for every problem b in the batch, given the factorization
+    of A_b and the pivots computed by sytrf. A and B hold device pointers to the problems, and
+    ipiv points to the pivots of the first problem on the device, with stride strideP between
+    problems. extra must point to sytrs_extra_size bytes of device memory, and the workspace
+    of rocBLAS must be set up by the caller. B is overwritten with the solutions.
+
+    The interchange of each 1x1 or 2x2 pivot step is applied to the columns of the triangular
+    factor computed in the later steps, so that the factor becomes P*U (or P*L) with a single
+    permutation P and a unit triangular matrix, as LAPACK's syconv does. The solution is then
+    X = P * inv(U**T) * inv(D) * inv(U) * P**T * B, where the inverse of each 2x2 block of D is
+    computed on the host in the scaled form used by LAPACK and applied with dgmm. */
+template <typename T, typename I>
+inline hipsolverStatus_t sytrs(rocblas_handle         handle,
+                               hipsolverFillMode_t    uplo,
+                               int                    n,
+                               int                    nrhs,
+                               const std::vector<T*>& A,
+                               int                    lda,
+                               const I*               ipiv,
+                               rocblas_stride         strideP,
+                               const std::vector<T*>& B,
+                               int                    ldb,
+                               int                    batch_count,
+                               void*                  extra)
+{
+    using routines = sytrs_routines<T>;
+
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    bool   upper  = uplo == HIPSOLVER_FILL_MODE_UPPER;
+    size_t size_D = 3 * size_t(n);
+
+    T*           dW = (T*)extra;
+    T*           dX = dW + size_t(n) * n;
+    T*           dY = dX + size_t(n) * nrhs;
+    T*           dD = dY + size_t(n) * nrhs;
+    rocblas_int* dP = (rocblas_int*)(dD + size_D * batch_count);
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    // pivots, and the diagonal and off-diagonal of D (the latter in the layout of sytrf)
+    std::vector<I> hIpiv(size_t(n) * batch_count);
+    std::vector<T> hA(2 * size_t(n) * batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* diag = hA.data() + 2 * size_t(n) * b;
+
+        CHECK_HIP_ERROR(hipMemcpyAsync(hIpiv.data() + size_t(n) * b,
+                                       ipiv + b * strideP,
+                                       sizeof(I) * n,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+        CHECK_HIP_ERROR(hipMemcpy2DAsync(diag,
+                                         sizeof(T),
+                                         A[b],
+                                         sizeof(T) * (lda + 1),
+                                         sizeof(T),
+                                         n,
+                                         hipMemcpyDeviceToHost,
+                                         stream));
+        if(n > 1)
+            CHECK_HIP_ERROR(hipMemcpy2DAsync(diag + n,
+                                             sizeof(T),
+                                             A[b] + (upper ? lda : 1),
+                                             sizeof(T) * (lda + 1),
+                                             sizeof(T),
+                                             n - 1,
+                                             hipMemcpyDeviceToHost,
+                                             stream));
+    }
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // interchanges applied to the copy of the factor: rows r1 and r2 of ncols columns from c0
+    struct swap_t
+    {
+        int r1, r2, c0, ncols;
+    };
+    std::vector<std::vector<swap_t>> swaps(batch_count);
+    std::vector<bool>                has_2x2(batch_count, false);
+
+    // for each problem: the diagonal of inv(D), its off-diagonal and the off-diagonal of the
+    // converted factor, followed by the interchanges in the format of laswp
+    std::vector<T>           hD(size_D * batch_count);
+    std::vector<rocblas_int> hP(size_t(n) * batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        const I* piv  = hIpiv.data() + size_t(n) * b;
+        const T* diag = hA.data() + 2 * size_t(n) * b;
+        const T* off  = diag + n;
+        T*       dinv = hD.data() + size_D * b;
+        T*       einv = dinv + n;
+        T*       woff = einv + n;
+        rocblas_int* perm = hP.data() + size_t(n) * b;
+
+        for(int i = 0; i < n; i++)
+        {
+            einv[i] = 0;
+            woff[i] = i < n - 1 ? off[i] : T(0);
+            perm[i] = i + 1;
+        }
+
+        // inverse of the 2x2 block of D in rows p and p + 1
+        auto invert_2x2 = [&](int p) {
+            std::complex<double> akm1k = sytrs_widen(off[p]);
+            std::complex<double> akm1  = sytrs_widen(diag[p]) / akm1k;
+            std::complex<double> ak    = sytrs_widen(diag[p + 1]) / akm1k;
+            std::complex<double> denom = akm1k * (akm1 * ak - 1.0);
+
+            dinv[p]     = sytrs_narrow<T>(ak / denom);
+            dinv[p + 1] = sytrs_narrow<T>(akm1 / denom);
+            einv[p]     = sytrs_narrow<T>(-1.0 / denom);
+            woff[p]     = 0;
+            has_2x2[b]  = true;
+        };
+
+        int k = upper ? n - 1 : 0;
+        while(upper ? k >= 0 : k < n)
+        {
+            bool block = piv[k] < 0;
+            int  kp    = (block ? -piv[k] : piv[k]) - 1;
+            int  p     = block ? (upper ? k - 1 : k) : k; // first row of the block
+            int  r     = block ? (upper ? k - 1 : k + 1) : k; // row interchanged with kp
+            if(kp < 0 || kp >= n || p < 0 || p + block >= n)
+                return HIPSOLVER_STATUS_INVALID_VALUE;
+
+            if(block)
+                invert_2x2(p);
+            else
+                dinv[k] = sytrs_narrow<T>(1.0 / sytrs_widen(diag[k]));
+
+            perm[r] = kp + 1;
+            if(kp != r)
+            {
+                if(upper && k < n - 1)
+                    swaps[b].push_back({r, kp, k + 1, n - k - 1});
+                else if(!upper && p > 0)
+                    swaps[b].push_back({r, kp, 0, p});
+            }
+
+            k += upper ? -1 - block : 1 + block;
+        }
+    }
+
+    CHECK_HIP_ERROR(
+        hipMemcpyAsync(dD, hD.data(), sizeof(T) * hD.size(), hipMemcpyHostToDevice, stream));
+    CHECK_HIP_ERROR(hipMemcpyAsync(
+        dP, hP.data(), sizeof(rocblas_int) * hP.size(), hipMemcpyHostToDevice, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    pointer_mode_host_scope scope(handle);
+    const T                 one = 1;
+    rocblas_fill            fill = hip2rocblas_fill(uplo);
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        T*           dinv = dD + size_D * b;
+        T*           einv = dinv + n;
+        T*           woff = einv + n;
+        rocblas_int* perm = dP + size_t(n) * b;
+
+        // unit triangular factor, with the interchanges of the later steps applied
+        CHECK_HIP_ERROR(hipMemcpy2DAsync(dW,
+                                         sizeof(T) * n,
+                                         A[b],
+                                         sizeof(T) * lda,
+                                         sizeof(T) * n,
+                                         n,
+                                         hipMemcpyDeviceToDevice,
+                                         stream));
+        if(n > 1)
+            CHECK_HIP_ERROR(hipMemcpy2DAsync(dW + (upper ? n : 1),
+                                             sizeof(T) * (n + 1),
+                                             woff,
+                                             sizeof(T),
+                                             sizeof(T),
+                                             n - 1,
+                                             hipMemcpyDeviceToDevice,
+                                             stream));
+        for(const swap_t& s : swaps[b])
+            CHECK_ROCBLAS_ERROR(routines::swap(handle,
+                                               s.ncols,
+                                               dW + s.r1 + size_t(s.c0) * n,
+                                               n,
+                                               dW + s.r2 + size_t(s.c0) * n,
+                                               n));
+
+        // B = inv(U) * P**T * B
+        CHECK_ROCBLAS_ERROR(routines::laswp(handle, nrhs, B[b], ldb, 1, n, perm, upper ? -1 : 1));
+        CHECK_ROCBLAS_ERROR(routines::trsm(handle,
+                                           rocblas_side_left,
+                                           fill,
+                                           rocblas_operation_none,
+                                           rocblas_diagonal_unit,
+                                           n,
+                                           nrhs,
+                                           &one,
+                                           dW,
+                                           n,
+                                           B[b],
+                                           ldb));
+
+        // B = inv(D) * B
+        CHECK_ROCBLAS_ERROR(
+            routines::dgmm(handle, rocblas_side_left, n, nrhs, B[b], ldb, dinv, 1, dX, n));
+        if(has_2x2[b])
+        {
+            CHECK_ROCBLAS_ERROR(routines::dgmm(
+                handle, rocblas_side_left, n - 1, nrhs, B[b] + 1, ldb, einv, 1, dY, n));
+            CHECK_ROCBLAS_ERROR(routines::geam(handle,
+                                               rocblas_operation_none,
+                                               rocblas_operation_none,
+                                               n - 1,
+                                               nrhs,
+                                               &one,
+                                               dX,
+                                               n,
+                                               &one,
+                                               dY,
+                                               n,
+                                               dX,
+                                               n));
+            CHECK_ROCBLAS_ERROR(routines::dgmm(
+                handle, rocblas_side_left, n - 1, nrhs, B[b], ldb, einv, 1, dY, n));
+            CHECK_ROCBLAS_ERROR(routines::geam(handle,
+                                               rocblas_operation_none,
+                                               rocblas_operation_none,
+                                               n - 1,
+                                               nrhs,
+                                               &one,
+                                               dX + 1,
+                                               n,
+                                               &one,
+                                               dY,
+                                               n,
+                                               dX + 1,
+                                               n));
+        }
+        CHECK_HIP_ERROR(hipMemcpy2DAsync(B[b],
+                                         sizeof(T) * ldb,
+                                         dX,
+                                         sizeof(T) * n,
+                                         sizeof(T) * n,
+                                         nrhs,
+                                         hipMemcpyDeviceToDevice,
+                                         stream));
+
+        // B = P * inv(U**T) * B
+        CHECK_ROCBLAS_ERROR(routines::trsm(handle,
+                                           rocblas_side_left,
+                                           fill,
+                                           rocblas_operation_transpose,
+                                           rocblas_diagonal_unit,
+                                           n,
+                                           nrhs,
+                                           &one,
+                                           dW,
+                                           n,
+                                           B[b],
+                                           ldb));
+        CHECK_ROCBLAS_ERROR(routines::laswp(handle, nrhs, B[b], ldb, 1, n, perm, upper ? 1 : -1));
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+HIPSOLVER_END_NAMESPACE
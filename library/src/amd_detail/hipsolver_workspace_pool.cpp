@@ -0,0 +1,436 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Implementation of the workspace pool on the rocSOLVER side.
+ *
+ *  A pool serves the workspace of the handles attached to it from a stream-ordered memory
+ *  pool. Each handle holds at most one block, which is reused while it is large enough and
+ *  released on the stream of the handle, so that other handles can reuse the memory without
+ *  synchronizing the device.
+ *
+ *  The blocks and the workspace of a handle are only changed by the thread calling on that
+ *  handle. Trimming or destroying the pool marks the blocks as stale instead, and each handle
+ *  drops its stale block on its next call. The handles attached to a pool share its ownership,
+ *  so that it outlives its destruction until the last of them has dropped its block. The lock
+ *  of a pool may be taken while the lock of a handle is held, but never the other way round.
+ */
+
+#include "exceptions.hpp"
+#include "hipsolver.h"
+#include "hipsolver_conversions.hpp"
+#include "hipsolver_handle.hpp"
+#include "lib_macros.hpp"
+#include "utility.hpp"
+#include "workspace_pool_tracker.hpp"
+
+#include "rocblas/rocblas.h"
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+struct hipsolverWorkspacePool
+{
+    struct lease_t
+    {
+        void*       ptr    = nullptr;
+        size_t      size   = 0;
+        hipStream_t stream = nullptr;
+        bool        stale  = false; // to be released by the handle on its next call
+    };
+
+    int          device;
+    hipMemPool_t mempool = nullptr; // nullptr if stream-ordered allocation is not supported
+
+    std::mutex                                  mutex;
+    hipsolver::workspace_pool_tracker           tracker;
+    std::unordered_map<rocblas_handle, lease_t> leases;
+    bool                                        destroyed = false; // set when destroyed
+
+    // reference held by the user, dropped by hipsolverDestroyWorkspacePool
+    std::shared_ptr<hipsolverWorkspacePool> self;
+
+    ~hipsolverWorkspacePool()
+    {
+        free();
+    }
+
+    hipError_t init()
+    {
+        hipError_t err = hipGetDevice(&device);
+        if(err != hipSuccess)
+            return err;
+
+        int supported = 0;
+        hipDeviceGetAttribute(&supported, hipDeviceAttributeMemoryPoolsSupported, device);
+        if(!supported)
+            return hipSuccess;
+
+        hipMemPoolProps props = {};
+        props.allocType       = hipMemAllocationTypePinned;
+        props.handleTypes     = hipMemHandleTypeNone;
+        props.location.type   = hipMemLocationTypeDevice;
+        props.location.id     = device;
+        if(hipMemPoolCreate(&mempool, &props) != hipSuccess)
+            mempool = nullptr;
+
+        return update_threshold();
+    }
+
+    // Only called once no handle refers to the pool; the blocks left are those of handles
+    // destroyed without being detached
+    void free()
+    {
+        for(auto& it : leases)
+            release(it.second);
+        leases.clear();
+
+        if(mempool)
+            hipMemPoolDestroy(mempool);
+        mempool = nullptr;
+    }
+
+    // Keep up to the high watermark cached in the pool across synchronizations
+    hipError_t update_threshold()
+    {
+        if(!mempool)
+            return hipSuccess;
+
+        uint64_t threshold = tracker.high_watermark;
+        return hipMemPoolSetAttribute(mempool, hipMemPoolAttrReleaseThreshold, &threshold);
+    }
+
+    size_t bytes_reserved()
+    {
+        uint64_t reserved;
+        if(mempool
+           && hipMemPoolGetAttribute(mempool, hipMemPoolAttrReservedMemCurrent, &reserved)
+                  == hipSuccess)
+            return reserved;
+        return tracker.bytes_in_use;
+    }
+
+    hipError_t allocate(lease_t& lease, size_t size, hipStream_t stream)
+    {
+        void*      ptr;
+        hipError_t err;
+        if(mempool)
+        {
+            err = hipMallocFromPoolAsync(&ptr, size, mempool, stream);
+            if(err == hipErrorOutOfMemory)
+            {
+                // return the cached memory to the device and try again
+                hipMemPoolTrimTo(mempool, 0);
+                tracker.on_trim();
+                err = hipMallocFromPoolAsync(&ptr, size, mempool, stream);
+            }
+        }
+        else
+            err = hipMalloc(&ptr, size);
+
+        if(err != hipSuccess)
+            return err;
+
+        lease.ptr    = ptr;
+        lease.size   = size;
+        lease.stream = stream;
+        tracker.on_allocate(size);
+        return hipSuccess;
+    }
+
+    void release(lease_t& lease)
+    {
+        if(lease.ptr)
+        {
+            // the block is freed after the work already queued on its stream
+            if(mempool)
+                hipFreeAsync(lease.ptr, lease.stream);
+            else
+                hipFree(lease.ptr);
+            tracker.on_release(lease.size);
+        }
+        lease = lease_t();
+    }
+
+    // Marks the blocks held by the handles as stale
+    void expire()
+    {
+        for(auto& it : leases)
+            it.second.stale = true;
+    }
+
+    void trim()
+    {
+        if(mempool)
+            hipMemPoolTrimTo(mempool, tracker.low_watermark);
+        tracker.on_trim();
+    }
+};
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+bool pool_workspace(rocblas_handle handle, handle_data& data, size_t size, rocblas_status* status)
+{
+    // the reference keeps the pool alive if it is destroyed concurrently
+    std::shared_ptr<hipsolverWorkspacePool> pool = data.pool;
+    if(!pool)
+        return false;
+
+    hipStream_t stream;
+    *status = rocblas_get_stream(handle, &stream);
+    if(*status != rocblas_status_success)
+        return true;
+
+    void*  ptr       = nullptr;
+    size_t held      = 0;
+    bool   destroyed = false, failed = false;
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        if(pool->destroyed)
+        {
+            // return the block of the handle before detaching it
+            auto it = pool->leases.find(handle);
+            if(it != pool->leases.end())
+            {
+                pool->release(it->second);
+                pool->leases.erase(it);
+            }
+            destroyed = true;
+        }
+        else
+        {
+            hipsolverWorkspacePool::lease_t& lease = pool->leases[handle];
+            if(lease.stale || lease.stream != stream
+               || pool->tracker.must_reallocate(lease.size, size)
+               || !data.budget.allows(lease.size))
+            {
+                pool->release(lease);
+                if(size > 0)
+                {
+                    failed = pool->allocate(lease, size, stream) != hipSuccess;
+                    if(!failed && pool->tracker.should_trim(pool->bytes_reserved()))
+                        pool->trim();
+                }
+            }
+            ptr  = lease.ptr;
+            held = lease.size;
+        }
+    }
+
+    // also set when the block could not be replaced, so that the handle drops the old one
+    *status = rocblas_set_workspace(handle, ptr, held);
+    if(*status == rocblas_status_success)
+        data.budget.on_workspace(held);
+    if(failed && *status == rocblas_status_success)
+        *status = rocblas_status_memory_error;
+
+    if(destroyed)
+    {
+        data.pool = nullptr;
+        return *status != rocblas_status_success;
+    }
+    return true;
+}
+
+HIPSOLVER_END_NAMESPACE
+
+extern "C" {
+
+/******************** WORKSPACE POOL ********************/
+hipsolverStatus_t hipsolverCreateWorkspacePool(hipsolverWorkspacePool_t* pool)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    auto wpool = std::make_shared<hipsolverWorkspacePool>();
+    if(wpool->init() != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    wpool->self = wpool;
+    *pool       = wpool.get();
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDestroyWorkspacePool(hipsolverWorkspacePool_t pool)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the handles still attached drop their blocks and detach on their next call; the pool is
+    // deleted once they have, or here if none is left
+    hipsolverWorkspacePool*                 wpool = (hipsolverWorkspacePool*)pool;
+    std::shared_ptr<hipsolverWorkspacePool> self;
+    {
+        std::lock_guard<std::mutex> lock(wpool->mutex);
+        if(wpool->destroyed)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        wpool->destroyed = true;
+        wpool->expire();
+        if(wpool->mempool)
+            hipMemPoolTrimTo(wpool->mempool, 0);
+        self = std::move(wpool->self);
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverWorkspacePoolSetWatermarks(hipsolverWorkspacePool_t pool,
+                                                      size_t                   low_watermark,
+                                                      size_t                   high_watermark)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolverWorkspacePool*     wpool = (hipsolverWorkspacePool*)pool;
+    std::lock_guard<std::mutex> lock(wpool->mutex);
+    if(!wpool->tracker.set_watermarks(low_watermark, high_watermark))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    CHECK_HIP_ERROR(wpool->update_threshold());
+    if(wpool->tracker.should_trim(wpool->bytes_reserved()))
+        wpool->trim();
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverWorkspacePoolTrim(hipsolverWorkspacePool_t pool)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the blocks held by the handles are released by their next calls
+    hipsolverWorkspacePool*     wpool = (hipsolverWorkspacePool*)pool;
+    std::lock_guard<std::mutex> lock(wpool->mutex);
+    wpool->expire();
+    wpool->trim();
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverWorkspacePoolGetStats(hipsolverWorkspacePool_t       pool,
+                                                 hipsolverWorkspacePoolStats_t* stats)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!stats)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolverWorkspacePool*     wpool = (hipsolverWorkspacePool*)pool;
+    std::lock_guard<std::mutex> lock(wpool->mutex);
+    stats->bytes_in_use      = wpool->tracker.bytes_in_use;
+    stats->peak_bytes_in_use = wpool->tracker.peak_bytes_in_use;
+    stats->bytes_reserved    = wpool->bytes_reserved();
+    stats->reallocations     = wpool->tracker.reallocations;
+    stats->trims             = wpool->tracker.trims;
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSetWorkspacePool(hipsolverHandle_t handle, hipsolverWorkspacePool_t pool)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    rocblas_handle          rhandle = (rocblas_handle)handle;
+    hipsolverWorkspacePool* wpool   = (hipsolverWorkspacePool*)pool;
+
+    std::shared_ptr<hipsolverWorkspacePool> new_pool;
+    if(wpool)
+    {
+        int device;
+        CHECK_HIP_ERROR(hipGetDevice(&device));
+        if(device != wpool->device)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        std::lock_guard<std::mutex> lock(wpool->mutex);
+        if(wpool->destroyed)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+        new_pool = wpool->self;
+    }
+
+    std::shared_ptr<hipsolverWorkspacePool> old_pool;
+    {
+        hipsolver::handle_data_lock data(rhandle);
+        old_pool   = data->pool;
+        data->pool = new_pool;
+    }
+    if(old_pool == new_pool)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    if(old_pool)
+    {
+        // return the block of the handle to its pool
+        {
+            std::lock_guard<std::mutex> lock(old_pool->mutex);
+            auto                        it = old_pool->leases.find(rhandle);
+            if(it != old_pool->leases.end())
+            {
+                old_pool->release(it->second);
+                old_pool->leases.erase(it);
+            }
+        }
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace(rhandle, nullptr, 0));
+        hipsolver::record_workspace_size(rhandle, 0);
+    }
+
+    if(new_pool)
+    {
+        std::lock_guard<std::mutex> lock(new_pool->mutex);
+        new_pool->leases[rhandle];
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+} // extern C
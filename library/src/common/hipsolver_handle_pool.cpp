@@ -0,0 +1,170 @@
+/* ************************************************************************
+ * Copyright (C) 2020-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief hipsolver_handle_pool.cpp provides pools of handles that can be acquired and
+ *  released by several threads. The pools only use hipSOLVER's regular APIs, so they are
+ *  shared by the cuSOLVER and rocSOLVER backends.
+ */
+
+#include "exceptions.hpp"
+#include "handle_pool_core.hpp"
+#include "hipsolver.h"
+
+// Creates and destroys the handles of a pool on the device of the pool
+class device_handle_factory : public hipsolver::handle_factory
+{
+public:
+    explicit device_handle_factory(int device)
+        : device(device)
+    {
+    }
+
+    hipsolverStatus_t create(hipsolverHandle_t* handle) override
+    {
+        return on_device([&]() { return hipsolverCreate(handle); });
+    }
+
+    hipsolverStatus_t destroy(hipsolverHandle_t handle) override
+    {
+        return on_device([&]() { return hipsolverDestroy(handle); });
+    }
+
+    hipsolverStatus_t set_stream(hipsolverHandle_t handle, hipStream_t stream) override
+    {
+        return hipsolverSetStream(handle, stream);
+    }
+
+private:
+    int device;
+
+    template <typename F>
+    hipsolverStatus_t on_device(F f)
+    {
+        int current;
+        if(hipGetDevice(&current) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        if(current == device)
+            return f();
+
+        if(hipSetDevice(device) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        hipsolverStatus_t status = f();
+        if(hipSetDevice(current) != hipSuccess && status == HIPSOLVER_STATUS_SUCCESS)
+            status = HIPSOLVER_STATUS_INTERNAL_ERROR;
+        return status;
+    }
+};
+
+extern "C" {
+
+hipsolverStatus_t hipsolverCreateHandlePool(hipsolverHandlePool_t* pool, int device, int capacity)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(capacity <= 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    int count;
+    if(hipGetDeviceCount(&count) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    if(device < 0 || device >= count)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *pool = new hipsolver::handle_pool_core(std::make_unique<device_handle_factory>(device),
+                                            capacity);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDestroyHandlePool(hipsolverHandlePool_t pool)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver::handle_pool_core* hpool = (hipsolver::handle_pool_core*)pool;
+    if(hpool->outstanding() > 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolverStatus_t status = hpool->drain();
+    delete hpool;
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverHandlePoolReserve(hipsolverHandlePool_t pool, int count)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return ((hipsolver::handle_pool_core*)pool)->reserve(count);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverHandlePoolAcquire(hipsolverHandlePool_t pool,
+                                             hipStream_t           stream,
+                                             hipsolverHandle_t*    handle)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!handle)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return ((hipsolver::handle_pool_core*)pool)->acquire(stream, handle);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverHandlePoolRelease(hipsolverHandlePool_t pool, hipsolverHandle_t handle)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return ((hipsolver::handle_pool_core*)pool)->release(handle);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+} //extern C
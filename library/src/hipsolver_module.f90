@@ -1469,6 +1469,141 @@ module hipsolver
             type(c_ptr), value :: info
         end function hipsolverZZgels
     end interface
+
+    interface
+        function hipsolverDSgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork) &
+                bind(c, name = 'hipsolverDSgels_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDSgels_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: lwork
+        end function hipsolverDSgels_bufferSize
+    end interface
+
+    interface
+        function hipsolverDHgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork) &
+                bind(c, name = 'hipsolverDHgels_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDHgels_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: lwork
+        end function hipsolverDHgels_bufferSize
+    end interface
+
+    interface
+        function hipsolverZCgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork) &
+                bind(c, name = 'hipsolverZCgels_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZCgels_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: lwork
+        end function hipsolverZCgels_bufferSize
+    end interface
+
+    interface
+        function hipsolverDSgels(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info) &
+                bind(c, name = 'hipsolverDSgels')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDSgels
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: work
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
+            type(c_ptr), value :: info
+        end function hipsolverDSgels
+    end interface
+
+    interface
+        function hipsolverDHgels(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info) &
+                bind(c, name = 'hipsolverDHgels')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDHgels
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: work
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
+            type(c_ptr), value :: info
+        end function hipsolverDHgels
+    end interface
+
+    interface
+        function hipsolverZCgels(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info) &
+                bind(c, name = 'hipsolverZCgels')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZCgels
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: work
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
+            type(c_ptr), value :: info
+        end function hipsolverZCgels
+    end interface
     
     ! ******************** GEQRF ********************
     interface
@@ -1611,6 +1746,171 @@ module hipsolver
         end function hipsolverZgeqrf
     end interface
 
+    ! ******************** GEQRF_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                bind(c, name = 'hipsolverSgeqrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgeqrfStridedBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgeqrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                bind(c, name = 'hipsolverDgeqrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgeqrfStridedBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgeqrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                bind(c, name = 'hipsolverCgeqrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgeqrfStridedBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgeqrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                bind(c, name = 'hipsolverZgeqrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgeqrfStridedBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgeqrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgeqrfStridedBatched(handle, m, n, A, lda, strideA, tau, strideT, work, &
+                lwork, info, batch_count) &
+                bind(c, name = 'hipsolverSgeqrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgeqrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_long_long), value :: strideT
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgeqrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDgeqrfStridedBatched(handle, m, n, A, lda, strideA, tau, strideT, work, &
+                lwork, info, batch_count) &
+                bind(c, name = 'hipsolverDgeqrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgeqrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_long_long), value :: strideT
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgeqrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCgeqrfStridedBatched(handle, m, n, A, lda, strideA, tau, strideT, work, &
+                lwork, info, batch_count) &
+                bind(c, name = 'hipsolverCgeqrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgeqrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_long_long), value :: strideT
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgeqrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgeqrfStridedBatched(handle, m, n, A, lda, strideA, tau, strideT, work, &
+                lwork, info, batch_count) &
+                bind(c, name = 'hipsolverZgeqrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgeqrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_long_long), value :: strideT
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgeqrfStridedBatched
+    end interface
+    
     ! ******************** GESV ********************
     interface
         function hipsolverSSgesv_bufferSize(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, lwork) &
@@ -1791,42 +2091,222 @@ module hipsolver
             type(c_ptr), value :: info
         end function hipsolverZZgesv
     end interface
-    
-    ! ******************** GESVD ********************
+
     interface
-        function hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
-                bind(c, name = 'hipsolverSgesvd_bufferSize')
+        function hipsolverDSgesv_bufferSize(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, lwork) &
+                bind(c, name = 'hipsolverDSgesv_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgesvd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDSgesv_bufferSize
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
-            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: lwork
-        end function hipsolverSgesvd_bufferSize
+        end function hipsolverDSgesv_bufferSize
     end interface
-    
+
     interface
-        function hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
-                bind(c, name = 'hipsolverDgesvd_bufferSize')
+        function hipsolverDHgesv_bufferSize(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, lwork) &
+                bind(c, name = 'hipsolverDHgesv_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgesvd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDHgesv_bufferSize
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
-            integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), value :: lwork
-        end function hipsolverDgesvd_bufferSize
-    end interface
-    
-    interface
-        function hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: lwork
+        end function hipsolverDHgesv_bufferSize
+    end interface
+
+    interface
+        function hipsolverZCgesv_bufferSize(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, lwork) &
+                bind(c, name = 'hipsolverZCgesv_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZCgesv_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: lwork
+        end function hipsolverZCgesv_bufferSize
+    end interface
+
+    interface
+        function hipsolverZKgesv_bufferSize(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, lwork) &
+                bind(c, name = 'hipsolverZKgesv_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZKgesv_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: lwork
+        end function hipsolverZKgesv_bufferSize
+    end interface
+
+    interface
+        function hipsolverDSgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, work, lwork, niters, info) &
+                bind(c, name = 'hipsolverDSgesv')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDSgesv
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: work
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
+            type(c_ptr), value :: info
+        end function hipsolverDSgesv
+    end interface
+
+    interface
+        function hipsolverDHgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, work, lwork, niters, info) &
+                bind(c, name = 'hipsolverDHgesv')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDHgesv
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: work
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
+            type(c_ptr), value :: info
+        end function hipsolverDHgesv
+    end interface
+
+    interface
+        function hipsolverZCgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, work, lwork, niters, info) &
+                bind(c, name = 'hipsolverZCgesv')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZCgesv
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: work
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
+            type(c_ptr), value :: info
+        end function hipsolverZCgesv
+    end interface
+
+    interface
+        function hipsolverZKgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, work, lwork, niters, info) &
+                bind(c, name = 'hipsolverZKgesv')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZKgesv
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: work
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
+            type(c_ptr), value :: info
+        end function hipsolverZKgesv
+    end interface
+    
+    ! ******************** GESVD ********************
+    interface
+        function hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+                bind(c, name = 'hipsolverSgesvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgesvd_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverSgesvd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+                bind(c, name = 'hipsolverDgesvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgesvd_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverDgesvd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
                 bind(c, name = 'hipsolverCgesvd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
@@ -1961,165 +2441,358 @@ module hipsolver
         end function hipsolverZgesvd
     end interface
     
-    ! ******************** GESVDJ ********************
+    ! ******************** GESVD_STRIDED_BATCHED ********************
     interface
-        function hipsolverSgesvdj_bufferSize(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params) &
-                bind(c, name = 'hipsolverSgesvdj_bufferSize')
+        function hipsolverSgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count) &
+                bind(c, name = 'hipsolverSgesvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgesvdj_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgesvdStridedBatched_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(c_int), value :: econ
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: S
-            type(c_ptr), value :: U
-            integer(c_int), value :: ldu
-            type(c_ptr), value :: V
-            integer(c_int), value :: ldv
             type(c_ptr), value :: lwork
-            type(c_ptr), value :: params
-        end function hipsolverSgesvdj_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSgesvdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDgesvdj_bufferSize(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params) &
-                bind(c, name = 'hipsolverDgesvdj_bufferSize')
+        function hipsolverDgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count) &
+                bind(c, name = 'hipsolverDgesvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgesvdj_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgesvdStridedBatched_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(c_int), value :: econ
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: S
-            type(c_ptr), value :: U
-            integer(c_int), value :: ldu
-            type(c_ptr), value :: V
-            integer(c_int), value :: ldv
             type(c_ptr), value :: lwork
-            type(c_ptr), value :: params
-        end function hipsolverDgesvdj_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDgesvdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCgesvdj_bufferSize(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params) &
-                bind(c, name = 'hipsolverCgesvdj_bufferSize')
+        function hipsolverCgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count) &
+                bind(c, name = 'hipsolverCgesvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgesvdj_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgesvdStridedBatched_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(c_int), value :: econ
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: S
-            type(c_ptr), value :: U
-            integer(c_int), value :: ldu
-            type(c_ptr), value :: V
-            integer(c_int), value :: ldv
             type(c_ptr), value :: lwork
-            type(c_ptr), value :: params
-        end function hipsolverCgesvdj_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverCgesvdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZgesvdj_bufferSize(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params) &
-                bind(c, name = 'hipsolverZgesvdj_bufferSize')
+        function hipsolverZgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count) &
+                bind(c, name = 'hipsolverZgesvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgesvdj_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgesvdStridedBatched_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(c_int), value :: econ
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: S
-            type(c_ptr), value :: U
-            integer(c_int), value :: ldu
-            type(c_ptr), value :: V
-            integer(c_int), value :: ldv
             type(c_ptr), value :: lwork
-            type(c_ptr), value :: params
-        end function hipsolverZgesvdj_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZgesvdStridedBatched_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSgesvdj(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params) &
-                bind(c, name = 'hipsolverSgesvdj')
+        function hipsolverSgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+                strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverSgesvdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgesvdj
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgesvdStridedBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(c_int), value :: econ
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
             type(c_ptr), value :: S
+            integer(c_long_long), value :: strideS
             type(c_ptr), value :: U
             integer(c_int), value :: ldu
+            integer(c_long_long), value :: strideU
             type(c_ptr), value :: V
             integer(c_int), value :: ldv
+            integer(c_long_long), value :: strideV
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            type(c_ptr), value :: params
-        end function hipsolverSgesvdj
+            integer(c_int), value :: batch_count
+        end function hipsolverSgesvdStridedBatched
     end interface
-
+    
     interface
-        function hipsolverDgesvdj(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params) &
-                bind(c, name = 'hipsolverDgesvdj')
+        function hipsolverDgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+                strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverDgesvdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgesvdj
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgesvdStridedBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(c_int), value :: econ
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
             type(c_ptr), value :: S
+            integer(c_long_long), value :: strideS
             type(c_ptr), value :: U
             integer(c_int), value :: ldu
+            integer(c_long_long), value :: strideU
             type(c_ptr), value :: V
             integer(c_int), value :: ldv
+            integer(c_long_long), value :: strideV
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            type(c_ptr), value :: params
-        end function hipsolverDgesvdj
+            integer(c_int), value :: batch_count
+        end function hipsolverDgesvdStridedBatched
     end interface
-
+    
     interface
-        function hipsolverCgesvdj(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params) &
-                bind(c, name = 'hipsolverCgesvdj')
+        function hipsolverCgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+                strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverCgesvdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgesvdj
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgesvdStridedBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(c_int), value :: econ
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: S
+            integer(c_long_long), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_long_long), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_long_long), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgesvdStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+                strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverZgesvdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgesvdStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: S
+            integer(c_long_long), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_long_long), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_long_long), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgesvdStridedBatched
+    end interface
+    
+    ! ******************** GESVDJ ********************
+    interface
+        function hipsolverSgesvdj_bufferSize(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params) &
+                bind(c, name = 'hipsolverSgesvdj_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgesvdj_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: econ
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            type(c_ptr), value :: params
+        end function hipsolverSgesvdj_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgesvdj_bufferSize(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params) &
+                bind(c, name = 'hipsolverDgesvdj_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgesvdj_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: econ
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            type(c_ptr), value :: params
+        end function hipsolverDgesvdj_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgesvdj_bufferSize(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params) &
+                bind(c, name = 'hipsolverCgesvdj_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgesvdj_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: econ
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            type(c_ptr), value :: params
+        end function hipsolverCgesvdj_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgesvdj_bufferSize(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params) &
+                bind(c, name = 'hipsolverZgesvdj_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgesvdj_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: econ
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            type(c_ptr), value :: params
+        end function hipsolverZgesvdj_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgesvdj(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params) &
+                bind(c, name = 'hipsolverSgesvdj')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgesvdj
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: econ
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            type(c_ptr), value :: params
+        end function hipsolverSgesvdj
+    end interface
+
+    interface
+        function hipsolverDgesvdj(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params) &
+                bind(c, name = 'hipsolverDgesvdj')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgesvdj
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: econ
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            type(c_ptr), value :: params
+        end function hipsolverDgesvdj
+    end interface
+
+    interface
+        function hipsolverCgesvdj(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params) &
+                bind(c, name = 'hipsolverCgesvdj')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgesvdj
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: econ
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
@@ -2491,2078 +3164,3407 @@ module hipsolver
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgetrf
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgetrf
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverZgetrf
+    end interface
+
+    ! ******************** GETRF_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSgetrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                bind(c, name = 'hipsolverSgetrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgetrfStridedBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                bind(c, name = 'hipsolverDgetrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgetrfStridedBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                bind(c, name = 'hipsolverCgetrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgetrfStridedBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                bind(c, name = 'hipsolverZgetrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgetrfStridedBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgetrfStridedBatched(handle, m, n, A, lda, strideA, work, lwork, ipiv, &
+                strideP, info, batch_count) &
+                bind(c, name = 'hipsolverSgetrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgetrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDgetrfStridedBatched(handle, m, n, A, lda, strideA, work, lwork, ipiv, &
+                strideP, info, batch_count) &
+                bind(c, name = 'hipsolverDgetrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgetrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCgetrfStridedBatched(handle, m, n, A, lda, strideA, work, lwork, ipiv, &
+                strideP, info, batch_count) &
+                bind(c, name = 'hipsolverCgetrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgetrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgetrfStridedBatched(handle, m, n, A, lda, strideA, work, lwork, ipiv, &
+                strideP, info, batch_count) &
+                bind(c, name = 'hipsolverZgetrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgetrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrfStridedBatched
+    end interface
+    
+    ! ******************** GETRS ********************
+    interface
+        function hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                bind(c, name = 'hipsolverSgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgetrs_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverSgetrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                bind(c, name = 'hipsolverDgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgetrs_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverDgetrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                bind(c, name = 'hipsolverCgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgetrs_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverCgetrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                bind(c, name = 'hipsolverZgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgetrs_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverZgetrs_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                bind(c, name = 'hipsolverSgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgetrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSgetrs
+    end interface
+    
+    interface
+        function hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                bind(c, name = 'hipsolverDgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgetrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDgetrs
+    end interface
+    
+    interface
+        function hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                bind(c, name = 'hipsolverCgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgetrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCgetrs
+    end interface
+    
+    interface
+        function hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                bind(c, name = 'hipsolverZgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgetrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZgetrs
+    end interface
+
+    ! ******************** GETRS_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSgetrsStridedBatched_bufferSize(handle, trans, n, nrhs, A, lda, strideA, &
+                ipiv, strideP, B, ldb, strideB, lwork, batch_count) &
+                bind(c, name = 'hipsolverSgetrsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgetrsStridedBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrsStridedBatched_bufferSize(handle, trans, n, nrhs, A, lda, strideA, &
+                ipiv, strideP, B, ldb, strideB, lwork, batch_count) &
+                bind(c, name = 'hipsolverDgetrsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgetrsStridedBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrsStridedBatched_bufferSize(handle, trans, n, nrhs, A, lda, strideA, &
+                ipiv, strideP, B, ldb, strideB, lwork, batch_count) &
+                bind(c, name = 'hipsolverCgetrsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgetrsStridedBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrsStridedBatched_bufferSize(handle, trans, n, nrhs, A, lda, strideA, &
+                ipiv, strideP, B, ldb, strideB, lwork, batch_count) &
+                bind(c, name = 'hipsolverZgetrsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgetrsStridedBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgetrsStridedBatched(handle, trans, n, nrhs, A, lda, strideA, ipiv, &
+                strideP, B, ldb, strideB, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverSgetrsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgetrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrsStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDgetrsStridedBatched(handle, trans, n, nrhs, A, lda, strideA, ipiv, &
+                strideP, B, ldb, strideB, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverDgetrsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgetrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrsStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCgetrsStridedBatched(handle, trans, n, nrhs, A, lda, strideA, ipiv, &
+                strideP, B, ldb, strideB, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverCgetrsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgetrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrsStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgetrsStridedBatched(handle, trans, n, nrhs, A, lda, strideA, ipiv, &
+                strideP, B, ldb, strideB, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverZgetrsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgetrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrsStridedBatched
+    end interface
+    
+    ! ******************** POTRF ********************
+    interface
+        function hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                bind(c, name = 'hipsolverSpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrf_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverSpotrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                bind(c, name = 'hipsolverDpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrf_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverDpotrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                bind(c, name = 'hipsolverCpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrf_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverCpotrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                bind(c, name = 'hipsolverZpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrf_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverZpotrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                bind(c, name = 'hipsolverSpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSpotrf
+    end interface
+
+    interface
+        function hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                bind(c, name = 'hipsolverDpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDpotrf
+    end interface
+
+    interface
+        function hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                bind(c, name = 'hipsolverCpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCpotrf
+    end interface
+
+    interface
+        function hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                bind(c, name = 'hipsolverZpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZpotrf
+    end interface
+    
+    ! ******************** POTRF_BATCHED ********************
+    interface
+        function hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                bind(c, name = 'hipsolverSpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrfBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                bind(c, name = 'hipsolverDpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrfBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                bind(c, name = 'hipsolverCpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrfBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                bind(c, name = 'hipsolverZpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrfBatched_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverSpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfBatched
+    end interface
+    
+    interface
+        function hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverDpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfBatched
+    end interface
+    
+    interface
+        function hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverCpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfBatched
+    end interface
+    
+    interface
+        function hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverZpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfBatched
+    end interface
+
+    ! ******************** POTRI ********************
+    interface
+        function hipsolverSpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
+                bind(c, name = 'hipsolverSpotri_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotri_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverSpotri_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
+                bind(c, name = 'hipsolverDpotri_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotri_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverDpotri_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
+                bind(c, name = 'hipsolverCpotri_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotri_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverCpotri_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
+                bind(c, name = 'hipsolverZpotri_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotri_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverZpotri_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotri(handle, uplo, n, A, lda, work, lwork, info) &
+                bind(c, name = 'hipsolverSpotri')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotri
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSpotri
+    end interface
+
+    interface
+        function hipsolverDpotri(handle, uplo, n, A, lda, work, lwork, info) &
+                bind(c, name = 'hipsolverDpotri')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotri
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDpotri
+    end interface
+
+    interface
+        function hipsolverCpotri(handle, uplo, n, A, lda, work, lwork, info) &
+                bind(c, name = 'hipsolverCpotri')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotri
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCpotri
+    end interface
+
+    interface
+        function hipsolverZpotri(handle, uplo, n, A, lda, work, lwork, info) &
+                bind(c, name = 'hipsolverZpotri')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotri
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZpotri
+    end interface
+
+    ! ******************** POTRS ********************
+    interface
+        function hipsolverSpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+                bind(c, name = 'hipsolverSpotrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrs_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverSpotrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+                bind(c, name = 'hipsolverDpotrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrs_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverDpotrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+                bind(c, name = 'hipsolverCpotrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrs_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverCpotrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+                bind(c, name = 'hipsolverZpotrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrs_bufferSize
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverZpotrs_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+                bind(c, name = 'hipsolverSpotrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSpotrs
+    end interface
+
+    interface
+        function hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+                bind(c, name = 'hipsolverDpotrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDpotrs
+    end interface
+
+    interface
+        function hipsolverCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+                bind(c, name = 'hipsolverCpotrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCpotrs
+    end interface
+
+    interface
+        function hipsolverZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+                bind(c, name = 'hipsolverZpotrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrs
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: info
-        end function hipsolverZgetrf
+        end function hipsolverZpotrs
     end interface
 
-    ! ******************** GETRS ********************
+    ! ******************** POTRS_BATCHED ********************
     interface
-        function hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
-                bind(c, name = 'hipsolverSgetrs_bufferSize')
+        function hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+                bind(c, name = 'hipsolverSpotrsBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgetrs_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrsBatched_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverSgetrs_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrsBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
-                bind(c, name = 'hipsolverDgetrs_bufferSize')
+        function hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+                bind(c, name = 'hipsolverDpotrsBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgetrs_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrsBatched_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverDgetrs_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrsBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
-                bind(c, name = 'hipsolverCgetrs_bufferSize')
+        function hipsolverCpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+                bind(c, name = 'hipsolverCpotrsBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgetrs_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrsBatched_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverCgetrs_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrsBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
-                bind(c, name = 'hipsolverZgetrs_bufferSize')
+        function hipsolverZpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+                bind(c, name = 'hipsolverZpotrsBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgetrs_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrsBatched_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverZgetrs_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrsBatched_bufferSize
     end interface
 
     interface
-        function hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
-                bind(c, name = 'hipsolverSgetrs')
+        function hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverSpotrsBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSgetrs
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrsBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSgetrs
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrsBatched
     end interface
-    
+
     interface
-        function hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
-                bind(c, name = 'hipsolverDgetrs')
+        function hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverDpotrsBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDgetrs
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrsBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDgetrs
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrsBatched
     end interface
-    
+
     interface
-        function hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
-                bind(c, name = 'hipsolverCgetrs')
+        function hipsolverCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverCpotrsBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCgetrs
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrsBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCgetrs
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrsBatched
     end interface
-    
+
     interface
-        function hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
-                bind(c, name = 'hipsolverZgetrs')
+        function hipsolverZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverZpotrsBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZgetrs
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrsBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZgetrs
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrsBatched
     end interface
 
-    ! ******************** POTRF ********************
+    ! ******************** SYEVD/HEEVD ********************
     interface
-        function hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
-                bind(c, name = 'hipsolverSpotrf_bufferSize')
+        function hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork) &
+                bind(c, name = 'hipsolverSsyevd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrf_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevd_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverSpotrf_bufferSize
+        end function hipsolverSsyevd_bufferSize
     end interface
     
     interface
-        function hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
-                bind(c, name = 'hipsolverDpotrf_bufferSize')
+        function hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork) &
+                bind(c, name = 'hipsolverDsyevd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrf_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevd_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverDpotrf_bufferSize
+        end function hipsolverDsyevd_bufferSize
     end interface
     
     interface
-        function hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
-                bind(c, name = 'hipsolverCpotrf_bufferSize')
+        function hipsolverCheevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork) &
+                bind(c, name = 'hipsolverCheevd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrf_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevd_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverCpotrf_bufferSize
+        end function hipsolverCheevd_bufferSize
     end interface
     
     interface
-        function hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
-                bind(c, name = 'hipsolverZpotrf_bufferSize')
+        function hipsolverZheevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork) &
+                bind(c, name = 'hipsolverZheevd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrf_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevd_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverZpotrf_bufferSize
+        end function hipsolverZheevd_bufferSize
     end interface
 
     interface
-        function hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info) &
-                bind(c, name = 'hipsolverSpotrf')
+        function hipsolverSsyevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info) &
+                bind(c, name = 'hipsolverSsyevd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrf
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevd
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSpotrf
+        end function hipsolverSsyevd
     end interface
 
     interface
-        function hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info) &
-                bind(c, name = 'hipsolverDpotrf')
+        function hipsolverDsyevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info) &
+                bind(c, name = 'hipsolverDsyevd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrf
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevd
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDpotrf
+        end function hipsolverDsyevd
     end interface
 
     interface
-        function hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info) &
-                bind(c, name = 'hipsolverCpotrf')
+        function hipsolverCheevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info) &
+                bind(c, name = 'hipsolverCheevd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrf
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevd
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCpotrf
+        end function hipsolverCheevd
     end interface
 
     interface
-        function hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info) &
-                bind(c, name = 'hipsolverZpotrf')
+        function hipsolverZheevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info) &
+                bind(c, name = 'hipsolverZheevd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrf
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevd
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZpotrf
+        end function hipsolverZheevd
     end interface
-    
-    ! ******************** POTRF_BATCHED ********************
+
+    ! ******************** SYEVD_STRIDED_BATCHED/HEEVD_STRIDED_BATCHED ********************
     interface
-        function hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
-                bind(c, name = 'hipsolverSpotrfBatched_bufferSize')
+        function hipsolverSsyevdStridedBatched_bufferSize(handle, jobz, uplo, n, A, lda, strideA, &
+                W, strideW, lwork, batch_count) &
+                bind(c, name = 'hipsolverSsyevdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrfBatched_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevdStridedBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: lwork
             integer(c_int), value :: batch_count
-        end function hipsolverSpotrfBatched_bufferSize
+        end function hipsolverSsyevdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
-                bind(c, name = 'hipsolverDpotrfBatched_bufferSize')
+        function hipsolverDsyevdStridedBatched_bufferSize(handle, jobz, uplo, n, A, lda, strideA, &
+                W, strideW, lwork, batch_count) &
+                bind(c, name = 'hipsolverDsyevdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrfBatched_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevdStridedBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: lwork
             integer(c_int), value :: batch_count
-        end function hipsolverDpotrfBatched_bufferSize
+        end function hipsolverDsyevdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
-                bind(c, name = 'hipsolverCpotrfBatched_bufferSize')
+        function hipsolverCheevdStridedBatched_bufferSize(handle, jobz, uplo, n, A, lda, strideA, &
+                W, strideW, lwork, batch_count) &
+                bind(c, name = 'hipsolverCheevdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrfBatched_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevdStridedBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: lwork
             integer(c_int), value :: batch_count
-        end function hipsolverCpotrfBatched_bufferSize
+        end function hipsolverCheevdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
-                bind(c, name = 'hipsolverZpotrfBatched_bufferSize')
+        function hipsolverZheevdStridedBatched_bufferSize(handle, jobz, uplo, n, A, lda, strideA, &
+                W, strideW, lwork, batch_count) &
+                bind(c, name = 'hipsolverZheevdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrfBatched_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevdStridedBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: lwork
             integer(c_int), value :: batch_count
-        end function hipsolverZpotrfBatched_bufferSize
+        end function hipsolverZheevdStridedBatched_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
-                bind(c, name = 'hipsolverSpotrfBatched')
+        function hipsolverSsyevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, W, strideW, &
+                work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverSsyevdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrfBatched
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevdStridedBatched
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
             integer(c_int), value :: batch_count
-        end function hipsolverSpotrfBatched
+        end function hipsolverSsyevdStridedBatched
     end interface
     
     interface
-        function hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
-                bind(c, name = 'hipsolverDpotrfBatched')
+        function hipsolverDsyevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, W, strideW, &
+                work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverDsyevdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrfBatched
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevdStridedBatched
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
             integer(c_int), value :: batch_count
-        end function hipsolverDpotrfBatched
+        end function hipsolverDsyevdStridedBatched
     end interface
     
     interface
-        function hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
-                bind(c, name = 'hipsolverCpotrfBatched')
+        function hipsolverCheevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, W, strideW, &
+                work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverCheevdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrfBatched
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevdStridedBatched
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
             integer(c_int), value :: batch_count
-        end function hipsolverCpotrfBatched
+        end function hipsolverCheevdStridedBatched
     end interface
     
     interface
-        function hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
-                bind(c, name = 'hipsolverZpotrfBatched')
+        function hipsolverZheevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, W, strideW, &
+                work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverZheevdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrfBatched
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevdStridedBatched
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
             integer(c_int), value :: batch_count
-        end function hipsolverZpotrfBatched
+        end function hipsolverZheevdStridedBatched
     end interface
-
-    ! ******************** POTRI ********************
+    
+    ! ******************** SYEVJ/HEEVJ ********************
     interface
-        function hipsolverSpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
-                bind(c, name = 'hipsolverSpotri_bufferSize')
+        function hipsolverSsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params) &
+                bind(c, name = 'hipsolverSsyevj_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotri_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevj_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverSpotri_bufferSize
+            type(c_ptr), value :: params
+        end function hipsolverSsyevj_bufferSize
     end interface
     
     interface
-        function hipsolverDpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
-                bind(c, name = 'hipsolverDpotri_bufferSize')
+        function hipsolverDsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params) &
+                bind(c, name = 'hipsolverDsyevj_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotri_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevj_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverDpotri_bufferSize
+            type(c_ptr), value :: params
+        end function hipsolverDsyevj_bufferSize
     end interface
     
     interface
-        function hipsolverCpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
-                bind(c, name = 'hipsolverCpotri_bufferSize')
+        function hipsolverCheevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params) &
+                bind(c, name = 'hipsolverCheevj_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotri_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevj_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverCpotri_bufferSize
+            type(c_ptr), value :: params
+        end function hipsolverCheevj_bufferSize
     end interface
     
     interface
-        function hipsolverZpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
-                bind(c, name = 'hipsolverZpotri_bufferSize')
+        function hipsolverZheevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params) &
+                bind(c, name = 'hipsolverZheevj_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotri_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevj_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverZpotri_bufferSize
+            type(c_ptr), value :: params
+        end function hipsolverZheevj_bufferSize
     end interface
 
     interface
-        function hipsolverSpotri(handle, uplo, n, A, lda, work, lwork, info) &
-                bind(c, name = 'hipsolverSpotri')
+        function hipsolverSsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params) &
+                bind(c, name = 'hipsolverSsyevj')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotri
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevj
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSpotri
+            type(c_ptr), value :: params
+        end function hipsolverSsyevj
     end interface
 
     interface
-        function hipsolverDpotri(handle, uplo, n, A, lda, work, lwork, info) &
-                bind(c, name = 'hipsolverDpotri')
+        function hipsolverDsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params) &
+                bind(c, name = 'hipsolverDsyevj')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotri
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevj
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDpotri
+            type(c_ptr), value :: params
+        end function hipsolverDsyevj
     end interface
 
     interface
-        function hipsolverCpotri(handle, uplo, n, A, lda, work, lwork, info) &
-                bind(c, name = 'hipsolverCpotri')
+        function hipsolverCheevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params) &
+                bind(c, name = 'hipsolverCheevj')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotri
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevj
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCpotri
+            type(c_ptr), value :: params
+        end function hipsolverCheevj
     end interface
 
     interface
-        function hipsolverZpotri(handle, uplo, n, A, lda, work, lwork, info) &
-                bind(c, name = 'hipsolverZpotri')
+        function hipsolverZheevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params) &
+                bind(c, name = 'hipsolverZheevj')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotri
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevj
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZpotri
+            type(c_ptr), value :: params
+        end function hipsolverZheevj
     end interface
 
-    ! ******************** POTRS ********************
+    ! ******************** SYEVJ_BATCHED/HEEVJ_BATCHED ********************
     interface
-        function hipsolverSpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
-                bind(c, name = 'hipsolverSpotrs_bufferSize')
+        function hipsolverSsyevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count) &
+                bind(c, name = 'hipsolverSsyevjBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrs_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevjBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverSpotrs_bufferSize
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverSsyevjBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
-                bind(c, name = 'hipsolverDpotrs_bufferSize')
+        function hipsolverDsyevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count) &
+                bind(c, name = 'hipsolverDsyevjBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrs_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevjBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverDpotrs_bufferSize
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverDsyevjBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
-                bind(c, name = 'hipsolverCpotrs_bufferSize')
+        function hipsolverCheevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count) &
+                bind(c, name = 'hipsolverCheevjBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrs_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevjBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverCpotrs_bufferSize
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverCheevjBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
-                bind(c, name = 'hipsolverZpotrs_bufferSize')
+        function hipsolverZheevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count) &
+                bind(c, name = 'hipsolverZheevjBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrs_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevjBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverZpotrs_bufferSize
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverZheevjBatched_bufferSize
     end interface
 
     interface
-        function hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
-                bind(c, name = 'hipsolverSpotrs')
+        function hipsolverSsyevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batch_count) &
+                bind(c, name = 'hipsolverSsyevjBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrs
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevjBatched
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSpotrs
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverSsyevjBatched
     end interface
 
     interface
-        function hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
-                bind(c, name = 'hipsolverDpotrs')
+        function hipsolverDsyevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batch_count) &
+                bind(c, name = 'hipsolverDsyevjBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrs
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevjBatched
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDpotrs
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverDsyevjBatched
     end interface
 
     interface
-        function hipsolverCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
-                bind(c, name = 'hipsolverCpotrs')
+        function hipsolverCheevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batch_count) &
+                bind(c, name = 'hipsolverCheevjBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrs
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevjBatched
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCpotrs
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverCheevjBatched
     end interface
 
     interface
-        function hipsolverZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
-                bind(c, name = 'hipsolverZpotrs')
+        function hipsolverZheevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batch_count) &
+                bind(c, name = 'hipsolverZheevjBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrs
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevjBatched
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZpotrs
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverZheevjBatched
     end interface
 
-    ! ******************** POTRS_BATCHED ********************
+    ! ******************** SYGVD/HEGVD ********************
     interface
-        function hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
-                bind(c, name = 'hipsolverSpotrsBatched_bufferSize')
+        function hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork) &
+                bind(c, name = 'hipsolverSsygvd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrsBatched_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsygvd_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-            integer(c_int), value :: batch_count
-        end function hipsolverSpotrsBatched_bufferSize
+        end function hipsolverSsygvd_bufferSize
     end interface
     
     interface
-        function hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
-                bind(c, name = 'hipsolverDpotrsBatched_bufferSize')
+        function hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork) &
+                bind(c, name = 'hipsolverDsygvd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrsBatched_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsygvd_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-            integer(c_int), value :: batch_count
-        end function hipsolverDpotrsBatched_bufferSize
+        end function hipsolverDsygvd_bufferSize
     end interface
     
     interface
-        function hipsolverCpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
-                bind(c, name = 'hipsolverCpotrsBatched_bufferSize')
+        function hipsolverChegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork) &
+                bind(c, name = 'hipsolverChegvd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrsBatched_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChegvd_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-            integer(c_int), value :: batch_count
-        end function hipsolverCpotrsBatched_bufferSize
+        end function hipsolverChegvd_bufferSize
     end interface
     
     interface
-        function hipsolverZpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
-                bind(c, name = 'hipsolverZpotrsBatched_bufferSize')
+        function hipsolverZhegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork) &
+                bind(c, name = 'hipsolverZhegvd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrsBatched_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhegvd_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-            integer(c_int), value :: batch_count
-        end function hipsolverZpotrsBatched_bufferSize
+        end function hipsolverZhegvd_bufferSize
     end interface
 
     interface
-        function hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
-                bind(c, name = 'hipsolverSpotrsBatched')
+        function hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info) &
+                bind(c, name = 'hipsolverSsygvd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSpotrsBatched
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsygvd
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
-        end function hipsolverSpotrsBatched
+        end function hipsolverSsygvd
     end interface
 
     interface
-        function hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
-                bind(c, name = 'hipsolverDpotrsBatched')
+        function hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info) &
+                bind(c, name = 'hipsolverDsygvd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDpotrsBatched
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsygvd
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
-        end function hipsolverDpotrsBatched
+        end function hipsolverDsygvd
     end interface
 
     interface
-        function hipsolverCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
-                bind(c, name = 'hipsolverCpotrsBatched')
+        function hipsolverChegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info) &
+                bind(c, name = 'hipsolverChegvd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCpotrsBatched
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChegvd
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
-        end function hipsolverCpotrsBatched
+        end function hipsolverChegvd
     end interface
 
     interface
-        function hipsolverZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
-                bind(c, name = 'hipsolverZpotrsBatched')
+        function hipsolverZhegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info) &
+                bind(c, name = 'hipsolverZhegvd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZpotrsBatched
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhegvd
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
-        end function hipsolverZpotrsBatched
+        end function hipsolverZhegvd
     end interface
 
-    ! ******************** SYEVD/HEEVD ********************
+    ! ******************** SYGVD_STRIDED_BATCHED/HEGVD_STRIDED_BATCHED ********************
     interface
-        function hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork) &
-                bind(c, name = 'hipsolverSsyevd_bufferSize')
+        function hipsolverSsygvdStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, &
+                strideA, B, ldb, strideB, W, strideW, lwork, batch_count) &
+                bind(c, name = 'hipsolverSsygvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsygvdStridedBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: lwork
-        end function hipsolverSsyevd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSsygvdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork) &
-                bind(c, name = 'hipsolverDsyevd_bufferSize')
+        function hipsolverDsygvdStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, &
+                strideA, B, ldb, strideB, W, strideW, lwork, batch_count) &
+                bind(c, name = 'hipsolverDsygvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsygvdStridedBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: lwork
-        end function hipsolverDsyevd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDsygvdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCheevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork) &
-                bind(c, name = 'hipsolverCheevd_bufferSize')
+        function hipsolverChegvdStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, &
+                strideA, B, ldb, strideB, W, strideW, lwork, batch_count) &
+                bind(c, name = 'hipsolverChegvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChegvdStridedBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: lwork
-        end function hipsolverCheevd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverChegvdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZheevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork) &
-                bind(c, name = 'hipsolverZheevd_bufferSize')
+        function hipsolverZhegvdStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, &
+                strideA, B, ldb, strideB, W, strideW, lwork, batch_count) &
+                bind(c, name = 'hipsolverZhegvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhegvdStridedBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: lwork
-        end function hipsolverZheevd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZhegvdStridedBatched_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSsyevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info) &
-                bind(c, name = 'hipsolverSsyevd')
+        function hipsolverSsygvdStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+                ldb, strideB, W, strideW, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverSsygvdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevd
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsygvdStridedBatched
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSsyevd
+            integer(c_int), value :: batch_count
+        end function hipsolverSsygvdStridedBatched
     end interface
-
+    
     interface
-        function hipsolverDsyevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info) &
-                bind(c, name = 'hipsolverDsyevd')
+        function hipsolverDsygvdStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+                ldb, strideB, W, strideW, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverDsygvdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevd
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsygvdStridedBatched
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDsyevd
+            integer(c_int), value :: batch_count
+        end function hipsolverDsygvdStridedBatched
     end interface
-
+    
     interface
-        function hipsolverCheevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info) &
-                bind(c, name = 'hipsolverCheevd')
+        function hipsolverChegvdStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+                ldb, strideB, W, strideW, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverChegvdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevd
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChegvdStridedBatched
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCheevd
+            integer(c_int), value :: batch_count
+        end function hipsolverChegvdStridedBatched
     end interface
-
+    
     interface
-        function hipsolverZheevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info) &
-                bind(c, name = 'hipsolverZheevd')
+        function hipsolverZhegvdStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+                ldb, strideB, W, strideW, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverZhegvdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevd
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhegvdStridedBatched
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: W
+            integer(c_long_long), value :: strideW
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZheevd
+            integer(c_int), value :: batch_count
+        end function hipsolverZhegvdStridedBatched
     end interface
-
-    ! ******************** SYEVJ/HEEVJ ********************
+    
+    ! ******************** SYGVJ/HEGVJ ********************
     interface
-        function hipsolverSsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params) &
-                bind(c, name = 'hipsolverSsyevj_bufferSize')
+        function hipsolverSsygvj_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params) &
+                bind(c, name = 'hipsolverSsygvj_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevj_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsygvj_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: W
             type(c_ptr), value :: lwork
             type(c_ptr), value :: params
-        end function hipsolverSsyevj_bufferSize
+        end function hipsolverSsygvj_bufferSize
     end interface
     
     interface
-        function hipsolverDsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params) &
-                bind(c, name = 'hipsolverDsyevj_bufferSize')
+        function hipsolverDsygvj_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params) &
+                bind(c, name = 'hipsolverDsygvj_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevj_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsygvj_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: W
             type(c_ptr), value :: lwork
             type(c_ptr), value :: params
-        end function hipsolverDsyevj_bufferSize
+        end function hipsolverDsygvj_bufferSize
     end interface
     
     interface
-        function hipsolverCheevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params) &
-                bind(c, name = 'hipsolverCheevj_bufferSize')
+        function hipsolverChegvj_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params) &
+                bind(c, name = 'hipsolverChegvj_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevj_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChegvj_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: W
             type(c_ptr), value :: lwork
             type(c_ptr), value :: params
-        end function hipsolverCheevj_bufferSize
+        end function hipsolverChegvj_bufferSize
     end interface
     
     interface
-        function hipsolverZheevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params) &
-                bind(c, name = 'hipsolverZheevj_bufferSize')
+        function hipsolverZhegvj_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params) &
+                bind(c, name = 'hipsolverZhegvj_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevj_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhegvj_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: W
             type(c_ptr), value :: lwork
             type(c_ptr), value :: params
-        end function hipsolverZheevj_bufferSize
+        end function hipsolverZhegvj_bufferSize
     end interface
 
     interface
-        function hipsolverSsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params) &
-                bind(c, name = 'hipsolverSsyevj')
+        function hipsolverSsygvj(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params) &
+                bind(c, name = 'hipsolverSsygvj')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevj
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsygvj
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
             type(c_ptr), value :: params
-        end function hipsolverSsyevj
+        end function hipsolverSsygvj
     end interface
 
     interface
-        function hipsolverDsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params) &
-                bind(c, name = 'hipsolverDsyevj')
+        function hipsolverDsygvj(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params) &
+                bind(c, name = 'hipsolverDsygvj')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevj
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsygvj
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
             type(c_ptr), value :: params
-        end function hipsolverDsyevj
+        end function hipsolverDsygvj
     end interface
 
     interface
-        function hipsolverCheevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params) &
-                bind(c, name = 'hipsolverCheevj')
+        function hipsolverChegvj(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params) &
+                bind(c, name = 'hipsolverChegvj')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevj
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChegvj
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
             type(c_ptr), value :: params
-        end function hipsolverCheevj
+        end function hipsolverChegvj
     end interface
 
     interface
-        function hipsolverZheevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params) &
-                bind(c, name = 'hipsolverZheevj')
+        function hipsolverZhegvj(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params) &
+                bind(c, name = 'hipsolverZhegvj')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevj
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhegvj
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
             integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
             type(c_ptr), value :: params
-        end function hipsolverZheevj
+        end function hipsolverZhegvj
     end interface
 
-    ! ******************** SYEVJ_BATCHED/HEEVJ_BATCHED ********************
+    ! ******************** SYTRD/HETRD ********************
     interface
-        function hipsolverSsyevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count) &
-                bind(c, name = 'hipsolverSsyevjBatched_bufferSize')
+        function hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+                bind(c, name = 'hipsolverSsytrd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevjBatched_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrd_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: W
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-            type(c_ptr), value :: params
-            integer(c_int), value :: batch_count
-        end function hipsolverSsyevjBatched_bufferSize
+        end function hipsolverSsytrd_bufferSize
     end interface
     
     interface
-        function hipsolverDsyevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count) &
-                bind(c, name = 'hipsolverDsyevjBatched_bufferSize')
+        function hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+                bind(c, name = 'hipsolverDsytrd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevjBatched_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrd_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: W
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-            type(c_ptr), value :: params
-            integer(c_int), value :: batch_count
-        end function hipsolverDsyevjBatched_bufferSize
+        end function hipsolverDsytrd_bufferSize
     end interface
     
     interface
-        function hipsolverCheevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count) &
-                bind(c, name = 'hipsolverCheevjBatched_bufferSize')
+        function hipsolverChetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+                bind(c, name = 'hipsolverChetrd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevjBatched_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChetrd_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: W
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-            type(c_ptr), value :: params
-            integer(c_int), value :: batch_count
-        end function hipsolverCheevjBatched_bufferSize
+        end function hipsolverChetrd_bufferSize
     end interface
     
     interface
-        function hipsolverZheevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count) &
-                bind(c, name = 'hipsolverZheevjBatched_bufferSize')
+        function hipsolverZhetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+                bind(c, name = 'hipsolverZhetrd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevjBatched_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhetrd_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: W
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-            type(c_ptr), value :: params
-            integer(c_int), value :: batch_count
-        end function hipsolverZheevjBatched_bufferSize
+        end function hipsolverZhetrd_bufferSize
     end interface
 
     interface
-        function hipsolverSsyevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batch_count) &
-                bind(c, name = 'hipsolverSsyevjBatched')
+        function hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+                bind(c, name = 'hipsolverSsytrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsyevjBatched
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrd
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: W
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            type(c_ptr), value :: params
-            integer(c_int), value :: batch_count
-        end function hipsolverSsyevjBatched
+        end function hipsolverSsytrd
     end interface
 
     interface
-        function hipsolverDsyevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batch_count) &
-                bind(c, name = 'hipsolverDsyevjBatched')
+        function hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+                bind(c, name = 'hipsolverDsytrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsyevjBatched
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrd
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: W
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            type(c_ptr), value :: params
-            integer(c_int), value :: batch_count
-        end function hipsolverDsyevjBatched
+        end function hipsolverDsytrd
     end interface
 
     interface
-        function hipsolverCheevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batch_count) &
-                bind(c, name = 'hipsolverCheevjBatched')
+        function hipsolverChetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+                bind(c, name = 'hipsolverChetrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCheevjBatched
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChetrd
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: W
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            type(c_ptr), value :: params
-            integer(c_int), value :: batch_count
-        end function hipsolverCheevjBatched
+        end function hipsolverChetrd
     end interface
 
     interface
-        function hipsolverZheevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batch_count) &
-                bind(c, name = 'hipsolverZheevjBatched')
+        function hipsolverZhetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+                bind(c, name = 'hipsolverZhetrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZheevjBatched
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhetrd
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: W
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            type(c_ptr), value :: params
-            integer(c_int), value :: batch_count
-        end function hipsolverZheevjBatched
+        end function hipsolverZhetrd
     end interface
 
-    ! ******************** SYGVD/HEGVD ********************
+    ! ******************** SYTRF ********************
     interface
-        function hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork) &
-                bind(c, name = 'hipsolverSsygvd_bufferSize')
+        function hipsolverSsytrf_bufferSize(handle, n, A, lda, lwork) &
+                bind(c, name = 'hipsolverSsytrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsygvd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrf_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverSsygvd_bufferSize
+        end function hipsolverSsytrf_bufferSize
     end interface
     
     interface
-        function hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork) &
-                bind(c, name = 'hipsolverDsygvd_bufferSize')
+        function hipsolverDsytrf_bufferSize(handle, n, A, lda, lwork) &
+                bind(c, name = 'hipsolverDsytrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsygvd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrf_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverDsygvd_bufferSize
+        end function hipsolverDsytrf_bufferSize
     end interface
     
     interface
-        function hipsolverChegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork) &
-                bind(c, name = 'hipsolverChegvd_bufferSize')
+        function hipsolverCsytrf_bufferSize(handle, n, A, lda, lwork) &
+                bind(c, name = 'hipsolverCsytrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChegvd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCsytrf_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverChegvd_bufferSize
+        end function hipsolverCsytrf_bufferSize
     end interface
     
     interface
-        function hipsolverZhegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork) &
-                bind(c, name = 'hipsolverZhegvd_bufferSize')
+        function hipsolverZsytrf_bufferSize(handle, n, A, lda, lwork) &
+                bind(c, name = 'hipsolverZsytrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhegvd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZsytrf_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverZhegvd_bufferSize
+        end function hipsolverZsytrf_bufferSize
     end interface
 
     interface
-        function hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info) &
-                bind(c, name = 'hipsolverSsygvd')
+        function hipsolverSsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info) &
+                bind(c, name = 'hipsolverSsytrf')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsygvd
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrf
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: W
+            type(c_ptr), value :: ipiv
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSsygvd
+        end function hipsolverSsytrf
     end interface
 
     interface
-        function hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info) &
-                bind(c, name = 'hipsolverDsygvd')
+        function hipsolverDsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info) &
+                bind(c, name = 'hipsolverDsytrf')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsygvd
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrf
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: W
+            type(c_ptr), value :: ipiv
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDsygvd
+        end function hipsolverDsytrf
     end interface
 
     interface
-        function hipsolverChegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info) &
-                bind(c, name = 'hipsolverChegvd')
+        function hipsolverCsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info) &
+                bind(c, name = 'hipsolverCsytrf')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChegvd
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCsytrf
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: W
+            type(c_ptr), value :: ipiv
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverChegvd
+        end function hipsolverCsytrf
     end interface
 
     interface
-        function hipsolverZhegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info) &
-                bind(c, name = 'hipsolverZhegvd')
+        function hipsolverZsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info) &
+                bind(c, name = 'hipsolverZsytrf')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhegvd
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZsytrf
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: W
+            type(c_ptr), value :: ipiv
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZhegvd
+        end function hipsolverZsytrf
     end interface
-
-    ! ******************** SYGVJ/HEGVJ ********************
+    
+    ! ******************** SYTRS ********************
     interface
-        function hipsolverSsygvj_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params) &
-                bind(c, name = 'hipsolverSsygvj_bufferSize')
+        function hipsolverSsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                bind(c, name = 'hipsolverSsytrs_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsygvj_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrs_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-            type(c_ptr), value :: params
-        end function hipsolverSsygvj_bufferSize
+        end function hipsolverSsytrs_bufferSize
     end interface
     
     interface
-        function hipsolverDsygvj_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params) &
-                bind(c, name = 'hipsolverDsygvj_bufferSize')
+        function hipsolverDsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                bind(c, name = 'hipsolverDsytrs_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsygvj_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrs_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-            type(c_ptr), value :: params
-        end function hipsolverDsygvj_bufferSize
+        end function hipsolverDsytrs_bufferSize
     end interface
     
     interface
-        function hipsolverChegvj_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params) &
-                bind(c, name = 'hipsolverChegvj_bufferSize')
+        function hipsolverCsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                bind(c, name = 'hipsolverCsytrs_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChegvj_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCsytrs_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-            type(c_ptr), value :: params
-        end function hipsolverChegvj_bufferSize
+        end function hipsolverCsytrs_bufferSize
     end interface
     
     interface
-        function hipsolverZhegvj_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params) &
-                bind(c, name = 'hipsolverZhegvj_bufferSize')
+        function hipsolverZsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                bind(c, name = 'hipsolverZsytrs_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhegvj_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZsytrs_bufferSize
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-            type(c_ptr), value :: params
-        end function hipsolverZhegvj_bufferSize
+        end function hipsolverZsytrs_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSsygvj(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params) &
-                bind(c, name = 'hipsolverSsygvj')
+        function hipsolverSsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                bind(c, name = 'hipsolverSsytrs')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsygvj
-            type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrs
+            type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: W
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            type(c_ptr), value :: lwork
             type(c_ptr), value :: info
-            type(c_ptr), value :: params
-        end function hipsolverSsygvj
+        end function hipsolverSsytrs
     end interface
-
+    
     interface
-        function hipsolverDsygvj(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params) &
-                bind(c, name = 'hipsolverDsygvj')
+        function hipsolverDsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                bind(c, name = 'hipsolverDsytrs')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsygvj
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrs
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: W
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            type(c_ptr), value :: lwork
             type(c_ptr), value :: info
-            type(c_ptr), value :: params
-        end function hipsolverDsygvj
+        end function hipsolverDsytrs
     end interface
-
+    
     interface
-        function hipsolverChegvj(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params) &
-                bind(c, name = 'hipsolverChegvj')
+        function hipsolverCsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                bind(c, name = 'hipsolverCsytrs')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChegvj
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCsytrs
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: W
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            type(c_ptr), value :: lwork
             type(c_ptr), value :: info
-            type(c_ptr), value :: params
-        end function hipsolverChegvj
+        end function hipsolverCsytrs
     end interface
-
+    
     interface
-        function hipsolverZhegvj(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params) &
-                bind(c, name = 'hipsolverZhegvj')
+        function hipsolverZsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                bind(c, name = 'hipsolverZsytrs')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhegvj
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZsytrs
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: W
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            type(c_ptr), value :: lwork
             type(c_ptr), value :: info
-            type(c_ptr), value :: params
-        end function hipsolverZhegvj
+        end function hipsolverZsytrs
     end interface
-
-    ! ******************** SYTRD/HETRD ********************
+    
     interface
-        function hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
-                bind(c, name = 'hipsolverSsytrd_bufferSize')
+        function hipsolverSsytrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork, batch_count) &
+                bind(c, name = 'hipsolverSsytrsBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrsBatched_bufferSize
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverSsytrd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSsytrsBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
-                bind(c, name = 'hipsolverDsytrd_bufferSize')
+        function hipsolverDsytrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork, batch_count) &
+                bind(c, name = 'hipsolverDsytrsBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrsBatched_bufferSize
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverDsytrd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDsytrsBatched_bufferSize
     end interface
     
     interface
-        function hipsolverChetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
-                bind(c, name = 'hipsolverChetrd_bufferSize')
+        function hipsolverCsytrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork, batch_count) &
+                bind(c, name = 'hipsolverCsytrsBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChetrd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCsytrsBatched_bufferSize
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverChetrd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverCsytrsBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZhetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
-                bind(c, name = 'hipsolverZhetrd_bufferSize')
+        function hipsolverZsytrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork, batch_count) &
+                bind(c, name = 'hipsolverZsytrsBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhetrd_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZsytrsBatched_bufferSize
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverZhetrd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZsytrsBatched_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
-                bind(c, name = 'hipsolverSsytrd')
+        function hipsolverSsytrsBatched(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverSsytrsBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrd
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrsBatched
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            type(c_ptr), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSsytrd
+            integer(c_int), value :: batch_count
+        end function hipsolverSsytrsBatched
     end interface
-
+    
     interface
-        function hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
-                bind(c, name = 'hipsolverDsytrd')
+        function hipsolverDsytrsBatched(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverDsytrsBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrd
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrsBatched
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            type(c_ptr), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDsytrd
+            integer(c_int), value :: batch_count
+        end function hipsolverDsytrsBatched
     end interface
-
+    
     interface
-        function hipsolverChetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
-                bind(c, name = 'hipsolverChetrd')
+        function hipsolverCsytrsBatched(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverCsytrsBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverChetrd
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCsytrsBatched
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            type(c_ptr), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverChetrd
+            integer(c_int), value :: batch_count
+        end function hipsolverCsytrsBatched
     end interface
-
+    
     interface
-        function hipsolverZhetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
-                bind(c, name = 'hipsolverZhetrd')
+        function hipsolverZsytrsBatched(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverZsytrsBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZhetrd
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZsytrsBatched
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            type(c_ptr), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZhetrd
+            integer(c_int), value :: batch_count
+        end function hipsolverZsytrsBatched
     end interface
-
-    ! ******************** SYTRF ********************
+    
     interface
-        function hipsolverSsytrf_bufferSize(handle, n, A, lda, lwork) &
-                bind(c, name = 'hipsolverSsytrf_bufferSize')
+        function hipsolverSsytrsStridedBatched_bufferSize(handle, uplo, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                B, ldb, strideB, lwork, batch_count) &
+                bind(c, name = 'hipsolverSsytrsStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrf_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrsStridedBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: lwork
-        end function hipsolverSsytrf_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSsytrsStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDsytrf_bufferSize(handle, n, A, lda, lwork) &
-                bind(c, name = 'hipsolverDsytrf_bufferSize')
+        function hipsolverDsytrsStridedBatched_bufferSize(handle, uplo, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                B, ldb, strideB, lwork, batch_count) &
+                bind(c, name = 'hipsolverDsytrsStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrf_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrsStridedBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: lwork
-        end function hipsolverDsytrf_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDsytrsStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCsytrf_bufferSize(handle, n, A, lda, lwork) &
-                bind(c, name = 'hipsolverCsytrf_bufferSize')
+        function hipsolverCsytrsStridedBatched_bufferSize(handle, uplo, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                B, ldb, strideB, lwork, batch_count) &
+                bind(c, name = 'hipsolverCsytrsStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCsytrf_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCsytrsStridedBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: lwork
-        end function hipsolverCsytrf_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverCsytrsStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZsytrf_bufferSize(handle, n, A, lda, lwork) &
-                bind(c, name = 'hipsolverZsytrf_bufferSize')
+        function hipsolverZsytrsStridedBatched_bufferSize(handle, uplo, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                B, ldb, strideB, lwork, batch_count) &
+                bind(c, name = 'hipsolverZsytrsStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZsytrf_bufferSize
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZsytrsStridedBatched_bufferSize
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: lwork
-        end function hipsolverZsytrf_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZsytrsStridedBatched_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info) &
-                bind(c, name = 'hipsolverSsytrf')
+        function hipsolverSsytrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                B, ldb, strideB, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverSsytrsStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrf
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverSsytrsStridedBatched
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
             type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            type(c_ptr), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSsytrf
+            integer(c_int), value :: batch_count
+        end function hipsolverSsytrsStridedBatched
     end interface
-
+    
     interface
-        function hipsolverDsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info) &
-                bind(c, name = 'hipsolverDsytrf')
+        function hipsolverDsytrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                B, ldb, strideB, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverDsytrsStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrf
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverDsytrsStridedBatched
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
             type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            type(c_ptr), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDsytrf
+            integer(c_int), value :: batch_count
+        end function hipsolverDsytrsStridedBatched
     end interface
-
+    
     interface
-        function hipsolverCsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info) &
-                bind(c, name = 'hipsolverCsytrf')
+        function hipsolverCsytrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                B, ldb, strideB, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverCsytrsStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCsytrf
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverCsytrsStridedBatched
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
             type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            type(c_ptr), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCsytrf
+            integer(c_int), value :: batch_count
+        end function hipsolverCsytrsStridedBatched
     end interface
-
+    
     interface
-        function hipsolverZsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info) &
-                bind(c, name = 'hipsolverZsytrf')
+        function hipsolverZsytrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                B, ldb, strideB, work, lwork, info, batch_count) &
+                bind(c, name = 'hipsolverZsytrsStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
-            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZsytrf
+            integer(kind(HIPSOLVER_STATUS_SUCCESS)) :: hipsolverZsytrsStridedBatched
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_long_long), value :: strideA
             type(c_ptr), value :: ipiv
+            integer(c_long_long), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_long_long), value :: strideB
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            type(c_ptr), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZsytrf
+            integer(c_int), value :: batch_count
+        end function hipsolverZsytrsStridedBatched
     end interface
     
 end module hipsolver
@@ -0,0 +1,105 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Rules of the capture-safe mode of a handle, under which a call may only queue work on
+ *  the stream of the handle, so that it can be recorded into a HIP graph. They decide where the
+ *  workspace of a call comes from and which steps are refused, none of which touch the device,
+ *  so they can be tested on the host. It does not depend on the library headers, so that the
+ *  clients can include it.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace hipsolver
+{
+
+/*! \brief Steps of a call that cannot be recorded into a graph. */
+enum capture_step : int
+{
+    capture_step_allocate, // allocates or frees device or pinned host memory
+    capture_step_synchronize, // waits for the stream, e.g. to read results on the host
+    capture_step_host, // computes on the host, in the calling thread or in a host callback
+};
+
+/*! \brief Where the workspace of a call that does not provide one comes from. */
+enum workspace_source : int
+{
+    workspace_managed, // grown by hipSOLVER, as when the mode is off
+    workspace_unchanged, // the call needs no workspace, so the handle is left as it is
+    workspace_reserved, // the workspace reserved for the handle
+    workspace_refused, // the reserved workspace is too small
+};
+
+/*! \brief Capture-safe mode of a handle.
+
+    The workspace is reserved up front, either explicitly or by pinning the workspace grown by
+    the calls made before the mode was enabled. Calls that provide their own workspace use it
+    as usual; the others take the reserved workspace, and are refused if it is too small rather
+    than growing it. Steps that allocate memory, wait for the device or run on the host are
+    refused as well, except that the layouts of pointer arrays found before the mode was
+    enabled are still used. The rules apply whether or not the stream is being captured, so
+    that a call that would break a capture fails in the same way when it is tried beforehand. */
+struct capture_policy
+{
+    bool   safe     = false;
+    size_t reserved = 0; // bytes of the workspace reserved for the handle
+
+    workspace_source workspace(size_t size) const
+    {
+        if(!safe)
+            return workspace_managed;
+        if(size == 0)
+            return workspace_unchanged;
+        return size <= reserved ? workspace_reserved : workspace_refused;
+    }
+
+    bool allows(capture_step step) const
+    {
+        (void)step;
+        return !safe;
+    }
+
+    // Whether the parameters of a Jacobi solver, with room for capacity problems, can hold the
+    // results of a batch of batch_count problems
+    bool allows_results(int capacity, int batch_count) const
+    {
+        return !safe || batch_count <= capacity;
+    }
+
+    // Whether stride detection can look at a pointer array, whose layout may already be cached
+    bool allows_stride_detection(bool cached) const
+    {
+        return !safe || cached;
+    }
+
+    // Size reserved when the mode is enabled, given the size of the workspace grown so far
+    size_t pin_size(size_t bytes_in_use) const
+    {
+        return reserved > 0 ? reserved : bytes_in_use;
+    }
+};
+
+}
@@ -0,0 +1,291 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Cache of idle handles shared by several threads. Handles are created, destroyed
+ *  and bound to streams through a factory, so that the pool can be tested on the host
+ *  with a mock factory. It does not depend on the internal headers, so that the clients
+ *  can include it.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace hipsolver
+{
+
+/*! \brief Creates, destroys, and binds to streams the handles of a pool. */
+class handle_factory
+{
+public:
+    virtual ~handle_factory() = default;
+
+    virtual hipsolverStatus_t create(hipsolverHandle_t* handle)                        = 0;
+    virtual hipsolverStatus_t destroy(hipsolverHandle_t handle)                        = 0;
+    virtual hipsolverStatus_t set_stream(hipsolverHandle_t handle, hipStream_t stream) = 0;
+};
+
+/*! \brief Keeps track of up to capacity handles, idle or in use, in slots that change state
+    with atomic operations, so that reusing and releasing a tracked handle never waits for
+    another thread. Each thread starts its search at a different slot to avoid contention.
+    A handle is only released from the slot holding it in use, so that releasing a handle the
+    pool does not own, or releasing one twice, is refused. Handles created while every slot is
+    taken are recorded in a locked set until they are released, which only happens on the path
+    that already creates or destroys a handle. */
+class handle_pool_core
+{
+public:
+    std::atomic<size_t> created{0}; // handles created by the factory
+    std::atomic<size_t> reused{0}; // acquisitions served from the cache
+
+    handle_pool_core(std::unique_ptr<handle_factory> factory, int capacity)
+        : factory(std::move(factory))
+        , capacity(capacity)
+        , slots(new slot_t[capacity])
+    {
+    }
+
+    ~handle_pool_core()
+    {
+        drain();
+    }
+
+    // Number of handles acquired and not yet released
+    int outstanding() const
+    {
+        return n_outstanding.load();
+    }
+
+    // Number of handles cached in the pool
+    int idle() const
+    {
+        int count = 0;
+        for(int i = 0; i < capacity; i++)
+            if(slots[i].state.load() == slot_idle)
+                count++;
+        return count;
+    }
+
+    // Creates handles until count of them (at most capacity) are cached in the pool
+    hipsolverStatus_t reserve(int count)
+    {
+        for(int missing = std::min(count, capacity) - idle(); missing > 0; missing--)
+        {
+            hipsolverHandle_t handle;
+            hipsolverStatus_t status = factory->create(&handle);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+            created++;
+
+            if(claim(handle, slot_idle) < 0)
+                return factory->destroy(handle);
+        }
+
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipsolverStatus_t acquire(hipStream_t stream, hipsolverHandle_t* handle)
+    {
+        hipsolverHandle_t h;
+        int               i = take();
+        if(i >= 0)
+        {
+            h = slots[i].handle.load(std::memory_order_relaxed);
+            reused++;
+        }
+        else
+        {
+            hipsolverStatus_t status = factory->create(&h);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+            created++;
+
+            i = claim(h, slot_acquired);
+            if(i < 0)
+            {
+                std::lock_guard<std::mutex> lock(overflow_mutex);
+                overflow.insert(h);
+            }
+        }
+
+        hipsolverStatus_t status = factory->set_stream(h, stream);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+        {
+            if(i < 0)
+            {
+                std::lock_guard<std::mutex> lock(overflow_mutex);
+                overflow.erase(h);
+            }
+            give_back(i, h);
+            return status;
+        }
+
+        n_outstanding++;
+        *handle = h;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // Returns the handle to the cache, or destroys it if the cache is full. Fails with
+    // HIPSOLVER_STATUS_INVALID_VALUE if the handle was not acquired from the pool.
+    hipsolverStatus_t release(hipsolverHandle_t handle)
+    {
+        int i = find_acquired(handle);
+        if(i < 0)
+        {
+            std::lock_guard<std::mutex> lock(overflow_mutex);
+            if(overflow.erase(handle) == 0)
+                return HIPSOLVER_STATUS_INVALID_VALUE;
+        }
+
+        n_outstanding--;
+        return give_back(i, handle);
+    }
+
+    // Destroys the cached handles
+    hipsolverStatus_t drain()
+    {
+        hipsolverStatus_t status = HIPSOLVER_STATUS_SUCCESS;
+        for(int i = 0; i < capacity; i++)
+        {
+            int expected = slot_idle;
+            if(!slots[i].state.compare_exchange_strong(
+                   expected, slot_busy, std::memory_order_acquire))
+                continue;
+
+            hipsolverHandle_t handle = slots[i].handle.exchange(nullptr);
+            slots[i].state.store(slot_empty, std::memory_order_release);
+
+            hipsolverStatus_t stat = factory->destroy(handle);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = stat;
+        }
+        return status;
+    }
+
+private:
+    // The handle of a slot is only written while the slot is busy
+    enum slot_state : int
+    {
+        slot_empty,
+        slot_busy,
+        slot_idle,
+        slot_acquired,
+    };
+
+    struct slot_t
+    {
+        std::atomic<int>               state{slot_empty};
+        std::atomic<hipsolverHandle_t> handle{nullptr};
+    };
+
+    std::unique_ptr<handle_factory> factory;
+    int                             capacity;
+    std::unique_ptr<slot_t[]>       slots;
+    std::atomic<int>                n_outstanding{0};
+
+    std::mutex                            overflow_mutex;
+    std::unordered_set<hipsolverHandle_t> overflow; // acquired handles that have no slot
+
+    int first_slot() const
+    {
+        return std::hash<std::thread::id>()(std::this_thread::get_id()) % capacity;
+    }
+
+    // Moves the first slot found from one state to another, and returns its index, or -1
+    int transition(int from, int to)
+    {
+        int first = first_slot();
+        for(int i = 0; i < capacity; i++)
+        {
+            slot_t& slot     = slots[(first + i) % capacity];
+            int     expected = from;
+            if(slot.state.load(std::memory_order_relaxed) == from
+               && slot.state.compare_exchange_strong(expected, to, std::memory_order_acquire))
+                return (first + i) % capacity;
+        }
+        return -1;
+    }
+
+    // Marks an idle handle as acquired, and returns its slot, or -1 if the cache is empty
+    int take()
+    {
+        return transition(slot_idle, slot_acquired);
+    }
+
+    // Stores a handle in an empty slot in the given state, and returns the slot, or -1 if every
+    // slot is taken
+    int claim(hipsolverHandle_t handle, int state)
+    {
+        int i = transition(slot_empty, slot_busy);
+        if(i >= 0)
+        {
+            slots[i].handle.store(handle, std::memory_order_relaxed);
+            slots[i].state.store(state, std::memory_order_release);
+        }
+        return i;
+    }
+
+    // Marks the slot holding the given acquired handle as busy, and returns it, or -1
+    int find_acquired(hipsolverHandle_t handle)
+    {
+        int first = first_slot();
+        for(int i = 0; i < capacity; i++)
+        {
+            slot_t& slot     = slots[(first + i) % capacity];
+            int     expected = slot_acquired;
+            if(slot.state.load(std::memory_order_acquire) != slot_acquired
+               || slot.handle.load(std::memory_order_relaxed) != handle
+               || !slot.state.compare_exchange_strong(
+                   expected, slot_busy, std::memory_order_acquire))
+                continue;
+
+            // the slot may have been refilled by another handle in between
+            if(slot.handle.load(std::memory_order_relaxed) == handle)
+                return (first + i) % capacity;
+            slot.state.store(slot_acquired, std::memory_order_release);
+        }
+        return -1;
+    }
+
+    // Returns a handle that is no longer acquired to the cache from its slot, or from outside
+    // the slots if it has none, destroying it if the cache is full
+    hipsolverStatus_t give_back(int i, hipsolverHandle_t handle)
+    {
+        if(i >= 0)
+            slots[i].state.store(slot_idle, std::memory_order_release);
+        else if(claim(handle, slot_idle) < 0)
+            return factory->destroy(handle);
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+};
+
+}
@@ -0,0 +1,171 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+/*! \file
+ *  \brief Dispatch of small dense problems to a host LAPACK library. It holds the
+ *  per-handle thresholds, the dispatch decision and the host path, none of which touch
+ *  the device, so they can be tested on the host. It does not depend on the library
+ *  headers, so that the clients can include it.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hipsolver
+{
+
+enum hybrid_function : int
+{
+    hybrid_getrf,
+    hybrid_getrs,
+    hybrid_potrf,
+    hybrid_potrs,
+    hybrid_function_count
+};
+
+/*! \brief Entry points of a host LAPACK library for the type T, with the Fortran calling
+    convention. Null entries are not available. */
+template <typename T>
+struct host_lapack
+{
+    void (*getrf)(int* m, int* n, T* A, int* lda, int* ipiv, int* info) = nullptr;
+    void (*getrs)(
+        char* trans, int* n, int* nrhs, T* A, int* lda, int* ipiv, T* B, int* ldb, int* info)
+        = nullptr;
+    void (*potrf)(char* uplo, int* n, T* A, int* lda, int* info) = nullptr;
+    void (*potrs)(char* uplo, int* n, int* nrhs, T* A, int* lda, T* B, int* ldb, int* info)
+        = nullptr;
+};
+
+class hybrid_policy
+{
+public:
+    static constexpr int default_threshold = 32;
+
+    bool enabled = false;
+    int  threshold[hybrid_function_count]; // problems of size < threshold run on the host
+
+    size_t host_calls   = 0;
+    size_t device_calls = 0;
+
+    hybrid_policy()
+    {
+        for(int i = 0; i < hybrid_function_count; i++)
+            threshold[i] = default_threshold;
+    }
+
+    bool set_threshold(int func, int n)
+    {
+        if(func < 0 || func >= hybrid_function_count || n < 0)
+            return false;
+
+        threshold[func] = n;
+        return true;
+    }
+
+    /* Whether a call to func on a problem of size n runs on the host. Calls with invalid
+       arguments stay on the device, which reports the error, and so do calls whose data is
+       not accessible from the host. */
+    bool use_host(int func, int64_t n, bool valid_args, bool host_accessible) const
+    {
+        return enabled && valid_args && host_accessible && n < threshold[func];
+    }
+
+    void on_dispatch(bool host)
+    {
+        if(host)
+            host_calls++;
+        else
+            device_calls++;
+    }
+};
+
+/*! \brief Threshold for a function given the times of the host and device paths on
+    problems of increasing sizes: the smallest measured size from which the device path
+    is faster at every larger measured size, 0 if it is always faster, or one more than
+    the largest size if the host path is faster there. */
+inline int hybrid_crossover(const int*    sizes,
+                            const double* host_time,
+                            const double* device_time,
+                            int           count)
+{
+    int threshold = 0;
+    for(int i = count - 1; i >= 0; i--)
+    {
+        if(host_time[i] < device_time[i])
+        {
+            threshold = (i == count - 1) ? sizes[i] + 1 : sizes[i + 1];
+            break;
+        }
+    }
+    return threshold;
+}
+
+// Host path. The arguments are assumed to be valid, and info is set as the device path does.
+
+template <typename T>
+void hybrid_host_getrf(
+    const host_lapack<T>& lapack, int m, int n, T* A, int lda, int* ipiv, int* info)
+{
+    lapack.getrf(&m, &n, A, &lda, ipiv, info);
+}
+
+template <typename T>
+void hybrid_host_getrs(const host_lapack<T>& lapack,
+                       char                  trans,
+                       int                   n,
+                       int                   nrhs,
+                       T*                    A,
+                       int                   lda,
+                       int*                  ipiv,
+                       T*                    B,
+                       int                   ldb,
+                       int*                  info)
+{
+    lapack.getrs(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+template <typename T>
+void hybrid_host_potrf(const host_lapack<T>& lapack, char uplo, int n, T* A, int lda, int* info)
+{
+    lapack.potrf(&uplo, &n, A, &lda, info);
+}
+
+template <typename T>
+void hybrid_host_potrs(const host_lapack<T>& lapack,
+                       char                  uplo,
+                       int                   n,
+                       int                   nrhs,
+                       T*                    A,
+                       int                   lda,
+                       T*                    B,
+                       int                   ldb,
+                       int*                  info)
+{
+    lapack.potrs(&uplo, &n, &nrhs, A, &lda, B, &ldb, info);
+}
+
+}
@@ -0,0 +1,164 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Detection of pointer arrays that describe a strided batch. It holds the test
+ *  for an affine array and the per-handle cache of its results, none of which touch the
+ *  device, so they can be tested on the host. It does not depend on the library headers,
+ *  so that the clients can include it.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+namespace hipsolver
+{
+
+/*! \brief Layout of the matrices referenced by a pointer array. When affine is true, the
+    i-th pointer is base + i * stride, with the stride in bytes. */
+struct pointer_layout
+{
+    bool      affine = false;
+    uintptr_t base   = 0;
+    int64_t   stride = 0;
+
+    /* Whether the batch can be passed to a strided routine whose elements have the given
+       size and whose matrices span at least min_stride elements. The stride in elements is
+       written to stride_out. A batch of one matrix takes min_stride. */
+    bool as_strided(size_t elem_size, int64_t min_stride, int count, int64_t* stride_out) const
+    {
+        if(!affine || count < 1)
+            return false;
+        if(count == 1)
+        {
+            *stride_out = min_stride;
+            return true;
+        }
+        if(stride % int64_t(elem_size) != 0 || stride / int64_t(elem_size) < min_stride)
+            return false;
+
+        *stride_out = stride / int64_t(elem_size);
+        return true;
+    }
+};
+
+/*! \brief Whether the count pointers in ptrs are equally spaced. Null pointers are never
+    part of an affine array, so that the pointer-array routines can report them. */
+inline pointer_layout detect_pointer_layout(const void* const* ptrs, int count)
+{
+    pointer_layout layout;
+    if(count < 1 || !ptrs[0])
+        return layout;
+
+    uintptr_t base   = uintptr_t(ptrs[0]);
+    int64_t   stride = count > 1 ? int64_t(uintptr_t(ptrs[1]) - base) : 0;
+    for(int i = 1; i < count; i++)
+    {
+        if(uintptr_t(ptrs[i]) != base + uintptr_t(stride * i))
+            return layout;
+    }
+
+    layout.affine = true;
+    layout.base   = base;
+    layout.stride = stride;
+    return layout;
+}
+
+/*! \brief Per-handle state of the stride detection. The layouts of the pointer arrays seen
+    by the handle are cached by address and length, which assumes that an array is not
+    rewritten while the detection is enabled; the cache is emptied whenever the mode is
+    set, and when it reaches its capacity. */
+class stride_detection
+{
+public:
+    static constexpr size_t capacity = 256;
+
+    bool enabled = false;
+
+    size_t strided_calls = 0;
+    size_t batched_calls = 0;
+
+    bool find(const void* array, int count, pointer_layout* layout) const
+    {
+        auto it = layouts.find(key{array, count});
+        if(it == layouts.end())
+            return false;
+
+        *layout = it->second;
+        return true;
+    }
+
+    void insert(const void* array, int count, const pointer_layout& layout)
+    {
+        if(layouts.size() >= capacity)
+            layouts.clear();
+        layouts[key{array, count}] = layout;
+    }
+
+    void set_enabled(bool enable)
+    {
+        enabled = enable;
+        layouts.clear();
+    }
+
+    void on_dispatch(bool strided)
+    {
+        if(strided)
+            strided_calls++;
+        else
+            batched_calls++;
+    }
+
+    size_t size() const
+    {
+        return layouts.size();
+    }
+
+private:
+    struct key
+    {
+        const void* array;
+        int         count;
+
+        bool operator==(const key& other) const
+        {
+            return array == other.array && count == other.count;
+        }
+    };
+
+    struct key_hash
+    {
+        size_t operator()(const key& k) const
+        {
+            return std::hash<const void*>()(k.array) ^ (std::hash<int>()(k.count) << 1);
+        }
+    };
+
+    std::unordered_map<key, pointer_layout, key_hash> layouts;
+};
+
+}
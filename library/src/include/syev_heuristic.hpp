@@ -0,0 +1,352 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Selection of the symmetric eigensolver used by syevAuto. It holds the table of
+ *  measured winners, the lookup into it and its JSON form, none of which touch the device,
+ *  so they can be tested on the host. It does not depend on the library headers, so that
+ *  the clients can include it; hipsolver-bench uses it to write the tables it tunes.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace hipsolver
+{
+
+enum syev_algorithm : int
+{
+    syev_alg_syevd,
+    syev_alg_syevj,
+    syev_alg_syevdx,
+    syev_algorithm_count
+};
+
+inline const char* syev_algorithm_name(syev_algorithm alg)
+{
+    switch(alg)
+    {
+    case syev_alg_syevj:
+        return "syevj";
+    case syev_alg_syevdx:
+        return "syevdx";
+    default:
+        return "syevd";
+    }
+}
+
+inline bool syev_algorithm_from_name(const std::string& name, syev_algorithm* alg)
+{
+    for(int i = 0; i < syev_algorithm_count; i++)
+    {
+        if(name == syev_algorithm_name(syev_algorithm(i)))
+        {
+            *alg = syev_algorithm(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+/*! \brief The fastest algorithm measured for a problem of size n, with batch matrices,
+    with or without eigenvectors, and for which a fraction of the spectrum is wanted. */
+struct syev_heuristic_entry
+{
+    int64_t        n;
+    int64_t        batch;
+    bool           vectors;
+    double         fraction;
+    syev_algorithm alg;
+};
+
+/*! \brief Table of measured winners for a device. A problem takes the algorithm of the
+    nearest entry that agrees on whether eigenvectors are wanted, with sizes and batch counts
+    compared on a logarithmic scale. */
+class syev_heuristic
+{
+public:
+    std::string                       device;
+    std::vector<syev_heuristic_entry> entries;
+
+    /* Table used when none has been tuned for the device: Jacobi for small matrices, which
+       it diagonalizes in a few sweeps and in parallel across a batch; syevdx when few
+       eigenpairs of a large matrix are wanted, as it runs one matrix at a time; and
+       divide-and-conquer otherwise. */
+    static syev_heuristic defaults()
+    {
+        static const int64_t sizes[]     = {16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
+        static const int64_t batches[]   = {1, 8, 64, 512};
+        static const double  fractions[] = {0.1, 1.0};
+
+        syev_heuristic table;
+        table.device = "default";
+        for(int v = 0; v < 2; v++)
+            for(int64_t n : sizes)
+                for(int64_t batch : batches)
+                    for(double fraction : fractions)
+                    {
+                        syev_algorithm alg = syev_alg_syevd;
+                        if(n <= 32 || (n <= 64 && batch >= 8))
+                            alg = syev_alg_syevj;
+                        else if(fraction < 0.5 && n >= 256 && batch <= 8)
+                            alg = syev_alg_syevdx;
+                        table.entries.push_back({n, batch, v == 1, fraction, alg});
+                    }
+        return table;
+    }
+
+    syev_algorithm choose(bool vectors, int64_t n, int64_t batch, double fraction) const
+    {
+        syev_algorithm best      = syev_alg_syevd;
+        double         best_dist = -1;
+        for(const syev_heuristic_entry& e : entries)
+        {
+            if(e.vectors != vectors)
+                continue;
+
+            double dist = std::fabs(log_scale(n) - log_scale(e.n))
+                          + std::fabs(log_scale(batch) - log_scale(e.batch))
+                          + 4 * std::fabs(fraction - e.fraction);
+            if(best_dist < 0 || dist < best_dist)
+            {
+                best      = e.alg;
+                best_dist = dist;
+            }
+        }
+        return best;
+    }
+
+    std::string to_json() const
+    {
+        std::ostringstream out;
+        out << "{\n  \"device\": \"" << device << "\",\n  \"entries\": [";
+        for(size_t i = 0; i < entries.size(); i++)
+        {
+            const syev_heuristic_entry& e = entries[i];
+            out << (i ? ",\n" : "\n") << "    {\"n\": " << e.n << ", \"batch\": " << e.batch
+                << ", \"jobz\": \"" << (e.vectors ? 'V' : 'N') << "\", \"fraction\": "
+                << e.fraction << ", \"algorithm\": \"" << syev_algorithm_name(e.alg) << "\"}";
+        }
+        out << "\n  ]\n}\n";
+        return out.str();
+    }
+
+    /* Parses a table written by to_json. Keys that are not recognized are skipped. Returns
+       false, leaving table unchanged, if the text is malformed or an entry is incomplete. */
+    static bool from_json(const std::string& text, syev_heuristic* table)
+    {
+        parser         p{text.c_str()};
+        syev_heuristic result;
+        bool           ok = p.object([&](const std::string& key) {
+            if(key == "device")
+                return p.string(&result.device);
+            if(key == "entries")
+                return p.array([&]() {
+                    syev_heuristic_entry e{-1, -1, false, -1, syev_alg_syevd};
+                    std::string          jobz, alg;
+                    bool                 valid = p.object([&](const std::string& name) {
+                        if(name == "n")
+                            return p.integer(&e.n);
+                        if(name == "batch")
+                            return p.integer(&e.batch);
+                        if(name == "fraction")
+                            return p.number(&e.fraction);
+                        if(name == "jobz")
+                            return p.string(&jobz);
+                        if(name == "algorithm")
+                            return p.string(&alg);
+                        return p.skip();
+                    });
+                    if(!valid || e.n < 0 || e.batch < 0 || e.fraction < 0 || e.fraction > 1
+                       || (jobz != "N" && jobz != "V") || !syev_algorithm_from_name(alg, &e.alg))
+                        return false;
+
+                    e.vectors = jobz == "V";
+                    result.entries.push_back(e);
+                    return true;
+                });
+            return p.skip();
+        });
+
+        if(!ok || !p.end())
+            return false;
+        *table = result;
+        return true;
+    }
+
+    static bool read(const std::string& path, syev_heuristic* table)
+    {
+        std::ifstream file(path);
+        if(!file)
+            return false;
+
+        std::stringstream text;
+        text << file.rdbuf();
+        return from_json(text.str(), table);
+    }
+
+    bool write(const std::string& path) const
+    {
+        std::ofstream file(path);
+        file << to_json();
+        return bool(file);
+    }
+
+private:
+    static double log_scale(int64_t x)
+    {
+        return std::log2(double(x < 1 ? 1 : x));
+    }
+
+    // Reader of the subset of JSON used by the tables
+    struct parser
+    {
+        const char* s;
+
+        void space()
+        {
+            while(*s == ' ' || *s == '\t' || *s == '\n' || *s == '\r')
+                s++;
+        }
+
+        bool expect(char c)
+        {
+            space();
+            if(*s != c)
+                return false;
+            s++;
+            return true;
+        }
+
+        bool end()
+        {
+            space();
+            return *s == '\0';
+        }
+
+        bool string(std::string* out)
+        {
+            if(!expect('"'))
+                return false;
+            out->clear();
+            for(; *s != '"'; s++)
+            {
+                if(*s == '\0')
+                    return false;
+                if(*s == '\\' && *++s == '\0')
+                    return false;
+                out->push_back(*s);
+            }
+            s++;
+            return true;
+        }
+
+        bool number(double* out)
+        {
+            space();
+            char* last;
+            *out = std::strtod(s, &last);
+            if(last == s)
+                return false;
+            s = last;
+            return true;
+        }
+
+        bool integer(int64_t* out)
+        {
+            double x;
+            if(!number(&x) || x != std::floor(x))
+                return false;
+            *out = int64_t(x);
+            return true;
+        }
+
+        template <typename F>
+        bool object(F member)
+        {
+            if(!expect('{'))
+                return false;
+            if(expect('}'))
+                return true;
+            do
+            {
+                std::string key;
+                if(!string(&key) || !expect(':') || !member(key))
+                    return false;
+            } while(expect(','));
+            return expect('}');
+        }
+
+        template <typename F>
+        bool array(F element)
+        {
+            if(!expect('['))
+                return false;
+            if(expect(']'))
+                return true;
+            do
+            {
+                if(!element())
+                    return false;
+            } while(expect(','));
+            return expect(']');
+        }
+
+        bool skip()
+        {
+            space();
+            if(*s == '"')
+            {
+                std::string ignored;
+                return string(&ignored);
+            }
+            if(*s == '{')
+                return object([&](const std::string&) { return skip(); });
+            if(*s == '[')
+                return array([&]() { return skip(); });
+            for(const char* word : {"true", "false", "null"})
+            {
+                size_t len = std::strlen(word);
+                if(std::strncmp(s, word, len) == 0)
+                {
+                    s += len;
+                    return true;
+                }
+            }
+            double ignored;
+            return number(&ignored);
+        }
+    };
+};
+
+}
@@ -0,0 +1,289 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Schedule of the out-of-core Cholesky and LU factorizations. It holds the list of
+ *  copies and computations on block columns of the host matrix and the dependencies between
+ *  them, none of which touch the device, so they can be tested on the host with a simulated
+ *  executor. It does not depend on the library headers, so that the clients can include it.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace hipsolver
+{
+
+/*! \brief Queues on which the tasks of a schedule run. Tasks on the same queue run in the
+    order of the schedule; the device queues are streams, and the host queue is the calling
+    thread. */
+enum tile_queue : int
+{
+    tile_queue_load,
+    tile_queue_compute,
+    tile_queue_store,
+    tile_queue_host,
+    tile_queue_count
+};
+
+enum tile_op : int
+{
+    tile_op_load_panel, // copies block column j of the host matrix to panel buffer j % 2
+    tile_op_load_block, // copies the part of factored block column k that updates panel j
+    tile_op_update, // applies the factored block column k to panel j
+    tile_op_factor, // factors the diagonal block of panel j and the rows below it
+    tile_op_store_pivots, // copies the pivots of panel j to the host (LU)
+    tile_op_store_panel, // copies panel j back to the host matrix
+    tile_op_pivots, // converts the pivots of panel j to rows of the whole matrix (LU)
+    tile_op_swap, // applies the pivots of panel j to stored block column k (LU)
+};
+
+/*! \brief A task of the schedule. Block column k is read from stream buffer stream, or, if
+    stream is -1, from the panel buffer that still holds it. deps lists earlier tasks, on
+    any queue, that must be complete before the task starts. */
+struct tile_task
+{
+    tile_op          op;
+    int64_t          j;
+    int64_t          k;
+    int              stream;
+    std::vector<int> deps;
+
+    tile_queue queue() const
+    {
+        switch(op)
+        {
+        case tile_op_load_panel:
+        case tile_op_load_block:
+            return tile_queue_load;
+        case tile_op_update:
+        case tile_op_factor:
+            return tile_queue_compute;
+        case tile_op_store_pivots:
+        case tile_op_store_panel:
+            return tile_queue_store;
+        default:
+            return tile_queue_host;
+        }
+    }
+};
+
+/*! \brief Left-looking factorization of an m-by-n matrix held in host memory, by block
+    columns of nb columns.
+
+    The device holds two panel buffers and two stream buffers, each of ld() rows and nb
+    columns. Block column j is loaded into a panel buffer, updated with the factored block
+    columns to its left, which are streamed through the stream buffers, factored, and stored
+    back, while the next block column is loaded.
+
+    For the Cholesky factorization (m = n), the rows of block column j above the diagonal
+    block are neither loaded nor used, and the block column factored last, which is still in
+    the other panel buffer, is used from there. Its update is applied first, as the updates
+    commute, which frees the buffer for the next block column early.
+
+    For the LU factorization, the updates must be applied from left to right, so the block
+    column factored last is streamed like the others, rather than holding up the load of the
+    next block column until it is applied. The whole block column is loaded, and the row
+    interchanges of the factored block columns are applied to it on the device before it is
+    updated. The stored block columns hold only their own interchanges; those of the block
+    columns to their right are applied on the device to the streamed copies, and by the host
+    to the stored block columns once they are no longer streamed. */
+class tile_schedule
+{
+public:
+    static constexpr int panel_buffers  = 2;
+    static constexpr int stream_buffers = 2;
+
+    bool                   lu = false;
+    int64_t                m  = 0;
+    int64_t                n  = 0;
+    int64_t                nb = 1;
+    std::vector<tile_task> tasks;
+
+    static tile_schedule cholesky(int64_t n, int64_t nb)
+    {
+        return build(false, n, n, nb);
+    }
+
+    static tile_schedule getrf(int64_t m, int64_t n, int64_t nb)
+    {
+        return build(true, m, n, nb);
+    }
+
+    // Number of block columns
+    int64_t panels() const
+    {
+        return (n + nb - 1) / nb;
+    }
+
+    // Number of block columns with a diagonal block
+    int64_t factored() const
+    {
+        return (std::min(m, n) + nb - 1) / nb;
+    }
+
+    // Number of columns of block column j
+    int64_t width(int64_t j) const
+    {
+        return std::min(nb, n - j * nb);
+    }
+
+    // Number of pivots of block column j (LU)
+    int64_t pivots(int64_t j) const
+    {
+        return j < factored() ? std::min(m - j * nb, width(j)) : 0;
+    }
+
+    // First row of block column j that is loaded into a panel buffer
+    int64_t panel_row(int64_t j) const
+    {
+        return lu ? 0 : j * nb;
+    }
+
+    // First row of block column k that is loaded to update panel j
+    int64_t block_row(int64_t j, int64_t k) const
+    {
+        return lu ? k * nb : j * nb;
+    }
+
+    // Leading dimension of the device buffers
+    int64_t ld() const
+    {
+        return std::max(m, int64_t(1));
+    }
+
+    // Elements held by the device buffers
+    size_t buffer_elements() const
+    {
+        int64_t cols = std::min(nb, std::max(n, int64_t(1)));
+        return size_t(panel_buffers + stream_buffers) * ld() * cols;
+    }
+
+    /* Tile size used when none is given: the largest power of two not above 1024 for which
+       the device buffers take at most limit bytes, if limit is not 0. */
+    static int64_t default_tile_size(int64_t m, int64_t n, size_t elem_size, size_t limit)
+    {
+        size_t  rows = size_t(panel_buffers + stream_buffers) * std::max(m, int64_t(1));
+        int64_t nb   = 1024;
+        while(nb > 1 && limit > 0 && rows * nb * elem_size > limit)
+            nb /= 2;
+        return std::max(int64_t(1), std::min(nb, n));
+    }
+
+private:
+    static tile_schedule build(bool lu, int64_t m, int64_t n, int64_t nb)
+    {
+        tile_schedule s;
+        s.lu = lu;
+        s.m  = m;
+        s.n  = n;
+        s.nb = std::max(nb, int64_t(1));
+
+        int64_t panels   = s.panels();
+        int64_t factored = s.factored();
+
+        std::vector<int> load_panel(panels, -1), store_panel(panels, -1);
+        std::vector<int> store_pivots(panels, -1), last_load(panels, -1);
+        int              resident_reader[panel_buffers] = {-1, -1};
+        int              stream_reader[stream_buffers]  = {-1, -1};
+        int              streamed                       = 0;
+
+        for(int64_t j = 0; j < panels; j++)
+        {
+            int p = int(j % panel_buffers);
+
+            // the panel buffer is free once its previous block column is stored and used
+            load_panel[j] = s.add(tile_op_load_panel,
+                                  j,
+                                  -1,
+                                  -1,
+                                  {j >= panel_buffers ? store_panel[j - panel_buffers] : -1,
+                                   resident_reader[p]});
+            int last_compute = load_panel[j];
+
+            // the block column factored last is still in the other panel buffer
+            bool resident = !lu && j > 0 && j - 1 < factored;
+            if(resident)
+                last_compute = s.use_resident(j, load_panel[j], resident_reader);
+
+            for(int64_t k = 0; k < std::min(j, factored) - (resident ? 1 : 0); k++)
+            {
+                int buf = streamed++ % stream_buffers;
+                int load
+                    = s.add(tile_op_load_block, j, k, buf, {store_panel[k], stream_reader[buf]});
+                last_load[k] = load;
+
+                last_compute       = s.add(tile_op_update, j, k, buf, {load, load_panel[j]});
+                stream_reader[buf] = last_compute;
+            }
+
+            if(j < factored)
+            {
+                last_compute = s.add(tile_op_factor, j, -1, -1, {load_panel[j]});
+                if(lu)
+                    store_pivots[j] = s.add(tile_op_store_pivots, j, -1, -1, {last_compute});
+            }
+            store_panel[j] = s.add(tile_op_store_panel, j, -1, -1, {last_compute});
+        }
+
+        // interchanges of the block columns to the right of each stored block column, applied
+        // once it has been streamed for the last time
+        if(lu)
+        {
+            std::vector<int> conv(factored);
+            for(int64_t i = 0; i < factored; i++)
+                conv[i] = s.add(tile_op_pivots, i, -1, -1, {store_pivots[i]});
+            for(int64_t k = 0; k < factored; k++)
+                for(int64_t i = k + 1; i < factored; i++)
+                    s.add(tile_op_swap, i, k, -1, {conv[i], store_panel[k], last_load[k]});
+        }
+
+        return s;
+    }
+
+    int use_resident(int64_t j, int load, int* resident_reader)
+    {
+        int update = add(tile_op_update, j, j - 1, -1, {load});
+        resident_reader[(j - 1) % panel_buffers] = update;
+        return update;
+    }
+
+    int add(tile_op op, int64_t j, int64_t k, int stream, std::initializer_list<int> deps)
+    {
+        tile_task task{op, j, k, stream, {}};
+        for(int d : deps)
+        {
+            if(d >= 0 && std::find(task.deps.begin(), task.deps.end(), d) == task.deps.end())
+                task.deps.push_back(d);
+        }
+        tasks.push_back(task);
+        return int(tasks.size()) - 1;
+    }
+};
+
+}
@@ -23,24 +23,56 @@
 
 #pragma once
 
+#include "capture_mode.hpp"
 #include "hipsolver.h"
+#include "lib_macros.hpp"
 
 #include "rocblas/rocblas.h"
 #include "rocsolver/rocsolver.h"
 
+HIPSOLVER_BEGIN_NAMESPACE
+
+/*! \brief Returns true if a workspace of the given size fits in the memory budget of the handle.
+    Requests that do not fit are counted as rejected. */
+bool check_memory_budget(rocblas_handle handle, size_t size);
+
+/*! \brief Returns true if a workspace of the given size does not fit in the memory budget of the
+    handle, in which case the caller switches to a lower-memory variant of its algorithm. */
+bool use_low_memory_variant(rocblas_handle handle, size_t size);
+
+/*! \brief Records the size of the workspace managed by hipSOLVER for the handle. */
+void record_workspace_size(rocblas_handle handle, size_t size);
+
+/*! \brief Returns the capture-safe mode of the handle. */
+capture_policy get_capture_policy(rocblas_handle handle);
+
+/*! \brief Returns HIPSOLVER_STATUS_NOT_CAPTURABLE if the handle is in capture-safe mode, under
+    which the given step is refused. */
+hipsolverStatus_t check_capture(rocblas_handle handle, capture_step step);
+
+/*! \brief Provides a workspace of the given size to the handle: its reserved workspace if it is in
+    capture-safe mode, a block of its workspace pool if it has one, or else device memory owned by
+    rocBLAS, subject to its memory budget. Throws HIPSOLVER_STATUS_NOT_CAPTURABLE if the reserved
+    workspace is too small. The state of the handle is locked once for the whole call. */
+rocblas_status manage_workspace(rocblas_handle handle, size_t size);
+
+/*! \brief Sets a workspace supplied by the caller on the handle. It replaces the workspace
+    allocated by hipSOLVER, and is not held against the memory budget of the handle. */
+rocblas_status set_user_workspace(rocblas_handle handle, void* work, size_t size);
+
+HIPSOLVER_END_NAMESPACE
+
 inline rocblas_status hipsolverManageWorkspace(rocblas_handle handle, size_t new_size)
 {
     if(new_size < 0)
         return rocblas_status_memory_error;
 
-    size_t current_size = 0;
-    if(rocblas_is_user_managing_device_memory(handle))
-        rocblas_get_device_memory_size(handle, &current_size);
+    return hipsolver::manage_workspace(handle, new_size);
+}
 
-    if(new_size > current_size)
-        return rocblas_set_device_memory_size(handle, new_size);
-    else
-        return rocblas_status_success;
+inline rocblas_status hipsolverSetUserWorkspace(rocblas_handle handle, void* work, size_t size)
+{
+    return hipsolver::set_user_workspace(handle, work, size);
 }
 
 inline rocblas_status
@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Bookkeeping of a workspace pool shared by several handles. It makes all the
+ *  decisions of the pool without touching the device, so it can be tested on the host.
+ *  It does not depend on the library headers, so that the clients can include it.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace hipsolver
+{
+
+class workspace_pool_tracker
+{
+public:
+    size_t low_watermark  = 0;
+    size_t high_watermark = SIZE_MAX;
+
+    size_t bytes_in_use      = 0; // bytes currently held by handles
+    size_t peak_bytes_in_use = 0;
+    size_t reallocations     = 0;
+    size_t trims             = 0;
+
+    bool set_watermarks(size_t low, size_t high)
+    {
+        if(low > high)
+            return false;
+
+        low_watermark  = low;
+        high_watermark = high;
+        return true;
+    }
+
+    /* Whether a handle holding a block of held bytes must replace it to serve a request of
+       size bytes. Blocks are reused when they are large enough, unless the pool is above its
+       high watermark and the block is more than twice the size of the request. */
+    bool must_reallocate(size_t held, size_t size) const
+    {
+        if(size > held)
+            return true;
+        return bytes_in_use > high_watermark && held / 2 > size;
+    }
+
+    void on_allocate(size_t size)
+    {
+        bytes_in_use += size;
+        peak_bytes_in_use = std::max(peak_bytes_in_use, bytes_in_use);
+        reallocations++;
+    }
+
+    void on_release(size_t size)
+    {
+        bytes_in_use -= std::min(size, bytes_in_use);
+    }
+
+    // Whether the memory cached by the pool should be trimmed down to the low watermark
+    bool should_trim(size_t bytes_reserved) const
+    {
+        return bytes_reserved > high_watermark;
+    }
+
+    void on_trim()
+    {
+        trims++;
+    }
+};
+
+}
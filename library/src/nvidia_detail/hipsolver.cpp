@@ -132,1046 +132,764 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/******************** GESVDJ PARAMS ********************/
-hipsolverStatus_t hipsolverCreateGesvdjInfo(hipsolverGesvdjInfo_t* info)
+hipsolverStatus_t
+    hipsolverGetBufferSizeCacheStats(hipsolverHandle_t handle, size_t* hits, size_t* misses)
 try
 {
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCreateGesvdjInfo((gesvdjInfo_t*)info));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDestroyGesvdjInfo(hipsolverGesvdjInfo_t info)
+hipsolverStatus_t hipsolverClearBufferSizeCache(hipsolverHandle_t handle)
 try
 {
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDestroyGesvdjInfo((gesvdjInfo_t)info));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverXgesvdjSetMaxSweeps(hipsolverGesvdjInfo_t info, int max_sweeps)
+hipsolverStatus_t hipsolverSetMemoryBudget(hipsolverHandle_t handle, size_t bytes)
 try
 {
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnXgesvdjSetMaxSweeps((gesvdjInfo_t)info, max_sweeps));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverXgesvdjSetSortEig(hipsolverGesvdjInfo_t info, int sort_eig)
+hipsolverStatus_t hipsolverGetMemoryUsage(hipsolverHandle_t handle, hipsolverMemoryUsage_t* usage)
 try
 {
-    if(!info)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!usage)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnXgesvdjSetSortEig((gesvdjInfo_t)info, sort_eig));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverXgesvdjSetTolerance(hipsolverGesvdjInfo_t info, double tolerance)
+hipsolverStatus_t hipsolverSetHybridMode(hipsolverHandle_t handle, hipsolverHybridMode_t mode)
 try
 {
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnXgesvdjSetTolerance((gesvdjInfo_t)info, tolerance));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverXgesvdjGetResidual(hipsolverDnHandle_t   handle,
-                                              hipsolverGesvdjInfo_t info,
-                                              double*               residual)
+hipsolverStatus_t hipsolverGetHybridMode(hipsolverHandle_t handle, hipsolverHybridMode_t* mode)
 try
 {
-    if(!info)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!mode)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnXgesvdjGetResidual((cusolverDnHandle_t)handle, (gesvdjInfo_t)info, residual));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverXgesvdjGetSweeps(hipsolverDnHandle_t   handle,
-                                            hipsolverGesvdjInfo_t info,
-                                            int*                  executed_sweeps)
+hipsolverStatus_t hipsolverSetHybridThreshold(hipsolverHandle_t         handle,
+                                              hipsolverHybridFunction_t function,
+                                              int                       n)
 try
 {
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnXgesvdjGetSweeps(
-        (cusolverDnHandle_t)handle, (gesvdjInfo_t)info, executed_sweeps));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** SYEVJ PARAMS ********************/
-hipsolverStatus_t hipsolverCreateSyevjInfo(hipsolverSyevjInfo_t* info)
+hipsolverStatus_t hipsolverGetHybridThreshold(hipsolverHandle_t         handle,
+                                              hipsolverHybridFunction_t function,
+                                              int*                      n)
 try
 {
-    if(!info)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!n)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnCreateSyevjInfo((syevjInfo_t*)info));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDestroySyevjInfo(hipsolverSyevjInfo_t info)
+hipsolverStatus_t hipsolverCalibrateHybridThresholds(hipsolverHandle_t handle)
 try
 {
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDestroySyevjInfo((syevjInfo_t)info));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverXsyevjSetMaxSweeps(hipsolverSyevjInfo_t info, int max_sweeps)
+hipsolverStatus_t
+    hipsolverGetHybridStats(hipsolverHandle_t handle, size_t* hostCalls, size_t* deviceCalls)
 try
 {
-    if(!info)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!hostCalls || !deviceCalls)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnXsyevjSetMaxSweeps((syevjInfo_t)info, max_sweeps));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverXsyevjSetSortEig(hipsolverSyevjInfo_t info, int sort_eig)
+/******************** STRIDE DETECTION ********************/
+hipsolverStatus_t hipsolverSetStrideDetectionMode(hipsolverHandle_t              handle,
+                                                  hipsolverStrideDetectionMode_t mode)
 try
 {
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnXsyevjSetSortEig((syevjInfo_t)info, sort_eig));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverXsyevjSetTolerance(hipsolverSyevjInfo_t info, double tolerance)
+hipsolverStatus_t hipsolverGetStrideDetectionMode(hipsolverHandle_t               handle,
+                                                  hipsolverStrideDetectionMode_t* mode)
 try
 {
-    if(!info)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!mode)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnXsyevjSetTolerance((syevjInfo_t)info, tolerance));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverXsyevjGetResidual(hipsolverDnHandle_t  handle,
-                                             hipsolverSyevjInfo_t info,
-                                             double*              residual)
+hipsolverStatus_t hipsolverGetStrideDetectionStats(hipsolverHandle_t handle,
+                                                   size_t*           stridedCalls,
+                                                   size_t*           batchedCalls)
 try
 {
-    if(!info)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!stridedCalls || !batchedCalls)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnXsyevjGetResidual((cusolverDnHandle_t)handle, (syevjInfo_t)info, residual));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverXsyevjGetSweeps(hipsolverDnHandle_t  handle,
-                                           hipsolverSyevjInfo_t info,
-                                           int*                 executed_sweeps)
+/******************** CAPTURE MODE ********************/
+hipsolverStatus_t hipsolverSetCaptureMode(hipsolverHandle_t handle, hipsolverCaptureMode_t mode)
 try
 {
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnXsyevjGetSweeps((cusolverDnHandle_t)handle, (syevjInfo_t)info, executed_sweeps));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** ORGBR/UNGBR ********************/
-hipsolverStatus_t hipsolverSorgbr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverSideMode_t side,
-                                             int                 m,
-                                             int                 n,
-                                             int                 k,
-                                             float*              A,
-                                             int                 lda,
-                                             float*              tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverGetCaptureMode(hipsolverHandle_t handle, hipsolverCaptureMode_t* mode)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSorgbr_bufferSize(
-        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_side(side), m, n, k, A, lda, tau, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgbr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverSideMode_t side,
-                                             int                 m,
-                                             int                 n,
-                                             int                 k,
-                                             double*             A,
-                                             int                 lda,
-                                             double*             tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverReserveWorkspace(hipsolverHandle_t handle, size_t bytes)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDorgbr_bufferSize(
-        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_side(side), m, n, k, A, lda, tau, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungbr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverSideMode_t side,
-                                             int                 m,
-                                             int                 n,
-                                             int                 k,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             hipFloatComplex*    tau,
-                                             int*                lwork)
+/******************** WORKSPACE POOL ********************/
+hipsolverStatus_t hipsolverCreateWorkspacePool(hipsolverWorkspacePool_t* pool)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnCungbr_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_side(side),
-                                                                  m,
-                                                                  n,
-                                                                  k,
-                                                                  (cuComplex*)A,
-                                                                  lda,
-                                                                  (cuComplex*)tau,
-                                                                  lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungbr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverSideMode_t side,
-                                             int                 m,
-                                             int                 n,
-                                             int                 k,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             hipDoubleComplex*   tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverDestroyWorkspacePool(hipsolverWorkspacePool_t pool)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZungbr_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_side(side),
-                                                                  m,
-                                                                  n,
-                                                                  k,
-                                                                  (cuDoubleComplex*)A,
-                                                                  lda,
-                                                                  (cuDoubleComplex*)tau,
-                                                                  lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSorgbr(hipsolverHandle_t   handle,
-                                  hipsolverSideMode_t side,
-                                  int                 m,
-                                  int                 n,
-                                  int                 k,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              tau,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverWorkspacePoolSetWatermarks(hipsolverWorkspacePool_t pool,
+                                                      size_t                   low_watermark,
+                                                      size_t                   high_watermark)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSorgbr((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_side(side),
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       A,
-                                                       lda,
-                                                       tau,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgbr(hipsolverHandle_t   handle,
-                                  hipsolverSideMode_t side,
-                                  int                 m,
-                                  int                 n,
-                                  int                 k,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             tau,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverWorkspacePoolTrim(hipsolverWorkspacePool_t pool)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDorgbr((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_side(side),
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       A,
-                                                       lda,
-                                                       tau,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungbr(hipsolverHandle_t   handle,
-                                  hipsolverSideMode_t side,
-                                  int                 m,
-                                  int                 n,
-                                  int                 k,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  hipFloatComplex*    tau,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverWorkspacePoolGetStats(hipsolverWorkspacePool_t       pool,
+                                                 hipsolverWorkspacePoolStats_t* stats)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!stats)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnCungbr((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_side(side),
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       (cuComplex*)tau,
-                                                       (cuComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungbr(hipsolverHandle_t   handle,
-                                  hipsolverSideMode_t side,
-                                  int                 m,
-                                  int                 n,
-                                  int                 k,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  hipDoubleComplex*   tau,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverSetWorkspacePool(hipsolverHandle_t handle, hipsolverWorkspacePool_t pool)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZungbr((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_side(side),
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       (cuDoubleComplex*)tau,
-                                                       (cuDoubleComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** ORGQR/UNGQR ********************/
-hipsolverStatus_t hipsolverSorgqr_bufferSize(
-    hipsolverHandle_t handle, int m, int n, int k, float* A, int lda, float* tau, int* lwork)
+/******************** GESVDJ PARAMS ********************/
+hipsolverStatus_t hipsolverCreateGesvdjInfo(hipsolverGesvdjInfo_t* info)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSorgqr_bufferSize((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnCreateGesvdjInfo((gesvdjInfo_t*)info));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgqr_bufferSize(
-    hipsolverHandle_t handle, int m, int n, int k, double* A, int lda, double* tau, int* lwork)
+hipsolverStatus_t hipsolverDestroyGesvdjInfo(hipsolverGesvdjInfo_t info)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnDorgqr_bufferSize((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnDestroyGesvdjInfo((gesvdjInfo_t)info));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungqr_bufferSize(hipsolverHandle_t handle,
-                                             int               m,
-                                             int               n,
-                                             int               k,
-                                             hipFloatComplex*  A,
-                                             int               lda,
-                                             hipFloatComplex*  tau,
-                                             int*              lwork)
+hipsolverStatus_t hipsolverXgesvdjSetMaxSweeps(hipsolverGesvdjInfo_t info, int max_sweeps)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnCungqr_bufferSize(
-        (cusolverDnHandle_t)handle, m, n, k, (cuComplex*)A, lda, (cuComplex*)tau, lwork));
+    return hipsolver::cuda2hip_status(
+        cusolverDnXgesvdjSetMaxSweeps((gesvdjInfo_t)info, max_sweeps));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungqr_bufferSize(hipsolverHandle_t handle,
-                                             int               m,
-                                             int               n,
-                                             int               k,
-                                             hipDoubleComplex* A,
-                                             int               lda,
-                                             hipDoubleComplex* tau,
-                                             int*              lwork)
+hipsolverStatus_t hipsolverXgesvdjSetSortEig(hipsolverGesvdjInfo_t info, int sort_eig)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZungqr_bufferSize((cusolverDnHandle_t)handle,
-                                                                  m,
-                                                                  n,
-                                                                  k,
-                                                                  (cuDoubleComplex*)A,
-                                                                  lda,
-                                                                  (cuDoubleComplex*)tau,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(cusolverDnXgesvdjSetSortEig((gesvdjInfo_t)info, sort_eig));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSorgqr(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               k,
-                                  float*            A,
-                                  int               lda,
-                                  float*            tau,
-                                  float*            work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverXgesvdjSetTolerance(hipsolverGesvdjInfo_t info, double tolerance)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSorgqr((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, work, lwork, devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnXgesvdjSetTolerance((gesvdjInfo_t)info, tolerance));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgqr(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               k,
-                                  double*           A,
-                                  int               lda,
-                                  double*           tau,
-                                  double*           work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverXgesvdjGetResidual(hipsolverDnHandle_t   handle,
+                                              hipsolverGesvdjInfo_t info,
+                                              double*               residual)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
     return hipsolver::cuda2hip_status(
-        cusolverDnDorgqr((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, work, lwork, devInfo));
+        cusolverDnXgesvdjGetResidual((cusolverDnHandle_t)handle, (gesvdjInfo_t)info, residual));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungqr(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               k,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  hipFloatComplex*  tau,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverXgesvdjGetSweeps(hipsolverDnHandle_t   handle,
+                                            hipsolverGesvdjInfo_t info,
+                                            int*                  executed_sweeps)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnCungqr((cusolverDnHandle_t)handle,
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       (cuComplex*)tau,
-                                                       (cuComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnXgesvdjGetSweeps(
+        (cusolverDnHandle_t)handle, (gesvdjInfo_t)info, executed_sweeps));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungqr(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               k,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  hipDoubleComplex* tau,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverXgesvdjGetResidualAsync(hipsolverDnHandle_t   handle,
+                                                   hipsolverGesvdjInfo_t info,
+                                                   double*               residual)
 try
 {
     if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+        return HIPSOLVER_STATUS_HANDLE_IS_NULLPTR;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!residual)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZungqr((cusolverDnHandle_t)handle,
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       (cuDoubleComplex*)tau,
-                                                       (cuDoubleComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** ORGTR/UNGTR ********************/
-hipsolverStatus_t hipsolverSorgtr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             float*              A,
-                                             int                 lda,
-                                             float*              tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverXgesvdjGetSweepsAsync(hipsolverDnHandle_t   handle,
+                                                 hipsolverGesvdjInfo_t info,
+                                                 int*                  executed_sweeps)
 try
 {
     if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+        return HIPSOLVER_STATUS_HANDLE_IS_NULLPTR;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!executed_sweeps)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSorgtr_bufferSize(
-        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, tau, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgtr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             double*             A,
-                                             int                 lda,
-                                             double*             tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverXgesvdjGetMaxAsync(hipsolverDnHandle_t   handle,
+                                              hipsolverGesvdjInfo_t info,
+                                              double*               max_residual,
+                                              int*                  max_sweeps)
 try
 {
     if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+        return HIPSOLVER_STATUS_HANDLE_IS_NULLPTR;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!max_residual || !max_sweeps)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDorgtr_bufferSize(
-        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, tau, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungtr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             hipFloatComplex*    tau,
-                                             int*                lwork)
+/******************** SYEVJ PARAMS ********************/
+hipsolverStatus_t hipsolverCreateSyevjInfo(hipsolverSyevjInfo_t* info)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnCungtr_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuComplex*)A,
-                                                                  lda,
-                                                                  (cuComplex*)tau,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(cusolverDnCreateSyevjInfo((syevjInfo_t*)info));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungtr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             hipDoubleComplex*   tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverDestroySyevjInfo(hipsolverSyevjInfo_t info)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZungtr_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuDoubleComplex*)A,
-                                                                  lda,
-                                                                  (cuDoubleComplex*)tau,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(cusolverDnDestroySyevjInfo((syevjInfo_t)info));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSorgtr(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              tau,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverXsyevjSetMaxSweeps(hipsolverSyevjInfo_t info, int max_sweeps)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSorgtr((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       tau,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnXsyevjSetMaxSweeps((syevjInfo_t)info, max_sweeps));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgtr(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             tau,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverXsyevjSetSortEig(hipsolverSyevjInfo_t info, int sort_eig)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDorgtr((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       tau,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnXsyevjSetSortEig((syevjInfo_t)info, sort_eig));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungtr(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  hipFloatComplex*    tau,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverXsyevjSetTolerance(hipsolverSyevjInfo_t info, double tolerance)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnCungtr((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       (cuComplex*)tau,
-                                                       (cuComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnXsyevjSetTolerance((syevjInfo_t)info, tolerance));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungtr(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  hipDoubleComplex*   tau,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverXsyevjGetResidual(hipsolverDnHandle_t  handle,
+                                             hipsolverSyevjInfo_t info,
+                                             double*              residual)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZungtr((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       (cuDoubleComplex*)tau,
-                                                       (cuDoubleComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(
+        cusolverDnXsyevjGetResidual((cusolverDnHandle_t)handle, (syevjInfo_t)info, residual));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** ORMQR/UNMQR ********************/
-hipsolverStatus_t hipsolverSormqr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             int                  k,
-                                             float*               A,
-                                             int                  lda,
-                                             float*               tau,
-                                             float*               C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverXsyevjGetSweeps(hipsolverDnHandle_t  handle,
+                                           hipsolverSyevjInfo_t info,
+                                           int*                 executed_sweeps)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
     return hipsolver::cuda2hip_status(
-        cusolverDnSormqr_bufferSize((cusolverDnHandle_t)handle,
-                                    hipsolver::hip2cuda_side(side),
-                                    hipsolver::hip2cuda_operation(trans),
-                                    m,
-                                    n,
-                                    k,
-                                    A,
-                                    lda,
-                                    tau,
-                                    C,
-                                    ldc,
-                                    lwork));
+        cusolverDnXsyevjGetSweeps((cusolverDnHandle_t)handle, (syevjInfo_t)info, executed_sweeps));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDormqr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             int                  k,
-                                             double*              A,
-                                             int                  lda,
-                                             double*              tau,
-                                             double*              C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverXsyevjGetResidualAsync(hipsolverDnHandle_t  handle,
+                                                  hipsolverSyevjInfo_t info,
+                                                  double*              residual)
 try
 {
     if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+        return HIPSOLVER_STATUS_HANDLE_IS_NULLPTR;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!residual)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnDormqr_bufferSize((cusolverDnHandle_t)handle,
-                                    hipsolver::hip2cuda_side(side),
-                                    hipsolver::hip2cuda_operation(trans),
-                                    m,
-                                    n,
-                                    k,
-                                    A,
-                                    lda,
-                                    tau,
-                                    C,
-                                    ldc,
-                                    lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCunmqr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             int                  k,
-                                             hipFloatComplex*     A,
-                                             int                  lda,
-                                             hipFloatComplex*     tau,
-                                             hipFloatComplex*     C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverXsyevjGetSweepsAsync(hipsolverDnHandle_t  handle,
+                                                hipsolverSyevjInfo_t info,
+                                                int*                 executed_sweeps)
 try
 {
     if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+        return HIPSOLVER_STATUS_HANDLE_IS_NULLPTR;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!executed_sweeps)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnCunmqr_bufferSize((cusolverDnHandle_t)handle,
-                                    hipsolver::hip2cuda_side(side),
-                                    hipsolver::hip2cuda_operation(trans),
-                                    m,
-                                    n,
-                                    k,
-                                    (cuComplex*)A,
-                                    lda,
-                                    (cuComplex*)tau,
-                                    (cuComplex*)C,
-                                    ldc,
-                                    lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZunmqr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             int                  k,
-                                             hipDoubleComplex*    A,
-                                             int                  lda,
-                                             hipDoubleComplex*    tau,
-                                             hipDoubleComplex*    C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverXsyevjGetMaxAsync(hipsolverDnHandle_t  handle,
+                                             hipsolverSyevjInfo_t info,
+                                             double*              max_residual,
+                                             int*                 max_sweeps)
 try
 {
     if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+        return HIPSOLVER_STATUS_HANDLE_IS_NULLPTR;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!max_residual || !max_sweeps)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnZunmqr_bufferSize((cusolverDnHandle_t)handle,
-                                    hipsolver::hip2cuda_side(side),
-                                    hipsolver::hip2cuda_operation(trans),
-                                    m,
-                                    n,
-                                    k,
-                                    (cuDoubleComplex*)A,
-                                    lda,
-                                    (cuDoubleComplex*)tau,
-                                    (cuDoubleComplex*)C,
-                                    ldc,
-                                    lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSormqr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  int                  k,
-                                  float*               A,
-                                  int                  lda,
-                                  float*               tau,
-                                  float*               C,
-                                  int                  ldc,
-                                  float*               work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+/******************** ORGBR/UNGBR ********************/
+hipsolverStatus_t hipsolverSorgbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              tau,
+                                             int*                lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSormqr((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_side(side),
-                                                       hipsolver::hip2cuda_operation(trans),
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       A,
-                                                       lda,
-                                                       tau,
-                                                       C,
-                                                       ldc,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnSorgbr_bufferSize(
+        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_side(side), m, n, k, A, lda, tau, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDormqr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  int                  k,
-                                  double*              A,
-                                  int                  lda,
-                                  double*              tau,
-                                  double*              C,
-                                  int                  ldc,
-                                  double*              work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverDorgbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             tau,
+                                             int*                lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDormqr((cusolverDnHandle_t)handle,
+    return hipsolver::cuda2hip_status(cusolverDnDorgbr_bufferSize(
+        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_side(side), m, n, k, A, lda, tau, lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    tau,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnCungbr_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_side(side),
+                                                                  m,
+                                                                  n,
+                                                                  k,
+                                                                  (cuComplex*)A,
+                                                                  lda,
+                                                                  (cuComplex*)tau,
+                                                                  lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   tau,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnZungbr_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_side(side),
+                                                                  m,
+                                                                  n,
+                                                                  k,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  (cuDoubleComplex*)tau,
+                                                                  lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSorgbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              tau,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnSorgbr((cusolverDnHandle_t)handle,
                                                        hipsolver::hip2cuda_side(side),
-                                                       hipsolver::hip2cuda_operation(trans),
                                                        m,
                                                        n,
                                                        k,
                                                        A,
                                                        lda,
                                                        tau,
-                                                       C,
-                                                       ldc,
                                                        work,
                                                        lwork,
                                                        devInfo));
@@ -1181,36 +899,63 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCunmqr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  int                  k,
-                                  hipFloatComplex*     A,
-                                  int                  lda,
-                                  hipFloatComplex*     tau,
-                                  hipFloatComplex*     C,
-                                  int                  ldc,
-                                  hipFloatComplex*     work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverDorgbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             tau,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCunmqr((cusolverDnHandle_t)handle,
+    return hipsolver::cuda2hip_status(cusolverDnDorgbr((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_side(side),
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       A,
+                                                       lda,
+                                                       tau,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    tau,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnCungbr((cusolverDnHandle_t)handle,
                                                        hipsolver::hip2cuda_side(side),
-                                                       hipsolver::hip2cuda_operation(trans),
                                                        m,
                                                        n,
                                                        k,
                                                        (cuComplex*)A,
                                                        lda,
                                                        (cuComplex*)tau,
-                                                       (cuComplex*)C,
-                                                       ldc,
                                                        (cuComplex*)work,
                                                        lwork,
                                                        devInfo));
@@ -1220,36 +965,30 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZunmqr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  int                  k,
-                                  hipDoubleComplex*    A,
-                                  int                  lda,
-                                  hipDoubleComplex*    tau,
-                                  hipDoubleComplex*    C,
-                                  int                  ldc,
-                                  hipDoubleComplex*    work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverZungbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   tau,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZunmqr((cusolverDnHandle_t)handle,
+    return hipsolver::cuda2hip_status(cusolverDnZungbr((cusolverDnHandle_t)handle,
                                                        hipsolver::hip2cuda_side(side),
-                                                       hipsolver::hip2cuda_operation(trans),
                                                        m,
                                                        n,
                                                        k,
                                                        (cuDoubleComplex*)A,
                                                        lda,
                                                        (cuDoubleComplex*)tau,
-                                                       (cuDoubleComplex*)C,
-                                                       ldc,
                                                        (cuDoubleComplex*)work,
                                                        lwork,
                                                        devInfo));
@@ -1259,259 +998,153 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/******************** ORMTR/UNMTR ********************/
-hipsolverStatus_t hipsolverSormtr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverFillMode_t  uplo,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             float*               A,
-                                             int                  lda,
-                                             float*               tau,
-                                             float*               C,
-                                             int                  ldc,
-                                             int*                 lwork)
+/******************** ORGQR/UNGQR ********************/
+hipsolverStatus_t hipsolverSorgqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int k, float* A, int lda, float* tau, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
     return hipsolver::cuda2hip_status(
-        cusolverDnSormtr_bufferSize((cusolverDnHandle_t)handle,
-                                    hipsolver::hip2cuda_side(side),
-                                    hipsolver::hip2cuda_fill(uplo),
-                                    hipsolver::hip2cuda_operation(trans),
-                                    m,
-                                    n,
-                                    A,
-                                    lda,
-                                    tau,
-                                    C,
-                                    ldc,
-                                    lwork));
+        cusolverDnSorgqr_bufferSize((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDormtr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverFillMode_t  uplo,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             double*              A,
-                                             int                  lda,
-                                             double*              tau,
-                                             double*              C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverDorgqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int k, double* A, int lda, double* tau, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
     return hipsolver::cuda2hip_status(
-        cusolverDnDormtr_bufferSize((cusolverDnHandle_t)handle,
-                                    hipsolver::hip2cuda_side(side),
-                                    hipsolver::hip2cuda_fill(uplo),
-                                    hipsolver::hip2cuda_operation(trans),
-                                    m,
-                                    n,
-                                    A,
-                                    lda,
-                                    tau,
-                                    C,
-                                    ldc,
-                                    lwork));
+        cusolverDnDorgqr_bufferSize((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCunmtr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverFillMode_t  uplo,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             hipFloatComplex*     A,
-                                             int                  lda,
-                                             hipFloatComplex*     tau,
-                                             hipFloatComplex*     C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverCungqr_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             hipFloatComplex*  tau,
+                                             int*              lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnCunmtr_bufferSize((cusolverDnHandle_t)handle,
-                                    hipsolver::hip2cuda_side(side),
-                                    hipsolver::hip2cuda_fill(uplo),
-                                    hipsolver::hip2cuda_operation(trans),
-                                    m,
-                                    n,
-                                    (cuComplex*)A,
-                                    lda,
-                                    (cuComplex*)tau,
-                                    (cuComplex*)C,
-                                    ldc,
-                                    lwork));
+    return hipsolver::cuda2hip_status(cusolverDnCungqr_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, k, (cuComplex*)A, lda, (cuComplex*)tau, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZunmtr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverFillMode_t  uplo,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             hipDoubleComplex*    A,
-                                             int                  lda,
-                                             hipDoubleComplex*    tau,
-                                             hipDoubleComplex*    C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverZungqr_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             hipDoubleComplex* tau,
+                                             int*              lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnZunmtr_bufferSize((cusolverDnHandle_t)handle,
-                                    hipsolver::hip2cuda_side(side),
-                                    hipsolver::hip2cuda_fill(uplo),
-                                    hipsolver::hip2cuda_operation(trans),
-                                    m,
-                                    n,
-                                    (cuDoubleComplex*)A,
-                                    lda,
-                                    (cuDoubleComplex*)tau,
-                                    (cuDoubleComplex*)C,
-                                    ldc,
-                                    lwork));
+    return hipsolver::cuda2hip_status(cusolverDnZungqr_bufferSize((cusolverDnHandle_t)handle,
+                                                                  m,
+                                                                  n,
+                                                                  k,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  (cuDoubleComplex*)tau,
+                                                                  lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSormtr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverFillMode_t  uplo,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  float*               A,
-                                  int                  lda,
-                                  float*               tau,
-                                  float*               C,
-                                  int                  ldc,
-                                  float*               work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverSorgqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  float*            A,
+                                  int               lda,
+                                  float*            tau,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSormtr((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_side(side),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       hipsolver::hip2cuda_operation(trans),
-                                                       m,
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       tau,
-                                                       C,
-                                                       ldc,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(
+        cusolverDnSorgqr((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, work, lwork, devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDormtr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverFillMode_t  uplo,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  double*              A,
-                                  int                  lda,
-                                  double*              tau,
-                                  double*              C,
-                                  int                  ldc,
-                                  double*              work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverDorgqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  double*           A,
+                                  int               lda,
+                                  double*           tau,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDormtr((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_side(side),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       hipsolver::hip2cuda_operation(trans),
-                                                       m,
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       tau,
-                                                       C,
-                                                       ldc,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(
+        cusolverDnDorgqr((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, work, lwork, devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCunmtr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverFillMode_t  uplo,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  hipFloatComplex*     A,
-                                  int                  lda,
-                                  hipFloatComplex*     tau,
-                                  hipFloatComplex*     C,
-                                  int                  ldc,
-                                  hipFloatComplex*     work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverCungqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  tau,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCunmtr((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_side(side),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       hipsolver::hip2cuda_operation(trans),
+    return hipsolver::cuda2hip_status(cusolverDnCungqr((cusolverDnHandle_t)handle,
                                                        m,
                                                        n,
+                                                       k,
                                                        (cuComplex*)A,
                                                        lda,
                                                        (cuComplex*)tau,
-                                                       (cuComplex*)C,
-                                                       ldc,
                                                        (cuComplex*)work,
                                                        lwork,
                                                        devInfo));
@@ -1521,36 +1154,28 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZunmtr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverFillMode_t  uplo,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  hipDoubleComplex*    A,
-                                  int                  lda,
-                                  hipDoubleComplex*    tau,
-                                  hipDoubleComplex*    C,
-                                  int                  ldc,
-                                  hipDoubleComplex*    work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverZungqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* tau,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZunmtr((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_side(side),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       hipsolver::hip2cuda_operation(trans),
+    return hipsolver::cuda2hip_status(cusolverDnZungqr((cusolverDnHandle_t)handle,
                                                        m,
                                                        n,
+                                                       k,
                                                        (cuDoubleComplex*)A,
                                                        lda,
                                                        (cuDoubleComplex*)tau,
-                                                       (cuDoubleComplex*)C,
-                                                       ldc,
                                                        (cuDoubleComplex*)work,
                                                        lwork,
                                                        devInfo));
@@ -1560,139 +1185,175 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/******************** GEBRD ********************/
-hipsolverStatus_t hipsolverSgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+/******************** ORGTR/UNGTR ********************/
+hipsolverStatus_t hipsolverSorgtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              tau,
+                                             int*                lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnSorgtr_bufferSize(
+        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, tau, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverDorgtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             tau,
+                                             int*                lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnDgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnDorgtr_bufferSize(
+        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, tau, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
-try
-{
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+hipsolverStatus_t hipsolverCungtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    tau,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnCgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnCungtr_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuComplex*)A,
+                                                                  lda,
+                                                                  (cuComplex*)tau,
+                                                                  lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverZungtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   tau,
+                                             int*                lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnZgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnZungtr_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  (cuDoubleComplex*)tau,
+                                                                  lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgebrd(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  float*            A,
-                                  int               lda,
-                                  float*            D,
-                                  float*            E,
-                                  float*            tauq,
-                                  float*            taup,
-                                  float*            work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverSorgtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              tau,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSgebrd(
-        (cusolverDnHandle_t)handle, m, n, A, lda, D, E, tauq, taup, work, lwork, devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnSorgtr((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       tau,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgebrd(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  double*           A,
-                                  int               lda,
-                                  double*           D,
-                                  double*           E,
-                                  double*           tauq,
-                                  double*           taup,
-                                  double*           work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverDorgtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             tau,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDgebrd(
-        (cusolverDnHandle_t)handle, m, n, A, lda, D, E, tauq, taup, work, lwork, devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnDorgtr((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       tau,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgebrd(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  float*            D,
-                                  float*            E,
-                                  hipFloatComplex*  tauq,
-                                  hipFloatComplex*  taup,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverCungtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    tau,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCgebrd((cusolverDnHandle_t)handle,
-                                                       m,
+    return hipsolver::cuda2hip_status(cusolverDnCungtr((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
                                                        n,
                                                        (cuComplex*)A,
                                                        lda,
-                                                       D,
-                                                       E,
-                                                       (cuComplex*)tauq,
-                                                       (cuComplex*)taup,
+                                                       (cuComplex*)tau,
                                                        (cuComplex*)work,
                                                        lwork,
                                                        devInfo));
@@ -1702,32 +1363,26 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgebrd(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  double*           D,
-                                  double*           E,
-                                  hipDoubleComplex* tauq,
-                                  hipDoubleComplex* taup,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverZungtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   tau,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZgebrd((cusolverDnHandle_t)handle,
-                                                       m,
+    return hipsolver::cuda2hip_status(cusolverDnZungtr((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
                                                        n,
                                                        (cuDoubleComplex*)A,
                                                        lda,
-                                                       D,
-                                                       E,
-                                                       (cuDoubleComplex*)tauq,
-                                                       (cuDoubleComplex*)taup,
+                                                       (cuDoubleComplex*)tau,
                                                        (cuDoubleComplex*)work,
                                                        lwork,
                                                        devInfo));
@@ -1737,155 +1392,183 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/******************** GELS ********************/
-hipsolverStatus_t hipsolverSSgels_bufferSize(hipsolverHandle_t handle,
-                                             int               m,
-                                             int               n,
-                                             int               nrhs,
-                                             float*            A,
-                                             int               lda,
-                                             float*            B,
-                                             int               ldb,
-                                             float*            X,
-                                             int               ldx,
-                                             size_t*           lwork)
+/******************** ORMQR/UNMQR ********************/
+hipsolverStatus_t hipsolverSormqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             float*               A,
+                                             int                  lda,
+                                             float*               tau,
+                                             float*               C,
+                                             int                  ldc,
+                                             int*                 lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSSgels_bufferSize(
-        (cusolverDnHandle_t)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, nullptr, lwork));
+    return hipsolver::cuda2hip_status(
+        cusolverDnSormqr_bufferSize((cusolverDnHandle_t)handle,
+                                    hipsolver::hip2cuda_side(side),
+                                    hipsolver::hip2cuda_operation(trans),
+                                    m,
+                                    n,
+                                    k,
+                                    A,
+                                    lda,
+                                    tau,
+                                    C,
+                                    ldc,
+                                    lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDDgels_bufferSize(hipsolverHandle_t handle,
-                                             int               m,
-                                             int               n,
-                                             int               nrhs,
-                                             double*           A,
-                                             int               lda,
-                                             double*           B,
-                                             int               ldb,
-                                             double*           X,
-                                             int               ldx,
-                                             size_t*           lwork)
+hipsolverStatus_t hipsolverDormqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             double*              A,
+                                             int                  lda,
+                                             double*              tau,
+                                             double*              C,
+                                             int                  ldc,
+                                             int*                 lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDDgels_bufferSize(
-        (cusolverDnHandle_t)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, nullptr, lwork));
+    return hipsolver::cuda2hip_status(
+        cusolverDnDormqr_bufferSize((cusolverDnHandle_t)handle,
+                                    hipsolver::hip2cuda_side(side),
+                                    hipsolver::hip2cuda_operation(trans),
+                                    m,
+                                    n,
+                                    k,
+                                    A,
+                                    lda,
+                                    tau,
+                                    C,
+                                    ldc,
+                                    lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCCgels_bufferSize(hipsolverHandle_t handle,
-                                             int               m,
-                                             int               n,
-                                             int               nrhs,
-                                             hipFloatComplex*  A,
-                                             int               lda,
-                                             hipFloatComplex*  B,
-                                             int               ldb,
-                                             hipFloatComplex*  X,
-                                             int               ldx,
-                                             size_t*           lwork)
-try
-{
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-
-    return hipsolver::cuda2hip_status(cusolverDnCCgels_bufferSize((cusolverDnHandle_t)handle,
-                                                                  m,
-                                                                  n,
-                                                                  nrhs,
-                                                                  (cuComplex*)A,
-                                                                  lda,
-                                                                  (cuComplex*)B,
-                                                                  ldb,
-                                                                  (cuComplex*)X,
-                                                                  ldx,
-                                                                  nullptr,
-                                                                  lwork));
+hipsolverStatus_t hipsolverCunmqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             hipFloatComplex*     tau,
+                                             hipFloatComplex*     C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnCunmqr_bufferSize((cusolverDnHandle_t)handle,
+                                    hipsolver::hip2cuda_side(side),
+                                    hipsolver::hip2cuda_operation(trans),
+                                    m,
+                                    n,
+                                    k,
+                                    (cuComplex*)A,
+                                    lda,
+                                    (cuComplex*)tau,
+                                    (cuComplex*)C,
+                                    ldc,
+                                    lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZZgels_bufferSize(hipsolverHandle_t handle,
-                                             int               m,
-                                             int               n,
-                                             int               nrhs,
-                                             hipDoubleComplex* A,
-                                             int               lda,
-                                             hipDoubleComplex* B,
-                                             int               ldb,
-                                             hipDoubleComplex* X,
-                                             int               ldx,
-                                             size_t*           lwork)
+hipsolverStatus_t hipsolverZunmqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             hipDoubleComplex*    tau,
+                                             hipDoubleComplex*    C,
+                                             int                  ldc,
+                                             int*                 lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZZgels_bufferSize((cusolverDnHandle_t)handle,
-                                                                  m,
-                                                                  n,
-                                                                  nrhs,
-                                                                  (cuDoubleComplex*)A,
-                                                                  lda,
-                                                                  (cuDoubleComplex*)B,
-                                                                  ldb,
-                                                                  (cuDoubleComplex*)X,
-                                                                  ldx,
-                                                                  nullptr,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(
+        cusolverDnZunmqr_bufferSize((cusolverDnHandle_t)handle,
+                                    hipsolver::hip2cuda_side(side),
+                                    hipsolver::hip2cuda_operation(trans),
+                                    m,
+                                    n,
+                                    k,
+                                    (cuDoubleComplex*)A,
+                                    lda,
+                                    (cuDoubleComplex*)tau,
+                                    (cuDoubleComplex*)C,
+                                    ldc,
+                                    lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSSgels(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               nrhs,
-                                  float*            A,
-                                  int               lda,
-                                  float*            B,
-                                  int               ldb,
-                                  float*            X,
-                                  int               ldx,
-                                  void*             work,
-                                  size_t            lwork,
-                                  int*              niters,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverSormqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  float*               A,
+                                  int                  lda,
+                                  float*               tau,
+                                  float*               C,
+                                  int                  ldc,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSSgels((cusolverDnHandle_t)handle,
+    return hipsolver::cuda2hip_status(cusolverDnSormqr((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_side(side),
+                                                       hipsolver::hip2cuda_operation(trans),
                                                        m,
                                                        n,
-                                                       nrhs,
+                                                       k,
                                                        A,
                                                        lda,
-                                                       B,
-                                                       ldb,
-                                                       X,
-                                                       ldx,
+                                                       tau,
+                                                       C,
+                                                       ldc,
                                                        work,
                                                        lwork,
-                                                       niters,
                                                        devInfo));
 }
 catch(...)
@@ -1893,38 +1576,38 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDDgels(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               nrhs,
-                                  double*           A,
-                                  int               lda,
-                                  double*           B,
-                                  int               ldb,
-                                  double*           X,
-                                  int               ldx,
-                                  void*             work,
-                                  size_t            lwork,
-                                  int*              niters,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverDormqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  double*              A,
+                                  int                  lda,
+                                  double*              tau,
+                                  double*              C,
+                                  int                  ldc,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDDgels((cusolverDnHandle_t)handle,
+    return hipsolver::cuda2hip_status(cusolverDnDormqr((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_side(side),
+                                                       hipsolver::hip2cuda_operation(trans),
                                                        m,
                                                        n,
-                                                       nrhs,
+                                                       k,
                                                        A,
                                                        lda,
-                                                       B,
-                                                       ldb,
-                                                       X,
-                                                       ldx,
+                                                       tau,
+                                                       C,
+                                                       ldc,
                                                        work,
                                                        lwork,
-                                                       niters,
                                                        devInfo));
 }
 catch(...)
@@ -1932,38 +1615,38 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCCgels(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               nrhs,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  hipFloatComplex*  B,
-                                  int               ldb,
-                                  hipFloatComplex*  X,
-                                  int               ldx,
-                                  void*             work,
-                                  size_t            lwork,
-                                  int*              niters,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverCunmqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  hipFloatComplex*     tau,
+                                  hipFloatComplex*     C,
+                                  int                  ldc,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCCgels((cusolverDnHandle_t)handle,
+    return hipsolver::cuda2hip_status(cusolverDnCunmqr((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_side(side),
+                                                       hipsolver::hip2cuda_operation(trans),
                                                        m,
                                                        n,
-                                                       nrhs,
+                                                       k,
                                                        (cuComplex*)A,
                                                        lda,
-                                                       (cuComplex*)B,
-                                                       ldb,
-                                                       (cuComplex*)X,
-                                                       ldx,
-                                                       work,
+                                                       (cuComplex*)tau,
+                                                       (cuComplex*)C,
+                                                       ldc,
+                                                       (cuComplex*)work,
                                                        lwork,
-                                                       niters,
                                                        devInfo));
 }
 catch(...)
@@ -1971,38 +1654,38 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZZgels(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               nrhs,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  hipDoubleComplex* B,
-                                  int               ldb,
-                                  hipDoubleComplex* X,
-                                  int               ldx,
-                                  void*             work,
-                                  size_t            lwork,
-                                  int*              niters,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverZunmqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  hipDoubleComplex*    tau,
+                                  hipDoubleComplex*    C,
+                                  int                  ldc,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZZgels((cusolverDnHandle_t)handle,
+    return hipsolver::cuda2hip_status(cusolverDnZunmqr((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_side(side),
+                                                       hipsolver::hip2cuda_operation(trans),
                                                        m,
                                                        n,
-                                                       nrhs,
+                                                       k,
                                                        (cuDoubleComplex*)A,
                                                        lda,
-                                                       (cuDoubleComplex*)B,
-                                                       ldb,
-                                                       (cuDoubleComplex*)X,
-                                                       ldx,
-                                                       work,
+                                                       (cuDoubleComplex*)tau,
+                                                       (cuDoubleComplex*)C,
+                                                       ldc,
+                                                       (cuDoubleComplex*)work,
                                                        lwork,
-                                                       niters,
                                                        devInfo));
 }
 catch(...)
@@ -2010,131 +1693,259 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/******************** GEQRF ********************/
-hipsolverStatus_t hipsolverSgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+/******************** ORMTR/UNMTR ********************/
+hipsolverStatus_t hipsolverSormtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             float*               A,
+                                             int                  lda,
+                                             float*               tau,
+                                             float*               C,
+                                             int                  ldc,
+                                             int*                 lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
     return hipsolver::cuda2hip_status(
-        cusolverDnSgeqrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+        cusolverDnSormtr_bufferSize((cusolverDnHandle_t)handle,
+                                    hipsolver::hip2cuda_side(side),
+                                    hipsolver::hip2cuda_fill(uplo),
+                                    hipsolver::hip2cuda_operation(trans),
+                                    m,
+                                    n,
+                                    A,
+                                    lda,
+                                    tau,
+                                    C,
+                                    ldc,
+                                    lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverDormtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             double*              A,
+                                             int                  lda,
+                                             double*              tau,
+                                             double*              C,
+                                             int                  ldc,
+                                             int*                 lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
     return hipsolver::cuda2hip_status(
-        cusolverDnDgeqrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+        cusolverDnDormtr_bufferSize((cusolverDnHandle_t)handle,
+                                    hipsolver::hip2cuda_side(side),
+                                    hipsolver::hip2cuda_fill(uplo),
+                                    hipsolver::hip2cuda_operation(trans),
+                                    m,
+                                    n,
+                                    A,
+                                    lda,
+                                    tau,
+                                    C,
+                                    ldc,
+                                    lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverCunmtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             hipFloatComplex*     tau,
+                                             hipFloatComplex*     C,
+                                             int                  ldc,
+                                             int*                 lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
     return hipsolver::cuda2hip_status(
-        cusolverDnCgeqrf_bufferSize((cusolverDnHandle_t)handle, m, n, (cuComplex*)A, lda, lwork));
+        cusolverDnCunmtr_bufferSize((cusolverDnHandle_t)handle,
+                                    hipsolver::hip2cuda_side(side),
+                                    hipsolver::hip2cuda_fill(uplo),
+                                    hipsolver::hip2cuda_operation(trans),
+                                    m,
+                                    n,
+                                    (cuComplex*)A,
+                                    lda,
+                                    (cuComplex*)tau,
+                                    (cuComplex*)C,
+                                    ldc,
+                                    lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverZunmtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             hipDoubleComplex*    tau,
+                                             hipDoubleComplex*    C,
+                                             int                  ldc,
+                                             int*                 lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZgeqrf_bufferSize(
-        (cusolverDnHandle_t)handle, m, n, (cuDoubleComplex*)A, lda, lwork));
+    return hipsolver::cuda2hip_status(
+        cusolverDnZunmtr_bufferSize((cusolverDnHandle_t)handle,
+                                    hipsolver::hip2cuda_side(side),
+                                    hipsolver::hip2cuda_fill(uplo),
+                                    hipsolver::hip2cuda_operation(trans),
+                                    m,
+                                    n,
+                                    (cuDoubleComplex*)A,
+                                    lda,
+                                    (cuDoubleComplex*)tau,
+                                    (cuDoubleComplex*)C,
+                                    ldc,
+                                    lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgeqrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  float*            A,
-                                  int               lda,
-                                  float*            tau,
-                                  float*            work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverSormtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  float*               A,
+                                  int                  lda,
+                                  float*               tau,
+                                  float*               C,
+                                  int                  ldc,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSgeqrf((cusolverDnHandle_t)handle, m, n, A, lda, tau, work, lwork, devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnSormtr((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_side(side),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       hipsolver::hip2cuda_operation(trans),
+                                                       m,
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       tau,
+                                                       C,
+                                                       ldc,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgeqrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  double*           A,
-                                  int               lda,
-                                  double*           tau,
-                                  double*           work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverDormtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  double*              A,
+                                  int                  lda,
+                                  double*              tau,
+                                  double*              C,
+                                  int                  ldc,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnDgeqrf((cusolverDnHandle_t)handle, m, n, A, lda, tau, work, lwork, devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnDormtr((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_side(side),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       hipsolver::hip2cuda_operation(trans),
+                                                       m,
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       tau,
+                                                       C,
+                                                       ldc,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgeqrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  hipFloatComplex*  tau,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverCunmtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  hipFloatComplex*     tau,
+                                  hipFloatComplex*     C,
+                                  int                  ldc,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCgeqrf((cusolverDnHandle_t)handle,
+    return hipsolver::cuda2hip_status(cusolverDnCunmtr((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_side(side),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       hipsolver::hip2cuda_operation(trans),
                                                        m,
                                                        n,
                                                        (cuComplex*)A,
                                                        lda,
                                                        (cuComplex*)tau,
+                                                       (cuComplex*)C,
+                                                       ldc,
                                                        (cuComplex*)work,
                                                        lwork,
                                                        devInfo));
@@ -2144,26 +1955,36 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgeqrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  hipDoubleComplex* tau,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverZunmtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  hipDoubleComplex*    tau,
+                                  hipDoubleComplex*    C,
+                                  int                  ldc,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZgeqrf((cusolverDnHandle_t)handle,
+    return hipsolver::cuda2hip_status(cusolverDnZunmtr((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_side(side),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       hipsolver::hip2cuda_operation(trans),
                                                        m,
                                                        n,
                                                        (cuDoubleComplex*)A,
                                                        lda,
                                                        (cuDoubleComplex*)tau,
+                                                       (cuDoubleComplex*)C,
+                                                       ldc,
                                                        (cuDoubleComplex*)work,
                                                        lwork,
                                                        devInfo));
@@ -2173,233 +1994,141 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/******************** GESV ********************/
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgesv_bufferSize(hipsolverHandle_t handle,
-                                                              int               n,
-                                                              int               nrhs,
-                                                              float*            A,
-                                                              int               lda,
-                                                              int*              devIpiv,
-                                                              float*            B,
-                                                              int               ldb,
-                                                              float*            X,
-                                                              int               ldx,
-                                                              size_t*           lwork)
+/******************** GEBRD ********************/
+hipsolverStatus_t hipsolverSgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSSgesv_bufferSize(
-        (cusolverDnHandle_t)handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, nullptr, lwork));
+    return hipsolver::cuda2hip_status(
+        cusolverDnSgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgesv_bufferSize(hipsolverHandle_t handle,
-                                                              int               n,
-                                                              int               nrhs,
-                                                              double*           A,
-                                                              int               lda,
-                                                              int*              devIpiv,
-                                                              double*           B,
-                                                              int               ldb,
-                                                              double*           X,
-                                                              int               ldx,
-                                                              size_t*           lwork)
+hipsolverStatus_t hipsolverDgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDDgesv_bufferSize(
-        (cusolverDnHandle_t)handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, nullptr, lwork));
+    return hipsolver::cuda2hip_status(
+        cusolverDnDgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgesv_bufferSize(hipsolverHandle_t handle,
-                                                              int               n,
-                                                              int               nrhs,
-                                                              hipFloatComplex*  A,
-                                                              int               lda,
-                                                              int*              devIpiv,
-                                                              hipFloatComplex*  B,
-                                                              int               ldb,
-                                                              hipFloatComplex*  X,
-                                                              int               ldx,
-                                                              size_t*           lwork)
+hipsolverStatus_t hipsolverCgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCCgesv_bufferSize((cusolverDnHandle_t)handle,
-                                                                  n,
-                                                                  nrhs,
-                                                                  (cuComplex*)A,
-                                                                  lda,
-                                                                  devIpiv,
-                                                                  (cuComplex*)B,
-                                                                  ldb,
-                                                                  (cuComplex*)X,
-                                                                  ldx,
-                                                                  nullptr,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(
+        cusolverDnCgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgesv_bufferSize(hipsolverHandle_t handle,
-                                                              int               n,
-                                                              int               nrhs,
-                                                              hipDoubleComplex* A,
-                                                              int               lda,
-                                                              int*              devIpiv,
-                                                              hipDoubleComplex* B,
-                                                              int               ldb,
-                                                              hipDoubleComplex* X,
-                                                              int               ldx,
-                                                              size_t*           lwork)
+hipsolverStatus_t hipsolverZgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZZgesv_bufferSize((cusolverDnHandle_t)handle,
-                                                                  n,
-                                                                  nrhs,
-                                                                  (cuDoubleComplex*)A,
-                                                                  lda,
-                                                                  devIpiv,
-                                                                  (cuDoubleComplex*)B,
-                                                                  ldb,
-                                                                  (cuDoubleComplex*)X,
-                                                                  ldx,
-                                                                  nullptr,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(
+        cusolverDnZgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgesv(hipsolverHandle_t handle,
-                                                   int               n,
-                                                   int               nrhs,
-                                                   float*            A,
-                                                   int               lda,
-                                                   int*              devIpiv,
-                                                   float*            B,
-                                                   int               ldb,
-                                                   float*            X,
-                                                   int               ldx,
-                                                   void*             work,
-                                                   size_t            lwork,
-                                                   int*              niters,
-                                                   int*              devInfo)
+hipsolverStatus_t hipsolverSgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            D,
+                                  float*            E,
+                                  float*            tauq,
+                                  float*            taup,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSSgesv((cusolverDnHandle_t)handle,
-                                                       n,
-                                                       nrhs,
-                                                       A,
-                                                       lda,
-                                                       devIpiv,
-                                                       B,
-                                                       ldb,
-                                                       X,
-                                                       ldx,
-                                                       work,
-                                                       lwork,
-                                                       niters,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnSgebrd(
+        (cusolverDnHandle_t)handle, m, n, A, lda, D, E, tauq, taup, work, lwork, devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgesv(hipsolverHandle_t handle,
-                                                   int               n,
-                                                   int               nrhs,
-                                                   double*           A,
-                                                   int               lda,
-                                                   int*              devIpiv,
-                                                   double*           B,
-                                                   int               ldb,
-                                                   double*           X,
-                                                   int               ldx,
-                                                   void*             work,
-                                                   size_t            lwork,
-                                                   int*              niters,
-                                                   int*              devInfo)
+hipsolverStatus_t hipsolverDgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           D,
+                                  double*           E,
+                                  double*           tauq,
+                                  double*           taup,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDDgesv((cusolverDnHandle_t)handle,
-                                                       n,
-                                                       nrhs,
-                                                       A,
-                                                       lda,
-                                                       devIpiv,
-                                                       B,
-                                                       ldb,
-                                                       X,
-                                                       ldx,
-                                                       work,
-                                                       lwork,
-                                                       niters,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnDgebrd(
+        (cusolverDnHandle_t)handle, m, n, A, lda, D, E, tauq, taup, work, lwork, devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgesv(hipsolverHandle_t handle,
-                                                   int               n,
-                                                   int               nrhs,
-                                                   hipFloatComplex*  A,
-                                                   int               lda,
-                                                   int*              devIpiv,
-                                                   hipFloatComplex*  B,
-                                                   int               ldb,
-                                                   hipFloatComplex*  X,
-                                                   int               ldx,
-                                                   void*             work,
-                                                   size_t            lwork,
-                                                   int*              niters,
-                                                   int*              devInfo)
+hipsolverStatus_t hipsolverCgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  float*            D,
+                                  float*            E,
+                                  hipFloatComplex*  tauq,
+                                  hipFloatComplex*  taup,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCCgesv((cusolverDnHandle_t)handle,
+    return hipsolver::cuda2hip_status(cusolverDnCgebrd((cusolverDnHandle_t)handle,
+                                                       m,
                                                        n,
-                                                       nrhs,
                                                        (cuComplex*)A,
                                                        lda,
-                                                       devIpiv,
-                                                       (cuComplex*)B,
-                                                       ldb,
-                                                       (cuComplex*)X,
-                                                       ldx,
-                                                       work,
+                                                       D,
+                                                       E,
+                                                       (cuComplex*)tauq,
+                                                       (cuComplex*)taup,
+                                                       (cuComplex*)work,
                                                        lwork,
-                                                       niters,
                                                        devInfo));
 }
 catch(...)
@@ -2407,38 +2136,34 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgesv(hipsolverHandle_t handle,
-                                                   int               n,
-                                                   int               nrhs,
-                                                   hipDoubleComplex* A,
-                                                   int               lda,
-                                                   int*              devIpiv,
-                                                   hipDoubleComplex* B,
-                                                   int               ldb,
-                                                   hipDoubleComplex* X,
-                                                   int               ldx,
-                                                   void*             work,
-                                                   size_t            lwork,
-                                                   int*              niters,
-                                                   int*              devInfo)
+hipsolverStatus_t hipsolverZgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  double*           D,
+                                  double*           E,
+                                  hipDoubleComplex* tauq,
+                                  hipDoubleComplex* taup,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZZgesv((cusolverDnHandle_t)handle,
+    return hipsolver::cuda2hip_status(cusolverDnZgebrd((cusolverDnHandle_t)handle,
+                                                       m,
                                                        n,
-                                                       nrhs,
                                                        (cuDoubleComplex*)A,
                                                        lda,
-                                                       devIpiv,
-                                                       (cuDoubleComplex*)B,
-                                                       ldb,
-                                                       (cuDoubleComplex*)X,
-                                                       ldx,
-                                                       work,
+                                                       D,
+                                                       E,
+                                                       (cuDoubleComplex*)tauq,
+                                                       (cuDoubleComplex*)taup,
+                                                       (cuDoubleComplex*)work,
                                                        lwork,
-                                                       niters,
                                                        devInfo));
 }
 catch(...)
@@ -2446,103 +2171,155 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/******************** GESVD ********************/
-hipsolverStatus_t hipsolverSgesvd_bufferSize(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+/******************** GELS ********************/
+hipsolverStatus_t hipsolverSSgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             float*            A,
+                                             int               lda,
+                                             float*            B,
+                                             int               ldb,
+                                             float*            X,
+                                             int               ldx,
+                                             size_t*           lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnSSgels_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, nullptr, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgesvd_bufferSize(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverDDgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             double*           A,
+                                             int               lda,
+                                             double*           B,
+                                             int               ldb,
+                                             double*           X,
+                                             int               ldx,
+                                             size_t*           lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnDDgels_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, nullptr, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgesvd_bufferSize(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverCCgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             hipFloatComplex*  B,
+                                             int               ldb,
+                                             hipFloatComplex*  X,
+                                             int               ldx,
+                                             size_t*           lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnCCgels_bufferSize((cusolverDnHandle_t)handle,
+                                                                  m,
+                                                                  n,
+                                                                  nrhs,
+                                                                  (cuComplex*)A,
+                                                                  lda,
+                                                                  (cuComplex*)B,
+                                                                  ldb,
+                                                                  (cuComplex*)X,
+                                                                  ldx,
+                                                                  nullptr,
+                                                                  lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgesvd_bufferSize(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverZZgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             hipDoubleComplex* B,
+                                             int               ldb,
+                                             hipDoubleComplex* X,
+                                             int               ldx,
+                                             size_t*           lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnZZgels_bufferSize((cusolverDnHandle_t)handle,
+                                                                  m,
+                                                                  n,
+                                                                  nrhs,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  (cuDoubleComplex*)B,
+                                                                  ldb,
+                                                                  (cuDoubleComplex*)X,
+                                                                  ldx,
+                                                                  nullptr,
+                                                                  lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgesvd(hipsolverHandle_t handle,
-                                  signed char       jobu,
-                                  signed char       jobv,
+hipsolverStatus_t hipsolverSSgels(hipsolverHandle_t handle,
                                   int               m,
                                   int               n,
+                                  int               nrhs,
                                   float*            A,
                                   int               lda,
-                                  float*            S,
-                                  float*            U,
-                                  int               ldu,
-                                  float*            V,
-                                  int               ldv,
-                                  float*            work,
-                                  int               lwork,
-                                  float*            rwork,
+                                  float*            B,
+                                  int               ldb,
+                                  float*            X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
                                   int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSgesvd((cusolverDnHandle_t)handle,
-                                                       jobu,
-                                                       jobv,
+    return hipsolver::cuda2hip_status(cusolverDnSSgels((cusolverDnHandle_t)handle,
                                                        m,
                                                        n,
+                                                       nrhs,
                                                        A,
                                                        lda,
-                                                       S,
-                                                       U,
-                                                       ldu,
-                                                       V,
-                                                       ldv,
+                                                       B,
+                                                       ldb,
+                                                       X,
+                                                       ldx,
                                                        work,
                                                        lwork,
-                                                       rwork,
+                                                       niters,
                                                        devInfo));
 }
 catch(...)
@@ -2550,42 +2327,38 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgesvd(hipsolverHandle_t handle,
-                                  signed char       jobu,
-                                  signed char       jobv,
+hipsolverStatus_t hipsolverDDgels(hipsolverHandle_t handle,
                                   int               m,
                                   int               n,
+                                  int               nrhs,
                                   double*           A,
                                   int               lda,
-                                  double*           S,
-                                  double*           U,
-                                  int               ldu,
-                                  double*           V,
-                                  int               ldv,
-                                  double*           work,
-                                  int               lwork,
-                                  double*           rwork,
+                                  double*           B,
+                                  int               ldb,
+                                  double*           X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
                                   int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDgesvd((cusolverDnHandle_t)handle,
-                                                       jobu,
-                                                       jobv,
+    return hipsolver::cuda2hip_status(cusolverDnDDgels((cusolverDnHandle_t)handle,
                                                        m,
                                                        n,
+                                                       nrhs,
                                                        A,
                                                        lda,
-                                                       S,
-                                                       U,
-                                                       ldu,
-                                                       V,
-                                                       ldv,
+                                                       B,
+                                                       ldb,
+                                                       X,
+                                                       ldx,
                                                        work,
                                                        lwork,
-                                                       rwork,
+                                                       niters,
                                                        devInfo));
 }
 catch(...)
@@ -2593,42 +2366,38 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgesvd(hipsolverHandle_t handle,
-                                  signed char       jobu,
-                                  signed char       jobv,
+hipsolverStatus_t hipsolverCCgels(hipsolverHandle_t handle,
                                   int               m,
                                   int               n,
+                                  int               nrhs,
                                   hipFloatComplex*  A,
                                   int               lda,
-                                  float*            S,
-                                  hipFloatComplex*  U,
-                                  int               ldu,
-                                  hipFloatComplex*  V,
-                                  int               ldv,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  float*            rwork,
+                                  hipFloatComplex*  B,
+                                  int               ldb,
+                                  hipFloatComplex*  X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
                                   int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCgesvd((cusolverDnHandle_t)handle,
-                                                       jobu,
-                                                       jobv,
+    return hipsolver::cuda2hip_status(cusolverDnCCgels((cusolverDnHandle_t)handle,
                                                        m,
                                                        n,
+                                                       nrhs,
                                                        (cuComplex*)A,
                                                        lda,
-                                                       S,
-                                                       (cuComplex*)U,
-                                                       ldu,
-                                                       (cuComplex*)V,
-                                                       ldv,
-                                                       (cuComplex*)work,
+                                                       (cuComplex*)B,
+                                                       ldb,
+                                                       (cuComplex*)X,
+                                                       ldx,
+                                                       work,
                                                        lwork,
-                                                       rwork,
+                                                       niters,
                                                        devInfo));
 }
 catch(...)
@@ -2636,42 +2405,38 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgesvd(hipsolverHandle_t handle,
-                                  signed char       jobu,
-                                  signed char       jobv,
+hipsolverStatus_t hipsolverZZgels(hipsolverHandle_t handle,
                                   int               m,
                                   int               n,
+                                  int               nrhs,
                                   hipDoubleComplex* A,
                                   int               lda,
-                                  double*           S,
-                                  hipDoubleComplex* U,
-                                  int               ldu,
-                                  hipDoubleComplex* V,
-                                  int               ldv,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  double*           rwork,
+                                  hipDoubleComplex* B,
+                                  int               ldb,
+                                  hipDoubleComplex* X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
                                   int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZgesvd((cusolverDnHandle_t)handle,
-                                                       jobu,
-                                                       jobv,
+    return hipsolver::cuda2hip_status(cusolverDnZZgels((cusolverDnHandle_t)handle,
                                                        m,
                                                        n,
+                                                       nrhs,
                                                        (cuDoubleComplex*)A,
                                                        lda,
-                                                       S,
-                                                       (cuDoubleComplex*)U,
-                                                       ldu,
-                                                       (cuDoubleComplex*)V,
-                                                       ldv,
-                                                       (cuDoubleComplex*)work,
+                                                       (cuDoubleComplex*)B,
+                                                       ldb,
+                                                       (cuDoubleComplex*)X,
+                                                       ldx,
+                                                       work,
                                                        lwork,
-                                                       rwork,
+                                                       niters,
                                                        devInfo));
 }
 catch(...)
@@ -2679,1257 +2444,979 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/******************** GESVDJ ********************/
-hipsolverStatus_t hipsolverSgesvdj_bufferSize(hipsolverDnHandle_t   handle,
-                                              hipsolverEigMode_t    jobz,
-                                              int                   econ,
-                                              int                   m,
-                                              int                   n,
-                                              const float*          A,
-                                              int                   lda,
-                                              const float*          S,
-                                              const float*          U,
-                                              int                   ldu,
-                                              const float*          V,
-                                              int                   ldv,
-                                              int*                  lwork,
-                                              hipsolverGesvdjInfo_t info)
-try
-{
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+hipsolverStatus_t hipsolverDSgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             double*           A,
+                                             int               lda,
+                                             double*           B,
+                                             int               ldb,
+                                             double*           X,
+                                             int               ldx,
+                                             size_t*           lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSgesvdj_bufferSize((cusolverDnHandle_t)handle,
-                                                                   hipsolver::hip2cuda_evect(jobz),
-                                                                   econ,
-                                                                   m,
-                                                                   n,
-                                                                   A,
-                                                                   lda,
-                                                                   S,
-                                                                   U,
-                                                                   ldu,
-                                                                   V,
-                                                                   ldv,
-                                                                   lwork,
-                                                                   (gesvdjInfo_t)info));
+    return hipsolver::cuda2hip_status(cusolverDnDSgels_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, nullptr, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgesvdj_bufferSize(hipsolverDnHandle_t   handle,
-                                              hipsolverEigMode_t    jobz,
-                                              int                   econ,
-                                              int                   m,
-                                              int                   n,
-                                              const double*         A,
-                                              int                   lda,
-                                              const double*         S,
-                                              const double*         U,
-                                              int                   ldu,
-                                              const double*         V,
-                                              int                   ldv,
-                                              int*                  lwork,
-                                              hipsolverGesvdjInfo_t info)
+hipsolverStatus_t hipsolverDHgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             double*           A,
+                                             int               lda,
+                                             double*           B,
+                                             int               ldb,
+                                             double*           X,
+                                             int               ldx,
+                                             size_t*           lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDgesvdj_bufferSize((cusolverDnHandle_t)handle,
-                                                                   hipsolver::hip2cuda_evect(jobz),
-                                                                   econ,
-                                                                   m,
-                                                                   n,
-                                                                   A,
-                                                                   lda,
-                                                                   S,
-                                                                   U,
-                                                                   ldu,
-                                                                   V,
-                                                                   ldv,
-                                                                   lwork,
-                                                                   (gesvdjInfo_t)info));
+    return hipsolver::cuda2hip_status(cusolverDnDHgels_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, nullptr, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgesvdj_bufferSize(hipsolverDnHandle_t    handle,
-                                              hipsolverEigMode_t     jobz,
-                                              int                    econ,
-                                              int                    m,
-                                              int                    n,
-                                              const hipFloatComplex* A,
-                                              int                    lda,
-                                              const float*           S,
-                                              const hipFloatComplex* U,
-                                              int                    ldu,
-                                              const hipFloatComplex* V,
-                                              int                    ldv,
-                                              int*                   lwork,
-                                              hipsolverGesvdjInfo_t  info)
+hipsolverStatus_t hipsolverZCgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             hipDoubleComplex* B,
+                                             int               ldb,
+                                             hipDoubleComplex* X,
+                                             int               ldx,
+                                             size_t*           lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnCgesvdj_bufferSize((cusolverDnHandle_t)handle,
-                                                                   hipsolver::hip2cuda_evect(jobz),
-                                                                   econ,
-                                                                   m,
-                                                                   n,
-                                                                   (cuComplex*)A,
-                                                                   lda,
-                                                                   S,
-                                                                   (cuComplex*)U,
-                                                                   ldu,
-                                                                   (cuComplex*)V,
-                                                                   ldv,
-                                                                   lwork,
-                                                                   (gesvdjInfo_t)info));
+    return hipsolver::cuda2hip_status(cusolverDnZCgels_bufferSize((cusolverDnHandle_t)handle,
+                                                                  m,
+                                                                  n,
+                                                                  nrhs,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  (cuDoubleComplex*)B,
+                                                                  ldb,
+                                                                  (cuDoubleComplex*)X,
+                                                                  ldx,
+                                                                  nullptr,
+                                                                  lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgesvdj_bufferSize(hipsolverDnHandle_t     handle,
-                                              hipsolverEigMode_t      jobz,
-                                              int                     econ,
-                                              int                     m,
-                                              int                     n,
-                                              const hipDoubleComplex* A,
-                                              int                     lda,
-                                              const double*           S,
-                                              const hipDoubleComplex* U,
-                                              int                     ldu,
-                                              const hipDoubleComplex* V,
-                                              int                     ldv,
-                                              int*                    lwork,
-                                              hipsolverGesvdjInfo_t   info)
+hipsolverStatus_t hipsolverDSgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  double*           A,
+                                  int               lda,
+                                  double*           B,
+                                  int               ldb,
+                                  double*           X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZgesvdj_bufferSize((cusolverDnHandle_t)handle,
-                                                                   hipsolver::hip2cuda_evect(jobz),
-                                                                   econ,
-                                                                   m,
-                                                                   n,
-                                                                   (cuDoubleComplex*)A,
-                                                                   lda,
-                                                                   S,
-                                                                   (cuDoubleComplex*)U,
-                                                                   ldu,
-                                                                   (cuDoubleComplex*)V,
-                                                                   ldv,
-                                                                   lwork,
-                                                                   (gesvdjInfo_t)info));
+    return hipsolver::cuda2hip_status(cusolverDnDSgels((cusolverDnHandle_t)handle,
+                                                       m,
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       lda,
+                                                       B,
+                                                       ldb,
+                                                       X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgesvdj(hipsolverDnHandle_t   handle,
-                                   hipsolverEigMode_t    jobz,
-                                   int                   econ,
-                                   int                   m,
-                                   int                   n,
-                                   float*                A,
-                                   int                   lda,
-                                   float*                S,
-                                   float*                U,
-                                   int                   ldu,
-                                   float*                V,
-                                   int                   ldv,
-                                   float*                work,
-                                   int                   lwork,
-                                   int*                  devInfo,
-                                   hipsolverGesvdjInfo_t info)
+hipsolverStatus_t hipsolverDHgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  double*           A,
+                                  int               lda,
+                                  double*           B,
+                                  int               ldb,
+                                  double*           X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSgesvdj((cusolverDnHandle_t)handle,
-                                                        hipsolver::hip2cuda_evect(jobz),
-                                                        econ,
-                                                        m,
-                                                        n,
-                                                        A,
-                                                        lda,
-                                                        S,
-                                                        U,
-                                                        ldu,
-                                                        V,
-                                                        ldv,
-                                                        work,
-                                                        lwork,
-                                                        devInfo,
-                                                        (gesvdjInfo_t)info));
+    return hipsolver::cuda2hip_status(cusolverDnDHgels((cusolverDnHandle_t)handle,
+                                                       m,
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       lda,
+                                                       B,
+                                                       ldb,
+                                                       X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgesvdj(hipsolverDnHandle_t   handle,
-                                   hipsolverEigMode_t    jobz,
-                                   int                   econ,
-                                   int                   m,
-                                   int                   n,
-                                   double*               A,
-                                   int                   lda,
-                                   double*               S,
-                                   double*               U,
-                                   int                   ldu,
-                                   double*               V,
-                                   int                   ldv,
-                                   double*               work,
-                                   int                   lwork,
-                                   int*                  devInfo,
-                                   hipsolverGesvdjInfo_t info)
-try
-{
-    if(!handle)
+hipsolverStatus_t hipsolverZCgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* B,
+                                  int               ldb,
+                                  hipDoubleComplex* X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
+try
+{
+    if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDgesvdj((cusolverDnHandle_t)handle,
-                                                        hipsolver::hip2cuda_evect(jobz),
-                                                        econ,
-                                                        m,
-                                                        n,
-                                                        A,
-                                                        lda,
-                                                        S,
-                                                        U,
-                                                        ldu,
-                                                        V,
-                                                        ldv,
-                                                        work,
-                                                        lwork,
-                                                        devInfo,
-                                                        (gesvdjInfo_t)info));
+    return hipsolver::cuda2hip_status(cusolverDnZCgels((cusolverDnHandle_t)handle,
+                                                       m,
+                                                       n,
+                                                       nrhs,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       (cuDoubleComplex*)B,
+                                                       ldb,
+                                                       (cuDoubleComplex*)X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgesvdj(hipsolverDnHandle_t   handle,
-                                   hipsolverEigMode_t    jobz,
-                                   int                   econ,
-                                   int                   m,
-                                   int                   n,
-                                   hipFloatComplex*      A,
-                                   int                   lda,
-                                   float*                S,
-                                   hipFloatComplex*      U,
-                                   int                   ldu,
-                                   hipFloatComplex*      V,
-                                   int                   ldv,
-                                   hipFloatComplex*      work,
-                                   int                   lwork,
-                                   int*                  devInfo,
-                                   hipsolverGesvdjInfo_t info)
+/******************** GEQRF ********************/
+hipsolverStatus_t hipsolverSgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnCgesvdj((cusolverDnHandle_t)handle,
-                                                        hipsolver::hip2cuda_evect(jobz),
-                                                        econ,
-                                                        m,
-                                                        n,
-                                                        (cuComplex*)A,
-                                                        lda,
-                                                        S,
-                                                        (cuComplex*)U,
-                                                        ldu,
-                                                        (cuComplex*)V,
-                                                        ldv,
-                                                        (cuComplex*)work,
-                                                        lwork,
-                                                        devInfo,
-                                                        (gesvdjInfo_t)info));
+    return hipsolver::cuda2hip_status(
+        cusolverDnSgeqrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgesvdj(hipsolverDnHandle_t   handle,
-                                   hipsolverEigMode_t    jobz,
-                                   int                   econ,
-                                   int                   m,
-                                   int                   n,
-                                   hipDoubleComplex*     A,
-                                   int                   lda,
-                                   double*               S,
-                                   hipDoubleComplex*     U,
-                                   int                   ldu,
-                                   hipDoubleComplex*     V,
-                                   int                   ldv,
-                                   hipDoubleComplex*     work,
-                                   int                   lwork,
-                                   int*                  devInfo,
-                                   hipsolverGesvdjInfo_t info)
+hipsolverStatus_t hipsolverDgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZgesvdj((cusolverDnHandle_t)handle,
-                                                        hipsolver::hip2cuda_evect(jobz),
-                                                        econ,
-                                                        m,
-                                                        n,
-                                                        (cuDoubleComplex*)A,
-                                                        lda,
-                                                        S,
-                                                        (cuDoubleComplex*)U,
-                                                        ldu,
-                                                        (cuDoubleComplex*)V,
-                                                        ldv,
-                                                        (cuDoubleComplex*)work,
-                                                        lwork,
-                                                        devInfo,
-                                                        (gesvdjInfo_t)info));
+    return hipsolver::cuda2hip_status(
+        cusolverDnDgeqrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** GESVDJ_BATCHED ********************/
-hipsolverStatus_t hipsolverSgesvdjBatched_bufferSize(hipsolverDnHandle_t   handle,
-                                                     hipsolverEigMode_t    jobz,
-                                                     int                   m,
-                                                     int                   n,
-                                                     const float*          A,
-                                                     int                   lda,
-                                                     const float*          S,
-                                                     const float*          U,
-                                                     int                   ldu,
-                                                     const float*          V,
-                                                     int                   ldv,
-                                                     int*                  lwork,
-                                                     hipsolverGesvdjInfo_t info,
-                                                     int                   batch_count)
+hipsolverStatus_t hipsolverCgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
     return hipsolver::cuda2hip_status(
-        cusolverDnSgesvdjBatched_bufferSize((cusolverDnHandle_t)handle,
-                                            hipsolver::hip2cuda_evect(jobz),
-                                            m,
-                                            n,
-                                            A,
-                                            lda,
-                                            S,
-                                            U,
-                                            ldu,
-                                            V,
-                                            ldv,
-                                            lwork,
-                                            (gesvdjInfo_t)info,
-                                            batch_count));
+        cusolverDnCgeqrf_bufferSize((cusolverDnHandle_t)handle, m, n, (cuComplex*)A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgesvdjBatched_bufferSize(hipsolverDnHandle_t   handle,
-                                                     hipsolverEigMode_t    jobz,
-                                                     int                   m,
-                                                     int                   n,
-                                                     const double*         A,
-                                                     int                   lda,
-                                                     const double*         S,
-                                                     const double*         U,
-                                                     int                   ldu,
-                                                     const double*         V,
-                                                     int                   ldv,
-                                                     int*                  lwork,
-                                                     hipsolverGesvdjInfo_t info,
-                                                     int                   batch_count)
+hipsolverStatus_t hipsolverZgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnDgesvdjBatched_bufferSize((cusolverDnHandle_t)handle,
-                                            hipsolver::hip2cuda_evect(jobz),
-                                            m,
-                                            n,
-                                            A,
-                                            lda,
-                                            S,
-                                            U,
-                                            ldu,
-                                            V,
-                                            ldv,
-                                            lwork,
-                                            (gesvdjInfo_t)info,
-                                            batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnZgeqrf_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, (cuDoubleComplex*)A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgesvdjBatched_bufferSize(hipsolverDnHandle_t    handle,
-                                                     hipsolverEigMode_t     jobz,
-                                                     int                    m,
-                                                     int                    n,
-                                                     const hipFloatComplex* A,
-                                                     int                    lda,
-                                                     const float*           S,
-                                                     const hipFloatComplex* U,
-                                                     int                    ldu,
-                                                     const hipFloatComplex* V,
-                                                     int                    ldv,
-                                                     int*                   lwork,
-                                                     hipsolverGesvdjInfo_t  info,
-                                                     int                    batch_count)
+hipsolverStatus_t hipsolverSgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            tau,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
     return hipsolver::cuda2hip_status(
-        cusolverDnCgesvdjBatched_bufferSize((cusolverDnHandle_t)handle,
-                                            hipsolver::hip2cuda_evect(jobz),
-                                            m,
-                                            n,
-                                            (cuComplex*)A,
-                                            lda,
-                                            S,
-                                            (cuComplex*)U,
-                                            ldu,
-                                            (cuComplex*)V,
-                                            ldv,
-                                            lwork,
-                                            (gesvdjInfo_t)info,
-                                            batch_count));
+        cusolverDnSgeqrf((cusolverDnHandle_t)handle, m, n, A, lda, tau, work, lwork, devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgesvdjBatched_bufferSize(hipsolverDnHandle_t     handle,
-                                                     hipsolverEigMode_t      jobz,
-                                                     int                     m,
-                                                     int                     n,
-                                                     const hipDoubleComplex* A,
-                                                     int                     lda,
-                                                     const double*           S,
-                                                     const hipDoubleComplex* U,
-                                                     int                     ldu,
-                                                     const hipDoubleComplex* V,
-                                                     int                     ldv,
-                                                     int*                    lwork,
-                                                     hipsolverGesvdjInfo_t   info,
-                                                     int                     batch_count)
+hipsolverStatus_t hipsolverDgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           tau,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
     return hipsolver::cuda2hip_status(
-        cusolverDnZgesvdjBatched_bufferSize((cusolverDnHandle_t)handle,
-                                            hipsolver::hip2cuda_evect(jobz),
-                                            m,
-                                            n,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            S,
-                                            (cuDoubleComplex*)U,
-                                            ldu,
-                                            (cuDoubleComplex*)V,
-                                            ldv,
-                                            lwork,
-                                            (gesvdjInfo_t)info,
-                                            batch_count));
+        cusolverDnDgeqrf((cusolverDnHandle_t)handle, m, n, A, lda, tau, work, lwork, devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgesvdjBatched(hipsolverDnHandle_t   handle,
-                                          hipsolverEigMode_t    jobz,
-                                          int                   m,
-                                          int                   n,
-                                          float*                A,
-                                          int                   lda,
-                                          float*                S,
-                                          float*                U,
-                                          int                   ldu,
-                                          float*                V,
-                                          int                   ldv,
-                                          float*                work,
-                                          int                   lwork,
-                                          int*                  devInfo,
-                                          hipsolverGesvdjInfo_t info,
-                                          int                   batch_count)
+hipsolverStatus_t hipsolverCgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  tau,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSgesvdjBatched((cusolverDnHandle_t)handle,
-                                                               hipsolver::hip2cuda_evect(jobz),
-                                                               m,
-                                                               n,
-                                                               A,
-                                                               lda,
-                                                               S,
-                                                               U,
-                                                               ldu,
-                                                               V,
-                                                               ldv,
-                                                               work,
-                                                               lwork,
-                                                               devInfo,
-                                                               (gesvdjInfo_t)info,
-                                                               batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnCgeqrf((cusolverDnHandle_t)handle,
+                                                       m,
+                                                       n,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       (cuComplex*)tau,
+                                                       (cuComplex*)work,
+                                                       lwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgesvdjBatched(hipsolverDnHandle_t   handle,
-                                          hipsolverEigMode_t    jobz,
-                                          int                   m,
-                                          int                   n,
-                                          double*               A,
-                                          int                   lda,
-                                          double*               S,
-                                          double*               U,
-                                          int                   ldu,
-                                          double*               V,
-                                          int                   ldv,
-                                          double*               work,
-                                          int                   lwork,
-                                          int*                  devInfo,
-                                          hipsolverGesvdjInfo_t info,
-                                          int                   batch_count)
+hipsolverStatus_t hipsolverZgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* tau,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDgesvdjBatched((cusolverDnHandle_t)handle,
-                                                               hipsolver::hip2cuda_evect(jobz),
-                                                               m,
-                                                               n,
-                                                               A,
-                                                               lda,
-                                                               S,
-                                                               U,
-                                                               ldu,
-                                                               V,
-                                                               ldv,
-                                                               work,
-                                                               lwork,
-                                                               devInfo,
-                                                               (gesvdjInfo_t)info,
-                                                               batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnZgeqrf((cusolverDnHandle_t)handle,
+                                                       m,
+                                                       n,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       (cuDoubleComplex*)tau,
+                                                       (cuDoubleComplex*)work,
+                                                       lwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgesvdjBatched(hipsolverDnHandle_t   handle,
-                                          hipsolverEigMode_t    jobz,
-                                          int                   m,
-                                          int                   n,
-                                          hipFloatComplex*      A,
-                                          int                   lda,
-                                          float*                S,
-                                          hipFloatComplex*      U,
-                                          int                   ldu,
-                                          hipFloatComplex*      V,
-                                          int                   ldv,
-                                          hipFloatComplex*      work,
-                                          int                   lwork,
-                                          int*                  devInfo,
-                                          hipsolverGesvdjInfo_t info,
-                                          int                   batch_count)
+/******************** GEQRF_STRIDED_BATCHED ********************/
+// cuSOLVER has no strided-batched geqrf; the problems are solved one after the other
+hipsolverStatus_t hipsolverSgeqrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           int               m,
+                                                           int               n,
+                                                           float*            A,
+                                                           int               lda,
+                                                           long long int     strideA,
+                                                           int*              lwork,
+                                                           int               batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
-    return hipsolver::cuda2hip_status(cusolverDnCgesvdjBatched((cusolverDnHandle_t)handle,
-                                                               hipsolver::hip2cuda_evect(jobz),
-                                                               m,
-                                                               n,
-                                                               (cuComplex*)A,
-                                                               lda,
-                                                               S,
-                                                               (cuComplex*)U,
-                                                               ldu,
-                                                               (cuComplex*)V,
-                                                               ldv,
-                                                               (cuComplex*)work,
-                                                               lwork,
-                                                               devInfo,
-                                                               (gesvdjInfo_t)info,
-                                                               batch_count));
+hipsolverStatus_t hipsolverDgeqrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           int               m,
+                                                           int               n,
+                                                           double*           A,
+                                                           int               lda,
+                                                           long long int     strideA,
+                                                           int*              lwork,
+                                                           int               batch_count)
+try
+{
+    return hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgesvdjBatched(hipsolverDnHandle_t   handle,
-                                          hipsolverEigMode_t    jobz,
-                                          int                   m,
-                                          int                   n,
-                                          hipDoubleComplex*     A,
-                                          int                   lda,
-                                          double*               S,
-                                          hipDoubleComplex*     U,
-                                          int                   ldu,
-                                          hipDoubleComplex*     V,
-                                          int                   ldv,
-                                          hipDoubleComplex*     work,
-                                          int                   lwork,
-                                          int*                  devInfo,
-                                          hipsolverGesvdjInfo_t info,
-                                          int                   batch_count)
+hipsolverStatus_t hipsolverCgeqrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           int               m,
+                                                           int               n,
+                                                           hipFloatComplex*  A,
+                                                           int               lda,
+                                                           long long int     strideA,
+                                                           int*              lwork,
+                                                           int               batch_count)
+try
+{
+    return hipsolverCgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           int               m,
+                                                           int               n,
+                                                           hipDoubleComplex* A,
+                                                           int               lda,
+                                                           long long int     strideA,
+                                                           int*              lwork,
+                                                           int               batch_count)
+try
+{
+    return hipsolverZgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqrfStridedBatched(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                float*            A,
+                                                int               lda,
+                                                long long int     strideA,
+                                                float*            tau,
+                                                long long int     strideT,
+                                                float*            work,
+                                                int               lwork,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
+    if(batch_count < 0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZgesvdjBatched((cusolverDnHandle_t)handle,
-                                                               hipsolver::hip2cuda_evect(jobz),
-                                                               m,
-                                                               n,
-                                                               (cuDoubleComplex*)A,
-                                                               lda,
-                                                               S,
-                                                               (cuDoubleComplex*)U,
-                                                               ldu,
-                                                               (cuDoubleComplex*)V,
-                                                               ldv,
-                                                               (cuDoubleComplex*)work,
-                                                               lwork,
-                                                               devInfo,
-                                                               (gesvdjInfo_t)info,
-                                                               batch_count));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverSgeqrf(
+            handle, m, n, A + b * strideA, lda, tau + b * strideT, work, lwork, devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** GESVDA_STRIDED_BATCHED ********************/
-hipsolverStatus_t hipsolverDnSgesvdaStridedBatched_bufferSize(hipsolverHandle_t  handle,
-                                                              hipsolverEigMode_t jobz,
-                                                              int                rank,
-                                                              int                m,
-                                                              int                n,
-                                                              const float*       A,
-                                                              int                lda,
-                                                              long long int      strideA,
-                                                              const float*       S,
-                                                              long long int      strideS,
-                                                              const float*       U,
-                                                              int                ldu,
-                                                              long long int      strideU,
-                                                              const float*       V,
-                                                              int                ldv,
-                                                              long long int      strideV,
-                                                              int*               lwork,
-                                                              int                batch_count)
+hipsolverStatus_t hipsolverDgeqrfStridedBatched(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                double*           A,
+                                                int               lda,
+                                                long long int     strideA,
+                                                double*           tau,
+                                                long long int     strideT,
+                                                double*           work,
+                                                int               lwork,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSgesvdaStridedBatched_bufferSize((cusolverDnHandle_t)handle,
-                                                   hipsolver::hip2cuda_evect(jobz),
-                                                   rank,
-                                                   m,
-                                                   n,
-                                                   A,
-                                                   lda,
-                                                   strideA,
-                                                   S,
-                                                   strideS,
-                                                   U,
-                                                   ldu,
-                                                   strideU,
-                                                   V,
-                                                   ldv,
-                                                   strideV,
-                                                   lwork,
-                                                   batch_count));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverDgeqrf(
+            handle, m, n, A + b * strideA, lda, tau + b * strideT, work, lwork, devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnDgesvdaStridedBatched_bufferSize(hipsolverHandle_t  handle,
-                                                              hipsolverEigMode_t jobz,
-                                                              int                rank,
-                                                              int                m,
-                                                              int                n,
-                                                              const double*      A,
-                                                              int                lda,
-                                                              long long int      strideA,
-                                                              const double*      S,
-                                                              long long int      strideS,
-                                                              const double*      U,
-                                                              int                ldu,
-                                                              long long int      strideU,
-                                                              const double*      V,
-                                                              int                ldv,
-                                                              long long int      strideV,
-                                                              int*               lwork,
-                                                              int                batch_count)
+hipsolverStatus_t hipsolverCgeqrfStridedBatched(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                hipFloatComplex*  A,
+                                                int               lda,
+                                                long long int     strideA,
+                                                hipFloatComplex*  tau,
+                                                long long int     strideT,
+                                                hipFloatComplex*  work,
+                                                int               lwork,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnDgesvdaStridedBatched_bufferSize((cusolverDnHandle_t)handle,
-                                                   hipsolver::hip2cuda_evect(jobz),
-                                                   rank,
-                                                   m,
-                                                   n,
-                                                   A,
-                                                   lda,
-                                                   strideA,
-                                                   S,
-                                                   strideS,
-                                                   U,
-                                                   ldu,
-                                                   strideU,
-                                                   V,
-                                                   ldv,
-                                                   strideV,
-                                                   lwork,
-                                                   batch_count));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverCgeqrf(
+            handle, m, n, A + b * strideA, lda, tau + b * strideT, work, lwork, devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnCgesvdaStridedBatched_bufferSize(hipsolverHandle_t      handle,
-                                                              hipsolverEigMode_t     jobz,
-                                                              int                    rank,
-                                                              int                    m,
-                                                              int                    n,
-                                                              const hipFloatComplex* A,
-                                                              int                    lda,
-                                                              long long int          strideA,
-                                                              const float*           S,
-                                                              long long int          strideS,
-                                                              const hipFloatComplex* U,
-                                                              int                    ldu,
-                                                              long long int          strideU,
-                                                              const hipFloatComplex* V,
-                                                              int                    ldv,
-                                                              long long int          strideV,
-                                                              int*                   lwork,
-                                                              int                    batch_count)
+hipsolverStatus_t hipsolverZgeqrfStridedBatched(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                hipDoubleComplex* A,
+                                                int               lda,
+                                                long long int     strideA,
+                                                hipDoubleComplex* tau,
+                                                long long int     strideT,
+                                                hipDoubleComplex* work,
+                                                int               lwork,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnCgesvdaStridedBatched_bufferSize((cusolverDnHandle_t)handle,
-                                                   hipsolver::hip2cuda_evect(jobz),
-                                                   rank,
-                                                   m,
-                                                   n,
-                                                   (cuComplex*)A,
-                                                   lda,
-                                                   strideA,
-                                                   S,
-                                                   strideS,
-                                                   (cuComplex*)U,
-                                                   ldu,
-                                                   strideU,
-                                                   (cuComplex*)V,
-                                                   ldv,
-                                                   strideV,
-                                                   lwork,
-                                                   batch_count));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverZgeqrf(
+            handle, m, n, A + b * strideA, lda, tau + b * strideT, work, lwork, devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnZgesvdaStridedBatched_bufferSize(hipsolverHandle_t       handle,
-                                                              hipsolverEigMode_t      jobz,
-                                                              int                     rank,
-                                                              int                     m,
-                                                              int                     n,
-                                                              const hipDoubleComplex* A,
-                                                              int                     lda,
-                                                              long long int           strideA,
-                                                              const double*           S,
-                                                              long long int           strideS,
-                                                              const hipDoubleComplex* U,
-                                                              int                     ldu,
-                                                              long long int           strideU,
-                                                              const hipDoubleComplex* V,
-                                                              int                     ldv,
-                                                              long long int           strideV,
-                                                              int*                    lwork,
-                                                              int                     batch_count)
+/******************** GESV ********************/
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              float*            A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              float*            B,
+                                                              int               ldb,
+                                                              float*            X,
+                                                              int               ldx,
+                                                              size_t*           lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnZgesvdaStridedBatched_bufferSize((cusolverDnHandle_t)handle,
-                                                   hipsolver::hip2cuda_evect(jobz),
-                                                   rank,
-                                                   m,
-                                                   n,
-                                                   (cuDoubleComplex*)A,
-                                                   lda,
-                                                   strideA,
-                                                   S,
-                                                   strideS,
-                                                   (cuDoubleComplex*)U,
-                                                   ldu,
-                                                   strideU,
-                                                   (cuDoubleComplex*)V,
-                                                   ldv,
-                                                   strideV,
-                                                   lwork,
-                                                   batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnSSgesv_bufferSize(
+        (cusolverDnHandle_t)handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, nullptr, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnSgesvdaStridedBatched(hipsolverHandle_t  handle,
-                                                   hipsolverEigMode_t jobz,
-                                                   int                rank,
-                                                   int                m,
-                                                   int                n,
-                                                   const float*       A,
-                                                   int                lda,
-                                                   long long int      strideA,
-                                                   float*             S,
-                                                   long long int      strideS,
-                                                   float*             U,
-                                                   int                ldu,
-                                                   long long int      strideU,
-                                                   float*             V,
-                                                   int                ldv,
-                                                   long long int      strideV,
-                                                   float*             work,
-                                                   int                lwork,
-                                                   int*               devInfo,
-                                                   double*            hRnrmF,
-                                                   int                batch_count)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSgesvdaStridedBatched((cusolverDnHandle_t)handle,
-                                        hipsolver::hip2cuda_evect(jobz),
-                                        rank,
-                                        m,
-                                        n,
-                                        A,
-                                        lda,
-                                        strideA,
-                                        S,
-                                        strideS,
-                                        U,
-                                        ldu,
-                                        strideU,
-                                        V,
-                                        ldv,
-                                        strideV,
-                                        work,
-                                        lwork,
-                                        devInfo,
-                                        hRnrmF,
-                                        batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnDDgesv_bufferSize(
+        (cusolverDnHandle_t)handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, nullptr, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnDgesvdaStridedBatched(hipsolverHandle_t  handle,
-                                                   hipsolverEigMode_t jobz,
-                                                   int                rank,
-                                                   int                m,
-                                                   int                n,
-                                                   const double*      A,
-                                                   int                lda,
-                                                   long long int      strideA,
-                                                   double*            S,
-                                                   long long int      strideS,
-                                                   double*            U,
-                                                   int                ldu,
-                                                   long long int      strideU,
-                                                   double*            V,
-                                                   int                ldv,
-                                                   long long int      strideV,
-                                                   double*            work,
-                                                   int                lwork,
-                                                   int*               devInfo,
-                                                   double*            hRnrmF,
-                                                   int                batch_count)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipFloatComplex*  A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              hipFloatComplex*  B,
+                                                              int               ldb,
+                                                              hipFloatComplex*  X,
+                                                              int               ldx,
+                                                              size_t*           lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnDgesvdaStridedBatched((cusolverDnHandle_t)handle,
-                                        hipsolver::hip2cuda_evect(jobz),
-                                        rank,
-                                        m,
-                                        n,
-                                        A,
-                                        lda,
-                                        strideA,
-                                        S,
-                                        strideS,
-                                        U,
-                                        ldu,
-                                        strideU,
-                                        V,
-                                        ldv,
-                                        strideV,
-                                        work,
-                                        lwork,
-                                        devInfo,
-                                        hRnrmF,
-                                        batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnCCgesv_bufferSize((cusolverDnHandle_t)handle,
+                                                                  n,
+                                                                  nrhs,
+                                                                  (cuComplex*)A,
+                                                                  lda,
+                                                                  devIpiv,
+                                                                  (cuComplex*)B,
+                                                                  ldb,
+                                                                  (cuComplex*)X,
+                                                                  ldx,
+                                                                  nullptr,
+                                                                  lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnCgesvdaStridedBatched(hipsolverHandle_t      handle,
-                                                   hipsolverEigMode_t     jobz,
-                                                   int                    rank,
-                                                   int                    m,
-                                                   int                    n,
-                                                   const hipFloatComplex* A,
-                                                   int                    lda,
-                                                   long long int          strideA,
-                                                   float*                 S,
-                                                   long long int          strideS,
-                                                   hipFloatComplex*       U,
-                                                   int                    ldu,
-                                                   long long int          strideU,
-                                                   hipFloatComplex*       V,
-                                                   int                    ldv,
-                                                   long long int          strideV,
-                                                   hipFloatComplex*       work,
-                                                   int                    lwork,
-                                                   int*                   devInfo,
-                                                   double*                hRnrmF,
-                                                   int                    batch_count)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipDoubleComplex* A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              hipDoubleComplex* B,
+                                                              int               ldb,
+                                                              hipDoubleComplex* X,
+                                                              int               ldx,
+                                                              size_t*           lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnCgesvdaStridedBatched((cusolverDnHandle_t)handle,
-                                        hipsolver::hip2cuda_evect(jobz),
-                                        rank,
-                                        m,
-                                        n,
-                                        (cuComplex*)A,
-                                        lda,
-                                        strideA,
-                                        S,
-                                        strideS,
-                                        (cuComplex*)U,
-                                        ldu,
-                                        strideU,
-                                        (cuComplex*)V,
-                                        ldv,
-                                        strideV,
-                                        (cuComplex*)work,
-                                        lwork,
-                                        devInfo,
-                                        hRnrmF,
-                                        batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnZZgesv_bufferSize((cusolverDnHandle_t)handle,
+                                                                  n,
+                                                                  nrhs,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  devIpiv,
+                                                                  (cuDoubleComplex*)B,
+                                                                  ldb,
+                                                                  (cuDoubleComplex*)X,
+                                                                  ldx,
+                                                                  nullptr,
+                                                                  lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnZgesvdaStridedBatched(hipsolverHandle_t       handle,
-                                                   hipsolverEigMode_t      jobz,
-                                                   int                     rank,
-                                                   int                     m,
-                                                   int                     n,
-                                                   const hipDoubleComplex* A,
-                                                   int                     lda,
-                                                   long long int           strideA,
-                                                   double*                 S,
-                                                   long long int           strideS,
-                                                   hipDoubleComplex*       U,
-                                                   int                     ldu,
-                                                   long long int           strideU,
-                                                   hipDoubleComplex*       V,
-                                                   int                     ldv,
-                                                   long long int           strideV,
-                                                   hipDoubleComplex*       work,
-                                                   int                     lwork,
-                                                   int*                    devInfo,
-                                                   double*                 hRnrmF,
-                                                   int                     batch_count)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   float*            A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   float*            B,
+                                                   int               ldb,
+                                                   float*            X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnZgesvdaStridedBatched((cusolverDnHandle_t)handle,
-                                        hipsolver::hip2cuda_evect(jobz),
-                                        rank,
-                                        m,
-                                        n,
-                                        (cuDoubleComplex*)A,
-                                        lda,
-                                        strideA,
-                                        S,
-                                        strideS,
-                                        (cuDoubleComplex*)U,
-                                        ldu,
-                                        strideU,
-                                        (cuDoubleComplex*)V,
-                                        ldv,
-                                        strideV,
-                                        (cuDoubleComplex*)work,
-                                        lwork,
-                                        devInfo,
-                                        hRnrmF,
-                                        batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnSSgesv((cusolverDnHandle_t)handle,
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       lda,
+                                                       devIpiv,
+                                                       B,
+                                                       ldb,
+                                                       X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** GETRF ********************/
-hipsolverStatus_t hipsolverSgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSgetrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnDDgesv((cusolverDnHandle_t)handle,
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       lda,
+                                                       devIpiv,
+                                                       B,
+                                                       ldb,
+                                                       X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipFloatComplex*  A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   hipFloatComplex*  B,
+                                                   int               ldb,
+                                                   hipFloatComplex*  X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnDgetrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnCCgesv((cusolverDnHandle_t)handle,
+                                                       n,
+                                                       nrhs,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       devIpiv,
+                                                       (cuComplex*)B,
+                                                       ldb,
+                                                       (cuComplex*)X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   hipDoubleComplex* X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnCgetrf_bufferSize((cusolverDnHandle_t)handle, m, n, (cuComplex*)A, lda, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnZZgesv((cusolverDnHandle_t)handle,
+                                                       n,
+                                                       nrhs,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       devIpiv,
+                                                       (cuDoubleComplex*)B,
+                                                       ldb,
+                                                       (cuDoubleComplex*)X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDSgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZgetrf_bufferSize(
-        (cusolverDnHandle_t)handle, m, n, (cuDoubleComplex*)A, lda, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnDSgesv_bufferSize(
+        (cusolverDnHandle_t)handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, nullptr, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  float*            A,
-                                  int               lda,
-                                  float*            work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
-try
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDHgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork)
+try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSgetrf((cusolverDnHandle_t)handle, m, n, A, lda, work, devIpiv, devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnDHgesv_bufferSize(
+        (cusolverDnHandle_t)handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, nullptr, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  double*           A,
-                                  int               lda,
-                                  double*           work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZCgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipDoubleComplex* A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              hipDoubleComplex* B,
+                                                              int               ldb,
+                                                              hipDoubleComplex* X,
+                                                              int               ldx,
+                                                              size_t*           lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnDgetrf((cusolverDnHandle_t)handle, m, n, A, lda, work, devIpiv, devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnZCgesv_bufferSize((cusolverDnHandle_t)handle,
+                                                                  n,
+                                                                  nrhs,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  devIpiv,
+                                                                  (cuDoubleComplex*)B,
+                                                                  ldb,
+                                                                  (cuDoubleComplex*)X,
+                                                                  ldx,
+                                                                  nullptr,
+                                                                  lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZKgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipDoubleComplex* A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              hipDoubleComplex* B,
+                                                              int               ldb,
+                                                              hipDoubleComplex* X,
+                                                              int               ldx,
+                                                              size_t*           lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCgetrf(
-        (cusolverDnHandle_t)handle, m, n, (cuComplex*)A, lda, (cuComplex*)work, devIpiv, devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnZKgesv_bufferSize((cusolverDnHandle_t)handle,
+                                                                  n,
+                                                                  nrhs,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  devIpiv,
+                                                                  (cuDoubleComplex*)B,
+                                                                  ldb,
+                                                                  (cuDoubleComplex*)X,
+                                                                  ldx,
+                                                                  nullptr,
+                                                                  lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDSgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZgetrf((cusolverDnHandle_t)handle,
-                                                       m,
+    return hipsolver::cuda2hip_status(cusolverDnDSgesv((cusolverDnHandle_t)handle,
                                                        n,
-                                                       (cuDoubleComplex*)A,
+                                                       nrhs,
+                                                       A,
                                                        lda,
-                                                       (cuDoubleComplex*)work,
                                                        devIpiv,
+                                                       B,
+                                                       ldb,
+                                                       X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
                                                        devInfo));
 }
 catch(...)
@@ -3937,232 +3424,220 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/******************** GETRS ********************/
-hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             float*               A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             float*               B,
-                                             int                  ldb,
-                                             int*                 lwork)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDHgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return hipsolver::cuda2hip_status(cusolverDnDHgesv((cusolverDnHandle_t)handle,
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       lda,
+                                                       devIpiv,
+                                                       B,
+                                                       ldb,
+                                                       X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             double*              A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             double*              B,
-                                             int                  ldb,
-                                             int*                 lwork)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZCgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   hipDoubleComplex* X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return hipsolver::cuda2hip_status(cusolverDnZCgesv((cusolverDnHandle_t)handle,
+                                                       n,
+                                                       nrhs,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       devIpiv,
+                                                       (cuDoubleComplex*)B,
+                                                       ldb,
+                                                       (cuDoubleComplex*)X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             hipFloatComplex*     A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             hipFloatComplex*     B,
-                                             int                  ldb,
-                                             int*                 lwork)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZKgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   hipDoubleComplex* X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return hipsolver::cuda2hip_status(cusolverDnZKgesv((cusolverDnHandle_t)handle,
+                                                       n,
+                                                       nrhs,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       devIpiv,
+                                                       (cuDoubleComplex*)B,
+                                                       ldb,
+                                                       (cuDoubleComplex*)X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             hipDoubleComplex*    A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             hipDoubleComplex*    B,
-                                             int                  ldb,
-                                             int*                 lwork)
+/******************** GESVD ********************/
+hipsolverStatus_t hipsolverSgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return hipsolver::cuda2hip_status(
+        cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  float*               A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  float*               B,
-                                  int                  ldb,
-                                  float*               work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverDgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSgetrs((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_operation(trans),
-                                                       n,
-                                                       nrhs,
-                                                       A,
-                                                       lda,
-                                                       devIpiv,
-                                                       B,
-                                                       ldb,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(
+        cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  double*              A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  double*              B,
-                                  int                  ldb,
-                                  double*              work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverCgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDgetrs((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_operation(trans),
-                                                       n,
-                                                       nrhs,
-                                                       A,
-                                                       lda,
-                                                       devIpiv,
-                                                       B,
-                                                       ldb,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(
+        cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  hipFloatComplex*     A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  hipFloatComplex*     B,
-                                  int                  ldb,
-                                  hipFloatComplex*     work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverZgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCgetrs((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_operation(trans),
-                                                       n,
-                                                       nrhs,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       devIpiv,
-                                                       (cuComplex*)B,
-                                                       ldb,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(
+        cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  hipDoubleComplex*    A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  hipDoubleComplex*    B,
-                                  int                  ldb,
-                                  hipDoubleComplex*    work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverSgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            S,
+                                  float*            U,
+                                  int               ldu,
+                                  float*            V,
+                                  int               ldv,
+                                  float*            work,
+                                  int               lwork,
+                                  float*            rwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZgetrs((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_operation(trans),
+    return hipsolver::cuda2hip_status(cusolverDnSgesvd((cusolverDnHandle_t)handle,
+                                                       jobu,
+                                                       jobv,
+                                                       m,
                                                        n,
-                                                       nrhs,
-                                                       (cuDoubleComplex*)A,
+                                                       A,
                                                        lda,
-                                                       devIpiv,
-                                                       (cuDoubleComplex*)B,
-                                                       ldb,
+                                                       S,
+                                                       U,
+                                                       ldu,
+                                                       V,
+                                                       ldv,
+                                                       work,
+                                                       lwork,
+                                                       rwork,
                                                        devInfo));
 }
 catch(...)
@@ -4170,203 +3645,298 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-/******************** POTRF ********************/
-hipsolverStatus_t hipsolverSpotrf_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverDgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           S,
+                                  double*           U,
+                                  int               ldu,
+                                  double*           V,
+                                  int               ldv,
+                                  double*           work,
+                                  int               lwork,
+                                  double*           rwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSpotrf_bufferSize(
-        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnDgesvd((cusolverDnHandle_t)handle,
+                                                       jobu,
+                                                       jobv,
+                                                       m,
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       S,
+                                                       U,
+                                                       ldu,
+                                                       V,
+                                                       ldv,
+                                                       work,
+                                                       lwork,
+                                                       rwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrf_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverCgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  float*            S,
+                                  hipFloatComplex*  U,
+                                  int               ldu,
+                                  hipFloatComplex*  V,
+                                  int               ldv,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  float*            rwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDpotrf_bufferSize(
-        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnCgesvd((cusolverDnHandle_t)handle,
+                                                       jobu,
+                                                       jobv,
+                                                       m,
+                                                       n,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       S,
+                                                       (cuComplex*)U,
+                                                       ldu,
+                                                       (cuComplex*)V,
+                                                       ldv,
+                                                       (cuComplex*)work,
+                                                       lwork,
+                                                       rwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrf_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverZgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  double*           S,
+                                  hipDoubleComplex* U,
+                                  int               ldu,
+                                  hipDoubleComplex* V,
+                                  int               ldv,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  double*           rwork,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCpotrf_bufferSize(
-        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, (cuComplex*)A, lda, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnZgesvd((cusolverDnHandle_t)handle,
+                                                       jobu,
+                                                       jobv,
+                                                       m,
+                                                       n,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       S,
+                                                       (cuDoubleComplex*)U,
+                                                       ldu,
+                                                       (cuDoubleComplex*)V,
+                                                       ldv,
+                                                       (cuDoubleComplex*)work,
+                                                       lwork,
+                                                       rwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrf_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             int*                lwork)
+/******************** GESVD_STRIDED_BATCHED ********************/
+// cuSOLVER has no strided-batched gesvd; the problems are solved one after the other
+hipsolverStatus_t hipsolverSgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           int*              lwork,
+                                                           int               batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-
-    return hipsolver::cuda2hip_status(cusolverDnZpotrf_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuDoubleComplex*)A,
-                                                                  lda,
-                                                                  lwork));
+    return hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverDgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           int*              lwork,
+                                                           int               batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-
-    return hipsolver::cuda2hip_status(cusolverDnSpotrf((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverCgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           int*              lwork,
+                                                           int               batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-
-    return hipsolver::cuda2hip_status(cusolverDnDpotrf((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverZgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           int*              lwork,
+                                                           int               batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-
-    return hipsolver::cuda2hip_status(cusolverDnCpotrf((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       (cuComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverSgesvdStridedBatched(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                float*            A,
+                                                int               lda,
+                                                long long int     strideA,
+                                                float*            S,
+                                                long long int     strideS,
+                                                float*            U,
+                                                int               ldu,
+                                                long long int     strideU,
+                                                float*            V,
+                                                int               ldv,
+                                                long long int     strideV,
+                                                float*            work,
+                                                int               lwork,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZpotrf((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       (cuDoubleComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverSgesvd(handle,
+                                              jobu,
+                                              jobv,
+                                              m,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              S + b * strideS,
+                                              U + b * strideU,
+                                              ldu,
+                                              V + b * strideV,
+                                              ldv,
+                                              work,
+                                              lwork,
+                                              nullptr,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** POTRF_BATCHED ********************/
-hipsolverStatus_t hipsolverSpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    float*              A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverDgesvdStridedBatched(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                double*           A,
+                                                int               lda,
+                                                long long int     strideA,
+                                                double*           S,
+                                                long long int     strideS,
+                                                double*           U,
+                                                int               ldu,
+                                                long long int     strideU,
+                                                double*           V,
+                                                int               ldv,
+                                                long long int     strideV,
+                                                double*           work,
+                                                int               lwork,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
+    if(batch_count < 0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverDgesvd(handle,
+                                              jobu,
+                                              jobv,
+                                              m,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              S + b * strideS,
+                                              U + b * strideU,
+                                              ldu,
+                                              V + b * strideV,
+                                              ldv,
+                                              work,
+                                              lwork,
+                                              nullptr,
+                                              devInfo + b));
+
     return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
@@ -4374,21 +3944,51 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    double*             A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverCgesvdStridedBatched(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                hipFloatComplex*  A,
+                                                int               lda,
+                                                long long int     strideA,
+                                                float*            S,
+                                                long long int     strideS,
+                                                hipFloatComplex*  U,
+                                                int               ldu,
+                                                long long int     strideU,
+                                                hipFloatComplex*  V,
+                                                int               ldv,
+                                                long long int     strideV,
+                                                hipFloatComplex*  work,
+                                                int               lwork,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
+    if(batch_count < 0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverCgesvd(handle,
+                                              jobu,
+                                              jobv,
+                                              m,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              S + b * strideS,
+                                              U + b * strideU,
+                                              ldu,
+                                              V + b * strideV,
+                                              ldv,
+                                              work,
+                                              lwork,
+                                              nullptr,
+                                              devInfo + b));
+
     return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
@@ -4396,21 +3996,51 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipFloatComplex*    A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverZgesvdStridedBatched(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                hipDoubleComplex* A,
+                                                int               lda,
+                                                long long int     strideA,
+                                                double*           S,
+                                                long long int     strideS,
+                                                hipDoubleComplex* U,
+                                                int               ldu,
+                                                long long int     strideU,
+                                                hipDoubleComplex* V,
+                                                int               ldv,
+                                                long long int     strideV,
+                                                hipDoubleComplex* work,
+                                                int               lwork,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
+    if(batch_count < 0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverZgesvd(handle,
+                                              jobu,
+                                              jobv,
+                                              m,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              S + b * strideS,
+                                              U + b * strideU,
+                                              ldu,
+                                              V + b * strideV,
+                                              ldv,
+                                              work,
+                                              lwork,
+                                              nullptr,
+                                              devInfo + b));
+
     return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
@@ -4418,935 +4048,1257 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipDoubleComplex*   A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+/******************** GESVDJ ********************/
+hipsolverStatus_t hipsolverSgesvdj_bufferSize(hipsolverDnHandle_t   handle,
+                                              hipsolverEigMode_t    jobz,
+                                              int                   econ,
+                                              int                   m,
+                                              int                   n,
+                                              const float*          A,
+                                              int                   lda,
+                                              const float*          S,
+                                              const float*          U,
+                                              int                   ldu,
+                                              const float*          V,
+                                              int                   ldv,
+                                              int*                  lwork,
+                                              hipsolverGesvdjInfo_t info)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
+    if(!info)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return hipsolver::cuda2hip_status(cusolverDnSgesvdj_bufferSize((cusolverDnHandle_t)handle,
+                                                                   hipsolver::hip2cuda_evect(jobz),
+                                                                   econ,
+                                                                   m,
+                                                                   n,
+                                                                   A,
+                                                                   lda,
+                                                                   S,
+                                                                   U,
+                                                                   ldu,
+                                                                   V,
+                                                                   ldv,
+                                                                   lwork,
+                                                                   (gesvdjInfo_t)info));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A[],
-                                         int                 lda,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverDgesvdj_bufferSize(hipsolverDnHandle_t   handle,
+                                              hipsolverEigMode_t    jobz,
+                                              int                   econ,
+                                              int                   m,
+                                              int                   n,
+                                              const double*         A,
+                                              int                   lda,
+                                              const double*         S,
+                                              const double*         U,
+                                              int                   ldu,
+                                              const double*         V,
+                                              int                   ldv,
+                                              int*                  lwork,
+                                              hipsolverGesvdjInfo_t info)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSpotrfBatched((cusolverDnHandle_t)handle,
-                                                              hipsolver::hip2cuda_fill(uplo),
-                                                              n,
-                                                              A,
-                                                              lda,
-                                                              devInfo,
-                                                              batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnDgesvdj_bufferSize((cusolverDnHandle_t)handle,
+                                                                   hipsolver::hip2cuda_evect(jobz),
+                                                                   econ,
+                                                                   m,
+                                                                   n,
+                                                                   A,
+                                                                   lda,
+                                                                   S,
+                                                                   U,
+                                                                   ldu,
+                                                                   V,
+                                                                   ldv,
+                                                                   lwork,
+                                                                   (gesvdjInfo_t)info));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A[],
-                                         int                 lda,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverCgesvdj_bufferSize(hipsolverDnHandle_t    handle,
+                                              hipsolverEigMode_t     jobz,
+                                              int                    econ,
+                                              int                    m,
+                                              int                    n,
+                                              const hipFloatComplex* A,
+                                              int                    lda,
+                                              const float*           S,
+                                              const hipFloatComplex* U,
+                                              int                    ldu,
+                                              const hipFloatComplex* V,
+                                              int                    ldv,
+                                              int*                   lwork,
+                                              hipsolverGesvdjInfo_t  info)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDpotrfBatched((cusolverDnHandle_t)handle,
-                                                              hipsolver::hip2cuda_fill(uplo),
-                                                              n,
-                                                              A,
-                                                              lda,
-                                                              devInfo,
-                                                              batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnCgesvdj_bufferSize((cusolverDnHandle_t)handle,
+                                                                   hipsolver::hip2cuda_evect(jobz),
+                                                                   econ,
+                                                                   m,
+                                                                   n,
+                                                                   (cuComplex*)A,
+                                                                   lda,
+                                                                   S,
+                                                                   (cuComplex*)U,
+                                                                   ldu,
+                                                                   (cuComplex*)V,
+                                                                   ldv,
+                                                                   lwork,
+                                                                   (gesvdjInfo_t)info));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipFloatComplex*    A[],
-                                         int                 lda,
-                                         hipFloatComplex*    work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
-try
-{
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-
-    return hipsolver::cuda2hip_status(cusolverDnCpotrfBatched((cusolverDnHandle_t)handle,
-                                                              hipsolver::hip2cuda_fill(uplo),
-                                                              n,
-                                                              (cuComplex**)A,
-                                                              lda,
-                                                              devInfo,
-                                                              batch_count));
-}
-catch(...)
-{
-    return hipsolver::exception2hip_status();
-}
-
-hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipDoubleComplex*   A[],
-                                         int                 lda,
-                                         hipDoubleComplex*   work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverZgesvdj_bufferSize(hipsolverDnHandle_t     handle,
+                                              hipsolverEigMode_t      jobz,
+                                              int                     econ,
+                                              int                     m,
+                                              int                     n,
+                                              const hipDoubleComplex* A,
+                                              int                     lda,
+                                              const double*           S,
+                                              const hipDoubleComplex* U,
+                                              int                     ldu,
+                                              const hipDoubleComplex* V,
+                                              int                     ldv,
+                                              int*                    lwork,
+                                              hipsolverGesvdjInfo_t   info)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZpotrfBatched((cusolverDnHandle_t)handle,
-                                                              hipsolver::hip2cuda_fill(uplo),
-                                                              n,
-                                                              (cuDoubleComplex**)A,
-                                                              lda,
-                                                              devInfo,
-                                                              batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnZgesvdj_bufferSize((cusolverDnHandle_t)handle,
+                                                                   hipsolver::hip2cuda_evect(jobz),
+                                                                   econ,
+                                                                   m,
+                                                                   n,
+                                                                   (cuDoubleComplex*)A,
+                                                                   lda,
+                                                                   S,
+                                                                   (cuDoubleComplex*)U,
+                                                                   ldu,
+                                                                   (cuDoubleComplex*)V,
+                                                                   ldv,
+                                                                   lwork,
+                                                                   (gesvdjInfo_t)info));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** POTRI ********************/
-hipsolverStatus_t hipsolverSpotri_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverSgesvdj(hipsolverDnHandle_t   handle,
+                                   hipsolverEigMode_t    jobz,
+                                   int                   econ,
+                                   int                   m,
+                                   int                   n,
+                                   float*                A,
+                                   int                   lda,
+                                   float*                S,
+                                   float*                U,
+                                   int                   ldu,
+                                   float*                V,
+                                   int                   ldv,
+                                   float*                work,
+                                   int                   lwork,
+                                   int*                  devInfo,
+                                   hipsolverGesvdjInfo_t info)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSpotri_bufferSize(
-        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnSgesvdj((cusolverDnHandle_t)handle,
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        econ,
+                                                        m,
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        S,
+                                                        U,
+                                                        ldu,
+                                                        V,
+                                                        ldv,
+                                                        work,
+                                                        lwork,
+                                                        devInfo,
+                                                        (gesvdjInfo_t)info));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotri_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverDgesvdj(hipsolverDnHandle_t   handle,
+                                   hipsolverEigMode_t    jobz,
+                                   int                   econ,
+                                   int                   m,
+                                   int                   n,
+                                   double*               A,
+                                   int                   lda,
+                                   double*               S,
+                                   double*               U,
+                                   int                   ldu,
+                                   double*               V,
+                                   int                   ldv,
+                                   double*               work,
+                                   int                   lwork,
+                                   int*                  devInfo,
+                                   hipsolverGesvdjInfo_t info)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDpotri_bufferSize(
-        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnDgesvdj((cusolverDnHandle_t)handle,
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        econ,
+                                                        m,
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        S,
+                                                        U,
+                                                        ldu,
+                                                        V,
+                                                        ldv,
+                                                        work,
+                                                        lwork,
+                                                        devInfo,
+                                                        (gesvdjInfo_t)info));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotri_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverCgesvdj(hipsolverDnHandle_t   handle,
+                                   hipsolverEigMode_t    jobz,
+                                   int                   econ,
+                                   int                   m,
+                                   int                   n,
+                                   hipFloatComplex*      A,
+                                   int                   lda,
+                                   float*                S,
+                                   hipFloatComplex*      U,
+                                   int                   ldu,
+                                   hipFloatComplex*      V,
+                                   int                   ldv,
+                                   hipFloatComplex*      work,
+                                   int                   lwork,
+                                   int*                  devInfo,
+                                   hipsolverGesvdjInfo_t info)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnCpotri_bufferSize(
-        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, (cuComplex*)A, lda, lwork));
+    return hipsolver::cuda2hip_status(cusolverDnCgesvdj((cusolverDnHandle_t)handle,
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        econ,
+                                                        m,
+                                                        n,
+                                                        (cuComplex*)A,
+                                                        lda,
+                                                        S,
+                                                        (cuComplex*)U,
+                                                        ldu,
+                                                        (cuComplex*)V,
+                                                        ldv,
+                                                        (cuComplex*)work,
+                                                        lwork,
+                                                        devInfo,
+                                                        (gesvdjInfo_t)info));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotri_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverZgesvdj(hipsolverDnHandle_t   handle,
+                                   hipsolverEigMode_t    jobz,
+                                   int                   econ,
+                                   int                   m,
+                                   int                   n,
+                                   hipDoubleComplex*     A,
+                                   int                   lda,
+                                   double*               S,
+                                   hipDoubleComplex*     U,
+                                   int                   ldu,
+                                   hipDoubleComplex*     V,
+                                   int                   ldv,
+                                   hipDoubleComplex*     work,
+                                   int                   lwork,
+                                   int*                  devInfo,
+                                   hipsolverGesvdjInfo_t info)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZpotri_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuDoubleComplex*)A,
-                                                                  lda,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(cusolverDnZgesvdj((cusolverDnHandle_t)handle,
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        econ,
+                                                        m,
+                                                        n,
+                                                        (cuDoubleComplex*)A,
+                                                        lda,
+                                                        S,
+                                                        (cuDoubleComplex*)U,
+                                                        ldu,
+                                                        (cuDoubleComplex*)V,
+                                                        ldv,
+                                                        (cuDoubleComplex*)work,
+                                                        lwork,
+                                                        devInfo,
+                                                        (gesvdjInfo_t)info));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotri(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+/******************** GESVDJ_BATCHED ********************/
+hipsolverStatus_t hipsolverSgesvdjBatched_bufferSize(hipsolverDnHandle_t   handle,
+                                                     hipsolverEigMode_t    jobz,
+                                                     int                   m,
+                                                     int                   n,
+                                                     const float*          A,
+                                                     int                   lda,
+                                                     const float*          S,
+                                                     const float*          U,
+                                                     int                   ldu,
+                                                     const float*          V,
+                                                     int                   ldv,
+                                                     int*                  lwork,
+                                                     hipsolverGesvdjInfo_t info,
+                                                     int                   batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSpotri((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
-}
-catch(...)
-{
-    return hipsolver::exception2hip_status();
-}
-
-hipsolverStatus_t hipsolverDpotri(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
-try
-{
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-
-    return hipsolver::cuda2hip_status(cusolverDnDpotri((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(
+        cusolverDnSgesvdjBatched_bufferSize((cusolverDnHandle_t)handle,
+                                            hipsolver::hip2cuda_evect(jobz),
+                                            m,
+                                            n,
+                                            A,
+                                            lda,
+                                            S,
+                                            U,
+                                            ldu,
+                                            V,
+                                            ldv,
+                                            lwork,
+                                            (gesvdjInfo_t)info,
+                                            batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotri(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverDgesvdjBatched_bufferSize(hipsolverDnHandle_t   handle,
+                                                     hipsolverEigMode_t    jobz,
+                                                     int                   m,
+                                                     int                   n,
+                                                     const double*         A,
+                                                     int                   lda,
+                                                     const double*         S,
+                                                     const double*         U,
+                                                     int                   ldu,
+                                                     const double*         V,
+                                                     int                   ldv,
+                                                     int*                  lwork,
+                                                     hipsolverGesvdjInfo_t info,
+                                                     int                   batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnCpotri((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       (cuComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(
+        cusolverDnDgesvdjBatched_bufferSize((cusolverDnHandle_t)handle,
+                                            hipsolver::hip2cuda_evect(jobz),
+                                            m,
+                                            n,
+                                            A,
+                                            lda,
+                                            S,
+                                            U,
+                                            ldu,
+                                            V,
+                                            ldv,
+                                            lwork,
+                                            (gesvdjInfo_t)info,
+                                            batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotri(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverCgesvdjBatched_bufferSize(hipsolverDnHandle_t    handle,
+                                                     hipsolverEigMode_t     jobz,
+                                                     int                    m,
+                                                     int                    n,
+                                                     const hipFloatComplex* A,
+                                                     int                    lda,
+                                                     const float*           S,
+                                                     const hipFloatComplex* U,
+                                                     int                    ldu,
+                                                     const hipFloatComplex* V,
+                                                     int                    ldv,
+                                                     int*                   lwork,
+                                                     hipsolverGesvdjInfo_t  info,
+                                                     int                    batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZpotri((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       (cuDoubleComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(
+        cusolverDnCgesvdjBatched_bufferSize((cusolverDnHandle_t)handle,
+                                            hipsolver::hip2cuda_evect(jobz),
+                                            m,
+                                            n,
+                                            (cuComplex*)A,
+                                            lda,
+                                            S,
+                                            (cuComplex*)U,
+                                            ldu,
+                                            (cuComplex*)V,
+                                            ldv,
+                                            lwork,
+                                            (gesvdjInfo_t)info,
+                                            batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** POTRS ********************/
-hipsolverStatus_t hipsolverSpotrs_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             int                 nrhs,
-                                             float*              A,
-                                             int                 lda,
-                                             float*              B,
-                                             int                 ldb,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverZgesvdjBatched_bufferSize(hipsolverDnHandle_t     handle,
+                                                     hipsolverEigMode_t      jobz,
+                                                     int                     m,
+                                                     int                     n,
+                                                     const hipDoubleComplex* A,
+                                                     int                     lda,
+                                                     const double*           S,
+                                                     const hipDoubleComplex* U,
+                                                     int                     ldu,
+                                                     const hipDoubleComplex* V,
+                                                     int                     ldv,
+                                                     int*                    lwork,
+                                                     hipsolverGesvdjInfo_t   info,
+                                                     int                     batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
+    if(!info)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return hipsolver::cuda2hip_status(
+        cusolverDnZgesvdjBatched_bufferSize((cusolverDnHandle_t)handle,
+                                            hipsolver::hip2cuda_evect(jobz),
+                                            m,
+                                            n,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            S,
+                                            (cuDoubleComplex*)U,
+                                            ldu,
+                                            (cuDoubleComplex*)V,
+                                            ldv,
+                                            lwork,
+                                            (gesvdjInfo_t)info,
+                                            batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrs_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             int                 nrhs,
-                                             double*             A,
-                                             int                 lda,
-                                             double*             B,
-                                             int                 ldb,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverSgesvdjBatched(hipsolverDnHandle_t   handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   m,
+                                          int                   n,
+                                          float*                A,
+                                          int                   lda,
+                                          float*                S,
+                                          float*                U,
+                                          int                   ldu,
+                                          float*                V,
+                                          int                   ldv,
+                                          float*                work,
+                                          int                   lwork,
+                                          int*                  devInfo,
+                                          hipsolverGesvdjInfo_t info,
+                                          int                   batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
+    if(!info)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return hipsolver::cuda2hip_status(cusolverDnSgesvdjBatched((cusolverDnHandle_t)handle,
+                                                               hipsolver::hip2cuda_evect(jobz),
+                                                               m,
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               S,
+                                                               U,
+                                                               ldu,
+                                                               V,
+                                                               ldv,
+                                                               work,
+                                                               lwork,
+                                                               devInfo,
+                                                               (gesvdjInfo_t)info,
+                                                               batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrs_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             int                 nrhs,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             hipFloatComplex*    B,
-                                             int                 ldb,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverDgesvdjBatched(hipsolverDnHandle_t   handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   m,
+                                          int                   n,
+                                          double*               A,
+                                          int                   lda,
+                                          double*               S,
+                                          double*               U,
+                                          int                   ldu,
+                                          double*               V,
+                                          int                   ldv,
+                                          double*               work,
+                                          int                   lwork,
+                                          int*                  devInfo,
+                                          hipsolverGesvdjInfo_t info,
+                                          int                   batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
+    if(!info)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
-}
-catch(...)
-{
-    return hipsolver::exception2hip_status();
-}
-
-hipsolverStatus_t hipsolverZpotrs_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             int                 nrhs,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             hipDoubleComplex*   B,
-                                             int                 ldb,
-                                             int*                lwork)
-try
-{
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return hipsolver::cuda2hip_status(cusolverDnDgesvdjBatched((cusolverDnHandle_t)handle,
+                                                               hipsolver::hip2cuda_evect(jobz),
+                                                               m,
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               S,
+                                                               U,
+                                                               ldu,
+                                                               V,
+                                                               ldv,
+                                                               work,
+                                                               lwork,
+                                                               devInfo,
+                                                               (gesvdjInfo_t)info,
+                                                               batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrs(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  int                 nrhs,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              B,
-                                  int                 ldb,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverCgesvdjBatched(hipsolverDnHandle_t   handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   m,
+                                          int                   n,
+                                          hipFloatComplex*      A,
+                                          int                   lda,
+                                          float*                S,
+                                          hipFloatComplex*      U,
+                                          int                   ldu,
+                                          hipFloatComplex*      V,
+                                          int                   ldv,
+                                          hipFloatComplex*      work,
+                                          int                   lwork,
+                                          int*                  devInfo,
+                                          hipsolverGesvdjInfo_t info,
+                                          int                   batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSpotrs((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       nrhs,
-                                                       A,
-                                                       lda,
-                                                       B,
-                                                       ldb,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnCgesvdjBatched((cusolverDnHandle_t)handle,
+                                                               hipsolver::hip2cuda_evect(jobz),
+                                                               m,
+                                                               n,
+                                                               (cuComplex*)A,
+                                                               lda,
+                                                               S,
+                                                               (cuComplex*)U,
+                                                               ldu,
+                                                               (cuComplex*)V,
+                                                               ldv,
+                                                               (cuComplex*)work,
+                                                               lwork,
+                                                               devInfo,
+                                                               (gesvdjInfo_t)info,
+                                                               batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrs(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  int                 nrhs,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             B,
-                                  int                 ldb,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverZgesvdjBatched(hipsolverDnHandle_t   handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   m,
+                                          int                   n,
+                                          hipDoubleComplex*     A,
+                                          int                   lda,
+                                          double*               S,
+                                          hipDoubleComplex*     U,
+                                          int                   ldu,
+                                          hipDoubleComplex*     V,
+                                          int                   ldv,
+                                          hipDoubleComplex*     work,
+                                          int                   lwork,
+                                          int*                  devInfo,
+                                          hipsolverGesvdjInfo_t info,
+                                          int                   batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDpotrs((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       nrhs,
-                                                       A,
-                                                       lda,
-                                                       B,
-                                                       ldb,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnZgesvdjBatched((cusolverDnHandle_t)handle,
+                                                               hipsolver::hip2cuda_evect(jobz),
+                                                               m,
+                                                               n,
+                                                               (cuDoubleComplex*)A,
+                                                               lda,
+                                                               S,
+                                                               (cuDoubleComplex*)U,
+                                                               ldu,
+                                                               (cuDoubleComplex*)V,
+                                                               ldv,
+                                                               (cuDoubleComplex*)work,
+                                                               lwork,
+                                                               devInfo,
+                                                               (gesvdjInfo_t)info,
+                                                               batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrs(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  int                 nrhs,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  hipFloatComplex*    B,
-                                  int                 ldb,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+/******************** GESVDA_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverDnSgesvdaStridedBatched_bufferSize(hipsolverHandle_t  handle,
+                                                              hipsolverEigMode_t jobz,
+                                                              int                rank,
+                                                              int                m,
+                                                              int                n,
+                                                              const float*       A,
+                                                              int                lda,
+                                                              long long int      strideA,
+                                                              const float*       S,
+                                                              long long int      strideS,
+                                                              const float*       U,
+                                                              int                ldu,
+                                                              long long int      strideU,
+                                                              const float*       V,
+                                                              int                ldv,
+                                                              long long int      strideV,
+                                                              int*               lwork,
+                                                              int                batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCpotrs((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       nrhs,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       (cuComplex*)B,
-                                                       ldb,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(
+        cusolverDnSgesvdaStridedBatched_bufferSize((cusolverDnHandle_t)handle,
+                                                   hipsolver::hip2cuda_evect(jobz),
+                                                   rank,
+                                                   m,
+                                                   n,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   S,
+                                                   strideS,
+                                                   U,
+                                                   ldu,
+                                                   strideU,
+                                                   V,
+                                                   ldv,
+                                                   strideV,
+                                                   lwork,
+                                                   batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrs(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  int                 nrhs,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  hipDoubleComplex*   B,
-                                  int                 ldb,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverDnDgesvdaStridedBatched_bufferSize(hipsolverHandle_t  handle,
+                                                              hipsolverEigMode_t jobz,
+                                                              int                rank,
+                                                              int                m,
+                                                              int                n,
+                                                              const double*      A,
+                                                              int                lda,
+                                                              long long int      strideA,
+                                                              const double*      S,
+                                                              long long int      strideS,
+                                                              const double*      U,
+                                                              int                ldu,
+                                                              long long int      strideU,
+                                                              const double*      V,
+                                                              int                ldv,
+                                                              long long int      strideV,
+                                                              int*               lwork,
+                                                              int                batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZpotrs((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       nrhs,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       (cuDoubleComplex*)B,
-                                                       ldb,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(
+        cusolverDnDgesvdaStridedBatched_bufferSize((cusolverDnHandle_t)handle,
+                                                   hipsolver::hip2cuda_evect(jobz),
+                                                   rank,
+                                                   m,
+                                                   n,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   S,
+                                                   strideS,
+                                                   U,
+                                                   ldu,
+                                                   strideU,
+                                                   V,
+                                                   ldv,
+                                                   strideV,
+                                                   lwork,
+                                                   batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** POTRS_BATCHED ********************/
-hipsolverStatus_t hipsolverSpotrsBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    float*              A[],
-                                                    int                 lda,
-                                                    float*              B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverDnCgesvdaStridedBatched_bufferSize(hipsolverHandle_t      handle,
+                                                              hipsolverEigMode_t     jobz,
+                                                              int                    rank,
+                                                              int                    m,
+                                                              int                    n,
+                                                              const hipFloatComplex* A,
+                                                              int                    lda,
+                                                              long long int          strideA,
+                                                              const float*           S,
+                                                              long long int          strideS,
+                                                              const hipFloatComplex* U,
+                                                              int                    ldu,
+                                                              long long int          strideU,
+                                                              const hipFloatComplex* V,
+                                                              int                    ldv,
+                                                              long long int          strideV,
+                                                              int*                   lwork,
+                                                              int                    batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return hipsolver::cuda2hip_status(
+        cusolverDnCgesvdaStridedBatched_bufferSize((cusolverDnHandle_t)handle,
+                                                   hipsolver::hip2cuda_evect(jobz),
+                                                   rank,
+                                                   m,
+                                                   n,
+                                                   (cuComplex*)A,
+                                                   lda,
+                                                   strideA,
+                                                   S,
+                                                   strideS,
+                                                   (cuComplex*)U,
+                                                   ldu,
+                                                   strideU,
+                                                   (cuComplex*)V,
+                                                   ldv,
+                                                   strideV,
+                                                   lwork,
+                                                   batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrsBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    double*             A[],
-                                                    int                 lda,
-                                                    double*             B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverDnZgesvdaStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                                              hipsolverEigMode_t      jobz,
+                                                              int                     rank,
+                                                              int                     m,
+                                                              int                     n,
+                                                              const hipDoubleComplex* A,
+                                                              int                     lda,
+                                                              long long int           strideA,
+                                                              const double*           S,
+                                                              long long int           strideS,
+                                                              const hipDoubleComplex* U,
+                                                              int                     ldu,
+                                                              long long int           strideU,
+                                                              const hipDoubleComplex* V,
+                                                              int                     ldv,
+                                                              long long int           strideV,
+                                                              int*                    lwork,
+                                                              int                     batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return hipsolver::cuda2hip_status(
+        cusolverDnZgesvdaStridedBatched_bufferSize((cusolverDnHandle_t)handle,
+                                                   hipsolver::hip2cuda_evect(jobz),
+                                                   rank,
+                                                   m,
+                                                   n,
+                                                   (cuDoubleComplex*)A,
+                                                   lda,
+                                                   strideA,
+                                                   S,
+                                                   strideS,
+                                                   (cuDoubleComplex*)U,
+                                                   ldu,
+                                                   strideU,
+                                                   (cuDoubleComplex*)V,
+                                                   ldv,
+                                                   strideV,
+                                                   lwork,
+                                                   batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrsBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    hipFloatComplex*    A[],
-                                                    int                 lda,
-                                                    hipFloatComplex*    B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverDnSgesvdaStridedBatched(hipsolverHandle_t  handle,
+                                                   hipsolverEigMode_t jobz,
+                                                   int                rank,
+                                                   int                m,
+                                                   int                n,
+                                                   const float*       A,
+                                                   int                lda,
+                                                   long long int      strideA,
+                                                   float*             S,
+                                                   long long int      strideS,
+                                                   float*             U,
+                                                   int                ldu,
+                                                   long long int      strideU,
+                                                   float*             V,
+                                                   int                ldv,
+                                                   long long int      strideV,
+                                                   float*             work,
+                                                   int                lwork,
+                                                   int*               devInfo,
+                                                   double*            hRnrmF,
+                                                   int                batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return hipsolver::cuda2hip_status(
+        cusolverDnSgesvdaStridedBatched((cusolverDnHandle_t)handle,
+                                        hipsolver::hip2cuda_evect(jobz),
+                                        rank,
+                                        m,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        S,
+                                        strideS,
+                                        U,
+                                        ldu,
+                                        strideU,
+                                        V,
+                                        ldv,
+                                        strideV,
+                                        work,
+                                        lwork,
+                                        devInfo,
+                                        hRnrmF,
+                                        batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrsBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    hipDoubleComplex*   A[],
-                                                    int                 lda,
-                                                    hipDoubleComplex*   B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverDnDgesvdaStridedBatched(hipsolverHandle_t  handle,
+                                                   hipsolverEigMode_t jobz,
+                                                   int                rank,
+                                                   int                m,
+                                                   int                n,
+                                                   const double*      A,
+                                                   int                lda,
+                                                   long long int      strideA,
+                                                   double*            S,
+                                                   long long int      strideS,
+                                                   double*            U,
+                                                   int                ldu,
+                                                   long long int      strideU,
+                                                   double*            V,
+                                                   int                ldv,
+                                                   long long int      strideV,
+                                                   double*            work,
+                                                   int                lwork,
+                                                   int*               devInfo,
+                                                   double*            hRnrmF,
+                                                   int                batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!lwork)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return hipsolver::cuda2hip_status(
+        cusolverDnDgesvdaStridedBatched((cusolverDnHandle_t)handle,
+                                        hipsolver::hip2cuda_evect(jobz),
+                                        rank,
+                                        m,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        S,
+                                        strideS,
+                                        U,
+                                        ldu,
+                                        strideU,
+                                        V,
+                                        ldv,
+                                        strideV,
+                                        work,
+                                        lwork,
+                                        devInfo,
+                                        hRnrmF,
+                                        batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrsBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         float*              A[],
-                                         int                 lda,
-                                         float*              B[],
-                                         int                 ldb,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverDnCgesvdaStridedBatched(hipsolverHandle_t      handle,
+                                                   hipsolverEigMode_t     jobz,
+                                                   int                    rank,
+                                                   int                    m,
+                                                   int                    n,
+                                                   const hipFloatComplex* A,
+                                                   int                    lda,
+                                                   long long int          strideA,
+                                                   float*                 S,
+                                                   long long int          strideS,
+                                                   hipFloatComplex*       U,
+                                                   int                    ldu,
+                                                   long long int          strideU,
+                                                   hipFloatComplex*       V,
+                                                   int                    ldv,
+                                                   long long int          strideV,
+                                                   hipFloatComplex*       work,
+                                                   int                    lwork,
+                                                   int*                   devInfo,
+                                                   double*                hRnrmF,
+                                                   int                    batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSpotrsBatched((cusolverDnHandle_t)handle,
-                                                              hipsolver::hip2cuda_fill(uplo),
-                                                              n,
-                                                              nrhs,
-                                                              A,
-                                                              lda,
-                                                              B,
-                                                              ldb,
-                                                              devInfo,
-                                                              batch_count));
+    return hipsolver::cuda2hip_status(
+        cusolverDnCgesvdaStridedBatched((cusolverDnHandle_t)handle,
+                                        hipsolver::hip2cuda_evect(jobz),
+                                        rank,
+                                        m,
+                                        n,
+                                        (cuComplex*)A,
+                                        lda,
+                                        strideA,
+                                        S,
+                                        strideS,
+                                        (cuComplex*)U,
+                                        ldu,
+                                        strideU,
+                                        (cuComplex*)V,
+                                        ldv,
+                                        strideV,
+                                        (cuComplex*)work,
+                                        lwork,
+                                        devInfo,
+                                        hRnrmF,
+                                        batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrsBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         double*             A[],
-                                         int                 lda,
-                                         double*             B[],
-                                         int                 ldb,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverDnZgesvdaStridedBatched(hipsolverHandle_t       handle,
+                                                   hipsolverEigMode_t      jobz,
+                                                   int                     rank,
+                                                   int                     m,
+                                                   int                     n,
+                                                   const hipDoubleComplex* A,
+                                                   int                     lda,
+                                                   long long int           strideA,
+                                                   double*                 S,
+                                                   long long int           strideS,
+                                                   hipDoubleComplex*       U,
+                                                   int                     ldu,
+                                                   long long int           strideU,
+                                                   hipDoubleComplex*       V,
+                                                   int                     ldv,
+                                                   long long int           strideV,
+                                                   hipDoubleComplex*       work,
+                                                   int                     lwork,
+                                                   int*                    devInfo,
+                                                   double*                 hRnrmF,
+                                                   int                     batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDpotrsBatched((cusolverDnHandle_t)handle,
-                                                              hipsolver::hip2cuda_fill(uplo),
-                                                              n,
-                                                              nrhs,
-                                                              A,
-                                                              lda,
-                                                              B,
-                                                              ldb,
-                                                              devInfo,
-                                                              batch_count));
+    return hipsolver::cuda2hip_status(
+        cusolverDnZgesvdaStridedBatched((cusolverDnHandle_t)handle,
+                                        hipsolver::hip2cuda_evect(jobz),
+                                        rank,
+                                        m,
+                                        n,
+                                        (cuDoubleComplex*)A,
+                                        lda,
+                                        strideA,
+                                        S,
+                                        strideS,
+                                        (cuDoubleComplex*)U,
+                                        ldu,
+                                        strideU,
+                                        (cuDoubleComplex*)V,
+                                        ldv,
+                                        strideV,
+                                        (cuDoubleComplex*)work,
+                                        lwork,
+                                        devInfo,
+                                        hRnrmF,
+                                        batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrsBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         hipFloatComplex*    A[],
-                                         int                 lda,
-                                         hipFloatComplex*    B[],
-                                         int                 ldb,
-                                         hipFloatComplex*    work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+/******************** GETRF ********************/
+hipsolverStatus_t hipsolverSgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCpotrsBatched((cusolverDnHandle_t)handle,
-                                                              hipsolver::hip2cuda_fill(uplo),
-                                                              n,
-                                                              nrhs,
-                                                              (cuComplex**)A,
-                                                              lda,
-                                                              (cuComplex**)B,
-                                                              ldb,
-                                                              devInfo,
-                                                              batch_count));
+    return hipsolver::cuda2hip_status(
+        cusolverDnSgetrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrsBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         hipDoubleComplex*   A[],
-                                         int                 lda,
-                                         hipDoubleComplex*   B[],
-                                         int                 ldb,
-                                         hipDoubleComplex*   work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverDgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZpotrsBatched((cusolverDnHandle_t)handle,
-                                                              hipsolver::hip2cuda_fill(uplo),
-                                                              n,
-                                                              nrhs,
-                                                              (cuDoubleComplex**)A,
-                                                              lda,
-                                                              (cuDoubleComplex**)B,
-                                                              ldb,
-                                                              devInfo,
-                                                              batch_count));
+    return hipsolver::cuda2hip_status(
+        cusolverDnDgetrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** SYEVD/HEEVD ********************/
-hipsolverStatus_t hipsolverSsyevd_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverEigMode_t  jobz,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             float*              A,
-                                             int                 lda,
-                                             float*              W,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverCgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsyevd_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  A,
-                                                                  lda,
-                                                                  W,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(
+        cusolverDnCgetrf_bufferSize((cusolverDnHandle_t)handle, m, n, (cuComplex*)A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsyevd_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverEigMode_t  jobz,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             double*             A,
-                                             int                 lda,
-                                             double*             W,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverZgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDsyevd_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  A,
-                                                                  lda,
-                                                                  W,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(cusolverDnZgetrf_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, (cuDoubleComplex*)A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCheevd_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverEigMode_t  jobz,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             float*              W,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverSgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCheevd_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuComplex*)A,
-                                                                  lda,
-                                                                  W,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(
+        cusolverDnSgetrf((cusolverDnHandle_t)handle, m, n, A, lda, work, devIpiv, devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZheevd_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverEigMode_t  jobz,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             double*             W,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverDgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZheevd_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuDoubleComplex*)A,
-                                                                  lda,
-                                                                  W,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(
+        cusolverDnDgetrf((cusolverDnHandle_t)handle, m, n, A, lda, work, devIpiv, devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSsyevd(hipsolverHandle_t   handle,
-                                  hipsolverEigMode_t  jobz,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              W,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverCgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsyevd((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_evect(jobz),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       W,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnCgetrf(
+        (cusolverDnHandle_t)handle, m, n, (cuComplex*)A, lda, (cuComplex*)work, devIpiv, devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsyevd(hipsolverHandle_t   handle,
-                                  hipsolverEigMode_t  jobz,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             W,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverZgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDsyevd((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_evect(jobz),
-                                                       hipsolver::hip2cuda_fill(uplo),
+    return hipsolver::cuda2hip_status(cusolverDnZgetrf((cusolverDnHandle_t)handle,
+                                                       m,
                                                        n,
-                                                       A,
+                                                       (cuDoubleComplex*)A,
                                                        lda,
-                                                       W,
-                                                       work,
-                                                       lwork,
+                                                       (cuDoubleComplex*)work,
+                                                       devIpiv,
                                                        devInfo));
 }
 catch(...)
@@ -5354,2332 +5306,5355 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCheevd(hipsolverHandle_t   handle,
-                                  hipsolverEigMode_t  jobz,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  float*              W,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+/******************** GETRF_STRIDED_BATCHED ********************/
+// cuSOLVER has no strided-batched getrf; the problems are solved one after the other
+hipsolverStatus_t hipsolverSgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           int               m,
+                                                           int               n,
+                                                           float*            A,
+                                                           int               lda,
+                                                           long long int     strideA,
+                                                           int*              lwork,
+                                                           int               batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    return hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
-    return hipsolver::cuda2hip_status(cusolverDnCheevd((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_evect(jobz),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       W,
-                                                       (cuComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+hipsolverStatus_t hipsolverDgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           int               m,
+                                                           int               n,
+                                                           double*           A,
+                                                           int               lda,
+                                                           long long int     strideA,
+                                                           int*              lwork,
+                                                           int               batch_count)
+try
+{
+    return hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZheevd(hipsolverHandle_t   handle,
-                                  hipsolverEigMode_t  jobz,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  double*             W,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverCgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           int               m,
+                                                           int               n,
+                                                           hipFloatComplex*  A,
+                                                           int               lda,
+                                                           long long int     strideA,
+                                                           int*              lwork,
+                                                           int               batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    return hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
-    return hipsolver::cuda2hip_status(cusolverDnZheevd((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_evect(jobz),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       W,
-                                                       (cuDoubleComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+hipsolverStatus_t hipsolverZgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           int               m,
+                                                           int               n,
+                                                           hipDoubleComplex* A,
+                                                           int               lda,
+                                                           long long int     strideA,
+                                                           int*              lwork,
+                                                           int               batch_count)
+try
+{
+    return hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** SYEVDX/HEEVDX ********************/
-hipsolverStatus_t hipsolverSsyevdx_bufferSize(hipsolverHandle_t   handle,
-                                              hipsolverEigMode_t  jobz,
-                                              hipsolverEigRange_t range,
-                                              hipsolverFillMode_t uplo,
-                                              int                 n,
-                                              const float*        A,
-                                              int                 lda,
-                                              float               vl,
-                                              float               vu,
-                                              int                 il,
-                                              int                 iu,
-                                              int*                nev,
-                                              const float*        W,
-                                              int*                lwork)
+hipsolverStatus_t hipsolverSgetrfStridedBatched(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                float*            A,
+                                                int               lda,
+                                                long long int     strideA,
+                                                float*            work,
+                                                int               lwork,
+                                                int*              devIpiv,
+                                                long long int     strideP,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSsyevdx_bufferSize((cusolverDnHandle_t)handle,
-                                     hipsolver::hip2cuda_evect(jobz),
-                                     hipsolver::hip2cuda_erange(range),
-                                     hipsolver::hip2cuda_fill(uplo),
-                                     n,
-                                     A,
-                                     lda,
-                                     vl,
-                                     vu,
-                                     il,
-                                     iu,
-                                     nev,
-                                     W,
-                                     lwork));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverSgetrf(handle,
+                                              m,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              work,
+                                              lwork,
+                                              devIpiv ? devIpiv + b * strideP : nullptr,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsyevdx_bufferSize(hipsolverHandle_t   handle,
-                                              hipsolverEigMode_t  jobz,
-                                              hipsolverEigRange_t range,
-                                              hipsolverFillMode_t uplo,
-                                              int                 n,
-                                              const double*       A,
-                                              int                 lda,
-                                              double              vl,
-                                              double              vu,
-                                              int                 il,
-                                              int                 iu,
-                                              int*                nev,
-                                              const double*       W,
-                                              int*                lwork)
+hipsolverStatus_t hipsolverDgetrfStridedBatched(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                double*           A,
+                                                int               lda,
+                                                long long int     strideA,
+                                                double*           work,
+                                                int               lwork,
+                                                int*              devIpiv,
+                                                long long int     strideP,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnDsyevdx_bufferSize((cusolverDnHandle_t)handle,
-                                     hipsolver::hip2cuda_evect(jobz),
-                                     hipsolver::hip2cuda_erange(range),
-                                     hipsolver::hip2cuda_fill(uplo),
-                                     n,
-                                     A,
-                                     lda,
-                                     vl,
-                                     vu,
-                                     il,
-                                     iu,
-                                     nev,
-                                     W,
-                                     lwork));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverDgetrf(handle,
+                                              m,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              work,
+                                              lwork,
+                                              devIpiv ? devIpiv + b * strideP : nullptr,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCheevdx_bufferSize(hipsolverHandle_t      handle,
-                                              hipsolverEigMode_t     jobz,
-                                              hipsolverEigRange_t    range,
-                                              hipsolverFillMode_t    uplo,
-                                              int                    n,
-                                              const hipFloatComplex* A,
-                                              int                    lda,
-                                              float                  vl,
-                                              float                  vu,
-                                              int                    il,
-                                              int                    iu,
-                                              int*                   nev,
-                                              const float*           W,
-                                              int*                   lwork)
+hipsolverStatus_t hipsolverCgetrfStridedBatched(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                hipFloatComplex*  A,
+                                                int               lda,
+                                                long long int     strideA,
+                                                hipFloatComplex*  work,
+                                                int               lwork,
+                                                int*              devIpiv,
+                                                long long int     strideP,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnCheevdx_bufferSize((cusolverDnHandle_t)handle,
-                                     hipsolver::hip2cuda_evect(jobz),
-                                     hipsolver::hip2cuda_erange(range),
-                                     hipsolver::hip2cuda_fill(uplo),
-                                     n,
-                                     (cuComplex*)A,
-                                     lda,
-                                     vl,
-                                     vu,
-                                     il,
-                                     iu,
-                                     nev,
-                                     W,
-                                     lwork));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverCgetrf(handle,
+                                              m,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              work,
+                                              lwork,
+                                              devIpiv ? devIpiv + b * strideP : nullptr,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZheevdx_bufferSize(hipsolverHandle_t       handle,
-                                              hipsolverEigMode_t      jobz,
-                                              hipsolverEigRange_t     range,
-                                              hipsolverFillMode_t     uplo,
-                                              int                     n,
-                                              const hipDoubleComplex* A,
-                                              int                     lda,
-                                              double                  vl,
-                                              double                  vu,
-                                              int                     il,
-                                              int                     iu,
-                                              int*                    nev,
-                                              const double*           W,
-                                              int*                    lwork)
+hipsolverStatus_t hipsolverZgetrfStridedBatched(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                hipDoubleComplex* A,
+                                                int               lda,
+                                                long long int     strideA,
+                                                hipDoubleComplex* work,
+                                                int               lwork,
+                                                int*              devIpiv,
+                                                long long int     strideP,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnZheevdx_bufferSize((cusolverDnHandle_t)handle,
-                                     hipsolver::hip2cuda_evect(jobz),
-                                     hipsolver::hip2cuda_erange(range),
-                                     hipsolver::hip2cuda_fill(uplo),
-                                     n,
-                                     (cuDoubleComplex*)A,
-                                     lda,
-                                     vl,
-                                     vu,
-                                     il,
-                                     iu,
-                                     nev,
-                                     W,
-                                     lwork));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverZgetrf(handle,
+                                              m,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              work,
+                                              lwork,
+                                              devIpiv ? devIpiv + b * strideP : nullptr,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSsyevdx(hipsolverHandle_t   handle,
-                                   hipsolverEigMode_t  jobz,
-                                   hipsolverEigRange_t range,
-                                   hipsolverFillMode_t uplo,
-                                   int                 n,
-                                   float*              A,
-                                   int                 lda,
-                                   float               vl,
-                                   float               vu,
-                                   int                 il,
-                                   int                 iu,
-                                   int*                nev,
-                                   float*              W,
-                                   float*              work,
-                                   int                 lwork,
-                                   int*                devInfo)
+/******************** GETRS ********************/
+hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             float*               B,
+                                             int                  ldb,
+                                             int*                 lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsyevdx((cusolverDnHandle_t)handle,
-                                                        hipsolver::hip2cuda_evect(jobz),
-                                                        hipsolver::hip2cuda_erange(range),
-                                                        hipsolver::hip2cuda_fill(uplo),
-                                                        n,
-                                                        A,
-                                                        lda,
-                                                        vl,
-                                                        vu,
-                                                        il,
-                                                        iu,
-                                                        nev,
-                                                        W,
-                                                        work,
-                                                        lwork,
-                                                        devInfo));
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsyevdx(hipsolverHandle_t   handle,
-                                   hipsolverEigMode_t  jobz,
-                                   hipsolverEigRange_t range,
-                                   hipsolverFillMode_t uplo,
-                                   int                 n,
-                                   double*             A,
-                                   int                 lda,
-                                   double              vl,
-                                   double              vu,
-                                   int                 il,
-                                   int                 iu,
-                                   int*                nev,
-                                   double*             W,
-                                   double*             work,
-                                   int                 lwork,
-                                   int*                devInfo)
+hipsolverStatus_t hipsolverDgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             double*              B,
+                                             int                  ldb,
+                                             int*                 lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDsyevdx((cusolverDnHandle_t)handle,
-                                                        hipsolver::hip2cuda_evect(jobz),
-                                                        hipsolver::hip2cuda_erange(range),
-                                                        hipsolver::hip2cuda_fill(uplo),
-                                                        n,
-                                                        A,
-                                                        lda,
-                                                        vl,
-                                                        vu,
-                                                        il,
-                                                        iu,
-                                                        nev,
-                                                        W,
-                                                        work,
-                                                        lwork,
-                                                        devInfo));
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCheevdx(hipsolverHandle_t   handle,
-                                   hipsolverEigMode_t  jobz,
-                                   hipsolverEigRange_t range,
-                                   hipsolverFillMode_t uplo,
-                                   int                 n,
-                                   hipFloatComplex*    A,
-                                   int                 lda,
-                                   float               vl,
-                                   float               vu,
-                                   int                 il,
-                                   int                 iu,
-                                   int*                nev,
-                                   float*              W,
-                                   hipFloatComplex*    work,
-                                   int                 lwork,
-                                   int*                devInfo)
+hipsolverStatus_t hipsolverCgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipFloatComplex*     B,
+                                             int                  ldb,
+                                             int*                 lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnCheevdx((cusolverDnHandle_t)handle,
-                                                        hipsolver::hip2cuda_evect(jobz),
-                                                        hipsolver::hip2cuda_erange(range),
-                                                        hipsolver::hip2cuda_fill(uplo),
-                                                        n,
-                                                        (cuComplex*)A,
-                                                        lda,
-                                                        vl,
-                                                        vu,
-                                                        il,
-                                                        iu,
-                                                        nev,
-                                                        W,
-                                                        (cuComplex*)work,
-                                                        lwork,
-                                                        devInfo));
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZheevdx(hipsolverHandle_t   handle,
-                                   hipsolverEigMode_t  jobz,
-                                   hipsolverEigRange_t range,
-                                   hipsolverFillMode_t uplo,
-                                   int                 n,
-                                   hipDoubleComplex*   A,
-                                   int                 lda,
-                                   double              vl,
-                                   double              vu,
-                                   int                 il,
-                                   int                 iu,
-                                   int*                nev,
-                                   double*             W,
-                                   hipDoubleComplex*   work,
-                                   int                 lwork,
-                                   int*                devInfo)
+hipsolverStatus_t hipsolverZgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipDoubleComplex*    B,
+                                             int                  ldb,
+                                             int*                 lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZheevdx((cusolverDnHandle_t)handle,
-                                                        hipsolver::hip2cuda_evect(jobz),
-                                                        hipsolver::hip2cuda_erange(range),
-                                                        hipsolver::hip2cuda_fill(uplo),
-                                                        n,
-                                                        (cuDoubleComplex*)A,
-                                                        lda,
-                                                        vl,
-                                                        vu,
-                                                        il,
-                                                        iu,
-                                                        nev,
-                                                        W,
-                                                        (cuDoubleComplex*)work,
-                                                        lwork,
-                                                        devInfo));
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** SYEVJ/HEEVJ ********************/
-hipsolverStatus_t hipsolverSsyevj_bufferSize(hipsolverDnHandle_t  handle,
-                                             hipsolverEigMode_t   jobz,
-                                             hipsolverFillMode_t  uplo,
-                                             int                  n,
-                                             float*               A,
-                                             int                  lda,
-                                             float*               W,
-                                             int*                 lwork,
-                                             hipsolverSyevjInfo_t info)
+hipsolverStatus_t hipsolverSgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  float*               A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  float*               B,
+                                  int                  ldb,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsyevj_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  A,
-                                                                  lda,
-                                                                  W,
-                                                                  lwork,
-                                                                  (syevjInfo_t)info));
+    return hipsolver::cuda2hip_status(cusolverDnSgetrs((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_operation(trans),
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       lda,
+                                                       devIpiv,
+                                                       B,
+                                                       ldb,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsyevj_bufferSize(hipsolverDnHandle_t  handle,
-                                             hipsolverEigMode_t   jobz,
-                                             hipsolverFillMode_t  uplo,
-                                             int                  n,
-                                             double*              A,
-                                             int                  lda,
-                                             double*              W,
-                                             int*                 lwork,
-                                             hipsolverSyevjInfo_t info)
+hipsolverStatus_t hipsolverDgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  double*              A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  double*              B,
+                                  int                  ldb,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDsyevj_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  A,
-                                                                  lda,
-                                                                  W,
-                                                                  lwork,
-                                                                  (syevjInfo_t)info));
+    return hipsolver::cuda2hip_status(cusolverDnDgetrs((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_operation(trans),
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       lda,
+                                                       devIpiv,
+                                                       B,
+                                                       ldb,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCheevj_bufferSize(hipsolverDnHandle_t  handle,
-                                             hipsolverEigMode_t   jobz,
-                                             hipsolverFillMode_t  uplo,
-                                             int                  n,
-                                             hipFloatComplex*     A,
-                                             int                  lda,
-                                             float*               W,
-                                             int*                 lwork,
-                                             hipsolverSyevjInfo_t info)
-try
-{
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    return hipsolver::cuda2hip_status(cusolverDnCheevj_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuComplex*)A,
-                                                                  lda,
-                                                                  W,
-                                                                  lwork,
-                                                                  (syevjInfo_t)info));
-}
-catch(...)
-{
-    return hipsolver::exception2hip_status();
-}
-
-hipsolverStatus_t hipsolverZheevj_bufferSize(hipsolverDnHandle_t  handle,
-                                             hipsolverEigMode_t   jobz,
-                                             hipsolverFillMode_t  uplo,
-                                             int                  n,
-                                             hipDoubleComplex*    A,
-                                             int                  lda,
-                                             double*              W,
-                                             int*                 lwork,
-                                             hipsolverSyevjInfo_t info)
+hipsolverStatus_t hipsolverCgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  hipFloatComplex*     B,
+                                  int                  ldb,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZheevj_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuDoubleComplex*)A,
-                                                                  lda,
-                                                                  W,
-                                                                  lwork,
-                                                                  (syevjInfo_t)info));
+    return hipsolver::cuda2hip_status(cusolverDnCgetrs((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_operation(trans),
+                                                       n,
+                                                       nrhs,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       devIpiv,
+                                                       (cuComplex*)B,
+                                                       ldb,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSsyevj(hipsolverDnHandle_t  handle,
-                                  hipsolverEigMode_t   jobz,
-                                  hipsolverFillMode_t  uplo,
+hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
                                   int                  n,
-                                  float*               A,
+                                  int                  nrhs,
+                                  hipDoubleComplex*    A,
                                   int                  lda,
-                                  float*               W,
-                                  float*               work,
+                                  int*                 devIpiv,
+                                  hipDoubleComplex*    B,
+                                  int                  ldb,
+                                  hipDoubleComplex*    work,
                                   int                  lwork,
-                                  int*                 devInfo,
-                                  hipsolverSyevjInfo_t info)
+                                  int*                 devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsyevj((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_evect(jobz),
-                                                       hipsolver::hip2cuda_fill(uplo),
+    return hipsolver::cuda2hip_status(cusolverDnZgetrs((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_operation(trans),
                                                        n,
-                                                       A,
+                                                       nrhs,
+                                                       (cuDoubleComplex*)A,
                                                        lda,
-                                                       W,
-                                                       work,
-                                                       lwork,
-                                                       devInfo,
-                                                       (syevjInfo_t)info));
+                                                       devIpiv,
+                                                       (cuDoubleComplex*)B,
+                                                       ldb,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsyevj(hipsolverDnHandle_t  handle,
-                                  hipsolverEigMode_t   jobz,
-                                  hipsolverFillMode_t  uplo,
-                                  int                  n,
-                                  double*              A,
-                                  int                  lda,
-                                  double*              W,
-                                  double*              work,
-                                  int                  lwork,
-                                  int*                 devInfo,
-                                  hipsolverSyevjInfo_t info)
+/******************** GETRS_STRIDED_BATCHED ********************/
+// cuSOLVER has no strided-batched getrs; the problems are solved one after the other
+hipsolverStatus_t hipsolverSgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                                           hipsolverOperation_t trans,
+                                                           int                  n,
+                                                           int                  nrhs,
+                                                           float*               A,
+                                                           int                  lda,
+                                                           long long int        strideA,
+                                                           int*                 devIpiv,
+                                                           long long int        strideP,
+                                                           float*               B,
+                                                           int                  ldb,
+                                                           long long int        strideB,
+                                                           int*                 lwork,
+                                                           int                  batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    return hipsolver::cuda2hip_status(cusolverDnDsyevj((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_evect(jobz),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       W,
-                                                       work,
-                                                       lwork,
-                                                       devInfo,
-                                                       (syevjInfo_t)info));
+    return hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, lwork);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCheevj(hipsolverDnHandle_t  handle,
-                                  hipsolverEigMode_t   jobz,
-                                  hipsolverFillMode_t  uplo,
-                                  int                  n,
-                                  hipFloatComplex*     A,
-                                  int                  lda,
-                                  float*               W,
-                                  hipFloatComplex*     work,
-                                  int                  lwork,
-                                  int*                 devInfo,
-                                  hipsolverSyevjInfo_t info)
+hipsolverStatus_t hipsolverDgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                                           hipsolverOperation_t trans,
+                                                           int                  n,
+                                                           int                  nrhs,
+                                                           double*              A,
+                                                           int                  lda,
+                                                           long long int        strideA,
+                                                           int*                 devIpiv,
+                                                           long long int        strideP,
+                                                           double*              B,
+                                                           int                  ldb,
+                                                           long long int        strideB,
+                                                           int*                 lwork,
+                                                           int                  batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    return hipsolver::cuda2hip_status(cusolverDnCheevj((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_evect(jobz),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       W,
-                                                       (cuComplex*)work,
-                                                       lwork,
-                                                       devInfo,
-                                                       (syevjInfo_t)info));
+    return hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, lwork);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZheevj(hipsolverDnHandle_t  handle,
-                                  hipsolverEigMode_t   jobz,
-                                  hipsolverFillMode_t  uplo,
-                                  int                  n,
-                                  hipDoubleComplex*    A,
-                                  int                  lda,
-                                  double*              W,
-                                  hipDoubleComplex*    work,
-                                  int                  lwork,
-                                  int*                 devInfo,
-                                  hipsolverSyevjInfo_t info)
+hipsolverStatus_t hipsolverCgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                                           hipsolverOperation_t trans,
+                                                           int                  n,
+                                                           int                  nrhs,
+                                                           hipFloatComplex*     A,
+                                                           int                  lda,
+                                                           long long int        strideA,
+                                                           int*                 devIpiv,
+                                                           long long int        strideP,
+                                                           hipFloatComplex*     B,
+                                                           int                  ldb,
+                                                           long long int        strideB,
+                                                           int*                 lwork,
+                                                           int                  batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
-    return hipsolver::cuda2hip_status(cusolverDnZheevj((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_evect(jobz),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       W,
-                                                       (cuDoubleComplex*)work,
-                                                       lwork,
-                                                       devInfo,
-                                                       (syevjInfo_t)info));
+hipsolverStatus_t hipsolverZgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                                           hipsolverOperation_t trans,
+                                                           int                  n,
+                                                           int                  nrhs,
+                                                           hipDoubleComplex*    A,
+                                                           int                  lda,
+                                                           long long int        strideA,
+                                                           int*                 devIpiv,
+                                                           long long int        strideP,
+                                                           hipDoubleComplex*    B,
+                                                           int                  ldb,
+                                                           long long int        strideB,
+                                                           int*                 lwork,
+                                                           int                  batch_count)
+try
+{
+    return hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, lwork);
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** SYEVJ_BATCHED/HEEVJ_BATCHED ********************/
-hipsolverStatus_t hipsolverSsyevjBatched_bufferSize(hipsolverDnHandle_t  handle,
-                                                    hipsolverEigMode_t   jobz,
-                                                    hipsolverFillMode_t  uplo,
-                                                    int                  n,
-                                                    float*               A,
-                                                    int                  lda,
-                                                    float*               W,
-                                                    int*                 lwork,
-                                                    hipsolverSyevjInfo_t info,
-                                                    int                  batch_count)
+hipsolverStatus_t hipsolverSgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                hipsolverOperation_t trans,
+                                                int                  n,
+                                                int                  nrhs,
+                                                float*               A,
+                                                int                  lda,
+                                                long long int        strideA,
+                                                int*                 devIpiv,
+                                                long long int        strideP,
+                                                float*               B,
+                                                int                  ldb,
+                                                long long int        strideB,
+                                                float*               work,
+                                                int                  lwork,
+                                                int*                 devInfo,
+                                                int                  batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
+    if(batch_count < 0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSsyevjBatched_bufferSize((cusolverDnHandle_t)handle,
-                                           hipsolver::hip2cuda_evect(jobz),
-                                           hipsolver::hip2cuda_fill(uplo),
-                                           n,
-                                           A,
-                                           lda,
-                                           W,
-                                           lwork,
-                                           (syevjInfo_t)info,
-                                           batch_count));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverSgetrs(handle,
+                                              trans,
+                                              n,
+                                              nrhs,
+                                              A + b * strideA,
+                                              lda,
+                                              devIpiv + b * strideP,
+                                              B + b * strideB,
+                                              ldb,
+                                              work,
+                                              lwork,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsyevjBatched_bufferSize(hipsolverDnHandle_t  handle,
-                                                    hipsolverEigMode_t   jobz,
-                                                    hipsolverFillMode_t  uplo,
-                                                    int                  n,
-                                                    double*              A,
-                                                    int                  lda,
-                                                    double*              W,
-                                                    int*                 lwork,
-                                                    hipsolverSyevjInfo_t info,
-                                                    int                  batch_count)
+hipsolverStatus_t hipsolverDgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                hipsolverOperation_t trans,
+                                                int                  n,
+                                                int                  nrhs,
+                                                double*              A,
+                                                int                  lda,
+                                                long long int        strideA,
+                                                int*                 devIpiv,
+                                                long long int        strideP,
+                                                double*              B,
+                                                int                  ldb,
+                                                long long int        strideB,
+                                                double*              work,
+                                                int                  lwork,
+                                                int*                 devInfo,
+                                                int                  batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
+    if(batch_count < 0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnDsyevjBatched_bufferSize((cusolverDnHandle_t)handle,
-                                           hipsolver::hip2cuda_evect(jobz),
-                                           hipsolver::hip2cuda_fill(uplo),
-                                           n,
-                                           A,
-                                           lda,
-                                           W,
-                                           lwork,
-                                           (syevjInfo_t)info,
-                                           batch_count));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverDgetrs(handle,
+                                              trans,
+                                              n,
+                                              nrhs,
+                                              A + b * strideA,
+                                              lda,
+                                              devIpiv + b * strideP,
+                                              B + b * strideB,
+                                              ldb,
+                                              work,
+                                              lwork,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCheevjBatched_bufferSize(hipsolverDnHandle_t  handle,
-                                                    hipsolverEigMode_t   jobz,
-                                                    hipsolverFillMode_t  uplo,
-                                                    int                  n,
-                                                    hipFloatComplex*     A,
-                                                    int                  lda,
-                                                    float*               W,
-                                                    int*                 lwork,
-                                                    hipsolverSyevjInfo_t info,
-                                                    int                  batch_count)
+hipsolverStatus_t hipsolverCgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                hipsolverOperation_t trans,
+                                                int                  n,
+                                                int                  nrhs,
+                                                hipFloatComplex*     A,
+                                                int                  lda,
+                                                long long int        strideA,
+                                                int*                 devIpiv,
+                                                long long int        strideP,
+                                                hipFloatComplex*     B,
+                                                int                  ldb,
+                                                long long int        strideB,
+                                                hipFloatComplex*     work,
+                                                int                  lwork,
+                                                int*                 devInfo,
+                                                int                  batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
+    if(batch_count < 0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnCheevjBatched_bufferSize((cusolverDnHandle_t)handle,
-                                           hipsolver::hip2cuda_evect(jobz),
-                                           hipsolver::hip2cuda_fill(uplo),
-                                           n,
-                                           (cuComplex*)A,
-                                           lda,
-                                           W,
-                                           lwork,
-                                           (syevjInfo_t)info,
-                                           batch_count));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverCgetrs(handle,
+                                              trans,
+                                              n,
+                                              nrhs,
+                                              A + b * strideA,
+                                              lda,
+                                              devIpiv + b * strideP,
+                                              B + b * strideB,
+                                              ldb,
+                                              work,
+                                              lwork,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZheevjBatched_bufferSize(hipsolverDnHandle_t  handle,
-                                                    hipsolverEigMode_t   jobz,
-                                                    hipsolverFillMode_t  uplo,
-                                                    int                  n,
-                                                    hipDoubleComplex*    A,
-                                                    int                  lda,
-                                                    double*              W,
-                                                    int*                 lwork,
-                                                    hipsolverSyevjInfo_t info,
-                                                    int                  batch_count)
+hipsolverStatus_t hipsolverZgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                hipsolverOperation_t trans,
+                                                int                  n,
+                                                int                  nrhs,
+                                                hipDoubleComplex*    A,
+                                                int                  lda,
+                                                long long int        strideA,
+                                                int*                 devIpiv,
+                                                long long int        strideP,
+                                                hipDoubleComplex*    B,
+                                                int                  ldb,
+                                                long long int        strideB,
+                                                hipDoubleComplex*    work,
+                                                int                  lwork,
+                                                int*                 devInfo,
+                                                int                  batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
+    if(batch_count < 0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnZheevjBatched_bufferSize((cusolverDnHandle_t)handle,
-                                           hipsolver::hip2cuda_evect(jobz),
-                                           hipsolver::hip2cuda_fill(uplo),
-                                           n,
-                                           (cuDoubleComplex*)A,
-                                           lda,
-                                           W,
-                                           lwork,
-                                           (syevjInfo_t)info,
-                                           batch_count));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverZgetrs(handle,
+                                              trans,
+                                              n,
+                                              nrhs,
+                                              A + b * strideA,
+                                              lda,
+                                              devIpiv + b * strideP,
+                                              B + b * strideB,
+                                              ldb,
+                                              work,
+                                              lwork,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSsyevjBatched(hipsolverDnHandle_t  handle,
-                                         hipsolverEigMode_t   jobz,
-                                         hipsolverFillMode_t  uplo,
-                                         int                  n,
-                                         float*               A,
-                                         int                  lda,
-                                         float*               W,
-                                         float*               work,
-                                         int                  lwork,
-                                         int*                 devInfo,
-                                         hipsolverSyevjInfo_t info,
-                                         int                  batch_count)
+/******************** POTRF ********************/
+hipsolverStatus_t hipsolverSpotrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsyevjBatched((cusolverDnHandle_t)handle,
-                                                              hipsolver::hip2cuda_evect(jobz),
-                                                              hipsolver::hip2cuda_fill(uplo),
-                                                              n,
-                                                              A,
-                                                              lda,
-                                                              W,
-                                                              work,
-                                                              lwork,
-                                                              devInfo,
-                                                              (syevjInfo_t)info,
-                                                              batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnSpotrf_bufferSize(
+        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsyevjBatched(hipsolverDnHandle_t  handle,
-                                         hipsolverEigMode_t   jobz,
-                                         hipsolverFillMode_t  uplo,
-                                         int                  n,
-                                         double*              A,
-                                         int                  lda,
-                                         double*              W,
-                                         double*              work,
-                                         int                  lwork,
-                                         int*                 devInfo,
-                                         hipsolverSyevjInfo_t info,
-                                         int                  batch_count)
+hipsolverStatus_t hipsolverDpotrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDsyevjBatched((cusolverDnHandle_t)handle,
-                                                              hipsolver::hip2cuda_evect(jobz),
-                                                              hipsolver::hip2cuda_fill(uplo),
-                                                              n,
-                                                              A,
-                                                              lda,
-                                                              W,
-                                                              work,
-                                                              lwork,
-                                                              devInfo,
-                                                              (syevjInfo_t)info,
-                                                              batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnDpotrf_bufferSize(
+        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCheevjBatched(hipsolverDnHandle_t  handle,
-                                         hipsolverEigMode_t   jobz,
-                                         hipsolverFillMode_t  uplo,
-                                         int                  n,
-                                         hipFloatComplex*     A,
-                                         int                  lda,
-                                         float*               W,
-                                         hipFloatComplex*     work,
-                                         int                  lwork,
-                                         int*                 devInfo,
-                                         hipsolverSyevjInfo_t info,
-                                         int                  batch_count)
+hipsolverStatus_t hipsolverCpotrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int*                lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnCheevjBatched((cusolverDnHandle_t)handle,
-                                                              hipsolver::hip2cuda_evect(jobz),
-                                                              hipsolver::hip2cuda_fill(uplo),
-                                                              n,
-                                                              (cuComplex*)A,
-                                                              lda,
-                                                              W,
-                                                              (cuComplex*)work,
-                                                              lwork,
-                                                              devInfo,
-                                                              (syevjInfo_t)info,
-                                                              batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnCpotrf_bufferSize(
+        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, (cuComplex*)A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZheevjBatched(hipsolverDnHandle_t  handle,
-                                         hipsolverEigMode_t   jobz,
-                                         hipsolverFillMode_t  uplo,
-                                         int                  n,
-                                         hipDoubleComplex*    A,
-                                         int                  lda,
-                                         double*              W,
-                                         hipDoubleComplex*    work,
-                                         int                  lwork,
-                                         int*                 devInfo,
-                                         hipsolverSyevjInfo_t info,
-                                         int                  batch_count)
+hipsolverStatus_t hipsolverZpotrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int*                lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZheevjBatched((cusolverDnHandle_t)handle,
-                                                              hipsolver::hip2cuda_evect(jobz),
-                                                              hipsolver::hip2cuda_fill(uplo),
-                                                              n,
-                                                              (cuDoubleComplex*)A,
-                                                              lda,
-                                                              W,
-                                                              (cuDoubleComplex*)work,
-                                                              lwork,
-                                                              devInfo,
-                                                              (syevjInfo_t)info,
-                                                              batch_count));
+    return hipsolver::cuda2hip_status(cusolverDnZpotrf_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** SYGVD/HEGVD ********************/
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvd_bufferSize(hipsolverHandle_t   handle,
-                                                              hipsolverEigType_t  itype,
-                                                              hipsolverEigMode_t  jobz,
-                                                              hipsolverFillMode_t uplo,
-                                                              int                 n,
-                                                              float*              A,
-                                                              int                 lda,
-                                                              float*              B,
-                                                              int                 ldb,
-                                                              float*              W,
-                                                              int*                lwork)
+hipsolverStatus_t hipsolverSpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsygvd_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_eform(itype),
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  A,
-                                                                  lda,
-                                                                  B,
-                                                                  ldb,
-                                                                  W,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(cusolverDnSpotrf((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvd_bufferSize(hipsolverHandle_t   handle,
-                                                              hipsolverEigType_t  itype,
-                                                              hipsolverEigMode_t  jobz,
-                                                              hipsolverFillMode_t uplo,
-                                                              int                 n,
-                                                              double*             A,
-                                                              int                 lda,
-                                                              double*             B,
-                                                              int                 ldb,
-                                                              double*             W,
-                                                              int*                lwork)
+hipsolverStatus_t hipsolverDpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDsygvd_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_eform(itype),
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  A,
-                                                                  lda,
-                                                                  B,
-                                                                  ldb,
-                                                                  W,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(cusolverDnDpotrf((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvd_bufferSize(hipsolverHandle_t   handle,
-                                                              hipsolverEigType_t  itype,
-                                                              hipsolverEigMode_t  jobz,
-                                                              hipsolverFillMode_t uplo,
-                                                              int                 n,
-                                                              hipFloatComplex*    A,
-                                                              int                 lda,
-                                                              hipFloatComplex*    B,
-                                                              int                 ldb,
-                                                              float*              W,
-                                                              int*                lwork)
+hipsolverStatus_t hipsolverCpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnChegvd_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_eform(itype),
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuComplex*)A,
-                                                                  lda,
-                                                                  (cuComplex*)B,
-                                                                  ldb,
-                                                                  W,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(cusolverDnCpotrf((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       (cuComplex*)work,
+                                                       lwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd_bufferSize(hipsolverHandle_t   handle,
-                                                              hipsolverEigType_t  itype,
-                                                              hipsolverEigMode_t  jobz,
-                                                              hipsolverFillMode_t uplo,
-                                                              int                 n,
-                                                              hipDoubleComplex*   A,
-                                                              int                 lda,
-                                                              hipDoubleComplex*   B,
-                                                              int                 ldb,
-                                                              double*             W,
-                                                              int*                lwork)
+hipsolverStatus_t hipsolverZpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZhegvd_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_eform(itype),
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuDoubleComplex*)A,
-                                                                  lda,
-                                                                  (cuDoubleComplex*)B,
-                                                                  ldb,
-                                                                  W,
-                                                                  lwork));
+    return hipsolver::cuda2hip_status(cusolverDnZpotrf((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       (cuDoubleComplex*)work,
+                                                       lwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvd(hipsolverHandle_t   handle,
-                                                   hipsolverEigType_t  itype,
-                                                   hipsolverEigMode_t  jobz,
-                                                   hipsolverFillMode_t uplo,
-                                                   int                 n,
-                                                   float*              A,
-                                                   int                 lda,
-                                                   float*              B,
-                                                   int                 ldb,
-                                                   float*              W,
-                                                   float*              work,
-                                                   int                 lwork,
-                                                   int*                devInfo)
+/******************** POTRF_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsygvd((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_eform(itype),
-                                                       hipsolver::hip2cuda_evect(jobz),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       B,
-                                                       ldb,
-                                                       W,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvd(hipsolverHandle_t   handle,
-                                                   hipsolverEigType_t  itype,
-                                                   hipsolverEigMode_t  jobz,
-                                                   hipsolverFillMode_t uplo,
-                                                   int                 n,
-                                                   double*             A,
-                                                   int                 lda,
-                                                   double*             B,
-                                                   int                 ldb,
-                                                   double*             W,
-                                                   double*             work,
-                                                   int                 lwork,
-                                                   int*                devInfo)
+hipsolverStatus_t hipsolverDpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDsygvd((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_eform(itype),
-                                                       hipsolver::hip2cuda_evect(jobz),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       B,
-                                                       ldb,
-                                                       W,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvd(hipsolverHandle_t   handle,
-                                                   hipsolverEigType_t  itype,
-                                                   hipsolverEigMode_t  jobz,
-                                                   hipsolverFillMode_t uplo,
-                                                   int                 n,
-                                                   hipFloatComplex*    A,
-                                                   int                 lda,
-                                                   hipFloatComplex*    B,
-                                                   int                 ldb,
-                                                   float*              W,
-                                                   hipFloatComplex*    work,
-                                                   int                 lwork,
-                                                   int*                devInfo)
+hipsolverStatus_t hipsolverCpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipFloatComplex*    A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnChegvd((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_eform(itype),
-                                                       hipsolver::hip2cuda_evect(jobz),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       (cuComplex*)B,
-                                                       ldb,
-                                                       W,
-                                                       (cuComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd(hipsolverHandle_t   handle,
-                                                   hipsolverEigType_t  itype,
-                                                   hipsolverEigMode_t  jobz,
-                                                   hipsolverFillMode_t uplo,
-                                                   int                 n,
-                                                   hipDoubleComplex*   A,
-                                                   int                 lda,
-                                                   hipDoubleComplex*   B,
-                                                   int                 ldb,
-                                                   double*             W,
-                                                   hipDoubleComplex*   work,
-                                                   int                 lwork,
-                                                   int*                devInfo)
+hipsolverStatus_t hipsolverZpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipDoubleComplex*   A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZhegvd((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_eform(itype),
-                                                       hipsolver::hip2cuda_evect(jobz),
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       (cuDoubleComplex*)B,
-                                                       ldb,
-                                                       W,
-                                                       (cuDoubleComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** SYGVDX/HEGVDX ********************/
-hipsolverStatus_t hipsolverSsygvdx_bufferSize(hipsolverHandle_t   handle,
-                                              hipsolverEigType_t  itype,
-                                              hipsolverEigMode_t  jobz,
-                                              hipsolverEigRange_t range,
-                                              hipsolverFillMode_t uplo,
-                                              int                 n,
-                                              const float*        A,
-                                              int                 lda,
-                                              const float*        B,
-                                              int                 ldb,
-                                              float               vl,
-                                              float               vu,
-                                              int                 il,
-                                              int                 iu,
-                                              int*                nev,
-                                              const float*        W,
-                                              int*                lwork)
+hipsolverStatus_t hipsolverSpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A[],
+                                         int                 lda,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSsygvdx_bufferSize((cusolverDnHandle_t)handle,
-                                     hipsolver::hip2cuda_eform(itype),
-                                     hipsolver::hip2cuda_evect(jobz),
-                                     hipsolver::hip2cuda_erange(range),
-                                     hipsolver::hip2cuda_fill(uplo),
-                                     n,
-                                     A,
-                                     lda,
-                                     B,
-                                     ldb,
-                                     vl,
-                                     vu,
-                                     il,
-                                     iu,
-                                     nev,
-                                     W,
-                                     lwork));
+    return hipsolver::cuda2hip_status(cusolverDnSpotrfBatched((cusolverDnHandle_t)handle,
+                                                              hipsolver::hip2cuda_fill(uplo),
+                                                              n,
+                                                              A,
+                                                              lda,
+                                                              devInfo,
+                                                              batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsygvdx_bufferSize(hipsolverHandle_t   handle,
-                                              hipsolverEigType_t  itype,
-                                              hipsolverEigMode_t  jobz,
-                                              hipsolverEigRange_t range,
-                                              hipsolverFillMode_t uplo,
-                                              int                 n,
-                                              const double*       A,
-                                              int                 lda,
-                                              const double*       B,
-                                              int                 ldb,
-                                              double              vl,
-                                              double              vu,
-                                              int                 il,
-                                              int                 iu,
-                                              int*                nev,
-                                              const double*       W,
-                                              int*                lwork)
+hipsolverStatus_t hipsolverDpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A[],
+                                         int                 lda,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnDsygvdx_bufferSize((cusolverDnHandle_t)handle,
-                                     hipsolver::hip2cuda_eform(itype),
-                                     hipsolver::hip2cuda_evect(jobz),
-                                     hipsolver::hip2cuda_erange(range),
-                                     hipsolver::hip2cuda_fill(uplo),
-                                     n,
-                                     A,
-                                     lda,
-                                     B,
-                                     ldb,
-                                     vl,
-                                     vu,
-                                     il,
-                                     iu,
-                                     nev,
-                                     W,
-                                     lwork));
+    return hipsolver::cuda2hip_status(cusolverDnDpotrfBatched((cusolverDnHandle_t)handle,
+                                                              hipsolver::hip2cuda_fill(uplo),
+                                                              n,
+                                                              A,
+                                                              lda,
+                                                              devInfo,
+                                                              batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverChegvdx_bufferSize(hipsolverHandle_t      handle,
-                                              hipsolverEigType_t     itype,
-                                              hipsolverEigMode_t     jobz,
-                                              hipsolverEigRange_t    range,
-                                              hipsolverFillMode_t    uplo,
-                                              int                    n,
-                                              const hipFloatComplex* A,
-                                              int                    lda,
-                                              const hipFloatComplex* B,
-                                              int                    ldb,
-                                              float                  vl,
-                                              float                  vu,
-                                              int                    il,
-                                              int                    iu,
-                                              int*                   nev,
-                                              const float*           W,
-                                              int*                   lwork)
+hipsolverStatus_t hipsolverCpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipFloatComplex*    A[],
+                                         int                 lda,
+                                         hipFloatComplex*    work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnChegvdx_bufferSize((cusolverDnHandle_t)handle,
-                                     hipsolver::hip2cuda_eform(itype),
-                                     hipsolver::hip2cuda_evect(jobz),
-                                     hipsolver::hip2cuda_erange(range),
-                                     hipsolver::hip2cuda_fill(uplo),
-                                     n,
-                                     (cuComplex*)A,
-                                     lda,
-                                     (cuComplex*)B,
-                                     ldb,
-                                     vl,
-                                     vu,
-                                     il,
-                                     iu,
-                                     nev,
-                                     W,
-                                     lwork));
+    return hipsolver::cuda2hip_status(cusolverDnCpotrfBatched((cusolverDnHandle_t)handle,
+                                                              hipsolver::hip2cuda_fill(uplo),
+                                                              n,
+                                                              (cuComplex**)A,
+                                                              lda,
+                                                              devInfo,
+                                                              batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZhegvdx_bufferSize(hipsolverHandle_t       handle,
-                                              hipsolverEigType_t      itype,
-                                              hipsolverEigMode_t      jobz,
-                                              hipsolverEigRange_t     range,
-                                              hipsolverFillMode_t     uplo,
-                                              int                     n,
-                                              const hipDoubleComplex* A,
-                                              int                     lda,
-                                              const hipDoubleComplex* B,
-                                              int                     ldb,
-                                              double                  vl,
-                                              double                  vu,
-                                              int                     il,
-                                              int                     iu,
-                                              int*                    nev,
-                                              const double*           W,
-                                              int*                    lwork)
+hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipDoubleComplex*   A[],
+                                         int                 lda,
+                                         hipDoubleComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnZhegvdx_bufferSize((cusolverDnHandle_t)handle,
-                                     hipsolver::hip2cuda_eform(itype),
-                                     hipsolver::hip2cuda_evect(jobz),
-                                     hipsolver::hip2cuda_erange(range),
-                                     hipsolver::hip2cuda_fill(uplo),
-                                     n,
-                                     (cuDoubleComplex*)A,
-                                     lda,
-                                     (cuDoubleComplex*)B,
-                                     ldb,
-                                     vl,
-                                     vu,
-                                     il,
-                                     iu,
-                                     nev,
-                                     W,
-                                     lwork));
+    return hipsolver::cuda2hip_status(cusolverDnZpotrfBatched((cusolverDnHandle_t)handle,
+                                                              hipsolver::hip2cuda_fill(uplo),
+                                                              n,
+                                                              (cuDoubleComplex**)A,
+                                                              lda,
+                                                              devInfo,
+                                                              batch_count));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSsygvdx(hipsolverHandle_t   handle,
-                                   hipsolverEigType_t  itype,
-                                   hipsolverEigMode_t  jobz,
-                                   hipsolverEigRange_t range,
-                                   hipsolverFillMode_t uplo,
-                                   int                 n,
-                                   float*              A,
-                                   int                 lda,
-                                   float*              B,
-                                   int                 ldb,
-                                   float               vl,
-                                   float               vu,
-                                   int                 il,
-                                   int                 iu,
-                                   int*                nev,
-                                   float*              W,
-                                   float*              work,
-                                   int                 lwork,
-                                   int*                devInfo)
+/******************** POTRI ********************/
+hipsolverStatus_t hipsolverSpotri_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsygvdx((cusolverDnHandle_t)handle,
-                                                        hipsolver::hip2cuda_eform(itype),
-                                                        hipsolver::hip2cuda_evect(jobz),
-                                                        hipsolver::hip2cuda_erange(range),
-                                                        hipsolver::hip2cuda_fill(uplo),
-                                                        n,
-                                                        A,
-                                                        lda,
-                                                        B,
-                                                        ldb,
-                                                        vl,
-                                                        vu,
-                                                        il,
-                                                        iu,
-                                                        nev,
-                                                        W,
-                                                        work,
-                                                        lwork,
-                                                        devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnSpotri_bufferSize(
+        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsygvdx(hipsolverHandle_t   handle,
-                                   hipsolverEigType_t  itype,
-                                   hipsolverEigMode_t  jobz,
-                                   hipsolverEigRange_t range,
-                                   hipsolverFillMode_t uplo,
-                                   int                 n,
-                                   double*             A,
-                                   int                 lda,
-                                   double*             B,
-                                   int                 ldb,
-                                   double              vl,
-                                   double              vu,
-                                   int                 il,
-                                   int                 iu,
-                                   int*                nev,
-                                   double*             W,
-                                   double*             work,
-                                   int                 lwork,
-                                   int*                devInfo)
+hipsolverStatus_t hipsolverDpotri_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDsygvdx((cusolverDnHandle_t)handle,
-                                                        hipsolver::hip2cuda_eform(itype),
-                                                        hipsolver::hip2cuda_evect(jobz),
-                                                        hipsolver::hip2cuda_erange(range),
-                                                        hipsolver::hip2cuda_fill(uplo),
-                                                        n,
-                                                        A,
-                                                        lda,
-                                                        B,
-                                                        ldb,
-                                                        vl,
-                                                        vu,
-                                                        il,
-                                                        iu,
-                                                        nev,
-                                                        W,
-                                                        work,
-                                                        lwork,
-                                                        devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnDpotri_bufferSize(
+        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverChegvdx(hipsolverHandle_t   handle,
-                                   hipsolverEigType_t  itype,
-                                   hipsolverEigMode_t  jobz,
-                                   hipsolverEigRange_t range,
-                                   hipsolverFillMode_t uplo,
-                                   int                 n,
-                                   hipFloatComplex*    A,
-                                   int                 lda,
-                                   hipFloatComplex*    B,
-                                   int                 ldb,
-                                   float               vl,
-                                   float               vu,
-                                   int                 il,
-                                   int                 iu,
-                                   int*                nev,
-                                   float*              W,
-                                   hipFloatComplex*    work,
-                                   int                 lwork,
-                                   int*                devInfo)
+hipsolverStatus_t hipsolverCpotri_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnCpotri_bufferSize(
+        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, (cuComplex*)A, lda, lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotri_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnZpotri_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotri(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnSpotri((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotri(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnDpotri((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotri(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnCpotri((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       (cuComplex*)work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotri(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnZpotri((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       (cuDoubleComplex*)work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** POTRS ********************/
+hipsolverStatus_t hipsolverSpotrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              B,
+                                  int                 ldb,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnSpotrs((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       lda,
+                                                       B,
+                                                       ldb,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             B,
+                                  int                 ldb,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnDpotrs((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       lda,
+                                                       B,
+                                                       ldb,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    B,
+                                  int                 ldb,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnCpotrs((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       nrhs,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       (cuComplex*)B,
+                                                       ldb,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   B,
+                                  int                 ldb,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnZpotrs((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       nrhs,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       (cuDoubleComplex*)B,
+                                                       ldb,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** POTRS_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    float*              B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    double*             B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipFloatComplex*    A[],
+                                                    int                 lda,
+                                                    hipFloatComplex*    B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipDoubleComplex*   A[],
+                                                    int                 lda,
+                                                    hipDoubleComplex*   B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A[],
+                                         int                 lda,
+                                         float*              B[],
+                                         int                 ldb,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnSpotrsBatched((cusolverDnHandle_t)handle,
+                                                              hipsolver::hip2cuda_fill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              A,
+                                                              lda,
+                                                              B,
+                                                              ldb,
+                                                              devInfo,
+                                                              batch_count));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A[],
+                                         int                 lda,
+                                         double*             B[],
+                                         int                 ldb,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnDpotrsBatched((cusolverDnHandle_t)handle,
+                                                              hipsolver::hip2cuda_fill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              A,
+                                                              lda,
+                                                              B,
+                                                              ldb,
+                                                              devInfo,
+                                                              batch_count));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipFloatComplex*    A[],
+                                         int                 lda,
+                                         hipFloatComplex*    B[],
+                                         int                 ldb,
+                                         hipFloatComplex*    work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnCpotrsBatched((cusolverDnHandle_t)handle,
+                                                              hipsolver::hip2cuda_fill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              (cuComplex**)A,
+                                                              lda,
+                                                              (cuComplex**)B,
+                                                              ldb,
+                                                              devInfo,
+                                                              batch_count));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipDoubleComplex*   A[],
+                                         int                 lda,
+                                         hipDoubleComplex*   B[],
+                                         int                 ldb,
+                                         hipDoubleComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnZpotrsBatched((cusolverDnHandle_t)handle,
+                                                              hipsolver::hip2cuda_fill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              (cuDoubleComplex**)A,
+                                                              lda,
+                                                              (cuDoubleComplex**)B,
+                                                              ldb,
+                                                              devInfo,
+                                                              batch_count));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYEVD/HEEVD ********************/
+hipsolverStatus_t hipsolverSsyevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              W,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnSsyevd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  W,
+                                                                  lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             W,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnDsyevd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  W,
+                                                                  lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             float*              W,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnCheevd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuComplex*)A,
+                                                                  lda,
+                                                                  W,
+                                                                  lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             double*             W,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnZheevd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  W,
+                                                                  lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsyevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              W,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnSsyevd((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       W,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             W,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnDsyevd((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       W,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  float*              W,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnCheevd((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       W,
+                                                       (cuComplex*)work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  double*             W,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnZheevd((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       W,
+                                                       (cuDoubleComplex*)work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYEVD_STRIDED_BATCHED/HEEVD_STRIDED_BATCHED ********************/
+// cuSOLVER has no strided-batched syevd/heevd; the problems are solved one after the other
+hipsolverStatus_t hipsolverSsyevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverEigMode_t  jobz,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           float*              A,
+                                                           int                 lda,
+                                                           long long int       strideA,
+                                                           float*              W,
+                                                           long long int       strideW,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    return hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverEigMode_t  jobz,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           double*             A,
+                                                           int                 lda,
+                                                           long long int       strideA,
+                                                           double*             W,
+                                                           long long int       strideW,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    return hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverEigMode_t  jobz,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           hipFloatComplex*    A,
+                                                           int                 lda,
+                                                           long long int       strideA,
+                                                           float*              W,
+                                                           long long int       strideW,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    return hipsolverCheevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverEigMode_t  jobz,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           hipDoubleComplex*   A,
+                                                           int                 lda,
+                                                           long long int       strideA,
+                                                           double*             W,
+                                                           long long int       strideW,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    return hipsolverZheevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsyevdStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                float*              A,
+                                                int                 lda,
+                                                long long int       strideA,
+                                                float*              W,
+                                                long long int       strideW,
+                                                float*              work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverSsyevd(handle,
+                                              jobz,
+                                              uplo,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              W + b * strideW,
+                                              work,
+                                              lwork,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevdStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                double*             A,
+                                                int                 lda,
+                                                long long int       strideA,
+                                                double*             W,
+                                                long long int       strideW,
+                                                double*             work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverDsyevd(handle,
+                                              jobz,
+                                              uplo,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              W + b * strideW,
+                                              work,
+                                              lwork,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevdStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                hipFloatComplex*    A,
+                                                int                 lda,
+                                                long long int       strideA,
+                                                float*              W,
+                                                long long int       strideW,
+                                                hipFloatComplex*    work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverCheevd(handle,
+                                              jobz,
+                                              uplo,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              W + b * strideW,
+                                              work,
+                                              lwork,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevdStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                hipDoubleComplex*   A,
+                                                int                 lda,
+                                                long long int       strideA,
+                                                double*             W,
+                                                long long int       strideW,
+                                                hipDoubleComplex*   work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverZheevd(handle,
+                                              jobz,
+                                              uplo,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              W + b * strideW,
+                                              work,
+                                              lwork,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYEVDX/HEEVDX ********************/
+hipsolverStatus_t hipsolverSsyevdx_bufferSize(hipsolverHandle_t   handle,
+                                              hipsolverEigMode_t  jobz,
+                                              hipsolverEigRange_t range,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              const float*        A,
+                                              int                 lda,
+                                              float               vl,
+                                              float               vu,
+                                              int                 il,
+                                              int                 iu,
+                                              int*                nev,
+                                              const float*        W,
+                                              int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnSsyevdx_bufferSize((cusolverDnHandle_t)handle,
+                                     hipsolver::hip2cuda_evect(jobz),
+                                     hipsolver::hip2cuda_erange(range),
+                                     hipsolver::hip2cuda_fill(uplo),
+                                     n,
+                                     A,
+                                     lda,
+                                     vl,
+                                     vu,
+                                     il,
+                                     iu,
+                                     nev,
+                                     W,
+                                     lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevdx_bufferSize(hipsolverHandle_t   handle,
+                                              hipsolverEigMode_t  jobz,
+                                              hipsolverEigRange_t range,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              const double*       A,
+                                              int                 lda,
+                                              double              vl,
+                                              double              vu,
+                                              int                 il,
+                                              int                 iu,
+                                              int*                nev,
+                                              const double*       W,
+                                              int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnDsyevdx_bufferSize((cusolverDnHandle_t)handle,
+                                     hipsolver::hip2cuda_evect(jobz),
+                                     hipsolver::hip2cuda_erange(range),
+                                     hipsolver::hip2cuda_fill(uplo),
+                                     n,
+                                     A,
+                                     lda,
+                                     vl,
+                                     vu,
+                                     il,
+                                     iu,
+                                     nev,
+                                     W,
+                                     lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevdx_bufferSize(hipsolverHandle_t      handle,
+                                              hipsolverEigMode_t     jobz,
+                                              hipsolverEigRange_t    range,
+                                              hipsolverFillMode_t    uplo,
+                                              int                    n,
+                                              const hipFloatComplex* A,
+                                              int                    lda,
+                                              float                  vl,
+                                              float                  vu,
+                                              int                    il,
+                                              int                    iu,
+                                              int*                   nev,
+                                              const float*           W,
+                                              int*                   lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnCheevdx_bufferSize((cusolverDnHandle_t)handle,
+                                     hipsolver::hip2cuda_evect(jobz),
+                                     hipsolver::hip2cuda_erange(range),
+                                     hipsolver::hip2cuda_fill(uplo),
+                                     n,
+                                     (cuComplex*)A,
+                                     lda,
+                                     vl,
+                                     vu,
+                                     il,
+                                     iu,
+                                     nev,
+                                     W,
+                                     lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevdx_bufferSize(hipsolverHandle_t       handle,
+                                              hipsolverEigMode_t      jobz,
+                                              hipsolverEigRange_t     range,
+                                              hipsolverFillMode_t     uplo,
+                                              int                     n,
+                                              const hipDoubleComplex* A,
+                                              int                     lda,
+                                              double                  vl,
+                                              double                  vu,
+                                              int                     il,
+                                              int                     iu,
+                                              int*                    nev,
+                                              const double*           W,
+                                              int*                    lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnZheevdx_bufferSize((cusolverDnHandle_t)handle,
+                                     hipsolver::hip2cuda_evect(jobz),
+                                     hipsolver::hip2cuda_erange(range),
+                                     hipsolver::hip2cuda_fill(uplo),
+                                     n,
+                                     (cuDoubleComplex*)A,
+                                     lda,
+                                     vl,
+                                     vu,
+                                     il,
+                                     iu,
+                                     nev,
+                                     W,
+                                     lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsyevdx(hipsolverHandle_t   handle,
+                                   hipsolverEigMode_t  jobz,
+                                   hipsolverEigRange_t range,
+                                   hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   float*              A,
+                                   int                 lda,
+                                   float               vl,
+                                   float               vu,
+                                   int                 il,
+                                   int                 iu,
+                                   int*                nev,
+                                   float*              W,
+                                   float*              work,
+                                   int                 lwork,
+                                   int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnSsyevdx((cusolverDnHandle_t)handle,
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        hipsolver::hip2cuda_erange(range),
+                                                        hipsolver::hip2cuda_fill(uplo),
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        vl,
+                                                        vu,
+                                                        il,
+                                                        iu,
+                                                        nev,
+                                                        W,
+                                                        work,
+                                                        lwork,
+                                                        devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevdx(hipsolverHandle_t   handle,
+                                   hipsolverEigMode_t  jobz,
+                                   hipsolverEigRange_t range,
+                                   hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   double*             A,
+                                   int                 lda,
+                                   double              vl,
+                                   double              vu,
+                                   int                 il,
+                                   int                 iu,
+                                   int*                nev,
+                                   double*             W,
+                                   double*             work,
+                                   int                 lwork,
+                                   int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnDsyevdx((cusolverDnHandle_t)handle,
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        hipsolver::hip2cuda_erange(range),
+                                                        hipsolver::hip2cuda_fill(uplo),
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        vl,
+                                                        vu,
+                                                        il,
+                                                        iu,
+                                                        nev,
+                                                        W,
+                                                        work,
+                                                        lwork,
+                                                        devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevdx(hipsolverHandle_t   handle,
+                                   hipsolverEigMode_t  jobz,
+                                   hipsolverEigRange_t range,
+                                   hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   hipFloatComplex*    A,
+                                   int                 lda,
+                                   float               vl,
+                                   float               vu,
+                                   int                 il,
+                                   int                 iu,
+                                   int*                nev,
+                                   float*              W,
+                                   hipFloatComplex*    work,
+                                   int                 lwork,
+                                   int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnCheevdx((cusolverDnHandle_t)handle,
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        hipsolver::hip2cuda_erange(range),
+                                                        hipsolver::hip2cuda_fill(uplo),
+                                                        n,
+                                                        (cuComplex*)A,
+                                                        lda,
+                                                        vl,
+                                                        vu,
+                                                        il,
+                                                        iu,
+                                                        nev,
+                                                        W,
+                                                        (cuComplex*)work,
+                                                        lwork,
+                                                        devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevdx(hipsolverHandle_t   handle,
+                                   hipsolverEigMode_t  jobz,
+                                   hipsolverEigRange_t range,
+                                   hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   hipDoubleComplex*   A,
+                                   int                 lda,
+                                   double              vl,
+                                   double              vu,
+                                   int                 il,
+                                   int                 iu,
+                                   int*                nev,
+                                   double*             W,
+                                   hipDoubleComplex*   work,
+                                   int                 lwork,
+                                   int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnZheevdx((cusolverDnHandle_t)handle,
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        hipsolver::hip2cuda_erange(range),
+                                                        hipsolver::hip2cuda_fill(uplo),
+                                                        n,
+                                                        (cuDoubleComplex*)A,
+                                                        lda,
+                                                        vl,
+                                                        vu,
+                                                        il,
+                                                        iu,
+                                                        nev,
+                                                        W,
+                                                        (cuDoubleComplex*)work,
+                                                        lwork,
+                                                        devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYEVJ/HEEVJ ********************/
+hipsolverStatus_t hipsolverSsyevj_bufferSize(hipsolverDnHandle_t  handle,
+                                             hipsolverEigMode_t   jobz,
+                                             hipsolverFillMode_t  uplo,
+                                             int                  n,
+                                             float*               A,
+                                             int                  lda,
+                                             float*               W,
+                                             int*                 lwork,
+                                             hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnSsyevj_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  W,
+                                                                  lwork,
+                                                                  (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevj_bufferSize(hipsolverDnHandle_t  handle,
+                                             hipsolverEigMode_t   jobz,
+                                             hipsolverFillMode_t  uplo,
+                                             int                  n,
+                                             double*              A,
+                                             int                  lda,
+                                             double*              W,
+                                             int*                 lwork,
+                                             hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnDsyevj_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  W,
+                                                                  lwork,
+                                                                  (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevj_bufferSize(hipsolverDnHandle_t  handle,
+                                             hipsolverEigMode_t   jobz,
+                                             hipsolverFillMode_t  uplo,
+                                             int                  n,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             float*               W,
+                                             int*                 lwork,
+                                             hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnCheevj_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuComplex*)A,
+                                                                  lda,
+                                                                  W,
+                                                                  lwork,
+                                                                  (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevj_bufferSize(hipsolverDnHandle_t  handle,
+                                             hipsolverEigMode_t   jobz,
+                                             hipsolverFillMode_t  uplo,
+                                             int                  n,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             double*              W,
+                                             int*                 lwork,
+                                             hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnZheevj_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  W,
+                                                                  lwork,
+                                                                  (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsyevj(hipsolverDnHandle_t  handle,
+                                  hipsolverEigMode_t   jobz,
+                                  hipsolverFillMode_t  uplo,
+                                  int                  n,
+                                  float*               A,
+                                  int                  lda,
+                                  float*               W,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo,
+                                  hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnSsyevj((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       W,
+                                                       work,
+                                                       lwork,
+                                                       devInfo,
+                                                       (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevj(hipsolverDnHandle_t  handle,
+                                  hipsolverEigMode_t   jobz,
+                                  hipsolverFillMode_t  uplo,
+                                  int                  n,
+                                  double*              A,
+                                  int                  lda,
+                                  double*              W,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo,
+                                  hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnDsyevj((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       W,
+                                                       work,
+                                                       lwork,
+                                                       devInfo,
+                                                       (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevj(hipsolverDnHandle_t  handle,
+                                  hipsolverEigMode_t   jobz,
+                                  hipsolverFillMode_t  uplo,
+                                  int                  n,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  float*               W,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo,
+                                  hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnCheevj((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       W,
+                                                       (cuComplex*)work,
+                                                       lwork,
+                                                       devInfo,
+                                                       (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevj(hipsolverDnHandle_t  handle,
+                                  hipsolverEigMode_t   jobz,
+                                  hipsolverFillMode_t  uplo,
+                                  int                  n,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  double*              W,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo,
+                                  hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnZheevj((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       W,
+                                                       (cuDoubleComplex*)work,
+                                                       lwork,
+                                                       devInfo,
+                                                       (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYEVJ_BATCHED/HEEVJ_BATCHED ********************/
+hipsolverStatus_t hipsolverSsyevjBatched_bufferSize(hipsolverDnHandle_t  handle,
+                                                    hipsolverEigMode_t   jobz,
+                                                    hipsolverFillMode_t  uplo,
+                                                    int                  n,
+                                                    float*               A,
+                                                    int                  lda,
+                                                    float*               W,
+                                                    int*                 lwork,
+                                                    hipsolverSyevjInfo_t info,
+                                                    int                  batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnSsyevjBatched_bufferSize((cusolverDnHandle_t)handle,
+                                           hipsolver::hip2cuda_evect(jobz),
+                                           hipsolver::hip2cuda_fill(uplo),
+                                           n,
+                                           A,
+                                           lda,
+                                           W,
+                                           lwork,
+                                           (syevjInfo_t)info,
+                                           batch_count));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevjBatched_bufferSize(hipsolverDnHandle_t  handle,
+                                                    hipsolverEigMode_t   jobz,
+                                                    hipsolverFillMode_t  uplo,
+                                                    int                  n,
+                                                    double*              A,
+                                                    int                  lda,
+                                                    double*              W,
+                                                    int*                 lwork,
+                                                    hipsolverSyevjInfo_t info,
+                                                    int                  batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnDsyevjBatched_bufferSize((cusolverDnHandle_t)handle,
+                                           hipsolver::hip2cuda_evect(jobz),
+                                           hipsolver::hip2cuda_fill(uplo),
+                                           n,
+                                           A,
+                                           lda,
+                                           W,
+                                           lwork,
+                                           (syevjInfo_t)info,
+                                           batch_count));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevjBatched_bufferSize(hipsolverDnHandle_t  handle,
+                                                    hipsolverEigMode_t   jobz,
+                                                    hipsolverFillMode_t  uplo,
+                                                    int                  n,
+                                                    hipFloatComplex*     A,
+                                                    int                  lda,
+                                                    float*               W,
+                                                    int*                 lwork,
+                                                    hipsolverSyevjInfo_t info,
+                                                    int                  batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnCheevjBatched_bufferSize((cusolverDnHandle_t)handle,
+                                           hipsolver::hip2cuda_evect(jobz),
+                                           hipsolver::hip2cuda_fill(uplo),
+                                           n,
+                                           (cuComplex*)A,
+                                           lda,
+                                           W,
+                                           lwork,
+                                           (syevjInfo_t)info,
+                                           batch_count));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevjBatched_bufferSize(hipsolverDnHandle_t  handle,
+                                                    hipsolverEigMode_t   jobz,
+                                                    hipsolverFillMode_t  uplo,
+                                                    int                  n,
+                                                    hipDoubleComplex*    A,
+                                                    int                  lda,
+                                                    double*              W,
+                                                    int*                 lwork,
+                                                    hipsolverSyevjInfo_t info,
+                                                    int                  batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnZheevjBatched_bufferSize((cusolverDnHandle_t)handle,
+                                           hipsolver::hip2cuda_evect(jobz),
+                                           hipsolver::hip2cuda_fill(uplo),
+                                           n,
+                                           (cuDoubleComplex*)A,
+                                           lda,
+                                           W,
+                                           lwork,
+                                           (syevjInfo_t)info,
+                                           batch_count));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsyevjBatched(hipsolverDnHandle_t  handle,
+                                         hipsolverEigMode_t   jobz,
+                                         hipsolverFillMode_t  uplo,
+                                         int                  n,
+                                         float*               A,
+                                         int                  lda,
+                                         float*               W,
+                                         float*               work,
+                                         int                  lwork,
+                                         int*                 devInfo,
+                                         hipsolverSyevjInfo_t info,
+                                         int                  batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnSsyevjBatched((cusolverDnHandle_t)handle,
+                                                              hipsolver::hip2cuda_evect(jobz),
+                                                              hipsolver::hip2cuda_fill(uplo),
+                                                              n,
+                                                              A,
+                                                              lda,
+                                                              W,
+                                                              work,
+                                                              lwork,
+                                                              devInfo,
+                                                              (syevjInfo_t)info,
+                                                              batch_count));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevjBatched(hipsolverDnHandle_t  handle,
+                                         hipsolverEigMode_t   jobz,
+                                         hipsolverFillMode_t  uplo,
+                                         int                  n,
+                                         double*              A,
+                                         int                  lda,
+                                         double*              W,
+                                         double*              work,
+                                         int                  lwork,
+                                         int*                 devInfo,
+                                         hipsolverSyevjInfo_t info,
+                                         int                  batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnDsyevjBatched((cusolverDnHandle_t)handle,
+                                                              hipsolver::hip2cuda_evect(jobz),
+                                                              hipsolver::hip2cuda_fill(uplo),
+                                                              n,
+                                                              A,
+                                                              lda,
+                                                              W,
+                                                              work,
+                                                              lwork,
+                                                              devInfo,
+                                                              (syevjInfo_t)info,
+                                                              batch_count));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevjBatched(hipsolverDnHandle_t  handle,
+                                         hipsolverEigMode_t   jobz,
+                                         hipsolverFillMode_t  uplo,
+                                         int                  n,
+                                         hipFloatComplex*     A,
+                                         int                  lda,
+                                         float*               W,
+                                         hipFloatComplex*     work,
+                                         int                  lwork,
+                                         int*                 devInfo,
+                                         hipsolverSyevjInfo_t info,
+                                         int                  batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnCheevjBatched((cusolverDnHandle_t)handle,
+                                                              hipsolver::hip2cuda_evect(jobz),
+                                                              hipsolver::hip2cuda_fill(uplo),
+                                                              n,
+                                                              (cuComplex*)A,
+                                                              lda,
+                                                              W,
+                                                              (cuComplex*)work,
+                                                              lwork,
+                                                              devInfo,
+                                                              (syevjInfo_t)info,
+                                                              batch_count));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevjBatched(hipsolverDnHandle_t  handle,
+                                         hipsolverEigMode_t   jobz,
+                                         hipsolverFillMode_t  uplo,
+                                         int                  n,
+                                         hipDoubleComplex*    A,
+                                         int                  lda,
+                                         double*              W,
+                                         hipDoubleComplex*    work,
+                                         int                  lwork,
+                                         int*                 devInfo,
+                                         hipsolverSyevjInfo_t info,
+                                         int                  batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnZheevjBatched((cusolverDnHandle_t)handle,
+                                                              hipsolver::hip2cuda_evect(jobz),
+                                                              hipsolver::hip2cuda_fill(uplo),
+                                                              n,
+                                                              (cuDoubleComplex*)A,
+                                                              lda,
+                                                              W,
+                                                              (cuDoubleComplex*)work,
+                                                              lwork,
+                                                              devInfo,
+                                                              (syevjInfo_t)info,
+                                                              batch_count));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYGVD/HEGVD ********************/
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvd_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverEigType_t  itype,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              float*              A,
+                                                              int                 lda,
+                                                              float*              B,
+                                                              int                 ldb,
+                                                              float*              W,
+                                                              int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnSsygvd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_eform(itype),
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  B,
+                                                                  ldb,
+                                                                  W,
+                                                                  lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvd_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverEigType_t  itype,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              double*             A,
+                                                              int                 lda,
+                                                              double*             B,
+                                                              int                 ldb,
+                                                              double*             W,
+                                                              int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnDsygvd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_eform(itype),
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  B,
+                                                                  ldb,
+                                                                  W,
+                                                                  lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvd_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverEigType_t  itype,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              hipFloatComplex*    A,
+                                                              int                 lda,
+                                                              hipFloatComplex*    B,
+                                                              int                 ldb,
+                                                              float*              W,
+                                                              int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnChegvd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_eform(itype),
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuComplex*)A,
+                                                                  lda,
+                                                                  (cuComplex*)B,
+                                                                  ldb,
+                                                                  W,
+                                                                  lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverEigType_t  itype,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              hipDoubleComplex*   A,
+                                                              int                 lda,
+                                                              hipDoubleComplex*   B,
+                                                              int                 ldb,
+                                                              double*             W,
+                                                              int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnZhegvd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_eform(itype),
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  (cuDoubleComplex*)B,
+                                                                  ldb,
+                                                                  W,
+                                                                  lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvd(hipsolverHandle_t   handle,
+                                                   hipsolverEigType_t  itype,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   float*              W,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnSsygvd((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_eform(itype),
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       B,
+                                                       ldb,
+                                                       W,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvd(hipsolverHandle_t   handle,
+                                                   hipsolverEigType_t  itype,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   double*             W,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnDsygvd((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_eform(itype),
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       B,
+                                                       ldb,
+                                                       W,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvd(hipsolverHandle_t   handle,
+                                                   hipsolverEigType_t  itype,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipFloatComplex*    A,
+                                                   int                 lda,
+                                                   hipFloatComplex*    B,
+                                                   int                 ldb,
+                                                   float*              W,
+                                                   hipFloatComplex*    work,
+                                                   int                 lwork,
+                                                   int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnChegvd((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_eform(itype),
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       (cuComplex*)B,
+                                                       ldb,
+                                                       W,
+                                                       (cuComplex*)work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd(hipsolverHandle_t   handle,
+                                                   hipsolverEigType_t  itype,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipDoubleComplex*   A,
+                                                   int                 lda,
+                                                   hipDoubleComplex*   B,
+                                                   int                 ldb,
+                                                   double*             W,
+                                                   hipDoubleComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnZhegvd((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_eform(itype),
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       (cuDoubleComplex*)B,
+                                                       ldb,
+                                                       W,
+                                                       (cuDoubleComplex*)work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYGVD_STRIDED_BATCHED/HEGVD_STRIDED_BATCHED ********************/
+// cuSOLVER has no strided-batched sygvd/hegvd; the problems are solved one after the other
+hipsolverStatus_t hipsolverSsygvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverEigType_t  itype,
+                                                           hipsolverEigMode_t  jobz,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           float*              A,
+                                                           int                 lda,
+                                                           long long int       strideA,
+                                                           float*              B,
+                                                           int                 ldb,
+                                                           long long int       strideB,
+                                                           float*              W,
+                                                           long long int       strideW,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    return hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsygvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverEigType_t  itype,
+                                                           hipsolverEigMode_t  jobz,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           double*             A,
+                                                           int                 lda,
+                                                           long long int       strideA,
+                                                           double*             B,
+                                                           int                 ldb,
+                                                           long long int       strideB,
+                                                           double*             W,
+                                                           long long int       strideW,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    return hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChegvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverEigType_t  itype,
+                                                           hipsolverEigMode_t  jobz,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           hipFloatComplex*    A,
+                                                           int                 lda,
+                                                           long long int       strideA,
+                                                           hipFloatComplex*    B,
+                                                           int                 ldb,
+                                                           long long int       strideB,
+                                                           float*              W,
+                                                           long long int       strideW,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    return hipsolverChegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhegvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverEigType_t  itype,
+                                                           hipsolverEigMode_t  jobz,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           hipDoubleComplex*   A,
+                                                           int                 lda,
+                                                           long long int       strideA,
+                                                           hipDoubleComplex*   B,
+                                                           int                 ldb,
+                                                           long long int       strideB,
+                                                           double*             W,
+                                                           long long int       strideW,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    return hipsolverZhegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsygvdStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverEigType_t  itype,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                float*              A,
+                                                int                 lda,
+                                                long long int       strideA,
+                                                float*              B,
+                                                int                 ldb,
+                                                long long int       strideB,
+                                                float*              W,
+                                                long long int       strideW,
+                                                float*              work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverSsygvd(handle,
+                                              itype,
+                                              jobz,
+                                              uplo,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              B + b * strideB,
+                                              ldb,
+                                              W + b * strideW,
+                                              work,
+                                              lwork,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsygvdStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverEigType_t  itype,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                double*             A,
+                                                int                 lda,
+                                                long long int       strideA,
+                                                double*             B,
+                                                int                 ldb,
+                                                long long int       strideB,
+                                                double*             W,
+                                                long long int       strideW,
+                                                double*             work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverDsygvd(handle,
+                                              itype,
+                                              jobz,
+                                              uplo,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              B + b * strideB,
+                                              ldb,
+                                              W + b * strideW,
+                                              work,
+                                              lwork,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChegvdStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverEigType_t  itype,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                hipFloatComplex*    A,
+                                                int                 lda,
+                                                long long int       strideA,
+                                                hipFloatComplex*    B,
+                                                int                 ldb,
+                                                long long int       strideB,
+                                                float*              W,
+                                                long long int       strideW,
+                                                hipFloatComplex*    work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverChegvd(handle,
+                                              itype,
+                                              jobz,
+                                              uplo,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              B + b * strideB,
+                                              ldb,
+                                              W + b * strideW,
+                                              work,
+                                              lwork,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhegvdStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverEigType_t  itype,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                hipDoubleComplex*   A,
+                                                int                 lda,
+                                                long long int       strideA,
+                                                hipDoubleComplex*   B,
+                                                int                 ldb,
+                                                long long int       strideB,
+                                                double*             W,
+                                                long long int       strideW,
+                                                hipDoubleComplex*   work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPSOLVER_ERROR(hipsolverZhegvd(handle,
+                                              itype,
+                                              jobz,
+                                              uplo,
+                                              n,
+                                              A + b * strideA,
+                                              lda,
+                                              B + b * strideB,
+                                              ldb,
+                                              W + b * strideW,
+                                              work,
+                                              lwork,
+                                              devInfo + b));
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYGVDX/HEGVDX ********************/
+hipsolverStatus_t hipsolverSsygvdx_bufferSize(hipsolverHandle_t   handle,
+                                              hipsolverEigType_t  itype,
+                                              hipsolverEigMode_t  jobz,
+                                              hipsolverEigRange_t range,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              const float*        A,
+                                              int                 lda,
+                                              const float*        B,
+                                              int                 ldb,
+                                              float               vl,
+                                              float               vu,
+                                              int                 il,
+                                              int                 iu,
+                                              int*                nev,
+                                              const float*        W,
+                                              int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnSsygvdx_bufferSize((cusolverDnHandle_t)handle,
+                                     hipsolver::hip2cuda_eform(itype),
+                                     hipsolver::hip2cuda_evect(jobz),
+                                     hipsolver::hip2cuda_erange(range),
+                                     hipsolver::hip2cuda_fill(uplo),
+                                     n,
+                                     A,
+                                     lda,
+                                     B,
+                                     ldb,
+                                     vl,
+                                     vu,
+                                     il,
+                                     iu,
+                                     nev,
+                                     W,
+                                     lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsygvdx_bufferSize(hipsolverHandle_t   handle,
+                                              hipsolverEigType_t  itype,
+                                              hipsolverEigMode_t  jobz,
+                                              hipsolverEigRange_t range,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              const double*       A,
+                                              int                 lda,
+                                              const double*       B,
+                                              int                 ldb,
+                                              double              vl,
+                                              double              vu,
+                                              int                 il,
+                                              int                 iu,
+                                              int*                nev,
+                                              const double*       W,
+                                              int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnDsygvdx_bufferSize((cusolverDnHandle_t)handle,
+                                     hipsolver::hip2cuda_eform(itype),
+                                     hipsolver::hip2cuda_evect(jobz),
+                                     hipsolver::hip2cuda_erange(range),
+                                     hipsolver::hip2cuda_fill(uplo),
+                                     n,
+                                     A,
+                                     lda,
+                                     B,
+                                     ldb,
+                                     vl,
+                                     vu,
+                                     il,
+                                     iu,
+                                     nev,
+                                     W,
+                                     lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChegvdx_bufferSize(hipsolverHandle_t      handle,
+                                              hipsolverEigType_t     itype,
+                                              hipsolverEigMode_t     jobz,
+                                              hipsolverEigRange_t    range,
+                                              hipsolverFillMode_t    uplo,
+                                              int                    n,
+                                              const hipFloatComplex* A,
+                                              int                    lda,
+                                              const hipFloatComplex* B,
+                                              int                    ldb,
+                                              float                  vl,
+                                              float                  vu,
+                                              int                    il,
+                                              int                    iu,
+                                              int*                   nev,
+                                              const float*           W,
+                                              int*                   lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnChegvdx_bufferSize((cusolverDnHandle_t)handle,
+                                     hipsolver::hip2cuda_eform(itype),
+                                     hipsolver::hip2cuda_evect(jobz),
+                                     hipsolver::hip2cuda_erange(range),
+                                     hipsolver::hip2cuda_fill(uplo),
+                                     n,
+                                     (cuComplex*)A,
+                                     lda,
+                                     (cuComplex*)B,
+                                     ldb,
+                                     vl,
+                                     vu,
+                                     il,
+                                     iu,
+                                     nev,
+                                     W,
+                                     lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhegvdx_bufferSize(hipsolverHandle_t       handle,
+                                              hipsolverEigType_t      itype,
+                                              hipsolverEigMode_t      jobz,
+                                              hipsolverEigRange_t     range,
+                                              hipsolverFillMode_t     uplo,
+                                              int                     n,
+                                              const hipDoubleComplex* A,
+                                              int                     lda,
+                                              const hipDoubleComplex* B,
+                                              int                     ldb,
+                                              double                  vl,
+                                              double                  vu,
+                                              int                     il,
+                                              int                     iu,
+                                              int*                    nev,
+                                              const double*           W,
+                                              int*                    lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnZhegvdx_bufferSize((cusolverDnHandle_t)handle,
+                                     hipsolver::hip2cuda_eform(itype),
+                                     hipsolver::hip2cuda_evect(jobz),
+                                     hipsolver::hip2cuda_erange(range),
+                                     hipsolver::hip2cuda_fill(uplo),
+                                     n,
+                                     (cuDoubleComplex*)A,
+                                     lda,
+                                     (cuDoubleComplex*)B,
+                                     ldb,
+                                     vl,
+                                     vu,
+                                     il,
+                                     iu,
+                                     nev,
+                                     W,
+                                     lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsygvdx(hipsolverHandle_t   handle,
+                                   hipsolverEigType_t  itype,
+                                   hipsolverEigMode_t  jobz,
+                                   hipsolverEigRange_t range,
+                                   hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   float*              A,
+                                   int                 lda,
+                                   float*              B,
+                                   int                 ldb,
+                                   float               vl,
+                                   float               vu,
+                                   int                 il,
+                                   int                 iu,
+                                   int*                nev,
+                                   float*              W,
+                                   float*              work,
+                                   int                 lwork,
+                                   int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnSsygvdx((cusolverDnHandle_t)handle,
+                                                        hipsolver::hip2cuda_eform(itype),
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        hipsolver::hip2cuda_erange(range),
+                                                        hipsolver::hip2cuda_fill(uplo),
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        B,
+                                                        ldb,
+                                                        vl,
+                                                        vu,
+                                                        il,
+                                                        iu,
+                                                        nev,
+                                                        W,
+                                                        work,
+                                                        lwork,
+                                                        devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsygvdx(hipsolverHandle_t   handle,
+                                   hipsolverEigType_t  itype,
+                                   hipsolverEigMode_t  jobz,
+                                   hipsolverEigRange_t range,
+                                   hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   double*             A,
+                                   int                 lda,
+                                   double*             B,
+                                   int                 ldb,
+                                   double              vl,
+                                   double              vu,
+                                   int                 il,
+                                   int                 iu,
+                                   int*                nev,
+                                   double*             W,
+                                   double*             work,
+                                   int                 lwork,
+                                   int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnDsygvdx((cusolverDnHandle_t)handle,
+                                                        hipsolver::hip2cuda_eform(itype),
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        hipsolver::hip2cuda_erange(range),
+                                                        hipsolver::hip2cuda_fill(uplo),
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        B,
+                                                        ldb,
+                                                        vl,
+                                                        vu,
+                                                        il,
+                                                        iu,
+                                                        nev,
+                                                        W,
+                                                        work,
+                                                        lwork,
+                                                        devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChegvdx(hipsolverHandle_t   handle,
+                                   hipsolverEigType_t  itype,
+                                   hipsolverEigMode_t  jobz,
+                                   hipsolverEigRange_t range,
+                                   hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   hipFloatComplex*    A,
+                                   int                 lda,
+                                   hipFloatComplex*    B,
+                                   int                 ldb,
+                                   float               vl,
+                                   float               vu,
+                                   int                 il,
+                                   int                 iu,
+                                   int*                nev,
+                                   float*              W,
+                                   hipFloatComplex*    work,
+                                   int                 lwork,
+                                   int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnChegvdx((cusolverDnHandle_t)handle,
+                                                        hipsolver::hip2cuda_eform(itype),
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        hipsolver::hip2cuda_erange(range),
+                                                        hipsolver::hip2cuda_fill(uplo),
+                                                        n,
+                                                        (cuComplex*)A,
+                                                        lda,
+                                                        (cuComplex*)B,
+                                                        ldb,
+                                                        vl,
+                                                        vu,
+                                                        il,
+                                                        iu,
+                                                        nev,
+                                                        W,
+                                                        (cuComplex*)work,
+                                                        lwork,
+                                                        devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhegvdx(hipsolverHandle_t   handle,
+                                   hipsolverEigType_t  itype,
+                                   hipsolverEigMode_t  jobz,
+                                   hipsolverEigRange_t range,
+                                   hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   hipDoubleComplex*   A,
+                                   int                 lda,
+                                   hipDoubleComplex*   B,
+                                   int                 ldb,
+                                   double              vl,
+                                   double              vu,
+                                   int                 il,
+                                   int                 iu,
+                                   int*                nev,
+                                   double*             W,
+                                   hipDoubleComplex*   work,
+                                   int                 lwork,
+                                   int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnZhegvdx((cusolverDnHandle_t)handle,
+                                                        hipsolver::hip2cuda_eform(itype),
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        hipsolver::hip2cuda_erange(range),
+                                                        hipsolver::hip2cuda_fill(uplo),
+                                                        n,
+                                                        (cuDoubleComplex*)A,
+                                                        lda,
+                                                        (cuDoubleComplex*)B,
+                                                        ldb,
+                                                        vl,
+                                                        vu,
+                                                        il,
+                                                        iu,
+                                                        nev,
+                                                        W,
+                                                        (cuDoubleComplex*)work,
+                                                        lwork,
+                                                        devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYGVJ/HEGVJ ********************/
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvj_bufferSize(hipsolverHandle_t    handle,
+                                                              hipsolverEigType_t   itype,
+                                                              hipsolverEigMode_t   jobz,
+                                                              hipsolverFillMode_t  uplo,
+                                                              int                  n,
+                                                              float*               A,
+                                                              int                  lda,
+                                                              float*               B,
+                                                              int                  ldb,
+                                                              float*               W,
+                                                              int*                 lwork,
+                                                              hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnSsygvj_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_eform(itype),
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  B,
+                                                                  ldb,
+                                                                  W,
+                                                                  lwork,
+                                                                  (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvj_bufferSize(hipsolverHandle_t    handle,
+                                                              hipsolverEigType_t   itype,
+                                                              hipsolverEigMode_t   jobz,
+                                                              hipsolverFillMode_t  uplo,
+                                                              int                  n,
+                                                              double*              A,
+                                                              int                  lda,
+                                                              double*              B,
+                                                              int                  ldb,
+                                                              double*              W,
+                                                              int*                 lwork,
+                                                              hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnDsygvj_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_eform(itype),
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  B,
+                                                                  ldb,
+                                                                  W,
+                                                                  lwork,
+                                                                  (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvj_bufferSize(hipsolverHandle_t    handle,
+                                                              hipsolverEigType_t   itype,
+                                                              hipsolverEigMode_t   jobz,
+                                                              hipsolverFillMode_t  uplo,
+                                                              int                  n,
+                                                              hipFloatComplex*     A,
+                                                              int                  lda,
+                                                              hipFloatComplex*     B,
+                                                              int                  ldb,
+                                                              float*               W,
+                                                              int*                 lwork,
+                                                              hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnChegvj_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_eform(itype),
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuComplex*)A,
+                                                                  lda,
+                                                                  (cuComplex*)B,
+                                                                  ldb,
+                                                                  W,
+                                                                  lwork,
+                                                                  (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvj_bufferSize(hipsolverHandle_t    handle,
+                                                              hipsolverEigType_t   itype,
+                                                              hipsolverEigMode_t   jobz,
+                                                              hipsolverFillMode_t  uplo,
+                                                              int                  n,
+                                                              hipDoubleComplex*    A,
+                                                              int                  lda,
+                                                              hipDoubleComplex*    B,
+                                                              int                  ldb,
+                                                              double*              W,
+                                                              int*                 lwork,
+                                                              hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnZhegvj_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_eform(itype),
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  (cuDoubleComplex*)B,
+                                                                  ldb,
+                                                                  W,
+                                                                  lwork,
+                                                                  (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvj(hipsolverHandle_t    handle,
+                                                   hipsolverEigType_t   itype,
+                                                   hipsolverEigMode_t   jobz,
+                                                   hipsolverFillMode_t  uplo,
+                                                   int                  n,
+                                                   float*               A,
+                                                   int                  lda,
+                                                   float*               B,
+                                                   int                  ldb,
+                                                   float*               W,
+                                                   float*               work,
+                                                   int                  lwork,
+                                                   int*                 devInfo,
+                                                   hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnSsygvj((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_eform(itype),
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       B,
+                                                       ldb,
+                                                       W,
+                                                       work,
+                                                       lwork,
+                                                       devInfo,
+                                                       (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvj(hipsolverHandle_t    handle,
+                                                   hipsolverEigType_t   itype,
+                                                   hipsolverEigMode_t   jobz,
+                                                   hipsolverFillMode_t  uplo,
+                                                   int                  n,
+                                                   double*              A,
+                                                   int                  lda,
+                                                   double*              B,
+                                                   int                  ldb,
+                                                   double*              W,
+                                                   double*              work,
+                                                   int                  lwork,
+                                                   int*                 devInfo,
+                                                   hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnDsygvj((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_eform(itype),
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       B,
+                                                       ldb,
+                                                       W,
+                                                       work,
+                                                       lwork,
+                                                       devInfo,
+                                                       (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvj(hipsolverHandle_t    handle,
+                                                   hipsolverEigType_t   itype,
+                                                   hipsolverEigMode_t   jobz,
+                                                   hipsolverFillMode_t  uplo,
+                                                   int                  n,
+                                                   hipFloatComplex*     A,
+                                                   int                  lda,
+                                                   hipFloatComplex*     B,
+                                                   int                  ldb,
+                                                   float*               W,
+                                                   hipFloatComplex*     work,
+                                                   int                  lwork,
+                                                   int*                 devInfo,
+                                                   hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnChegvj((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_eform(itype),
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       (cuComplex*)B,
+                                                       ldb,
+                                                       W,
+                                                       (cuComplex*)work,
+                                                       lwork,
+                                                       devInfo,
+                                                       (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvj(hipsolverHandle_t    handle,
+                                                   hipsolverEigType_t   itype,
+                                                   hipsolverEigMode_t   jobz,
+                                                   hipsolverFillMode_t  uplo,
+                                                   int                  n,
+                                                   hipDoubleComplex*    A,
+                                                   int                  lda,
+                                                   hipDoubleComplex*    B,
+                                                   int                  ldb,
+                                                   double*              W,
+                                                   hipDoubleComplex*    work,
+                                                   int                  lwork,
+                                                   int*                 devInfo,
+                                                   hipsolverSyevjInfo_t info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnZhegvj((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_eform(itype),
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       (cuDoubleComplex*)B,
+                                                       ldb,
+                                                       W,
+                                                       (cuDoubleComplex*)work,
+                                                       lwork,
+                                                       devInfo,
+                                                       (syevjInfo_t)info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYTRD/HETRD ********************/
+hipsolverStatus_t hipsolverSsytrd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              D,
+                                             float*              E,
+                                             float*              tau,
+                                             int*                lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnChegvdx((cusolverDnHandle_t)handle,
-                                                        hipsolver::hip2cuda_eform(itype),
-                                                        hipsolver::hip2cuda_evect(jobz),
-                                                        hipsolver::hip2cuda_erange(range),
-                                                        hipsolver::hip2cuda_fill(uplo),
-                                                        n,
-                                                        (cuComplex*)A,
-                                                        lda,
-                                                        (cuComplex*)B,
-                                                        ldb,
-                                                        vl,
-                                                        vu,
-                                                        il,
-                                                        iu,
-                                                        nev,
-                                                        W,
-                                                        (cuComplex*)work,
-                                                        lwork,
-                                                        devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnSsytrd_bufferSize(
+        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, D, E, tau, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZhegvdx(hipsolverHandle_t   handle,
-                                   hipsolverEigType_t  itype,
-                                   hipsolverEigMode_t  jobz,
-                                   hipsolverEigRange_t range,
-                                   hipsolverFillMode_t uplo,
-                                   int                 n,
-                                   hipDoubleComplex*   A,
-                                   int                 lda,
-                                   hipDoubleComplex*   B,
-                                   int                 ldb,
-                                   double              vl,
-                                   double              vu,
-                                   int                 il,
-                                   int                 iu,
-                                   int*                nev,
-                                   double*             W,
-                                   hipDoubleComplex*   work,
-                                   int                 lwork,
-                                   int*                devInfo)
+hipsolverStatus_t hipsolverDsytrd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             D,
+                                             double*             E,
+                                             double*             tau,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnDsytrd_bufferSize(
+        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, D, E, tau, lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChetrd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             float*              D,
+                                             float*              E,
+                                             hipFloatComplex*    tau,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnChetrd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuComplex*)A,
+                                                                  lda,
+                                                                  D,
+                                                                  E,
+                                                                  (cuComplex*)tau,
+                                                                  lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhetrd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             double*             D,
+                                             double*             E,
+                                             hipDoubleComplex*   tau,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnZhetrd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  (cuDoubleComplex*)A,
+                                                                  lda,
+                                                                  D,
+                                                                  E,
+                                                                  (cuDoubleComplex*)tau,
+                                                                  lwork));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsytrd(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              D,
+                                  float*              E,
+                                  float*              tau,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnSsytrd((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       D,
+                                                       E,
+                                                       tau,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsytrd(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             D,
+                                  double*             E,
+                                  double*             tau,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnDsytrd((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       D,
+                                                       E,
+                                                       tau,
+                                                       work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChetrd(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  float*              D,
+                                  float*              E,
+                                  hipFloatComplex*    tau,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnChetrd((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       D,
+                                                       E,
+                                                       (cuComplex*)tau,
+                                                       (cuComplex*)work,
+                                                       lwork,
+                                                       devInfo));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhetrd(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  double*             D,
+                                  double*             E,
+                                  hipDoubleComplex*   tau,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZhegvdx((cusolverDnHandle_t)handle,
-                                                        hipsolver::hip2cuda_eform(itype),
-                                                        hipsolver::hip2cuda_evect(jobz),
-                                                        hipsolver::hip2cuda_erange(range),
-                                                        hipsolver::hip2cuda_fill(uplo),
-                                                        n,
-                                                        (cuDoubleComplex*)A,
-                                                        lda,
-                                                        (cuDoubleComplex*)B,
-                                                        ldb,
-                                                        vl,
-                                                        vu,
-                                                        il,
-                                                        iu,
-                                                        nev,
-                                                        W,
-                                                        (cuDoubleComplex*)work,
-                                                        lwork,
-                                                        devInfo));
+    return hipsolver::cuda2hip_status(cusolverDnZhetrd((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       D,
+                                                       E,
+                                                       (cuDoubleComplex*)tau,
+                                                       (cuDoubleComplex*)work,
+                                                       lwork,
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** SYGVJ/HEGVJ ********************/
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvj_bufferSize(hipsolverHandle_t    handle,
-                                                              hipsolverEigType_t   itype,
-                                                              hipsolverEigMode_t   jobz,
-                                                              hipsolverFillMode_t  uplo,
-                                                              int                  n,
-                                                              float*               A,
-                                                              int                  lda,
-                                                              float*               B,
-                                                              int                  ldb,
-                                                              float*               W,
-                                                              int*                 lwork,
-                                                              hipsolverSyevjInfo_t info)
+/******************** SYTRF ********************/
+hipsolverStatus_t
+    hipsolverSsytrf_bufferSize(hipsolverHandle_t handle, int n, float* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsygvj_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_eform(itype),
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  A,
-                                                                  lda,
-                                                                  B,
-                                                                  ldb,
-                                                                  W,
-                                                                  lwork,
-                                                                  (syevjInfo_t)info));
+    return hipsolver::cuda2hip_status(
+        cusolverDnSsytrf_bufferSize((cusolverDnHandle_t)handle, n, A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvj_bufferSize(hipsolverHandle_t    handle,
-                                                              hipsolverEigType_t   itype,
-                                                              hipsolverEigMode_t   jobz,
-                                                              hipsolverFillMode_t  uplo,
-                                                              int                  n,
-                                                              double*              A,
-                                                              int                  lda,
-                                                              double*              B,
-                                                              int                  ldb,
-                                                              double*              W,
-                                                              int*                 lwork,
-                                                              hipsolverSyevjInfo_t info)
+hipsolverStatus_t
+    hipsolverDsytrf_bufferSize(hipsolverHandle_t handle, int n, double* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDsygvj_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_eform(itype),
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  A,
-                                                                  lda,
-                                                                  B,
-                                                                  ldb,
-                                                                  W,
-                                                                  lwork,
-                                                                  (syevjInfo_t)info));
+    return hipsolver::cuda2hip_status(
+        cusolverDnDsytrf_bufferSize((cusolverDnHandle_t)handle, n, A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvj_bufferSize(hipsolverHandle_t    handle,
-                                                              hipsolverEigType_t   itype,
-                                                              hipsolverEigMode_t   jobz,
-                                                              hipsolverFillMode_t  uplo,
-                                                              int                  n,
-                                                              hipFloatComplex*     A,
-                                                              int                  lda,
-                                                              hipFloatComplex*     B,
-                                                              int                  ldb,
-                                                              float*               W,
-                                                              int*                 lwork,
-                                                              hipsolverSyevjInfo_t info)
+hipsolverStatus_t hipsolverCsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, hipFloatComplex* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnChegvj_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_eform(itype),
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuComplex*)A,
-                                                                  lda,
-                                                                  (cuComplex*)B,
-                                                                  ldb,
-                                                                  W,
-                                                                  lwork,
-                                                                  (syevjInfo_t)info));
+    return hipsolver::cuda2hip_status(
+        cusolverDnCsytrf_bufferSize((cusolverDnHandle_t)handle, n, (cuComplex*)A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvj_bufferSize(hipsolverHandle_t    handle,
-                                                              hipsolverEigType_t   itype,
-                                                              hipsolverEigMode_t   jobz,
-                                                              hipsolverFillMode_t  uplo,
-                                                              int                  n,
-                                                              hipDoubleComplex*    A,
-                                                              int                  lda,
-                                                              hipDoubleComplex*    B,
-                                                              int                  ldb,
-                                                              double*              W,
-                                                              int*                 lwork,
-                                                              hipsolverSyevjInfo_t info)
+hipsolverStatus_t hipsolverZsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, hipDoubleComplex* A, int lda, int* lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZhegvj_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_eform(itype),
-                                                                  hipsolver::hip2cuda_evect(jobz),
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuDoubleComplex*)A,
-                                                                  lda,
-                                                                  (cuDoubleComplex*)B,
-                                                                  ldb,
-                                                                  W,
-                                                                  lwork,
-                                                                  (syevjInfo_t)info));
+    return hipsolver::cuda2hip_status(cusolverDnZsytrf_bufferSize(
+        (cusolverDnHandle_t)handle, n, (cuDoubleComplex*)A, lda, lwork));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvj(hipsolverHandle_t    handle,
-                                                   hipsolverEigType_t   itype,
-                                                   hipsolverEigMode_t   jobz,
-                                                   hipsolverFillMode_t  uplo,
-                                                   int                  n,
-                                                   float*               A,
-                                                   int                  lda,
-                                                   float*               B,
-                                                   int                  ldb,
-                                                   float*               W,
-                                                   float*               work,
-                                                   int                  lwork,
-                                                   int*                 devInfo,
-                                                   hipsolverSyevjInfo_t info)
+hipsolverStatus_t hipsolverSsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  int*                ipiv,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsygvj((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_eform(itype),
-                                                       hipsolver::hip2cuda_evect(jobz),
+    return hipsolver::cuda2hip_status(cusolverDnSsytrf((cusolverDnHandle_t)handle,
                                                        hipsolver::hip2cuda_fill(uplo),
                                                        n,
                                                        A,
                                                        lda,
-                                                       B,
-                                                       ldb,
-                                                       W,
+                                                       ipiv,
                                                        work,
                                                        lwork,
-                                                       devInfo,
-                                                       (syevjInfo_t)info));
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvj(hipsolverHandle_t    handle,
-                                                   hipsolverEigType_t   itype,
-                                                   hipsolverEigMode_t   jobz,
-                                                   hipsolverFillMode_t  uplo,
-                                                   int                  n,
-                                                   double*              A,
-                                                   int                  lda,
-                                                   double*              B,
-                                                   int                  ldb,
-                                                   double*              W,
-                                                   double*              work,
-                                                   int                  lwork,
-                                                   int*                 devInfo,
-                                                   hipsolverSyevjInfo_t info)
+hipsolverStatus_t hipsolverDsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  int*                ipiv,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnDsygvj((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_eform(itype),
-                                                       hipsolver::hip2cuda_evect(jobz),
+    return hipsolver::cuda2hip_status(cusolverDnDsytrf((cusolverDnHandle_t)handle,
                                                        hipsolver::hip2cuda_fill(uplo),
                                                        n,
                                                        A,
                                                        lda,
-                                                       B,
-                                                       ldb,
-                                                       W,
+                                                       ipiv,
                                                        work,
                                                        lwork,
-                                                       devInfo,
-                                                       (syevjInfo_t)info));
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvj(hipsolverHandle_t    handle,
-                                                   hipsolverEigType_t   itype,
-                                                   hipsolverEigMode_t   jobz,
-                                                   hipsolverFillMode_t  uplo,
-                                                   int                  n,
-                                                   hipFloatComplex*     A,
-                                                   int                  lda,
-                                                   hipFloatComplex*     B,
-                                                   int                  ldb,
-                                                   float*               W,
-                                                   hipFloatComplex*     work,
-                                                   int                  lwork,
-                                                   int*                 devInfo,
-                                                   hipsolverSyevjInfo_t info)
+hipsolverStatus_t hipsolverCsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  int*                ipiv,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    return hipsolver::cuda2hip_status(cusolverDnChegvj((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_eform(itype),
-                                                       hipsolver::hip2cuda_evect(jobz),
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnCsytrf((cusolverDnHandle_t)handle,
                                                        hipsolver::hip2cuda_fill(uplo),
                                                        n,
                                                        (cuComplex*)A,
                                                        lda,
-                                                       (cuComplex*)B,
-                                                       ldb,
-                                                       W,
+                                                       ipiv,
                                                        (cuComplex*)work,
                                                        lwork,
-                                                       devInfo,
-                                                       (syevjInfo_t)info));
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvj(hipsolverHandle_t    handle,
-                                                   hipsolverEigType_t   itype,
-                                                   hipsolverEigMode_t   jobz,
-                                                   hipsolverFillMode_t  uplo,
-                                                   int                  n,
-                                                   hipDoubleComplex*    A,
-                                                   int                  lda,
-                                                   hipDoubleComplex*    B,
-                                                   int                  ldb,
-                                                   double*              W,
-                                                   hipDoubleComplex*    work,
-                                                   int                  lwork,
-                                                   int*                 devInfo,
-                                                   hipsolverSyevjInfo_t info)
+hipsolverStatus_t hipsolverZsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  int*                ipiv,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(!info)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return hipsolver::cuda2hip_status(cusolverDnZhegvj((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_eform(itype),
-                                                       hipsolver::hip2cuda_evect(jobz),
+    return hipsolver::cuda2hip_status(cusolverDnZsytrf((cusolverDnHandle_t)handle,
                                                        hipsolver::hip2cuda_fill(uplo),
                                                        n,
                                                        (cuDoubleComplex*)A,
                                                        lda,
-                                                       (cuDoubleComplex*)B,
-                                                       ldb,
-                                                       W,
+                                                       ipiv,
                                                        (cuDoubleComplex*)work,
                                                        lwork,
-                                                       devInfo,
-                                                       (syevjInfo_t)info));
+                                                       devInfo));
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** SYTRD/HETRD ********************/
-hipsolverStatus_t hipsolverSsytrd_bufferSize(hipsolverHandle_t   handle,
+/******************** SYTRS ********************/
+// cuSOLVER only provides sytrs through the 64-bit API
+hipsolverStatus_t hipsolverSsytrs_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
+                                             int                 nrhs,
                                              float*              A,
                                              int                 lda,
-                                             float*              D,
-                                             float*              E,
-                                             float*              tau,
+                                             int*                ipiv,
+                                             float*              B,
+                                             int                 ldb,
                                              int*                lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsytrd_bufferSize(
-        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, D, E, tau, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsytrd_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverDsytrs_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
+                                             int                 nrhs,
                                              double*             A,
                                              int                 lda,
-                                             double*             D,
-                                             double*             E,
-                                             double*             tau,
+                                             int*                ipiv,
+                                             double*             B,
+                                             int                 ldb,
                                              int*                lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDsytrd_bufferSize(
-        (cusolverDnHandle_t)handle, hipsolver::hip2cuda_fill(uplo), n, A, lda, D, E, tau, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverChetrd_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverCsytrs_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
+                                             int                 nrhs,
                                              hipFloatComplex*    A,
                                              int                 lda,
-                                             float*              D,
-                                             float*              E,
-                                             hipFloatComplex*    tau,
+                                             int*                ipiv,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
                                              int*                lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnChetrd_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuComplex*)A,
-                                                                  lda,
-                                                                  D,
-                                                                  E,
-                                                                  (cuComplex*)tau,
-                                                                  lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZhetrd_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverZsytrs_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
+                                             int                 nrhs,
                                              hipDoubleComplex*   A,
                                              int                 lda,
-                                             double*             D,
-                                             double*             E,
-                                             hipDoubleComplex*   tau,
+                                             int*                ipiv,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
                                              int*                lwork)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZhetrd_bufferSize((cusolverDnHandle_t)handle,
-                                                                  hipsolver::hip2cuda_fill(uplo),
-                                                                  n,
-                                                                  (cuDoubleComplex*)A,
-                                                                  lda,
-                                                                  D,
-                                                                  E,
-                                                                  (cuDoubleComplex*)tau,
-                                                                  lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsytrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  float*              A,
+                                  int                 lda,
+                                  int*                ipiv,
+                                  float*              B,
+                                  int                 ldb,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsytrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  double*             A,
+                                  int                 lda,
+                                  int*                ipiv,
+                                  double*             B,
+                                  int                 ldb,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCsytrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  int*                ipiv,
+                                  hipFloatComplex*    B,
+                                  int                 ldb,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZsytrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  int*                ipiv,
+                                  hipDoubleComplex*   B,
+                                  int                 ldb,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+
+/******************** SYTRS_BATCHED ********************/
+hipsolverStatus_t hipsolverSsytrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    int*                ipiv,
+                                                    float*              B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsytrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    int*                ipiv,
+                                                    double*             B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCsytrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipFloatComplex*    A[],
+                                                    int                 lda,
+                                                    int*                ipiv,
+                                                    hipFloatComplex*    B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZsytrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipDoubleComplex*   A[],
+                                                    int                 lda,
+                                                    int*                ipiv,
+                                                    hipDoubleComplex*   B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSsytrd(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              D,
-                                  float*              E,
-                                  float*              tau,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverSsytrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A[],
+                                         int                 lda,
+                                         int*                ipiv,
+                                         float*              B[],
+                                         int                 ldb,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsytrd((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       D,
-                                                       E,
-                                                       tau,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsytrd(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             D,
-                                  double*             E,
-                                  double*             tau,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverDsytrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A[],
+                                         int                 lda,
+                                         int*                ipiv,
+                                         double*             B[],
+                                         int                 ldb,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDsytrd((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       D,
-                                                       E,
-                                                       tau,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverChetrd(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  float*              D,
-                                  float*              E,
-                                  hipFloatComplex*    tau,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverCsytrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipFloatComplex*    A[],
+                                         int                 lda,
+                                         int*                ipiv,
+                                         hipFloatComplex*    B[],
+                                         int                 ldb,
+                                         hipFloatComplex*    work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnChetrd((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       D,
-                                                       E,
-                                                       (cuComplex*)tau,
-                                                       (cuComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZhetrd(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  double*             D,
-                                  double*             E,
-                                  hipDoubleComplex*   tau,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverZsytrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipDoubleComplex*   A[],
+                                         int                 lda,
+                                         int*                ipiv,
+                                         hipDoubleComplex*   B[],
+                                         int                 ldb,
+                                         hipDoubleComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZhetrd((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       D,
-                                                       E,
-                                                       (cuDoubleComplex*)tau,
-                                                       (cuDoubleComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-/******************** SYTRF ********************/
-hipsolverStatus_t
-    hipsolverSsytrf_bufferSize(hipsolverHandle_t handle, int n, float* A, int lda, int* lwork)
+
+/******************** SYTRS_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSsytrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 nrhs,
+                                                           float*              A,
+                                                           int                 lda,
+                                                           long long int       strideA,
+                                                           int*                ipiv,
+                                                           long long int       strideP,
+                                                           float*              B,
+                                                           int                 ldb,
+                                                           long long int       strideB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnSsytrf_bufferSize((cusolverDnHandle_t)handle, n, A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t
-    hipsolverDsytrf_bufferSize(hipsolverHandle_t handle, int n, double* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverDsytrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 nrhs,
+                                                           double*             A,
+                                                           int                 lda,
+                                                           long long int       strideA,
+                                                           int*                ipiv,
+                                                           long long int       strideP,
+                                                           double*             B,
+                                                           int                 ldb,
+                                                           long long int       strideB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnDsytrf_bufferSize((cusolverDnHandle_t)handle, n, A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCsytrf_bufferSize(
-    hipsolverHandle_t handle, int n, hipFloatComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverCsytrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 nrhs,
+                                                           hipFloatComplex*    A,
+                                                           int                 lda,
+                                                           long long int       strideA,
+                                                           int*                ipiv,
+                                                           long long int       strideP,
+                                                           hipFloatComplex*    B,
+                                                           int                 ldb,
+                                                           long long int       strideB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(
-        cusolverDnCsytrf_bufferSize((cusolverDnHandle_t)handle, n, (cuComplex*)A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZsytrf_bufferSize(
-    hipsolverHandle_t handle, int n, hipDoubleComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverZsytrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 nrhs,
+                                                           hipDoubleComplex*   A,
+                                                           int                 lda,
+                                                           long long int       strideA,
+                                                           int*                ipiv,
+                                                           long long int       strideP,
+                                                           hipDoubleComplex*   B,
+                                                           int                 ldb,
+                                                           long long int       strideB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZsytrf_bufferSize(
-        (cusolverDnHandle_t)handle, n, (cuDoubleComplex*)A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSsytrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  float*              A,
-                                  int                 lda,
-                                  int*                ipiv,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverSsytrsStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 nrhs,
+                                                float*              A,
+                                                int                 lda,
+                                                long long int       strideA,
+                                                int*                ipiv,
+                                                long long int       strideP,
+                                                float*              B,
+                                                int                 ldb,
+                                                long long int       strideB,
+                                                float*              work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnSsytrf((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       ipiv,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsytrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  double*             A,
-                                  int                 lda,
-                                  int*                ipiv,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverDsytrsStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 nrhs,
+                                                double*             A,
+                                                int                 lda,
+                                                long long int       strideA,
+                                                int*                ipiv,
+                                                long long int       strideP,
+                                                double*             B,
+                                                int                 ldb,
+                                                long long int       strideB,
+                                                double*             work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnDsytrf((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       ipiv,
-                                                       work,
-                                                       lwork,
-                                                       devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCsytrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  int*                ipiv,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverCsytrsStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 nrhs,
+                                                hipFloatComplex*    A,
+                                                int                 lda,
+                                                long long int       strideA,
+                                                int*                ipiv,
+                                                long long int       strideP,
+                                                hipFloatComplex*    B,
+                                                int                 ldb,
+                                                long long int       strideB,
+                                                hipFloatComplex*    work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnCsytrf((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       ipiv,
-                                                       (cuComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return hipsolver::exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZsytrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  int*                ipiv,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverZsytrsStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 nrhs,
+                                                hipDoubleComplex*   A,
+                                                int                 lda,
+                                                long long int       strideA,
+                                                int*                ipiv,
+                                                long long int       strideP,
+                                                hipDoubleComplex*   B,
+                                                int                 ldb,
+                                                long long int       strideB,
+                                                hipDoubleComplex*   work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return hipsolver::cuda2hip_status(cusolverDnZsytrf((cusolverDnHandle_t)handle,
-                                                       hipsolver::hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       ipiv,
-                                                       (cuDoubleComplex*)work,
-                                                       lwork,
-                                                       devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
@@ -111,6 +111,32 @@ hipsolverSideMode_t cuda2hip_side(cublasSideMode_t side)
     }
 }
 
+cublasDiagType_t hip2cuda_diag(hipsolverDiagType_t diag)
+{
+    switch(diag)
+    {
+    case HIPSOLVER_DIAG_NON_UNIT:
+        return CUBLAS_DIAG_NON_UNIT;
+    case HIPSOLVER_DIAG_UNIT:
+        return CUBLAS_DIAG_UNIT;
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
+hipsolverDiagType_t cuda2hip_diag(cublasDiagType_t diag)
+{
+    switch(diag)
+    {
+    case CUBLAS_DIAG_NON_UNIT:
+        return HIPSOLVER_DIAG_NON_UNIT;
+    case CUBLAS_DIAG_UNIT:
+        return HIPSOLVER_DIAG_UNIT;
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
 cusolverEigMode_t hip2cuda_evect(hipsolverEigMode_t eig)
 {
     switch(eig)
@@ -292,6 +318,8 @@ cusolverDnFunction_t hip2cuda_function(hipsolverDnFunction_t func)
     {
     case HIPSOLVERDN_GETRF:
         return CUSOLVERDN_GETRF;
+    case HIPSOLVERDN_POTRF:
+        return CUSOLVERDN_POTRF;
     default:
         throw HIPSOLVER_STATUS_INVALID_ENUM;
     }
@@ -303,6 +331,8 @@ hipsolverDnFunction_t cuda2hip_function(cusolverDnFunction_t func)
     {
     case CUSOLVERDN_GETRF:
         return HIPSOLVERDN_GETRF;
+    case CUSOLVERDN_POTRF:
+        return HIPSOLVERDN_POTRF;
     default:
         throw HIPSOLVER_STATUS_INVALID_ENUM;
     }
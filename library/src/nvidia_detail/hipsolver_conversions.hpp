@@ -42,6 +42,10 @@ cublasSideMode_t hip2cuda_side(hipsolverSideMode_t side);
 
 hipsolverSideMode_t cuda2hip_side(cublasSideMode_t side);
 
+cublasDiagType_t hip2cuda_diag(hipsolverDiagType_t diag);
+
+hipsolverDiagType_t cuda2hip_diag(cublasDiagType_t diag);
+
 cusolverEigMode_t hip2cuda_evect(hipsolverEigMode_t eig);
 
 hipsolverEigMode_t cuda2hip_evect(cusolverEigMode_t eig);
@@ -68,6 +68,11 @@ try
     if(!params)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
+    // cuSOLVER has a single geqrf algorithm
+    if(func == HIPSOLVERDN_GEQRF)
+        return hipsolver::hip2cuda_algmode(alg) == CUSOLVER_ALG_0 ? HIPSOLVER_STATUS_SUCCESS
+                                                                   : HIPSOLVER_STATUS_NOT_SUPPORTED;
+
     return hipsolver::cuda2hip_status(cusolverDnSetAdvOptions((cusolverDnParams_t)params,
                                                               hipsolver::hip2cuda_function(func),
                                                               hipsolver::hip2cuda_algmode(alg)));
@@ -233,6 +238,66 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
+/******************** GETRF OUT-OF-CORE ********************/
+hipsolverStatus_t hipsolverDnXgetrfOutOfCore_bufferSize(hipsolverDnHandle_t handle,
+                                                        hipsolverDnParams_t params,
+                                                        int64_t             m,
+                                                        int64_t             n,
+                                                        hipDataType         dataTypeA,
+                                                        const void*         A,
+                                                        int64_t             lda,
+                                                        hipDataType         computeType,
+                                                        int64_t             tileSize,
+                                                        size_t*             lworkOnDevice,
+                                                        size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgetrfOutOfCore(hipsolverDnHandle_t handle,
+                                             hipsolverDnParams_t params,
+                                             int64_t             m,
+                                             int64_t             n,
+                                             hipDataType         dataTypeA,
+                                             void*               A,
+                                             int64_t             lda,
+                                             int64_t*            hostIpiv,
+                                             hipDataType         computeType,
+                                             int64_t             tileSize,
+                                             void*               workOnDevice,
+                                             size_t              lworkOnDevice,
+                                             void*               workOnHost,
+                                             size_t              lworkOnHost,
+                                             int*                hostInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
 /******************** GETRS ********************/
 hipsolverStatus_t hipsolverDnXgetrs(hipsolverDnHandle_t  handle,
                                     hipsolverDnParams_t  params,
@@ -346,6 +411,65 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
+/******************** POTRF OUT-OF-CORE ********************/
+hipsolverStatus_t hipsolverDnXpotrfOutOfCore_bufferSize(hipsolverDnHandle_t handle,
+                                                        hipsolverDnParams_t params,
+                                                        hipsolverFillMode_t uplo,
+                                                        int64_t             n,
+                                                        hipDataType         dataTypeA,
+                                                        const void*         A,
+                                                        int64_t             lda,
+                                                        hipDataType         computeType,
+                                                        int64_t             tileSize,
+                                                        size_t*             lworkOnDevice,
+                                                        size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXpotrfOutOfCore(hipsolverDnHandle_t handle,
+                                             hipsolverDnParams_t params,
+                                             hipsolverFillMode_t uplo,
+                                             int64_t             n,
+                                             hipDataType         dataTypeA,
+                                             void*               A,
+                                             int64_t             lda,
+                                             hipDataType         computeType,
+                                             int64_t             tileSize,
+                                             void*               workOnDevice,
+                                             size_t              lworkOnDevice,
+                                             void*               workOnHost,
+                                             size_t              lworkOnHost,
+                                             int*                hostInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
 /******************** POTRS ********************/
 hipsolverStatus_t hipsolverDnXpotrs(hipsolverDnHandle_t handle,
                                     hipsolverDnParams_t params,
@@ -383,4 +507,903 @@ catch(...)
 {
     return hipsolver::exception2hip_status();
 }
+
+/******************** SYEVD ********************/
+hipsolverStatus_t hipsolverDnXsyevd_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverDnParams_t params,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int64_t             n,
+                                               hipDataType         dataTypeA,
+                                               const void*         A,
+                                               int64_t             lda,
+                                               hipDataType         dataTypeW,
+                                               const void*         W,
+                                               hipDataType         computeType,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXsyevd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  (cusolverDnParams_t)params,
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  dataTypeA,
+                                                                  A,
+                                                                  lda,
+                                                                  dataTypeW,
+                                                                  W,
+                                                                  computeType,
+                                                                  lworkOnDevice,
+                                                                  lworkOnHost));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsyevd(hipsolverDnHandle_t handle,
+                                    hipsolverDnParams_t params,
+                                    hipsolverEigMode_t  jobz,
+                                    hipsolverFillMode_t uplo,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    void*               A,
+                                    int64_t             lda,
+                                    hipDataType         dataTypeW,
+                                    void*               W,
+                                    hipDataType         computeType,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXsyevd((cusolverDnHandle_t)handle,
+                                                       (cusolverDnParams_t)params,
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       dataTypeA,
+                                                       A,
+                                                       lda,
+                                                       dataTypeW,
+                                                       W,
+                                                       computeType,
+                                                       workOnDevice,
+                                                       lworkOnDevice,
+                                                       workOnHost,
+                                                       lworkOnHost,
+                                                       info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYEVDX ********************/
+hipsolverStatus_t hipsolverDnXsyevdx_bufferSize(hipsolverDnHandle_t handle,
+                                                hipsolverDnParams_t params,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverEigRange_t range,
+                                                hipsolverFillMode_t uplo,
+                                                int64_t             n,
+                                                hipDataType         dataTypeA,
+                                                const void*         A,
+                                                int64_t             lda,
+                                                void*               vl,
+                                                void*               vu,
+                                                int64_t             il,
+                                                int64_t             iu,
+                                                int64_t*            nev,
+                                                hipDataType         dataTypeW,
+                                                const void*         W,
+                                                hipDataType         computeType,
+                                                size_t*             lworkOnDevice,
+                                                size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnXsyevdx_bufferSize((cusolverDnHandle_t)handle,
+                                     (cusolverDnParams_t)params,
+                                     hipsolver::hip2cuda_evect(jobz),
+                                     hipsolver::hip2cuda_erange(range),
+                                     hipsolver::hip2cuda_fill(uplo),
+                                     n,
+                                     dataTypeA,
+                                     A,
+                                     lda,
+                                     vl,
+                                     vu,
+                                     il,
+                                     iu,
+                                     nev,
+                                     dataTypeW,
+                                     W,
+                                     computeType,
+                                     lworkOnDevice,
+                                     lworkOnHost));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsyevdx(hipsolverDnHandle_t handle,
+                                     hipsolverDnParams_t params,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverEigRange_t range,
+                                     hipsolverFillMode_t uplo,
+                                     int64_t             n,
+                                     hipDataType         dataTypeA,
+                                     void*               A,
+                                     int64_t             lda,
+                                     void*               vl,
+                                     void*               vu,
+                                     int64_t             il,
+                                     int64_t             iu,
+                                     int64_t*            nev,
+                                     hipDataType         dataTypeW,
+                                     void*               W,
+                                     hipDataType         computeType,
+                                     void*               workOnDevice,
+                                     size_t              lworkOnDevice,
+                                     void*               workOnHost,
+                                     size_t              lworkOnHost,
+                                     int*                info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXsyevdx((cusolverDnHandle_t)handle,
+                                                        (cusolverDnParams_t)params,
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        hipsolver::hip2cuda_erange(range),
+                                                        hipsolver::hip2cuda_fill(uplo),
+                                                        n,
+                                                        dataTypeA,
+                                                        A,
+                                                        lda,
+                                                        vl,
+                                                        vu,
+                                                        il,
+                                                        iu,
+                                                        nev,
+                                                        dataTypeW,
+                                                        W,
+                                                        computeType,
+                                                        workOnDevice,
+                                                        lworkOnDevice,
+                                                        workOnHost,
+                                                        lworkOnHost,
+                                                        info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** GESVD ********************/
+hipsolverStatus_t hipsolverDnXgesvd_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverDnParams_t params,
+                                               signed char         jobu,
+                                               signed char         jobv,
+                                               int64_t             m,
+                                               int64_t             n,
+                                               hipDataType         dataTypeA,
+                                               const void*         A,
+                                               int64_t             lda,
+                                               hipDataType         dataTypeS,
+                                               const void*         S,
+                                               hipDataType         dataTypeU,
+                                               const void*         U,
+                                               int64_t             ldu,
+                                               hipDataType         dataTypeV,
+                                               const void*         V,
+                                               int64_t             ldv,
+                                               hipDataType         computeType,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXgesvd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  (cusolverDnParams_t)params,
+                                                                  jobu,
+                                                                  jobv,
+                                                                  m,
+                                                                  n,
+                                                                  dataTypeA,
+                                                                  A,
+                                                                  lda,
+                                                                  dataTypeS,
+                                                                  S,
+                                                                  dataTypeU,
+                                                                  U,
+                                                                  ldu,
+                                                                  dataTypeV,
+                                                                  V,
+                                                                  ldv,
+                                                                  computeType,
+                                                                  lworkOnDevice,
+                                                                  lworkOnHost));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgesvd(hipsolverDnHandle_t handle,
+                                    hipsolverDnParams_t params,
+                                    signed char         jobu,
+                                    signed char         jobv,
+                                    int64_t             m,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    void*               A,
+                                    int64_t             lda,
+                                    hipDataType         dataTypeS,
+                                    void*               S,
+                                    hipDataType         dataTypeU,
+                                    void*               U,
+                                    int64_t             ldu,
+                                    hipDataType         dataTypeV,
+                                    void*               V,
+                                    int64_t             ldv,
+                                    hipDataType         computeType,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXgesvd((cusolverDnHandle_t)handle,
+                                                       (cusolverDnParams_t)params,
+                                                       jobu,
+                                                       jobv,
+                                                       m,
+                                                       n,
+                                                       dataTypeA,
+                                                       A,
+                                                       lda,
+                                                       dataTypeS,
+                                                       S,
+                                                       dataTypeU,
+                                                       U,
+                                                       ldu,
+                                                       dataTypeV,
+                                                       V,
+                                                       ldv,
+                                                       computeType,
+                                                       workOnDevice,
+                                                       lworkOnDevice,
+                                                       workOnHost,
+                                                       lworkOnHost,
+                                                       info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** GESVDP ********************/
+hipsolverStatus_t hipsolverDnXgesvdp_bufferSize(hipsolverDnHandle_t handle,
+                                                hipsolverDnParams_t params,
+                                                hipsolverEigMode_t  jobz,
+                                                int                 econ,
+                                                int64_t             m,
+                                                int64_t             n,
+                                                hipDataType         dataTypeA,
+                                                const void*         A,
+                                                int64_t             lda,
+                                                hipDataType         dataTypeS,
+                                                const void*         S,
+                                                hipDataType         dataTypeU,
+                                                const void*         U,
+                                                int64_t             ldu,
+                                                hipDataType         dataTypeV,
+                                                const void*         V,
+                                                int64_t             ldv,
+                                                hipDataType         computeType,
+                                                size_t*             lworkOnDevice,
+                                                size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXgesvdp_bufferSize((cusolverDnHandle_t)handle,
+                                                                   (cusolverDnParams_t)params,
+                                                                   hipsolver::hip2cuda_evect(jobz),
+                                                                   econ,
+                                                                   m,
+                                                                   n,
+                                                                   dataTypeA,
+                                                                   A,
+                                                                   lda,
+                                                                   dataTypeS,
+                                                                   S,
+                                                                   dataTypeU,
+                                                                   U,
+                                                                   ldu,
+                                                                   dataTypeV,
+                                                                   V,
+                                                                   ldv,
+                                                                   computeType,
+                                                                   lworkOnDevice,
+                                                                   lworkOnHost));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgesvdp(hipsolverDnHandle_t handle,
+                                     hipsolverDnParams_t params,
+                                     hipsolverEigMode_t  jobz,
+                                     int                 econ,
+                                     int64_t             m,
+                                     int64_t             n,
+                                     hipDataType         dataTypeA,
+                                     void*               A,
+                                     int64_t             lda,
+                                     hipDataType         dataTypeS,
+                                     void*               S,
+                                     hipDataType         dataTypeU,
+                                     void*               U,
+                                     int64_t             ldu,
+                                     hipDataType         dataTypeV,
+                                     void*               V,
+                                     int64_t             ldv,
+                                     hipDataType         computeType,
+                                     void*               workOnDevice,
+                                     size_t              lworkOnDevice,
+                                     void*               workOnHost,
+                                     size_t              lworkOnHost,
+                                     int*                info,
+                                     double*             hErrSigma)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXgesvdp((cusolverDnHandle_t)handle,
+                                                        (cusolverDnParams_t)params,
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        econ,
+                                                        m,
+                                                        n,
+                                                        dataTypeA,
+                                                        A,
+                                                        lda,
+                                                        dataTypeS,
+                                                        S,
+                                                        dataTypeU,
+                                                        U,
+                                                        ldu,
+                                                        dataTypeV,
+                                                        V,
+                                                        ldv,
+                                                        computeType,
+                                                        workOnDevice,
+                                                        lworkOnDevice,
+                                                        workOnHost,
+                                                        lworkOnHost,
+                                                        info,
+                                                        hErrSigma));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** GESVDR ********************/
+hipsolverStatus_t hipsolverDnXgesvdr_bufferSize(hipsolverDnHandle_t handle,
+                                                hipsolverDnParams_t params,
+                                                signed char         jobu,
+                                                signed char         jobv,
+                                                int64_t             m,
+                                                int64_t             n,
+                                                int64_t             k,
+                                                int64_t             p,
+                                                int64_t             niters,
+                                                hipDataType         dataTypeA,
+                                                const void*         A,
+                                                int64_t             lda,
+                                                hipDataType         dataTypeSrand,
+                                                const void*         Srand,
+                                                hipDataType         dataTypeUrand,
+                                                const void*         Urand,
+                                                int64_t             ldUrand,
+                                                hipDataType         dataTypeVrand,
+                                                const void*         Vrand,
+                                                int64_t             ldVrand,
+                                                hipDataType         computeType,
+                                                size_t*             lworkOnDevice,
+                                                size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXgesvdr_bufferSize((cusolverDnHandle_t)handle,
+                                                                   (cusolverDnParams_t)params,
+                                                                   jobu,
+                                                                   jobv,
+                                                                   m,
+                                                                   n,
+                                                                   k,
+                                                                   p,
+                                                                   niters,
+                                                                   dataTypeA,
+                                                                   A,
+                                                                   lda,
+                                                                   dataTypeSrand,
+                                                                   Srand,
+                                                                   dataTypeUrand,
+                                                                   Urand,
+                                                                   ldUrand,
+                                                                   dataTypeVrand,
+                                                                   Vrand,
+                                                                   ldVrand,
+                                                                   computeType,
+                                                                   lworkOnDevice,
+                                                                   lworkOnHost));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgesvdr(hipsolverDnHandle_t handle,
+                                     hipsolverDnParams_t params,
+                                     signed char         jobu,
+                                     signed char         jobv,
+                                     int64_t             m,
+                                     int64_t             n,
+                                     int64_t             k,
+                                     int64_t             p,
+                                     int64_t             niters,
+                                     hipDataType         dataTypeA,
+                                     void*               A,
+                                     int64_t             lda,
+                                     hipDataType         dataTypeSrand,
+                                     void*               Srand,
+                                     hipDataType         dataTypeUrand,
+                                     void*               Urand,
+                                     int64_t             ldUrand,
+                                     hipDataType         dataTypeVrand,
+                                     void*               Vrand,
+                                     int64_t             ldVrand,
+                                     hipDataType         computeType,
+                                     void*               workOnDevice,
+                                     size_t              lworkOnDevice,
+                                     void*               workOnHost,
+                                     size_t              lworkOnHost,
+                                     int*                info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXgesvdr((cusolverDnHandle_t)handle,
+                                                        (cusolverDnParams_t)params,
+                                                        jobu,
+                                                        jobv,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        p,
+                                                        niters,
+                                                        dataTypeA,
+                                                        A,
+                                                        lda,
+                                                        dataTypeSrand,
+                                                        Srand,
+                                                        dataTypeUrand,
+                                                        Urand,
+                                                        ldUrand,
+                                                        dataTypeVrand,
+                                                        Vrand,
+                                                        ldVrand,
+                                                        computeType,
+                                                        workOnDevice,
+                                                        lworkOnDevice,
+                                                        workOnHost,
+                                                        lworkOnHost,
+                                                        info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** GESVDR_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverDnXgesvdrStridedBatched_bufferSize(hipsolverDnHandle_t handle,
+                                                              hipsolverDnParams_t params,
+                                                              signed char         jobu,
+                                                              signed char         jobv,
+                                                              int64_t             m,
+                                                              int64_t             n,
+                                                              int64_t             k,
+                                                              int64_t             p,
+                                                              int64_t             niters,
+                                                              hipDataType         dataTypeA,
+                                                              const void*         A,
+                                                              int64_t             lda,
+                                                              int64_t             strideA,
+                                                              hipDataType         dataTypeSrand,
+                                                              const void*         Srand,
+                                                              int64_t             strideS,
+                                                              hipDataType         dataTypeUrand,
+                                                              const void*         Urand,
+                                                              int64_t             ldUrand,
+                                                              int64_t             strideU,
+                                                              hipDataType         dataTypeVrand,
+                                                              const void*         Vrand,
+                                                              int64_t             ldVrand,
+                                                              int64_t             strideV,
+                                                              hipDataType         computeType,
+                                                              size_t*             lworkOnDevice,
+                                                              size_t*             lworkOnHost,
+                                                              int64_t             batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgesvdrStridedBatched(hipsolverDnHandle_t handle,
+                                                   hipsolverDnParams_t params,
+                                                   signed char         jobu,
+                                                   signed char         jobv,
+                                                   int64_t             m,
+                                                   int64_t             n,
+                                                   int64_t             k,
+                                                   int64_t             p,
+                                                   int64_t             niters,
+                                                   hipDataType         dataTypeA,
+                                                   void*               A,
+                                                   int64_t             lda,
+                                                   int64_t             strideA,
+                                                   hipDataType         dataTypeSrand,
+                                                   void*               Srand,
+                                                   int64_t             strideS,
+                                                   hipDataType         dataTypeUrand,
+                                                   void*               Urand,
+                                                   int64_t             ldUrand,
+                                                   int64_t             strideU,
+                                                   hipDataType         dataTypeVrand,
+                                                   void*               Vrand,
+                                                   int64_t             ldVrand,
+                                                   int64_t             strideV,
+                                                   hipDataType         computeType,
+                                                   void*               workOnDevice,
+                                                   size_t              lworkOnDevice,
+                                                   void*               workOnHost,
+                                                   size_t              lworkOnHost,
+                                                   int*                info,
+                                                   double*             hRnrmF,
+                                                   int64_t             batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYTRS ********************/
+hipsolverStatus_t hipsolverDnXsytrs_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverFillMode_t uplo,
+                                               int64_t             n,
+                                               int64_t             nrhs,
+                                               hipDataType         dataTypeA,
+                                               const void*         A,
+                                               int64_t             lda,
+                                               const int64_t*      devIpiv,
+                                               hipDataType         dataTypeB,
+                                               void*               B,
+                                               int64_t             ldb,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnXsytrs_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  nrhs,
+                                                                  dataTypeA,
+                                                                  A,
+                                                                  lda,
+                                                                  devIpiv,
+                                                                  dataTypeB,
+                                                                  B,
+                                                                  ldb,
+                                                                  lworkOnDevice,
+                                                                  lworkOnHost));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsytrs(hipsolverDnHandle_t handle,
+                                    hipsolverFillMode_t uplo,
+                                    int64_t             n,
+                                    int64_t             nrhs,
+                                    hipDataType         dataTypeA,
+                                    const void*         A,
+                                    int64_t             lda,
+                                    const int64_t*      devIpiv,
+                                    hipDataType         dataTypeB,
+                                    void*               B,
+                                    int64_t             ldb,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnXsytrs((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       nrhs,
+                                                       dataTypeA,
+                                                       A,
+                                                       lda,
+                                                       devIpiv,
+                                                       dataTypeB,
+                                                       B,
+                                                       ldb,
+                                                       workOnDevice,
+                                                       lworkOnDevice,
+                                                       workOnHost,
+                                                       lworkOnHost,
+                                                       info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** TRTRI ********************/
+hipsolverStatus_t hipsolverDnXtrtri_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverFillMode_t uplo,
+                                               hipsolverDiagType_t diag,
+                                               int64_t             n,
+                                               hipDataType         dataTypeA,
+                                               void*               A,
+                                               int64_t             lda,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnXtrtri_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  hipsolver::hip2cuda_diag(diag),
+                                                                  n,
+                                                                  dataTypeA,
+                                                                  A,
+                                                                  lda,
+                                                                  lworkOnDevice,
+                                                                  lworkOnHost));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXtrtri(hipsolverDnHandle_t handle,
+                                    hipsolverFillMode_t uplo,
+                                    hipsolverDiagType_t diag,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    void*               A,
+                                    int64_t             lda,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnXtrtri((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       hipsolver::hip2cuda_diag(diag),
+                                                       n,
+                                                       dataTypeA,
+                                                       A,
+                                                       lda,
+                                                       workOnDevice,
+                                                       lworkOnDevice,
+                                                       workOnHost,
+                                                       lworkOnHost,
+                                                       info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYEV AUTO ********************/
+hipsolverStatus_t hipsolverDnSetSyevAutoAlgorithm(hipsolverDnHandle_t      handle,
+                                                  hipsolverSyevAlgorithm_t alg)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnGetSyevAutoAlgorithm(hipsolverDnHandle_t       handle,
+                                                  hipsolverEigMode_t        jobz,
+                                                  hipsolverEigRange_t       range,
+                                                  int64_t                   n,
+                                                  int64_t                   il,
+                                                  int64_t                   iu,
+                                                  int64_t                   batch_count,
+                                                  hipsolverSyevAlgorithm_t* alg)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!alg)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsyevAuto_bufferSize(hipsolverDnHandle_t handle,
+                                                  hipsolverDnParams_t params,
+                                                  hipsolverEigMode_t  jobz,
+                                                  hipsolverEigRange_t range,
+                                                  hipsolverFillMode_t uplo,
+                                                  int64_t             n,
+                                                  hipDataType         dataTypeA,
+                                                  const void*         A,
+                                                  int64_t             lda,
+                                                  int64_t             strideA,
+                                                  int64_t             il,
+                                                  int64_t             iu,
+                                                  hipDataType         dataTypeW,
+                                                  const void*         W,
+                                                  int64_t             strideW,
+                                                  hipDataType         computeType,
+                                                  size_t*             lworkOnDevice,
+                                                  size_t*             lworkOnHost,
+                                                  int64_t             batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsyevAuto(hipsolverDnHandle_t handle,
+                                       hipsolverDnParams_t params,
+                                       hipsolverEigMode_t  jobz,
+                                       hipsolverEigRange_t range,
+                                       hipsolverFillMode_t uplo,
+                                       int64_t             n,
+                                       hipDataType         dataTypeA,
+                                       void*               A,
+                                       int64_t             lda,
+                                       int64_t             strideA,
+                                       int64_t             il,
+                                       int64_t             iu,
+                                       hipDataType         dataTypeW,
+                                       void*               W,
+                                       int64_t             strideW,
+                                       hipDataType         computeType,
+                                       void*               workOnDevice,
+                                       size_t              lworkOnDevice,
+                                       void*               workOnHost,
+                                       size_t              lworkOnHost,
+                                       int*                info,
+                                       int64_t             batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 } //extern C
@@ -373,6 +373,204 @@ catch(...)
     return hipsolver::exception2hip_status();
 }*/
 
+/******************** CSRLSVCHOL64 ********************/
+hipsolverStatus_t hipsolverSpScsrlsvchol64(hipsolverSpHandle_t       handle,
+                                           int64_t                   n,
+                                           int64_t                   nnzA,
+                                           const hipsparseMatDescr_t descrA,
+                                           const float*              csrVal,
+                                           const int64_t*            csrRowPtr,
+                                           const int64_t*            csrColInd,
+                                           const float*              b,
+                                           float                     tolerance,
+                                           int                       reorder,
+                                           float*                    x,
+                                           int64_t*                  singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrlsvchol64(hipsolverSpHandle_t       handle,
+                                           int64_t                   n,
+                                           int64_t                   nnzA,
+                                           const hipsparseMatDescr_t descrA,
+                                           const double*             csrVal,
+                                           const int64_t*            csrRowPtr,
+                                           const int64_t*            csrColInd,
+                                           const double*             b,
+                                           double                    tolerance,
+                                           int                       reorder,
+                                           double*                   x,
+                                           int64_t*                  singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpScsrlsvcholHost64(hipsolverSpHandle_t       handle,
+                                               int64_t                   n,
+                                               int64_t                   nnzA,
+                                               const hipsparseMatDescr_t descrA,
+                                               const float*              csrVal,
+                                               const int64_t*            csrRowPtr,
+                                               const int64_t*            csrColInd,
+                                               const float*              b,
+                                               float                     tolerance,
+                                               int                       reorder,
+                                               float*                    x,
+                                               int64_t*                  singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrlsvcholHost64(hipsolverSpHandle_t       handle,
+                                               int64_t                   n,
+                                               int64_t                   nnzA,
+                                               const hipsparseMatDescr_t descrA,
+                                               const double*             csrVal,
+                                               const int64_t*            csrRowPtr,
+                                               const int64_t*            csrColInd,
+                                               const double*             b,
+                                               double                    tolerance,
+                                               int                       reorder,
+                                               double*                   x,
+                                               int64_t*                  singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** CSRLSVLDL ********************/
+hipsolverStatus_t hipsolverSpScsrlsvldl(hipsolverSpHandle_t       handle,
+                                        int                       n,
+                                        int                       nnzA,
+                                        const hipsparseMatDescr_t descrA,
+                                        const float*              csrVal,
+                                        const int*                csrRowPtr,
+                                        const int*                csrColInd,
+                                        const float*              b,
+                                        float                     tolerance,
+                                        int                       reorder,
+                                        float                     perturb,
+                                        float*                    x,
+                                        int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrlsvldl(hipsolverSpHandle_t       handle,
+                                        int                       n,
+                                        int                       nnzA,
+                                        const hipsparseMatDescr_t descrA,
+                                        const double*             csrVal,
+                                        const int*                csrRowPtr,
+                                        const int*                csrColInd,
+                                        const double*             b,
+                                        double                    tolerance,
+                                        int                       reorder,
+                                        double                    perturb,
+                                        double*                   x,
+                                        int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpScsrlsvldlHost(hipsolverSpHandle_t       handle,
+                                            int                       n,
+                                            int                       nnzA,
+                                            const hipsparseMatDescr_t descrA,
+                                            const float*              csrVal,
+                                            const int*                csrRowPtr,
+                                            const int*                csrColInd,
+                                            const float*              b,
+                                            float                     tolerance,
+                                            int                       reorder,
+                                            float                     perturb,
+                                            float*                    x,
+                                            int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrlsvldlHost(hipsolverSpHandle_t       handle,
+                                            int                       n,
+                                            int                       nnzA,
+                                            const hipsparseMatDescr_t descrA,
+                                            const double*             csrVal,
+                                            const int*                csrRowPtr,
+                                            const int*                csrColInd,
+                                            const double*             b,
+                                            double                    tolerance,
+                                            int                       reorder,
+                                            double                    perturb,
+                                            double*                   x,
+                                            int*                      singularity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
 /******************** CSRLSVQR ********************/
 hipsolverStatus_t hipsolverSpScsrlsvqr(hipsolverSpHandle_t       handle,
                                        int                       n,
@@ -522,4 +720,226 @@ catch(...)
     return hipsolver::exception2hip_status();
 }*/
 
+/******************** CSRPCG ********************/
+hipsolverStatus_t hipsolverSpScsrpcg(hipsolverSpHandle_t       handle,
+                                     int                       n,
+                                     int                       nnzA,
+                                     const hipsparseMatDescr_t descrA,
+                                     const float*              csrVal,
+                                     const int*                csrRowPtr,
+                                     const int*                csrColInd,
+                                     const float*              b,
+                                     float                     tolerance,
+                                     int                       maxiter,
+                                     hipsolverSpPrecond_t      precond,
+                                     int                       reusePrecond,
+                                     float*                    x,
+                                     int*                      niters,
+                                     float*                    resHistory)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrpcg(hipsolverSpHandle_t       handle,
+                                     int                       n,
+                                     int                       nnzA,
+                                     const hipsparseMatDescr_t descrA,
+                                     const double*             csrVal,
+                                     const int*                csrRowPtr,
+                                     const int*                csrColInd,
+                                     const double*             b,
+                                     double                    tolerance,
+                                     int                       maxiter,
+                                     hipsolverSpPrecond_t      precond,
+                                     int                       reusePrecond,
+                                     double*                   x,
+                                     int*                      niters,
+                                     double*                   resHistory)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpScsrpcgHost(hipsolverSpHandle_t       handle,
+                                         int                       n,
+                                         int                       nnzA,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              csrVal,
+                                         const int*                csrRowPtr,
+                                         const int*                csrColInd,
+                                         const float*              b,
+                                         float                     tolerance,
+                                         int                       maxiter,
+                                         hipsolverSpPrecond_t      precond,
+                                         int                       reusePrecond,
+                                         float*                    x,
+                                         int*                      niters,
+                                         float*                    resHistory)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrpcgHost(hipsolverSpHandle_t       handle,
+                                         int                       n,
+                                         int                       nnzA,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             csrVal,
+                                         const int*                csrRowPtr,
+                                         const int*                csrColInd,
+                                         const double*             b,
+                                         double                    tolerance,
+                                         int                       maxiter,
+                                         hipsolverSpPrecond_t      precond,
+                                         int                       reusePrecond,
+                                         double*                   x,
+                                         int*                      niters,
+                                         double*                   resHistory)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** CSRGMRES ********************/
+hipsolverStatus_t hipsolverSpScsrgmres(hipsolverSpHandle_t       handle,
+                                       int                       n,
+                                       int                       nnzA,
+                                       const hipsparseMatDescr_t descrA,
+                                       const float*              csrVal,
+                                       const int*                csrRowPtr,
+                                       const int*                csrColInd,
+                                       const float*              b,
+                                       float                     tolerance,
+                                       int                       maxiter,
+                                       int                       restart,
+                                       hipsolverSpPrecond_t      precond,
+                                       int                       reusePrecond,
+                                       float*                    x,
+                                       int*                      niters,
+                                       float*                    resHistory)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrgmres(hipsolverSpHandle_t       handle,
+                                       int                       n,
+                                       int                       nnzA,
+                                       const hipsparseMatDescr_t descrA,
+                                       const double*             csrVal,
+                                       const int*                csrRowPtr,
+                                       const int*                csrColInd,
+                                       const double*             b,
+                                       double                    tolerance,
+                                       int                       maxiter,
+                                       int                       restart,
+                                       hipsolverSpPrecond_t      precond,
+                                       int                       reusePrecond,
+                                       double*                   x,
+                                       int*                      niters,
+                                       double*                   resHistory)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpScsrgmresHost(hipsolverSpHandle_t       handle,
+                                           int                       n,
+                                           int                       nnzA,
+                                           const hipsparseMatDescr_t descrA,
+                                           const float*              csrVal,
+                                           const int*                csrRowPtr,
+                                           const int*                csrColInd,
+                                           const float*              b,
+                                           float                     tolerance,
+                                           int                       maxiter,
+                                           int                       restart,
+                                           hipsolverSpPrecond_t      precond,
+                                           int                       reusePrecond,
+                                           float*                    x,
+                                           int*                      niters,
+                                           float*                    resHistory)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpDcsrgmresHost(hipsolverSpHandle_t       handle,
+                                           int                       n,
+                                           int                       nnzA,
+                                           const hipsparseMatDescr_t descrA,
+                                           const double*             csrVal,
+                                           const int*                csrRowPtr,
+                                           const int*                csrColInd,
+                                           const double*             b,
+                                           double                    tolerance,
+                                           int                       maxiter,
+                                           int                       restart,
+                                           hipsolverSpPrecond_t      precond,
+                                           int                       reusePrecond,
+                                           double*                   x,
+                                           int*                      niters,
+                                           double*                   resHistory)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
 } //extern C